@@ -24,9 +24,14 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <termios.h>
+#include <poll.h>
+#include <errno.h>
+#include <unistd.h>
 #include <utils/util_misc.h>
 #include <utils/util_file.h>
 #include <utils/cJSON.h>
+#include <utils/util_periodic.h>
+#include <utils/util_time.h>
 #include <dji_aircraft_info.h>
 #include "test_flight_controller_command_flying.h"
 #include "dji_flight_controller.h"
@@ -49,40 +54,64 @@ using namespace cv;
 #define DJI_TEST_COMMAND_FLYING_CONTROL_SPEED_DEFAULT                    5
 #define DJI_TEST_COMMAND_FLYING_RC_LOST_ACTION_STR_MAX_LEN               32
 #define DJI_TEST_COMMAND_FLYING_CONFIG_DIR_PATH_LEN_MAX                  (256)
+#define DJI_TEST_COMMAND_FLYING_STATUS_REFRESH_TIMEOUT_MS                (100)
+#define DJI_TEST_COMMAND_FLYING_CONFIG_REFRESH_INTERVAL_MS               (1000)
+#define DJI_TEST_COMMAND_FLYING_CPU_USAGE_PRINT_INTERVAL_MS              (10000)
 
 /* Private types -------------------------------------------------------------*/
+/* Latest values of the subscribed topics, written by the subscription callbacks. */
+typedef struct {
+    T_DjiFcSubscriptionQuaternion quaternion;
+    T_DjiFcSubscriptionGpsPosition gpsPosition;
+    T_DjiFcSubscriptionHeightFusion heightFusion;
+    T_DjiFcSubscriptionPositionVO positionVo;
+    T_DjiFcSubscriptionControlDevice controlDevice;
+    T_DjiFcSubscriptionSingleBatteryInfo batteryInfo1;
+    T_DjiFcSubscriptionSingleBatteryInfo batteryInfo2;
+} T_DjiUserFlightStatus;
 
 /* Private values -------------------------------------------------------------*/
 static T_DjiTaskHandle s_commandFlyingTaskHandle;
 static T_DjiTaskHandle s_statusDisplayTaskHandle;
-static T_DjiFlightControllerJoystickCommand s_flyingCommand = {0};
+static T_DjiFlightControllerJoystickCommand s_flyingCommand = {};
 static uint16_t s_inputFlag = 0;
 static dji_f32_t s_flyingSpeed = DJI_TEST_COMMAND_FLYING_CONTROL_SPEED_DEFAULT;
 static uint16_t s_goHomeAltitude = DJI_TEST_COMMAND_FLYING_GO_HOME_ALTITUDE;
 static char s_rcLostActionString[DJI_TEST_COMMAND_FLYING_RC_LOST_ACTION_STR_MAX_LEN] = {0};
-static T_DjiFlightControllerHomeLocation s_homeLocation = {0};
-static T_DjiFcSubscriptionGpsPosition s_gpsPosition = {0};
+static T_DjiFlightControllerHomeLocation s_homeLocation = {};
 static bool isFirstUpdateConfig = false;
 static bool isCommandFlyingTaskStart = false;
-static uint32_t s_statusDisplayTaskCnt = 0;
-static T_DjiFcSubscriptionSingleBatteryInfo singleBatteryInfo1 = {0};
-static T_DjiFcSubscriptionSingleBatteryInfo singleBatteryInfo2 = {0};
+static T_DjiUserFlightStatus s_flightStatus = {};
+static bool s_isFlightStatusUpdated = false;
+static T_DjiMutexHandle s_flightStatusMutex = nullptr;
+static T_DjiSemaHandle s_flightStatusUpdateSema = nullptr;
 
 /* Private functions declaration ---------------------------------------------*/
 static void *DjiUser_FlightControllerCommandFlyingTask(void *arg);
 static void *DjiUser_FlightControllerStatusDisplayTask(void *arg);
-static void DjiUser_ShowFlightStatusByOpenCV(void);
 static void DjiUser_FlightControllerVelocityAndYawRateCtrl(T_DjiFlightControllerJoystickCommand command);
 static int DjiUser_ScanKeyboardInput(void);
 static T_DjiReturnCode
 DjiUser_FlightCtrlJoystickCtrlAuthSwitchEventCb(T_DjiFlightControllerJoystickCtrlAuthorityEventInfo eventData);
-static T_DjiVector3f DjiUser_FlightControlGetValueOfQuaternion(void);
-static T_DjiFcSubscriptionGpsPosition DjiUser_FlightControlGetValueOfGpsPosition(void);
-static T_DjiFcSubscriptionAltitudeOfHomePoint DjiUser_FlightControlGetValueOfRelativeHeight(void);
-static T_DjiFcSubscriptionPositionVO DjiUser_FlightControlGetValueOfPositionVo(void);
-static T_DjiFcSubscriptionControlDevice DjiUser_FlightControlGetValueOfControlDevice(void);
-static T_DjiFcSubscriptionSingleBatteryInfo DjiUser_FlightControlGetValueOfBattery1(void);
-static T_DjiFcSubscriptionSingleBatteryInfo DjiUser_FlightControlGetValueOfBattery2(void);
+#ifdef OPEN_CV_INSTALLED
+static void DjiUser_ShowFlightStatusByOpenCV(const T_DjiUserFlightStatus *flightStatus);
+static T_DjiVector3f DjiUser_FlightControlQuaternionToEulerAngle(T_DjiFcSubscriptionQuaternion quaternion);
+#endif
+static void DjiUser_FlightControlUpdateStatus(void *value, const uint8_t *data, uint16_t dataSize, uint16_t valueSize);
+static T_DjiReturnCode DjiUser_FlightControlQuaternionCallback(const uint8_t *data, uint16_t dataSize,
+                                                               const T_DjiDataTimestamp *timestamp);
+static T_DjiReturnCode DjiUser_FlightControlGpsPositionCallback(const uint8_t *data, uint16_t dataSize,
+                                                                const T_DjiDataTimestamp *timestamp);
+static T_DjiReturnCode DjiUser_FlightControlHeightFusionCallback(const uint8_t *data, uint16_t dataSize,
+                                                                 const T_DjiDataTimestamp *timestamp);
+static T_DjiReturnCode DjiUser_FlightControlPositionVoCallback(const uint8_t *data, uint16_t dataSize,
+                                                               const T_DjiDataTimestamp *timestamp);
+static T_DjiReturnCode DjiUser_FlightControlControlDeviceCallback(const uint8_t *data, uint16_t dataSize,
+                                                                  const T_DjiDataTimestamp *timestamp);
+static T_DjiReturnCode DjiUser_FlightControlBattery1Callback(const uint8_t *data, uint16_t dataSize,
+                                                             const T_DjiDataTimestamp *timestamp);
+static T_DjiReturnCode DjiUser_FlightControlBattery2Callback(const uint8_t *data, uint16_t dataSize,
+                                                             const T_DjiDataTimestamp *timestamp);
 static T_DjiReturnCode DjiUser_FlightControlUpdateConfig(void);
 
 /* Exported functions definition ---------------------------------------------*/
@@ -90,6 +119,19 @@ void DjiUser_RunFlightControllerCommandFlyingSample(void)
 {
     T_DjiReturnCode returnCode;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    int input;
+
+    returnCode = osalHandler->MutexCreate(&s_flightStatusMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create flight status mutex failed, errno = 0x%08llX", returnCode);
+        return;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_flightStatusUpdateSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create flight status semaphore failed, errno = 0x%08llX", returnCode);
+        return;
+    }
 
     returnCode = osalHandler->TaskCreate("command_flying_task", DjiUser_FlightControllerCommandFlyingTask,
                                          DJI_TEST_COMMAND_FLYING_TASK_STACK_SIZE, NULL,
@@ -110,8 +152,16 @@ void DjiUser_RunFlightControllerCommandFlyingSample(void)
     osalHandler->TaskSleepMs(1000);
 
     while (1) {
-        osalHandler->TaskSleepMs(1);
-        switch (DjiUser_ScanKeyboardInput()) {
+        input = DjiUser_ScanKeyboardInput();
+        if (input == EOF) {
+            // Keep flying tasks alive, only the keyboard is gone.
+            USER_LOG_WARN("Keyboard input is closed, stop scanning keyboard.");
+            while (1) {
+                osalHandler->TaskSleepMs(1000);
+            }
+        }
+
+        switch (input) {
             case 'W':
             case 'w':
                 s_flyingCommand.x = s_flyingSpeed;
@@ -222,8 +272,10 @@ void DjiUser_RunFlightControllerCommandFlyingSample(void)
                 break;
             case 'X':
             case 'x':
-                s_homeLocation.longitude = (dji_f64_t) s_gpsPosition.x / 10000000;
-                s_homeLocation.latitude = (dji_f64_t) s_gpsPosition.y / 10000000;
+                osalHandler->MutexLock(s_flightStatusMutex);
+                s_homeLocation.longitude = (dji_f64_t) s_flightStatus.gpsPosition.x / 10000000;
+                s_homeLocation.latitude = (dji_f64_t) s_flightStatus.gpsPosition.y / 10000000;
+                osalHandler->MutexUnlock(s_flightStatusMutex);
                 DjiFlightController_SetHomeLocationUsingCurrentAircraftLocation();
                 USER_LOG_INFO(" - Set home location\r\n");
                 break;
@@ -282,8 +334,10 @@ static void *DjiUser_FlightControllerCommandFlyingTask(void *arg)
 {
     T_DjiReturnCode returnCode;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-    T_DjiFlightControllerRidInfo ridInfo = {0};
-    T_DjiFlightControllerGeneralInfo generalInfo = {0};
+    T_DjiFlightControllerRidInfo ridInfo = {};
+    T_DjiFlightControllerGeneralInfo generalInfo = {};
+    T_UtilPeriodic controlLoop;
+    uint32_t cycleCount = 1;
 
     ridInfo.latitude = 22.542812;
     ridInfo.longitude = 113.958902;
@@ -304,7 +358,7 @@ static void *DjiUser_FlightControllerCommandFlyingTask(void *arg)
     /*! subscribe fc data */
     returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
                                                   DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
-                                                  NULL);
+                                                  DjiUser_FlightControlQuaternionCallback);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Subscribe topic flight status failed, error code:0x%08llX", returnCode);
         return NULL;
@@ -312,7 +366,7 @@ static void *DjiUser_FlightControllerCommandFlyingTask(void *arg)
 
     returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION,
                                                   DJI_DATA_SUBSCRIPTION_TOPIC_5_HZ,
-                                                  NULL);
+                                                  DjiUser_FlightControlGpsPositionCallback);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Subscribe topic gps failed, error code:0x%08llX", returnCode);
         return NULL;
@@ -320,7 +374,7 @@ static void *DjiUser_FlightControllerCommandFlyingTask(void *arg)
 
     returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_HEIGHT_FUSION,
                                                   DJI_DATA_SUBSCRIPTION_TOPIC_10_HZ,
-                                                  NULL);
+                                                  DjiUser_FlightControlHeightFusionCallback);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Subscribe topic altitude failed, error code:0x%08llX", returnCode);
         return NULL;
@@ -328,7 +382,7 @@ static void *DjiUser_FlightControllerCommandFlyingTask(void *arg)
 
     returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_POSITION_VO,
                                                   DJI_DATA_SUBSCRIPTION_TOPIC_10_HZ,
-                                                  NULL);
+                                                  DjiUser_FlightControlPositionVoCallback);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Subscribe topic altitude failed, error code:0x%08llX", returnCode);
         return NULL;
@@ -336,12 +390,26 @@ static void *DjiUser_FlightControllerCommandFlyingTask(void *arg)
 
     returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_CONTROL_DEVICE,
                                                   DJI_DATA_SUBSCRIPTION_TOPIC_5_HZ,
-                                                  NULL);
+                                                  DjiUser_FlightControlControlDeviceCallback);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Subscribe topic altitude failed, error code:0x%08llX", returnCode);
         return NULL;
     }
 
+    returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_BATTERY_SINGLE_INFO_INDEX1,
+                                                  DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
+                                                  DjiUser_FlightControlBattery1Callback);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Subscribe topic battery1 failed, error code:0x%08llX", returnCode);
+    }
+
+    returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_BATTERY_SINGLE_INFO_INDEX2,
+                                                  DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
+                                                  DjiUser_FlightControlBattery2Callback);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Subscribe topic battery2 failed, error code:0x%08llX", returnCode);
+    }
+
     osalHandler->TaskSleepMs(1000);
 
     returnCode = DjiUser_FlightControlUpdateConfig();
@@ -363,9 +431,11 @@ static void *DjiUser_FlightControllerCommandFlyingTask(void *arg)
     }
 
     isCommandFlyingTaskStart = true;
+    osalHandler->SemaphorePost(s_flightStatusUpdateSema);
+    UtilPeriodic_Init(&controlLoop, 1000000 / DJI_TEST_COMMAND_FLYING_CTRL_FREQ, NULL);
 
     while (true) {
-        s_inputFlag++;
+        s_inputFlag += cycleCount;
         if (s_inputFlag > 25) {
             s_flyingCommand.x = 0;
             s_flyingCommand.y = 0;
@@ -376,73 +446,102 @@ static void *DjiUser_FlightControllerCommandFlyingTask(void *arg)
 
         DjiUser_FlightControllerVelocityAndYawRateCtrl(s_flyingCommand);
 
-        osalHandler->TaskSleepMs(1000 / DJI_TEST_COMMAND_FLYING_CTRL_FREQ);
+        cycleCount = UtilPeriodic_WaitNextCycle(&controlLoop);
+        if (controlLoop.cycleCount % (60 * DJI_TEST_COMMAND_FLYING_CTRL_FREQ) == 0) {
+            UtilPeriodic_PrintStatistics(&controlLoop, "command flying");
+        }
     }
 }
 
 static void *DjiUser_FlightControllerStatusDisplayTask(void *arg)
 {
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiUserFlightStatus flightStatus;
+#ifdef SYSTEM_ARCH_LINUX
+    T_DjiRunTimeStamps lastRunTimeStamps = DjiUtilTime_GetRunTimeStamps();
+    T_DjiRunTimeStamps runTimeStamps;
+#endif
+
+    // Sleep until the command flying task has subscribed the topics, instead of polling the start flag.
+    while (isCommandFlyingTaskStart == false) {
+        osalHandler->SemaphoreWait(s_flightStatusUpdateSema);
+    }
 
     while (1) {
-        if (isCommandFlyingTaskStart == false) {
-            continue;
-        }
+        // Woken by the subscription callbacks, the timeout only keeps the window responsive without new data.
+        osalHandler->SemaphoreTimedWait(s_flightStatusUpdateSema, DJI_TEST_COMMAND_FLYING_STATUS_REFRESH_TIMEOUT_MS);
+
+        osalHandler->MutexLock(s_flightStatusMutex);
+        flightStatus = s_flightStatus;
+        s_isFlightStatusUpdated = false;
+        osalHandler->MutexUnlock(s_flightStatusMutex);
+
 #ifdef OPEN_CV_INSTALLED
-        DjiUser_ShowFlightStatusByOpenCV();
+        DjiUser_ShowFlightStatusByOpenCV(&flightStatus);
+#else
+        USER_UTIL_UNUSED(flightStatus);
+#endif
+
+#ifdef SYSTEM_ARCH_LINUX
+        runTimeStamps = DjiUtilTime_GetRunTimeStamps();
+        if (runTimeStamps.realUsec - lastRunTimeStamps.realUsec >=
+            DJI_TEST_COMMAND_FLYING_CPU_USAGE_PRINT_INTERVAL_MS * 1000) {
+            USER_LOG_INFO("Process cpu usage: %.1f%%",
+                          (dji_f64_t) (runTimeStamps.userUsec - lastRunTimeStamps.userUsec +
+                                       runTimeStamps.sysUsec - lastRunTimeStamps.sysUsec) * 100 /
+                          (dji_f64_t) (runTimeStamps.realUsec - lastRunTimeStamps.realUsec));
+            lastRunTimeStamps = runTimeStamps;
+        }
 #endif
-        osalHandler->TaskSleepMs(1000 / DJI_TEST_COMMAND_FLYING_CTRL_FREQ);
     }
 }
 
-static void DjiUser_ShowFlightStatusByOpenCV(void)
-{
 #ifdef OPEN_CV_INSTALLED
-    E_DjiFlightControllerGoHomeAltitude goHomeAltitude = 0;
-    T_DjiVector3f aircraftAngles = {0};
-    T_DjiFcSubscriptionAltitudeOfHomePoint altitudeOfHomePoint = {0};
-    E_DjiFlightControllerRtkPositionEnableStatus rtkPositionEnableStatus;
-    E_DjiFlightControllerRCLostAction rcLostAction = DJI_FLIGHT_CONTROLLER_RC_LOST_ACTION_HOVER;
-    E_DjiFlightControllerObstacleAvoidanceEnableStatus downwardsVisEnable;
-    E_DjiFlightControllerObstacleAvoidanceEnableStatus upwardsVisEnable;
-    E_DjiFlightControllerObstacleAvoidanceEnableStatus horizontalVisEnable;
+static void DjiUser_ShowFlightStatusByOpenCV(const T_DjiUserFlightStatus *flightStatus)
+{
+    static E_DjiFlightControllerRtkPositionEnableStatus rtkPositionEnableStatus;
+    static E_DjiFlightControllerRCLostAction rcLostAction = DJI_FLIGHT_CONTROLLER_RC_LOST_ACTION_HOVER;
+    static E_DjiFlightControllerObstacleAvoidanceEnableStatus downwardsVisEnable;
+    static E_DjiFlightControllerObstacleAvoidanceEnableStatus upwardsVisEnable;
+    static E_DjiFlightControllerObstacleAvoidanceEnableStatus horizontalVisEnable;
 //    E_DjiFlightControllerObstacleAvoidanceEnableStatus upwardsRadarEnable;
 //    E_DjiFlightControllerObstacleAvoidanceEnableStatus horizontalRadarEnable;
-    T_DjiFcSubscriptionControlDevice controlDevice;
-    T_DjiFcSubscriptionPositionVO positionVo;
+    static uint32_t lastConfigRefreshTimeMs = 0;
+    static bool isConfigRefreshed = false;
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiVector3f aircraftAngles = {};
     T_DjiAircraftInfoBaseInfo aircraftInfoBaseInfo;
     T_DjiReturnCode returnCode;
-
-    returnCode = DjiAircraftInfo_GetBaseInfo(&aircraftInfoBaseInfo);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("get aircraft base info error");
-    }
+    uint32_t currentTimeMs = 0;
 
     Mat img(480, 1000, CV_8UC1, cv::Scalar(0));
 
-    // Get latest flight status
-    if (aircraftInfoBaseInfo.aircraftSeries != DJI_AIRCRAFT_SERIES_M300) {
-        DjiFlightController_GetRCLostAction(&rcLostAction);
-    }
-    DjiFlightController_GetGoHomeAltitude(&s_goHomeAltitude);
-    DjiFlightController_GetRtkPositionEnableStatus(&rtkPositionEnableStatus);
-    DjiFlightController_GetDownwardsVisualObstacleAvoidanceEnableStatus(&downwardsVisEnable);
-//    DjiFlightController_GetUpwardsRadarObstacleAvoidanceEnableStatus(&upwardsRadarEnable);
-    DjiFlightController_GetUpwardsVisualObstacleAvoidanceEnableStatus(&upwardsVisEnable);
-//    DjiFlightController_GetHorizontalRadarObstacleAvoidanceEnableStatus(&horizontalRadarEnable);
-    DjiFlightController_GetHorizontalVisualObstacleAvoidanceEnableStatus(&horizontalVisEnable);
-
-    controlDevice = DjiUser_FlightControlGetValueOfControlDevice();
-    aircraftAngles = DjiUser_FlightControlGetValueOfQuaternion();
-    s_gpsPosition = DjiUser_FlightControlGetValueOfGpsPosition();
-    altitudeOfHomePoint = DjiUser_FlightControlGetValueOfRelativeHeight();
-    positionVo = DjiUser_FlightControlGetValueOfPositionVo();
-
-    if (s_statusDisplayTaskCnt++ % 20 == 0) {
-        singleBatteryInfo1 = DjiUser_FlightControlGetValueOfBattery1();
-        singleBatteryInfo2 = DjiUser_FlightControlGetValueOfBattery2();
+    // Settings are requests to the aircraft, refresh them at a low rate instead of on every frame
+    osalHandler->GetTimeMs(&currentTimeMs);
+    if (isConfigRefreshed == false ||
+        currentTimeMs - lastConfigRefreshTimeMs >= DJI_TEST_COMMAND_FLYING_CONFIG_REFRESH_INTERVAL_MS) {
+        returnCode = DjiAircraftInfo_GetBaseInfo(&aircraftInfoBaseInfo);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("get aircraft base info error");
+        }
+
+        if (aircraftInfoBaseInfo.aircraftSeries != DJI_AIRCRAFT_SERIES_M300) {
+            DjiFlightController_GetRCLostAction(&rcLostAction);
+        }
+        DjiFlightController_GetGoHomeAltitude(&s_goHomeAltitude);
+        DjiFlightController_GetRtkPositionEnableStatus(&rtkPositionEnableStatus);
+        DjiFlightController_GetDownwardsVisualObstacleAvoidanceEnableStatus(&downwardsVisEnable);
+//        DjiFlightController_GetUpwardsRadarObstacleAvoidanceEnableStatus(&upwardsRadarEnable);
+        DjiFlightController_GetUpwardsVisualObstacleAvoidanceEnableStatus(&upwardsVisEnable);
+//        DjiFlightController_GetHorizontalRadarObstacleAvoidanceEnableStatus(&horizontalRadarEnable);
+        DjiFlightController_GetHorizontalVisualObstacleAvoidanceEnableStatus(&horizontalVisEnable);
+
+        lastConfigRefreshTimeMs = currentTimeMs;
+        isConfigRefreshed = true;
     }
 
+    aircraftAngles = DjiUser_FlightControlQuaternionToEulerAngle(flightStatus->quaternion);
+
     // Display latest flight status
     cv::putText(img, "Status: ", cv::Point(30, 20), FONT_HERSHEY_SIMPLEX, 0.6,
                 cv::Scalar(255, 0, 0));
@@ -453,19 +552,19 @@ static void DjiUser_ShowFlightStatusByOpenCV(void)
                 cv::Scalar(200, 0, 0));
     cv::putText(img, "Yaw: " + cv::format("%.4f", aircraftAngles.z), cv::Point(50, 110), FONT_HERSHEY_SIMPLEX, 0.5,
                 cv::Scalar(200, 0, 0));
-    cv::putText(img, "WorldX: " + cv::format("%.4f", positionVo.x), cv::Point(50, 140), FONT_HERSHEY_SIMPLEX, 0.5,
+    cv::putText(img, "WorldX: " + cv::format("%.4f", flightStatus->positionVo.x), cv::Point(50, 140), FONT_HERSHEY_SIMPLEX, 0.5,
                 cv::Scalar(200, 0, 0));
-    cv::putText(img, "WorldY: " + cv::format("%.4f", positionVo.y), cv::Point(50, 170), FONT_HERSHEY_SIMPLEX, 0.5,
+    cv::putText(img, "WorldY: " + cv::format("%.4f", flightStatus->positionVo.y), cv::Point(50, 170), FONT_HERSHEY_SIMPLEX, 0.5,
                 cv::Scalar(200, 0, 0));
-    cv::putText(img, "WorldZ: " + cv::format("%.4f", altitudeOfHomePoint), cv::Point(50, 200), FONT_HERSHEY_SIMPLEX,
+    cv::putText(img, "WorldZ: " + cv::format("%.4f", flightStatus->heightFusion), cv::Point(50, 200), FONT_HERSHEY_SIMPLEX,
                 0.5, cv::Scalar(200, 0, 0));
-    cv::putText(img, "Latitude: " + cv::format("%.4f", (dji_f64_t) s_gpsPosition.y / 10000000), cv::Point(50, 230),
+    cv::putText(img, "Latitude: " + cv::format("%.4f", (dji_f64_t) flightStatus->gpsPosition.y / 10000000), cv::Point(50, 230),
                 FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(200, 0, 0));
-    cv::putText(img, "Longitude: " + cv::format("%.4f", (dji_f64_t) s_gpsPosition.x / 10000000), cv::Point(50, 260),
+    cv::putText(img, "Longitude: " + cv::format("%.4f", (dji_f64_t) flightStatus->gpsPosition.x / 10000000), cv::Point(50, 260),
                 FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(200, 0, 0));
-    cv::putText(img, "Battery1: " + cv::format("%d%%", singleBatteryInfo1.batteryCapacityPercent), cv::Point(50, 290),
+    cv::putText(img, "Battery1: " + cv::format("%d%%", flightStatus->batteryInfo1.batteryCapacityPercent), cv::Point(50, 290),
                 FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(200, 0, 0));
-    cv::putText(img, "Battery2: " + cv::format("%d%%", singleBatteryInfo2.batteryCapacityPercent), cv::Point(50, 320),
+    cv::putText(img, "Battery2: " + cv::format("%d%%", flightStatus->batteryInfo2.batteryCapacityPercent), cv::Point(50, 320),
                 FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(200, 0, 0));
 
     cv::putText(img, "Config: ", cv::Point(300, 20), FONT_HERSHEY_SIMPLEX, 0.6,
@@ -489,7 +588,7 @@ static void DjiUser_ShowFlightStatusByOpenCV(void)
                 FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(200, 0, 0));
     cv::putText(img, "-> horizontalVisEnable(Sync APP): " + cv::format("%d", horizontalVisEnable), cv::Point(320, 290),
                 FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(200, 0, 0));
-    cv::putText(img, "-> ControlDevice: " + cv::format("%d", controlDevice.deviceStatus), cv::Point(320, 320),
+    cv::putText(img, "-> ControlDevice: " + cv::format("%d", flightStatus->controlDevice.deviceStatus), cv::Point(320, 320),
                 FONT_HERSHEY_SIMPLEX, 0.5, cv::Scalar(200, 0, 0));
 
     cv::putText(img,
@@ -504,8 +603,8 @@ static void DjiUser_ShowFlightStatusByOpenCV(void)
 
     cv::imshow("Payload SDK Command Flying Data Observation Window", img);
     cv::waitKey(1);
-#endif
 }
+#endif
 
 static void DjiUser_FlightControllerVelocityAndYawRateCtrl(T_DjiFlightControllerJoystickCommand command)
 {
@@ -528,9 +627,15 @@ static void DjiUser_FlightControllerVelocityAndYawRateCtrl(T_DjiFlightController
     }
 }
 
+/**
+ * @brief Block until a key is pressed, the caller sleeps in poll() instead of checking stdin periodically.
+ * @return The key, or EOF if stdin is closed.
+ */
 static int DjiUser_ScanKeyboardInput(void)
 {
-    int input;
+    int input = EOF;
+    unsigned char inputChar;
+    struct pollfd inputFd;
     struct termios new_settings;
     struct termios stored_settings;
 
@@ -538,11 +643,21 @@ static int DjiUser_ScanKeyboardInput(void)
     new_settings = stored_settings;
     new_settings.c_lflag &= (~ICANON);
     new_settings.c_cc[VTIME] = 0;
-    tcgetattr(0, &stored_settings);
     new_settings.c_cc[VMIN] = 1;
     tcsetattr(0, TCSANOW, &new_settings);
 
-    input = getchar();
+    inputFd.fd = STDIN_FILENO;
+    inputFd.events = POLLIN;
+    inputFd.revents = 0;
+    while (poll(&inputFd, 1, -1) < 0) {
+        if (errno != EINTR) {
+            break;
+        }
+    }
+
+    if ((inputFd.revents & POLLIN) && read(STDIN_FILENO, &inputChar, 1) == 1) {
+        input = inputChar;
+    }
     tcsetattr(0, TCSANOW, &stored_settings);
 
     return input;
@@ -610,27 +725,12 @@ DjiUser_FlightCtrlJoystickCtrlAuthSwitchEventCb(T_DjiFlightControllerJoystickCtr
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-static T_DjiVector3f DjiUser_FlightControlGetValueOfQuaternion(void)
+#ifdef OPEN_CV_INSTALLED
+static T_DjiVector3f DjiUser_FlightControlQuaternionToEulerAngle(T_DjiFcSubscriptionQuaternion quaternion)
 {
-    T_DjiReturnCode djiStat;
-    T_DjiFcSubscriptionQuaternion quaternion = {0};
-    T_DjiDataTimestamp quaternionTimestamp = {0};
     dji_f64_t pitch, yaw, roll;
     T_DjiVector3f vector3F;
 
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
-                                                      (uint8_t *) &quaternion,
-                                                      sizeof(T_DjiFcSubscriptionQuaternion),
-                                                      &quaternionTimestamp);
-
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic quaternion error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", quaternionTimestamp.millisecond,
-                       quaternionTimestamp.microsecond);
-        USER_LOG_DEBUG("Quaternion: %f %f %f %f.", quaternion.q0, quaternion.q1, quaternion.q2, quaternion.q3);
-    }
-
     pitch = (dji_f64_t) asinf(-2 * quaternion.q1 * quaternion.q3 + 2 * quaternion.q0 * quaternion.q2) * 57.3;
     roll = (dji_f64_t) atan2f(2 * quaternion.q2 * quaternion.q3 + 2 * quaternion.q0 * quaternion.q1,
                               -2 * quaternion.q1 * quaternion.q1 - 2 * quaternion.q2 * quaternion.q2 + 1) * 57.3;
@@ -644,131 +744,93 @@ static T_DjiVector3f DjiUser_FlightControlGetValueOfQuaternion(void)
 
     return vector3F;
 }
+#endif
 
-static T_DjiFcSubscriptionGpsPosition DjiUser_FlightControlGetValueOfGpsPosition(void)
+/**
+ * @brief Store a topic value and wake the status display task. Updates arriving before the task has rendered the
+ * previous ones are coalesced into a single wake up.
+ */
+static void DjiUser_FlightControlUpdateStatus(void *value, const uint8_t *data, uint16_t dataSize, uint16_t valueSize)
 {
-    T_DjiReturnCode djiStat;
-    T_DjiDataTimestamp timestamp = {0};
-    T_DjiFcSubscriptionGpsPosition gpsPosition;
-
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION,
-                                                      (uint8_t *) &gpsPosition,
-                                                      sizeof(T_DjiFcSubscriptionGpsPosition),
-                                                      &timestamp);
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    bool isWakeUpNeeded;
 
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic quaternion error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", timestamp.millisecond,
-                       timestamp.microsecond);
+    if (data == nullptr || dataSize < valueSize) {
+        return;
     }
 
-    return gpsPosition;
-}
-
-static T_DjiFcSubscriptionAltitudeOfHomePoint DjiUser_FlightControlGetValueOfRelativeHeight(void)
-{
-    T_DjiReturnCode djiStat;
-    T_DjiDataTimestamp timestamp = {0};
-    T_DjiFcSubscriptionAltitudeOfHomePoint altitudeOfHomePoint;
-
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_HEIGHT_FUSION,
-                                                      (uint8_t *) &altitudeOfHomePoint,
-                                                      sizeof(T_DjiFcSubscriptionAltitudeOfHomePoint),
-                                                      &timestamp);
+    osalHandler->MutexLock(s_flightStatusMutex);
+    memcpy(value, data, valueSize);
+    isWakeUpNeeded = !s_isFlightStatusUpdated;
+    s_isFlightStatusUpdated = true;
+    osalHandler->MutexUnlock(s_flightStatusMutex);
 
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic quaternion error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", timestamp.millisecond,
-                       timestamp.microsecond);
+    if (isWakeUpNeeded) {
+        osalHandler->SemaphorePost(s_flightStatusUpdateSema);
     }
-
-    return altitudeOfHomePoint;
 }
 
-static T_DjiFcSubscriptionPositionVO DjiUser_FlightControlGetValueOfPositionVo(void)
+static T_DjiReturnCode DjiUser_FlightControlQuaternionCallback(const uint8_t *data, uint16_t dataSize,
+                                                               const T_DjiDataTimestamp *timestamp)
 {
-    T_DjiReturnCode djiStat;
-    T_DjiDataTimestamp timestamp = {0};
-    T_DjiFcSubscriptionPositionVO positionVo;
+    DjiUser_FlightControlUpdateStatus(&s_flightStatus.quaternion, data, dataSize,
+                                      sizeof(T_DjiFcSubscriptionQuaternion));
 
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_POSITION_VO,
-                                                      (uint8_t *) &positionVo,
-                                                      sizeof(T_DjiFcSubscriptionPositionVO),
-                                                      &timestamp);
-
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic quaternion error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", timestamp.millisecond,
-                       timestamp.microsecond);
-    }
-
-    return positionVo;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-static T_DjiFcSubscriptionControlDevice DjiUser_FlightControlGetValueOfControlDevice(void)
+static T_DjiReturnCode DjiUser_FlightControlGpsPositionCallback(const uint8_t *data, uint16_t dataSize,
+                                                                const T_DjiDataTimestamp *timestamp)
 {
-    T_DjiReturnCode djiStat;
-    T_DjiDataTimestamp timestamp = {0};
-    T_DjiFcSubscriptionControlDevice controlDevice;
+    DjiUser_FlightControlUpdateStatus(&s_flightStatus.gpsPosition, data, dataSize,
+                                      sizeof(T_DjiFcSubscriptionGpsPosition));
 
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_CONTROL_DEVICE,
-                                                      (uint8_t *) &controlDevice,
-                                                      sizeof(T_DjiFcSubscriptionControlDevice),
-                                                      &timestamp);
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
 
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic quaternion error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", timestamp.millisecond,
-                       timestamp.microsecond);
-    }
+static T_DjiReturnCode DjiUser_FlightControlHeightFusionCallback(const uint8_t *data, uint16_t dataSize,
+                                                                 const T_DjiDataTimestamp *timestamp)
+{
+    DjiUser_FlightControlUpdateStatus(&s_flightStatus.heightFusion, data, dataSize,
+                                      sizeof(T_DjiFcSubscriptionHeightFusion));
 
-    return controlDevice;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-static T_DjiFcSubscriptionSingleBatteryInfo DjiUser_FlightControlGetValueOfBattery1(void)
+static T_DjiReturnCode DjiUser_FlightControlPositionVoCallback(const uint8_t *data, uint16_t dataSize,
+                                                               const T_DjiDataTimestamp *timestamp)
 {
-    T_DjiReturnCode djiStat;
-    T_DjiDataTimestamp timestamp = {0};
-    T_DjiFcSubscriptionSingleBatteryInfo singleBatteryInfo;
+    DjiUser_FlightControlUpdateStatus(&s_flightStatus.positionVo, data, dataSize,
+                                      sizeof(T_DjiFcSubscriptionPositionVO));
 
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_BATTERY_SINGLE_INFO_INDEX1,
-                                                      (uint8_t *) &singleBatteryInfo,
-                                                      sizeof(T_DjiFcSubscriptionSingleBatteryInfo),
-                                                      &timestamp);
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
 
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic battery1 error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", timestamp.millisecond,
-                       timestamp.microsecond);
-    }
+static T_DjiReturnCode DjiUser_FlightControlControlDeviceCallback(const uint8_t *data, uint16_t dataSize,
+                                                                  const T_DjiDataTimestamp *timestamp)
+{
+    DjiUser_FlightControlUpdateStatus(&s_flightStatus.controlDevice, data, dataSize,
+                                      sizeof(T_DjiFcSubscriptionControlDevice));
 
-    return singleBatteryInfo;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-static T_DjiFcSubscriptionSingleBatteryInfo DjiUser_FlightControlGetValueOfBattery2(void)
+static T_DjiReturnCode DjiUser_FlightControlBattery1Callback(const uint8_t *data, uint16_t dataSize,
+                                                             const T_DjiDataTimestamp *timestamp)
 {
-    T_DjiReturnCode djiStat;
-    T_DjiDataTimestamp timestamp = {0};
-    T_DjiFcSubscriptionSingleBatteryInfo singleBatteryInfo;
+    DjiUser_FlightControlUpdateStatus(&s_flightStatus.batteryInfo1, data, dataSize,
+                                      sizeof(T_DjiFcSubscriptionSingleBatteryInfo));
 
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_BATTERY_SINGLE_INFO_INDEX2,
-                                                      (uint8_t *) &singleBatteryInfo,
-                                                      sizeof(T_DjiFcSubscriptionSingleBatteryInfo),
-                                                      &timestamp);
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
 
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic battery2 error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", timestamp.millisecond,
-                       timestamp.microsecond);
-    }
+static T_DjiReturnCode DjiUser_FlightControlBattery2Callback(const uint8_t *data, uint16_t dataSize,
+                                                             const T_DjiDataTimestamp *timestamp)
+{
+    DjiUser_FlightControlUpdateStatus(&s_flightStatus.batteryInfo2, data, dataSize,
+                                      sizeof(T_DjiFcSubscriptionSingleBatteryInfo));
 
-    return singleBatteryInfo;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
 static T_DjiReturnCode DjiUser_FlightControlUpdateConfig(void)
@@ -923,9 +985,10 @@ static T_DjiReturnCode DjiUser_FlightControlUpdateConfig(void)
 
     if (isFirstUpdateConfig == false) {
         USER_LOG_INFO("Using current aircraft location, not use config home location.");
-        s_gpsPosition = DjiUser_FlightControlGetValueOfGpsPosition();
-        s_homeLocation.latitude = (dji_f64_t) s_gpsPosition.y / 10000000;
-        s_homeLocation.longitude = (dji_f64_t) s_gpsPosition.x / 10000000;
+        osalHandler->MutexLock(s_flightStatusMutex);
+        s_homeLocation.latitude = (dji_f64_t) s_flightStatus.gpsPosition.y / 10000000;
+        s_homeLocation.longitude = (dji_f64_t) s_flightStatus.gpsPosition.x / 10000000;
+        osalHandler->MutexUnlock(s_flightStatusMutex);
 
         returnCode = DjiFlightController_SetHomeLocationUsingCurrentAircraftLocation();
         if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
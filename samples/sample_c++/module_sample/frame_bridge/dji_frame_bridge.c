@@ -0,0 +1,688 @@
+/**
+ ********************************************************************
+ * @file    dji_frame_bridge.c
+ * @brief   Shared memory frame bridge: a ring of frame slots in a POSIX shared memory object, written by one
+ * publisher and read by several processes, woken up through a futex. Self-contained, a subscriber
+ * process only needs this file, its header and the psdk headers for the return codes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "dji_frame_bridge.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define DJI_FRAME_BRIDGE_MAGIC                  (0x4246444AU) // "JDFB"
+#define DJI_FRAME_BRIDGE_VERSION                (1)
+#define DJI_FRAME_BRIDGE_CACHE_LINE_SIZE        (64)
+#define DJI_FRAME_BRIDGE_SLOT_NUM_MIN           (2)
+#define DJI_FRAME_BRIDGE_ALIGN(size)            \
+    (((size) + DJI_FRAME_BRIDGE_CACHE_LINE_SIZE - 1) & ~((uint64_t) DJI_FRAME_BRIDGE_CACHE_LINE_SIZE - 1))
+
+/* Private types -------------------------------------------------------------*/
+/* Written only by the reader owning it, read by everyone for the statistics. */
+typedef struct {
+    uint32_t pid; // 0 when free
+    uint32_t reserved;
+    uint64_t readSequence; // last sequence read or dropped
+    uint64_t readCount;
+    uint64_t dropCount;
+    uint64_t latencyTotalUs;
+    uint32_t latencyMaxUs;
+} __attribute__((aligned(DJI_FRAME_BRIDGE_CACHE_LINE_SIZE))) T_DjiFrameBridgeReaderSlot;
+
+typedef struct {
+    uint32_t magic; // stored last by the publisher, the segment is not usable before
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t slotDataSize;
+    uint64_t slotStride;
+    uint64_t segmentSize;
+    uint32_t publisherPid;
+    uint32_t isClosed;
+    uint64_t writeSequence __attribute__((aligned(DJI_FRAME_BRIDGE_CACHE_LINE_SIZE)));
+    uint32_t futexWord; // bumped on every publish and on close
+    uint32_t waiterCount;
+    uint32_t readerCount;
+    T_DjiFrameBridgeReaderSlot readers[DJI_FRAME_BRIDGE_READER_NUM_MAX];
+} T_DjiFrameBridgeHeader;
+
+/* Frame n lives in slot (n - 1) % slotCount, its sequence is 0 while the publisher rewrites the slot. */
+typedef struct {
+    uint64_t sequence;
+    T_DjiFrameBridgeFrameInfo info;
+} __attribute__((aligned(DJI_FRAME_BRIDGE_CACHE_LINE_SIZE))) T_DjiFrameBridgeSlot;
+
+typedef struct {
+    char name[DJI_FRAME_BRIDGE_NAME_SIZE_MAX + 1];
+    bool isPublisher;
+    pthread_mutex_t publishMutex; // the ring has a single writer, publishing threads of the process take turns
+    T_DjiFrameBridgeHeader *header;
+    uint8_t *slots;
+    int readerIndex;
+    uint64_t acquiredSequence; // frame handed out by AcquireFrame, 0 when none
+    uint64_t acquiredTimestampUs;
+} T_DjiFrameBridge;
+
+/* Private values -------------------------------------------------------------*/
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode DjiFrameBridge_GetShmName(const char *name, char *shmName, size_t shmNameSize);
+static T_DjiFrameBridgeSlot *DjiFrameBridge_GetSlot(T_DjiFrameBridge *bridge, uint64_t sequence);
+static void DjiFrameBridge_WakeReaders(T_DjiFrameBridgeHeader *header);
+static void DjiFrameBridge_WaitPublish(T_DjiFrameBridgeHeader *header, uint32_t futexValue, uint64_t timeoutUs);
+static bool DjiFrameBridge_IsProcessAlive(uint32_t pid);
+static bool DjiFrameBridge_ClaimReaderSlot(T_DjiFrameBridge *bridge);
+static T_DjiReturnCode DjiFrameBridge_FinishFrame(T_DjiFrameBridge *subscriber, bool isRead);
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Create the bridge, an existing bridge of the same name is replaced and its readers see it closed.
+ * @param name: bridge name, the shared memory object is /dev/shm/<name>.
+ * @param slotCount: frames kept in the ring, a reader may fall slotCount - 1 frames behind without dropping.
+ * @param slotDataSize: largest frame in bytes.
+ * @param bridge: publisher handle.
+ * @note The shared memory object is created 0600, opening it to other users is left to the deployer.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiFrameBridge_CreatePublisher(const char *name, uint32_t slotCount, uint32_t slotDataSize,
+                                               T_DjiFrameBridgeHandle *bridge)
+{
+    T_DjiFrameBridge *newBridge;
+    T_DjiFrameBridgeHeader *header;
+    T_DjiReturnCode returnCode;
+    char shmName[DJI_FRAME_BRIDGE_NAME_SIZE_MAX + 2];
+    uint64_t headerSize = DJI_FRAME_BRIDGE_ALIGN(sizeof(T_DjiFrameBridgeHeader));
+    uint64_t slotStride = DJI_FRAME_BRIDGE_ALIGN(sizeof(T_DjiFrameBridgeSlot) + (uint64_t) slotDataSize);
+    uint64_t segmentSize;
+    void *segment;
+    int fd;
+
+    if (bridge == NULL || slotCount < DJI_FRAME_BRIDGE_SLOT_NUM_MIN || slotDataSize == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    returnCode = DjiFrameBridge_GetShmName(name, shmName, sizeof(shmName));
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    newBridge = calloc(1, sizeof(T_DjiFrameBridge));
+    if (newBridge == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    // Readers of a previous publisher keep their mapping of the old object until they see it closed.
+    shm_unlink(shmName);
+    fd = shm_open(shmName, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        free(newBridge);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    segmentSize = headerSize + slotStride * slotCount;
+    if (ftruncate(fd, (off_t) segmentSize) != 0) {
+        close(fd);
+        shm_unlink(shmName);
+        free(newBridge);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    segment = mmap(NULL, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED) {
+        shm_unlink(shmName);
+        free(newBridge);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    if (pthread_mutex_init(&newBridge->publishMutex, NULL) != 0) {
+        munmap(segment, segmentSize);
+        shm_unlink(shmName);
+        free(newBridge);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    // The object is zero filled by ftruncate, so every slot starts with sequence 0, empty.
+    header = segment;
+    header->version = DJI_FRAME_BRIDGE_VERSION;
+    header->slotCount = slotCount;
+    header->slotDataSize = slotDataSize;
+    header->slotStride = slotStride;
+    header->segmentSize = segmentSize;
+    header->publisherPid = (uint32_t) getpid();
+    __atomic_store_n(&header->magic, DJI_FRAME_BRIDGE_MAGIC, __ATOMIC_RELEASE);
+
+    snprintf(newBridge->name, sizeof(newBridge->name), "%s", name);
+    newBridge->isPublisher = true;
+    newBridge->header = header;
+    newBridge->slots = (uint8_t *) segment + headerSize;
+    newBridge->readerIndex = -1;
+    *bridge = newBridge;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Copy a frame into the next slot of the ring and wake up the readers waiting for it. Never waits for the
+ * readers; threads publishing to the same bridge, such as the decoders of two cameras, are serialized. While no reader
+ * is attached the frame is not copied and no sequence number is used.
+ * @param bridge: publisher handle.
+ * @param info: frame description, its sequence and timestamp are filled in by the bridge.
+ * @param data: info->dataSize bytes.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE when the frame is larger than a slot.
+ */
+T_DjiReturnCode DjiFrameBridge_Publish(T_DjiFrameBridgeHandle bridge, const T_DjiFrameBridgeFrameInfo *info,
+                                       const uint8_t *data)
+{
+    T_DjiFrameBridge *publisher = bridge;
+    T_DjiFrameBridgeHeader *header;
+    T_DjiFrameBridgeSlot *slot;
+    uint64_t sequence;
+
+    if (publisher == NULL || publisher->isPublisher == false || info == NULL || data == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    header = publisher->header;
+    if (info->dataSize > header->slotDataSize) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    if (__atomic_load_n(&header->readerCount, __ATOMIC_ACQUIRE) == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    pthread_mutex_lock(&publisher->publishMutex);
+    sequence = header->writeSequence + 1;
+    slot = DjiFrameBridge_GetSlot(publisher, sequence);
+
+    // Seqlock write: a reader copying this slot meanwhile sees its sequence change and drops the frame.
+    __atomic_store_n(&slot->sequence, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    slot->info = *info;
+    slot->info.sequence = sequence;
+    slot->info.timestampUs = DjiFrameBridge_GetTimeUs();
+    memcpy((uint8_t *) slot + sizeof(T_DjiFrameBridgeSlot), data, info->dataSize);
+
+    __atomic_store_n(&slot->sequence, sequence, __ATOMIC_RELEASE);
+    __atomic_store_n(&header->writeSequence, sequence, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&publisher->publishMutex);
+    DjiFrameBridge_WakeReaders(header);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiFrameBridge_DestroyPublisher(T_DjiFrameBridgeHandle bridge)
+{
+    T_DjiFrameBridge *publisher = bridge;
+    char shmName[DJI_FRAME_BRIDGE_NAME_SIZE_MAX + 2];
+
+    if (publisher == NULL || publisher->isPublisher == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    __atomic_store_n(&publisher->header->isClosed, 1, __ATOMIC_SEQ_CST);
+    DjiFrameBridge_WakeReaders(publisher->header);
+
+    DjiFrameBridge_GetShmName(publisher->name, shmName, sizeof(shmName));
+    shm_unlink(shmName);
+    munmap(publisher->header, publisher->header->segmentSize);
+    pthread_mutex_destroy(&publisher->publishMutex);
+    free(publisher);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Attach to a bridge as a reader, reading starts with the next frame published. Reader places left by a
+ * process that died without closing are taken back.
+ * @param name: bridge name given to the publisher.
+ * @param bridge: subscriber handle, to be used by one thread.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND when the bridge is not published,
+ * DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER when its ring geometry is corrupt,
+ * DJI_ERROR_SYSTEM_MODULE_CODE_BUSY when all the reader places are taken.
+ */
+T_DjiReturnCode DjiFrameBridge_OpenSubscriber(const char *name, T_DjiFrameBridgeHandle *bridge)
+{
+    T_DjiFrameBridge *newBridge;
+    T_DjiFrameBridgeHeader *header;
+    T_DjiReturnCode returnCode;
+    char shmName[DJI_FRAME_BRIDGE_NAME_SIZE_MAX + 2];
+    uint64_t headerSize = DJI_FRAME_BRIDGE_ALIGN(sizeof(T_DjiFrameBridgeHeader));
+    struct stat st;
+    void *segment;
+    int fd;
+
+    if (bridge == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    returnCode = DjiFrameBridge_GetShmName(name, shmName, sizeof(shmName));
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    fd = shm_open(shmName, O_RDWR, 0);
+    if (fd < 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    if (fstat(fd, &st) != 0 || (uint64_t) st.st_size < sizeof(T_DjiFrameBridgeHeader)) {
+        close(fd);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    segment = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    header = segment;
+    if (__atomic_load_n(&header->magic, __ATOMIC_ACQUIRE) != DJI_FRAME_BRIDGE_MAGIC ||
+        header->segmentSize != (uint64_t) st.st_size || header->isClosed != 0 ||
+        DjiFrameBridge_IsProcessAlive(header->publisherPid) == false) {
+        munmap(segment, st.st_size);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+    if (header->version != DJI_FRAME_BRIDGE_VERSION) {
+        munmap(segment, st.st_size);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+    }
+
+    // Every read trusts the ring geometry, a corrupt one must not divide by zero or read past the mapping.
+    if (header->slotCount < DJI_FRAME_BRIDGE_SLOT_NUM_MIN || header->segmentSize < headerSize ||
+        header->slotStride < sizeof(T_DjiFrameBridgeSlot) + (uint64_t) header->slotDataSize ||
+        header->slotStride > (header->segmentSize - headerSize) / header->slotCount ||
+        headerSize + header->slotStride * header->slotCount != header->segmentSize) {
+        munmap(segment, st.st_size);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    newBridge = calloc(1, sizeof(T_DjiFrameBridge));
+    if (newBridge == NULL) {
+        munmap(segment, st.st_size);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+    snprintf(newBridge->name, sizeof(newBridge->name), "%s", name);
+    newBridge->isPublisher = false;
+    newBridge->header = header;
+    newBridge->slots = (uint8_t *) segment + headerSize;
+
+    if (DjiFrameBridge_ClaimReaderSlot(newBridge) == false) {
+        munmap(segment, st.st_size);
+        free(newBridge);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    *bridge = newBridge;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Wait for the next frame and hand it out in place, without copying. The frame may be overwritten by the
+ * publisher while it is used, it is only valid when DjiFrameBridge_ReleaseFrame succeeds.
+ * @param bridge: subscriber handle.
+ * @param info: frame description.
+ * @param data: frame data inside the shared memory, info->dataSize bytes.
+ * @param timeoutMs: 0 to poll.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT when no frame was published in time,
+ * DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND when the publisher closed the bridge.
+ */
+T_DjiReturnCode DjiFrameBridge_AcquireFrame(T_DjiFrameBridgeHandle bridge, T_DjiFrameBridgeFrameInfo *info,
+                                            const uint8_t **data, uint32_t timeoutMs)
+{
+    T_DjiFrameBridge *subscriber = bridge;
+    T_DjiFrameBridgeHeader *header;
+    T_DjiFrameBridgeReaderSlot *reader;
+    T_DjiFrameBridgeSlot *slot;
+    uint64_t deadlineUs;
+    uint64_t nowUs;
+    uint64_t writeSequence;
+    uint64_t nextSequence;
+    uint32_t futexValue;
+
+    if (subscriber == NULL || subscriber->isPublisher == true || info == NULL || data == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    header = subscriber->header;
+    reader = &header->readers[subscriber->readerIndex];
+    deadlineUs = DjiFrameBridge_GetTimeUs() + (uint64_t) timeoutMs * 1000;
+    subscriber->acquiredSequence = 0;
+
+    while (1) {
+        // Sampled before the sequence, a publish in between then makes the futex wait return at once.
+        futexValue = __atomic_load_n(&header->futexWord, __ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&header->isClosed, __ATOMIC_ACQUIRE) != 0) {
+            return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+        }
+
+        writeSequence = __atomic_load_n(&header->writeSequence, __ATOMIC_ACQUIRE);
+        nextSequence = reader->readSequence + 1;
+        if (nextSequence <= writeSequence) {
+            // Fell more than a ring behind: the frames in between are gone, resume at the oldest one left.
+            if (writeSequence - nextSequence >= header->slotCount) {
+                reader->dropCount += writeSequence - header->slotCount + 1 - nextSequence;
+                nextSequence = writeSequence - header->slotCount + 1;
+            }
+
+            slot = DjiFrameBridge_GetSlot(subscriber, nextSequence);
+            if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != nextSequence) {
+                reader->dropCount++;
+                __atomic_store_n(&reader->readSequence, nextSequence, __ATOMIC_RELEASE);
+                continue;
+            }
+
+            *info = slot->info;
+            if (info->dataSize > header->slotDataSize) {
+                info->dataSize = header->slotDataSize;
+            }
+            *data = (const uint8_t *) slot + sizeof(T_DjiFrameBridgeSlot);
+            subscriber->acquiredSequence = nextSequence;
+            subscriber->acquiredTimestampUs = info->timestampUs;
+            return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+        }
+
+        nowUs = DjiFrameBridge_GetTimeUs();
+        if (nowUs >= deadlineUs) {
+            // A publisher killed before closing the bridge is only noticed here.
+            return DjiFrameBridge_IsProcessAlive(header->publisherPid) ? DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT
+                                                                       : DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+        }
+        DjiFrameBridge_WaitPublish(header, futexValue, deadlineUs - nowUs);
+    }
+}
+
+/**
+ * @brief Finish with the frame of DjiFrameBridge_AcquireFrame and advance the read cursor.
+ * @param bridge: subscriber handle.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE when the frame was overwritten while it was
+ * used, the frame is then counted as dropped and what was read of it must be discarded.
+ */
+T_DjiReturnCode DjiFrameBridge_ReleaseFrame(T_DjiFrameBridgeHandle bridge)
+{
+    T_DjiFrameBridge *subscriber = bridge;
+
+    if (subscriber == NULL || subscriber->isPublisher == true) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    return DjiFrameBridge_FinishFrame(subscriber, true);
+}
+
+/**
+ * @brief Wait for the next frame and copy it out, frames overwritten during the copy are skipped.
+ * @param bridge: subscriber handle.
+ * @param info: frame description.
+ * @param buffer: frame data.
+ * @param bufferSize: size of buffer, a larger frame is dropped with DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE.
+ * @param timeoutMs: 0 to poll.
+ * @return Execution result, as DjiFrameBridge_AcquireFrame.
+ */
+T_DjiReturnCode DjiFrameBridge_ReadFrame(T_DjiFrameBridgeHandle bridge, T_DjiFrameBridgeFrameInfo *info,
+                                         uint8_t *buffer, uint32_t bufferSize, uint32_t timeoutMs)
+{
+    T_DjiReturnCode returnCode;
+    const uint8_t *data;
+
+    while (1) {
+        returnCode = DjiFrameBridge_AcquireFrame(bridge, info, &data, timeoutMs);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
+
+        if (info->dataSize > bufferSize) {
+            DjiFrameBridge_FinishFrame(bridge, false);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+        }
+
+        memcpy(buffer, data, info->dataSize);
+        if (DjiFrameBridge_ReleaseFrame(bridge) == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+        }
+    }
+}
+
+T_DjiReturnCode DjiFrameBridge_CloseSubscriber(T_DjiFrameBridgeHandle bridge)
+{
+    T_DjiFrameBridge *subscriber = bridge;
+    T_DjiFrameBridgeHeader *header;
+
+    if (subscriber == NULL || subscriber->isPublisher == true) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    header = subscriber->header;
+    __atomic_sub_fetch(&header->readerCount, 1, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&header->readers[subscriber->readerIndex].pid, 0, __ATOMIC_RELEASE);
+    munmap(header, header->segmentSize);
+    free(subscriber);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiFrameBridge_GetPublishedCount(T_DjiFrameBridgeHandle bridge, uint64_t *count)
+{
+    T_DjiFrameBridge *handle = bridge;
+
+    if (handle == NULL || count == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    *count = __atomic_load_n(&handle->header->writeSequence, __ATOMIC_ACQUIRE);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Get the statistics of all the readers attached to the bridge, from the publisher or from any reader.
+ * @param bridge: publisher or subscriber handle.
+ * @param statistics: output list.
+ * @param maxCount: capacity of the output list.
+ * @param count: number of readers listed.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiFrameBridge_GetReaderStatistics(T_DjiFrameBridgeHandle bridge,
+                                                   T_DjiFrameBridgeReaderStatistics *statistics, uint32_t maxCount,
+                                                   uint32_t *count)
+{
+    T_DjiFrameBridge *handle = bridge;
+    T_DjiFrameBridgeReaderSlot *reader;
+    uint64_t writeSequence;
+    uint64_t readSequence;
+    uint32_t i;
+
+    if (handle == NULL || statistics == NULL || count == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    *count = 0;
+    writeSequence = __atomic_load_n(&handle->header->writeSequence, __ATOMIC_ACQUIRE);
+    for (i = 0; i < DJI_FRAME_BRIDGE_READER_NUM_MAX && *count < maxCount; i++) {
+        reader = &handle->header->readers[i];
+        if (__atomic_load_n(&reader->pid, __ATOMIC_ACQUIRE) == 0) {
+            continue;
+        }
+
+        readSequence = __atomic_load_n(&reader->readSequence, __ATOMIC_ACQUIRE);
+        statistics[*count].pid = reader->pid;
+        statistics[*count].lag = writeSequence > readSequence ? writeSequence - readSequence : 0;
+        statistics[*count].readCount = reader->readCount;
+        statistics[*count].dropCount = reader->dropCount;
+        statistics[*count].latencyAvgUs =
+            reader->readCount != 0 ? (uint32_t) (reader->latencyTotalUs / reader->readCount) : 0;
+        statistics[*count].latencyMaxUs = reader->latencyMaxUs;
+        (*count)++;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+uint64_t DjiFrameBridge_GetTimeUs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t) ts.tv_sec * 1000000 + (uint64_t) ts.tv_nsec / 1000;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode DjiFrameBridge_GetShmName(const char *name, char *shmName, size_t shmNameSize)
+{
+    if (name == NULL || name[0] == '\0' || strlen(name) > DJI_FRAME_BRIDGE_NAME_SIZE_MAX ||
+        strchr(name, '/') != NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    snprintf(shmName, shmNameSize, "/%s", name);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiFrameBridgeSlot *DjiFrameBridge_GetSlot(T_DjiFrameBridge *bridge, uint64_t sequence)
+{
+    T_DjiFrameBridgeHeader *header = bridge->header;
+
+    return (T_DjiFrameBridgeSlot *) (bridge->slots + ((sequence - 1) % header->slotCount) * header->slotStride);
+}
+
+static void DjiFrameBridge_WakeReaders(T_DjiFrameBridgeHeader *header)
+{
+    __atomic_add_fetch(&header->futexWord, 1, __ATOMIC_SEQ_CST);
+
+    // The system call is only paid when a reader is sleeping, a busy reader finds the frame on its own.
+    if (__atomic_load_n(&header->waiterCount, __ATOMIC_SEQ_CST) != 0) {
+        syscall(SYS_futex, &header->futexWord, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+    }
+}
+
+static void DjiFrameBridge_WaitPublish(T_DjiFrameBridgeHeader *header, uint32_t futexValue, uint64_t timeoutUs)
+{
+    struct timespec timeout;
+
+    timeout.tv_sec = (time_t) (timeoutUs / 1000000);
+    timeout.tv_nsec = (long) (timeoutUs % 1000000) * 1000;
+
+    // Shared futex, the publisher lives in another process. Returns at once when futexWord moved on since sampled.
+    __atomic_add_fetch(&header->waiterCount, 1, __ATOMIC_SEQ_CST);
+    syscall(SYS_futex, &header->futexWord, FUTEX_WAIT, futexValue, &timeout, NULL, 0);
+    __atomic_sub_fetch(&header->waiterCount, 1, __ATOMIC_SEQ_CST);
+}
+
+/* Publisher and readers are expected in the same pid namespace, the liveness checks rely on it. */
+static bool DjiFrameBridge_IsProcessAlive(uint32_t pid)
+{
+    return kill((pid_t) pid, 0) == 0 || errno != ESRCH;
+}
+
+static bool DjiFrameBridge_ClaimReaderSlot(T_DjiFrameBridge *bridge)
+{
+    T_DjiFrameBridgeHeader *header = bridge->header;
+    T_DjiFrameBridgeReaderSlot *reader;
+    uint32_t pid;
+    uint32_t expected;
+    int i;
+
+    // Reclaim the places of readers which died without closing.
+    for (i = 0; i < DJI_FRAME_BRIDGE_READER_NUM_MAX; i++) {
+        pid = __atomic_load_n(&header->readers[i].pid, __ATOMIC_ACQUIRE);
+        if (pid != 0 && DjiFrameBridge_IsProcessAlive(pid) == false &&
+            __atomic_compare_exchange_n(&header->readers[i].pid, &pid, 0, false, __ATOMIC_SEQ_CST,
+                                        __ATOMIC_SEQ_CST)) {
+            __atomic_sub_fetch(&header->readerCount, 1, __ATOMIC_SEQ_CST);
+        }
+    }
+
+    for (i = 0; i < DJI_FRAME_BRIDGE_READER_NUM_MAX; i++) {
+        reader = &header->readers[i];
+        expected = 0;
+        if (__atomic_compare_exchange_n(&reader->pid, &expected, (uint32_t) getpid(), false, __ATOMIC_SEQ_CST,
+                                        __ATOMIC_SEQ_CST)) {
+            reader->readCount = 0;
+            reader->dropCount = 0;
+            reader->latencyTotalUs = 0;
+            reader->latencyMaxUs = 0;
+            __atomic_store_n(&reader->readSequence, __atomic_load_n(&header->writeSequence, __ATOMIC_ACQUIRE),
+                             __ATOMIC_RELEASE);
+            __atomic_add_fetch(&header->readerCount, 1, __ATOMIC_SEQ_CST);
+            bridge->readerIndex = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static T_DjiReturnCode DjiFrameBridge_FinishFrame(T_DjiFrameBridge *subscriber, bool isRead)
+{
+    T_DjiFrameBridgeReaderSlot *reader;
+    T_DjiFrameBridgeSlot *slot;
+    uint64_t sequence;
+    uint64_t nowUs;
+    uint32_t latencyUs;
+
+    sequence = subscriber->acquiredSequence;
+    if (sequence == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+    subscriber->acquiredSequence = 0;
+
+    reader = &subscriber->header->readers[subscriber->readerIndex];
+    slot = DjiFrameBridge_GetSlot(subscriber, sequence);
+
+    // Seqlock read: the reads of the frame must be done before the sequence is checked again.
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (isRead == false || __atomic_load_n(&slot->sequence, __ATOMIC_RELAXED) != sequence) {
+        reader->dropCount++;
+        __atomic_store_n(&reader->readSequence, sequence, __ATOMIC_RELEASE);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    nowUs = DjiFrameBridge_GetTimeUs();
+    latencyUs = nowUs > subscriber->acquiredTimestampUs ? (uint32_t) (nowUs - subscriber->acquiredTimestampUs) : 0;
+    reader->readCount++;
+    reader->latencyTotalUs += latencyUs;
+    if (latencyUs > reader->latencyMaxUs) {
+        reader->latencyMaxUs = latencyUs;
+    }
+    __atomic_store_n(&reader->readSequence, sequence, __ATOMIC_RELEASE);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,109 @@
+/**
+ ********************************************************************
+ * @file    dji_frame_bridge.h
+ * @brief   This is the header file for "dji_frame_bridge.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef DJI_FRAME_BRIDGE_H
+#define DJI_FRAME_BRIDGE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_FRAME_BRIDGE_NAME_SIZE_MAX          (32)
+#define DJI_FRAME_BRIDGE_READER_NUM_MAX         (8)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    DJI_FRAME_BRIDGE_SOURCE_LIVEVIEW = 0, /*!< Decoded liveview image, sourceIndex is the camera position. */
+    DJI_FRAME_BRIDGE_SOURCE_PERCEPTION = 1, /*!< Stereo image, sourceIndex is the perception camera position. */
+    DJI_FRAME_BRIDGE_SOURCE_SYNTHETIC = 2, /*!< Generated by the benchmark. */
+} E_DjiFrameBridgeSource;
+
+typedef struct {
+    uint64_t sequence; /*!< Set by the publisher, 1 for the first frame, consecutive. */
+    uint64_t timestampUs; /*!< Set by the publisher, CLOCK_MONOTONIC so that it compares across processes. */
+    uint32_t source; /*!< E_DjiFrameBridgeSource. */
+    uint32_t sourceIndex;
+    uint32_t format; /*!< E_DjiCameraImageFormat for liveview, bits per pixel for perception. */
+    uint32_t width;
+    uint32_t height;
+    uint32_t dataSize;
+} T_DjiFrameBridgeFrameInfo;
+
+typedef struct {
+    uint32_t pid;
+    uint64_t lag; /*!< Frames published but not read yet. */
+    uint64_t readCount;
+    uint64_t dropCount; /*!< Frames overwritten before this reader got to them. */
+    uint32_t latencyAvgUs; /*!< From publishing to the end of reading. */
+    uint32_t latencyMaxUs;
+} T_DjiFrameBridgeReaderStatistics;
+
+typedef void *T_DjiFrameBridgeHandle;
+
+/* Exported functions --------------------------------------------------------*/
+/*! @note
+ * One publisher per bridge, whose threads may all publish, up to DJI_FRAME_BRIDGE_READER_NUM_MAX readers in any
+ * process. The publisher never waits for the readers: each reader has its own read cursor, and a reader falling more
+ * than a ring behind skips to the oldest frame still in the ring and counts the skipped frames as dropped. Nothing is
+ * copied while no reader is attached. A subscriber loop:
+ *
+ *     DjiFrameBridge_OpenSubscriber("dji_liveview", &bridge);
+ *     while (DjiFrameBridge_ReadFrame(bridge, &info, buffer, sizeof(buffer), 1000) != NOT_FOUND) { ... }
+ *     DjiFrameBridge_CloseSubscriber(bridge);
+ *
+ * NOT_FOUND means the publisher is gone, open the bridge again to follow a restarted publisher.
+ */
+T_DjiReturnCode DjiFrameBridge_CreatePublisher(const char *name, uint32_t slotCount, uint32_t slotDataSize,
+                                               T_DjiFrameBridgeHandle *bridge);
+T_DjiReturnCode DjiFrameBridge_Publish(T_DjiFrameBridgeHandle bridge, const T_DjiFrameBridgeFrameInfo *info,
+                                       const uint8_t *data);
+T_DjiReturnCode DjiFrameBridge_DestroyPublisher(T_DjiFrameBridgeHandle bridge);
+
+T_DjiReturnCode DjiFrameBridge_OpenSubscriber(const char *name, T_DjiFrameBridgeHandle *bridge);
+T_DjiReturnCode DjiFrameBridge_AcquireFrame(T_DjiFrameBridgeHandle bridge, T_DjiFrameBridgeFrameInfo *info,
+                                            const uint8_t **data, uint32_t timeoutMs);
+T_DjiReturnCode DjiFrameBridge_ReleaseFrame(T_DjiFrameBridgeHandle bridge);
+T_DjiReturnCode DjiFrameBridge_ReadFrame(T_DjiFrameBridgeHandle bridge, T_DjiFrameBridgeFrameInfo *info,
+                                         uint8_t *buffer, uint32_t bufferSize, uint32_t timeoutMs);
+T_DjiReturnCode DjiFrameBridge_CloseSubscriber(T_DjiFrameBridgeHandle bridge);
+
+T_DjiReturnCode DjiFrameBridge_GetPublishedCount(T_DjiFrameBridgeHandle bridge, uint64_t *count);
+T_DjiReturnCode DjiFrameBridge_GetReaderStatistics(T_DjiFrameBridgeHandle bridge,
+                                                   T_DjiFrameBridgeReaderStatistics *statistics, uint32_t maxCount,
+                                                   uint32_t *count);
+uint64_t DjiFrameBridge_GetTimeUs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DJI_FRAME_BRIDGE_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
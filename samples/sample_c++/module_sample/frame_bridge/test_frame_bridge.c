@@ -0,0 +1,259 @@
+/**
+ ********************************************************************
+ * @file    test_frame_bridge.c
+ * @brief   Cross process benchmark of the frame bridge, a synthetic 1080p RGB producer against reader
+ * processes copying, reading in place and lagging behind.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <unistd.h>
+#include <sys/wait.h>
+#include "test_frame_bridge.h"
+#include "dji_frame_bridge.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define FRAME_BRIDGE_BENCHMARK_NAME                 "dji_frame_bridge_benchmark"
+#define FRAME_BRIDGE_BENCHMARK_FRAME_WIDTH          (1920)
+#define FRAME_BRIDGE_BENCHMARK_FRAME_HEIGHT         (1080)
+#define FRAME_BRIDGE_BENCHMARK_FRAME_SIZE           (FRAME_BRIDGE_BENCHMARK_FRAME_WIDTH * \
+                                                     FRAME_BRIDGE_BENCHMARK_FRAME_HEIGHT * 3)
+#define FRAME_BRIDGE_BENCHMARK_SLOT_NUM             (4)
+#define FRAME_BRIDGE_BENCHMARK_LATENCY_FRAME_NUM    (90)
+#define FRAME_BRIDGE_BENCHMARK_LATENCY_PERIOD_US    (33333) // 30 fps, the liveview rate
+#define FRAME_BRIDGE_BENCHMARK_THROUGHPUT_FRAME_NUM (600)
+#define FRAME_BRIDGE_BENCHMARK_SLOW_READER_DELAY_MS (100)
+#define FRAME_BRIDGE_BENCHMARK_ATTACH_TIMEOUT_MS    (3000)
+#define FRAME_BRIDGE_BENCHMARK_DRAIN_TIMEOUT_MS     (1000)
+
+/* Private types -------------------------------------------------------------*/
+typedef enum {
+    FRAME_BRIDGE_BENCHMARK_READER_COPY = 0,
+    FRAME_BRIDGE_BENCHMARK_READER_IN_PLACE,
+    FRAME_BRIDGE_BENCHMARK_READER_SLOW,
+    FRAME_BRIDGE_BENCHMARK_READER_NUM,
+} E_FrameBridgeBenchmarkReader;
+
+/* Private values -------------------------------------------------------------*/
+static const char *s_readerName[FRAME_BRIDGE_BENCHMARK_READER_NUM] = {"copy", "in place", "slow copy"};
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode DjiTest_FrameBridgeRunPhase(const char *phaseName, uint32_t frameCount, uint32_t periodUs,
+                                                   uint8_t *frameBuffer);
+static void DjiTest_FrameBridgeRunReader(E_FrameBridgeBenchmarkReader type, uint8_t *frameBuffer);
+static uint32_t DjiTest_FrameBridgeGetReaderCount(T_DjiFrameBridgeHandle bridge);
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Publish synthetic 1080p RGB frames to three reader processes: one copying every frame out, one reading
+ * frames in place, and one copying but too slow to keep up, which must drop frames without slowing the others. The
+ * frames are published at 30 fps for the latency, then as fast as possible for the throughput.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_FrameBridgeRunBenchmark(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+    uint8_t *frameBuffer;
+    uint32_t i;
+
+    // Allocated before the readers are forked, which then use their copy of it as their read buffer.
+    frameBuffer = osalHandler->Malloc(FRAME_BRIDGE_BENCHMARK_FRAME_SIZE);
+    if (frameBuffer == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+    for (i = 0; i < FRAME_BRIDGE_BENCHMARK_FRAME_SIZE; i++) {
+        frameBuffer[i] = (uint8_t) i;
+    }
+
+    returnCode = DjiTest_FrameBridgeRunPhase("latency", FRAME_BRIDGE_BENCHMARK_LATENCY_FRAME_NUM,
+                                             FRAME_BRIDGE_BENCHMARK_LATENCY_PERIOD_US, frameBuffer);
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        returnCode = DjiTest_FrameBridgeRunPhase("throughput", FRAME_BRIDGE_BENCHMARK_THROUGHPUT_FRAME_NUM, 0,
+                                                 frameBuffer);
+    }
+
+    osalHandler->Free(frameBuffer);
+
+    return returnCode;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode DjiTest_FrameBridgeRunPhase(const char *phaseName, uint32_t frameCount, uint32_t periodUs,
+                                                   uint8_t *frameBuffer)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiFrameBridgeHandle bridge = NULL;
+    T_DjiFrameBridgeFrameInfo info = {0};
+    T_DjiFrameBridgeReaderStatistics statistics[DJI_FRAME_BRIDGE_READER_NUM_MAX];
+    T_DjiReturnCode returnCode;
+    pid_t readerPid[FRAME_BRIDGE_BENCHMARK_READER_NUM] = {0};
+    uint64_t startUs;
+    uint64_t stopUs;
+    uint64_t nowUs;
+    uint64_t publishedCount = 0;
+    uint32_t statisticsCount = 0;
+    uint32_t waitMs;
+    uint32_t i;
+    uint32_t j;
+
+    returnCode = DjiFrameBridge_CreatePublisher(FRAME_BRIDGE_BENCHMARK_NAME, FRAME_BRIDGE_BENCHMARK_SLOT_NUM,
+                                                FRAME_BRIDGE_BENCHMARK_FRAME_SIZE, &bridge);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create frame bridge error: 0x%08llX.", returnCode);
+        return returnCode;
+    }
+
+    for (i = 0; i < FRAME_BRIDGE_BENCHMARK_READER_NUM; i++) {
+        readerPid[i] = fork();
+        if (readerPid[i] == 0) {
+            DjiTest_FrameBridgeRunReader((E_FrameBridgeBenchmarkReader) i, frameBuffer);
+        } else if (readerPid[i] < 0) {
+            USER_LOG_ERROR("Fork frame bridge reader error.");
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            goto destroyBridge;
+        }
+    }
+
+    for (waitMs = 0; DjiTest_FrameBridgeGetReaderCount(bridge) < FRAME_BRIDGE_BENCHMARK_READER_NUM; waitMs++) {
+        if (waitMs >= FRAME_BRIDGE_BENCHMARK_ATTACH_TIMEOUT_MS) {
+            USER_LOG_ERROR("Frame bridge readers did not attach.");
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT;
+            goto destroyBridge;
+        }
+        osalHandler->TaskSleepMs(1);
+    }
+
+    info.source = DJI_FRAME_BRIDGE_SOURCE_SYNTHETIC;
+    info.width = FRAME_BRIDGE_BENCHMARK_FRAME_WIDTH;
+    info.height = FRAME_BRIDGE_BENCHMARK_FRAME_HEIGHT;
+    info.dataSize = FRAME_BRIDGE_BENCHMARK_FRAME_SIZE;
+
+    startUs = DjiFrameBridge_GetTimeUs();
+    for (i = 0; i < frameCount; i++) {
+        frameBuffer[0] = (uint8_t) i;
+        DjiFrameBridge_Publish(bridge, &info, frameBuffer);
+
+        // Paced on an absolute schedule, so the time spent publishing is not added to the period.
+        nowUs = DjiFrameBridge_GetTimeUs();
+        if (periodUs != 0 && startUs + (uint64_t) (i + 1) * periodUs > nowUs) {
+            usleep((useconds_t) (startUs + (uint64_t) (i + 1) * periodUs - nowUs));
+        }
+    }
+    stopUs = DjiFrameBridge_GetTimeUs();
+    DjiFrameBridge_GetPublishedCount(bridge, &publishedCount);
+
+    // The readers keeping up get the time to read the last frames, the slow one is left behind.
+    for (waitMs = 0; waitMs < FRAME_BRIDGE_BENCHMARK_DRAIN_TIMEOUT_MS; waitMs++) {
+        DjiFrameBridge_GetReaderStatistics(bridge, statistics, DJI_FRAME_BRIDGE_READER_NUM_MAX, &statisticsCount);
+        for (j = 0; j < statisticsCount; j++) {
+            if (statistics[j].pid != (uint32_t) readerPid[FRAME_BRIDGE_BENCHMARK_READER_SLOW] &&
+                statistics[j].lag != 0) {
+                break;
+            }
+        }
+        if (j == statisticsCount) {
+            break;
+        }
+        osalHandler->TaskSleepMs(1);
+    }
+
+    USER_LOG_INFO("Frame bridge %s: published %llu frames of %u bytes in %llu ms, %.1f fps, %.1f MB/s.",
+                  phaseName, publishedCount, FRAME_BRIDGE_BENCHMARK_FRAME_SIZE, (stopUs - startUs) / 1000,
+                  publishedCount * 1000000.0 / (stopUs - startUs),
+                  publishedCount * (double) FRAME_BRIDGE_BENCHMARK_FRAME_SIZE / (stopUs - startUs));
+    for (i = 0; i < statisticsCount; i++) {
+        for (j = 0; j < FRAME_BRIDGE_BENCHMARK_READER_NUM; j++) {
+            if (statistics[i].pid == (uint32_t) readerPid[j]) {
+                break;
+            }
+        }
+        USER_LOG_INFO("Frame bridge %s: %-9s reader read %llu, dropped %llu, lag %llu, latency avg %u us, max %u us.",
+                      phaseName, j < FRAME_BRIDGE_BENCHMARK_READER_NUM ? s_readerName[j] : "unknown",
+                      statistics[i].readCount, statistics[i].dropCount, statistics[i].lag,
+                      statistics[i].latencyAvgUs, statistics[i].latencyMaxUs);
+    }
+
+destroyBridge:
+    // The readers see the bridge closed and exit.
+    DjiFrameBridge_DestroyPublisher(bridge);
+    for (i = 0; i < FRAME_BRIDGE_BENCHMARK_READER_NUM; i++) {
+        if (readerPid[i] > 0) {
+            waitpid(readerPid[i], NULL, 0);
+        }
+    }
+
+    return returnCode;
+}
+
+static void DjiTest_FrameBridgeRunReader(E_FrameBridgeBenchmarkReader type, uint8_t *frameBuffer)
+{
+    T_DjiFrameBridgeHandle bridge = NULL;
+    T_DjiFrameBridgeFrameInfo info;
+    T_DjiReturnCode returnCode;
+    const uint8_t *data;
+    volatile uint8_t checksum = 0;
+    uint32_t waitMs;
+
+    // Forked from the sample process: only the bridge is used here, no logging or other psdk service.
+    for (waitMs = 0; DjiFrameBridge_OpenSubscriber(FRAME_BRIDGE_BENCHMARK_NAME, &bridge) !=
+                     DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS; waitMs++) {
+        if (waitMs >= FRAME_BRIDGE_BENCHMARK_ATTACH_TIMEOUT_MS) {
+            _exit(1);
+        }
+        usleep(1000);
+    }
+
+    while (1) {
+        if (type == FRAME_BRIDGE_BENCHMARK_READER_IN_PLACE) {
+            returnCode = DjiFrameBridge_AcquireFrame(bridge, &info, &data, 1000);
+            if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                checksum ^= data[0] ^ data[info.dataSize - 1];
+                DjiFrameBridge_ReleaseFrame(bridge);
+            }
+        } else {
+            returnCode = DjiFrameBridge_ReadFrame(bridge, &info, frameBuffer, FRAME_BRIDGE_BENCHMARK_FRAME_SIZE, 1000);
+            if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS && type == FRAME_BRIDGE_BENCHMARK_READER_SLOW) {
+                usleep(FRAME_BRIDGE_BENCHMARK_SLOW_READER_DELAY_MS * 1000);
+            }
+        }
+
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND) {
+            break;
+        }
+    }
+
+    DjiFrameBridge_CloseSubscriber(bridge);
+    _exit(0);
+}
+
+static uint32_t DjiTest_FrameBridgeGetReaderCount(T_DjiFrameBridgeHandle bridge)
+{
+    T_DjiFrameBridgeReaderStatistics statistics[DJI_FRAME_BRIDGE_READER_NUM_MAX];
+    uint32_t count = 0;
+
+    DjiFrameBridge_GetReaderStatistics(bridge, statistics, DJI_FRAME_BRIDGE_READER_NUM_MAX, &count);
+
+    return count;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
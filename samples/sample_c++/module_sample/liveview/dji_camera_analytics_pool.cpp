@@ -0,0 +1,350 @@
+/**
+ ********************************************************************
+ * @file    dji_camera_analytics_pool.cpp
+ * @brief
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_camera_analytics_pool.hpp"
+#include <time.h>
+#include "dji_logger.h"
+
+/* Private constants ---------------------------------------------------------*/
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+
+/* Private functions declaration ---------------------------------------------*/
+static double DjiCameraAnalyticsPool_GetTimeMs(void);
+
+/* Exported functions definition ---------------------------------------------*/
+DJICameraAnalyticsPool::DJICameraAnalyticsPool()
+    : workerCount(0),
+      nextSlotIndex(0),
+      isRunning(false),
+      presenterIsRunning(false),
+      processCallback(nullptr),
+      presentCallback(nullptr),
+      callbackUserData(nullptr)
+{
+    for (int i = 0; i < DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX; i++) {
+        slots[i].isUsed = false;
+        slots[i].hasPendingFrame = false;
+        slots[i].isProcessing = false;
+        slots[i].hasResultFrame = false;
+    }
+    resetStatisticsWithLock();
+
+    pthread_mutex_init(&mutex, nullptr);
+    pthread_cond_init(&frameCond, nullptr);
+    pthread_cond_init(&resultCond, nullptr);
+}
+
+DJICameraAnalyticsPool::~DJICameraAnalyticsPool()
+{
+    stop();
+
+    pthread_mutex_destroy(&mutex);
+    pthread_cond_destroy(&frameCond);
+    pthread_cond_destroy(&resultCond);
+}
+
+bool DJICameraAnalyticsPool::start(int workerNum, CameraAnalyticsProcessCallback processCb,
+                                   CameraAnalyticsPresentCallback presentCb, void *userData)
+{
+    pthread_mutex_lock(&mutex);
+    if (isRunning) {
+        pthread_mutex_unlock(&mutex);
+        USER_LOG_WARN("Analytics pool already running.");
+        return true;
+    }
+
+    if (workerNum <= 0) {
+        workerNum = 1;
+    } else if (workerNum > DJI_CAMERA_ANALYTICS_WORKER_NUM_MAX) {
+        workerNum = DJI_CAMERA_ANALYTICS_WORKER_NUM_MAX;
+    }
+
+    processCallback = processCb;
+    presentCallback = presentCb;
+    callbackUserData = userData;
+    isRunning = true;
+    pthread_mutex_unlock(&mutex);
+
+    for (workerCount = 0; workerCount < workerNum; workerCount++) {
+        workerContexts[workerCount].pool = this;
+        workerContexts[workerCount].index = workerCount;
+        if (pthread_create(&workerThreads[workerCount], nullptr, workerThreadEntry,
+                           &workerContexts[workerCount]) != 0) {
+            USER_LOG_ERROR("Create analytics worker %d failed.", workerCount);
+            stop();
+            return false;
+        }
+    }
+
+    if (pthread_create(&presenterThread, nullptr, presenterThreadEntry, this) != 0) {
+        USER_LOG_ERROR("Create analytics presenter failed.");
+        stop();
+        return false;
+    }
+    presenterIsRunning = true;
+
+    return true;
+}
+
+void DJICameraAnalyticsPool::stop()
+{
+    pthread_mutex_lock(&mutex);
+    isRunning = false;
+    pthread_cond_broadcast(&frameCond);
+    pthread_cond_broadcast(&resultCond);
+    pthread_mutex_unlock(&mutex);
+
+    for (int i = 0; i < workerCount; i++) {
+        pthread_join(workerThreads[i], nullptr);
+    }
+    workerCount = 0;
+
+    if (presenterIsRunning) {
+        pthread_join(presenterThread, nullptr);
+        presenterIsRunning = false;
+    }
+}
+
+bool DJICameraAnalyticsPool::submitFrame(const char *name, CameraRGBImage &img)
+{
+    int slotIndex;
+
+    pthread_mutex_lock(&mutex);
+    slotIndex = findSlotWithLock(name);
+    if (!isRunning || slotIndex < 0) {
+        pthread_mutex_unlock(&mutex);
+        return false;
+    }
+
+    StreamSlot &slot = slots[slotIndex];
+    if (slot.hasPendingFrame) {
+        slot.droppedCount++;
+    }
+
+    /* Only the latest frame matters for live analytics, the previous pending frame is simply replaced. */
+    slot.pendingFrame.rawData.swap(img.rawData);
+    slot.pendingFrame.width = img.width;
+    slot.pendingFrame.height = img.height;
+    slot.pendingFrame.format = img.format;
+    slot.hasPendingFrame = true;
+    slot.submittedCount++;
+
+    pthread_cond_signal(&frameCond);
+    pthread_mutex_unlock(&mutex);
+
+    return true;
+}
+
+void DJICameraAnalyticsPool::printStatistics()
+{
+    pthread_mutex_lock(&mutex);
+    for (int i = 0; i < DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX; i++) {
+        if (!slots[i].isUsed) {
+            continue;
+        }
+
+        USER_LOG_INFO("[%s] analytics submitted %llu processed %llu dropped %llu, process time avg %.2f ms max %.2f ms",
+                      slots[i].name.c_str(), slots[i].submittedCount, slots[i].processedCount,
+                      slots[i].droppedCount,
+                      slots[i].processedCount ? slots[i].processTimeTotalMs / slots[i].processedCount : 0,
+                      slots[i].processTimeMaxMs);
+    }
+    resetStatisticsWithLock();
+    pthread_mutex_unlock(&mutex);
+}
+
+void DJICameraAnalyticsPool::resetStatistics()
+{
+    pthread_mutex_lock(&mutex);
+    resetStatisticsWithLock();
+    pthread_mutex_unlock(&mutex);
+}
+
+/* Private functions definition-----------------------------------------------*/
+void *DJICameraAnalyticsPool::workerThreadEntry(void *p)
+{
+    WorkerContext *context = static_cast<WorkerContext *>(p);
+
+    context->pool->workerThreadFunc(context->index);
+    return nullptr;
+}
+
+void *DJICameraAnalyticsPool::presenterThreadEntry(void *p)
+{
+    static_cast<DJICameraAnalyticsPool *>(p)->presenterThreadFunc();
+    return nullptr;
+}
+
+void DJICameraAnalyticsPool::workerThreadFunc(int workerIndex)
+{
+    CameraRGBImage frame;
+    int slotIndex;
+    double startTimeMs;
+    double spentTimeMs;
+
+    pthread_mutex_lock(&mutex);
+    while (isRunning) {
+        slotIndex = takePendingSlotWithLock();
+        if (slotIndex < 0) {
+            pthread_cond_wait(&frameCond, &mutex);
+            continue;
+        }
+
+        StreamSlot &slot = slots[slotIndex];
+        frame.rawData.swap(slot.pendingFrame.rawData);
+        frame.width = slot.pendingFrame.width;
+        frame.height = slot.pendingFrame.height;
+        frame.format = slot.pendingFrame.format;
+        slot.hasPendingFrame = false;
+        slot.isProcessing = true;
+        pthread_mutex_unlock(&mutex);
+
+        startTimeMs = DjiCameraAnalyticsPool_GetTimeMs();
+        if (processCallback) {
+            processCallback(frame, workerIndex, callbackUserData);
+        }
+        spentTimeMs = DjiCameraAnalyticsPool_GetTimeMs() - startTimeMs;
+
+        pthread_mutex_lock(&mutex);
+        slot.resultFrame.rawData.swap(frame.rawData);
+        slot.resultFrame.width = frame.width;
+        slot.resultFrame.height = frame.height;
+        slot.resultFrame.format = frame.format;
+        slot.hasResultFrame = true;
+        slot.isProcessing = false;
+        slot.processedCount++;
+        slot.processTimeTotalMs += spentTimeMs;
+        if (spentTimeMs > slot.processTimeMaxMs) {
+            slot.processTimeMaxMs = spentTimeMs;
+        }
+
+        pthread_cond_signal(&resultCond);
+        /* A newer frame of this stream may have been held back while it was being processed. */
+        if (slot.hasPendingFrame) {
+            pthread_cond_signal(&frameCond);
+        }
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+void DJICameraAnalyticsPool::presenterThreadFunc()
+{
+    CameraRGBImage frame;
+    std::string name;
+    int slotIndex;
+
+    pthread_mutex_lock(&mutex);
+    while (isRunning) {
+        slotIndex = -1;
+        for (int i = 0; i < DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX; i++) {
+            if (slots[i].isUsed && slots[i].hasResultFrame) {
+                slotIndex = i;
+                break;
+            }
+        }
+
+        if (slotIndex < 0) {
+            pthread_cond_wait(&resultCond, &mutex);
+            continue;
+        }
+
+        StreamSlot &slot = slots[slotIndex];
+        frame.rawData.swap(slot.resultFrame.rawData);
+        frame.width = slot.resultFrame.width;
+        frame.height = slot.resultFrame.height;
+        frame.format = slot.resultFrame.format;
+        name = slot.name;
+        slot.hasResultFrame = false;
+        pthread_mutex_unlock(&mutex);
+
+        if (presentCallback) {
+            presentCallback(frame, name.c_str(), callbackUserData);
+        }
+
+        pthread_mutex_lock(&mutex);
+    }
+    pthread_mutex_unlock(&mutex);
+}
+
+int DJICameraAnalyticsPool::findSlotWithLock(const char *name)
+{
+    int freeSlotIndex = -1;
+
+    for (int i = 0; i < DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX; i++) {
+        if (slots[i].isUsed && slots[i].name == name) {
+            return i;
+        }
+        if (!slots[i].isUsed && freeSlotIndex < 0) {
+            freeSlotIndex = i;
+        }
+    }
+
+    if (freeSlotIndex >= 0) {
+        slots[freeSlotIndex].name = name;
+        slots[freeSlotIndex].isUsed = true;
+    }
+
+    return freeSlotIndex;
+}
+
+void DJICameraAnalyticsPool::resetStatisticsWithLock()
+{
+    for (int i = 0; i < DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX; i++) {
+        slots[i].submittedCount = 0;
+        slots[i].droppedCount = 0;
+        slots[i].processedCount = 0;
+        slots[i].processTimeTotalMs = 0;
+        slots[i].processTimeMaxMs = 0;
+    }
+}
+
+int DJICameraAnalyticsPool::takePendingSlotWithLock()
+{
+    /* Round robin over the streams so one busy camera can not starve the others. */
+    for (int i = 0; i < DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX; i++) {
+        int slotIndex = (nextSlotIndex + i) % DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX;
+
+        if (slots[slotIndex].isUsed && slots[slotIndex].hasPendingFrame && !slots[slotIndex].isProcessing) {
+            nextSlotIndex = (slotIndex + 1) % DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX;
+            return slotIndex;
+        }
+    }
+
+    return -1;
+}
+
+static double DjiCameraAnalyticsPool_GetTimeMs(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,125 @@
+/**
+ ********************************************************************
+ * @file    dji_camera_analytics_pool.hpp
+ * @brief   This is the header file for "dji_camera_analytics_pool.cpp", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef DJI_CAMERA_ANALYTICS_POOL_H
+#define DJI_CAMERA_ANALYTICS_POOL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "pthread.h"
+#include <string>
+#include "dji_camera_image_handler.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX     (4)
+#define DJI_CAMERA_ANALYTICS_WORKER_NUM_MAX     (4)
+
+/* Exported types ------------------------------------------------------------*/
+/*! @note
+ * Runs on a worker thread. workerIndex is stable for the lifetime of the worker, so per-worker resources such as
+ * detection models can be indexed by it without extra locking.
+ */
+typedef void (*CameraAnalyticsProcessCallback)(CameraRGBImage &img, int workerIndex, void *userData);
+
+/*! @note Runs on the single presenter thread, which makes it the only place that touches the display. */
+typedef void (*CameraAnalyticsPresentCallback)(CameraRGBImage &img, const char *name, void *userData);
+
+/*! @note
+ * Moves image analytics off the decoder callback thread. Every stream keeps only its latest unprocessed frame, older
+ * frames are dropped and counted, so a slow detector never backs up the decoder. A stream is processed by at most one
+ * worker at a time to keep its results in order, while different streams are processed in parallel.
+ */
+class DJICameraAnalyticsPool {
+public:
+    DJICameraAnalyticsPool();
+    ~DJICameraAnalyticsPool();
+
+    bool start(int workerNum, CameraAnalyticsProcessCallback processCb, CameraAnalyticsPresentCallback presentCb,
+               void *userData);
+    void stop();
+    bool submitFrame(const char *name, CameraRGBImage &img);
+    /* Prints the counters since the last print and starts a new interval, so repeated runs report separately. */
+    void printStatistics();
+    void resetStatistics();
+
+private:
+    struct StreamSlot {
+        std::string name;
+        bool isUsed;
+        bool hasPendingFrame;
+        bool isProcessing;
+        bool hasResultFrame;
+        CameraRGBImage pendingFrame;
+        CameraRGBImage resultFrame;
+        uint64_t submittedCount;
+        uint64_t droppedCount;
+        uint64_t processedCount;
+        double processTimeTotalMs;
+        double processTimeMaxMs;
+    };
+
+    struct WorkerContext {
+        DJICameraAnalyticsPool *pool;
+        int index;
+    };
+
+    static void *workerThreadEntry(void *p);
+    static void *presenterThreadEntry(void *p);
+    void workerThreadFunc(int workerIndex);
+    void presenterThreadFunc();
+    int findSlotWithLock(const char *name);
+    int takePendingSlotWithLock();
+    void resetStatisticsWithLock();
+
+    StreamSlot slots[DJI_CAMERA_ANALYTICS_STREAM_NUM_MAX];
+    WorkerContext workerContexts[DJI_CAMERA_ANALYTICS_WORKER_NUM_MAX];
+    pthread_t workerThreads[DJI_CAMERA_ANALYTICS_WORKER_NUM_MAX];
+    pthread_t presenterThread;
+    int workerCount;
+    int nextSlotIndex;
+    bool isRunning;
+    bool presenterIsRunning;
+
+    CameraAnalyticsProcessCallback processCallback;
+    CameraAnalyticsPresentCallback presentCallback;
+    void *callbackUserData;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t frameCond;
+    pthread_cond_t resultCond;
+};
+
+/* Exported functions --------------------------------------------------------*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DJI_CAMERA_ANALYTICS_POOL_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -36,6 +36,9 @@
 /* Exported functions definition ---------------------------------------------*/
 DJICameraImageHandler::DJICameraImageHandler() : m_newImageFlag(false)
 {
+    m_img.height = 0;
+    m_img.width = 0;
+    m_img.format = DJI_CAMERA_IMAGE_FORMAT_RGB24;
     pthread_mutex_init(&m_mutex, NULL);
     pthread_cond_init(&m_condv, NULL);
 }
@@ -56,20 +59,31 @@ bool DJICameraImageHandler::getNewImageWithLock(CameraRGBImage &copyOfImage, int
      */
     pthread_mutex_lock(&m_mutex);
     if (m_newImageFlag) {
-        /* At this point, a copy of m_img is made, so it is safe to
-         * do any modifications to copyOfImage in user code.
+        /* At this point, the pixel buffer of m_img is handed over to copyOfImage, so it is safe to
+         * do any modifications to copyOfImage in user code. The next write refills m_img.
          */
-        copyOfImage = m_img;
+        copyOfImage.rawData.swap(m_img.rawData);
+        copyOfImage.height = m_img.height;
+        copyOfImage.width = m_img.width;
+        copyOfImage.format = m_img.format;
         m_newImageFlag = false;
         result = 0;
     } else {
         struct timespec absTimeout;
         clock_gettime(CLOCK_REALTIME, &absTimeout);
-        absTimeout.tv_nsec += timeoutMilliSec * 1e6;
+        absTimeout.tv_sec += timeoutMilliSec / 1000;
+        absTimeout.tv_nsec += (timeoutMilliSec % 1000) * 1000000L;
+        if (absTimeout.tv_nsec >= 1000000000L) {
+            absTimeout.tv_sec += 1;
+            absTimeout.tv_nsec -= 1000000000L;
+        }
         result = pthread_cond_timedwait(&m_condv, &m_mutex, &absTimeout);
 
         if (result == 0) {
-            copyOfImage = m_img;
+            copyOfImage.rawData.swap(m_img.rawData);
+            copyOfImage.height = m_img.height;
+            copyOfImage.width = m_img.width;
+            copyOfImage.format = m_img.format;
             m_newImageFlag = false;
         }
     }
@@ -77,13 +91,15 @@ bool DJICameraImageHandler::getNewImageWithLock(CameraRGBImage &copyOfImage, int
     return (result == 0) ? true : false;
 }
 
-void DJICameraImageHandler::writeNewImageWithLock(uint8_t *buf, int bufSize, int width, int height)
+void DJICameraImageHandler::writeNewImageWithLock(uint8_t *buf, int bufSize, int width, int height,
+                                                  E_DjiCameraImageFormat format)
 {
     pthread_mutex_lock(&m_mutex);
 
     m_img.rawData.assign(buf, buf + bufSize);
     m_img.height = height;
     m_img.width = width;
+    m_img.format = format;
     m_newImageFlag = true;
 
     pthread_cond_signal(&m_condv);
@@ -39,10 +39,45 @@ extern "C" {
 /* Exported constants --------------------------------------------------------*/
 
 /* Exported types ------------------------------------------------------------*/
+typedef enum {
+    DJI_CAMERA_IMAGE_FORMAT_RGB24 = 0, /*!< Packed RGB 8:8:8, the default output format. */
+    DJI_CAMERA_IMAGE_FORMAT_BGR24, /*!< Packed BGR 8:8:8, the native channel order of OpenCV. */
+    DJI_CAMERA_IMAGE_FORMAT_GRAY8, /*!< Single luma plane. */
+    DJI_CAMERA_IMAGE_FORMAT_NV12, /*!< Luma plane followed by an interleaved UV plane. */
+    DJI_CAMERA_IMAGE_FORMAT_YUV420P, /*!< Planar YUV 4:2:0, the native decoder output. */
+} E_DjiCameraImageFormat;
+
+/*! @note
+ * Output format and geometry requested by an image consumer. The crop rectangle is applied to the decoded
+ * frame first and the result is then scaled to outputWidth x outputHeight. A zero crop size selects the
+ * full frame, a zero output size keeps the cropped size. When YUV420P is requested without crop or scaling,
+ * the decoded planes are handed over without any pixel conversion.
+ */
+struct CameraImageOutputConfig {
+    CameraImageOutputConfig()
+        : format(DJI_CAMERA_IMAGE_FORMAT_RGB24), cropX(0), cropY(0), cropWidth(0), cropHeight(0),
+          outputWidth(0), outputHeight(0)
+    {}
+
+    explicit CameraImageOutputConfig(E_DjiCameraImageFormat fmt, int width = 0, int height = 0)
+        : format(fmt), cropX(0), cropY(0), cropWidth(0), cropHeight(0),
+          outputWidth(width), outputHeight(height)
+    {}
+
+    E_DjiCameraImageFormat format;
+    int cropX;
+    int cropY;
+    int cropWidth;
+    int cropHeight;
+    int outputWidth;
+    int outputHeight;
+};
+
 struct CameraRGBImage {
     std::vector<uint8_t> rawData;
     int height;
     int width;
+    E_DjiCameraImageFormat format;
 };
 
 typedef void (*CameraImageCallback)(CameraRGBImage pImg, void *userData);
@@ -54,7 +89,8 @@ public:
     DJICameraImageHandler();
     ~DJICameraImageHandler();
 
-    void writeNewImageWithLock(uint8_t *buf, int bufSize, int width, int height);
+    void writeNewImageWithLock(uint8_t *buf, int bufSize, int width, int height,
+                               E_DjiCameraImageFormat format = DJI_CAMERA_IMAGE_FORMAT_RGB24);
     bool getNewImageWithLock(CameraRGBImage &copyOfImage, int timeoutMilliSec);
 
 private:
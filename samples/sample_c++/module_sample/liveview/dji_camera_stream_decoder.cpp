@@ -27,6 +27,7 @@
 #include "unistd.h"
 #include "pthread.h"
 #include "dji_logger.h"
+#include <utility>
 
 /* Private constants ---------------------------------------------------------*/
 
@@ -35,6 +36,9 @@
 /* Private values -------------------------------------------------------------*/
 
 /* Private functions declaration ---------------------------------------------*/
+#ifdef FFMPEG_INSTALLED
+static AVPixelFormat DjiCameraStreamDecoder_GetAvPixelFormat(E_DjiCameraImageFormat format);
+#endif
 
 /* Exported functions definition ---------------------------------------------*/
 DJICameraStreamDecoder::DJICameraStreamDecoder()
@@ -43,28 +47,34 @@ DJICameraStreamDecoder::DJICameraStreamDecoder()
       cbThreadStatus(-1),
       cb(nullptr),
       cbUserParam(nullptr),
+      waitForKeyFrame(false),
+      decodedFrameCount(0),
+      frameBridge(nullptr),
+      frameBridgeSourceIndex(0),
 #ifdef FFMPEG_INSTALLED
       pCodecCtx(nullptr),
       pCodec(nullptr),
       pCodecParserCtx(nullptr),
       pSwsCtx(nullptr),
       pFrameYUV(nullptr),
-      pFrameRGB(nullptr),
 #endif
-      bufSize(0)
+      outputBuffer()
 {
     pthread_mutex_init(&decodemutex, nullptr);
+    pthread_mutex_init(&frameBridgeMutex, nullptr);
 }
 
 DJICameraStreamDecoder::~DJICameraStreamDecoder()
 {
-    pthread_mutex_destroy(&decodemutex);
     if(cb)
     {
         registerCallback(nullptr, nullptr);
     }
 
     cleanup();
+    // Both calls above lock the decode mutex, it goes last.
+    pthread_mutex_destroy(&frameBridgeMutex);
+    pthread_mutex_destroy(&decodemutex);
 }
 
 bool DJICameraStreamDecoder::init()
@@ -73,6 +83,7 @@ bool DJICameraStreamDecoder::init()
 
     if (true == initSuccess) {
         USER_LOG_INFO("Decoder already initialized.\n");
+        pthread_mutex_unlock(&decodemutex);
         return true;
     }
 
@@ -80,6 +91,7 @@ bool DJICameraStreamDecoder::init()
     // avcodec_register_all();
     pCodecCtx = avcodec_alloc_context3(nullptr);
     if (!pCodecCtx) {
+        pthread_mutex_unlock(&decodemutex);
         return false;
     }
 
@@ -87,21 +99,19 @@ bool DJICameraStreamDecoder::init()
     // pCodec = avcodec_find_decoder(AV_CODEC_ID_H264);
     pCodec = const_cast<AVCodec *>(avcodec_find_decoder(AV_CODEC_ID_H264));
     if (!pCodec || avcodec_open2(pCodecCtx, pCodec, nullptr) < 0) {
+        pthread_mutex_unlock(&decodemutex);
         return false;
     }
 
     pCodecParserCtx = av_parser_init(AV_CODEC_ID_H264);
     if (!pCodecParserCtx) {
+        pthread_mutex_unlock(&decodemutex);
         return false;
     }
 
     pFrameYUV = av_frame_alloc();
     if (!pFrameYUV) {
-        return false;
-    }
-
-    pFrameRGB = av_frame_alloc();
-    if (!pFrameRGB) {
+        pthread_mutex_unlock(&decodemutex);
         return false;
     }
 
@@ -146,13 +156,44 @@ void DJICameraStreamDecoder::cleanup()
         av_free(pCodecCtx);
         pCodecCtx = nullptr;
     }
+#endif
+    outputBuffer.clear();
+    pthread_mutex_unlock(&decodemutex);
+}
+
+/*! @note
+ * Drops all codec state but keeps the decoder, its threads and the scaler alive, so a new stream can be decoded
+ * without the cost of a full init(). Packets are discarded until the next key frame to avoid corrupted output.
+ */
+void DJICameraStreamDecoder::flush()
+{
+    pthread_mutex_lock(&decodemutex);
+
+#ifdef FFMPEG_INSTALLED
+    if (nullptr != pCodecCtx) {
+        avcodec_flush_buffers(pCodecCtx);
+    }
 
-    if (nullptr != pFrameRGB) {
-        av_free(pFrameRGB);
-        pFrameRGB = nullptr;
+    /* The parser may hold a partial access unit of the previous stream and has no flush call. */
+    if (nullptr != pCodecParserCtx) {
+        av_parser_close(pCodecParserCtx);
+        pCodecParserCtx = av_parser_init(AV_CODEC_ID_H264);
     }
 #endif
+    waitForKeyFrame = true;
+
+    pthread_mutex_unlock(&decodemutex);
+}
+
+uint64_t DJICameraStreamDecoder::getDecodedFrameCount()
+{
+    uint64_t count;
+
+    pthread_mutex_lock(&decodemutex);
+    count = decodedFrameCount;
     pthread_mutex_unlock(&decodemutex);
+
+    return count;
 }
 
 void *DJICameraStreamDecoder::callbackThreadEntry(void *p)
@@ -172,12 +213,34 @@ void DJICameraStreamDecoder::callbackThreadFunc()
             continue;
         }
 
+        pthread_mutex_lock(&frameBridgeMutex);
+        if (frameBridge) {
+            T_DjiFrameBridgeFrameInfo info = {};
+
+            info.source = DJI_FRAME_BRIDGE_SOURCE_LIVEVIEW;
+            info.sourceIndex = frameBridgeSourceIndex;
+            info.format = copyOfImage.format;
+            info.width = copyOfImage.width;
+            info.height = copyOfImage.height;
+            info.dataSize = copyOfImage.rawData.size();
+            DjiFrameBridge_Publish(frameBridge, &info, copyOfImage.rawData.data());
+        }
+        pthread_mutex_unlock(&frameBridgeMutex);
+
         if (cb) {
-            (*cb)(copyOfImage, cbUserParam);
+            (*cb)(std::move(copyOfImage), cbUserParam);
         }
     }
 }
 
+void DJICameraStreamDecoder::setFrameBridge(T_DjiFrameBridgeHandle bridge, uint32_t sourceIndex)
+{
+    pthread_mutex_lock(&frameBridgeMutex);
+    frameBridge = bridge;
+    frameBridgeSourceIndex = sourceIndex;
+    pthread_mutex_unlock(&frameBridgeMutex);
+}
+
 void DJICameraStreamDecoder::decodeBuffer(const uint8_t *buf, int bufLen)
 {
     const uint8_t *pData = buf;
@@ -201,40 +264,22 @@ void DJICameraStreamDecoder::decodeBuffer(const uint8_t *buf, int bufLen)
         pData += processedLen;
 
         if (pkt.size > 0) {
+            if (waitForKeyFrame) {
+                if (pCodecParserCtx->key_frame != 1) {
+                    continue;
+                }
+                waitForKeyFrame = false;
+            }
+
             int ret = avcodec_send_packet(pCodecCtx, &pkt);
             ret = avcodec_receive_frame(pCodecCtx, pFrameYUV);
 
             if(0 != ret) {
                 continue;
             } else {
-                int w = pFrameYUV->width;
-                int h = pFrameYUV->height;
-                ////DSTATUS_PRIVATE("Got picture! size=%dx%d\n", w, h);
-
-                if (nullptr == pSwsCtx) {
-                    pSwsCtx = sws_getContext(w, h, pCodecCtx->pix_fmt,
-                                             w, h, AV_PIX_FMT_RGB24,
-                                             4, nullptr, nullptr, nullptr);
-                }
-
-                if( 0 == bufSize) {
-                    bufSize = w * h * 3;
-                    pFrameRGB->width = w;
-                    pFrameRGB->height = h;
-                    pFrameRGB->format = AV_PIX_FMT_RGB24;
-                    av_frame_get_buffer(pFrameRGB, 1);
-                }
-
-                if (nullptr != pSwsCtx && 0 != bufSize) {
-                    sws_scale(pSwsCtx,
-                              (uint8_t const *const *) pFrameYUV->data, pFrameYUV->linesize, 0, pFrameYUV->height,
-                              pFrameRGB->data, pFrameRGB->linesize);
-
-                    pFrameRGB->height = h;
-                    pFrameRGB->width = w;
-
-                    decodedImageHandler.writeNewImageWithLock(pFrameRGB->data[0], bufSize, w, h);
-                }
+                ////DSTATUS_PRIVATE("Got picture! size=%dx%d\n", pFrameYUV->width, pFrameYUV->height);
+                decodedFrameCount++;
+                convertDecodedFrame();
             }
         }
     }
@@ -245,6 +290,16 @@ void DJICameraStreamDecoder::decodeBuffer(const uint8_t *buf, int bufLen)
 
 bool DJICameraStreamDecoder::registerCallback(CameraImageCallback f, void *param)
 {
+    return registerCallback(f, param, CameraImageOutputConfig());
+}
+
+bool DJICameraStreamDecoder::registerCallback(CameraImageCallback f, void *param,
+                                              const CameraImageOutputConfig &config)
+{
+    pthread_mutex_lock(&decodemutex);
+    outputConfig = config;
+    pthread_mutex_unlock(&decodemutex);
+
     cb = f;
     cbUserParam = param;
 
@@ -276,5 +331,105 @@ bool DJICameraStreamDecoder::registerCallback(CameraImageCallback f, void *param
 }
 
 /* Private functions definition-----------------------------------------------*/
+#ifdef FFMPEG_INSTALLED
+void DJICameraStreamDecoder::convertDecodedFrame()
+{
+    AVPixelFormat srcFormat = static_cast<AVPixelFormat>(pFrameYUV->format);
+    AVPixelFormat dstFormat = DjiCameraStreamDecoder_GetAvPixelFormat(outputConfig.format);
+    const AVPixFmtDescriptor *srcDesc = av_pix_fmt_desc_get(srcFormat);
+    int srcPixSteps[4];
+    const uint8_t *srcData[4] = {nullptr};
+    uint8_t *dstData[4] = {nullptr};
+    int dstLinesize[4] = {};
+    int cropX, cropY, cropWidth, cropHeight;
+    int outWidth, outHeight;
+    int outSize;
+    bool isSameLayout;
+
+    if (nullptr == srcDesc) {
+        return;
+    }
+
+    /* Chroma subsampled planes can only be cropped on whole chroma samples. */
+    cropX = outputConfig.cropX & ~((1 << srcDesc->log2_chroma_w) - 1);
+    cropY = outputConfig.cropY & ~((1 << srcDesc->log2_chroma_h) - 1);
+    if (cropX < 0 || cropY < 0 || cropX >= pFrameYUV->width || cropY >= pFrameYUV->height) {
+        cropX = 0;
+        cropY = 0;
+    }
+
+    cropWidth = outputConfig.cropWidth > 0 ? outputConfig.cropWidth : pFrameYUV->width;
+    cropHeight = outputConfig.cropHeight > 0 ? outputConfig.cropHeight : pFrameYUV->height;
+    if (cropX + cropWidth > pFrameYUV->width) {
+        cropWidth = pFrameYUV->width - cropX;
+    }
+    if (cropY + cropHeight > pFrameYUV->height) {
+        cropHeight = pFrameYUV->height - cropY;
+    }
+
+    outWidth = outputConfig.outputWidth > 0 ? outputConfig.outputWidth : cropWidth;
+    outHeight = outputConfig.outputHeight > 0 ? outputConfig.outputHeight : cropHeight;
+
+    outSize = av_image_get_buffer_size(dstFormat, outWidth, outHeight, 1);
+    if (outSize <= 0) {
+        return;
+    }
+    if (outputBuffer.size() != (size_t) outSize) {
+        outputBuffer.resize(outSize);
+    }
+
+    isSameLayout = (srcFormat == dstFormat) ||
+                   (srcFormat == AV_PIX_FMT_YUVJ420P && dstFormat == AV_PIX_FMT_YUV420P);
+
+    if (isSameLayout && cropWidth == pFrameYUV->width && cropHeight == pFrameYUV->height &&
+        outWidth == cropWidth && outHeight == cropHeight) {
+        /* Native passthrough: only pack the decoder planes, no pixel conversion pass. */
+        av_image_copy_to_buffer(outputBuffer.data(), outSize, pFrameYUV->data, pFrameYUV->linesize,
+                                dstFormat, outWidth, outHeight, 1);
+    } else {
+        av_image_fill_max_pixsteps(srcPixSteps, nullptr, srcDesc);
+        for (int i = 0; i < 4 && nullptr != pFrameYUV->data[i]; i++) {
+            int shiftW = (i == 1 || i == 2) ? srcDesc->log2_chroma_w : 0;
+            int shiftH = (i == 1 || i == 2) ? srcDesc->log2_chroma_h : 0;
+
+            srcData[i] = pFrameYUV->data[i] + (cropY >> shiftH) * pFrameYUV->linesize[i] +
+                         (cropX >> shiftW) * srcPixSteps[i];
+        }
+
+        av_image_fill_arrays(dstData, dstLinesize, outputBuffer.data(), dstFormat, outWidth, outHeight, 1);
+
+        pSwsCtx = sws_getCachedContext(pSwsCtx, cropWidth, cropHeight, srcFormat,
+                                       outWidth, outHeight, dstFormat,
+                                       (outWidth < cropWidth || outHeight < cropHeight) ? SWS_AREA : SWS_BICUBIC,
+                                       nullptr, nullptr, nullptr);
+        if (nullptr == pSwsCtx) {
+            return;
+        }
+
+        sws_scale(pSwsCtx, srcData, pFrameYUV->linesize, 0, cropHeight, dstData, dstLinesize);
+    }
+
+    decodedImageHandler.writeNewImageWithLock(outputBuffer.data(), outSize, outWidth, outHeight,
+                                              outputConfig.format);
+}
+
+static AVPixelFormat DjiCameraStreamDecoder_GetAvPixelFormat(E_DjiCameraImageFormat format)
+{
+    switch (format) {
+        case DJI_CAMERA_IMAGE_FORMAT_BGR24:
+            return AV_PIX_FMT_BGR24;
+        case DJI_CAMERA_IMAGE_FORMAT_GRAY8:
+            return AV_PIX_FMT_GRAY8;
+        case DJI_CAMERA_IMAGE_FORMAT_NV12:
+            return AV_PIX_FMT_NV12;
+        case DJI_CAMERA_IMAGE_FORMAT_YUV420P:
+            return AV_PIX_FMT_YUV420P;
+        case DJI_CAMERA_IMAGE_FORMAT_RGB24:
+        default:
+            return AV_PIX_FMT_RGB24;
+    }
+}
+#endif
+
 
 /****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -33,11 +33,14 @@ extern "C" {
 #include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
 #include <libswscale/swscale.h>
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
 #endif
 }
 
 #include "pthread.h"
 #include "dji_camera_image_handler.hpp"
+#include "frame_bridge/dji_frame_bridge.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -52,11 +55,15 @@ public:
     ~DJICameraStreamDecoder();
     bool init();
     void cleanup();
+    void flush();
+    uint64_t getDecodedFrameCount();
 
     void callbackThreadFunc();
     void decodeBuffer(const uint8_t *pBuf, int len);
     static void *callbackThreadEntry(void *p);
     bool registerCallback(CameraImageCallback f, void *param);
+    bool registerCallback(CameraImageCallback f, void *param, const CameraImageOutputConfig &config);
+    void setFrameBridge(T_DjiFrameBridgeHandle bridge, uint32_t sourceIndex);
     DJICameraImageHandler decodedImageHandler;
 
 private:
@@ -66,8 +73,15 @@ private:
     int cbThreadStatus;
     CameraImageCallback cb;
     void *cbUserParam;
+    CameraImageOutputConfig outputConfig;
+    bool waitForKeyFrame;
+    uint64_t decodedFrameCount;
 
     pthread_mutex_t decodemutex;
+    /* Held around every publish, so clearing the bridge waits for the frame in flight before it is destroyed. */
+    pthread_mutex_t frameBridgeMutex;
+    T_DjiFrameBridgeHandle frameBridge;
+    uint32_t frameBridgeSourceIndex;
 
 #ifdef FFMPEG_INSTALLED
     AVCodecContext *pCodecCtx;
@@ -76,9 +90,10 @@ private:
     SwsContext *pSwsCtx;
 
     AVFrame *pFrameYUV;
-    AVFrame *pFrameRGB;
+
+    void convertDecodedFrame();
 #endif
-    size_t bufSize;
+    std::vector<uint8_t> outputBuffer;
 };
 
 /* Exported functions --------------------------------------------------------*/
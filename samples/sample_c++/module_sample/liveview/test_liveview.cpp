@@ -24,186 +24,249 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "test_liveview.hpp"
+#include "dji_platform.h"
+#include "dji_logger.h"
 
 /* Private constants ---------------------------------------------------------*/
+#define LIVEVIEW_SWITCH_HANDOFF_TIMEOUT_MS      (2000)
+#define LIVEVIEW_SWITCH_HANDOFF_CHECK_MS        (10)
 
 /* Private types -------------------------------------------------------------*/
 
 /* Private values -------------------------------------------------------------*/
-std::map<::E_DjiLiveViewCameraPosition, DJICameraStreamDecoder *> streamDecoder;
+/* The H.264 callback carries no user data, it reaches the streams of the sample through this pointer. */
+static std::atomic<LiveviewSample *> s_liveviewSample(nullptr);
 
 /* Private functions declaration ---------------------------------------------*/
-static void LiveviewConvertH264ToRgbCallback(E_DjiLiveViewCameraPosition position, const uint8_t *buf, uint32_t bufLen);
 
 /* Exported functions definition ---------------------------------------------*/
 LiveviewSample::LiveviewSample()
 {
     T_DjiReturnCode returnCode;
+    const E_DjiLiveViewCameraPosition positions[] = {
+        DJI_LIVEVIEW_CAMERA_POSITION_FPV,
+        DJI_LIVEVIEW_CAMERA_POSITION_NO_1,
+        DJI_LIVEVIEW_CAMERA_POSITION_NO_2,
+        DJI_LIVEVIEW_CAMERA_POSITION_NO_3,
+    };
 
     returnCode = DjiLiveview_Init();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         throw ("Liveview init failed");
     }
 
-    streamDecoder = {
-        {DJI_LIVEVIEW_CAMERA_POSITION_FPV,  (new DJICameraStreamDecoder())},
-        {DJI_LIVEVIEW_CAMERA_POSITION_NO_1, (new DJICameraStreamDecoder())},
-        {DJI_LIVEVIEW_CAMERA_POSITION_NO_2, (new DJICameraStreamDecoder())},
-        {DJI_LIVEVIEW_CAMERA_POSITION_NO_3, (new DJICameraStreamDecoder())},
-    };
+    for (auto &context : streamContext) {
+        context.decoder = nullptr;
+        context.isStreaming = false;
+    }
+
+    for (auto position : positions) {
+        streamContext[position].decoder = new DJICameraStreamDecoder();
+        streamContext[position].source = DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT;
+        streamContext[position].callback = nullptr;
+        streamContext[position].userData = nullptr;
+    }
+
+    s_liveviewSample = this;
 }
 
 LiveviewSample::~LiveviewSample()
 {
     T_DjiReturnCode returnCode;
+    LiveviewSample *sample = this;
+
+    StopAllCameraStreams();
 
     returnCode = DjiLiveview_Deinit();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         perror("Liveview deinit failed");
     }
 
-    for (auto pair : streamDecoder) {
-        if (pair.second) {
-            delete pair.second;
+    /* A newer sample may own the callback by now, only hand it back if it is still ours. */
+    s_liveviewSample.compare_exchange_strong(sample, nullptr);
+
+    for (auto &context : streamContext) {
+        if (context.decoder) {
+            delete context.decoder;
+            context.decoder = nullptr;
         }
     }
 }
 
-T_DjiReturnCode LiveviewSample::StartFpvCameraStream(CameraImageCallback callback, void *userData)
+T_DjiReturnCode LiveviewSample::StartCameraStream(E_DjiLiveViewCameraPosition position,
+                                                  E_DjiLiveViewCameraSource source,
+                                                  CameraImageCallback callback, void *userData,
+                                                  const CameraImageOutputConfig &config)
 {
-    auto deocder = streamDecoder.find(DJI_LIVEVIEW_CAMERA_POSITION_FPV);
-
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->init();
-        deocder->second->registerCallback(callback, userData);
+    T_LiveviewStreamContext *context = GetStreamContext(position);
+    T_DjiReturnCode returnCode;
 
-        return DjiLiveview_StartH264Stream(DJI_LIVEVIEW_CAMERA_POSITION_FPV, DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT,
-                                           LiveviewConvertH264ToRgbCallback);
-    } else {
+    if (context == nullptr) {
         return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
     }
-}
-
-T_DjiReturnCode LiveviewSample::StartMainCameraStream(CameraImageCallback callback, void *userData)
-{
-    auto deocder = streamDecoder.find(DJI_LIVEVIEW_CAMERA_POSITION_NO_1);
-
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->init();
-        deocder->second->registerCallback(callback, userData);
 
-        return DjiLiveview_StartH264Stream(DJI_LIVEVIEW_CAMERA_POSITION_NO_1, DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT,
-                                           LiveviewConvertH264ToRgbCallback);
-    } else {
-        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    if (context->isStreaming) {
+        USER_LOG_WARN("Camera stream of position %d is already started.", position);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
     }
-}
 
-T_DjiReturnCode LiveviewSample::StartViceCameraStream(CameraImageCallback callback, void *userData)
-{
-    auto deocder = streamDecoder.find(DJI_LIVEVIEW_CAMERA_POSITION_NO_2);
+    /* Only the first start pays for the decoder init, later starts just restart at the next key frame. */
+    if (!context->decoder->init()) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    context->decoder->flush();
+    context->decoder->registerCallback(callback, userData, config);
 
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->init();
-        deocder->second->registerCallback(callback, userData);
+    context->source = source;
+    context->callback = callback;
+    context->userData = userData;
+    context->config = config;
 
-        return DjiLiveview_StartH264Stream(DJI_LIVEVIEW_CAMERA_POSITION_NO_2, DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT,
-                                           LiveviewConvertH264ToRgbCallback);
-    } else {
-        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    /* Buffers delivered before the start returns are dropped, the decoder waits for a key frame anyway. */
+    returnCode = DjiLiveview_StartH264Stream(position, source, ConvertH264ToRgbCallback);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
     }
+    context->isStreaming = true;
+
+    return returnCode;
 }
 
-T_DjiReturnCode LiveviewSample::StartTopCameraStream(CameraImageCallback callback, void *userData)
+T_DjiReturnCode LiveviewSample::StopCameraStream(E_DjiLiveViewCameraPosition position)
 {
-    auto deocder = streamDecoder.find(DJI_LIVEVIEW_CAMERA_POSITION_NO_3);
+    T_LiveviewStreamContext *context = GetStreamContext(position);
 
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->init();
-        deocder->second->registerCallback(callback, userData);
-
-        return DjiLiveview_StartH264Stream(DJI_LIVEVIEW_CAMERA_POSITION_NO_3, DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT,
-                                           LiveviewConvertH264ToRgbCallback);
-    } else {
+    if (context == nullptr) {
         return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
     }
+
+    /* Stop feeding the decoder right away, it stays initialized for the next start. */
+    context->isStreaming = false;
+
+    return DjiLiveview_StopH264Stream(position, context->source);
 }
 
-T_DjiReturnCode LiveviewSample::StopFpvCameraStream()
+/*! @note
+ * Switching keeps the current picture until the new stream delivers its first decoded frame. For a different position
+ * the new stream is started first and the old one is only stopped once the new decoder has passed a key frame. For a
+ * new source on the same position the warm decoder is flushed and resumes at the next key frame.
+ */
+T_DjiReturnCode LiveviewSample::SwitchCameraStream(E_DjiLiveViewCameraPosition fromPosition,
+                                                   E_DjiLiveViewCameraPosition toPosition,
+                                                   E_DjiLiveViewCameraSource toSource, void *toUserData)
 {
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_LiveviewStreamContext *fromContext = GetStreamContext(fromPosition);
+    T_LiveviewStreamContext *toContext = GetStreamContext(toPosition);
     T_DjiReturnCode returnCode;
+    uint64_t decodedFrameCount;
+    uint32_t waitTimeMs = 0;
 
-    returnCode = DjiLiveview_StopH264Stream(DJI_LIVEVIEW_CAMERA_POSITION_FPV, DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        return returnCode;
+    if (fromContext == nullptr || toContext == nullptr) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
     }
 
-    auto deocder = streamDecoder.find(DJI_LIVEVIEW_CAMERA_POSITION_FPV);
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->cleanup();
+    if (!fromContext->isStreaming) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
     }
 
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
-}
+    if (fromPosition == toPosition) {
+        if (fromContext->source == toSource) {
+            return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+        }
 
-T_DjiReturnCode LiveviewSample::StopMainCameraStream()
-{
-    T_DjiReturnCode returnCode;
+        returnCode = DjiLiveview_StopH264Stream(fromPosition, fromContext->source);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
+
+        fromContext->decoder->flush();
+        fromContext->source = toSource;
+
+        returnCode = DjiLiveview_StartH264Stream(fromPosition, toSource, ConvertH264ToRgbCallback);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            fromContext->isStreaming = false;
+        }
+
+        return returnCode;
+    }
+
+    if (toContext->isStreaming) {
+        return StopCameraStream(fromPosition);
+    }
 
-    returnCode = DjiLiveview_StopH264Stream(DJI_LIVEVIEW_CAMERA_POSITION_NO_1, DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT);
+    decodedFrameCount = toContext->decoder->getDecodedFrameCount();
+    returnCode = StartCameraStream(toPosition, toSource, fromContext->callback, toUserData, fromContext->config);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         return returnCode;
     }
 
-    auto deocder = streamDecoder.find(DJI_LIVEVIEW_CAMERA_POSITION_NO_1);
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->cleanup();
+    while (toContext->decoder->getDecodedFrameCount() == decodedFrameCount &&
+           waitTimeMs < LIVEVIEW_SWITCH_HANDOFF_TIMEOUT_MS) {
+        osalHandler->TaskSleepMs(LIVEVIEW_SWITCH_HANDOFF_CHECK_MS);
+        waitTimeMs += LIVEVIEW_SWITCH_HANDOFF_CHECK_MS;
     }
 
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    if (waitTimeMs >= LIVEVIEW_SWITCH_HANDOFF_TIMEOUT_MS) {
+        USER_LOG_WARN("No key frame from camera position %d within %d ms, switch anyway.", toPosition,
+                      LIVEVIEW_SWITCH_HANDOFF_TIMEOUT_MS);
+    }
+
+    return StopCameraStream(fromPosition);
 }
 
-T_DjiReturnCode LiveviewSample::StopViceCameraStream()
+T_DjiReturnCode LiveviewSample::StopAllCameraStreams()
 {
-    T_DjiReturnCode returnCode;
-
-    returnCode = DjiLiveview_StopH264Stream(DJI_LIVEVIEW_CAMERA_POSITION_NO_2, DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        return returnCode;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    for (int i = 0; i < LIVEVIEW_CAMERA_POSITION_NUM_MAX; i++) {
+        if (streamContext[i].decoder && streamContext[i].isStreaming) {
+            T_DjiReturnCode stopReturnCode = StopCameraStream((E_DjiLiveViewCameraPosition) i);
+            if (stopReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                returnCode = stopReturnCode;
+            }
+        }
     }
 
-    auto deocder = streamDecoder.find(DJI_LIVEVIEW_CAMERA_POSITION_NO_2);
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->cleanup();
+    return returnCode;
+}
+
+T_DjiReturnCode LiveviewSample::SetFrameBridge(T_DjiFrameBridgeHandle bridge)
+{
+    /* Frames are tagged with the camera position, so a subscriber can tell the streams apart after a switch. */
+    for (int i = 0; i < LIVEVIEW_CAMERA_POSITION_NUM_MAX; i++) {
+        if (streamContext[i].decoder) {
+            streamContext[i].decoder->setFrameBridge(bridge, i);
+        }
     }
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-T_DjiReturnCode LiveviewSample::StopTopCameraStream()
+/* Private functions definition-----------------------------------------------*/
+void LiveviewSample::ConvertH264ToRgbCallback(E_DjiLiveViewCameraPosition position, const uint8_t *buf,
+                                              uint32_t bufLen)
 {
-    T_DjiReturnCode returnCode;
+    LiveviewSample *sample = s_liveviewSample;
+    T_LiveviewStreamContext *context;
 
-    returnCode = DjiLiveview_StopH264Stream(DJI_LIVEVIEW_CAMERA_POSITION_NO_3, DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        return returnCode;
+    if (sample == nullptr) {
+        return;
     }
 
-    auto deocder = streamDecoder.find(DJI_LIVEVIEW_CAMERA_POSITION_NO_3);
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->cleanup();
+    context = sample->GetStreamContext(position);
+    if (context && context->isStreaming) {
+        context->decoder->decodeBuffer(buf, bufLen);
     }
-
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-/* Private functions definition-----------------------------------------------*/
-static void LiveviewConvertH264ToRgbCallback(E_DjiLiveViewCameraPosition position, const uint8_t *buf, uint32_t bufLen)
+T_LiveviewStreamContext *LiveviewSample::GetStreamContext(E_DjiLiveViewCameraPosition position)
 {
-    auto deocder = streamDecoder.find(position);
-    if ((deocder != streamDecoder.end()) && deocder->second) {
-        deocder->second->decodeBuffer(buf, bufLen);
+    if ((uint32_t) position >= LIVEVIEW_CAMERA_POSITION_NUM_MAX || streamContext[position].decoder == nullptr) {
+        return nullptr;
     }
+
+    return &streamContext[position];
 }
 
 /****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
\ No newline at end of file
@@ -28,8 +28,8 @@
 #define TEST_LIVEVIEW_H
 
 /* Includes ------------------------------------------------------------------*/
+#include <atomic>
 #include "dji_liveview.h"
-#include <map>
 #include "dji_camera_stream_decoder.hpp"
 
 #ifdef __cplusplus
@@ -37,26 +37,45 @@ extern "C" {
 #endif
 
 /* Exported constants --------------------------------------------------------*/
+#define LIVEVIEW_CAMERA_POSITION_NUM_MAX        (DJI_LIVEVIEW_CAMERA_POSITION_FPV + 1)
 
 /* Exported types ------------------------------------------------------------*/
 using namespace std;
 
+typedef struct {
+    DJICameraStreamDecoder *decoder;
+    std::atomic<bool> isStreaming;
+    E_DjiLiveViewCameraSource source;
+    CameraImageCallback callback;
+    void *userData;
+    CameraImageOutputConfig config;
+} T_LiveviewStreamContext;
+
+/*! @note
+ * Manages the H.264 streams of all camera positions. Every position owns one decoder which is created with the
+ * sample and kept warm across stop, start and switch, so changing cameras never pays for a decoder rebuild.
+ */
 class LiveviewSample {
 public:
     LiveviewSample();
     ~LiveviewSample();
 
-    T_DjiReturnCode StartFpvCameraStream(CameraImageCallback callback, void *userData);
-    T_DjiReturnCode StopFpvCameraStream();
-
-    T_DjiReturnCode StartMainCameraStream(CameraImageCallback callback, void *userData);
-    T_DjiReturnCode StopMainCameraStream();
+    T_DjiReturnCode StartCameraStream(E_DjiLiveViewCameraPosition position, E_DjiLiveViewCameraSource source,
+                                      CameraImageCallback callback, void *userData,
+                                      const CameraImageOutputConfig &config = CameraImageOutputConfig());
+    T_DjiReturnCode StopCameraStream(E_DjiLiveViewCameraPosition position);
+    T_DjiReturnCode SwitchCameraStream(E_DjiLiveViewCameraPosition fromPosition,
+                                       E_DjiLiveViewCameraPosition toPosition,
+                                       E_DjiLiveViewCameraSource toSource, void *toUserData);
+    T_DjiReturnCode StopAllCameraStreams();
+    T_DjiReturnCode SetFrameBridge(T_DjiFrameBridgeHandle bridge);
 
-    T_DjiReturnCode StartViceCameraStream(CameraImageCallback callback, void *userData);
-    T_DjiReturnCode StopViceCameraStream();
+private:
+    static void ConvertH264ToRgbCallback(E_DjiLiveViewCameraPosition position, const uint8_t *buf, uint32_t bufLen);
+    T_LiveviewStreamContext *GetStreamContext(E_DjiLiveViewCameraPosition position);
 
-    T_DjiReturnCode StartTopCameraStream(CameraImageCallback callback, void *userData);
-    T_DjiReturnCode StopTopCameraStream();
+    /* Indexed by camera position, so the H.264 callback finds its decoder without any lookup or lock. */
+    T_LiveviewStreamContext streamContext[LIVEVIEW_CAMERA_POSITION_NUM_MAX];
 };
 
 /* Exported functions --------------------------------------------------------*/
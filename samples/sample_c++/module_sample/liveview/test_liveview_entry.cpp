@@ -27,6 +27,8 @@
 #include <dji_logger.h>
 #include "test_liveview_entry.hpp"
 #include "test_liveview.hpp"
+#include "dji_camera_analytics_pool.hpp"
+#include "frame_bridge/dji_frame_bridge.h"
 
 #ifdef OPEN_CV_INSTALLED
 
@@ -40,8 +42,32 @@ using namespace cv;
 using namespace std;
 
 /* Private constants ---------------------------------------------------------*/
+#define USER_LIVEVIEW_DEFAULT_WORKER_NUM            (1)
+#define USER_LIVEVIEW_FACE_DETECT_WORKER_NUM        (1)
+/* The dnn module already spreads one inference over all cores, more workers only add memory. */
+#define USER_LIVEVIEW_OBJECT_DETECT_WORKER_NUM      (1)
+#define USER_LIVEVIEW_FRAME_BRIDGE_NAME             "dji_liveview"
+#define USER_LIVEVIEW_FRAME_BRIDGE_SLOT_NUM         (4)
+#define USER_LIVEVIEW_FRAME_BRIDGE_SLOT_SIZE        (1920 * 1080 * 3)
 
 /* Private types -------------------------------------------------------------*/
+#ifdef OPEN_CV_INSTALLED
+/*! @note
+ * Detection models are expensive to load and not safe for concurrent use, so every analytics worker owns one set.
+ * A set is loaded on first use and then reused for all following frames, camera positions and sample runs.
+ */
+typedef struct {
+    bool isFaceDetectorLoaded;
+    bool isObjectDetectorLoaded;
+    CascadeClassifier faceDetector;
+    dnn::Net objectDetector;
+} T_DjiUserVisionModelCache;
+#endif
+
+typedef struct {
+    E_DjiLiveViewCameraPosition position;
+    char const *name;
+} T_DjiUserLiveviewCameraName;
 
 /* Private values -------------------------------------------------------------*/
 const char *classNames[] = {"background", "person", "bicycle", "car", "motorcycle", "airplane", "bus", "train", "truck",
@@ -63,12 +89,25 @@ const size_t inHeight = 300;
 const float WHRatio = inWidth / (float) inHeight;
 static int32_t s_demoIndex = -1;
 char curFileDirPath[DJI_FILE_PATH_SIZE_MAX];
-char tempFileDirPath[DJI_FILE_PATH_SIZE_MAX];
-char prototxtFileDirPath[DJI_FILE_PATH_SIZE_MAX];
-char weightsFileDirPath[DJI_FILE_PATH_SIZE_MAX];
+static DJICameraAnalyticsPool s_analyticsPool;
+static const T_DjiUserLiveviewCameraName s_cameraName[] = {
+    {.position = DJI_LIVEVIEW_CAMERA_POSITION_FPV, .name = "FPV_CAM"},
+    {.position = DJI_LIVEVIEW_CAMERA_POSITION_NO_1, .name = "MAIN_CAM"},
+    {.position = DJI_LIVEVIEW_CAMERA_POSITION_NO_2, .name = "VICE_CAM"},
+    {.position = DJI_LIVEVIEW_CAMERA_POSITION_NO_3, .name = "TOP_CAM"},
+};
+#ifdef OPEN_CV_INSTALLED
+static T_DjiUserVisionModelCache s_visionModelCache[DJI_CAMERA_ANALYTICS_WORKER_NUM_MAX];
+#endif
 
 /* Private functions declaration ---------------------------------------------*/
 static void DjiUser_ShowRgbImageCallback(CameraRGBImage img, void *userData);
+static void DjiUser_ProcessImageCallback(CameraRGBImage &img, int workerIndex, void *userData);
+static void DjiUser_PresentImageCallback(CameraRGBImage &img, const char *name, void *userData);
+#ifdef OPEN_CV_INSTALLED
+static CascadeClassifier *DjiUser_GetFaceDetector(int workerIndex);
+static dnn::Net *DjiUser_GetObjectDetector(int workerIndex);
+#endif
 static T_DjiReturnCode DjiUser_GetCurrentFileDirPath(const char *filePath, uint32_t pathBufferSize, char *dirPath);
 
 /* Exported functions definition ---------------------------------------------*/
@@ -76,13 +115,13 @@ void DjiUser_RunCameraStreamViewSample()
 {
     char cameraIndexChar = 0;
     char demoIndexChar = 0;
-    char isQuit = 0;
-    CameraRGBImage camImg;
-    char fpvName[] = "FPV_CAM";
-    char mainName[] = "MAIN_CAM";
-    char viceName[] = "VICE_CAM";
-    char topName[] = "TOP_CAM";
+    char inputChar = 0;
+    int cameraIndex;
+    int newCameraIndex;
     T_DjiReturnCode returnCode;
+    CameraImageOutputConfig outputConfig(DJI_CAMERA_IMAGE_FORMAT_BGR24);
+    int workerNum = USER_LIVEVIEW_DEFAULT_WORKER_NUM;
+    T_DjiFrameBridgeHandle frameBridge = nullptr;
 
     LiveviewSample *liveviewSample;
     try {
@@ -110,12 +149,16 @@ void DjiUser_RunCameraStreamViewSample()
             break;
         case '1':
             s_demoIndex = 1;
+            /* The binary demo only needs luma, so skip the color conversion pass in the decoder. */
+            outputConfig.format = DJI_CAMERA_IMAGE_FORMAT_GRAY8;
             break;
         case '2':
             s_demoIndex = 2;
+            workerNum = USER_LIVEVIEW_FACE_DETECT_WORKER_NUM;
             break;
         case '3':
             s_demoIndex = 3;
+            workerNum = USER_LIVEVIEW_OBJECT_DETECT_WORKER_NUM;
             break;
         default:
             cout << "No demo selected";
@@ -131,79 +174,107 @@ void DjiUser_RunCameraStreamViewSample()
          << endl;
     cin >> cameraIndexChar;
 
-    switch (cameraIndexChar) {
-        case '0':
-            liveviewSample->StartFpvCameraStream(&DjiUser_ShowRgbImageCallback, &fpvName);
-            break;
-        case '1':
-            liveviewSample->StartMainCameraStream(&DjiUser_ShowRgbImageCallback, &mainName);
-            break;
-        case '2':
-            liveviewSample->StartViceCameraStream(&DjiUser_ShowRgbImageCallback, &viceName);
-            break;
-        case '3':
-            liveviewSample->StartTopCameraStream(&DjiUser_ShowRgbImageCallback, &topName);
-            break;
-        default:
-            cout << "No camera selected";
-            delete liveviewSample;
-            return;
+    if (!s_analyticsPool.start(workerNum, DjiUser_ProcessImageCallback, DjiUser_PresentImageCallback, nullptr)) {
+        USER_LOG_ERROR("Start analytics pool failed.");
+        delete liveviewSample;
+        return;
+    }
+
+    cameraIndex = cameraIndexChar - '0';
+    if (cameraIndex < 0 || cameraIndex >= (int) (sizeof(s_cameraName) / sizeof(s_cameraName[0]))) {
+        cout << "No camera selected";
+        s_analyticsPool.stop();
+        delete liveviewSample;
+        return;
     }
 
-    cout << "Please enter the 'q' or 'Q' to quit camera stream view\n"
+    /* Other processes can subscribe to the decoded frames, the sample runs on without them if the bridge fails. */
+    returnCode = DjiFrameBridge_CreatePublisher(USER_LIVEVIEW_FRAME_BRIDGE_NAME, USER_LIVEVIEW_FRAME_BRIDGE_SLOT_NUM,
+                                                USER_LIVEVIEW_FRAME_BRIDGE_SLOT_SIZE, &frameBridge);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_WARN("Create liveview frame bridge failed, return code:0x%08X", returnCode);
+        frameBridge = nullptr;
+    } else {
+        liveviewSample->SetFrameBridge(frameBridge);
+    }
+
+    returnCode = liveviewSample->StartCameraStream(s_cameraName[cameraIndex].position,
+                                                   DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT,
+                                                   &DjiUser_ShowRgbImageCallback,
+                                                   (void *) s_cameraName[cameraIndex].name, outputConfig);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Start camera stream failed, return code:0x%08X", returnCode);
+    }
+
+    cout << "Please enter [0]-[3] to switch to another camera stream, or 'q' or 'Q' to quit camera stream view\n"
          << endl;
 
     while (true) {
-        cin >> isQuit;
-        if (isQuit == 'q' || isQuit == 'Q') {
+        cin >> inputChar;
+        if (inputChar == 'q' || inputChar == 'Q') {
             break;
         }
+
+        newCameraIndex = inputChar - '0';
+        if (newCameraIndex < 0 || newCameraIndex >= (int) (sizeof(s_cameraName) / sizeof(s_cameraName[0])) ||
+            newCameraIndex == cameraIndex) {
+            continue;
+        }
+
+        returnCode = liveviewSample->SwitchCameraStream(s_cameraName[cameraIndex].position,
+                                                        s_cameraName[newCameraIndex].position,
+                                                        DJI_LIVEVIEW_CAMERA_SOURCE_DEFAULT,
+                                                        (void *) s_cameraName[newCameraIndex].name);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Switch camera stream failed, return code:0x%08X", returnCode);
+            continue;
+        }
+        cameraIndex = newCameraIndex;
     }
 
-    switch (cameraIndexChar) {
-        case '0':
-            liveviewSample->StopFpvCameraStream();
-            break;
-        case '1':
-            liveviewSample->StopMainCameraStream();
-            break;
-        case '2':
-            liveviewSample->StopViceCameraStream();
-            break;
-        case '3':
-            liveviewSample->StopTopCameraStream();
-            break;
-        default:
-            cout << "No camera selected";
-            delete liveviewSample;
-            return;
+    liveviewSample->StopAllCameraStreams();
+    if (frameBridge) {
+        liveviewSample->SetFrameBridge(nullptr);
+        DjiFrameBridge_DestroyPublisher(frameBridge);
     }
 
+    s_analyticsPool.stop();
+    s_analyticsPool.printStatistics();
     delete liveviewSample;
 }
 
 /* Private functions definition-----------------------------------------------*/
 static void DjiUser_ShowRgbImageCallback(CameraRGBImage img, void *userData)
 {
-    string name = string(reinterpret_cast<char *>(userData));
+    /* Runs on the decoder callback thread, hand the frame over and return at once. */
+    s_analyticsPool.submitFrame(reinterpret_cast<char *>(userData), img);
+}
 
+static void DjiUser_ProcessImageCallback(CameraRGBImage &img, int workerIndex, void *userData)
+{
 #ifdef OPEN_CV_INSTALLED
-    Mat mat(img.height, img.width, CV_8UC3, img.rawData.data(), img.width * 3);
-
-    if (s_demoIndex == 0) {
-        cvtColor(mat, mat, COLOR_RGB2BGR);
-        imshow(name, mat);
-    } else if (s_demoIndex == 1) {
-        cvtColor(mat, mat, COLOR_RGB2GRAY);
-        Mat mask;
-        cv::threshold(mat, mask, 0, 255, cv::THRESH_BINARY | cv::THRESH_OTSU);
-        imshow(name, mask);
+    Mat mat;
+
+    if (img.format == DJI_CAMERA_IMAGE_FORMAT_GRAY8) {
+        mat = Mat(img.height, img.width, CV_8UC1, img.rawData.data(), img.width);
+    } else if (img.format == DJI_CAMERA_IMAGE_FORMAT_BGR24) {
+        mat = Mat(img.height, img.width, CV_8UC3, img.rawData.data(), img.width * 3);
+    } else {
+        USER_LOG_WARN("Unsupported image format %d for analytics.", img.format);
+        return;
+    }
+
+    if (s_demoIndex == 1) {
+        cv::threshold(mat, mat, 0, 255, cv::THRESH_BINARY | cv::THRESH_OTSU);
     } else if (s_demoIndex == 2) {
-        cvtColor(mat, mat, COLOR_RGB2BGR);
-        snprintf(tempFileDirPath, DJI_FILE_PATH_SIZE_MAX, "%s/data/haarcascade_frontalface_alt.xml", curFileDirPath);
-        auto faceDetector = cv::CascadeClassifier(tempFileDirPath);
+        CascadeClassifier *faceDetector = DjiUser_GetFaceDetector(workerIndex);
         std::vector<Rect> faces;
-        faceDetector.detectMultiScale(mat, faces, 1.1, 3, 0, Size(50, 50));
+
+        if (faceDetector == nullptr) {
+            return;
+        }
+
+        faceDetector->detectMultiScale(mat, faces, 1.1, 3, 0, Size(50, 50));
 
         for (int i = 0; i < faces.size(); ++i) {
             cout << "index: " << i;
@@ -214,19 +285,14 @@ static void DjiUser_ShowRgbImageCallback(CameraRGBImage img, void *userData)
                           cv::Point(faces[i].x + faces[i].width, faces[i].y + faces[i].height),
                           Scalar(0, 0, 255), 2, 1, 0);
         }
-        imshow(name, mat);
     } else if (s_demoIndex == 3) {
-        snprintf(prototxtFileDirPath, DJI_FILE_PATH_SIZE_MAX,
-                 "%s/data/tensorflow/ssd_inception_v2_coco_2017_11_17.pbtxt",
-                 curFileDirPath);
-        //Attention: If you want to run the Tensorflow Object detection demo, Please download the tensorflow model.
-        //Download Url: http://download.tensorflow.org/models/object_detection/ssd_inception_v2_coco_2017_11_17.tar.gz
-        snprintf(weightsFileDirPath, DJI_FILE_PATH_SIZE_MAX, "%s/data/tensorflow/frozen_inference_graph.pb",
-                 curFileDirPath);
-
-        dnn::Net net = cv::dnn::readNetFromTensorflow(weightsFileDirPath, prototxtFileDirPath);
+        dnn::Net *net = DjiUser_GetObjectDetector(workerIndex);
         Size frame_size = mat.size();
 
+        if (net == nullptr) {
+            return;
+        }
+
         Size cropSize;
         if (frame_size.width / (float) frame_size.height > WHRatio) {
             cropSize = Size(static_cast<int>(frame_size.height * WHRatio),
@@ -241,11 +307,11 @@ static void DjiUser_ShowRgbImageCallback(CameraRGBImage img, void *userData)
                   cropSize);
 
         cv::Mat blob = cv::dnn::blobFromImage(mat, 1, Size(300, 300));
-        net.setInput(blob);
-        Mat output = net.forward();
+        net->setInput(blob);
+        Mat output = net->forward();
         Mat detectionMat(output.size[2], output.size[3], CV_32F, output.ptr<float>());
 
-        mat = mat(crop);
+        mat = mat(crop).clone();
         float confidenceThreshold = 0.50;
 
         for (int i = 0; i < detectionMat.rows; i++) {
@@ -276,13 +342,77 @@ static void DjiUser_ShowRgbImageCallback(CameraRGBImage img, void *userData)
                 putText(mat, label, Point(xLeftBottom, yLeftBottom), FONT_HERSHEY_SIMPLEX, 0.5, Scalar(0, 0, 0));
             }
         }
-        imshow(name, mat);
+
+        /* Only the center crop is presented, mat is continuous after clone(). */
+        img.rawData.assign(mat.data, mat.data + mat.rows * mat.cols * 3);
+        img.width = mat.cols;
+        img.height = mat.rows;
+    }
+#endif
+}
+
+static void DjiUser_PresentImageCallback(CameraRGBImage &img, const char *name, void *userData)
+{
+#ifdef OPEN_CV_INSTALLED
+    Mat mat;
+
+    if (img.format == DJI_CAMERA_IMAGE_FORMAT_GRAY8) {
+        mat = Mat(img.height, img.width, CV_8UC1, img.rawData.data(), img.width);
+    } else if (img.format == DJI_CAMERA_IMAGE_FORMAT_BGR24) {
+        mat = Mat(img.height, img.width, CV_8UC3, img.rawData.data(), img.width * 3);
+    } else {
+        return;
     }
 
+    imshow(name, mat);
     cv::waitKey(1);
 #endif
 }
 
+#ifdef OPEN_CV_INSTALLED
+static CascadeClassifier *DjiUser_GetFaceDetector(int workerIndex)
+{
+    T_DjiUserVisionModelCache *cache = &s_visionModelCache[workerIndex];
+    char modelFilePath[DJI_FILE_PATH_SIZE_MAX];
+
+    if (!cache->isFaceDetectorLoaded) {
+        cache->isFaceDetectorLoaded = true;
+        snprintf(modelFilePath, DJI_FILE_PATH_SIZE_MAX, "%s/data/haarcascade_frontalface_alt.xml", curFileDirPath);
+        if (!cache->faceDetector.load(modelFilePath)) {
+            USER_LOG_ERROR("Load face detector %s failed.", modelFilePath);
+        }
+    }
+
+    return cache->faceDetector.empty() ? nullptr : &cache->faceDetector;
+}
+
+static dnn::Net *DjiUser_GetObjectDetector(int workerIndex)
+{
+    T_DjiUserVisionModelCache *cache = &s_visionModelCache[workerIndex];
+    char prototxtFilePath[DJI_FILE_PATH_SIZE_MAX];
+    char weightsFilePath[DJI_FILE_PATH_SIZE_MAX];
+
+    if (!cache->isObjectDetectorLoaded) {
+        cache->isObjectDetectorLoaded = true;
+        snprintf(prototxtFilePath, DJI_FILE_PATH_SIZE_MAX,
+                 "%s/data/tensorflow/ssd_inception_v2_coco_2017_11_17.pbtxt",
+                 curFileDirPath);
+        //Attention: If you want to run the Tensorflow Object detection demo, Please download the tensorflow model.
+        //Download Url: http://download.tensorflow.org/models/object_detection/ssd_inception_v2_coco_2017_11_17.tar.gz
+        snprintf(weightsFilePath, DJI_FILE_PATH_SIZE_MAX, "%s/data/tensorflow/frozen_inference_graph.pb",
+                 curFileDirPath);
+
+        try {
+            cache->objectDetector = cv::dnn::readNetFromTensorflow(weightsFilePath, prototxtFilePath);
+        } catch (...) {
+            USER_LOG_ERROR("Load object detector %s failed.", weightsFilePath);
+        }
+    }
+
+    return cache->objectDetector.empty() ? nullptr : &cache->objectDetector;
+}
+#endif
+
 static T_DjiReturnCode DjiUser_GetCurrentFileDirPath(const char *filePath, uint32_t pathBufferSize, char *dirPath)
 {
     uint32_t i = strlen(filePath) - 1;
@@ -28,6 +28,7 @@
 #include "dji_logger.h"
 #include "dji_perception.h"
 #include "test_perception.hpp"
+#include "frame_bridge/dji_frame_bridge.h"
 #include <iostream>
 
 #ifdef OPEN_CV_INSTALLED
@@ -41,6 +42,9 @@
 #define USER_PERCEPTION_TASK_STACK_SIZE    (1024)
 #define USER_PERCEPTION_DIRECTION_NUM      (12)
 #define FPS_STRING_LEN                     (50)
+#define USER_PERCEPTION_FRAME_BRIDGE_NAME  "dji_perception"
+#define USER_PERCEPTION_FRAME_BRIDGE_SLOT_NUM   (4)
+#define USER_PERCEPTION_FRAME_BRIDGE_SLOT_SIZE  (1024 * 1024)
 
 /* Private types -------------------------------------------------------------*/
 typedef struct {
@@ -67,6 +71,8 @@ static T_DjiTestStereoImagePacket s_stereoImagePacket = {
     .imageRawBuffer = nullptr,
     .mutex          = nullptr,
     .gotData        = false};
+/* Only touched under the image packet mutex, so the callback never publishes into a destroyed bridge. */
+static T_DjiFrameBridgeHandle s_perceptionFrameBridge = nullptr;
 
 static const T_DjiTestPerceptionDirectionName directionName[] = {
     {.direction = DJI_PERCEPTION_RECTIFY_DOWN, .name = "down"},
@@ -126,6 +132,14 @@ void DjiUser_RunStereoVisionViewSample(void)
         goto DestroyMutex;
     }
 
+    returnCode = DjiFrameBridge_CreatePublisher(USER_PERCEPTION_FRAME_BRIDGE_NAME,
+                                                USER_PERCEPTION_FRAME_BRIDGE_SLOT_NUM,
+                                                USER_PERCEPTION_FRAME_BRIDGE_SLOT_SIZE, &s_perceptionFrameBridge);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_WARN("Create perception frame bridge failed, return code:0x%08X", returnCode);
+        s_perceptionFrameBridge = nullptr;
+    }
+
     returnCode = DjiPerception_GetStereoCameraParameters(&cameraParametersPacket);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Get camera parameters failed, return code:0x%08X", returnCode);
@@ -284,6 +298,13 @@ void DjiUser_RunStereoVisionViewSample(void)
     }
 
 DestroyTask:
+    if (s_perceptionFrameBridge) {
+        osalHandler->MutexLock(s_stereoImagePacket.mutex);
+        DjiFrameBridge_DestroyPublisher(s_perceptionFrameBridge);
+        s_perceptionFrameBridge = nullptr;
+        osalHandler->MutexUnlock(s_stereoImagePacket.mutex);
+    }
+
     returnCode = osalHandler->TaskDestroy(s_stereoImageThread);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Destroy task failed, return code:0x%08X", returnCode);
@@ -319,6 +340,18 @@ static void DjiTest_PerceptionImageCallback(T_DjiPerceptionImageInfo imageInfo,
         s_stereoImagePacket.imageRawBuffer = (uint8_t *) osalHandler->Malloc(bufferLen);
         memcpy(s_stereoImagePacket.imageRawBuffer, imageRawBuffer, bufferLen);
         s_stereoImagePacket.gotData = true;
+
+        if (s_perceptionFrameBridge) {
+            T_DjiFrameBridgeFrameInfo frameInfo = {};
+
+            frameInfo.source = DJI_FRAME_BRIDGE_SOURCE_PERCEPTION;
+            frameInfo.sourceIndex = imageInfo.dataType;
+            frameInfo.format = imageInfo.rawInfo.bpp;
+            frameInfo.width = imageInfo.rawInfo.width;
+            frameInfo.height = imageInfo.rawInfo.height;
+            frameInfo.dataSize = bufferLen;
+            DjiFrameBridge_Publish(s_perceptionFrameBridge, &frameInfo, imageRawBuffer);
+        }
         osalHandler->MutexUnlock(s_stereoImagePacket.mutex);
     }
 }
@@ -35,6 +35,8 @@
 #include "../common/osal/osal.h"
 #include "../common/osal/osal_fs.h"
 #include "../common/osal/osal_socket.h"
+#include "utils/util_periodic.h"
+#include "utils/util_asset.h"
 #include "../manifold2/hal/hal_usb_bulk.h"
 #include "../manifold2/hal/hal_uart.h"
 #include "../manifold2/hal/hal_network.h"
@@ -94,6 +96,7 @@ void Application::DjiUser_SetupEnvironment(int argc, char **argv)
     T_DjiHalUartHandler uartHandler = {0};
     T_DjiHalUsbBulkHandler usbBulkHandler = {0};
     T_DjiLoggerConsole printConsole;
+    T_UtilPeriodicClock periodicClock;
     T_DjiLoggerConsole localRecordConsole;
     T_DjiFileSystemHandler fileSystemHandler = {0};
     T_DjiSocketHandler socketHandler{0};
@@ -131,6 +134,8 @@ void Application::DjiUser_SetupEnvironment(int argc, char **argv)
     osalHandler.Free = Osal_Free;
     osalHandler.GetTimeMs = Osal_GetTimeMs;
     osalHandler.GetTimeUs = Osal_GetTimeUs;
+    periodicClock.GetTimeUs = Osal_GetTimeUs;
+    periodicClock.SleepUntilUs = Osal_TaskSleepUntilUs;
     osalHandler.GetRandomNum = Osal_GetRandomNum;
 
     printConsole.func = DjiUser_PrintConsole;
@@ -172,6 +177,17 @@ void Application::DjiUser_SetupEnvironment(int argc, char **argv)
         throw std::runtime_error("Register osal handler error.");
     }
 
+    // Periodic tasks sleep until microsecond deadlines, finer than the task sleep of the osal handler.
+    returnCode = UtilPeriodic_SetDefaultClock(&periodicClock);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        throw std::runtime_error("Set periodic clock error.");
+    }
+
+    returnCode = UtilAsset_Init();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        throw std::runtime_error("Init asset error.");
+    }
+
     returnCode = DjiPlatform_RegHalUartHandler(&uartHandler);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         throw std::runtime_error("Register hal uart handler error.");
@@ -29,16 +29,21 @@
 #include <gimbal/test_gimbal_entry.hpp>
 #include "application.hpp"
 #include "fc_subscription/test_fc_subscription.h"
+#include "fc_subscription/test_fc_subscription_cache.h"
+#include "fc_subscription/test_fc_subscription_recorder.h"
 #include <gimbal_emu/test_payload_gimbal_emu.h>
 #include <camera_emu/test_payload_cam_emu_media.h>
 #include <camera_emu/test_payload_cam_emu_base.h>
 #include <dji_logger.h>
 #include "widget/test_widget.h"
 #include "widget/test_widget_speaker.h"
+#include "widget/test_widget_floating_window.h"
+#include "widget/test_widget_value_store.h"
 #include <power_management/test_power_management.h>
 #include "data_transmission/test_data_transmission.h"
 #include <flight_controller/test_flight_controller_entry.h>
 #include <positioning/test_positioning.h>
+#include <xport/test_payload_xport_state.h>
 #include <hms_manager/hms_manager_entry.h>
 #include "camera_manager/test_camera_manager_entry.h"
 
@@ -66,11 +71,18 @@ start:
         << "| [0] Fc subscribe sample - subscribe quaternion and gps data                                      |\n"
         << "| [1] Flight controller sample - you can control flying by PSDK                                    |\n"
         << "| [2] Hms info manager sample - get health manger system info by language                          |\n"
+        << "| [3] Fc telemetry recorder sample - record the 200Hz topics for 60s, convert with fc_recorder2csv |\n"
+        << "| [4] Fc telemetry recorder benchmark - record the 200Hz topics from a synthetic generator         |\n"
         << "| [a] Gimbal manager sample - you can control gimbal by PSDK                                       |\n"
+        << "| [b] Fc subscription cache benchmark - 1 kHz synthetic publisher against snapshot readers         |\n"
         << "| [c] Camera stream view sample - display the camera video stream                                  |\n"
         << "| [d] Stereo vision view sample - display the stereo image                                         |\n"
         << "| [e] Run camera manager sample - you can test camera's functions interactively                    |\n"
         << "| [f] Start rtk positioning sample - you can receive rtk rtcm data when rtk signal is ok           |\n"
+        << "| [g] Rtcm journal replay - replay rtk_replay.rtcm through the rtcm callback, print its latency    |\n"
+        << "| [h] XPort round trip benchmark - compare 10Hz polling with the cached state on a mocked XPort    |\n"
+        << "| [i] Widget floating window stress test - 4 log writers against a mocked floating window          |\n"
+        << "| [j] Widget value store benchmark - widget actions in the handler against the value store         |\n"
         << std::endl;
 
     std::cin >> inputChar;
@@ -84,9 +96,18 @@ start:
         case '2':
             DjiUser_RunHmsManagerSample();
             break;
+        case '3':
+            DjiTest_FcSubscriptionRecorderRunSample("fc_telemetry.rec", 60000);
+            break;
+        case '4':
+            DjiTest_FcSubscriptionRecorderRunBenchmark("fc_telemetry_benchmark.rec", 10000);
+            break;
         case 'a':
             DjiUser_RunGimbalManagerSample();
             break;
+        case 'b':
+            DjiTest_FcSubscriptionCacheRunBenchmark(1000, 2, 10000);
+            break;
         case 'c':
             DjiUser_RunCameraStreamViewSample();
             break;
@@ -105,6 +126,18 @@ start:
 
             USER_LOG_INFO("Start rtk positioning sample successfully");
             break;
+        case 'g':
+            DjiTest_PositioningRunRtcmReplay("rtk_replay.rtcm", 10);
+            break;
+        case 'h':
+            DjiTest_XPortRunRoundTripBenchmark(20000);
+            break;
+        case 'i':
+            DjiTest_WidgetFloatingWindowRunStressTest(4, 10000);
+            break;
+        case 'j':
+            DjiTest_WidgetValueStoreRunBenchmark(10000);
+            break;
         default:
             break;
     }
@@ -26,6 +26,7 @@
 #include "math.h"
 #include "test_payload_cam_emu_base.h"
 #include "utils/util_misc.h"
+#include "utils/util_timer.h"
 #include "dji_logger.h"
 #include "dji_platform.h"
 #include "dji_payload_camera.h"
@@ -34,8 +35,13 @@
 #include "dji_xport.h"
 #include "gimbal_emu/test_payload_gimbal_emu.h"
 
+#ifdef SYSTEM_ARCH_LINUX
+#include "test_payload_cam_emu_storage.h"
+#endif
+
 /* Private constants ---------------------------------------------------------*/
-#define PAYLOAD_CAMERA_EMU_TASK_FREQ            (100)
+#define PAYLOAD_CAMERA_EMU_ZOOM_STEP_PERIOD_MS  (100)
+#define PAYLOAD_CAMERA_EMU_RECORD_PERIOD_MS     (1000)
 #define PAYLOAD_CAMERA_EMU_TASK_STACK_SIZE      (2048)
 #define SDCARD_TOTAL_SPACE_IN_MB                (32 * 1024)
 #define SDCARD_PER_PHOTO_SPACE_IN_MB            (4)
@@ -82,7 +88,17 @@ static T_DjiCameraDigitalZoomHandler s_digitalZoomHandler;
 static T_DjiCameraOpticalZoomHandler s_opticalZoomHandler;
 static T_DjiCameraTapZoomHandler s_tapZoomHandler;
 
-static T_DjiTaskHandle s_userCameraThread;
+/* The emulation has no polling task, every pending shooting, recording or zoom deadline is a timer of this service. */
+static T_UtilTimerService s_cameraTimerService = {0};
+static T_UtilTimer s_photoStoreTimer;
+static T_UtilTimer s_intervalPhotoTimer;
+static T_UtilTimer s_recordVideoTimer;
+static T_UtilTimer s_opticalZoomTimer;
+static T_UtilTimer s_tapZoomTimer;
+static uint32_t s_storingPhotoCount = 1;
+static uint64_t s_intervalPhotoNextShotTimeUs = 0;
+static uint64_t s_recordVideoNextTickTimeUs = 0;
+static uint64_t s_opticalZoomNextStepTimeUs = 0;
 
 static T_DjiCameraSystemState s_cameraState = {0};
 static E_DjiCameraShootPhotoMode s_cameraShootPhotoMode = DJI_CAMERA_SHOOT_PHOTO_MODE_SINGLE;
@@ -107,11 +123,13 @@ static dji_f32_t s_cameraDigitalZoomFactor = ZOOM_DIGITAL_BASE_FACTOR;
 static bool s_isStartContinuousOpticalZoom = false;
 static bool s_isOpticalZoomReachLimit = false;
 static T_DjiMutexHandle s_zoomMutex = {0};
+static DjiTestCameraZoomChangeCallback s_zoomChangeCallback = NULL;
+static dji_f32_t s_notifiedOpticalZoomFactor = 0;
+static dji_f32_t s_notifiedDigitalZoomFactor = 0;
 
 static bool s_isTapZoomEnabled = false;
 static T_DjiCameraTapZoomState s_cameraTapZoomState = {0};
 static uint8_t s_tapZoomMultiplier = 1;
-static uint32_t s_tapZoomStartTime = 0;
 static bool s_isStartTapZoom = false;
 static bool s_isTapZooming = false;
 static T_TestCameraGimbalRotationArgument s_tapZoomNewestGimbalRotationArgument = {0};
@@ -163,9 +181,18 @@ static T_DjiReturnCode SetTapZoomMultiplier(uint8_t multiplier);
 static T_DjiReturnCode GetTapZoomMultiplier(uint8_t *multiplier);
 static T_DjiReturnCode TapZoomAtTarget(T_DjiCameraPointInScreen target);
 static T_DjiReturnCode DjiTest_CameraHybridZoom(uint32_t focalLength);
+static void DjiTest_CameraNotifyZoomChange(void);
 static T_DjiReturnCode DjiTest_CameraRotationGimbal(T_TestCameraGimbalRotationArgument gimbalRotationArgument);
 
-static void *UserCamera_Task(void *arg);
+static void DjiTest_CameraInitTimers(void);
+static void DjiTest_CameraUpdateSdCardSpace(void);
+static void DjiTest_CameraStorePhotos(uint32_t count);
+static void DjiTest_CameraStoreVideoSecond(void);
+static void DjiTest_CameraPhotoStoreTimerCallback(void *arg);
+static void DjiTest_CameraIntervalPhotoTimerCallback(void *arg);
+static void DjiTest_CameraRecordVideoTimerCallback(void *arg);
+static void DjiTest_CameraOpticalZoomTimerCallback(void *arg);
+static void DjiTest_CameraTapZoomTimerCallback(void *arg);
 
 /* Exported functions definition ---------------------------------------------*/
 
@@ -174,6 +201,7 @@ static T_DjiReturnCode GetSystemState(T_DjiCameraSystemState *systemState)
 {
     T_DjiReturnCode returnCode;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint64_t nowUs = 0;
 
     returnCode = osalHandler->MutexLock(s_commonMutex);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -181,6 +209,13 @@ static T_DjiReturnCode GetSystemState(T_DjiCameraSystemState *systemState)
         return returnCode;
     }
 
+    // The interval countdown is derived from the deadline of the next shot instead of being ticked down by a task.
+    if (s_cameraState.isShootingIntervalStart == true &&
+        UtilTimer_GetTimeUs(&s_cameraTimerService, &nowUs) == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_cameraState.currentPhotoShootingIntervalTimeInSeconds = s_intervalPhotoNextShotTimeUs > nowUs ?
+            (uint16_t) ((s_intervalPhotoNextShotTimeUs - nowUs + 999999) / 1000000) : 0;
+    }
+
     *systemState = s_cameraState;
 
     returnCode = osalHandler->MutexUnlock(s_commonMutex);
@@ -233,9 +268,23 @@ static T_DjiReturnCode StartRecordVideo(void)
         goto out;
     }
 
+#ifdef SYSTEM_ARCH_LINUX
+    if (DjiTest_CameraEmuStorageIsInited() == true) {
+        returnCode = DjiTest_CameraEmuStorageStartRecord();
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("start record video to sdcard error: 0x%08llX.", returnCode);
+            goto out;
+        }
+    }
+#endif
+
     s_cameraState.isRecording = true;
     USER_LOG_INFO("start record video");
 
+    UtilTimer_GetTimeUs(&s_cameraTimerService, &s_recordVideoNextTickTimeUs);
+    s_recordVideoNextTickTimeUs += PAYLOAD_CAMERA_EMU_RECORD_PERIOD_MS * 1000;
+    UtilTimer_StartAt(&s_cameraTimerService, &s_recordVideoTimer, s_recordVideoNextTickTimeUs);
+
 out:
     djiStat = osalHandler->MutexUnlock(s_commonMutex);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -266,6 +315,12 @@ static T_DjiReturnCode StopRecordVideo(void)
 
     s_cameraState.isRecording = false;
     s_cameraState.currentVideoRecordingTimeInSeconds = 0;
+    UtilTimer_Stop(&s_cameraTimerService, &s_recordVideoTimer);
+#ifdef SYSTEM_ARCH_LINUX
+    if (DjiTest_CameraEmuStorageIsInited() == true) {
+        DjiTest_CameraEmuStorageStopRecord();
+    }
+#endif
     USER_LOG_INFO("stop record video");
 
 out:
@@ -291,15 +346,27 @@ static T_DjiReturnCode StartShootPhoto(void)
 
     USER_LOG_INFO("start shoot photo");
     s_cameraState.isStoring = true;
+    s_storingPhotoCount = 1;
 
     if (s_cameraShootPhotoMode == DJI_CAMERA_SHOOT_PHOTO_MODE_SINGLE) {
         s_cameraState.shootingState = DJI_CAMERA_SHOOTING_SINGLE_PHOTO;
+        UtilTimer_Start(&s_cameraTimerService, &s_photoStoreTimer, TAKING_PHOTO_SPENT_TIME_MS_EMU);
     } else if (s_cameraShootPhotoMode == DJI_CAMERA_SHOOT_PHOTO_MODE_BURST) {
         s_cameraState.shootingState = DJI_CAMERA_SHOOTING_BURST_PHOTO;
+        s_storingPhotoCount = s_cameraBurstCount;
+        UtilTimer_Start(&s_cameraTimerService, &s_photoStoreTimer, TAKING_PHOTO_SPENT_TIME_MS_EMU);
     } else if (s_cameraShootPhotoMode == DJI_CAMERA_SHOOT_PHOTO_MODE_INTERVAL) {
         s_cameraState.shootingState = DJI_CAMERA_SHOOTING_INTERVAL_PHOTO;
         s_cameraState.isShootingIntervalStart = true;
         s_cameraState.currentPhotoShootingIntervalTimeInSeconds = s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds;
+        s_cameraState.currentPhotoShootingIntervalCount = s_cameraPhotoTimeIntervalSettings.captureCount;
+
+        // The first photo is taken right away, the next ones every interval from it.
+        if (s_cameraPhotoTimeIntervalSettings.captureCount > 0 &&
+            s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds > 0) {
+            UtilTimer_GetTimeUs(&s_cameraTimerService, &s_intervalPhotoNextShotTimeUs);
+            UtilTimer_StartAt(&s_cameraTimerService, &s_intervalPhotoTimer, s_intervalPhotoNextShotTimeUs);
+        }
     }
 
     returnCode = osalHandler->MutexUnlock(s_commonMutex);
@@ -326,6 +393,8 @@ static T_DjiReturnCode StopShootPhoto(void)
     s_cameraState.shootingState = DJI_CAMERA_SHOOTING_PHOTO_IDLE;
     s_cameraState.isStoring = false;
     s_cameraState.isShootingIntervalStart = false;
+    UtilTimer_Stop(&s_cameraTimerService, &s_intervalPhotoTimer);
+    UtilTimer_Stop(&s_cameraTimerService, &s_photoStoreTimer);
 
     returnCode = osalHandler->MutexUnlock(s_commonMutex);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -485,6 +554,7 @@ static T_DjiReturnCode GetSDCardState(T_DjiCameraSDCardState *sdCardState)
         return returnCode;
     }
 
+    DjiTest_CameraUpdateSdCardSpace();
     memcpy(sdCardState, &s_cameraSDCardState, sizeof(T_DjiCameraSDCardState));
 
     returnCode = osalHandler->MutexUnlock(s_commonMutex);
@@ -509,14 +579,27 @@ static T_DjiReturnCode FormatSDCard(void)
 
     USER_LOG_INFO("format sdcard");
 
+#ifdef SYSTEM_ARCH_LINUX
+    if (DjiTest_CameraEmuStorageIsInited() == true) {
+        // The files are deleted in background, GetSDCardState reports isFormatting until it is done.
+        returnCode = DjiTest_CameraEmuStorageFormat();
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("format sdcard storage error: 0x%08llX.", returnCode);
+            osalHandler->MutexUnlock(s_commonMutex);
+            return returnCode;
+        }
+        s_cameraState.isRecording = false;
+        s_cameraState.currentVideoRecordingTimeInSeconds = 0;
+        UtilTimer_Stop(&s_cameraTimerService, &s_recordVideoTimer);
+    }
+#endif
+
     memset(&s_cameraSDCardState, 0, sizeof(T_DjiCameraSDCardState));
     s_cameraSDCardState.isInserted = true;
     s_cameraSDCardState.isVerified = true;
     s_cameraSDCardState.totalSpaceInMB = SDCARD_TOTAL_SPACE_IN_MB;
     s_cameraSDCardState.remainSpaceInMB = SDCARD_TOTAL_SPACE_IN_MB;
-    s_cameraSDCardState.availableCaptureCount = SDCARD_TOTAL_SPACE_IN_MB / SDCARD_PER_PHOTO_SPACE_IN_MB;
-    s_cameraSDCardState.availableRecordingTimeInSeconds =
-        SDCARD_TOTAL_SPACE_IN_MB / SDCARD_PER_SECONDS_RECORD_SPACE_IN_MB;
+    DjiTest_CameraUpdateSdCardSpace();
 
     returnCode = osalHandler->MutexUnlock(s_commonMutex);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -644,6 +727,8 @@ static T_DjiReturnCode SetDigitalZoomFactor(dji_f32_t factor)
         return returnCode;
     }
 
+    DjiTest_CameraNotifyZoomChange();
+
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
@@ -669,6 +754,8 @@ static T_DjiReturnCode SetOpticalZoomFocalLength(uint32_t focalLength)
         return returnCode;
     }
 
+    DjiTest_CameraNotifyZoomChange();
+
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
@@ -719,6 +806,10 @@ static T_DjiReturnCode StartContinuousOpticalZoom(E_DjiCameraZoomDirection direc
     s_cameraZoomDirection = direction;
     s_cameraZoomSpeed = speed;
 
+    UtilTimer_GetTimeUs(&s_cameraTimerService, &s_opticalZoomNextStepTimeUs);
+    s_opticalZoomNextStepTimeUs += PAYLOAD_CAMERA_EMU_ZOOM_STEP_PERIOD_MS * 1000;
+    UtilTimer_StartAt(&s_cameraTimerService, &s_opticalZoomTimer, s_opticalZoomNextStepTimeUs);
+
     returnCode = osalHandler->MutexUnlock(s_zoomMutex);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
@@ -743,6 +834,7 @@ static T_DjiReturnCode StopContinuousOpticalZoom(void)
     s_isStartContinuousOpticalZoom = false;
     s_cameraZoomDirection = DJI_CAMERA_ZOOM_DIRECTION_OUT;
     s_cameraZoomSpeed = DJI_CAMERA_ZOOM_SPEED_NORMAL;
+    UtilTimer_Stop(&s_cameraTimerService, &s_opticalZoomTimer);
 
     returnCode = osalHandler->MutexUnlock(s_zoomMutex);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -872,6 +964,7 @@ static T_DjiReturnCode TapZoomAtTarget(T_DjiCameraPointInScreen target)
     }
 
     s_isStartTapZoom = true;
+    UtilTimer_Start(&s_cameraTimerService, &s_tapZoomTimer, 0);
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
@@ -896,6 +989,36 @@ static T_DjiReturnCode DjiTest_CameraHybridZoom(uint32_t focalLength)
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
+/* Must be called without holding the zoom mutex, the callback is only called when a factor really changed. */
+static void DjiTest_CameraNotifyZoomChange(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    DjiTestCameraZoomChangeCallback callback = s_zoomChangeCallback;
+    dji_f32_t opticalZoomFactor;
+    dji_f32_t digitalZoomFactor;
+    bool isChanged;
+
+    if (callback == NULL) {
+        return;
+    }
+
+    if (osalHandler->MutexLock(s_zoomMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return;
+    }
+
+    opticalZoomFactor = (dji_f32_t) s_cameraOpticalZoomFocalLength / ZOOM_OPTICAL_FOCAL_MIN_LENGTH;
+    digitalZoomFactor = s_cameraDigitalZoomFactor;
+    isChanged = opticalZoomFactor != s_notifiedOpticalZoomFactor || digitalZoomFactor != s_notifiedDigitalZoomFactor;
+    s_notifiedOpticalZoomFactor = opticalZoomFactor;
+    s_notifiedDigitalZoomFactor = digitalZoomFactor;
+
+    osalHandler->MutexUnlock(s_zoomMutex);
+
+    if (isChanged) {
+        callback(opticalZoomFactor, digitalZoomFactor);
+    }
+}
+
 static T_DjiReturnCode DjiTest_CameraRotationGimbal(T_TestCameraGimbalRotationArgument gimbalRotationArgument)
 {
     T_DjiReturnCode returnCode;
@@ -930,282 +1053,331 @@ static T_DjiReturnCode DjiTest_CameraRotationGimbal(T_TestCameraGimbalRotationAr
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-#ifndef __CC_ARM
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmissing-noreturn"
-#pragma GCC diagnostic ignored "-Wreturn-type"
+static void DjiTest_CameraInitTimers(void)
+{
+    UtilTimer_Init(&s_photoStoreTimer, DjiTest_CameraPhotoStoreTimerCallback, NULL);
+    UtilTimer_Init(&s_intervalPhotoTimer, DjiTest_CameraIntervalPhotoTimerCallback, NULL);
+    UtilTimer_Init(&s_recordVideoTimer, DjiTest_CameraRecordVideoTimerCallback, NULL);
+    UtilTimer_Init(&s_opticalZoomTimer, DjiTest_CameraOpticalZoomTimerCallback, NULL);
+    UtilTimer_Init(&s_tapZoomTimer, DjiTest_CameraTapZoomTimerCallback, NULL);
+}
+
+/*
+ * Must be called with the common mutex held, after the remain space of the sdcard changed. When the sdcard is backed
+ * by the storage directory, its space is read back from there instead of being counted down.
+ */
+static void DjiTest_CameraUpdateSdCardSpace(void)
+{
+#ifdef SYSTEM_ARCH_LINUX
+    T_DjiTestCameraEmuStorageState storageState = {0};
+
+    if (DjiTest_CameraEmuStorageIsInited() == true &&
+        DjiTest_CameraEmuStorageGetState(&storageState) == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_cameraSDCardState.totalSpaceInMB = storageState.totalSpaceInMB;
+        s_cameraSDCardState.remainSpaceInMB = storageState.remainSpaceInMB;
+        s_cameraSDCardState.isFull = storageState.isFull;
+        s_cameraSDCardState.isFormatting = storageState.isFormatting;
+    }
+#endif
+
+    if (s_cameraSDCardState.remainSpaceInMB > s_cameraSDCardState.totalSpaceInMB) {
+        s_cameraSDCardState.remainSpaceInMB = 0;
+        s_cameraSDCardState.isFull = true;
+    }
+
+    s_cameraSDCardState.availableRecordingTimeInSeconds =
+        s_cameraSDCardState.remainSpaceInMB / SDCARD_PER_SECONDS_RECORD_SPACE_IN_MB;
+    s_cameraSDCardState.availableCaptureCount = s_cameraSDCardState.remainSpaceInMB / SDCARD_PER_PHOTO_SPACE_IN_MB;
+}
+
+/* Must be called with the common mutex held. */
+static void DjiTest_CameraStorePhotos(uint32_t count)
+{
+#ifdef SYSTEM_ARCH_LINUX
+    T_DjiReturnCode returnCode;
+    uint32_t i;
+
+    if (DjiTest_CameraEmuStorageIsInited() == true) {
+        for (i = 0; i < count; i++) {
+            returnCode = DjiTest_CameraEmuStorageCapturePhoto(SDCARD_PER_PHOTO_SPACE_IN_MB * 1024 * 1024);
+            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_WARN("store photo to sdcard error: 0x%08llX, %u of %u photos stored.", returnCode, i, count);
+                break;
+            }
+        }
+        DjiTest_CameraUpdateSdCardSpace();
+        return;
+    }
+#endif
+
+    s_cameraSDCardState.remainSpaceInMB = s_cameraSDCardState.remainSpaceInMB - SDCARD_PER_PHOTO_SPACE_IN_MB * count;
+    DjiTest_CameraUpdateSdCardSpace();
+}
+
+/* Must be called with the common mutex held. */
+static void DjiTest_CameraStoreVideoSecond(void)
+{
+#ifdef SYSTEM_ARCH_LINUX
+    T_DjiReturnCode returnCode;
+
+    if (DjiTest_CameraEmuStorageIsInited() == true) {
+        returnCode = DjiTest_CameraEmuStorageAppendRecord(SDCARD_PER_SECONDS_RECORD_SPACE_IN_MB * 1024 * 1024, 1);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_WARN("store video to sdcard error: 0x%08llX.", returnCode);
+        }
+        DjiTest_CameraUpdateSdCardSpace();
+        return;
+    }
 #endif
 
-static void *UserCamera_Task(void *arg)
+    s_cameraSDCardState.remainSpaceInMB = s_cameraSDCardState.remainSpaceInMB - SDCARD_PER_SECONDS_RECORD_SPACE_IN_MB;
+    DjiTest_CameraUpdateSdCardSpace();
+}
+
+/*
+ * The timer callbacks below run on the camera timer task. Each one re-checks the state it acts on under the mutex,
+ * since the shooting, the recording or the zoom may have been stopped while the timer was being dispatched.
+ */
+static void DjiTest_CameraPhotoStoreTimerCallback(void *arg)
+{
+    T_DjiReturnCode returnCode;
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    USER_UTIL_UNUSED(arg);
+
+    returnCode = osalHandler->MutexLock(s_commonMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
+        return;
+    }
+
+    //store the photo after shooting finished
+    if (s_cameraState.isStoring == true) {
+        DjiTest_CameraStorePhotos(s_storingPhotoCount);
+        s_cameraState.isStoring = false;
+        s_cameraState.shootingState = DJI_CAMERA_SHOOTING_PHOTO_IDLE;
+    }
+
+    returnCode = osalHandler->MutexUnlock(s_commonMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
+    }
+}
+
+static void DjiTest_CameraIntervalPhotoTimerCallback(void *arg)
+{
+    T_DjiReturnCode returnCode;
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    USER_UTIL_UNUSED(arg);
+
+    returnCode = osalHandler->MutexLock(s_commonMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
+        return;
+    }
+
+    if (s_cameraState.isShootingIntervalStart != true) {
+        goto out;
+    }
+
+    s_cameraState.shootingState = DJI_CAMERA_SHOOTING_INTERVAL_PHOTO;
+    s_cameraState.isStoring = true;
+    s_storingPhotoCount = 1;
+    UtilTimer_Start(&s_cameraTimerService, &s_photoStoreTimer, TAKING_PHOTO_SPENT_TIME_MS_EMU);
+
+    if (s_cameraState.currentPhotoShootingIntervalCount < INTERVAL_PHOTOGRAPH_ALWAYS_COUNT) {
+        USER_LOG_INFO("interval taking photograph count:%d interval_time:%ds",
+                      (s_cameraPhotoTimeIntervalSettings.captureCount -
+                       s_cameraState.currentPhotoShootingIntervalCount + 1),
+                      s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds);
+        s_cameraState.currentPhotoShootingIntervalCount--;
+        if (s_cameraState.currentPhotoShootingIntervalCount == 0) {
+            // The last photo is still stored, its store timer turns the shooting state back to idle.
+            s_cameraState.isShootingIntervalStart = false;
+            s_cameraState.currentPhotoShootingIntervalTimeInSeconds = 0;
+            goto out;
+        }
+    } else {
+        USER_LOG_INFO("interval taking photograph always, interval_time:%ds",
+                      s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds);
+    }
+
+    // Next shot on the absolute grid of the interval, the dispatch latency of this one is not carried over.
+    s_intervalPhotoNextShotTimeUs += (uint64_t) s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds * 1000000;
+    UtilTimer_StartAt(&s_cameraTimerService, &s_intervalPhotoTimer, s_intervalPhotoNextShotTimeUs);
+
+out:
+    returnCode = osalHandler->MutexUnlock(s_commonMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
+    }
+}
+
+static void DjiTest_CameraRecordVideoTimerCallback(void *arg)
+{
+    T_DjiReturnCode returnCode;
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    USER_UTIL_UNUSED(arg);
+
+    returnCode = osalHandler->MutexLock(s_commonMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
+        return;
+    }
+
+    if (s_cameraState.isRecording) {
+        s_cameraState.currentVideoRecordingTimeInSeconds++;
+        DjiTest_CameraStoreVideoSecond();
+
+        s_recordVideoNextTickTimeUs += PAYLOAD_CAMERA_EMU_RECORD_PERIOD_MS * 1000;
+        UtilTimer_StartAt(&s_cameraTimerService, &s_recordVideoTimer, s_recordVideoNextTickTimeUs);
+    }
+
+    returnCode = osalHandler->MutexUnlock(s_commonMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
+    }
+}
+
+static void DjiTest_CameraOpticalZoomTimerCallback(void *arg)
 {
-    static uint32_t photoCnt = 0;
-    static uint32_t step = 0;
     T_DjiReturnCode returnCode;
     int32_t tempFocalLength = 0;
     dji_f32_t tempDigitalFactor = 0.0f;
-    uint32_t currentTime = 0;
-    bool isStartIntervalPhotoAction = false;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
 
     USER_UTIL_UNUSED(arg);
 
-    while (1) {
-        osalHandler->TaskSleepMs(1000 / PAYLOAD_CAMERA_EMU_TASK_FREQ);
-        step++;
+    returnCode = osalHandler->MutexLock(s_zoomMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
+        return;
+    }
 
-        returnCode = osalHandler->MutexLock(s_commonMutex);
-        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
-            continue;
+    if (s_isStartContinuousOpticalZoom != true) {
+        osalHandler->MutexUnlock(s_zoomMutex);
+        return;
+    }
+
+    //Add logic here for zoom camera
+    tempDigitalFactor = s_cameraDigitalZoomFactor;
+    tempFocalLength = (int32_t) s_cameraOpticalZoomFocalLength;
+    if (s_isOpticalZoomReachLimit == false) {
+        if (s_cameraZoomDirection == DJI_CAMERA_ZOOM_DIRECTION_IN) {
+            tempFocalLength += ((int) s_cameraZoomSpeed - DJI_CAMERA_ZOOM_SPEED_SLOWEST + 1) *
+                               ZOOM_OPTICAL_FOCAL_LENGTH_CTRL_STEP;
+        } else if (s_cameraZoomDirection == DJI_CAMERA_ZOOM_DIRECTION_OUT) {
+            tempFocalLength -= ((int) s_cameraZoomSpeed - DJI_CAMERA_ZOOM_SPEED_SLOWEST + 1) *
+                               ZOOM_OPTICAL_FOCAL_LENGTH_CTRL_STEP;
         }
 
-        s_cameraSDCardState.availableRecordingTimeInSeconds =
-            s_cameraSDCardState.remainSpaceInMB / SDCARD_PER_SECONDS_RECORD_SPACE_IN_MB;
-        s_cameraSDCardState.availableCaptureCount = s_cameraSDCardState.remainSpaceInMB / SDCARD_PER_PHOTO_SPACE_IN_MB;
-
-        //realize your photo shoot and storage logic here
-        if (s_cameraState.shootingState != DJI_CAMERA_SHOOTING_PHOTO_IDLE &&
-            photoCnt++ > TAKING_PHOTO_SPENT_TIME_MS_EMU / (1000 / PAYLOAD_CAMERA_EMU_TASK_FREQ)) {
-            photoCnt = 0;
-
-            //store the photo after shooting finished
-            if (s_cameraShootPhotoMode == DJI_CAMERA_SHOOT_PHOTO_MODE_SINGLE) {
-                s_cameraSDCardState.remainSpaceInMB =
-                    s_cameraSDCardState.remainSpaceInMB - SDCARD_PER_PHOTO_SPACE_IN_MB;
-                s_cameraState.isStoring = false;
-                s_cameraState.shootingState = DJI_CAMERA_SHOOTING_PHOTO_IDLE;
-            } else if (s_cameraShootPhotoMode == DJI_CAMERA_SHOOT_PHOTO_MODE_BURST) {
-                s_cameraSDCardState.remainSpaceInMB =
-                    s_cameraSDCardState.remainSpaceInMB - SDCARD_PER_PHOTO_SPACE_IN_MB * s_cameraBurstCount;
-                s_cameraState.isStoring = false;
-                s_cameraState.shootingState = DJI_CAMERA_SHOOTING_PHOTO_IDLE;
-            } else if (s_cameraShootPhotoMode == DJI_CAMERA_SHOOT_PHOTO_MODE_INTERVAL) {
-                if (isStartIntervalPhotoAction == true) {
-                    s_cameraState.isStoring = false;
-                    s_cameraState.shootingState = DJI_CAMERA_SHOOTING_PHOTO_IDLE;
-                    s_cameraSDCardState.remainSpaceInMB =
-                        s_cameraSDCardState.remainSpaceInMB - SDCARD_PER_PHOTO_SPACE_IN_MB;
-                }
-            }
+        if (tempFocalLength > ZOOM_OPTICAL_FOCAL_MAX_LENGTH) {
+            s_isOpticalZoomReachLimit = true;
+            tempFocalLength = ZOOM_OPTICAL_FOCAL_MAX_LENGTH;
+        }
 
-            //check the remain space of sdcard
-            if (s_cameraSDCardState.remainSpaceInMB > SDCARD_TOTAL_SPACE_IN_MB) {
-                s_cameraSDCardState.remainSpaceInMB = 0;
-                s_cameraSDCardState.isFull = true;
-            }
+        if (tempFocalLength < ZOOM_OPTICAL_FOCAL_MIN_LENGTH) {
+            tempFocalLength = ZOOM_OPTICAL_FOCAL_MIN_LENGTH;
+        }
+    } else {
+        if (s_cameraZoomDirection == DJI_CAMERA_ZOOM_DIRECTION_IN) {
+            tempDigitalFactor += (dji_f32_t) ZOOM_DIGITAL_STEP_FACTOR;
+        } else if (s_cameraZoomDirection == DJI_CAMERA_ZOOM_DIRECTION_OUT) {
+            tempDigitalFactor -= (dji_f32_t) ZOOM_DIGITAL_STEP_FACTOR;
+        }
 
-#if dji_ARCH_SYS_LINUX
-            T_DjiCameraMediaFileInfo mediaFileInfo = {0};
-
-            // push added media file information
-            if (s_cameraShootPhotoMode == dji_CAMERA_SHOOT_PHOTO_MODE_SINGLE) {
-                if (UtilFile_IsFileExist(PHOTO_FILE_PATH) == true) {
-                    psdkStat = PsdkTest_CameraMediaGetFileInfo(PHOTO_FILE_PATH, &mediaFileInfo);
-                    if (psdkStat != dji_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                        PsdkLogger_UserLogError("Get media file info error 0x%08llX", psdkStat);
-                    }
-
-                    psdkStat = PsdkPayloadCamera_PushAddedMediaFileInfo(PHOTO_FILE_PATH, mediaFileInfo);
-                    if (psdkStat != dji_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                        PsdkLogger_UserLogError("Push added media file info error 0x%08llX", psdkStat);
-                    }
-                } else {
-                    PsdkLogger_UserLogWarn("Can't found the media file by path. "
-                                           "Probably because media file has not existed. "
-                                           "Please check media file if exists. ");
-                }
-            }
-#endif
+        if (tempDigitalFactor > (dji_f32_t) ZOOM_DIGITAL_MAX_FACTOR) {
+            tempDigitalFactor = (dji_f32_t) ZOOM_DIGITAL_MAX_FACTOR;
         }
 
-        returnCode = osalHandler->MutexUnlock(s_commonMutex);
-        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
-            continue;
+        if (tempDigitalFactor < (dji_f32_t) ZOOM_DIGITAL_BASE_FACTOR) {
+            s_isOpticalZoomReachLimit = false;
+            tempDigitalFactor = ZOOM_DIGITAL_BASE_FACTOR;
         }
+    }
+    s_cameraOpticalZoomFocalLength = (uint16_t) tempFocalLength;
+    s_cameraDigitalZoomFactor = tempDigitalFactor;
 
-        // 10Hz
-        if (USER_UTIL_IS_WORK_TURN(step, 10, PAYLOAD_CAMERA_EMU_TASK_FREQ)) {
-            returnCode = osalHandler->MutexLock(s_zoomMutex);
-            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
-                continue;
-            }
+    s_opticalZoomNextStepTimeUs += PAYLOAD_CAMERA_EMU_ZOOM_STEP_PERIOD_MS * 1000;
+    UtilTimer_StartAt(&s_cameraTimerService, &s_opticalZoomTimer, s_opticalZoomNextStepTimeUs);
 
-#ifdef USER_CAMERA_EMU_HYBRID_ZOOM_ON
-            //Add logic here for zoom camera
-            if (s_isStartContinuousOpticalZoom == true) {
-                tempDigitalFactor = s_cameraDigitalZoomFactor;
-                tempFocalLength = (int32_t) s_cameraOpticalZoomFocalLength;
-                if (s_isOpticalZoomReachLimit == false) {
-                    if (s_cameraZoomDirection == DJI_CAMERA_ZOOM_DIRECTION_IN) {
-                        tempFocalLength += ((int) s_cameraZoomSpeed - DJI_CAMERA_ZOOM_SPEED_SLOWEST + 1) *
-                                           ZOOM_OPTICAL_FOCAL_LENGTH_CTRL_STEP;
-                    } else if (s_cameraZoomDirection == DJI_CAMERA_ZOOM_DIRECTION_OUT) {
-                        tempFocalLength -= ((int) s_cameraZoomSpeed - DJI_CAMERA_ZOOM_SPEED_SLOWEST + 1) *
-                                           ZOOM_OPTICAL_FOCAL_LENGTH_CTRL_STEP;
-                    }
-
-                    if (tempFocalLength > ZOOM_OPTICAL_FOCAL_MAX_LENGTH) {
-                        s_isOpticalZoomReachLimit = true;
-                        tempFocalLength = ZOOM_OPTICAL_FOCAL_MAX_LENGTH;
-                    }
-
-                    if (tempFocalLength < ZOOM_OPTICAL_FOCAL_MIN_LENGTH) {
-                        tempFocalLength = ZOOM_OPTICAL_FOCAL_MIN_LENGTH;
-                    }
-                } else {
-                    if (s_cameraZoomDirection == DJI_CAMERA_ZOOM_DIRECTION_IN) {
-                        tempDigitalFactor += (dji_f32_t) ZOOM_DIGITAL_STEP_FACTOR;
-                    } else if (s_cameraZoomDirection == DJI_CAMERA_ZOOM_DIRECTION_OUT) {
-                        tempDigitalFactor -= (dji_f32_t) ZOOM_DIGITAL_STEP_FACTOR;
-                    }
-
-                    if (tempDigitalFactor > (dji_f32_t) ZOOM_DIGITAL_MAX_FACTOR) {
-                        tempDigitalFactor = (dji_f32_t) ZOOM_DIGITAL_MAX_FACTOR;
-                    }
-
-                    if (tempDigitalFactor < (dji_f32_t) ZOOM_DIGITAL_BASE_FACTOR) {
-                        s_isOpticalZoomReachLimit = false;
-                        tempDigitalFactor = ZOOM_DIGITAL_BASE_FACTOR;
-                    }
-                }
-                s_cameraOpticalZoomFocalLength = (uint16_t) tempFocalLength;
-                s_cameraDigitalZoomFactor = tempDigitalFactor;
-            }
-#endif
+    returnCode = osalHandler->MutexUnlock(s_zoomMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
+        return;
+    }
 
-#if USER_CAMERA_EMU_TAP_ZOOM_ON
-            returnCode = osalHandler->MutexLock(s_tapZoomMutex);
-            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
-                goto out;
-            }
+    DjiTest_CameraNotifyZoomChange();
+}
 
-            if (s_isStartTapZoom) {
-                s_isStartTapZoom = false;
-                s_isTapZooming = true;
-
-                returnCode = osalHandler->GetTimeMs(&s_tapZoomStartTime);
-                if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    USER_LOG_ERROR("get start time error: 0x%08llX.", returnCode);
-                }
-
-                returnCode = DjiTest_CameraRotationGimbal(s_tapZoomNewestGimbalRotationArgument);
-                if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
-                    USER_LOG_ERROR("rotate gimbal error: 0x%08llX.", returnCode);
-                else
-                    s_cameraTapZoomState.isGimbalMoving = true;
-
-                returnCode = DjiTest_CameraHybridZoom(s_tapZoomNewestTargetHybridFocalLength);
-                if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    s_cameraTapZoomState.zoomState = (dji_f32_t) s_tapZoomNewestTargetHybridFocalLength >
-                                                     ((dji_f32_t) s_cameraOpticalZoomFocalLength *
-                                                      s_cameraDigitalZoomFactor)
-                                                     ? DJI_CAMERA_TAP_ZOOM_STATE_ZOOM_IN
-                                                     : DJI_CAMERA_TAP_ZOOM_STATE_ZOOM_OUT;
-                } else if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE) {
-                    USER_LOG_ERROR("hybrid zoom focal length beyond limit.");
-                    s_cameraTapZoomState.zoomState = DJI_CAMERA_TAP_ZOOM_STATE_ZOOM_LIMITED;
-                } else {
-                    USER_LOG_ERROR("hybrid zoom error: 0x%08llX.", returnCode);
-                }
-            } else if (s_isTapZooming) {
-                returnCode = osalHandler->GetTimeMs(&currentTime);
-                if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    USER_LOG_ERROR("get start time error: 0x%08llX.", returnCode);
-                }
-
-                if ((currentTime - s_tapZoomStartTime) >= TAP_ZOOM_DURATION) {
-                    s_cameraTapZoomState.zoomState = DJI_CAMERA_TAP_ZOOM_STATE_IDLE;
-                    s_cameraTapZoomState.isGimbalMoving = false;
-                    s_isTapZooming = false;
-                }
-            }
+/* Fired right after the tap to start rotating and zooming, then once more at the end of the tap zoom duration. */
+static void DjiTest_CameraTapZoomTimerCallback(void *arg)
+{
+    T_DjiReturnCode returnCode;
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    dji_f32_t currentHybridFocalLength;
 
-            returnCode = osalHandler->MutexUnlock(s_tapZoomMutex);
-            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
-                goto out;
-            }
-#endif
+    USER_UTIL_UNUSED(arg);
 
-out:
-            returnCode = osalHandler->MutexUnlock(s_zoomMutex);
-            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
-                continue;
-            }
-        }
+    returnCode = osalHandler->MutexLock(s_zoomMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
+        return;
+    }
 
-        // 1Hz
-        if (USER_UTIL_IS_WORK_TURN(step, 1, PAYLOAD_CAMERA_EMU_TASK_FREQ)) {
-            returnCode = osalHandler->MutexLock(s_commonMutex);
-            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
-                continue;
-            }
+    returnCode = osalHandler->MutexLock(s_tapZoomMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("lock mutex error: 0x%08llX.", returnCode);
+        goto out;
+    }
 
-            if (s_cameraState.isRecording) {
-                s_cameraState.currentVideoRecordingTimeInSeconds++;
-                s_cameraSDCardState.remainSpaceInMB =
-                    s_cameraSDCardState.remainSpaceInMB - SDCARD_PER_SECONDS_RECORD_SPACE_IN_MB;
-                if (s_cameraSDCardState.remainSpaceInMB > SDCARD_TOTAL_SPACE_IN_MB) {
-                    s_cameraSDCardState.remainSpaceInMB = 0;
-                    s_cameraSDCardState.isFull = true;
-                }
-            }
+    if (s_isStartTapZoom) {
+        s_isStartTapZoom = false;
+        s_isTapZooming = true;
+        UtilTimer_Start(&s_cameraTimerService, &s_tapZoomTimer, TAP_ZOOM_DURATION);
 
-            if (s_cameraState.isShootingIntervalStart == false) {
-                isStartIntervalPhotoAction = false;
-            }
+        returnCode = DjiTest_CameraRotationGimbal(s_tapZoomNewestGimbalRotationArgument);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
+            USER_LOG_ERROR("rotate gimbal error: 0x%08llX.", returnCode);
+        else
+            s_cameraTapZoomState.isGimbalMoving = true;
+
+        // The direction is given by the focal length before the zoom is applied.
+        currentHybridFocalLength = (dji_f32_t) s_cameraOpticalZoomFocalLength * s_cameraDigitalZoomFactor;
+        returnCode = DjiTest_CameraHybridZoom(s_tapZoomNewestTargetHybridFocalLength);
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            s_cameraTapZoomState.zoomState = (dji_f32_t) s_tapZoomNewestTargetHybridFocalLength >
+                                             currentHybridFocalLength
+                                             ? DJI_CAMERA_TAP_ZOOM_STATE_ZOOM_IN
+                                             : DJI_CAMERA_TAP_ZOOM_STATE_ZOOM_OUT;
+        } else if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE) {
+            USER_LOG_ERROR("hybrid zoom focal length beyond limit.");
+            s_cameraTapZoomState.zoomState = DJI_CAMERA_TAP_ZOOM_STATE_ZOOM_LIMITED;
+        } else {
+            USER_LOG_ERROR("hybrid zoom error: 0x%08llX.", returnCode);
+        }
+    } else if (s_isTapZooming) {
+        s_cameraTapZoomState.zoomState = DJI_CAMERA_TAP_ZOOM_STATE_IDLE;
+        s_cameraTapZoomState.isGimbalMoving = false;
+        s_isTapZooming = false;
+    }
 
-            if (s_cameraShootPhotoMode == DJI_CAMERA_SHOOT_PHOTO_MODE_INTERVAL
-                && s_cameraState.isShootingIntervalStart == true && s_cameraPhotoTimeIntervalSettings.captureCount > 0
-                && s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds > 0) {
-                s_cameraState.currentPhotoShootingIntervalTimeInSeconds--;
-
-                if ((s_cameraState.currentPhotoShootingIntervalTimeInSeconds == 0 &&
-                     s_cameraState.currentPhotoShootingIntervalCount > 0) ||
-                    (s_cameraState.isShootingIntervalStart == true && isStartIntervalPhotoAction == false)) {
-
-                    isStartIntervalPhotoAction = true;
-
-                    s_cameraState.shootingState = DJI_CAMERA_SHOOTING_INTERVAL_PHOTO;
-                    s_cameraState.isStoring = true;
-                    s_cameraState.currentPhotoShootingIntervalTimeInSeconds
-                        = s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds;
-                    if (s_cameraState.currentPhotoShootingIntervalCount < INTERVAL_PHOTOGRAPH_ALWAYS_COUNT) {
-                        USER_LOG_INFO("interval taking photograph count:%d interval_time:%ds",
-                                      (s_cameraPhotoTimeIntervalSettings.captureCount -
-                                       s_cameraState.currentPhotoShootingIntervalCount + 1),
-                                      s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds);
-                        s_cameraState.currentPhotoShootingIntervalCount--;
-                        if (s_cameraState.currentPhotoShootingIntervalCount == 0) {
-                            s_cameraState.shootingState = DJI_CAMERA_SHOOTING_PHOTO_IDLE;
-                            s_cameraState.isStoring = false;
-                            s_cameraState.isShootingIntervalStart = false;
-                        }
-                    } else {
-                        USER_LOG_INFO("interval taking photograph always, interval_time:%ds",
-                                      s_cameraPhotoTimeIntervalSettings.timeIntervalSeconds);
-                        s_cameraState.currentPhotoShootingIntervalCount--;
-                    }
-                }
-            }
+    returnCode = osalHandler->MutexUnlock(s_tapZoomMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
+    }
 
-            returnCode = osalHandler->MutexUnlock(s_commonMutex);
-            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
-                continue;
-            }
-        }
+out:
+    returnCode = osalHandler->MutexUnlock(s_zoomMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
+        return;
     }
-}
 
-#ifndef __CC_ARM
-#pragma GCC diagnostic pop
-#endif
+    DjiTest_CameraNotifyZoomChange();
+}
 
 /* Private functions definition-----------------------------------------------*/
 T_DjiReturnCode DjiTest_CameraEmuBaseStartService(void)
@@ -1234,6 +1406,13 @@ T_DjiReturnCode DjiTest_CameraEmuBaseStartService(void)
         return returnCode;
     }
 
+    returnCode = UtilTimer_ServiceInit(&s_cameraTimerService, NULL);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("init camera timer service error: 0x%08llX", returnCode);
+        return returnCode;
+    }
+    DjiTest_CameraInitTimers();
+
     returnCode = DjiPayloadCamera_Init();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("init payload camera error:0x%08llX", returnCode);
@@ -1249,6 +1428,16 @@ T_DjiReturnCode DjiTest_CameraEmuBaseStartService(void)
     s_cameraSDCardState.availableRecordingTimeInSeconds =
         SDCARD_TOTAL_SPACE_IN_MB / SDCARD_PER_SECONDS_RECORD_SPACE_IN_MB;
 
+#ifdef SYSTEM_ARCH_LINUX
+    /* Back the SDcard by a directory, the media files captured are then listed and downloaded from the app */
+    returnCode = DjiTest_CameraEmuStorageInit(NULL, SDCARD_TOTAL_SPACE_IN_MB);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_WARN("init sdcard storage error: 0x%08llX, only the sdcard space is emulated.", returnCode);
+    } else {
+        DjiTest_CameraUpdateSdCardSpace();
+    }
+#endif
+
     /* Register the camera common handler */
     s_commonHandler.GetSystemState = GetSystemState;
     s_commonHandler.SetMode = SetMode;
@@ -1346,9 +1535,8 @@ T_DjiReturnCode DjiTest_CameraEmuBaseStartService(void)
     }
 #endif
 
-    /* Create the camera emu taskHandle */
-    if (osalHandler->TaskCreate("user_camera_task", UserCamera_Task,
-                                PAYLOAD_CAMERA_EMU_TASK_STACK_SIZE, NULL, &s_userCameraThread)
+    /* Create the camera emu taskHandle, it only wakes up for the pending shooting, recording and zoom deadlines */
+    if (UtilTimer_ServiceStart(&s_cameraTimerService, "user_camera_task", PAYLOAD_CAMERA_EMU_TASK_STACK_SIZE)
         != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("user camera taskHandle create error");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
@@ -1424,6 +1612,25 @@ T_DjiReturnCode DjiTest_CameraGetOpticalZoomFactor(dji_f32_t *factor)
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
+/**
+ * @brief Register the callback notified of zoom factor changes, it is called once right away with the current factors
+ * if the camera is already running.
+ * @param callback: callback function, NULL stops the notifications.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraRegZoomChangeCallback(DjiTestCameraZoomChangeCallback callback)
+{
+    s_zoomChangeCallback = callback;
+    s_notifiedOpticalZoomFactor = 0;
+    s_notifiedDigitalZoomFactor = 0;
+
+    if (s_isCamInited == true) {
+        DjiTest_CameraNotifyZoomChange();
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
 T_DjiReturnCode DjiTest_CameraGetMode(E_DjiCameraMode *mode)
 {
     T_DjiReturnCode returnCode;
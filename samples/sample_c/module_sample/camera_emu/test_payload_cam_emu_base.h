@@ -38,11 +38,17 @@ extern "C" {
 /* Exported constants --------------------------------------------------------*/
 
 /* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Prototype of callback function notified when the zoom factors of the emulated camera change.
+ * @note It is called from the camera emulation timer task and from the camera handlers of the sdk, so it must not block.
+ */
+typedef void (*DjiTestCameraZoomChangeCallback)(dji_f32_t opticalZoomFactor, dji_f32_t digitalZoomFactor);
 
 /* Exported functions --------------------------------------------------------*/
 T_DjiReturnCode DjiTest_CameraEmuBaseStartService(void);
 T_DjiReturnCode DjiTest_CameraGetDigitalZoomFactor(dji_f32_t *factor);
 T_DjiReturnCode DjiTest_CameraGetOpticalZoomFactor(dji_f32_t *factor);
+T_DjiReturnCode DjiTest_CameraRegZoomChangeCallback(DjiTestCameraZoomChangeCallback callback);
 T_DjiReturnCode DjiTest_CameraGetMode(E_DjiCameraMode *mode);
 T_DjiReturnCode DjiTest_CameraGetVideoStreamType(E_DjiCameraVideoStreamType *type);
 bool DjiTest_CameraIsInited(void);
@@ -32,6 +32,7 @@
 #include "utils/util_buffer.h"
 #include "test_payload_cam_emu_media.h"
 #include "test_payload_cam_emu_base.h"
+#include "test_payload_cam_emu_storage.h"
 #include "camera_emu/dji_media_file_manage/dji_media_file_core.h"
 #include "dji_high_speed_data_channel.h"
 #include "dji_aircraft_info.h"
@@ -231,8 +232,15 @@ T_DjiReturnCode DjiTest_CameraEmuSetMediaFilePath(const char *path)
 T_DjiReturnCode DjiTest_CameraMediaGetFileInfo(const char *filePath, T_DjiCameraMediaFileInfo *fileInfo)
 {
     T_DjiReturnCode returnCode;
+    T_DjiReturnCode destroyReturnCode;
     T_DjiMediaFileHandle mediaFileHandle;
 
+    // The sdk asks the information of every file each time the file list is pulled, read it from the file only once.
+    if (DjiTest_CameraEmuStorageIsInited() == true &&
+        DjiTest_CameraEmuStorageGetFileInfo(filePath, fileInfo) == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
     returnCode = DjiMediaFile_CreateHandle(filePath, &mediaFileHandle);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Media file create handle error stat:0x%08llX", returnCode);
@@ -257,11 +265,15 @@ T_DjiReturnCode DjiTest_CameraMediaGetFileInfo(const char *filePath, T_DjiCamera
         goto out;
     }
 
+    if (DjiTest_CameraEmuStorageIsInited() == true) {
+        DjiTest_CameraEmuStorageSetFileInfo(filePath, fileInfo);
+    }
+
 out:
-    returnCode = DjiMediaFile_DestroyHandle(mediaFileHandle);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Media file destroy handle error stat:0x%08llX", returnCode);
-        return returnCode;
+    destroyReturnCode = DjiMediaFile_DestroyHandle(mediaFileHandle);
+    if (destroyReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Media file destroy handle error stat:0x%08llX", destroyReturnCode);
+        return destroyReturnCode;
     }
 
     return returnCode;
@@ -763,6 +775,10 @@ static T_DjiReturnCode GetMediaFileDir(char *dirPath)
     char curFileDirPath[DJI_FILE_PATH_SIZE_MAX];
     char tempPath[DJI_FILE_PATH_SIZE_MAX];
 
+    if (DjiTest_CameraEmuStorageIsInited() == true) {
+        return DjiTest_CameraEmuStorageGetRootPath(dirPath);
+    }
+
     returnCode = DjiUserUtil_GetCurrentFileDirPath(__FILE__, DJI_FILE_PATH_SIZE_MAX, curFileDirPath);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Get file current path error, stat = 0x%08llX", returnCode);
@@ -1003,7 +1019,11 @@ static T_DjiReturnCode DeleteMediaFile(char *filePath)
     T_DjiReturnCode returnCode;
 
     USER_LOG_INFO("delete media file:%s", filePath);
-    returnCode = DjiFile_Delete(filePath);
+    if (DjiTest_CameraEmuStorageIsInited() == true) {
+        returnCode = DjiTest_CameraEmuStorageDeleteFile(filePath);
+    } else {
+        returnCode = DjiFile_Delete(filePath);
+    }
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Media file delete error stat:0x%08llX", returnCode);
         return returnCode;
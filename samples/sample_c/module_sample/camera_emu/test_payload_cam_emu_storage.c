@@ -0,0 +1,1200 @@
+/**
+ ********************************************************************
+ * @file    test_payload_cam_emu_storage.c
+ * @brief   Emulated sdcard of the camera emulation: a directory under a quota, indexed in memory so the
+ * media file list is answered without rescanning the directory.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include "test_payload_cam_emu_storage.h"
+#include "utils/util_misc.h"
+#include "utils/util_file.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define DJI_TEST_CAMERA_EMU_STORAGE_DEFAULT_DIR_NAME        "camera_emu_sdcard"
+#define DJI_TEST_CAMERA_EMU_STORAGE_SEED_DIR_NAME           "media_file"
+#define DJI_TEST_CAMERA_EMU_STORAGE_PHOTO_TEMPLATE_NAME     "media_file/PSDK_0001_ORG.jpg"
+#define DJI_TEST_CAMERA_EMU_STORAGE_CAPTURE_PREFIX          "DJI_"
+#define DJI_TEST_CAMERA_EMU_STORAGE_INDEX_INIT_CAPACITY     (256)
+#define DJI_TEST_CAMERA_EMU_STORAGE_COPY_BUFFER_SIZE        (64 * 1024)
+#define DJI_TEST_CAMERA_EMU_STORAGE_TASK_STACK_SIZE         (2048)
+#define DJI_TEST_CAMERA_EMU_STORAGE_TASK_EXIT_TIMEOUT_MS    (10000)
+#define DJI_TEST_CAMERA_EMU_STORAGE_BYTES_PER_MB            (1024 * 1024)
+#define DJI_TEST_CAMERA_EMU_STORAGE_BENCHMARK_FILE_SIZE     (4 * 1024 * 1024)
+#define DJI_TEST_CAMERA_EMU_STORAGE_BENCHMARK_ROUNDS        (5)
+/* Leaves room in a file path for the "/", a file name and the prefix of the temporary copy of a photo. */
+#define DJI_TEST_CAMERA_EMU_STORAGE_ROOT_PATH_SIZE_MAX      \
+    (DJI_FILE_PATH_SIZE_MAX - DJI_TEST_CAMERA_EMU_STORAGE_FILE_NAME_SIZE_MAX - 16)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    T_DjiTestCameraEmuStorageFile file;
+    uint32_t nameHash;
+    bool isMediaInfoValid;
+    T_DjiCameraMediaFileInfo mediaInfo;
+} T_DjiTestCameraEmuStorageEntry;
+
+/* Private values -------------------------------------------------------------*/
+static bool s_isStorageInited = false;
+static T_DjiMutexHandle s_storageMutex = NULL;
+static T_DjiSemaHandle s_storageFormatSema = NULL;
+static T_DjiSemaHandle s_storageExitSema = NULL;
+static T_DjiTaskHandle s_storageFormatThread = NULL;
+static volatile bool s_isStorageTaskRunning = false;
+static char s_storageRootPath[DJI_TEST_CAMERA_EMU_STORAGE_ROOT_PATH_SIZE_MAX] = {0};
+static char s_storagePhotoTemplatePath[DJI_FILE_PATH_SIZE_MAX] = {0};
+
+static uint64_t s_storageQuotaBytes = 0;
+static uint64_t s_storageUsedBytes = 0;
+static uint64_t s_storageRemainBytes = 0;
+static uint64_t s_storageTotalBytes = 0;
+static bool s_isStorageFormatting = false;
+static uint32_t s_storageNextSequence = 1;
+static uint32_t s_storageFormatGeneration = 0;
+static bool s_isStorageRecording = false;
+static char s_storageRecordingName[DJI_TEST_CAMERA_EMU_STORAGE_FILE_NAME_SIZE_MAX] = {0};
+
+/* Files in directory order, then in creation order. Looked up by name through an open addressing table of entry
+ * index + 1, 0 marking a free slot. */
+static T_DjiTestCameraEmuStorageEntry *s_storageEntries = NULL;
+static uint32_t s_storageEntryCount = 0;
+static uint32_t s_storageEntryCapacity = 0;
+static uint32_t *s_storageHashTable = NULL;
+static uint32_t s_storageHashTableSize = 0;
+
+/* Private functions declaration ---------------------------------------------*/
+static uint32_t DjiTest_CameraEmuStorageHashName(const char *name);
+static T_DjiReturnCode DjiTest_CameraEmuStorageReserveEntries(uint32_t capacity);
+static void DjiTest_CameraEmuStorageRebuildHashTable(void);
+static T_DjiTestCameraEmuStorageEntry *DjiTest_CameraEmuStorageFindEntry(const char *name);
+static T_DjiTestCameraEmuStorageEntry *DjiTest_CameraEmuStorageAddEntry(const char *name, uint32_t sizeInBytes,
+                                                                        uint32_t modifyTime);
+static void DjiTest_CameraEmuStorageRemoveEntry(T_DjiTestCameraEmuStorageEntry *entry);
+static void DjiTest_CameraEmuStorageClearEntries(void);
+static const char *DjiTest_CameraEmuStorageGetNameInRoot(const char *filePath);
+static void DjiTest_CameraEmuStorageUpdateSpace(void);
+static T_DjiReturnCode DjiTest_CameraEmuStorageScanRoot(void);
+static T_DjiReturnCode DjiTest_CameraEmuStorageCopyFile(const char *srcPath, const char *dstPath,
+                                                        uint32_t *sizeInBytes);
+static T_DjiReturnCode DjiTest_CameraEmuStorageCreateFile(const char *path, uint32_t sizeInBytes);
+static void DjiTest_CameraEmuStorageSeedRoot(const char *seedDirPath);
+static uint32_t DjiTest_CameraEmuStorageRemoveAllFiles(const char *dirPath);
+static void *DjiTest_CameraEmuStorageFormatTask(void *arg);
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Open the emulated sdcard. The directory is scanned once here, afterwards the index follows the captures,
+ * the deletions and the formats done through this module.
+ * @param rootPath: directory of the sdcard, NULL to use the "camera_emu_sdcard" directory in the working directory,
+ * which is created and filled with the sample media files the first time.
+ * @param quotaInMB: capacity of the sdcard, the remaining space is also bounded by the free space of the filesystem.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageInit(const char *rootPath, uint32_t quotaInMB)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+    char curFileDirPath[DJI_FILE_PATH_SIZE_MAX] = {0};
+    char workDirPath[DJI_FILE_PATH_SIZE_MAX] = {0};
+    char seedDirPath[DJI_FILE_PATH_SIZE_MAX] = {0};
+    int length;
+    struct stat st;
+
+    if (s_isStorageInited == true) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    returnCode = DjiUserUtil_GetCurrentFileDirPath(__FILE__, DJI_FILE_PATH_SIZE_MAX, curFileDirPath);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Get file current path error, stat = 0x%08llX", returnCode);
+        return returnCode;
+    }
+
+    snprintf(s_storagePhotoTemplatePath, sizeof(s_storagePhotoTemplatePath), "%s%s", curFileDirPath,
+             DJI_TEST_CAMERA_EMU_STORAGE_PHOTO_TEMPLATE_NAME);
+    // The sample media files are only read from the source tree, the sdcard is written at run time so it is kept out
+    // of it.
+    if (rootPath == NULL) {
+        if (getcwd(workDirPath, sizeof(workDirPath)) == NULL) {
+            USER_LOG_ERROR("Get working directory error.");
+            return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        }
+        length = snprintf(s_storageRootPath, sizeof(s_storageRootPath), "%s/%s", workDirPath,
+                          DJI_TEST_CAMERA_EMU_STORAGE_DEFAULT_DIR_NAME);
+        snprintf(seedDirPath, sizeof(seedDirPath), "%s%s", curFileDirPath, DJI_TEST_CAMERA_EMU_STORAGE_SEED_DIR_NAME);
+    } else {
+        length = snprintf(s_storageRootPath, sizeof(s_storageRootPath), "%s", rootPath);
+    }
+    if (length < 0 || length >= (int) sizeof(s_storageRootPath)) {
+        USER_LOG_ERROR("Sdcard path is longer than %u bytes.", (uint32_t) sizeof(s_storageRootPath) - 1);
+        s_storageRootPath[0] = '\0';
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    while (strlen(s_storageRootPath) > 1 && s_storageRootPath[strlen(s_storageRootPath) - 1] == '/') {
+        s_storageRootPath[strlen(s_storageRootPath) - 1] = '\0';
+    }
+
+    if (stat(s_storageRootPath, &st) != 0) {
+        if (mkdir(s_storageRootPath, 0755) != 0) {
+            USER_LOG_ERROR("Create sdcard directory %s error.", s_storageRootPath);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        }
+        if (rootPath == NULL) {
+            DjiTest_CameraEmuStorageSeedRoot(seedDirPath);
+        }
+    } else if (S_ISDIR(st.st_mode) == 0) {
+        USER_LOG_ERROR("Sdcard path %s is not a directory.", s_storageRootPath);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    s_storageQuotaBytes = (uint64_t) quotaInMB * DJI_TEST_CAMERA_EMU_STORAGE_BYTES_PER_MB;
+    s_storageUsedBytes = 0;
+    s_storageNextSequence = 1;
+    s_isStorageFormatting = false;
+    s_isStorageRecording = false;
+
+    returnCode = DjiTest_CameraEmuStorageReserveEntries(DJI_TEST_CAMERA_EMU_STORAGE_INDEX_INIT_CAPACITY);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    returnCode = DjiTest_CameraEmuStorageScanRoot();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto freeIndex;
+    }
+    DjiTest_CameraEmuStorageUpdateSpace();
+
+    returnCode = osalHandler->MutexCreate(&s_storageMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create sdcard mutex error: 0x%08llX.", returnCode);
+        goto freeIndex;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_storageFormatSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create sdcard semaphore error: 0x%08llX.", returnCode);
+        goto destroyMutex;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_storageExitSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create sdcard semaphore error: 0x%08llX.", returnCode);
+        goto destroyFormatSema;
+    }
+
+    s_isStorageTaskRunning = true;
+    returnCode = osalHandler->TaskCreate("user_camera_sdcard_task", DjiTest_CameraEmuStorageFormatTask,
+                                         DJI_TEST_CAMERA_EMU_STORAGE_TASK_STACK_SIZE, NULL, &s_storageFormatThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create sdcard task error: 0x%08llX.", returnCode);
+        s_isStorageTaskRunning = false;
+        goto destroyExitSema;
+    }
+
+    s_isStorageInited = true;
+    USER_LOG_INFO("Sdcard %s: %u files, %llu MB used, %llu MB remain.", s_storageRootPath, s_storageEntryCount,
+                  (unsigned long long) (s_storageUsedBytes / DJI_TEST_CAMERA_EMU_STORAGE_BYTES_PER_MB),
+                  (unsigned long long) (s_storageRemainBytes / DJI_TEST_CAMERA_EMU_STORAGE_BYTES_PER_MB));
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+destroyExitSema:
+    osalHandler->SemaphoreDestroy(s_storageExitSema);
+    s_storageExitSema = NULL;
+destroyFormatSema:
+    osalHandler->SemaphoreDestroy(s_storageFormatSema);
+    s_storageFormatSema = NULL;
+destroyMutex:
+    osalHandler->MutexDestroy(s_storageMutex);
+    s_storageMutex = NULL;
+freeIndex:
+    DjiTest_CameraEmuStorageClearEntries();
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_CameraEmuStorageDeInit(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    // A format in progress is finished by the task before it exits.
+    s_isStorageTaskRunning = false;
+    osalHandler->SemaphorePost(s_storageFormatSema);
+    if (osalHandler->SemaphoreTimedWait(s_storageExitSema, DJI_TEST_CAMERA_EMU_STORAGE_TASK_EXIT_TIMEOUT_MS) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Wait sdcard task exit timeout.");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    osalHandler->TaskDestroy(s_storageFormatThread);
+    s_storageFormatThread = NULL;
+
+    osalHandler->SemaphoreDestroy(s_storageExitSema);
+    osalHandler->SemaphoreDestroy(s_storageFormatSema);
+    osalHandler->MutexDestroy(s_storageMutex);
+    s_storageExitSema = NULL;
+    s_storageFormatSema = NULL;
+    s_storageMutex = NULL;
+
+    DjiTest_CameraEmuStorageClearEntries();
+    s_isStorageInited = false;
+
+    return returnCode;
+}
+
+bool DjiTest_CameraEmuStorageIsInited(void)
+{
+    return s_isStorageInited;
+}
+
+/**
+ * @brief Get the directory of the sdcard, to be given to the sdk as the media file directory.
+ * @param dirPath: buffer of DJI_FILE_PATH_SIZE_MAX bytes.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageGetRootPath(char *dirPath)
+{
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    snprintf(dirPath, DJI_FILE_PATH_SIZE_MAX, "%s", s_storageRootPath);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Get the space of the sdcard. The free space of the filesystem is sampled on each call, a single statvfs, so
+ * that files written by other processes are accounted for.
+ * @param state: sdcard state.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageGetState(T_DjiTestCameraEmuStorageState *state)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    DjiTest_CameraEmuStorageUpdateSpace();
+    state->totalSpaceInMB = (uint32_t) (s_storageTotalBytes / DJI_TEST_CAMERA_EMU_STORAGE_BYTES_PER_MB);
+    state->remainSpaceInMB = (uint32_t) (s_storageRemainBytes / DJI_TEST_CAMERA_EMU_STORAGE_BYTES_PER_MB);
+    state->fileCount = s_storageEntryCount;
+    state->isFull = state->remainSpaceInMB == 0;
+    state->isFormatting = s_isStorageFormatting;
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Copy the file list of the sdcard out of the index, no filesystem access.
+ * @param files: output list.
+ * @param maxCount: capacity of the output list.
+ * @param count: number of files copied.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageGetFileList(T_DjiTestCameraEmuStorageFile *files, uint32_t maxCount,
+                                                    uint32_t *count)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t i;
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    *count = USER_UTIL_MIN(maxCount, s_storageEntryCount);
+    for (i = 0; i < *count; i++) {
+        files[i] = s_storageEntries[i].file;
+    }
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Get the media information of a file of the sdcard from the index.
+ * @param filePath: path of the file, as listed by the sdk in the sdcard directory.
+ * @param fileInfo: media information, its size is the size recorded in the index.
+ * @return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND when the file is not indexed or its media information was never
+ * set, the caller then reads it from the file and stores it with DjiTest_CameraEmuStorageSetFileInfo.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageGetFileInfo(const char *filePath, T_DjiCameraMediaFileInfo *fileInfo)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestCameraEmuStorageEntry *entry;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    const char *name;
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    name = DjiTest_CameraEmuStorageGetNameInRoot(filePath);
+    if (name == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    entry = DjiTest_CameraEmuStorageFindEntry(name);
+    if (entry != NULL && entry->isMediaInfoValid == true) {
+        *fileInfo = entry->mediaInfo;
+        fileInfo->fileSize = entry->file.sizeInBytes;
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    return returnCode;
+}
+
+/**
+ * @brief Store the media information of a file of the sdcard in the index, a file written into the sdcard directory by
+ * another process is indexed here.
+ * @param filePath: path of the file.
+ * @param fileInfo: media information read from the file.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageSetFileInfo(const char *filePath, const T_DjiCameraMediaFileInfo *fileInfo)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestCameraEmuStorageEntry *entry;
+    const char *name;
+    struct stat st;
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    name = DjiTest_CameraEmuStorageGetNameInRoot(filePath);
+    if (name == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    entry = DjiTest_CameraEmuStorageFindEntry(name);
+    if (entry == NULL && stat(filePath, &st) == 0 && S_ISREG(st.st_mode)) {
+        entry = DjiTest_CameraEmuStorageAddEntry(name, (uint32_t) st.st_size, (uint32_t) st.st_mtime);
+        if (entry != NULL) {
+            s_storageUsedBytes += entry->file.sizeInBytes;
+        }
+    }
+    if (entry != NULL) {
+        entry->mediaInfo = *fileInfo;
+        entry->isMediaInfoValid = true;
+    }
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    return entry != NULL ? DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS : DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+}
+
+/**
+ * @brief Store a new photo on the sdcard, a copy of the sample photo, or a file of the given size when the sample photo
+ * is missing.
+ * @param sizeInBytes: size of the photo when the sample photo is missing.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE when the sdcard is full.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageCapturePhoto(uint32_t sizeInBytes)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestCameraEmuStorageEntry *entry;
+    T_DjiReturnCode returnCode;
+    char name[DJI_TEST_CAMERA_EMU_STORAGE_FILE_NAME_SIZE_MAX];
+    char path[DJI_FILE_PATH_SIZE_MAX];
+    char tempPath[DJI_FILE_PATH_SIZE_MAX];
+    uint32_t photoSize = sizeInBytes;
+    uint32_t formatGeneration;
+    struct stat st;
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    if (stat(s_storagePhotoTemplatePath, &st) == 0) {
+        photoSize = (uint32_t) st.st_size;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    if (s_isStorageFormatting == true) {
+        osalHandler->MutexUnlock(s_storageMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+    DjiTest_CameraEmuStorageUpdateSpace();
+    if (photoSize > s_storageRemainBytes) {
+        osalHandler->MutexUnlock(s_storageMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+    snprintf(name, sizeof(name), DJI_TEST_CAMERA_EMU_STORAGE_CAPTURE_PREFIX "%04u.jpg", s_storageNextSequence++);
+    formatGeneration = s_storageFormatGeneration;
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    // The copy is done without the lock, into a temporary file of the format generation the name was reserved in. A
+    // format in the meantime restarts the sequence, so the photo is only renamed into place if none happened.
+    snprintf(path, sizeof(path), "%s/%s", s_storageRootPath, name);
+    snprintf(tempPath, sizeof(tempPath), "%s/.%08X_%s", s_storageRootPath, formatGeneration, name);
+    returnCode = DjiTest_CameraEmuStorageCopyFile(s_storagePhotoTemplatePath, tempPath, &photoSize);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        photoSize = sizeInBytes;
+        returnCode = DjiTest_CameraEmuStorageCreateFile(tempPath, photoSize);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Create photo %s error.", tempPath);
+            return returnCode;
+        }
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    if (s_isStorageFormatting == true || formatGeneration != s_storageFormatGeneration) {
+        osalHandler->MutexUnlock(s_storageMutex);
+        unlink(tempPath);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+    if (rename(tempPath, path) != 0) {
+        osalHandler->MutexUnlock(s_storageMutex);
+        USER_LOG_ERROR("Rename photo %s error.", tempPath);
+        unlink(tempPath);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    entry = DjiTest_CameraEmuStorageAddEntry(name, photoSize, (uint32_t) time(NULL));
+    if (entry != NULL) {
+        entry->mediaInfo.type = DJI_CAMERA_FILE_TYPE_JPEG;
+        entry->isMediaInfoValid = true;
+        s_storageUsedBytes += photoSize;
+    }
+    DjiTest_CameraEmuStorageUpdateSpace();
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Start a video on the sdcard, the file grows with DjiTest_CameraEmuStorageAppendRecord.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageStartRecord(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestCameraEmuStorageEntry *entry;
+    T_DjiReturnCode returnCode;
+    char name[DJI_TEST_CAMERA_EMU_STORAGE_FILE_NAME_SIZE_MAX];
+    char path[DJI_FILE_PATH_SIZE_MAX];
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    if (s_isStorageFormatting == true || s_isStorageRecording == true) {
+        osalHandler->MutexUnlock(s_storageMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    snprintf(name, sizeof(name), DJI_TEST_CAMERA_EMU_STORAGE_CAPTURE_PREFIX "%04u.mp4", s_storageNextSequence++);
+    snprintf(path, sizeof(path), "%s/%s", s_storageRootPath, name);
+    returnCode = DjiTest_CameraEmuStorageCreateFile(path, 0);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        osalHandler->MutexUnlock(s_storageMutex);
+        USER_LOG_ERROR("Create video %s error.", path);
+        return returnCode;
+    }
+
+    entry = DjiTest_CameraEmuStorageAddEntry(name, 0, (uint32_t) time(NULL));
+    if (entry != NULL) {
+        entry->mediaInfo.type = DJI_CAMERA_FILE_TYPE_MP4;
+        entry->mediaInfo.mediaFileAttr.attrVideoDuration = 0;
+        entry->mediaInfo.mediaFileAttr.attrVideoFrameRate = 30;
+        entry->mediaInfo.mediaFileAttr.attrVideoResolution = 1080;
+        entry->isMediaInfoValid = true;
+    }
+    snprintf(s_storageRecordingName, sizeof(s_storageRecordingName), "%s", name);
+    s_isStorageRecording = true;
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Grow the video being recorded.
+ * @param sizeInBytes: bytes recorded since the last call.
+ * @param durationInSeconds: duration recorded since the last call.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE when the sdcard is full, the video is then kept
+ * as it is.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageAppendRecord(uint32_t sizeInBytes, uint16_t durationInSeconds)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestCameraEmuStorageEntry *entry;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    char path[DJI_FILE_PATH_SIZE_MAX];
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    entry = s_isStorageRecording == true ? DjiTest_CameraEmuStorageFindEntry(s_storageRecordingName) : NULL;
+    if (entry == NULL) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+        goto out;
+    }
+
+    DjiTest_CameraEmuStorageUpdateSpace();
+    if (sizeInBytes > s_storageRemainBytes) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+        goto out;
+    }
+
+    // The video content is not emulated, the file is only extended so that the space it takes is real.
+    snprintf(path, sizeof(path), "%s/%s", s_storageRootPath, entry->file.name);
+    if (truncate(path, (off_t) entry->file.sizeInBytes + sizeInBytes) != 0) {
+        USER_LOG_ERROR("Extend video %s error.", path);
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        goto out;
+    }
+
+    entry->file.sizeInBytes += sizeInBytes;
+    entry->file.modifyTime = (uint32_t) time(NULL);
+    entry->mediaInfo.mediaFileAttr.attrVideoDuration += durationInSeconds;
+    s_storageUsedBytes += sizeInBytes;
+    DjiTest_CameraEmuStorageUpdateSpace();
+
+out:
+    osalHandler->MutexUnlock(s_storageMutex);
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_CameraEmuStorageStopRecord(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    s_isStorageRecording = false;
+    s_storageRecordingName[0] = '\0';
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Delete a file of the sdcard and drop it from the index.
+ * @param filePath: path of the file.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageDeleteFile(const char *filePath)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestCameraEmuStorageEntry *entry;
+    const char *name;
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    if (unlink(filePath) != 0) {
+        USER_LOG_ERROR("Delete file %s error.", filePath);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    name = DjiTest_CameraEmuStorageGetNameInRoot(filePath);
+    if (name == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    entry = DjiTest_CameraEmuStorageFindEntry(name);
+    if (entry != NULL) {
+        if (s_isStorageRecording == true && strcmp(name, s_storageRecordingName) == 0) {
+            s_isStorageRecording = false;
+            s_storageRecordingName[0] = '\0';
+        }
+        s_storageUsedBytes -= USER_UTIL_MIN(s_storageUsedBytes, entry->file.sizeInBytes);
+        DjiTest_CameraEmuStorageRemoveEntry(entry);
+    }
+    DjiTest_CameraEmuStorageUpdateSpace();
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Format the sdcard. The index is emptied at once, the files are deleted by the sdcard task; captures are
+ * refused with DJI_ERROR_SYSTEM_MODULE_CODE_BUSY until the state no longer reports isFormatting, and so are the photos
+ * still being copied when the format started.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageFormat(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (s_isStorageInited == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_storageMutex);
+    if (s_isStorageFormatting == true) {
+        osalHandler->MutexUnlock(s_storageMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+    s_isStorageFormatting = true;
+    s_isStorageRecording = false;
+    s_storageRecordingName[0] = '\0';
+    s_storageEntryCount = 0;
+    s_storageUsedBytes = 0;
+    s_storageNextSequence = 1;
+    s_storageFormatGeneration++;
+    DjiTest_CameraEmuStorageRebuildHashTable();
+    osalHandler->MutexUnlock(s_storageMutex);
+
+    osalHandler->SemaphorePost(s_storageFormatSema);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Compare listing a directory of many files by scanning it, as done for every request of the media file list,
+ * with listing it from the index of the sdcard. The directory is filled with empty files, removed at the end.
+ * @param dirPath: directory to fill, created when missing, it must not be the sdcard in use.
+ * @param fileCount: number of files.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_CameraEmuStorageRunBenchmark(const char *dirPath, uint32_t fileCount)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestCameraEmuStorageFile *files = NULL;
+    T_DjiTestCameraEmuStorageState state = {0};
+    T_DjiCameraMediaFileInfo mediaInfo = {0};
+    T_DjiReturnCode returnCode;
+    char path[DJI_FILE_PATH_SIZE_MAX];
+    uint32_t startMs = 0;
+    uint32_t stopMs = 0;
+    uint32_t scanMs = 0;
+    uint32_t listMs = 0;
+    uint32_t count = 0;
+    uint32_t round;
+    uint32_t i;
+    DIR *dir;
+    struct dirent *dirent;
+    struct stat st;
+
+    if (s_isStorageInited == true) {
+        USER_LOG_ERROR("Sdcard is in use, stop the camera emulation before the benchmark.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    if (fileCount == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    files = osalHandler->Malloc(fileCount * sizeof(T_DjiTestCameraEmuStorageFile));
+    if (files == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    if (mkdir(dirPath, 0755) != 0 && stat(dirPath, &st) != 0) {
+        USER_LOG_ERROR("Create benchmark directory %s error.", dirPath);
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        goto freeFiles;
+    }
+
+    osalHandler->GetTimeMs(&startMs);
+    for (i = 0; i < fileCount; i++) {
+        snprintf(path, sizeof(path), "%s/BENCH_%05u.jpg", dirPath, i);
+        returnCode = DjiTest_CameraEmuStorageCreateFile(path, DJI_TEST_CAMERA_EMU_STORAGE_BENCHMARK_FILE_SIZE);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Create benchmark file %s error.", path);
+            goto removeDir;
+        }
+    }
+    osalHandler->GetTimeMs(&stopMs);
+    USER_LOG_INFO("Benchmark: created %u files in %u ms.", fileCount, stopMs - startMs);
+
+    // Scan: what every list request costs without the index, a readdir and a stat per file.
+    for (round = 0; round < DJI_TEST_CAMERA_EMU_STORAGE_BENCHMARK_ROUNDS; round++) {
+        osalHandler->GetTimeMs(&startMs);
+        dir = opendir(dirPath);
+        if (dir == NULL) {
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            goto removeDir;
+        }
+        count = 0;
+        while ((dirent = readdir(dir)) != NULL) {
+            snprintf(path, sizeof(path), "%s/%s", dirPath, dirent->d_name);
+            if (stat(path, &st) == 0 && S_ISREG(st.st_mode)) {
+                count++;
+            }
+        }
+        closedir(dir);
+        osalHandler->GetTimeMs(&stopMs);
+        scanMs += stopMs - startMs;
+    }
+    USER_LOG_INFO("Benchmark: scan listed %u files in %u ms.", count,
+                  scanMs / DJI_TEST_CAMERA_EMU_STORAGE_BENCHMARK_ROUNDS);
+
+    osalHandler->GetTimeMs(&startMs);
+    returnCode = DjiTest_CameraEmuStorageInit(dirPath, UINT32_MAX);
+    osalHandler->GetTimeMs(&stopMs);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto removeDir;
+    }
+    USER_LOG_INFO("Benchmark: sdcard init indexed %u files in %u ms.", s_storageEntryCount, stopMs - startMs);
+
+    // First listing: the media information is read once per file and stored.
+    mediaInfo.type = DJI_CAMERA_FILE_TYPE_JPEG;
+    DjiTest_CameraEmuStorageGetFileList(files, fileCount, &count);
+    osalHandler->GetTimeMs(&startMs);
+    for (i = 0; i < count; i++) {
+        snprintf(path, sizeof(path), "%s/%s", dirPath, files[i].name);
+        DjiTest_CameraEmuStorageSetFileInfo(path, &mediaInfo);
+    }
+    osalHandler->GetTimeMs(&stopMs);
+    USER_LOG_INFO("Benchmark: first listing stored %u media infos in %u ms.", count, stopMs - startMs);
+
+    for (round = 0; round < DJI_TEST_CAMERA_EMU_STORAGE_BENCHMARK_ROUNDS; round++) {
+        osalHandler->GetTimeMs(&startMs);
+        DjiTest_CameraEmuStorageGetFileList(files, fileCount, &count);
+        for (i = 0; i < count; i++) {
+            snprintf(path, sizeof(path), "%s/%s", dirPath, files[i].name);
+            if (DjiTest_CameraEmuStorageGetFileInfo(path, &mediaInfo) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_ERROR("Benchmark: %s is not indexed.", path);
+            }
+        }
+        osalHandler->GetTimeMs(&stopMs);
+        listMs += stopMs - startMs;
+    }
+    USER_LOG_INFO("Benchmark: index listed %u files in %u ms.", count,
+                  listMs / DJI_TEST_CAMERA_EMU_STORAGE_BENCHMARK_ROUNDS);
+
+    osalHandler->GetTimeMs(&startMs);
+    DjiTest_CameraEmuStorageFormat();
+    DjiTest_CameraEmuStorageGetState(&state);
+    osalHandler->GetTimeMs(&stopMs);
+    USER_LOG_INFO("Benchmark: format returned in %u ms, %u files left in the index.", stopMs - startMs,
+                  state.fileCount);
+    while (state.isFormatting == true) {
+        osalHandler->TaskSleepMs(10);
+        DjiTest_CameraEmuStorageGetState(&state);
+    }
+    osalHandler->GetTimeMs(&stopMs);
+    USER_LOG_INFO("Benchmark: format done in %u ms.", stopMs - startMs);
+
+    returnCode = DjiTest_CameraEmuStorageDeInit();
+
+removeDir:
+    DjiTest_CameraEmuStorageRemoveAllFiles(dirPath);
+    rmdir(dirPath);
+freeFiles:
+    osalHandler->Free(files);
+    return returnCode;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static uint32_t DjiTest_CameraEmuStorageHashName(const char *name)
+{
+    uint32_t hash = 2166136261u;
+
+    while (*name != '\0') {
+        hash ^= (uint8_t) *name++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static T_DjiReturnCode DjiTest_CameraEmuStorageReserveEntries(uint32_t capacity)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestCameraEmuStorageEntry *entries;
+    uint32_t *hashTable;
+    uint32_t hashTableSize;
+
+    if (capacity <= s_storageEntryCapacity) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    // The table is kept at most half full, its size a power of two.
+    hashTableSize = 1;
+    while (hashTableSize < capacity * 2) {
+        hashTableSize <<= 1;
+    }
+
+    entries = osalHandler->Malloc(capacity * sizeof(T_DjiTestCameraEmuStorageEntry));
+    hashTable = osalHandler->Malloc(hashTableSize * sizeof(uint32_t));
+    if (entries == NULL || hashTable == NULL) {
+        USER_LOG_ERROR("Malloc sdcard index of %u files error.", capacity);
+        if (entries != NULL) {
+            osalHandler->Free(entries);
+        }
+        if (hashTable != NULL) {
+            osalHandler->Free(hashTable);
+        }
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    if (s_storageEntries != NULL) {
+        memcpy(entries, s_storageEntries, s_storageEntryCount * sizeof(T_DjiTestCameraEmuStorageEntry));
+        osalHandler->Free(s_storageEntries);
+        osalHandler->Free(s_storageHashTable);
+    }
+    s_storageEntries = entries;
+    s_storageEntryCapacity = capacity;
+    s_storageHashTable = hashTable;
+    s_storageHashTableSize = hashTableSize;
+    DjiTest_CameraEmuStorageRebuildHashTable();
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void DjiTest_CameraEmuStorageRebuildHashTable(void)
+{
+    uint32_t slot;
+    uint32_t i;
+
+    memset(s_storageHashTable, 0, s_storageHashTableSize * sizeof(uint32_t));
+    for (i = 0; i < s_storageEntryCount; i++) {
+        slot = s_storageEntries[i].nameHash & (s_storageHashTableSize - 1);
+        while (s_storageHashTable[slot] != 0) {
+            slot = (slot + 1) & (s_storageHashTableSize - 1);
+        }
+        s_storageHashTable[slot] = i + 1;
+    }
+}
+
+static T_DjiTestCameraEmuStorageEntry *DjiTest_CameraEmuStorageFindEntry(const char *name)
+{
+    T_DjiTestCameraEmuStorageEntry *entry;
+    uint32_t hash = DjiTest_CameraEmuStorageHashName(name);
+    uint32_t slot = hash & (s_storageHashTableSize - 1);
+
+    while (s_storageHashTable[slot] != 0) {
+        entry = &s_storageEntries[s_storageHashTable[slot] - 1];
+        if (entry->nameHash == hash && strcmp(entry->file.name, name) == 0) {
+            return entry;
+        }
+        slot = (slot + 1) & (s_storageHashTableSize - 1);
+    }
+
+    return NULL;
+}
+
+static T_DjiTestCameraEmuStorageEntry *DjiTest_CameraEmuStorageAddEntry(const char *name, uint32_t sizeInBytes,
+                                                                        uint32_t modifyTime)
+{
+    T_DjiTestCameraEmuStorageEntry *entry;
+    uint32_t slot;
+
+    if (strlen(name) >= DJI_TEST_CAMERA_EMU_STORAGE_FILE_NAME_SIZE_MAX) {
+        USER_LOG_WARN("File name %s is too long for the sdcard index.", name);
+        return NULL;
+    }
+
+    if (s_storageEntryCount == s_storageEntryCapacity &&
+        DjiTest_CameraEmuStorageReserveEntries(s_storageEntryCapacity * 2) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return NULL;
+    }
+
+    entry = &s_storageEntries[s_storageEntryCount];
+    memset(entry, 0, sizeof(T_DjiTestCameraEmuStorageEntry));
+    snprintf(entry->file.name, sizeof(entry->file.name), "%s", name);
+    entry->file.sizeInBytes = sizeInBytes;
+    entry->file.modifyTime = modifyTime;
+    entry->nameHash = DjiTest_CameraEmuStorageHashName(name);
+
+    slot = entry->nameHash & (s_storageHashTableSize - 1);
+    while (s_storageHashTable[slot] != 0) {
+        slot = (slot + 1) & (s_storageHashTableSize - 1);
+    }
+    s_storageHashTable[slot] = ++s_storageEntryCount;
+
+    return entry;
+}
+
+static void DjiTest_CameraEmuStorageRemoveEntry(T_DjiTestCameraEmuStorageEntry *entry)
+{
+    uint32_t index = (uint32_t) (entry - s_storageEntries);
+
+    memmove(entry, entry + 1, (s_storageEntryCount - index - 1) * sizeof(T_DjiTestCameraEmuStorageEntry));
+    s_storageEntryCount--;
+    DjiTest_CameraEmuStorageRebuildHashTable();
+}
+
+static void DjiTest_CameraEmuStorageClearEntries(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (s_storageEntries != NULL) {
+        osalHandler->Free(s_storageEntries);
+        osalHandler->Free(s_storageHashTable);
+    }
+    s_storageEntries = NULL;
+    s_storageHashTable = NULL;
+    s_storageEntryCount = 0;
+    s_storageEntryCapacity = 0;
+    s_storageHashTableSize = 0;
+}
+
+static const char *DjiTest_CameraEmuStorageGetNameInRoot(const char *filePath)
+{
+    size_t rootLen = strlen(s_storageRootPath);
+    const char *name;
+
+    if (strncmp(filePath, s_storageRootPath, rootLen) != 0 || filePath[rootLen] != '/') {
+        return NULL;
+    }
+
+    name = filePath + rootLen + 1;
+    while (*name == '/') {
+        name++;
+    }
+
+    return strchr(name, '/') == NULL && *name != '\0' ? name : NULL;
+}
+
+static void DjiTest_CameraEmuStorageUpdateSpace(void)
+{
+    struct statvfs fs;
+    uint64_t fsAvailBytes = UINT64_MAX;
+    uint64_t fsTotalBytes = UINT64_MAX;
+    uint64_t quotaRemainBytes;
+
+    if (statvfs(s_storageRootPath, &fs) == 0) {
+        fsAvailBytes = (uint64_t) fs.f_bavail * fs.f_frsize;
+        fsTotalBytes = (uint64_t) fs.f_blocks * fs.f_frsize;
+    }
+
+    quotaRemainBytes = s_storageQuotaBytes > s_storageUsedBytes ? s_storageQuotaBytes - s_storageUsedBytes : 0;
+    s_storageRemainBytes = USER_UTIL_MIN(quotaRemainBytes, fsAvailBytes);
+    s_storageTotalBytes = USER_UTIL_MIN(s_storageQuotaBytes, fsTotalBytes);
+}
+
+static T_DjiReturnCode DjiTest_CameraEmuStorageScanRoot(void)
+{
+    T_DjiTestCameraEmuStorageEntry *entry;
+    char path[DJI_FILE_PATH_SIZE_MAX];
+    unsigned int sequence;
+    DIR *dir;
+    struct dirent *dirent;
+    struct stat st;
+
+    dir = opendir(s_storageRootPath);
+    if (dir == NULL) {
+        USER_LOG_ERROR("Open sdcard directory %s error.", s_storageRootPath);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    while ((dirent = readdir(dir)) != NULL) {
+        // Hidden files are the temporary copies of photos, left behind when the sample was stopped while copying.
+        if (dirent->d_name[0] == '.') {
+            continue;
+        }
+        snprintf(path, sizeof(path), "%s/%s", s_storageRootPath, dirent->d_name);
+        if (stat(path, &st) != 0 || S_ISREG(st.st_mode) == 0) {
+            continue;
+        }
+
+        entry = DjiTest_CameraEmuStorageAddEntry(dirent->d_name, (uint32_t) st.st_size, (uint32_t) st.st_mtime);
+        if (entry == NULL) {
+            continue;
+        }
+        s_storageUsedBytes += entry->file.sizeInBytes;
+
+        if (sscanf(dirent->d_name, DJI_TEST_CAMERA_EMU_STORAGE_CAPTURE_PREFIX "%u.", &sequence) == 1 &&
+            sequence >= s_storageNextSequence) {
+            s_storageNextSequence = sequence + 1;
+        }
+    }
+    closedir(dir);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_CameraEmuStorageCopyFile(const char *srcPath, const char *dstPath,
+                                                        uint32_t *sizeInBytes)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    uint8_t *buffer;
+    uint32_t copiedSize = 0;
+    ssize_t readSize;
+    int srcFd;
+    int dstFd;
+
+    srcFd = open(srcPath, O_RDONLY);
+    if (srcFd < 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    dstFd = open(dstPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (dstFd < 0) {
+        close(srcFd);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    buffer = osalHandler->Malloc(DJI_TEST_CAMERA_EMU_STORAGE_COPY_BUFFER_SIZE);
+    if (buffer == NULL) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+        goto out;
+    }
+
+    while ((readSize = read(srcFd, buffer, DJI_TEST_CAMERA_EMU_STORAGE_COPY_BUFFER_SIZE)) > 0) {
+        if (write(dstFd, buffer, readSize) != readSize) {
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            break;
+        }
+        copiedSize += readSize;
+    }
+    if (readSize < 0) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    osalHandler->Free(buffer);
+
+out:
+    close(srcFd);
+    close(dstFd);
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        *sizeInBytes = copiedSize;
+    } else {
+        unlink(dstPath);
+    }
+
+    return returnCode;
+}
+
+static T_DjiReturnCode DjiTest_CameraEmuStorageCreateFile(const char *path, uint32_t sizeInBytes)
+{
+    int fd;
+    int ret;
+
+    // Sparse file: the size is reported as written without the time of writing it.
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    ret = ftruncate(fd, sizeInBytes);
+    close(fd);
+
+    return ret == 0 ? DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS : DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+}
+
+static void DjiTest_CameraEmuStorageSeedRoot(const char *seedDirPath)
+{
+    char srcPath[DJI_FILE_PATH_SIZE_MAX];
+    char dstPath[DJI_FILE_PATH_SIZE_MAX];
+    uint32_t sizeInBytes;
+    DIR *dir;
+    struct dirent *dirent;
+
+    dir = opendir(seedDirPath);
+    if (dir == NULL) {
+        return;
+    }
+
+    while ((dirent = readdir(dir)) != NULL) {
+        if (dirent->d_name[0] == '.') {
+            continue;
+        }
+        snprintf(srcPath, sizeof(srcPath), "%s/%s", seedDirPath, dirent->d_name);
+        snprintf(dstPath, sizeof(dstPath), "%s/%s", s_storageRootPath, dirent->d_name);
+        if (DjiTest_CameraEmuStorageCopyFile(srcPath, dstPath, &sizeInBytes) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_WARN("Copy %s to the sdcard error.", srcPath);
+        }
+    }
+    closedir(dir);
+}
+
+static uint32_t DjiTest_CameraEmuStorageRemoveAllFiles(const char *dirPath)
+{
+    char path[DJI_FILE_PATH_SIZE_MAX];
+    uint32_t count = 0;
+    DIR *dir;
+    struct dirent *dirent;
+    struct stat st;
+
+    dir = opendir(dirPath);
+    if (dir == NULL) {
+        return 0;
+    }
+
+    while ((dirent = readdir(dir)) != NULL) {
+        snprintf(path, sizeof(path), "%s/%s", dirPath, dirent->d_name);
+        if (stat(path, &st) == 0 && S_ISREG(st.st_mode) && unlink(path) == 0) {
+            count++;
+        }
+    }
+    closedir(dir);
+
+    return count;
+}
+
+static void *DjiTest_CameraEmuStorageFormatTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t count;
+
+    USER_UTIL_UNUSED(arg);
+
+    while (1) {
+        osalHandler->SemaphoreWait(s_storageFormatSema);
+
+        osalHandler->MutexLock(s_storageMutex);
+        if (s_isStorageFormatting == true) {
+            osalHandler->MutexUnlock(s_storageMutex);
+
+            // Nothing is written to the sdcard while formatting, the files are deleted without the lock.
+            count = DjiTest_CameraEmuStorageRemoveAllFiles(s_storageRootPath);
+            USER_LOG_INFO("Sdcard formatted, %u files deleted.", count);
+
+            osalHandler->MutexLock(s_storageMutex);
+            s_isStorageFormatting = false;
+            DjiTest_CameraEmuStorageUpdateSpace();
+        }
+        osalHandler->MutexUnlock(s_storageMutex);
+
+        if (s_isStorageTaskRunning == false) {
+            break;
+        }
+    }
+
+    osalHandler->SemaphorePost(s_storageExitSema);
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,79 @@
+/**
+ ********************************************************************
+ * @file    test_payload_cam_emu_storage.h
+ * @brief   This is the header file for "test_payload_cam_emu_storage.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_PAYLOAD_CAM_EMU_STORAGE_H
+#define TEST_PAYLOAD_CAM_EMU_STORAGE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_payload_camera.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_TEST_CAMERA_EMU_STORAGE_FILE_NAME_SIZE_MAX      (64)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    uint32_t totalSpaceInMB;
+    uint32_t remainSpaceInMB;
+    uint32_t fileCount;
+    bool isFull;
+    bool isFormatting;
+} T_DjiTestCameraEmuStorageState;
+
+typedef struct {
+    char name[DJI_TEST_CAMERA_EMU_STORAGE_FILE_NAME_SIZE_MAX];
+    uint32_t sizeInBytes;
+    uint32_t modifyTime; // unit: s, since epoch
+} T_DjiTestCameraEmuStorageFile;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode DjiTest_CameraEmuStorageInit(const char *rootPath, uint32_t quotaInMB);
+T_DjiReturnCode DjiTest_CameraEmuStorageDeInit(void);
+bool DjiTest_CameraEmuStorageIsInited(void);
+T_DjiReturnCode DjiTest_CameraEmuStorageGetRootPath(char *dirPath);
+T_DjiReturnCode DjiTest_CameraEmuStorageGetState(T_DjiTestCameraEmuStorageState *state);
+T_DjiReturnCode DjiTest_CameraEmuStorageGetFileList(T_DjiTestCameraEmuStorageFile *files, uint32_t maxCount,
+                                                    uint32_t *count);
+T_DjiReturnCode DjiTest_CameraEmuStorageGetFileInfo(const char *filePath, T_DjiCameraMediaFileInfo *fileInfo);
+T_DjiReturnCode DjiTest_CameraEmuStorageSetFileInfo(const char *filePath, const T_DjiCameraMediaFileInfo *fileInfo);
+T_DjiReturnCode DjiTest_CameraEmuStorageCapturePhoto(uint32_t sizeInBytes);
+T_DjiReturnCode DjiTest_CameraEmuStorageStartRecord(void);
+T_DjiReturnCode DjiTest_CameraEmuStorageAppendRecord(uint32_t sizeInBytes, uint16_t durationInSeconds);
+T_DjiReturnCode DjiTest_CameraEmuStorageStopRecord(void);
+T_DjiReturnCode DjiTest_CameraEmuStorageDeleteFile(const char *filePath);
+T_DjiReturnCode DjiTest_CameraEmuStorageFormat(void);
+T_DjiReturnCode DjiTest_CameraEmuStorageRunBenchmark(const char *dirPath, uint32_t fileCount);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_PAYLOAD_CAM_EMU_STORAGE_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -25,6 +25,8 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "test_data_transmission.h"
+#include "test_data_transmission_pump.h"
+#include <string.h>
 #include "dji_logger.h"
 #include "dji_platform.h"
 #include "utils/util_misc.h"
@@ -34,8 +36,11 @@
 #include "widget_interaction_test/test_widget_interaction.h"
 
 /* Private constants ---------------------------------------------------------*/
-#define DATA_TRANSMISSION_TASK_FREQ         (1)
-#define DATA_TRANSMISSION_TASK_STACK_SIZE   (2048)
+#define DATA_TRANSMISSION_TASK_FREQ                 (1)
+#define DATA_TRANSMISSION_TASK_STACK_SIZE           (2048)
+#define DATA_TRANSMISSION_STATISTICS_PRINT_PERIOD   (10)
+#define DATA_TRANSMISSION_LOW_SPEED_QUEUE_SIZE      (1024)
+#define DATA_TRANSMISSION_DATA_STREAM_QUEUE_SIZE    (8192)
 
 /* Private types -------------------------------------------------------------*/
 
@@ -45,10 +50,14 @@ static T_DjiReturnCode ReceiveDataFromMobile(const uint8_t *data, uint16_t len);
 static T_DjiReturnCode ReceiveDataFromCloud(const uint8_t *data, uint16_t len);
 static T_DjiReturnCode ReceiveDataFromExtensionPort(const uint8_t *data, uint16_t len);
 static T_DjiReturnCode ReceiveDataFromPayload(const uint8_t *data, uint16_t len);
+static void DjiTest_DataTransmissionConsumeData(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len);
+static const char *DjiTest_DataTransmissionGetChannelName(E_DjiChannelAddress channelAddress);
+static T_DjiReturnCode DjiTest_DataTransmissionEnableChannel(E_DjiChannelAddress channelAddress);
 
 /* Private variables ---------------------------------------------------------*/
 static T_DjiTaskHandle s_userDataTransmissionThread;
 static T_DjiAircraftInfoBaseInfo s_aircraftInfoBaseInfo;
+static bool s_isChannelActive[DJI_TEST_DATA_PUMP_CHANNEL_NUM] = {0};
 
 /* Exported functions definition ---------------------------------------------*/
 T_DjiReturnCode DjiTest_DataTransmissionStartService(void)
@@ -73,12 +82,20 @@ T_DjiReturnCode DjiTest_DataTransmissionStartService(void)
         return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
     }
 
+    /* Receive callbacks only hand data to the pump, so the pump has to run before they are registered. */
+    djiStat = DjiTest_DataPumpInit(DjiTest_DataPumpGetDefaultBackend(), DjiTest_DataTransmissionConsumeData);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("init data transmission pump error.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+
     channelAddress = DJI_CHANNEL_ADDRESS_MASTER_RC_APP;
     djiStat = DjiLowSpeedDataChannel_RegRecvDataCallback(channelAddress, ReceiveDataFromMobile);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("register receive data from mobile error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
+    DjiTest_DataTransmissionEnableChannel(channelAddress);
 
     if (s_aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M30 ||
         s_aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M30T) {
@@ -88,6 +105,7 @@ T_DjiReturnCode DjiTest_DataTransmissionStartService(void)
             USER_LOG_ERROR("register receive data from cloud error.");
             return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
         }
+        DjiTest_DataTransmissionEnableChannel(channelAddress);
     }
 
     if (s_aircraftInfoBaseInfo.mountPosition == DJI_MOUNT_POSITION_PAYLOAD_PORT_NO1 ||
@@ -99,6 +117,7 @@ T_DjiReturnCode DjiTest_DataTransmissionStartService(void)
             USER_LOG_ERROR("register receive data from extension port error.");
             return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
         }
+        DjiTest_DataTransmissionEnableChannel(channelAddress);
 
         djiStat = DjiHighSpeedDataChannel_SetBandwidthProportion(bandwidthProportionOfHighspeedChannel);
         if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -113,6 +132,11 @@ T_DjiReturnCode DjiTest_DataTransmissionStartService(void)
             USER_LOG_ERROR("get data stream remote address error.");
         }
 
+#ifdef SYSTEM_ARCH_LINUX
+        if (DjiPlatform_GetSocketHandler() != NULL) {
+            DjiTest_DataTransmissionEnableChannel(DJI_TEST_DATA_PUMP_CHANNEL_DATA_STREAM);
+        }
+#endif
     } else if (s_aircraftInfoBaseInfo.mountPosition == DJI_MOUNT_POSITION_EXTENSION_PORT
                 || DJI_MOUNT_POSITION_EXTENSION_LITE_PORT == s_aircraftInfoBaseInfo.mountPosition) {
         channelAddress = DJI_CHANNEL_ADDRESS_PAYLOAD_PORT_NO1;
@@ -121,6 +145,7 @@ T_DjiReturnCode DjiTest_DataTransmissionStartService(void)
             USER_LOG_ERROR("register receive data from payload NO1 error.");
             return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
         }
+        DjiTest_DataTransmissionEnableChannel(channelAddress);
     } else {
         return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
     }
@@ -151,6 +176,13 @@ T_DjiReturnCode DjiTest_DataTransmissionStopService(void)
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
+    returnCode = DjiTest_DataPumpDeInit();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("deinit data transmission pump error.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+    memset(s_isChannelActive, 0, sizeof(s_isChannelActive));
+
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
@@ -165,97 +197,41 @@ static void *UserDataTransmission_Task(void *arg)
 {
     T_DjiReturnCode djiStat;
     const uint8_t dataToBeSent[] = "DJI Data Transmission Test Data.";
-    T_DjiDataChannelState state = {0};
+    T_DjiTestDataPumpChannelStatistics statistics = {0};
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-    E_DjiChannelAddress channelAddress;
+    uint32_t cycleCount = 0;
 
     USER_UTIL_UNUSED(arg);
 
     while (1) {
         osalHandler->TaskSleepMs(1000 / DATA_TRANSMISSION_TASK_FREQ);
+        cycleCount++;
 
-        channelAddress = DJI_CHANNEL_ADDRESS_MASTER_RC_APP;
-        djiStat = DjiLowSpeedDataChannel_SendData(channelAddress, dataToBeSent, sizeof(dataToBeSent));
-        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
-            USER_LOG_ERROR("send data to mobile error.");
-
-        djiStat = DjiLowSpeedDataChannel_GetSendDataState(channelAddress, &state);
-        if (djiStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_DEBUG(
-                "send to mobile state: realtimeBandwidthBeforeFlowController: %d, realtimeBandwidthAfterFlowController: %d, busyState: %d.",
-                state.realtimeBandwidthBeforeFlowController, state.realtimeBandwidthAfterFlowController,
-                state.busyState);
-        } else {
-            USER_LOG_ERROR("get send to mobile channel state error.");
-        }
-
-        if (s_aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M30 ||
-            s_aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M30T) {
-            channelAddress = DJI_CHANNEL_ADDRESS_CLOUD_API;
-            djiStat = DjiLowSpeedDataChannel_SendData(channelAddress, dataToBeSent, sizeof(dataToBeSent));
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
-                USER_LOG_ERROR("send data to cloud error.");
-
-            djiStat = DjiLowSpeedDataChannel_GetSendDataState(channelAddress, &state);
-            if (djiStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_DEBUG(
-                    "send to cloud state: realtimeBandwidthBeforeFlowController: %d, realtimeBandwidthAfterFlowController: %d, busyState: %d.",
-                    state.realtimeBandwidthBeforeFlowController, state.realtimeBandwidthAfterFlowController,
-                    state.busyState);
-            } else {
-                USER_LOG_ERROR("get send to cloud channel state error.");
+        /* Sending only queues the data, the pump batches it into frames and paces it to the channel bandwidth. */
+        for (int i = 0; i < DJI_TEST_DATA_PUMP_CHANNEL_NUM; i++) {
+            if (!s_isChannelActive[i]) {
+                continue;
             }
-        }
-
-        if (s_aircraftInfoBaseInfo.mountPosition == DJI_MOUNT_POSITION_PAYLOAD_PORT_NO1 ||
-            s_aircraftInfoBaseInfo.mountPosition == DJI_MOUNT_POSITION_PAYLOAD_PORT_NO2 ||
-            s_aircraftInfoBaseInfo.mountPosition == DJI_MOUNT_POSITION_PAYLOAD_PORT_NO3) {
-            channelAddress = DJI_CHANNEL_ADDRESS_EXTENSION_PORT;
-            djiStat = DjiLowSpeedDataChannel_SendData(channelAddress, dataToBeSent, sizeof(dataToBeSent));
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
-                USER_LOG_ERROR("send data to extension port error.");
 
-            djiStat = DjiLowSpeedDataChannel_GetSendDataState(channelAddress, &state);
-            if (djiStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_DEBUG(
-                    "send to extension port state: realtimeBandwidthBeforeFlowController: %d, realtimeBandwidthAfterFlowController: %d, busyState: %d.",
-                    state.realtimeBandwidthBeforeFlowController, state.realtimeBandwidthAfterFlowController,
-                    state.busyState);
-            } else {
-                USER_LOG_ERROR("get send to extension port channel state error.");
+            djiStat = DjiTest_DataPumpSend((E_DjiChannelAddress) i, dataToBeSent, sizeof(dataToBeSent));
+            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_ERROR("send data to %s error.", DjiTest_DataTransmissionGetChannelName((E_DjiChannelAddress) i));
             }
 
-            if (DjiPlatform_GetSocketHandler() != NULL) {
-#ifdef SYSTEM_ARCH_LINUX
-                djiStat = DjiHighSpeedDataChannel_SendDataStreamData(dataToBeSent, sizeof(dataToBeSent));
-                if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
-                    USER_LOG_ERROR("send data to data stream error.");
-
-                djiStat = DjiHighSpeedDataChannel_GetDataStreamState(&state);
-                if (djiStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    USER_LOG_DEBUG(
-                        "data stream state: realtimeBandwidthLimit: %d, realtimeBandwidthBeforeFlowController: %d, busyState: %d.",
-                        state.realtimeBandwidthLimit, state.realtimeBandwidthBeforeFlowController, state.busyState);
-                } else {
-                    USER_LOG_ERROR("get data stream state error.");
-                }
-#endif
+            if (cycleCount % (DATA_TRANSMISSION_STATISTICS_PRINT_PERIOD * DATA_TRANSMISSION_TASK_FREQ) != 0) {
+                continue;
             }
-        } else if (s_aircraftInfoBaseInfo.mountPosition == DJI_MOUNT_POSITION_EXTENSION_PORT
-                    || DJI_MOUNT_POSITION_EXTENSION_LITE_PORT == s_aircraftInfoBaseInfo.mountPosition) {
-            channelAddress = DJI_CHANNEL_ADDRESS_PAYLOAD_PORT_NO1;
-            djiStat = DjiLowSpeedDataChannel_SendData(channelAddress, dataToBeSent, sizeof(dataToBeSent));
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
-                USER_LOG_ERROR("send data to extension port error.");
-
-            djiStat = DjiLowSpeedDataChannel_GetSendDataState(channelAddress, &state);
+
+            djiStat = DjiTest_DataPumpGetStatistics((E_DjiChannelAddress) i, &statistics);
             if (djiStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
                 USER_LOG_DEBUG(
-                    "send to extension port state: realtimeBandwidthBeforeFlowController: %d, realtimeBandwidthAfterFlowController: %d, busyState: %d.",
-                    state.realtimeBandwidthBeforeFlowController, state.realtimeBandwidthAfterFlowController,
-                    state.busyState);
+                    "send to %s state: queued: %u, sent: %u, frames: %u, dropped: %u, busy: %u, rate limit: %u.",
+                    DjiTest_DataTransmissionGetChannelName((E_DjiChannelAddress) i), statistics.queuedBytes,
+                    statistics.sentBytes, statistics.sentFrames, statistics.droppedBytes, statistics.busyCount,
+                    statistics.rateLimitBytesPerSecond);
             } else {
-                USER_LOG_ERROR("get send to extension port channel state error.");
+                USER_LOG_ERROR("get send to %s channel state error.",
+                               DjiTest_DataTransmissionGetChannelName((E_DjiChannelAddress) i));
             }
         }
     }
@@ -267,84 +243,78 @@ static void *UserDataTransmission_Task(void *arg)
 
 static T_DjiReturnCode ReceiveDataFromMobile(const uint8_t *data, uint16_t len)
 {
-    char *printData = NULL;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-
-    printData = osalHandler->Malloc(len + 1);
-    if (printData == NULL) {
-        USER_LOG_ERROR("malloc memory for printData fail.");
-        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
-    }
-
-    strncpy(printData, (const char *) data, len);
-    printData[len] = '\0';
-    USER_LOG_INFO("receive data from mobile: %s, len:%d.", printData, len);
-    DjiTest_WidgetLogAppend("receive data: %s, len:%d.", printData, len);
-
-    osalHandler->Free(printData);
-
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    return DjiTest_DataPumpPushRecvData(DJI_CHANNEL_ADDRESS_MASTER_RC_APP, data, len);
 }
 
 static T_DjiReturnCode ReceiveDataFromCloud(const uint8_t *data, uint16_t len)
 {
-    char *printData = NULL;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-
-    printData = osalHandler->Malloc(len + 1);
-    if (printData == NULL) {
-        USER_LOG_ERROR("malloc memory for printData fail.");
-        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
-    }
-
-    strncpy(printData, (const char *) data, len);
-    printData[len] = '\0';
-    USER_LOG_INFO("receive data from cloud: %s, len:%d.", printData, len);
-    DjiTest_WidgetLogAppend("receive data: %s, len:%d.", printData, len);
+    return DjiTest_DataPumpPushRecvData(DJI_CHANNEL_ADDRESS_CLOUD_API, data, len);
+}
 
-    osalHandler->Free(printData);
+static T_DjiReturnCode ReceiveDataFromExtensionPort(const uint8_t *data, uint16_t len)
+{
+    return DjiTest_DataPumpPushRecvData(DJI_CHANNEL_ADDRESS_EXTENSION_PORT, data, len);
+}
 
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+static T_DjiReturnCode ReceiveDataFromPayload(const uint8_t *data, uint16_t len)
+{
+    return DjiTest_DataPumpPushRecvData(DJI_CHANNEL_ADDRESS_PAYLOAD_PORT_NO1, data, len);
 }
 
-static T_DjiReturnCode ReceiveDataFromExtensionPort(const uint8_t *data, uint16_t len)
+static void DjiTest_DataTransmissionConsumeData(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len)
 {
-    char *printData = NULL;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    int printLen = len;
 
-    printData = osalHandler->Malloc(len + 1);
-    if (printData == NULL) {
-        USER_LOG_ERROR("malloc memory for printData fail.");
-        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    /* Test data is sent with its terminator, which should not be printed. */
+    if (printLen > 0 && data[printLen - 1] == '\0') {
+        printLen--;
     }
 
-    strncpy(printData, (const char *) data, len);
-    printData[len] = '\0';
-    USER_LOG_INFO("receive data from extension port: %s, len:%d.", printData, len);
-    DjiTest_WidgetLogAppend("receive data: %s, len:%d.", printData, len);
+    USER_LOG_INFO("receive data from %s: %.*s, len:%d.", DjiTest_DataTransmissionGetChannelName(channelAddress),
+                  printLen, (const char *) data, len);
+    DjiTest_WidgetLogAppend("receive data: %.*s, len:%d.", printLen, (const char *) data, len);
+}
 
-    osalHandler->Free(printData);
+static const char *DjiTest_DataTransmissionGetChannelName(E_DjiChannelAddress channelAddress)
+{
+    /* The data stream is a pseudo address of the pump, not an enumerator of the channel addresses. */
+    if (channelAddress == DJI_TEST_DATA_PUMP_CHANNEL_DATA_STREAM) {
+        return "data stream";
+    }
 
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    switch (channelAddress) {
+        case DJI_CHANNEL_ADDRESS_MASTER_RC_APP:
+            return "mobile";
+        case DJI_CHANNEL_ADDRESS_CLOUD_API:
+            return "cloud";
+        case DJI_CHANNEL_ADDRESS_EXTENSION_PORT:
+            return "extension port";
+        case DJI_CHANNEL_ADDRESS_PAYLOAD_PORT_NO1:
+            return "payload port";
+        default:
+            return "unknown";
+    }
 }
 
-static T_DjiReturnCode ReceiveDataFromPayload(const uint8_t *data, uint16_t len)
+static T_DjiReturnCode DjiTest_DataTransmissionEnableChannel(E_DjiChannelAddress channelAddress)
 {
-    char *printData = NULL;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode djiStat;
 
-    printData = osalHandler->Malloc(len + 1);
-    if (printData == NULL) {
-        USER_LOG_ERROR("malloc memory for printData fail.");
-        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    if (channelAddress == DJI_TEST_DATA_PUMP_CHANNEL_DATA_STREAM) {
+        djiStat = DjiTest_DataPumpEnableChannel(channelAddress, DATA_TRANSMISSION_DATA_STREAM_QUEUE_SIZE,
+                                                DJI_TEST_DATA_PUMP_DATA_STREAM_FRAME_SIZE);
+    } else {
+        djiStat = DjiTest_DataPumpEnableChannel(channelAddress, DATA_TRANSMISSION_LOW_SPEED_QUEUE_SIZE,
+                                                DJI_TEST_DATA_PUMP_LOW_SPEED_FRAME_SIZE);
     }
 
-    strncpy(printData, (const char *) data, len);
-    printData[len] = '\0';
-    USER_LOG_INFO("receive data from payload port: %s, len:%d.", printData, len);
-    DjiTest_WidgetLogAppend("receive data: %s, len:%d.", printData, len);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("enable %s channel of data transmission pump error.",
+                       DjiTest_DataTransmissionGetChannelName(channelAddress));
+        return djiStat;
+    }
 
-    osalHandler->Free(printData);
+    s_isChannelActive[channelAddress] = true;
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
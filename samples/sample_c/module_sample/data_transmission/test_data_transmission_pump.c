@@ -0,0 +1,664 @@
+/**
+ ********************************************************************
+ * @file    test_data_transmission_pump.c
+ * @brief
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_data_transmission_pump.h"
+#include <string.h>
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "dji_low_speed_data_channel.h"
+#include "dji_high_speed_data_channel.h"
+#include "utils/util_misc.h"
+#include "utils/util_buffer.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define DATA_PUMP_TASK_STACK_SIZE                   (2048)
+#define DATA_PUMP_IDLE_WAIT_TIME_MS                 (1000)
+#define DATA_PUMP_STATE_CHECK_INTERVAL_MS           (100)
+#define DATA_PUMP_BACKOFF_MIN_MS                    (100)
+#define DATA_PUMP_BACKOFF_MAX_MS                    (2000)
+#define DATA_PUMP_BURST_FRAME_NUM                   (4)
+#define DATA_PUMP_RATE_MIN_BYTES_PER_SECOND         (64)
+#define DATA_PUMP_LOW_SPEED_RATE_DEFAULT            (1024)
+#define DATA_PUMP_DATA_STREAM_RATE_DEFAULT          (64 * 1024)
+#define DATA_PUMP_RECV_SLOT_NUM                     (16)
+#define DATA_PUMP_RECV_SLOT_SIZE                    (256)
+#define DATA_PUMP_EXIT_WAIT_TIME_MS                 (1000)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    bool isEnabled;
+    T_UtilBuffer sendQueue;
+    uint8_t *sendQueueBuffer;
+    uint8_t *frameBuffer;
+    uint16_t frameSize;
+    uint16_t pendingLen;
+    uint32_t rateLimit;
+    uint32_t rateCeiling;
+    uint32_t tokens;
+    uint32_t lastRefillTimeMs;
+    uint32_t lastStateCheckTimeMs;
+    uint32_t backoffMs;
+    uint32_t backoffEndTimeMs;
+    T_DjiTestDataPumpChannelStatistics statistics;
+} T_DjiTestDataPumpChannel;
+
+typedef struct {
+    E_DjiChannelAddress channelAddress;
+    uint16_t len;
+    uint8_t data[DATA_PUMP_RECV_SLOT_SIZE];
+} T_DjiTestDataPumpRecvSlot;
+
+typedef struct {
+    uint32_t bandwidthLimit;
+    uint32_t windowStartTimeMs;
+    uint32_t windowAttemptBytes;
+    uint32_t windowSentBytes;
+    T_DjiDataChannelState state;
+} T_DjiTestDataPumpLoopback;
+
+/* Private functions declaration ---------------------------------------------*/
+static void *DjiTest_DataPumpTask(void *arg);
+static uint32_t DjiTest_DataPumpProcessSend(uint32_t nowMs);
+static void DjiTest_DataPumpUpdateRate(T_DjiTestDataPumpChannel *channel, E_DjiChannelAddress channelAddress,
+                                       uint32_t nowMs, bool isSendBusy);
+static bool DjiTest_DataPumpIsSendRetryable(T_DjiReturnCode returnCode);
+static void DjiTest_DataPumpProcessRecv(void);
+static T_DjiReturnCode DjiTest_DataPumpSdkSendData(E_DjiChannelAddress channelAddress, const uint8_t *data,
+                                                   uint16_t len);
+static T_DjiReturnCode DjiTest_DataPumpSdkGetSendDataState(E_DjiChannelAddress channelAddress,
+                                                           T_DjiDataChannelState *state);
+static T_DjiReturnCode DjiTest_DataPumpLoopbackSendData(E_DjiChannelAddress channelAddress, const uint8_t *data,
+                                                        uint16_t len);
+static T_DjiReturnCode DjiTest_DataPumpLoopbackGetSendDataState(E_DjiChannelAddress channelAddress,
+                                                                T_DjiDataChannelState *state);
+static void DjiTest_DataPumpLoopbackUpdateWindow(T_DjiTestDataPumpLoopback *loopback);
+
+/* Private variables ---------------------------------------------------------*/
+static const T_DjiTestDataPumpBackend s_sdkBackend = {
+    .SendData = DjiTest_DataPumpSdkSendData,
+    .GetSendDataState = DjiTest_DataPumpSdkGetSendDataState,
+};
+static const T_DjiTestDataPumpBackend s_loopbackBackend = {
+    .SendData = DjiTest_DataPumpLoopbackSendData,
+    .GetSendDataState = DjiTest_DataPumpLoopbackGetSendDataState,
+};
+static T_DjiTestDataPumpLoopback s_loopback[DJI_TEST_DATA_PUMP_CHANNEL_NUM];
+
+static const T_DjiTestDataPumpBackend *s_backend = NULL;
+static DjiTestDataPumpRecvCallback s_recvCallback = NULL;
+static T_DjiTestDataPumpChannel s_channel[DJI_TEST_DATA_PUMP_CHANNEL_NUM];
+static T_DjiTestDataPumpRecvSlot *s_recvSlot = NULL;
+static uint32_t s_recvWriteIndex = 0;
+static uint32_t s_recvReadIndex = 0;
+static uint32_t s_recvDroppedCount = 0;
+static T_DjiMutexHandle s_sendMutex;
+static T_DjiMutexHandle s_recvMutex;
+static T_DjiSemaHandle s_pumpSema;
+static T_DjiSemaHandle s_pumpExitSema;
+static T_DjiTaskHandle s_pumpThread;
+static volatile bool s_isPumpRunning = false;
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Start the message pump. Outgoing data is queued per channel, coalesced into channel sized frames and paced by
+ * the channel state reported by the backend. A frame the backend refuses as busy is kept and sent again once the
+ * backoff is over, only frames failing with other errors are dropped. Received data is copied once into a fixed queue
+ * on the SDK thread and handed to recvCallback on the pump task.
+ * @param backend: link to send through, NULL selects the default low speed and high speed data channel backend.
+ * @param recvCallback: consumer of received data, may be NULL.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_DataPumpInit(const T_DjiTestDataPumpBackend *backend, DjiTestDataPumpRecvCallback recvCallback)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+
+    if (s_isPumpRunning) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    s_backend = backend != NULL ? backend : &s_sdkBackend;
+    s_recvCallback = recvCallback;
+    memset(s_channel, 0, sizeof(s_channel));
+    s_recvWriteIndex = 0;
+    s_recvReadIndex = 0;
+    s_recvDroppedCount = 0;
+
+    s_recvSlot = osalHandler->Malloc(sizeof(T_DjiTestDataPumpRecvSlot) * DATA_PUMP_RECV_SLOT_NUM);
+    if (s_recvSlot == NULL) {
+        USER_LOG_ERROR("Malloc data pump receive queue failed.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    returnCode = osalHandler->MutexCreate(&s_sendMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create data pump send mutex failed, error code: 0x%08llX", returnCode);
+        goto freeRecvSlot;
+    }
+
+    returnCode = osalHandler->MutexCreate(&s_recvMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create data pump receive mutex failed, error code: 0x%08llX", returnCode);
+        goto destroySendMutex;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_pumpSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create data pump semaphore failed, error code: 0x%08llX", returnCode);
+        goto destroyRecvMutex;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_pumpExitSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create data pump exit semaphore failed, error code: 0x%08llX", returnCode);
+        goto destroyPumpSema;
+    }
+
+    s_isPumpRunning = true;
+    returnCode = osalHandler->TaskCreate("user_data_pump", DjiTest_DataPumpTask, DATA_PUMP_TASK_STACK_SIZE, NULL,
+                                         &s_pumpThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create data pump task failed, error code: 0x%08llX", returnCode);
+        s_isPumpRunning = false;
+        goto destroyPumpExitSema;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+destroyPumpExitSema:
+    osalHandler->SemaphoreDestroy(s_pumpExitSema);
+destroyPumpSema:
+    osalHandler->SemaphoreDestroy(s_pumpSema);
+destroyRecvMutex:
+    osalHandler->MutexDestroy(s_recvMutex);
+destroySendMutex:
+    osalHandler->MutexDestroy(s_sendMutex);
+freeRecvSlot:
+    osalHandler->Free(s_recvSlot);
+    s_recvSlot = NULL;
+
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_DataPumpDeInit(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (!s_isPumpRunning) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    s_isPumpRunning = false;
+    osalHandler->SemaphorePost(s_pumpSema);
+    if (osalHandler->SemaphoreTimedWait(s_pumpExitSema, DATA_PUMP_EXIT_WAIT_TIME_MS) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_WARN("Data pump task did not exit in time.");
+    }
+    osalHandler->TaskDestroy(s_pumpThread);
+
+    for (int i = 0; i < DJI_TEST_DATA_PUMP_CHANNEL_NUM; i++) {
+        if (s_channel[i].isEnabled) {
+            osalHandler->Free(s_channel[i].sendQueueBuffer);
+            osalHandler->Free(s_channel[i].frameBuffer);
+            s_channel[i].isEnabled = false;
+        }
+    }
+
+    osalHandler->SemaphoreDestroy(s_pumpExitSema);
+    osalHandler->SemaphoreDestroy(s_pumpSema);
+    osalHandler->MutexDestroy(s_recvMutex);
+    osalHandler->MutexDestroy(s_sendMutex);
+    osalHandler->Free(s_recvSlot);
+    s_recvSlot = NULL;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Enable the send queue of a channel.
+ * @param channelAddress: low speed channel address or DJI_TEST_DATA_PUMP_CHANNEL_DATA_STREAM.
+ * @param queueSize: size of the send queue, rounded down to a power of two.
+ * @param frameSize: max size of one frame handed to the backend.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_DataPumpEnableChannel(E_DjiChannelAddress channelAddress, uint16_t queueSize,
+                                              uint16_t frameSize)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestDataPumpChannel *channel;
+
+    if (!s_isPumpRunning || channelAddress >= DJI_TEST_DATA_PUMP_CHANNEL_NUM || frameSize == 0 ||
+        queueSize < frameSize) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    channel = &s_channel[channelAddress];
+    if (channel->isEnabled) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    channel->sendQueueBuffer = osalHandler->Malloc(queueSize);
+    channel->frameBuffer = osalHandler->Malloc(frameSize);
+    if (channel->sendQueueBuffer == NULL || channel->frameBuffer == NULL) {
+        osalHandler->Free(channel->sendQueueBuffer);
+        osalHandler->Free(channel->frameBuffer);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    osalHandler->MutexLock(s_sendMutex);
+    UtilBuffer_Init(&channel->sendQueue, channel->sendQueueBuffer, queueSize);
+    channel->frameSize = frameSize;
+    channel->rateCeiling = channelAddress == DJI_TEST_DATA_PUMP_CHANNEL_DATA_STREAM ?
+                           DATA_PUMP_DATA_STREAM_RATE_DEFAULT : DATA_PUMP_LOW_SPEED_RATE_DEFAULT;
+    channel->rateLimit = channel->rateCeiling;
+    channel->tokens = frameSize;
+    osalHandler->GetTimeMs(&channel->lastRefillTimeMs);
+    channel->lastStateCheckTimeMs = channel->lastRefillTimeMs - DATA_PUMP_STATE_CHECK_INTERVAL_MS;
+    channel->statistics.rateLimitBytesPerSecond = channel->rateLimit;
+    channel->isEnabled = true;
+    osalHandler->MutexUnlock(s_sendMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Queue data for a channel. The call never blocks on the link, data that does not fit the queue is dropped.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_DataPumpSend(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestDataPumpChannel *channel;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    if (!s_isPumpRunning || channelAddress >= DJI_TEST_DATA_PUMP_CHANNEL_NUM || data == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    channel = &s_channel[channelAddress];
+
+    osalHandler->MutexLock(s_sendMutex);
+    if (!channel->isEnabled) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    } else if (UtilBuffer_GetUnusedSize(&channel->sendQueue) < len) {
+        channel->statistics.droppedBytes += len;
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    } else {
+        UtilBuffer_Put(&channel->sendQueue, data, len);
+        channel->statistics.queuedBytes += len;
+    }
+    osalHandler->MutexUnlock(s_sendMutex);
+
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        osalHandler->SemaphorePost(s_pumpSema);
+    }
+
+    return returnCode;
+}
+
+/**
+ * @brief Hand received data to the pump. Meant to be called from the receive callbacks of the SDK, it only copies the
+ * data into the receive queue and returns.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_DataPumpPushRecvData(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestDataPumpRecvSlot *slot;
+
+    if (!s_isPumpRunning || data == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (len > DATA_PUMP_RECV_SLOT_SIZE) {
+        s_recvDroppedCount++;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    osalHandler->MutexLock(s_recvMutex);
+    if (s_recvWriteIndex - s_recvReadIndex >= DATA_PUMP_RECV_SLOT_NUM) {
+        s_recvDroppedCount++;
+        osalHandler->MutexUnlock(s_recvMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    slot = &s_recvSlot[s_recvWriteIndex % DATA_PUMP_RECV_SLOT_NUM];
+    slot->channelAddress = channelAddress;
+    slot->len = len;
+    memcpy(slot->data, data, len);
+    s_recvWriteIndex++;
+    osalHandler->MutexUnlock(s_recvMutex);
+
+    osalHandler->SemaphorePost(s_pumpSema);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_DataPumpGetStatistics(E_DjiChannelAddress channelAddress,
+                                              T_DjiTestDataPumpChannelStatistics *statistics)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (!s_isPumpRunning || channelAddress >= DJI_TEST_DATA_PUMP_CHANNEL_NUM || statistics == NULL ||
+        !s_channel[channelAddress].isEnabled) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    osalHandler->MutexLock(s_sendMutex);
+    *statistics = s_channel[channelAddress].statistics;
+    osalHandler->MutexUnlock(s_sendMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+const T_DjiTestDataPumpBackend *DjiTest_DataPumpGetDefaultBackend(void)
+{
+    return &s_sdkBackend;
+}
+
+/**
+ * @brief Get a backend that delivers every sent frame back to the receive queue of the same channel. Each channel
+ * accepts at most bandwidthLimitBytesPerSecond and reports busy state like a real flow controller once it is exceeded.
+ * @return Pointer to the loopback backend.
+ */
+const T_DjiTestDataPumpBackend *DjiTest_DataPumpGetLoopbackBackend(uint32_t bandwidthLimitBytesPerSecond)
+{
+    memset(s_loopback, 0, sizeof(s_loopback));
+    for (int i = 0; i < DJI_TEST_DATA_PUMP_CHANNEL_NUM; i++) {
+        s_loopback[i].bandwidthLimit = bandwidthLimitBytesPerSecond;
+        s_loopback[i].state.realtimeBandwidthLimit = (int32_t) bandwidthLimitBytesPerSecond;
+    }
+
+    return &s_loopbackBackend;
+}
+
+/* Private functions definition-----------------------------------------------*/
+#ifndef __CC_ARM
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-noreturn"
+#pragma GCC diagnostic ignored "-Wreturn-type"
+#endif
+
+static void *DjiTest_DataPumpTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t nowMs;
+    uint32_t waitTimeMs;
+
+    USER_UTIL_UNUSED(arg);
+
+    while (s_isPumpRunning) {
+        DjiTest_DataPumpProcessRecv();
+
+        osalHandler->GetTimeMs(&nowMs);
+        waitTimeMs = DjiTest_DataPumpProcessSend(nowMs);
+
+        /* Sleep until new data arrives or the next frame is allowed on any channel. */
+        osalHandler->SemaphoreTimedWait(s_pumpSema, waitTimeMs);
+    }
+
+    osalHandler->SemaphorePost(s_pumpExitSema);
+
+    return NULL;
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
+static uint32_t DjiTest_DataPumpProcessSend(uint32_t nowMs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t waitTimeMs = DATA_PUMP_IDLE_WAIT_TIME_MS;
+    T_DjiTestDataPumpChannel *channel;
+    uint16_t queuedLen;
+    uint16_t frameLen;
+    uint32_t tokensMax;
+    uint32_t elapsedMs;
+    T_DjiReturnCode returnCode;
+
+    for (int i = 0; i < DJI_TEST_DATA_PUMP_CHANNEL_NUM; i++) {
+        channel = &s_channel[i];
+
+        osalHandler->MutexLock(s_sendMutex);
+        if (!channel->isEnabled) {
+            osalHandler->MutexUnlock(s_sendMutex);
+            continue;
+        }
+
+        queuedLen = (uint16_t) (channel->sendQueue.writeIndex - channel->sendQueue.readIndex);
+        if (queuedLen == 0 && channel->pendingLen == 0) {
+            channel->lastRefillTimeMs = nowMs;
+            osalHandler->MutexUnlock(s_sendMutex);
+            continue;
+        }
+
+        if ((int32_t) (channel->backoffEndTimeMs - nowMs) > 0) {
+            waitTimeMs = USER_UTIL_MIN(waitTimeMs, channel->backoffEndTimeMs - nowMs);
+            channel->lastRefillTimeMs = nowMs;
+            osalHandler->MutexUnlock(s_sendMutex);
+            continue;
+        }
+
+        if (nowMs - channel->lastStateCheckTimeMs >= DATA_PUMP_STATE_CHECK_INTERVAL_MS) {
+            DjiTest_DataPumpUpdateRate(channel, (E_DjiChannelAddress) i, nowMs, false);
+            if ((int32_t) (channel->backoffEndTimeMs - nowMs) > 0) {
+                waitTimeMs = USER_UTIL_MIN(waitTimeMs, channel->backoffEndTimeMs - nowMs);
+                osalHandler->MutexUnlock(s_sendMutex);
+                continue;
+            }
+        }
+
+        elapsedMs = nowMs - channel->lastRefillTimeMs;
+        channel->lastRefillTimeMs = nowMs;
+        tokensMax = (uint32_t) channel->frameSize * DATA_PUMP_BURST_FRAME_NUM;
+        channel->tokens = USER_UTIL_MIN(tokensMax, channel->tokens + channel->rateLimit * elapsedMs / 1000);
+
+        /* Coalesce everything queued into frames of the channel size, as far as the rate allows. A frame the link
+         * refused stays in the frame buffer and goes out first once the backoff is over. */
+        while (queuedLen > 0 || channel->pendingLen > 0) {
+            frameLen = channel->pendingLen > 0 ? channel->pendingLen : USER_UTIL_MIN(queuedLen, channel->frameSize);
+            if (channel->tokens < frameLen) {
+                break;
+            }
+
+            if (channel->pendingLen == 0) {
+                UtilBuffer_Get(&channel->sendQueue, channel->frameBuffer, frameLen);
+                channel->pendingLen = frameLen;
+            }
+            channel->tokens -= frameLen;
+            osalHandler->MutexUnlock(s_sendMutex);
+
+            returnCode = s_backend->SendData((E_DjiChannelAddress) i, channel->frameBuffer, frameLen);
+
+            osalHandler->MutexLock(s_sendMutex);
+            queuedLen = (uint16_t) (channel->sendQueue.writeIndex - channel->sendQueue.readIndex);
+            if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                channel->statistics.sentBytes += frameLen;
+                channel->statistics.sentFrames++;
+            } else if (DjiTest_DataPumpIsSendRetryable(returnCode)) {
+                DjiTest_DataPumpUpdateRate(channel, (E_DjiChannelAddress) i, nowMs, true);
+                waitTimeMs = USER_UTIL_MIN(waitTimeMs, channel->backoffEndTimeMs - nowMs);
+                break;
+            } else {
+                USER_LOG_ERROR("Send data pump frame of channel %d failed, error code: 0x%08llX", i, returnCode);
+                channel->statistics.droppedBytes += frameLen;
+            }
+            channel->pendingLen = 0;
+        }
+
+        if (channel->pendingLen == 0 && queuedLen > 0) {
+            frameLen = USER_UTIL_MIN(queuedLen, channel->frameSize);
+            waitTimeMs = USER_UTIL_MIN(waitTimeMs,
+                                       (frameLen - channel->tokens) * 1000 / channel->rateLimit + 1);
+        } else if (channel->pendingLen > 0 && channel->tokens < channel->pendingLen) {
+            waitTimeMs = USER_UTIL_MIN(waitTimeMs,
+                                       (channel->pendingLen - channel->tokens) * 1000 / channel->rateLimit + 1);
+        }
+        osalHandler->MutexUnlock(s_sendMutex);
+    }
+
+    return waitTimeMs;
+}
+
+/* Additive increase while the link keeps up, multiplicative decrease and exponential backoff once it reports busy or
+ * refuses a frame. */
+static void DjiTest_DataPumpUpdateRate(T_DjiTestDataPumpChannel *channel, E_DjiChannelAddress channelAddress,
+                                       uint32_t nowMs, bool isSendBusy)
+{
+    T_DjiDataChannelState state = {0};
+
+    channel->lastStateCheckTimeMs = nowMs;
+    if (s_backend->GetSendDataState(channelAddress, &state) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS && !isSendBusy) {
+        return;
+    }
+
+    if (state.realtimeBandwidthLimit > 0) {
+        channel->rateCeiling = (uint32_t) state.realtimeBandwidthLimit;
+    }
+
+    if (state.busyState || isSendBusy) {
+        channel->statistics.busyCount++;
+        channel->rateLimit = USER_UTIL_MAX(DATA_PUMP_RATE_MIN_BYTES_PER_SECOND, channel->rateLimit / 2);
+        if (state.realtimeBandwidthAfterFlowController > 0) {
+            channel->rateLimit = USER_UTIL_MAX(DATA_PUMP_RATE_MIN_BYTES_PER_SECOND,
+                                               USER_UTIL_MIN(channel->rateLimit,
+                                                             (uint32_t) state.realtimeBandwidthAfterFlowController));
+        }
+        channel->backoffMs = channel->backoffMs == 0 ? DATA_PUMP_BACKOFF_MIN_MS :
+                             USER_UTIL_MIN(channel->backoffMs * 2, DATA_PUMP_BACKOFF_MAX_MS);
+        channel->backoffEndTimeMs = nowMs + channel->backoffMs;
+        channel->tokens = 0;
+    } else {
+        channel->backoffMs = 0;
+        channel->rateLimit = USER_UTIL_MIN(channel->rateCeiling, channel->rateLimit + channel->frameSize);
+    }
+
+    channel->statistics.rateLimitBytesPerSecond = channel->rateLimit;
+}
+
+/* Errors of a congested or momentarily unavailable link, the frame is kept and sent again after the backoff. */
+static bool DjiTest_DataPumpIsSendRetryable(T_DjiReturnCode returnCode)
+{
+    return returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY || returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT ||
+           returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_EXECUTING_HIGHER_PRIORITY_TASK;
+}
+
+static void DjiTest_DataPumpProcessRecv(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestDataPumpRecvSlot *slot;
+    uint32_t writeIndex;
+
+    osalHandler->MutexLock(s_recvMutex);
+    writeIndex = s_recvWriteIndex;
+    osalHandler->MutexUnlock(s_recvMutex);
+
+    /* Slots between read and write index are owned by the consumer, producers never touch them. */
+    while (s_recvReadIndex != writeIndex) {
+        slot = &s_recvSlot[s_recvReadIndex % DATA_PUMP_RECV_SLOT_NUM];
+        if (s_recvCallback != NULL) {
+            s_recvCallback(slot->channelAddress, slot->data, slot->len);
+        }
+
+        osalHandler->MutexLock(s_recvMutex);
+        s_recvReadIndex++;
+        osalHandler->MutexUnlock(s_recvMutex);
+    }
+}
+
+static T_DjiReturnCode DjiTest_DataPumpSdkSendData(E_DjiChannelAddress channelAddress, const uint8_t *data,
+                                                   uint16_t len)
+{
+    if (channelAddress == DJI_TEST_DATA_PUMP_CHANNEL_DATA_STREAM) {
+#ifdef SYSTEM_ARCH_LINUX
+        return DjiHighSpeedDataChannel_SendDataStreamData(data, len);
+#else
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+#endif
+    }
+
+    return DjiLowSpeedDataChannel_SendData(channelAddress, data, (uint8_t) len);
+}
+
+static T_DjiReturnCode DjiTest_DataPumpSdkGetSendDataState(E_DjiChannelAddress channelAddress,
+                                                           T_DjiDataChannelState *state)
+{
+    if (channelAddress == DJI_TEST_DATA_PUMP_CHANNEL_DATA_STREAM) {
+#ifdef SYSTEM_ARCH_LINUX
+        return DjiHighSpeedDataChannel_GetDataStreamState(state);
+#else
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+#endif
+    }
+
+    return DjiLowSpeedDataChannel_GetSendDataState(channelAddress, state);
+}
+
+static T_DjiReturnCode DjiTest_DataPumpLoopbackSendData(E_DjiChannelAddress channelAddress, const uint8_t *data,
+                                                        uint16_t len)
+{
+    T_DjiTestDataPumpLoopback *loopback = &s_loopback[channelAddress];
+
+    DjiTest_DataPumpLoopbackUpdateWindow(loopback);
+
+    loopback->windowAttemptBytes += len;
+    if (loopback->bandwidthLimit != 0 && loopback->windowSentBytes + len > loopback->bandwidthLimit) {
+        loopback->state.busyState = true;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    loopback->windowSentBytes += len;
+
+    return DjiTest_DataPumpPushRecvData(channelAddress, data, len);
+}
+
+static T_DjiReturnCode DjiTest_DataPumpLoopbackGetSendDataState(E_DjiChannelAddress channelAddress,
+                                                                T_DjiDataChannelState *state)
+{
+    /* The state follows the clock like a real flow controller, also while the pump holds back. */
+    DjiTest_DataPumpLoopbackUpdateWindow(&s_loopback[channelAddress]);
+    *state = s_loopback[channelAddress].state;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void DjiTest_DataPumpLoopbackUpdateWindow(T_DjiTestDataPumpLoopback *loopback)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t nowMs;
+
+    osalHandler->GetTimeMs(&nowMs);
+    if (nowMs - loopback->windowStartTimeMs >= 1000) {
+        loopback->state.realtimeBandwidthBeforeFlowController = (int32_t) loopback->windowAttemptBytes;
+        loopback->state.realtimeBandwidthAfterFlowController = (int32_t) loopback->windowSentBytes;
+        loopback->state.busyState = loopback->windowAttemptBytes > loopback->windowSentBytes;
+        loopback->windowStartTimeMs = nowMs;
+        loopback->windowAttemptBytes = 0;
+        loopback->windowSentBytes = 0;
+    }
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
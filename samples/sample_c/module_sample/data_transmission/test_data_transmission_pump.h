@@ -0,0 +1,89 @@
+/**
+ ********************************************************************
+ * @file    test_data_transmission_pump.h
+ * @brief   This is the header file for "test_data_transmission_pump.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_DATA_TRANSMISSION_PUMP_H
+#define TEST_DATA_TRANSMISSION_PUMP_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Pseudo channel address of the high speed data stream, placed right after the low speed channel addresses. */
+#define DJI_TEST_DATA_PUMP_CHANNEL_DATA_STREAM      ((E_DjiChannelAddress) (DJI_CHANNEL_ADDRESS_CLOUD_API + 1))
+#define DJI_TEST_DATA_PUMP_CHANNEL_NUM              (DJI_CHANNEL_ADDRESS_CLOUD_API + 2)
+
+/* Max size of one package on the physical link of the low speed channel. */
+#define DJI_TEST_DATA_PUMP_LOW_SPEED_FRAME_SIZE     (128)
+#define DJI_TEST_DATA_PUMP_DATA_STREAM_FRAME_SIZE   (1024)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Link the pump sends through. The default backend wraps the low speed and high speed data channel interfaces,
+ * the loopback backend can be used to exercise the pump without an aircraft.
+ */
+typedef struct {
+    T_DjiReturnCode (*SendData)(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len);
+    T_DjiReturnCode (*GetSendDataState)(E_DjiChannelAddress channelAddress, T_DjiDataChannelState *state);
+} T_DjiTestDataPumpBackend;
+
+/**
+ * @brief Prototype of the consumer of received data. It is called on the pump task, data points into the receive
+ * queue and is only valid until the callback returns.
+ */
+typedef void (*DjiTestDataPumpRecvCallback)(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len);
+
+typedef struct {
+    uint32_t queuedBytes;
+    uint32_t sentBytes;
+    uint32_t sentFrames;
+    uint32_t droppedBytes;
+    uint32_t busyCount;
+    uint32_t rateLimitBytesPerSecond;
+} T_DjiTestDataPumpChannelStatistics;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode DjiTest_DataPumpInit(const T_DjiTestDataPumpBackend *backend, DjiTestDataPumpRecvCallback recvCallback);
+T_DjiReturnCode DjiTest_DataPumpDeInit(void);
+T_DjiReturnCode DjiTest_DataPumpEnableChannel(E_DjiChannelAddress channelAddress, uint16_t queueSize,
+                                              uint16_t frameSize);
+T_DjiReturnCode DjiTest_DataPumpSend(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len);
+T_DjiReturnCode DjiTest_DataPumpPushRecvData(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len);
+T_DjiReturnCode DjiTest_DataPumpGetStatistics(E_DjiChannelAddress channelAddress,
+                                              T_DjiTestDataPumpChannelStatistics *statistics);
+
+const T_DjiTestDataPumpBackend *DjiTest_DataPumpGetDefaultBackend(void);
+const T_DjiTestDataPumpBackend *DjiTest_DataPumpGetLoopbackBackend(uint32_t bandwidthLimitBytesPerSecond);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_DATA_TRANSMISSION_PUMP_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -26,6 +26,7 @@
 #include <utils/util_misc.h>
 #include <math.h>
 #include "test_fc_subscription.h"
+#include "test_fc_subscription_cache.h"
 #include "dji_logger.h"
 #include "dji_platform.h"
 #include "widget_interaction_test/test_widget_interaction.h"
@@ -60,36 +61,50 @@ T_DjiReturnCode DjiTest_FcSubscriptionStartService(void)
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
-    djiStat = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION, DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
-                                               DjiTest_FcSubscriptionReceiveQuaternionCallback);
+    djiStat = DjiTest_FcSubscriptionCacheInit();
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("init fc subscription cache error.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+
+    djiStat = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
+                                                   DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
+                                                   sizeof(T_DjiFcSubscriptionQuaternion),
+                                                   DjiTest_FcSubscriptionReceiveQuaternionCallback);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+        djiStat != DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
         USER_LOG_ERROR("Subscribe topic quaternion error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     } else {
         USER_LOG_DEBUG("Subscribe topic quaternion success.");
     }
 
-    djiStat = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY, DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
-                                               NULL);
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+    djiStat = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY, DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
+                                                   sizeof(T_DjiFcSubscriptionVelocity), NULL);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+        djiStat != DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
         USER_LOG_ERROR("Subscribe topic velocity error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     } else {
         USER_LOG_DEBUG("Subscribe topic velocity success.");
     }
 
-    djiStat = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION, DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
-                                               NULL);
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+    djiStat = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION,
+                                                   DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
+                                                   sizeof(T_DjiFcSubscriptionGpsPosition), NULL);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+        djiStat != DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
         USER_LOG_ERROR("Subscribe topic gps position error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     } else {
         USER_LOG_DEBUG("Subscribe topic gps position success.");
     }
 
-    djiStat = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_DETAILS, DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
-                                               NULL);
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+    djiStat = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_GPS_DETAILS,
+                                                   DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
+                                                   sizeof(T_DjiFcSubscriptionGpsDetails), NULL);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+        djiStat != DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
         USER_LOG_ERROR("Subscribe topic gps details error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     } else {
@@ -125,24 +140,37 @@ T_DjiReturnCode DjiTest_FcSubscriptionRunSample(void)
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
-    USER_LOG_INFO("--> Step 2: Subscribe the topics of quaternion, velocity and gps position");
-    djiStat = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION, DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
-                                               DjiTest_FcSubscriptionReceiveQuaternionCallback);
+    djiStat = DjiTest_FcSubscriptionCacheInit();
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("init fc subscription cache error.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+
+    // The topics go through the cache, which shares them with the subscription service and the other samples.
+    USER_LOG_INFO("--> Step 2: Subscribe the topics of quaternion, velocity and gps position");
+    djiStat = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
+                                                   DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
+                                                   sizeof(T_DjiFcSubscriptionQuaternion),
+                                                   DjiTest_FcSubscriptionReceiveQuaternionCallback);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+        djiStat != DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
         USER_LOG_ERROR("Subscribe topic quaternion error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
-    djiStat = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY, DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
-                                               NULL);
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+    djiStat = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY, DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
+                                                   sizeof(T_DjiFcSubscriptionVelocity), NULL);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+        djiStat != DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
         USER_LOG_ERROR("Subscribe topic velocity error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
-    djiStat = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION, DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
-                                               NULL);
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+    djiStat = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION,
+                                                   DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
+                                                   sizeof(T_DjiFcSubscriptionGpsPosition), NULL);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+        djiStat != DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
         USER_LOG_ERROR("Subscribe topic gps position error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
@@ -151,10 +179,10 @@ T_DjiReturnCode DjiTest_FcSubscriptionRunSample(void)
 
     for (int i = 0; i < 10; ++i) {
         osalHandler->TaskSleepMs(1000 / FC_SUBSCRIPTION_TASK_FREQ);
-        djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY,
-                                                          (uint8_t *) &velocity,
-                                                          sizeof(T_DjiFcSubscriptionVelocity),
-                                                          &timestamp);
+        djiStat = DjiTest_FcSubscriptionCacheGetLatestValue(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY,
+                                                            (uint8_t *) &velocity,
+                                                            sizeof(T_DjiFcSubscriptionVelocity),
+                                                            &timestamp);
         if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
             USER_LOG_ERROR("get value of topic velocity error.");
         } else {
@@ -163,10 +191,10 @@ T_DjiReturnCode DjiTest_FcSubscriptionRunSample(void)
                           velocity.data.z, velocity.health, timestamp.millisecond, timestamp.microsecond);
         }
 
-        djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION,
-                                                          (uint8_t *) &gpsPosition,
-                                                          sizeof(T_DjiFcSubscriptionGpsPosition),
-                                                          &timestamp);
+        djiStat = DjiTest_FcSubscriptionCacheGetLatestValue(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION,
+                                                            (uint8_t *) &gpsPosition,
+                                                            sizeof(T_DjiFcSubscriptionGpsPosition),
+                                                            &timestamp);
         if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
             USER_LOG_ERROR("get value of topic gps position error.");
         } else {
@@ -205,25 +233,30 @@ T_DjiReturnCode DjiTest_FcSubscriptionRunSample(void)
     }
 
     USER_LOG_INFO("--> Step 4: Unsubscribe the topics of quaternion, velocity and gps position");
-    djiStat = DjiFcSubscription_UnSubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION);
+    djiStat = DjiTest_FcSubscriptionCacheUnSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("UnSubscribe topic quaternion error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
-    djiStat = DjiFcSubscription_UnSubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY);
+    djiStat = DjiTest_FcSubscriptionCacheUnSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("UnSubscribe topic quaternion error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
-    djiStat = DjiFcSubscription_UnSubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION);
+    djiStat = DjiTest_FcSubscriptionCacheUnSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("UnSubscribe topic quaternion error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
     USER_LOG_INFO("--> Step 5: Deinit fc subscription module");
+    djiStat = DjiTest_FcSubscriptionCacheDeInit();
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Deinit fc subscription cache error.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
 
     djiStat = DjiFcSubscription_DeInit();
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -262,9 +295,13 @@ static void *UserFcSubscription_Task(void *arg)
 {
     T_DjiReturnCode djiStat;
     T_DjiFcSubscriptionVelocity velocity = {0};
-    T_DjiDataTimestamp timestamp = {0};
     T_DjiFcSubscriptionGpsPosition gpsPosition = {0};
     T_DjiFcSubscriptionGpsDetails gpsDetails = {0};
+    T_DjiTestFcSubscriptionCacheItem items[] = {
+        {DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY,     (uint8_t *) &velocity,    sizeof(velocity)},
+        {DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION, (uint8_t *) &gpsPosition, sizeof(gpsPosition)},
+        {DJI_FC_SUBSCRIPTION_TOPIC_GPS_DETAILS,  (uint8_t *) &gpsDetails,  sizeof(gpsDetails)},
+    };
     T_DjiOsalHandler *osalHandler = NULL;
 
     USER_UTIL_UNUSED(arg);
@@ -273,47 +310,23 @@ static void *UserFcSubscription_Task(void *arg)
     while (1) {
         osalHandler->TaskSleepMs(1000 / FC_SUBSCRIPTION_TASK_FREQ);
 
-        djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY,
-                                                          (uint8_t *) &velocity,
-                                                          sizeof(T_DjiFcSubscriptionVelocity),
-                                                          &timestamp);
+        // One snapshot of the cached topics instead of one sdk call per topic, the values belong to the same instant.
+        djiStat = DjiTest_FcSubscriptionCacheGetSnapshot(items, UTIL_ARRAY_SIZE(items));
         if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("get value of topic velocity error.");
+            USER_LOG_ERROR("get snapshot of topics velocity, gps position and gps details error: 0x%08llX.", djiStat);
+            continue;
         }
 
         if (s_userFcSubscriptionDataShow == true) {
             USER_LOG_INFO("velocity: x %f y %f z %f, healthFlag %d.", velocity.data.x, velocity.data.y,
                           velocity.data.z, velocity.health);
-        }
-
-        djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_POSITION,
-                                                          (uint8_t *) &gpsPosition,
-                                                          sizeof(T_DjiFcSubscriptionGpsPosition),
-                                                          &timestamp);
-        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("get value of topic gps position error.");
-        }
-
-        if (s_userFcSubscriptionDataShow == true) {
             USER_LOG_INFO("gps position: x %d y %d z %d.", gpsPosition.x, gpsPosition.y, gpsPosition.z);
-        }
-
-        djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_GPS_DETAILS,
-                                                          (uint8_t *) &gpsDetails,
-                                                          sizeof(T_DjiFcSubscriptionGpsDetails),
-                                                          &timestamp);
-        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("get value of topic gps details error.");
-        }
-
-        if (s_userFcSubscriptionDataShow == true) {
             USER_LOG_INFO("gps total satellite number used: %d %d %d.",
                           gpsDetails.gpsSatelliteNumberUsed,
                           gpsDetails.glonassSatelliteNumberUsed,
                           gpsDetails.totalSatelliteNumberUsed);
             s_totalSatelliteNumberUsed = gpsDetails.totalSatelliteNumberUsed;
         }
-
     }
 }
 
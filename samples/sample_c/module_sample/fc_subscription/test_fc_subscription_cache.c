@@ -0,0 +1,852 @@
+/**
+ ********************************************************************
+ * @file    test_fc_subscription_cache.c
+ * @brief
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "test_fc_subscription_cache.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "utils/util_misc.h"
+#include "utils/util_periodic.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_SNAPSHOT_RETRY_MAX           (64)
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_SNAPSHOT_YIELD_INTERVAL      (8)
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_READER_NUM_MAX     (4)
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM          (4)
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TASK_STACK_SIZE    (2048)
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_YIELD_INTERVAL     (256)
+
+/* Orders the slot sequence accesses against the copy of the slot data, the cache is shared by tasks without locks. */
+#if defined(__CC_ARM)
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_BARRIER()                    __dmb(0xF)
+#else
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_BARRIER()                    __sync_synchronize()
+#endif
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief A topic value protected by a sequence lock: the writer makes the sequence odd while it copies the value and
+ * even again when done, readers retry when they see an odd sequence or a sequence changed across their copy. Each
+ * topic must have a single writer, the subscription callback or the synthetic publisher. A topic subscribed outside
+ * the cache has no writer, its value is read from the sdk when a snapshot is taken.
+ */
+typedef struct {
+    volatile uint32_t sequence;
+    volatile bool isUsed;
+    E_DjiFcSubscriptionTopic topic;
+    uint32_t baseSequence;
+    uint16_t dataSize;
+    uint16_t bufferSize;
+    uint8_t *data;
+    T_DjiDataTimestamp timestamp;
+    DjiReceiveDataOfTopicCallback callback;
+    bool isSubscribed;
+    bool isReadFromSdk;
+    uint8_t referenceCount;
+} T_DjiTestFcSubscriptionCacheSlot;
+
+typedef struct {
+    uint8_t index;
+    uint32_t snapshotCount;
+    uint32_t retryCount;
+    uint32_t busyCount;
+    uint32_t tornCount;
+    uint32_t inconsistentCount;
+} T_DjiTestFcSubscriptionCacheBenchmarkReader;
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiTestFcSubscriptionCacheSlot *DjiTest_FcSubscriptionCacheFindSlot(E_DjiFcSubscriptionTopic topic);
+static int32_t DjiTest_FcSubscriptionCacheAllocSlot(E_DjiFcSubscriptionTopic topic, uint16_t dataSize,
+                                                    DjiReceiveDataOfTopicCallback callback);
+static void DjiTest_FcSubscriptionCacheWriteSlot(T_DjiTestFcSubscriptionCacheSlot *slot, const uint8_t *data,
+                                                 uint16_t dataSize, const T_DjiDataTimestamp *timestamp);
+static T_DjiReturnCode DjiTest_FcSubscriptionCacheReceiveTopic(uint8_t index, const uint8_t *data, uint16_t dataSize,
+                                                               const T_DjiDataTimestamp *timestamp);
+static T_DjiReturnCode DjiTest_FcSubscriptionCacheTakeSnapshot(T_DjiTestFcSubscriptionCacheItem *items,
+                                                               uint8_t itemCount, uint32_t *retryCount);
+static T_DjiReturnCode DjiTest_FcSubscriptionCacheReadFromSdk(T_DjiTestFcSubscriptionCacheItem *items,
+                                                              T_DjiTestFcSubscriptionCacheSlot **slots,
+                                                              uint8_t itemCount);
+static void *DjiTest_FcSubscriptionCacheBenchmarkPublisherTask(void *arg);
+static void *DjiTest_FcSubscriptionCacheBenchmarkReaderTask(void *arg);
+
+/* The subscription callback does not carry the topic, so every slot has its own callback. */
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(index)                                                       \
+static T_DjiReturnCode DjiTest_FcSubscriptionCacheCallback##index(const uint8_t *data, uint16_t dataSize,            \
+                                                                  const T_DjiDataTimestamp *timestamp)               \
+{                                                                                                                    \
+    return DjiTest_FcSubscriptionCacheReceiveTopic(index, data, dataSize, timestamp);                                \
+}
+
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(0)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(1)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(2)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(3)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(4)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(5)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(6)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(7)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(8)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(9)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(10)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(11)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(12)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(13)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(14)
+DJI_TEST_FC_SUBSCRIPTION_CACHE_DEFINE_CALLBACK(15)
+
+/* Private values -------------------------------------------------------------*/
+static const DjiReceiveDataOfTopicCallback s_cacheCallbacks[DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX] = {
+    DjiTest_FcSubscriptionCacheCallback0, DjiTest_FcSubscriptionCacheCallback1,
+    DjiTest_FcSubscriptionCacheCallback2, DjiTest_FcSubscriptionCacheCallback3,
+    DjiTest_FcSubscriptionCacheCallback4, DjiTest_FcSubscriptionCacheCallback5,
+    DjiTest_FcSubscriptionCacheCallback6, DjiTest_FcSubscriptionCacheCallback7,
+    DjiTest_FcSubscriptionCacheCallback8, DjiTest_FcSubscriptionCacheCallback9,
+    DjiTest_FcSubscriptionCacheCallback10, DjiTest_FcSubscriptionCacheCallback11,
+    DjiTest_FcSubscriptionCacheCallback12, DjiTest_FcSubscriptionCacheCallback13,
+    DjiTest_FcSubscriptionCacheCallback14, DjiTest_FcSubscriptionCacheCallback15,
+};
+
+static const struct {
+    E_DjiFcSubscriptionTopic topic;
+    uint16_t dataSize;
+} s_benchmarkTopics[DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM] = {
+    {DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,     sizeof(T_DjiFcSubscriptionQuaternion)},
+    {DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY,       sizeof(T_DjiFcSubscriptionVelocity)},
+    {DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED, sizeof(T_DjiFcSubscriptionPositionFused)},
+    {DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_FUSED, sizeof(T_DjiFcSubscriptionAltitudeFused)},
+};
+
+static T_DjiTestFcSubscriptionCacheSlot s_cacheSlots[DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX];
+/* Created by the first init and kept afterwards, it guards the init count, so init and deinit can race safely. */
+static T_DjiMutexHandle s_cacheMutex = NULL;
+static uint8_t s_cacheInitCount = 0;
+static T_DjiTestFcSubscriptionCacheStatistics s_cacheStatistics = {0};
+
+static volatile bool s_isBenchmarkRunning = false;
+static T_DjiSemaHandle s_benchmarkStopSema = NULL;
+static uint32_t s_benchmarkPublishFrequency = 0;
+static uint32_t s_benchmarkPublishCount = 0;
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Initialize the cache. Every module using the cache calls it and calls DjiTest_FcSubscriptionCacheDeInit
+ * when done, only the first call has an effect.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionCacheInit(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiMutexHandle mutex = NULL;
+    T_DjiReturnCode returnCode;
+
+    if (s_cacheMutex == NULL) {
+        returnCode = osalHandler->MutexCreate(&mutex);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Create fc subscription cache mutex error: 0x%08llX.", returnCode);
+            return returnCode;
+        }
+
+        // Two tasks may init the cache for the first time together, only one mutex is kept.
+        if (!__sync_bool_compare_and_swap(&s_cacheMutex, NULL, mutex)) {
+            osalHandler->MutexDestroy(mutex);
+        }
+    }
+
+    osalHandler->MutexLock(s_cacheMutex);
+    if (s_cacheInitCount == UINT8_MAX) {
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    if (s_cacheInitCount == 0) {
+        memset(s_cacheSlots, 0, sizeof(s_cacheSlots));
+        memset(&s_cacheStatistics, 0, sizeof(s_cacheStatistics));
+    }
+    s_cacheInitCount++;
+    osalHandler->MutexUnlock(s_cacheMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Release the cache once the last module using it called this. All the topics subscribed through the cache
+ * are unsubscribed then, readers must be stopped before.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionCacheDeInit(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+    uint8_t i;
+
+    if (s_cacheMutex == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    osalHandler->MutexLock(s_cacheMutex);
+    if (s_cacheInitCount == 0 || --s_cacheInitCount > 0) {
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX; i++) {
+        if (s_cacheSlots[i].isUsed == true && s_cacheSlots[i].isSubscribed == true) {
+            returnCode = DjiFcSubscription_UnSubscribeTopic(s_cacheSlots[i].topic);
+            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_WARN("Unsubscribe cached topic 0x%08X error: 0x%08llX.", s_cacheSlots[i].topic, returnCode);
+            }
+        }
+        s_cacheSlots[i].isUsed = false;
+        if (s_cacheSlots[i].data != NULL) {
+            osalHandler->Free(s_cacheSlots[i].data);
+            s_cacheSlots[i].data = NULL;
+        }
+    }
+    osalHandler->MutexUnlock(s_cacheMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Subscribe a topic and keep its latest value in the cache. Every successful call, duplicates included, must be
+ * balanced by DjiTest_FcSubscriptionCacheUnSubscribe, the topic is released with the last one.
+ * @note A topic already subscribed directly through the sdk is still cached, its value is then read from the sdk
+ * when a snapshot is taken and is not part of the consistent cut of the other topics.
+ * @param topic: topic to subscribe.
+ * @param frequency: subscription frequency.
+ * @param dataSize: size of the topic data structure.
+ * @param callback: optional callback, called on the subscription thread after the cache is updated.
+ * @return Execution result, DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE if the topic was already subscribed,
+ * through the cache or not: its value is available from the cache but the callback is not installed.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionCacheSubscribe(E_DjiFcSubscriptionTopic topic,
+                                                     E_DjiDataSubscriptionTopicFreq frequency,
+                                                     uint16_t dataSize, DjiReceiveDataOfTopicCallback callback)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionCacheSlot *slot;
+    T_DjiReturnCode returnCode;
+    int32_t index;
+
+    if (s_cacheMutex == NULL || dataSize == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    osalHandler->MutexLock(s_cacheMutex);
+    if (s_cacheInitCount == 0) {
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    slot = DjiTest_FcSubscriptionCacheFindSlot(topic);
+    if (slot != NULL) {
+        slot->referenceCount++;
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE;
+    }
+
+    index = DjiTest_FcSubscriptionCacheAllocSlot(topic, dataSize, callback);
+    if (index < 0) {
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    returnCode = DjiFcSubscription_SubscribeTopic(topic, frequency, s_cacheCallbacks[index]);
+    if (returnCode == DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
+        USER_LOG_WARN("Topic 0x%08X is subscribed outside the cache, its value is read from the sdk.", topic);
+        s_cacheSlots[index].isReadFromSdk = true;
+    } else if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_cacheSlots[index].isUsed = false;
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return returnCode;
+    } else {
+        s_cacheSlots[index].isSubscribed = true;
+    }
+    s_cacheSlots[index].referenceCount = 1;
+    osalHandler->MutexUnlock(s_cacheMutex);
+
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_FcSubscriptionCacheUnSubscribe(E_DjiFcSubscriptionTopic topic)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionCacheSlot *slot;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    if (s_cacheMutex == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    osalHandler->MutexLock(s_cacheMutex);
+    if (s_cacheInitCount == 0) {
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    slot = DjiTest_FcSubscriptionCacheFindSlot(topic);
+    if (slot == NULL) {
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_NOT_SUBSCRIBED;
+    }
+
+    if (slot->referenceCount > 1) {
+        slot->referenceCount--;
+        osalHandler->MutexUnlock(s_cacheMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    if (slot->isSubscribed == true) {
+        returnCode = DjiFcSubscription_UnSubscribeTopic(topic);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            osalHandler->MutexUnlock(s_cacheMutex);
+            return returnCode;
+        }
+    }
+
+    // The buffer is kept until deinit, a reader may still be copying from it.
+    slot->isUsed = false;
+    osalHandler->MutexUnlock(s_cacheMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Write a topic value into the cache, for topics fed by something else than the subscription, like the
+ * synthetic publisher. A topic must only be published from one task at a time.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionCachePublish(E_DjiFcSubscriptionTopic topic, const uint8_t *data,
+                                                   uint16_t dataSize, const T_DjiDataTimestamp *timestamp)
+{
+    T_DjiTestFcSubscriptionCacheSlot *slot = DjiTest_FcSubscriptionCacheFindSlot(topic);
+
+    if (slot == NULL) {
+        return DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_NOT_SUBSCRIBED;
+    }
+
+    DjiTest_FcSubscriptionCacheWriteSlot(slot, data, dataSize, timestamp);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_FcSubscriptionCacheGetLatestValue(E_DjiFcSubscriptionTopic topic, uint8_t *data,
+                                                          uint16_t dataSize, T_DjiDataTimestamp *timestamp)
+{
+    T_DjiTestFcSubscriptionCacheItem item = {0};
+    T_DjiReturnCode returnCode;
+
+    item.topic = topic;
+    item.data = data;
+    item.dataSize = dataSize;
+
+    returnCode = DjiTest_FcSubscriptionCacheGetSnapshot(&item, 1);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    if (timestamp != NULL) {
+        *timestamp = item.timestamp;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Copy the values of several topics as they were at one instant: no topic of the snapshot was updated while
+ * the values were copied. This does not cross into the SDK and takes no lock.
+ * @param items: topics to read and destination of the values.
+ * @param itemCount: number of items, at most DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_BUSY if the writers kept interleaving with the copy.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionCacheGetSnapshot(T_DjiTestFcSubscriptionCacheItem *items, uint8_t itemCount)
+{
+    T_DjiReturnCode returnCode;
+    uint32_t retryCount = 0;
+
+    returnCode = DjiTest_FcSubscriptionCacheTakeSnapshot(items, itemCount, &retryCount);
+
+    // Statistics are informative only, concurrent readers may lose an increment.
+    s_cacheStatistics.snapshotRetryCount += retryCount;
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_cacheStatistics.snapshotCount++;
+    } else if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY) {
+        s_cacheStatistics.snapshotBusyCount++;
+    }
+
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_FcSubscriptionCacheGetStatistics(T_DjiTestFcSubscriptionCacheStatistics *statistics)
+{
+    if (statistics == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    *statistics = s_cacheStatistics;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Measure the cache under contention without an aircraft. A synthetic publisher writes quaternion, velocity,
+ * fused position and fused altitude at the given frequency, the reader tasks take snapshots of the four topics in a
+ * loop and check that no value is torn and that the snapshot is a consistent cut of the publisher sequence.
+ * @note The benchmark topics must not be cached from the subscription at the same time.
+ * @param publishFrequency: publisher frequency, in Hz.
+ * @param readerCount: number of reader tasks, at most 4.
+ * @param durationMs: benchmark duration.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR if an inconsistent snapshot was seen.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionCacheRunBenchmark(uint32_t publishFrequency, uint8_t readerCount,
+                                                        uint32_t durationMs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionCacheBenchmarkReader readers[DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_READER_NUM_MAX];
+    T_DjiTaskHandle readerTasks[DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_READER_NUM_MAX] = {0};
+    T_DjiTaskHandle publisherTask = NULL;
+    T_DjiReturnCode returnCode;
+    uint32_t snapshotCount = 0;
+    uint32_t retryCount = 0;
+    uint32_t busyCount = 0;
+    uint32_t errorCount = 0;
+    uint32_t startTimeMs = 0;
+    uint32_t elapsedTimeMs = 0;
+    uint8_t createdReaderCount = 0;
+    uint8_t i;
+
+    if (publishFrequency == 0 || readerCount == 0 || readerCount > DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_READER_NUM_MAX
+        || durationMs == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    returnCode = DjiTest_FcSubscriptionCacheInit();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    osalHandler->MutexLock(s_cacheMutex);
+    for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM; i++) {
+        if (DjiTest_FcSubscriptionCacheFindSlot(s_benchmarkTopics[i].topic) != NULL) {
+            osalHandler->MutexUnlock(s_cacheMutex);
+            USER_LOG_ERROR("Topic 0x%08X is cached from the subscription, stop it before the benchmark.",
+                           s_benchmarkTopics[i].topic);
+            DjiTest_FcSubscriptionCacheDeInit();
+            return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+        }
+    }
+    for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM; i++) {
+        if (DjiTest_FcSubscriptionCacheAllocSlot(s_benchmarkTopics[i].topic, s_benchmarkTopics[i].dataSize,
+                                                 NULL) < 0) {
+            osalHandler->MutexUnlock(s_cacheMutex);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+            goto out;
+        }
+    }
+    osalHandler->MutexUnlock(s_cacheMutex);
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_benchmarkStopSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto out;
+    }
+
+    USER_LOG_INFO("Fc subscription cache benchmark: publisher %u Hz, %d readers, %u ms.", publishFrequency,
+                  readerCount, durationMs);
+    s_benchmarkPublishFrequency = publishFrequency;
+    s_benchmarkPublishCount = 0;
+    s_isBenchmarkRunning = true;
+
+    returnCode = osalHandler->TaskCreate("cache_publisher", DjiTest_FcSubscriptionCacheBenchmarkPublisherTask,
+                                         DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TASK_STACK_SIZE, NULL,
+                                         &publisherTask);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create cache publisher task error: 0x%08llX.", returnCode);
+        s_isBenchmarkRunning = false;
+        goto stop;
+    }
+
+    memset(readers, 0, sizeof(readers));
+    for (i = 0; i < readerCount; i++) {
+        readers[i].index = i;
+        returnCode = osalHandler->TaskCreate("cache_reader", DjiTest_FcSubscriptionCacheBenchmarkReaderTask,
+                                             DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TASK_STACK_SIZE, &readers[i],
+                                             &readerTasks[i]);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Create cache reader task error: 0x%08llX.", returnCode);
+            break;
+        }
+        createdReaderCount++;
+    }
+
+    osalHandler->GetTimeMs(&startTimeMs);
+    if (createdReaderCount == readerCount) {
+        osalHandler->TaskSleepMs(durationMs);
+    }
+    s_isBenchmarkRunning = false;
+
+stop:
+    // Every task posts once it left its loop, after that it only sleeps and can be destroyed safely.
+    for (i = 0; i < createdReaderCount + (publisherTask != NULL ? 1 : 0); i++) {
+        osalHandler->SemaphoreTimedWait(s_benchmarkStopSema, 1000);
+    }
+    osalHandler->GetTimeMs(&elapsedTimeMs);
+    elapsedTimeMs -= startTimeMs;
+    if (publisherTask != NULL) {
+        osalHandler->TaskDestroy(publisherTask);
+    }
+    for (i = 0; i < createdReaderCount; i++) {
+        osalHandler->TaskDestroy(readerTasks[i]);
+    }
+    osalHandler->SemaphoreDestroy(s_benchmarkStopSema);
+    s_benchmarkStopSema = NULL;
+
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS && elapsedTimeMs > 0) {
+        for (i = 0; i < createdReaderCount; i++) {
+            USER_LOG_INFO("Reader %d: %u snapshots (%u/s), %u retries, %u busy, %u torn, %u inconsistent.", i,
+                          readers[i].snapshotCount, (uint32_t) ((uint64_t) readers[i].snapshotCount * 1000 / elapsedTimeMs),
+                          readers[i].retryCount, readers[i].busyCount, readers[i].tornCount,
+                          readers[i].inconsistentCount);
+            snapshotCount += readers[i].snapshotCount;
+            retryCount += readers[i].retryCount;
+            busyCount += readers[i].busyCount;
+            errorCount += readers[i].tornCount + readers[i].inconsistentCount;
+        }
+        USER_LOG_INFO("Publisher: %u updates in %u ms, readers: %u snapshots, %u retries, %u busy.",
+                      s_benchmarkPublishCount, elapsedTimeMs, snapshotCount, retryCount, busyCount);
+        if (errorCount != 0) {
+            USER_LOG_ERROR("Fc subscription cache returned %u inconsistent snapshots.", errorCount);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        }
+    }
+
+out:
+    osalHandler->MutexLock(s_cacheMutex);
+    for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM; i++) {
+        T_DjiTestFcSubscriptionCacheSlot *slot = DjiTest_FcSubscriptionCacheFindSlot(s_benchmarkTopics[i].topic);
+        if (slot != NULL) {
+            slot->isUsed = false;
+        }
+    }
+    osalHandler->MutexUnlock(s_cacheMutex);
+    DjiTest_FcSubscriptionCacheDeInit();
+
+    return returnCode;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiTestFcSubscriptionCacheSlot *DjiTest_FcSubscriptionCacheFindSlot(E_DjiFcSubscriptionTopic topic)
+{
+    uint8_t i;
+
+    for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX; i++) {
+        if (s_cacheSlots[i].isUsed == true && s_cacheSlots[i].topic == topic) {
+            return &s_cacheSlots[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Called with the cache mutex held. */
+static int32_t DjiTest_FcSubscriptionCacheAllocSlot(E_DjiFcSubscriptionTopic topic, uint16_t dataSize,
+                                                    DjiReceiveDataOfTopicCallback callback)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionCacheSlot *slot = NULL;
+    int32_t index = -1;
+    int32_t i;
+
+    // Prefer a released slot whose buffer is large enough, buffers are only freed on deinit.
+    for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX; i++) {
+        if (s_cacheSlots[i].isUsed == false && s_cacheSlots[i].bufferSize >= dataSize) {
+            index = i;
+            break;
+        }
+    }
+    if (index < 0) {
+        for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX; i++) {
+            if (s_cacheSlots[i].isUsed == false && s_cacheSlots[i].data == NULL) {
+                index = i;
+                break;
+            }
+        }
+    }
+    if (index < 0) {
+        USER_LOG_ERROR("No free slot in fc subscription cache for topic 0x%08X.", topic);
+        return -1;
+    }
+
+    slot = &s_cacheSlots[index];
+    if (slot->data == NULL) {
+        slot->data = osalHandler->Malloc(dataSize);
+        if (slot->data == NULL) {
+            USER_LOG_ERROR("Malloc fc subscription cache slot error.");
+            return -1;
+        }
+        slot->bufferSize = dataSize;
+    }
+
+    memset(slot->data, 0, slot->bufferSize);
+    memset(&slot->timestamp, 0, sizeof(T_DjiDataTimestamp));
+    slot->topic = topic;
+    slot->dataSize = dataSize;
+    slot->callback = callback;
+    slot->isSubscribed = false;
+    slot->isReadFromSdk = false;
+    slot->referenceCount = 0;
+    slot->baseSequence = slot->sequence;
+
+    DJI_TEST_FC_SUBSCRIPTION_CACHE_BARRIER();
+    slot->isUsed = true;
+
+    return index;
+}
+
+static void DjiTest_FcSubscriptionCacheWriteSlot(T_DjiTestFcSubscriptionCacheSlot *slot, const uint8_t *data,
+                                                 uint16_t dataSize, const T_DjiDataTimestamp *timestamp)
+{
+    uint16_t copySize = USER_UTIL_MIN(dataSize, slot->dataSize);
+
+    slot->sequence++;
+    DJI_TEST_FC_SUBSCRIPTION_CACHE_BARRIER();
+
+    memcpy(slot->data, data, copySize);
+    if (timestamp != NULL) {
+        slot->timestamp = *timestamp;
+    }
+
+    DJI_TEST_FC_SUBSCRIPTION_CACHE_BARRIER();
+    slot->sequence++;
+}
+
+static T_DjiReturnCode DjiTest_FcSubscriptionCacheReceiveTopic(uint8_t index, const uint8_t *data, uint16_t dataSize,
+                                                               const T_DjiDataTimestamp *timestamp)
+{
+    T_DjiTestFcSubscriptionCacheSlot *slot = &s_cacheSlots[index];
+
+    if (slot->isUsed == false || data == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    DjiTest_FcSubscriptionCacheWriteSlot(slot, data, dataSize, timestamp);
+
+    if (slot->callback != NULL) {
+        return slot->callback(data, dataSize, timestamp);
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_FcSubscriptionCacheTakeSnapshot(T_DjiTestFcSubscriptionCacheItem *items,
+                                                               uint8_t itemCount, uint32_t *retryCount)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionCacheSlot *slots[DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX];
+    uint32_t sequences[DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX];
+    bool isConsistent;
+    uint32_t retry;
+    uint8_t i;
+
+    if (items == NULL || itemCount == 0 || itemCount > DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    for (i = 0; i < itemCount; i++) {
+        slots[i] = DjiTest_FcSubscriptionCacheFindSlot(items[i].topic);
+        if (slots[i] == NULL) {
+            return DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_NOT_SUBSCRIBED;
+        }
+    }
+
+    for (retry = 0; retry < DJI_TEST_FC_SUBSCRIPTION_CACHE_SNAPSHOT_RETRY_MAX; retry++) {
+        isConsistent = true;
+        for (i = 0; i < itemCount; i++) {
+            sequences[i] = slots[i]->sequence;
+            if (sequences[i] & 1) {
+                isConsistent = false;
+                break;
+            }
+        }
+
+        if (isConsistent) {
+            DJI_TEST_FC_SUBSCRIPTION_CACHE_BARRIER();
+            for (i = 0; i < itemCount; i++) {
+                memcpy(items[i].data, slots[i]->data, USER_UTIL_MIN(items[i].dataSize, slots[i]->dataSize));
+                items[i].timestamp = slots[i]->timestamp;
+            }
+            DJI_TEST_FC_SUBSCRIPTION_CACHE_BARRIER();
+
+            for (i = 0; i < itemCount; i++) {
+                if (slots[i]->sequence != sequences[i]) {
+                    isConsistent = false;
+                    break;
+                }
+            }
+        }
+
+        if (isConsistent) {
+            for (i = 0; i < itemCount; i++) {
+                items[i].updateCount = (sequences[i] - slots[i]->baseSequence) / 2;
+            }
+            return DjiTest_FcSubscriptionCacheReadFromSdk(items, slots, itemCount);
+        }
+
+        (*retryCount)++;
+        // A preempted writer can not finish while a higher priority reader spins, give it the cpu from time to time.
+        if ((retry + 1) % DJI_TEST_FC_SUBSCRIPTION_CACHE_SNAPSHOT_YIELD_INTERVAL == 0) {
+            osalHandler->TaskSleepMs(1);
+        }
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+}
+
+/* The topics subscribed outside the cache are not written to their slot, the sdk keeps their latest value. */
+static T_DjiReturnCode DjiTest_FcSubscriptionCacheReadFromSdk(T_DjiTestFcSubscriptionCacheItem *items,
+                                                              T_DjiTestFcSubscriptionCacheSlot **slots,
+                                                              uint8_t itemCount)
+{
+    T_DjiReturnCode returnCode;
+    uint8_t i;
+
+    for (i = 0; i < itemCount; i++) {
+        if (slots[i]->isReadFromSdk == false) {
+            continue;
+        }
+
+        returnCode = DjiFcSubscription_GetLatestValueOfTopic(items[i].topic, items[i].data, items[i].dataSize,
+                                                             &items[i].timestamp);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
+        items[i].updateCount = 0;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-noreturn"
+#pragma GCC diagnostic ignored "-Wreturn-type"
+#endif
+
+static void *DjiTest_FcSubscriptionCacheBenchmarkPublisherTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint8_t payload[sizeof(T_DjiFcSubscriptionPositionFused)];
+    T_DjiDataTimestamp timestamp = {0};
+    T_UtilPeriodic publishLoop;
+    uint64_t timeUs = 0;
+    uint8_t i;
+
+    USER_UTIL_UNUSED(arg);
+
+    UtilPeriodic_Init(&publishLoop, 1000000 / s_benchmarkPublishFrequency, NULL);
+    while (s_isBenchmarkRunning) {
+        // Every topic of one cycle carries the cycle counter in all its bytes, so readers can detect torn values
+        // and snapshots mixing cycles.
+        s_benchmarkPublishCount++;
+        memset(payload, (uint8_t) s_benchmarkPublishCount, sizeof(payload));
+        osalHandler->GetTimeUs(&timeUs);
+        timestamp.millisecond = (uint32_t) (timeUs / 1000);
+        timestamp.microsecond = (uint32_t) timeUs;
+
+        for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM; i++) {
+            DjiTest_FcSubscriptionCachePublish(s_benchmarkTopics[i].topic, payload, s_benchmarkTopics[i].dataSize,
+                                               &timestamp);
+        }
+
+        UtilPeriodic_WaitNextCycle(&publishLoop);
+    }
+
+    UtilPeriodic_PrintStatistics(&publishLoop, "cache publisher");
+    osalHandler->SemaphorePost(s_benchmarkStopSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+static void *DjiTest_FcSubscriptionCacheBenchmarkReaderTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionCacheBenchmarkReader *reader = (T_DjiTestFcSubscriptionCacheBenchmarkReader *) arg;
+    T_DjiTestFcSubscriptionCacheItem items[DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM];
+    uint8_t values[DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM][sizeof(T_DjiFcSubscriptionPositionFused)];
+    T_DjiReturnCode returnCode;
+    uint32_t retryCount;
+    uint8_t firstValue;
+    uint8_t value;
+    uint16_t j;
+    uint8_t i;
+
+    for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM; i++) {
+        items[i].topic = s_benchmarkTopics[i].topic;
+        items[i].data = values[i];
+        items[i].dataSize = s_benchmarkTopics[i].dataSize;
+    }
+
+    while (s_isBenchmarkRunning) {
+        retryCount = 0;
+        returnCode = DjiTest_FcSubscriptionCacheTakeSnapshot(items, DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM,
+                                                             &retryCount);
+        reader->retryCount += retryCount;
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            reader->busyCount++;
+            continue;
+        }
+        reader->snapshotCount++;
+
+        // Topics are published in order, a consistent snapshot sees the later ones at most one cycle behind.
+        firstValue = values[0][0];
+        for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_TOPIC_NUM; i++) {
+            value = values[i][0];
+            for (j = 1; j < items[i].dataSize; j++) {
+                if (values[i][j] != value) {
+                    reader->tornCount++;
+                    break;
+                }
+            }
+            if (value != firstValue && value != (uint8_t) (firstValue - 1)) {
+                reader->inconsistentCount++;
+            }
+        }
+
+        if (reader->snapshotCount % DJI_TEST_FC_SUBSCRIPTION_CACHE_BENCHMARK_YIELD_INTERVAL == 0) {
+            osalHandler->TaskSleepMs(1);
+        }
+    }
+
+    osalHandler->SemaphorePost(s_benchmarkStopSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,82 @@
+/**
+ ********************************************************************
+ * @file    test_fc_subscription_cache.h
+ * @brief   This is the header file for "test_fc_subscription_cache.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_FC_SUBSCRIPTION_CACHE_H
+#define TEST_FC_SUBSCRIPTION_CACHE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_fc_subscription.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_TEST_FC_SUBSCRIPTION_CACHE_TOPIC_NUM_MAX        (16)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief One topic of a snapshot. The caller fills topic, data and dataSize, the cache fills the value, its
+ * timestamp and the number of updates the topic had received when the snapshot was taken, 0 for a topic subscribed
+ * outside the cache.
+ */
+typedef struct {
+    E_DjiFcSubscriptionTopic topic;
+    uint8_t *data;
+    uint16_t dataSize;
+    T_DjiDataTimestamp timestamp;
+    uint32_t updateCount;
+} T_DjiTestFcSubscriptionCacheItem;
+
+typedef struct {
+    uint32_t snapshotCount;
+    uint32_t snapshotRetryCount;
+    uint32_t snapshotBusyCount;
+} T_DjiTestFcSubscriptionCacheStatistics;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode DjiTest_FcSubscriptionCacheInit(void);
+T_DjiReturnCode DjiTest_FcSubscriptionCacheDeInit(void);
+T_DjiReturnCode DjiTest_FcSubscriptionCacheSubscribe(E_DjiFcSubscriptionTopic topic,
+                                                     E_DjiDataSubscriptionTopicFreq frequency,
+                                                     uint16_t dataSize, DjiReceiveDataOfTopicCallback callback);
+T_DjiReturnCode DjiTest_FcSubscriptionCacheUnSubscribe(E_DjiFcSubscriptionTopic topic);
+T_DjiReturnCode DjiTest_FcSubscriptionCachePublish(E_DjiFcSubscriptionTopic topic, const uint8_t *data,
+                                                   uint16_t dataSize, const T_DjiDataTimestamp *timestamp);
+T_DjiReturnCode DjiTest_FcSubscriptionCacheGetLatestValue(E_DjiFcSubscriptionTopic topic, uint8_t *data,
+                                                          uint16_t dataSize, T_DjiDataTimestamp *timestamp);
+T_DjiReturnCode DjiTest_FcSubscriptionCacheGetSnapshot(T_DjiTestFcSubscriptionCacheItem *items, uint8_t itemCount);
+T_DjiReturnCode DjiTest_FcSubscriptionCacheGetStatistics(T_DjiTestFcSubscriptionCacheStatistics *statistics);
+T_DjiReturnCode DjiTest_FcSubscriptionCacheRunBenchmark(uint32_t publishFrequency, uint8_t readerCount,
+                                                        uint32_t durationMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_FC_SUBSCRIPTION_CACHE_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
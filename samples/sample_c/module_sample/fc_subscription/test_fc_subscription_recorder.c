@@ -0,0 +1,889 @@
+/**
+ ********************************************************************
+ * @file    test_fc_subscription_recorder.c
+ * @brief
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "test_fc_subscription_recorder.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "utils/util_misc.h"
+#include "utils/util_periodic.h"
+#include "utils/util_time.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_BLOCK_DURATION_MS         (1000)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_BLOCK_RECORD_NUM_MIN      (4)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_BUFFER_NUM                (2)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_TASK_STACK_SIZE           (2048)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_FLUSH_TIMEOUT_MS          (1000)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_STOP_TIMEOUT_MS           (5000)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_GENERATOR_PERIOD_US       (1000)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_DEFAULT_FREQ_MIN          (DJI_DATA_SUBSCRIPTION_TOPIC_200_HZ)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_GENERATOR_DATA_SIZE_MAX   (128)
+
+/*
+ * Every subscribable topic with its data structure, its maximum frequency and the layout of its data for the decoder.
+ * The subscription callback does not carry the topic, so a callback is generated per topic from this list.
+ */
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_LIST(ENTRY)                                                          \
+    ENTRY(QUATERNION, T_DjiFcSubscriptionQuaternion, 200, "q0:f,q1:f,q2:f,q3:f")                                     \
+    ENTRY(ACCELERATION_GROUND, T_DjiFcSubscriptionAccelerationGround, 200, "x:f,y:f,z:f")                            \
+    ENTRY(ACCELERATION_BODY, T_DjiFcSubscriptionAccelerationBody, 200, "x:f,y:f,z:f")                                \
+    ENTRY(ACCELERATION_RAW, T_DjiFcSubscriptionAccelerationRaw, 400, "x:f,y:f,z:f")                                  \
+    ENTRY(VELOCITY, T_DjiFcSubscriptionVelocity, 200, "x:f,y:f,z:f,health:B")                                        \
+    ENTRY(ANGULAR_RATE_FUSIONED, T_DjiFcSubscriptionAngularRateFusioned, 200, "x:f,y:f,z:f")                         \
+    ENTRY(ANGULAR_RATE_RAW, T_DjiFcSubscriptionAngularRateRaw, 400, "x:f,y:f,z:f")                                   \
+    ENTRY(ALTITUDE_FUSED, T_DjiFcSubscriptionAltitudeFused, 200, "altitude:f")                                       \
+    ENTRY(ALTITUDE_BAROMETER, T_DjiFcSubscriptionAltitudeBarometer, 200, "altitude:f")                               \
+    ENTRY(ALTITUDE_OF_HOMEPOINT, T_DjiFcSubscriptionAltitudeOfHomePoint, 1, "altitude:f")                            \
+    ENTRY(HEIGHT_FUSION, T_DjiFcSubscriptionHeightFusion, 100, "height:f")                                           \
+    ENTRY(HEIGHT_RELATIVE, T_DjiFcSubscriptionHeightRelative, 100, "height:f")                                       \
+    ENTRY(POSITION_FUSED, T_DjiFcSubscriptionPositionFused, 200,                                                     \
+          "longitude:d,latitude:d,altitude:f,visibleSatelliteNumber:H")                                              \
+    ENTRY(GPS_DATE, T_DjiFcSubscriptionGpsDate, 5, "date:I")                                                         \
+    ENTRY(GPS_TIME, T_DjiFcSubscriptionGpsTime, 5, "time:I")                                                         \
+    ENTRY(GPS_POSITION, T_DjiFcSubscriptionGpsPosition, 5, "x:i,y:i,z:i")                                            \
+    ENTRY(GPS_VELOCITY, T_DjiFcSubscriptionGpsVelocity, 5, "x:f,y:f,z:f")                                            \
+    ENTRY(GPS_DETAILS, T_DjiFcSubscriptionGpsDetails, 5,                                                             \
+          "hdop:f,pdop:f,fixState:f,vacc:f,hacc:f,sacc:f,gpsSatelliteNumberUsed:I,glonassSatelliteNumberUsed:I,"     \
+          "totalSatelliteNumberUsed:H,gpsCounter:H")                                                                 \
+    ENTRY(GPS_SIGNAL_LEVEL, T_DjiFcSubscriptionGpsSignalLevel, 50, "level:B")                                        \
+    ENTRY(RTK_POSITION, T_DjiFcSubscriptionRtkPosition, 5, "longitude:d,latitude:d,hfsl:f")                          \
+    ENTRY(RTK_VELOCITY, T_DjiFcSubscriptionRtkVelocity, 5, "x:f,y:f,z:f")                                            \
+    ENTRY(RTK_YAW, T_DjiFcSubscriptionRtkYaw, 5, "yaw:h")                                                            \
+    ENTRY(RTK_POSITION_INFO, T_DjiFcSubscriptionRtkPositionInfo, 5, "info:B")                                        \
+    ENTRY(RTK_YAW_INFO, T_DjiFcSubscriptionRtkYawInfo, 5, "info:B")                                                  \
+    ENTRY(COMPASS, T_DjiFcSubscriptionCompass, 100, "x:h,y:h,z:h")                                                   \
+    ENTRY(RC, T_DjiFcSubscriptionRC, 100, "roll:h,pitch:h,yaw:h,throttle:h,mode:h,gear:h")                           \
+    ENTRY(GIMBAL_ANGLES, T_DjiFcSubscriptionGimbalAngles, 50, "x:f,y:f,z:f")                                         \
+    ENTRY(GIMBAL_STATUS, T_DjiFcSubscriptionGimbalStatus, 50, "status:I")                                            \
+    ENTRY(STATUS_FLIGHT, T_DjiFcSubscriptionFlightStatus, 50, "status:B")                                            \
+    ENTRY(STATUS_DISPLAYMODE, T_DjiFcSubscriptionDisplaymode, 50, "mode:B")                                          \
+    ENTRY(STATUS_LANDINGGEAR, T_DjiFcSubscriptionLandinggear, 50, "status:B")                                        \
+    ENTRY(STATUS_MOTOR_START_ERROR, T_DjiFcSubscriptionMotorStartError, 50, "error:H")                               \
+    ENTRY(BATTERY_INFO, T_DjiFcSubscriptionWholeBatteryInfo, 50, "capacity:I,voltage:i,current:i,percentage:B")      \
+    ENTRY(CONTROL_DEVICE, T_DjiFcSubscriptionControlDevice, 50, "controlMode:B,status:B")                            \
+    ENTRY(HARD_SYNC, T_DjiFcSubscriptionHardSync, 400,                                                               \
+          "time2p5ms:I,time1ns:I,resetTime2p5ms:I,index:H,flag:B,q0:f,q1:f,q2:f,q3:f,ax:f,ay:f,az:f,"                \
+          "wx:f,wy:f,wz:f")                                                                                          \
+    ENTRY(GPS_CONTROL_LEVEL, T_DjiFcSubscriptionGpsControlLevel, 50, "level:B")                                      \
+    ENTRY(RC_WITH_FLAG_DATA, T_DjiFcSubscriptionRCWithFlagData, 50, "pitch:f,roll:f,yaw:f,throttle:f,flag:B")        \
+    ENTRY(ESC_DATA, T_DjiFcSubscriptionEscData, 50, "")                                                              \
+    ENTRY(RTK_CONNECT_STATUS, T_DjiFcSubscriptionRTKConnectStatus, 50, "status:H")                                   \
+    ENTRY(GIMBAL_CONTROL_MODE, T_DjiFcSubscriptionGimbalControlMode, 50, "mode:B")                                   \
+    ENTRY(FLIGHT_ANOMALY, T_DjiFcSubscriptionFlightAnomaly, 50, "flags:I")                                           \
+    ENTRY(POSITION_VO, T_DjiFcSubscriptionPositionVO, 50, "x:f,y:f,z:f,health:B")                                    \
+    ENTRY(AVOID_DATA, T_DjiFcSubscriptionAvoidData, 100, "down:f,front:f,right:f,back:f,left:f,up:f,health:B")       \
+    ENTRY(HOME_POINT_SET_STATUS, T_DjiFcSubscriptionHomePointSetStatus, 50, "status:B")                              \
+    ENTRY(HOME_POINT_INFO, T_DjiFcSubscriptionHomePointInfo, 50, "latitude:d,longitude:d")                           \
+    ENTRY(THREE_GIMBAL_DATA, T_DjiFcSubscriptionThreeGimbalData, 50,                                                 \
+          "roll0:f,pitch0:f,yaw0:f,roll1:f,pitch1:f,yaw1:f,roll2:f,pitch2:f,yaw2:f")                                 \
+    ENTRY(BATTERY_SINGLE_INFO_INDEX1, T_DjiFcSubscriptionSingleBatteryInfo, 1, "")                                   \
+    ENTRY(BATTERY_SINGLE_INFO_INDEX2, T_DjiFcSubscriptionSingleBatteryInfo, 1, "")                                   \
+    ENTRY(IMU_ATTI_NAVI_DATA_WITH_TIMESTAMP, T_DjiFcSubscriptionImuAttiNaviDataWithTimestamp, 100,                   \
+          "version:H,flag:H,pn_x:f,pn_y:f,pn_z:f,vn_x:f,vn_y:f,vn_z:f,an_x:f,an_y:f,an_z:f,q0:f,q1:f,q2:f,q3:f,"     \
+          "resv:H,cnt:H,timestamp:I")
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    E_DjiFcSubscriptionTopic topic;
+    const char *name;
+    uint16_t dataSize;
+    E_DjiDataSubscriptionTopicFreq maxFrequency;
+    const char *layout;
+    DjiReceiveDataOfTopicCallback callback;
+} T_DjiTestFcSubscriptionRecorderTopicInfo;
+
+/**
+ * @brief One block of a topic: the timestamp columns and the data column, each sized for the block capacity.
+ * The producer only writes a buffer that is not full, the flush task only reads a buffer that is full.
+ */
+typedef struct {
+    uint8_t *memory;
+    uint16_t recordCount;
+    uint32_t droppedCount;
+    bool isFull;
+} T_DjiTestFcSubscriptionRecorderBuffer;
+
+typedef struct {
+    bool isEnabled;
+    bool isSubscribed;
+    uint16_t topicIndex;
+    uint16_t dataSize;
+    uint16_t frequency;
+    uint16_t capacity;
+    T_DjiTestFcSubscriptionRecorderBuffer buffers[DJI_TEST_FC_SUBSCRIPTION_RECORDER_BUFFER_NUM];
+    uint8_t activeBuffer;
+    uint8_t flushBuffer;
+    uint32_t pendingDroppedCount;
+    uint32_t generatedCount;
+} T_DjiTestFcSubscriptionRecorderChannel;
+
+/* Private functions declaration ---------------------------------------------*/
+static const T_DjiTestFcSubscriptionRecorderTopicInfo *DjiTest_FcSubscriptionRecorderGetTopicInfo(
+    E_DjiFcSubscriptionTopic topic);
+static T_DjiReturnCode DjiTest_FcSubscriptionRecorderOpen(const char *filePath,
+                                                          const T_DjiTestFcSubscriptionRecorderTopic *topics,
+                                                          uint8_t topicCount, bool isSubscribed);
+static T_DjiReturnCode DjiTest_FcSubscriptionRecorderWriteFileHeader(void);
+static T_DjiReturnCode DjiTest_FcSubscriptionRecorderWrite(const void *data, uint32_t len);
+static void DjiTest_FcSubscriptionRecorderAppend(E_DjiFcSubscriptionTopic topic, const uint8_t *data,
+                                                 uint16_t dataSize, const T_DjiDataTimestamp *timestamp);
+static bool DjiTest_FcSubscriptionRecorderFlushOnce(void);
+static void DjiTest_FcSubscriptionRecorderSetWriteError(T_DjiReturnCode returnCode);
+static void DjiTest_FcSubscriptionRecorderReleaseChannels(void);
+static uint8_t DjiTest_FcSubscriptionRecorderGetDefaultTopics(T_DjiTestFcSubscriptionRecorderTopic *topics);
+static void *DjiTest_FcSubscriptionRecorderFlushTask(void *arg);
+static void *DjiTest_FcSubscriptionRecorderGeneratorTask(void *arg);
+
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_DEFINE_CALLBACK(topicName, dataType, maxFrequency, layout)                \
+static T_DjiReturnCode DjiTest_FcSubscriptionRecorderCallback_##topicName(const uint8_t *data, uint16_t dataSize,    \
+                                                                          const T_DjiDataTimestamp *timestamp)       \
+{                                                                                                                    \
+    DjiTest_FcSubscriptionRecorderAppend(DJI_FC_SUBSCRIPTION_TOPIC_##topicName, data, dataSize, timestamp);          \
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;                                                                     \
+}
+
+DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_LIST(DJI_TEST_FC_SUBSCRIPTION_RECORDER_DEFINE_CALLBACK)
+
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_INFO(topicName, dataType, maxFrequency, layout)                     \
+    {DJI_FC_SUBSCRIPTION_TOPIC_##topicName, #topicName, sizeof(dataType),                                            \
+     (E_DjiDataSubscriptionTopicFreq) (maxFrequency), layout, DjiTest_FcSubscriptionRecorderCallback_##topicName},
+
+/* Private values -------------------------------------------------------------*/
+static const T_DjiTestFcSubscriptionRecorderTopicInfo s_recorderTopicInfos[] = {
+    DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_LIST(DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_INFO)
+};
+
+static T_DjiTestFcSubscriptionRecorderChannel s_recorderChannels[DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_NUM_MAX];
+static uint8_t s_recorderChannelOrder[DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_NUM_MAX];
+static uint8_t s_recorderChannelCount = 0;
+static T_DjiFileHandle s_recorderFile = NULL;
+static T_DjiMutexHandle s_recorderMutex = NULL;
+static T_DjiSemaHandle s_recorderFlushSema = NULL;
+static T_DjiSemaHandle s_recorderStopSema = NULL;
+static T_DjiTaskHandle s_recorderFlushThread = NULL;
+static volatile bool s_isRecording = false;
+static volatile bool s_isRecorderStopping = false;
+static T_DjiTestFcSubscriptionRecorderStatistics s_recorderStatistics = {0};
+static T_DjiReturnCode s_recorderWriteReturnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+static volatile bool s_isGeneratorRunning = false;
+static T_DjiSemaHandle s_generatorStopSema = NULL;
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Subscribe the given topics and record them into a binary file until the recorder is stopped.
+ * @note Records are appended to preallocated per-topic blocks on the subscription thread, blocks are written to the
+ * file by a background task, so recording does not slow down the subscription callbacks. Records arriving while both
+ * blocks of a topic wait for the file are dropped and counted in the next block.
+ * @param filePath: recording file, overwritten if it exists.
+ * @param topics: topics to record, each topic at most once.
+ * @param topicCount: number of topics.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderStart(const char *filePath,
+                                                    const T_DjiTestFcSubscriptionRecorderTopic *topics,
+                                                    uint8_t topicCount)
+{
+    return DjiTest_FcSubscriptionRecorderOpen(filePath, topics, topicCount, true);
+}
+
+/**
+ * @brief Unsubscribe the recorded topics, write the partially filled blocks and close the recording file.
+ * @return Execution result, the error of the first failed write or sync of the recording if any.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderStop(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiFileSystemHandler *fileSystemHandler = DjiPlatform_GetFileSystemHandler();
+    T_DjiTestFcSubscriptionRecorderChannel *channel;
+    T_DjiTestFcSubscriptionRecorderBuffer *buffer;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    uint8_t i;
+
+    if (s_recorderFile == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    for (i = 0; i < s_recorderChannelCount; i++) {
+        channel = &s_recorderChannels[s_recorderChannelOrder[i]];
+        if (channel->isSubscribed == true) {
+            if (DjiFcSubscription_UnSubscribeTopic((E_DjiFcSubscriptionTopic) s_recorderChannelOrder[i]) !=
+                DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_WARN("Unsubscribe recorded topic %s error.",
+                              s_recorderTopicInfos[s_recorderChannelOrder[i]].name);
+            }
+            channel->isSubscribed = false;
+        }
+    }
+
+    // Hand the partially filled blocks over to the flush task, it exits once every full block is written.
+    osalHandler->MutexLock(s_recorderMutex);
+    s_isRecording = false;
+    for (i = 0; i < s_recorderChannelCount; i++) {
+        channel = &s_recorderChannels[s_recorderChannelOrder[i]];
+        buffer = &channel->buffers[channel->activeBuffer];
+        if (buffer->isFull == false && (buffer->recordCount > 0 || channel->pendingDroppedCount > 0)) {
+            buffer->droppedCount = channel->pendingDroppedCount;
+            channel->pendingDroppedCount = 0;
+            buffer->isFull = true;
+        }
+    }
+    s_isRecorderStopping = true;
+    osalHandler->MutexUnlock(s_recorderMutex);
+    osalHandler->SemaphorePost(s_recorderFlushSema);
+
+    if (osalHandler->SemaphoreTimedWait(s_recorderStopSema, DJI_TEST_FC_SUBSCRIPTION_RECORDER_STOP_TIMEOUT_MS) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Wait recorder flush task timeout, the recording may be truncated.");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    osalHandler->TaskDestroy(s_recorderFlushThread);
+    s_recorderFlushThread = NULL;
+
+    if (fileSystemHandler->FileSync(s_recorderFile) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Sync recording file error.");
+        DjiTest_FcSubscriptionRecorderSetWriteError(DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR);
+    }
+    if (fileSystemHandler->FileClose(s_recorderFile) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Close recording file error.");
+        DjiTest_FcSubscriptionRecorderSetWriteError(DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR);
+    }
+    s_recorderFile = NULL;
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        returnCode = s_recorderWriteReturnCode;
+    }
+
+    osalHandler->SemaphoreDestroy(s_recorderStopSema);
+    osalHandler->SemaphoreDestroy(s_recorderFlushSema);
+    osalHandler->MutexDestroy(s_recorderMutex);
+    s_recorderStopSema = NULL;
+    s_recorderFlushSema = NULL;
+    s_recorderMutex = NULL;
+    DjiTest_FcSubscriptionRecorderReleaseChannels();
+
+    USER_LOG_INFO("Recorder stopped: %u records, %u dropped, %u blocks, %u bytes, %u write errors, max flush %u ms.",
+                  s_recorderStatistics.recordCount, s_recorderStatistics.droppedCount,
+                  s_recorderStatistics.blockCount, s_recorderStatistics.writtenBytes,
+                  s_recorderStatistics.writeErrorCount, s_recorderStatistics.maxFlushTimeMs);
+
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderGetStatistics(T_DjiTestFcSubscriptionRecorderStatistics *statistics)
+{
+    if (statistics == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    *statistics = s_recorderStatistics;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Record every topic with a maximum frequency of 200Hz or more from the aircraft for a while.
+ * @param filePath: recording file.
+ * @param durationMs: recording duration.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderRunSample(const char *filePath, uint32_t durationMs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionRecorderTopic topics[DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_NUM_MAX];
+    T_DjiReturnCode returnCode;
+    uint8_t topicCount;
+
+    USER_LOG_INFO("Fc subscription recorder sample start");
+
+    USER_LOG_INFO("--> Step 1: Init fc subscription module");
+    returnCode = DjiFcSubscription_Init();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("init data subscription module error.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+
+    USER_LOG_INFO("--> Step 2: Record the high rate topics into %s for %u ms", filePath, durationMs);
+    topicCount = DjiTest_FcSubscriptionRecorderGetDefaultTopics(topics);
+    returnCode = DjiTest_FcSubscriptionRecorderStart(filePath, topics, topicCount);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Start recorder error: 0x%08llX.", returnCode);
+        goto out;
+    }
+
+    osalHandler->TaskSleepMs(durationMs);
+
+    USER_LOG_INFO("--> Step 3: Stop recording, convert the file with fc_recorder2csv");
+    returnCode = DjiTest_FcSubscriptionRecorderStop();
+
+out:
+    USER_LOG_INFO("--> Step 4: Deinit fc subscription module");
+    if (DjiFcSubscription_DeInit() != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Deinit fc subscription error.");
+    }
+
+    USER_LOG_INFO("Fc subscription recorder sample end");
+
+    return returnCode;
+}
+
+/**
+ * @brief Record the topics of 200Hz or more from a synthetic generator instead of the aircraft, to check that the
+ * recorder keeps up with all of them at once and to measure its cpu cost.
+ * @param filePath: recording file.
+ * @param durationMs: benchmark duration.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR if records were dropped or lost.
+ */
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderRunBenchmark(const char *filePath, uint32_t durationMs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionRecorderTopic topics[DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_NUM_MAX];
+    T_DjiTaskHandle generatorThread = NULL;
+    T_DjiReturnCode returnCode;
+    uint32_t generatedCount = 0;
+    uint8_t topicCount;
+    uint8_t i;
+#ifdef SYSTEM_ARCH_LINUX
+    T_DjiRunTimeStamps startRunTimeStamps;
+    T_DjiRunTimeStamps endRunTimeStamps;
+#endif
+
+    topicCount = DjiTest_FcSubscriptionRecorderGetDefaultTopics(topics);
+    returnCode = DjiTest_FcSubscriptionRecorderOpen(filePath, topics, topicCount, false);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Open recorder error: 0x%08llX.", returnCode);
+        return returnCode;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_generatorStopSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        DjiTest_FcSubscriptionRecorderStop();
+        return returnCode;
+    }
+
+    USER_LOG_INFO("Fc subscription recorder benchmark: %d synthetic topics for %u ms.", topicCount, durationMs);
+#ifdef SYSTEM_ARCH_LINUX
+    startRunTimeStamps = DjiUtilTime_GetRunTimeStamps();
+#endif
+
+    s_isGeneratorRunning = true;
+    returnCode = osalHandler->TaskCreate("recorder_generator", DjiTest_FcSubscriptionRecorderGeneratorTask,
+                                         DJI_TEST_FC_SUBSCRIPTION_RECORDER_TASK_STACK_SIZE, NULL, &generatorThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create recorder generator task error: 0x%08llX.", returnCode);
+        s_isGeneratorRunning = false;
+    } else {
+        osalHandler->TaskSleepMs(durationMs);
+        s_isGeneratorRunning = false;
+        osalHandler->SemaphoreTimedWait(s_generatorStopSema, DJI_TEST_FC_SUBSCRIPTION_RECORDER_STOP_TIMEOUT_MS);
+        osalHandler->TaskDestroy(generatorThread);
+    }
+    osalHandler->SemaphoreDestroy(s_generatorStopSema);
+    s_generatorStopSema = NULL;
+
+    for (i = 0; i < s_recorderChannelCount; i++) {
+        generatedCount += s_recorderChannels[s_recorderChannelOrder[i]].generatedCount;
+    }
+
+    if (DjiTest_FcSubscriptionRecorderStop() != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+#ifdef SYSTEM_ARCH_LINUX
+    endRunTimeStamps = DjiUtilTime_GetRunTimeStamps();
+    if (endRunTimeStamps.realUsec > startRunTimeStamps.realUsec) {
+        USER_LOG_INFO("Process cpu usage while recording: %.2f%%.",
+                      (dji_f64_t) (endRunTimeStamps.userUsec - startRunTimeStamps.userUsec +
+                                   endRunTimeStamps.sysUsec - startRunTimeStamps.sysUsec) * 100 /
+                      (dji_f64_t) (endRunTimeStamps.realUsec - startRunTimeStamps.realUsec));
+    }
+#endif
+
+    USER_LOG_INFO("Generated %u records, recorded %u, dropped %u.", generatedCount,
+                  s_recorderStatistics.recordCount, s_recorderStatistics.droppedCount);
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+        (s_recorderStatistics.droppedCount != 0 || s_recorderStatistics.recordCount != generatedCount)) {
+        USER_LOG_ERROR("Recorder did not keep up with the synthetic topics.");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    return returnCode;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static const T_DjiTestFcSubscriptionRecorderTopicInfo *DjiTest_FcSubscriptionRecorderGetTopicInfo(
+    E_DjiFcSubscriptionTopic topic)
+{
+    if ((uint32_t) topic >= UTIL_ARRAY_SIZE(s_recorderTopicInfos) || s_recorderTopicInfos[topic].topic != topic) {
+        return NULL;
+    }
+
+    return &s_recorderTopicInfos[topic];
+}
+
+static T_DjiReturnCode DjiTest_FcSubscriptionRecorderOpen(const char *filePath,
+                                                          const T_DjiTestFcSubscriptionRecorderTopic *topics,
+                                                          uint8_t topicCount, bool isSubscribed)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiFileSystemHandler *fileSystemHandler = DjiPlatform_GetFileSystemHandler();
+    const T_DjiTestFcSubscriptionRecorderTopicInfo *topicInfo;
+    T_DjiTestFcSubscriptionRecorderChannel *channel;
+    T_DjiReturnCode returnCode;
+    uint32_t bufferSize;
+    uint8_t i;
+    uint8_t j;
+
+    if (filePath == NULL || topics == NULL || topicCount == 0 ||
+        topicCount > DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_NUM_MAX) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_recorderFile != NULL) {
+        USER_LOG_ERROR("Recorder is already running.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    if (fileSystemHandler == NULL || fileSystemHandler->FileOpen == NULL) {
+        USER_LOG_ERROR("File system handler is not registered, can not record.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    memset(s_recorderChannels, 0, sizeof(s_recorderChannels));
+    memset(&s_recorderStatistics, 0, sizeof(s_recorderStatistics));
+    s_recorderWriteReturnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    s_recorderChannelCount = 0;
+
+    for (i = 0; i < topicCount; i++) {
+        topicInfo = DjiTest_FcSubscriptionRecorderGetTopicInfo(topics[i].topic);
+        if (topicInfo == NULL || s_recorderChannels[topics[i].topic].isEnabled == true) {
+            USER_LOG_ERROR("Invalid or duplicated topic 0x%08X to record.", topics[i].topic);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+            goto free;
+        }
+
+        channel = &s_recorderChannels[topics[i].topic];
+        channel->isEnabled = true;
+        channel->topicIndex = i;
+        channel->dataSize = topicInfo->dataSize;
+        channel->frequency = topics[i].frequency != 0 ? topics[i].frequency : topicInfo->maxFrequency;
+        channel->capacity = USER_UTIL_MAX(DJI_TEST_FC_SUBSCRIPTION_RECORDER_BLOCK_RECORD_NUM_MIN,
+                                          channel->frequency * DJI_TEST_FC_SUBSCRIPTION_RECORDER_BLOCK_DURATION_MS /
+                                          1000);
+        s_recorderChannelOrder[s_recorderChannelCount++] = (uint8_t) topics[i].topic;
+
+        bufferSize = channel->capacity * (2 * sizeof(uint32_t) + channel->dataSize);
+        for (j = 0; j < DJI_TEST_FC_SUBSCRIPTION_RECORDER_BUFFER_NUM; j++) {
+            channel->buffers[j].memory = osalHandler->Malloc(bufferSize);
+            if (channel->buffers[j].memory == NULL) {
+                USER_LOG_ERROR("Malloc recorder buffer of topic %s error.", topicInfo->name);
+                returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+                goto free;
+            }
+        }
+    }
+
+    returnCode = fileSystemHandler->FileOpen(filePath, "wb+", &s_recorderFile);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Open recording file %s error: 0x%08llX.", filePath, returnCode);
+        s_recorderFile = NULL;
+        goto free;
+    }
+
+    returnCode = DjiTest_FcSubscriptionRecorderWriteFileHeader();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto close;
+    }
+
+    returnCode = osalHandler->MutexCreate(&s_recorderMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto close;
+    }
+    returnCode = osalHandler->SemaphoreCreate(0, &s_recorderFlushSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto destroyMutex;
+    }
+    returnCode = osalHandler->SemaphoreCreate(0, &s_recorderStopSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto destroyFlushSema;
+    }
+
+    s_isRecorderStopping = false;
+    returnCode = osalHandler->TaskCreate("recorder_flush", DjiTest_FcSubscriptionRecorderFlushTask,
+                                         DJI_TEST_FC_SUBSCRIPTION_RECORDER_TASK_STACK_SIZE, NULL,
+                                         &s_recorderFlushThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create recorder flush task error: 0x%08llX.", returnCode);
+        goto destroyStopSema;
+    }
+
+    s_isRecording = true;
+
+    if (isSubscribed == true) {
+        for (i = 0; i < s_recorderChannelCount; i++) {
+            channel = &s_recorderChannels[s_recorderChannelOrder[i]];
+            topicInfo = &s_recorderTopicInfos[s_recorderChannelOrder[i]];
+            returnCode = DjiFcSubscription_SubscribeTopic(topicInfo->topic,
+                                                          (E_DjiDataSubscriptionTopicFreq) channel->frequency,
+                                                          topicInfo->callback);
+            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                // The topic stays in the file without blocks, the other topics are still worth recording.
+                USER_LOG_WARN("Subscribe topic %s at %d Hz for recording error: 0x%08llX.", topicInfo->name,
+                              channel->frequency, returnCode);
+                continue;
+            }
+            channel->isSubscribed = true;
+        }
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+destroyStopSema:
+    osalHandler->SemaphoreDestroy(s_recorderStopSema);
+    s_recorderStopSema = NULL;
+destroyFlushSema:
+    osalHandler->SemaphoreDestroy(s_recorderFlushSema);
+    s_recorderFlushSema = NULL;
+destroyMutex:
+    osalHandler->MutexDestroy(s_recorderMutex);
+    s_recorderMutex = NULL;
+close:
+    fileSystemHandler->FileClose(s_recorderFile);
+    s_recorderFile = NULL;
+free:
+    DjiTest_FcSubscriptionRecorderReleaseChannels();
+    return returnCode;
+}
+
+static T_DjiReturnCode DjiTest_FcSubscriptionRecorderWriteFileHeader(void)
+{
+    T_DjiTestFcSubscriptionRecorderFileHeader fileHeader = {0};
+    T_DjiTestFcSubscriptionRecorderTopicDescriptor descriptor = {0};
+    const T_DjiTestFcSubscriptionRecorderTopicInfo *topicInfo;
+    T_DjiReturnCode returnCode;
+    uint8_t i;
+
+    memcpy(fileHeader.magic, DJI_TEST_FC_SUBSCRIPTION_RECORDER_FILE_MAGIC, sizeof(fileHeader.magic));
+    fileHeader.version = DJI_TEST_FC_SUBSCRIPTION_RECORDER_FILE_VERSION;
+    fileHeader.topicCount = s_recorderChannelCount;
+    returnCode = DjiTest_FcSubscriptionRecorderWrite(&fileHeader, sizeof(fileHeader));
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    for (i = 0; i < s_recorderChannelCount; i++) {
+        topicInfo = &s_recorderTopicInfos[s_recorderChannelOrder[i]];
+        descriptor.topic = topicInfo->topic;
+        descriptor.dataSize = topicInfo->dataSize;
+        descriptor.frequency = s_recorderChannels[s_recorderChannelOrder[i]].frequency;
+        descriptor.nameLength = (uint8_t) strlen(topicInfo->name);
+        descriptor.layoutLength = (uint8_t) strlen(topicInfo->layout);
+
+        returnCode = DjiTest_FcSubscriptionRecorderWrite(&descriptor, sizeof(descriptor));
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            returnCode = DjiTest_FcSubscriptionRecorderWrite(topicInfo->name, descriptor.nameLength);
+        }
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            returnCode = DjiTest_FcSubscriptionRecorderWrite(topicInfo->layout, descriptor.layoutLength);
+        }
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_FcSubscriptionRecorderWrite(const void *data, uint32_t len)
+{
+    T_DjiReturnCode returnCode;
+    uint32_t realLen = 0;
+
+    if (len == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    returnCode = DjiPlatform_GetFileSystemHandler()->FileWrite(s_recorderFile, (const uint8_t *) data, len, &realLen);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS || realLen != len) {
+        USER_LOG_ERROR("Write recording file error, %u of %u bytes written.", realLen, len);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    s_recorderStatistics.writtenBytes += len;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void DjiTest_FcSubscriptionRecorderAppend(E_DjiFcSubscriptionTopic topic, const uint8_t *data,
+                                                 uint16_t dataSize, const T_DjiDataTimestamp *timestamp)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionRecorderChannel *channel = &s_recorderChannels[topic];
+    T_DjiTestFcSubscriptionRecorderBuffer *buffer;
+    uint32_t *millisecondColumn;
+    uint32_t *microsecondColumn;
+    uint8_t *dataColumn;
+    bool isBlockFull = false;
+
+    if (s_isRecording == false || channel->isEnabled == false || data == NULL) {
+        return;
+    }
+
+    osalHandler->MutexLock(s_recorderMutex);
+    if (s_isRecording == false) {
+        osalHandler->MutexUnlock(s_recorderMutex);
+        return;
+    }
+
+    buffer = &channel->buffers[channel->activeBuffer];
+    if (buffer->isFull == true) {
+        channel->pendingDroppedCount++;
+        s_recorderStatistics.droppedCount++;
+        osalHandler->MutexUnlock(s_recorderMutex);
+        return;
+    }
+
+    millisecondColumn = (uint32_t *) buffer->memory;
+    microsecondColumn = millisecondColumn + channel->capacity;
+    dataColumn = (uint8_t *) (microsecondColumn + channel->capacity);
+
+    millisecondColumn[buffer->recordCount] = timestamp != NULL ? timestamp->millisecond : 0;
+    microsecondColumn[buffer->recordCount] = timestamp != NULL ? timestamp->microsecond : 0;
+    memcpy(&dataColumn[buffer->recordCount * channel->dataSize], data, USER_UTIL_MIN(dataSize, channel->dataSize));
+    if (dataSize < channel->dataSize) {
+        memset(&dataColumn[buffer->recordCount * channel->dataSize + dataSize], 0, channel->dataSize - dataSize);
+    }
+    buffer->recordCount++;
+    s_recorderStatistics.recordCount++;
+
+    if (buffer->recordCount == channel->capacity) {
+        buffer->droppedCount = channel->pendingDroppedCount;
+        channel->pendingDroppedCount = 0;
+        buffer->isFull = true;
+        channel->activeBuffer = (channel->activeBuffer + 1) % DJI_TEST_FC_SUBSCRIPTION_RECORDER_BUFFER_NUM;
+        isBlockFull = true;
+    }
+    osalHandler->MutexUnlock(s_recorderMutex);
+
+    if (isBlockFull) {
+        osalHandler->SemaphorePost(s_recorderFlushSema);
+    }
+}
+
+/* Write the oldest full block of every topic, returns true if a block was written. */
+static bool DjiTest_FcSubscriptionRecorderFlushOnce(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionRecorderBlockHeader blockHeader;
+    T_DjiTestFcSubscriptionRecorderChannel *channel;
+    T_DjiTestFcSubscriptionRecorderBuffer *buffer;
+    T_DjiReturnCode returnCode;
+    uint32_t *millisecondColumn;
+    uint32_t startTimeMs = 0;
+    uint32_t endTimeMs = 0;
+    bool isFull;
+    bool isWritten = false;
+    uint8_t i;
+
+    for (i = 0; i < s_recorderChannelCount; i++) {
+        channel = &s_recorderChannels[s_recorderChannelOrder[i]];
+        buffer = &channel->buffers[channel->flushBuffer];
+
+        osalHandler->MutexLock(s_recorderMutex);
+        isFull = buffer->isFull;
+        osalHandler->MutexUnlock(s_recorderMutex);
+        if (isFull == false) {
+            continue;
+        }
+
+        // The producer does not touch a full buffer, the block is written without holding the lock.
+        osalHandler->GetTimeMs(&startTimeMs);
+        blockHeader.syncWord = DJI_TEST_FC_SUBSCRIPTION_RECORDER_BLOCK_SYNC_WORD;
+        blockHeader.topicIndex = channel->topicIndex;
+        blockHeader.recordCount = buffer->recordCount;
+        blockHeader.droppedCount = buffer->droppedCount;
+        millisecondColumn = (uint32_t *) buffer->memory;
+
+        returnCode = DjiTest_FcSubscriptionRecorderWrite(&blockHeader, sizeof(blockHeader));
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            returnCode = DjiTest_FcSubscriptionRecorderWrite(millisecondColumn,
+                                                             buffer->recordCount * sizeof(uint32_t));
+        }
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            returnCode = DjiTest_FcSubscriptionRecorderWrite(millisecondColumn + channel->capacity,
+                                                             buffer->recordCount * sizeof(uint32_t));
+        }
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            returnCode = DjiTest_FcSubscriptionRecorderWrite(millisecondColumn + 2 * channel->capacity,
+                                                             buffer->recordCount * channel->dataSize);
+        }
+        osalHandler->GetTimeMs(&endTimeMs);
+        if (endTimeMs - startTimeMs > s_recorderStatistics.maxFlushTimeMs) {
+            s_recorderStatistics.maxFlushTimeMs = endTimeMs - startTimeMs;
+        }
+        // The block is released either way so the recording goes on, the converter stops at the failed block.
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            s_recorderStatistics.blockCount++;
+        } else {
+            DjiTest_FcSubscriptionRecorderSetWriteError(returnCode);
+        }
+
+        osalHandler->MutexLock(s_recorderMutex);
+        buffer->recordCount = 0;
+        buffer->droppedCount = 0;
+        buffer->isFull = false;
+        channel->flushBuffer = (channel->flushBuffer + 1) % DJI_TEST_FC_SUBSCRIPTION_RECORDER_BUFFER_NUM;
+        osalHandler->MutexUnlock(s_recorderMutex);
+        isWritten = true;
+    }
+
+    return isWritten;
+}
+
+/* Count a failed write, the first error is returned by the stop. */
+static void DjiTest_FcSubscriptionRecorderSetWriteError(T_DjiReturnCode returnCode)
+{
+    s_recorderStatistics.writeErrorCount++;
+    if (s_recorderWriteReturnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_recorderWriteReturnCode = returnCode;
+    }
+}
+
+static void DjiTest_FcSubscriptionRecorderReleaseChannels(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_NUM_MAX; i++) {
+        for (j = 0; j < DJI_TEST_FC_SUBSCRIPTION_RECORDER_BUFFER_NUM; j++) {
+            if (s_recorderChannels[i].buffers[j].memory != NULL) {
+                osalHandler->Free(s_recorderChannels[i].buffers[j].memory);
+                s_recorderChannels[i].buffers[j].memory = NULL;
+            }
+        }
+        s_recorderChannels[i].isEnabled = false;
+    }
+}
+
+static uint8_t DjiTest_FcSubscriptionRecorderGetDefaultTopics(T_DjiTestFcSubscriptionRecorderTopic *topics)
+{
+    uint8_t topicCount = 0;
+    uint8_t i;
+
+    for (i = 0; i < UTIL_ARRAY_SIZE(s_recorderTopicInfos); i++) {
+        if (s_recorderTopicInfos[i].maxFrequency >= DJI_TEST_FC_SUBSCRIPTION_RECORDER_DEFAULT_FREQ_MIN) {
+            topics[topicCount].topic = s_recorderTopicInfos[i].topic;
+            topics[topicCount].frequency = s_recorderTopicInfos[i].maxFrequency;
+            topicCount++;
+        }
+    }
+
+    return topicCount;
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-noreturn"
+#pragma GCC diagnostic ignored "-Wreturn-type"
+#endif
+
+static void *DjiTest_FcSubscriptionRecorderFlushTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    bool isStopping;
+
+    USER_UTIL_UNUSED(arg);
+
+    while (1) {
+        osalHandler->SemaphoreTimedWait(s_recorderFlushSema, DJI_TEST_FC_SUBSCRIPTION_RECORDER_FLUSH_TIMEOUT_MS);
+
+        // Read the stop flag before flushing, the blocks handed over by the stop are full by then.
+        isStopping = s_isRecorderStopping;
+        while (DjiTest_FcSubscriptionRecorderFlushOnce()) {
+        }
+
+        if (isStopping) {
+            break;
+        }
+    }
+
+    osalHandler->SemaphorePost(s_recorderStopSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+/* Produces every recorded topic at its frequency, on a 1ms grid, catching up with the records due after a late wakeup. */
+static void *DjiTest_FcSubscriptionRecorderGeneratorTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionRecorderChannel *channel;
+    T_DjiDataTimestamp timestamp = {0};
+    uint8_t payload[DJI_TEST_FC_SUBSCRIPTION_RECORDER_GENERATOR_DATA_SIZE_MAX];
+    T_UtilPeriodic generatorLoop;
+    uint64_t startTimeUs = 0;
+    uint64_t nowUs = 0;
+    uint64_t recordTimeUs;
+    uint32_t dueCount;
+    uint8_t i;
+
+    USER_UTIL_UNUSED(arg);
+
+    osalHandler->GetTimeUs(&startTimeUs);
+    UtilPeriodic_Init(&generatorLoop, DJI_TEST_FC_SUBSCRIPTION_RECORDER_GENERATOR_PERIOD_US, NULL);
+    while (s_isGeneratorRunning) {
+        osalHandler->GetTimeUs(&nowUs);
+        for (i = 0; i < s_recorderChannelCount; i++) {
+            channel = &s_recorderChannels[s_recorderChannelOrder[i]];
+            dueCount = (uint32_t) ((nowUs - startTimeUs) * channel->frequency / 1000000);
+            while (channel->generatedCount < dueCount && channel->dataSize <= sizeof(payload)) {
+                // The record counter in the first bytes lets the decoded csv be checked for gaps.
+                memset(payload, 0, channel->dataSize);
+                memcpy(payload, &channel->generatedCount,
+                       USER_UTIL_MIN(sizeof(channel->generatedCount), channel->dataSize));
+                recordTimeUs = startTimeUs + (uint64_t) channel->generatedCount * 1000000 / channel->frequency;
+                timestamp.millisecond = (uint32_t) (recordTimeUs / 1000);
+                timestamp.microsecond = (uint32_t) recordTimeUs;
+
+                s_recorderTopicInfos[s_recorderChannelOrder[i]].callback(payload, channel->dataSize, &timestamp);
+                channel->generatedCount++;
+            }
+        }
+
+        UtilPeriodic_WaitNextCycle(&generatorLoop);
+    }
+
+    UtilPeriodic_PrintStatistics(&generatorLoop, "recorder generator");
+    osalHandler->SemaphorePost(s_generatorStopSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,108 @@
+/**
+ ********************************************************************
+ * @file    test_fc_subscription_recorder.h
+ * @brief   This is the header file for "test_fc_subscription_recorder.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_FC_SUBSCRIPTION_RECORDER_H
+#define TEST_FC_SUBSCRIPTION_RECORDER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_fc_subscription.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/*
+ * Recording file layout, all values little endian:
+ *   file header, then one topic descriptor per recorded topic,
+ *   then blocks of one topic each: block header, millisecond column, microsecond column, data column.
+ * A topic descriptor is followed by its name and its layout string, the layout lists the fields of the topic data as
+ * "name:type" separated by commas, type being one of b B h H i I f d (int8 to double, as in python struct). An empty
+ * layout means the data is only dumped as hex by the decoder.
+ */
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_FILE_MAGIC            "DJIFCREC"
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_FILE_VERSION          (1)
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_BLOCK_SYNC_WORD       (0x4B4C4252) /* "RBLK" */
+#define DJI_TEST_FC_SUBSCRIPTION_RECORDER_TOPIC_NUM_MAX         (DJI_FC_SUBSCRIPTION_TOPIC_TOTAL_NUMBER)
+
+/* Exported types ------------------------------------------------------------*/
+#pragma pack(1)
+typedef struct {
+    char magic[8];
+    uint16_t version;
+    uint16_t topicCount;
+    uint32_t reserved;
+} T_DjiTestFcSubscriptionRecorderFileHeader;
+
+typedef struct {
+    uint32_t topic;
+    uint16_t dataSize;
+    uint16_t frequency;
+    uint8_t nameLength;
+    uint8_t layoutLength;
+} T_DjiTestFcSubscriptionRecorderTopicDescriptor;
+
+typedef struct {
+    uint32_t syncWord;
+    uint16_t topicIndex;
+    uint16_t recordCount;
+    uint32_t droppedCount;
+} T_DjiTestFcSubscriptionRecorderBlockHeader;
+#pragma pack()
+
+/**
+ * @brief Topic to record, frequency 0 selects the maximum frequency of the topic.
+ */
+typedef struct {
+    E_DjiFcSubscriptionTopic topic;
+    E_DjiDataSubscriptionTopicFreq frequency;
+} T_DjiTestFcSubscriptionRecorderTopic;
+
+typedef struct {
+    uint32_t recordCount;
+    uint32_t droppedCount;
+    uint32_t blockCount;
+    uint32_t writtenBytes;
+    uint32_t writeErrorCount;
+    uint32_t maxFlushTimeMs;
+} T_DjiTestFcSubscriptionRecorderStatistics;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderStart(const char *filePath,
+                                                    const T_DjiTestFcSubscriptionRecorderTopic *topics,
+                                                    uint8_t topicCount);
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderStop(void);
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderGetStatistics(T_DjiTestFcSubscriptionRecorderStatistics *statistics);
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderRunSample(const char *filePath, uint32_t durationMs);
+T_DjiReturnCode DjiTest_FcSubscriptionRecorderRunBenchmark(const char *filePath, uint32_t durationMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_FC_SUBSCRIPTION_RECORDER_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -31,7 +31,11 @@
 #include <math.h>
 #include <widget_interaction_test/test_widget_interaction.h>
 #include <dji_aircraft_info.h>
+#include "utils/util_misc.h"
+#include "utils/util_periodic.h"
+#include "fc_subscription/test_fc_subscription_cache.h"
 /* Private constants ---------------------------------------------------------*/
+#define DJI_TEST_FLIGHT_CONTROL_JOYSTICK_CTRL_FREQ      (50)
 
 /* Private types -------------------------------------------------------------*/
 typedef struct {
@@ -39,10 +43,23 @@ typedef struct {
     char *displayModeStr;
 } T_DjiTestFlightControlDisplayModeStr;
 
+/* Topics a control cycle works on, fetched together once per cycle. */
+typedef struct {
+    T_DjiFcSubscriptionPositionFused positionFused;
+    T_DjiFcSubscriptionQuaternion quaternion;
+    dji_f32_t relativeHeight;
+} T_DjiTestFlightControlSnapshot;
+
 /* Private values -------------------------------------------------------------*/
 static T_DjiOsalHandler *s_osalHandler = NULL;
 static const double s_earthCenter = 6378137.0;
 static const double s_degToRad = 0.01745329252;
+static const E_DjiFcSubscriptionTopic s_flightControlCachedTopics[] = {
+    DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
+    DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED,
+    DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_FUSED,
+    DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_OF_HOMEPOINT,
+};
 
 static const T_DjiTestFlightControlDisplayModeStr s_flightControlDisplayModeStr[] = {
     {.displayMode = DJI_FC_SUBSCRIPTION_DISPLAY_MODE_ATTITUDE, .displayModeStr = "attitude mode"},
@@ -61,9 +78,7 @@ static uint8_t DjiTest_FlightControlGetDisplayModeIndex(E_DjiFcSubscriptionDispl
 static T_DjiFcSubscriptionFlightStatus DjiTest_FlightControlGetValueOfFlightStatus(void);
 static T_DjiFcSubscriptionDisplaymode DjiTest_FlightControlGetValueOfDisplayMode(void);
 static T_DjiFcSubscriptionHeightFusion DjiTest_FlightControlGetValueOfHeightFusion(void);
-static T_DjiFcSubscriptionQuaternion DjiTest_FlightControlGetValueOfQuaternion(void);
-static T_DjiFcSubscriptionPositionFused DjiTest_FlightControlGetValueOfPositionFused(void);
-static dji_f32_t DjiTest_FlightControlGetValueOfRelativeHeight(void);
+static T_DjiReturnCode DjiTest_FlightControlGetSnapshot(T_DjiTestFlightControlSnapshot *snapshot);
 static bool DjiTest_FlightControlMotorStartedCheck(void);
 static bool DjiTest_FlightControlTakeOffInAirCheck(void);
 static bool DjiTest_FlightControlLandFinishedCheck(void);
@@ -149,6 +164,12 @@ T_DjiReturnCode DjiTest_FlightControlInit(void)
         return returnCode;
     }
 
+    returnCode = DjiTest_FcSubscriptionCacheInit();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Init fc subscription cache failed, error code:0x%08llX", returnCode);
+        return returnCode;
+    }
+
     /*! subscribe fc data */
     returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_STATUS_FLIGHT,
                                                   DJI_DATA_SUBSCRIPTION_TOPIC_10_HZ,
@@ -177,39 +198,44 @@ T_DjiReturnCode DjiTest_FlightControlInit(void)
         return returnCode;
     }
 
-    returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
-                                                  DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
-                                                  NULL);
+    /*! topics read by the control loops are cached, so one snapshot returns them all at the same instant */
+    returnCode = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
+                                                      DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
+                                                      sizeof(T_DjiFcSubscriptionQuaternion),
+                                                      NULL);
 
     if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
     } else if (returnCode == DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
-        USER_LOG_WARN("Subscribe topic quaternion duplicate");
+        USER_LOG_WARN("Subscribe topic quaternion duplicate, the cache shares the existing subscription");
     } else {
         USER_LOG_ERROR("Subscribe topic quaternion failed,error code:0x%08llX", returnCode);
         return returnCode;
     }
 
-    returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED,
-                                                  DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
-                                                  NULL);
+    returnCode = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED,
+                                                      DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
+                                                      sizeof(T_DjiFcSubscriptionPositionFused),
+                                                      NULL);
 
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Subscribe topic position fused failed,error code:0x%08llX", returnCode);
         return returnCode;
     }
 
-    returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_FUSED,
-                                                  DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
-                                                  NULL);
+    returnCode = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_FUSED,
+                                                      DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
+                                                      sizeof(T_DjiFcSubscriptionAltitudeFused),
+                                                      NULL);
 
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Subscribe topic altitude fused failed,error code:0x%08llX", returnCode);
         return returnCode;
     }
 
-    returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_OF_HOMEPOINT,
-                                                  DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
-                                                  NULL);
+    returnCode = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_OF_HOMEPOINT,
+                                                      DJI_DATA_SUBSCRIPTION_TOPIC_1_HZ,
+                                                      sizeof(T_DjiFcSubscriptionAltitudeOfHomePoint),
+                                                      NULL);
 
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Subscribe topic altitude of home point failed,error code:0x%08llX", returnCode);
@@ -230,6 +256,7 @@ T_DjiReturnCode DjiTest_FlightControlInit(void)
 T_DjiReturnCode DjiTest_FlightControlDeInit(void)
 {
     T_DjiReturnCode returnCode;
+    uint8_t i;
 
     returnCode = DjiFlightController_DeInit();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -238,6 +265,22 @@ T_DjiReturnCode DjiTest_FlightControlDeInit(void)
         return returnCode;
     }
 
+    /*! the cache is shared with other samples, release only the topics taken in init */
+    for (i = 0; i < UTIL_ARRAY_SIZE(s_flightControlCachedTopics); i++) {
+        returnCode = DjiTest_FcSubscriptionCacheUnSubscribe(s_flightControlCachedTopics[i]);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_WARN("Unsubscribe cached topic 0x%08X failed, error code:0x%08llX",
+                          s_flightControlCachedTopics[i], returnCode);
+        }
+    }
+
+    returnCode = DjiTest_FcSubscriptionCacheDeInit();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Deinit fc subscription cache failed, error code:0x%08llX",
+                       returnCode);
+        return returnCode;
+    }
+
     returnCode = DjiFcSubscription_DeInit();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Deinit data subscription module failed, error code:0x%08llX",
@@ -995,88 +1038,31 @@ T_DjiFcSubscriptionHeightFusion DjiTest_FlightControlGetValueOfHeightFusion(void
     return heightFusion;
 }
 
-T_DjiFcSubscriptionQuaternion DjiTest_FlightControlGetValueOfQuaternion(void)
-{
-    T_DjiReturnCode djiStat;
-    T_DjiFcSubscriptionQuaternion quaternion = {0};
-    T_DjiDataTimestamp quaternionTimestamp = {0};
-
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
-                                                      (uint8_t *) &quaternion,
-                                                      sizeof(T_DjiFcSubscriptionQuaternion),
-                                                      &quaternionTimestamp);
-
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic quaternion error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", quaternionTimestamp.millisecond,
-                       quaternionTimestamp.microsecond);
-        USER_LOG_DEBUG("Quaternion: %f %f %f %f.", quaternion.q0, quaternion.q1, quaternion.q2, quaternion.q3);
-    }
-
-    return quaternion;
-}
-
-T_DjiFcSubscriptionPositionFused DjiTest_FlightControlGetValueOfPositionFused(void)
-{
-    T_DjiReturnCode djiStat;
-    T_DjiFcSubscriptionPositionFused positionFused = {0};
-    T_DjiDataTimestamp positionFusedTimestamp = {0};
-
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED,
-                                                      (uint8_t *) &positionFused,
-                                                      sizeof(T_DjiFcSubscriptionPositionFused),
-                                                      &positionFusedTimestamp);
-
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic position fused error, error code: 0x%08X", djiStat);
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", positionFusedTimestamp.millisecond,
-                       positionFusedTimestamp.microsecond);
-        USER_LOG_DEBUG("PositionFused: %f, %f,%f,%d.", positionFused.latitude, positionFused.longitude,
-                       positionFused.altitude, positionFused.visibleSatelliteNumber);
-    }
-
-    return positionFused;
-}
-
-dji_f32_t DjiTest_FlightControlGetValueOfRelativeHeight(void)
+T_DjiReturnCode DjiTest_FlightControlGetSnapshot(T_DjiTestFlightControlSnapshot *snapshot)
 {
     T_DjiReturnCode djiStat;
     T_DjiFcSubscriptionAltitudeFused altitudeFused = 0;
     T_DjiFcSubscriptionAltitudeOfHomePoint homePointAltitude = 0;
-    dji_f32_t relativeHeight = 0;
-    T_DjiDataTimestamp relativeHeightTimestamp = {0};
-
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_OF_HOMEPOINT,
-                                                      (uint8_t *) &homePointAltitude,
-                                                      sizeof(T_DjiFcSubscriptionAltitudeOfHomePoint),
-                                                      &relativeHeightTimestamp);
-
-    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic altitude of home point error, error code: 0x%08X", djiStat);
-        return -1;
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", relativeHeightTimestamp.millisecond,
-                       relativeHeightTimestamp.microsecond);
-    }
-
-    djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_FUSED,
-                                                      (uint8_t *) &altitudeFused,
-                                                      sizeof(T_DjiFcSubscriptionAltitudeFused),
-                                                      &relativeHeightTimestamp);
+    T_DjiTestFcSubscriptionCacheItem items[] = {
+        {DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED,        (uint8_t *) &snapshot->positionFused,
+            sizeof(T_DjiFcSubscriptionPositionFused)},
+        {DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,            (uint8_t *) &snapshot->quaternion,
+            sizeof(T_DjiFcSubscriptionQuaternion)},
+        {DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_OF_HOMEPOINT, (uint8_t *) &homePointAltitude,
+            sizeof(T_DjiFcSubscriptionAltitudeOfHomePoint)},
+        {DJI_FC_SUBSCRIPTION_TOPIC_ALTITUDE_FUSED,        (uint8_t *) &altitudeFused,
+            sizeof(T_DjiFcSubscriptionAltitudeFused)},
+    };
 
+    djiStat = DjiTest_FcSubscriptionCacheGetSnapshot(items, UTIL_ARRAY_SIZE(items));
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic altitude fused error, error code: 0x%08X", djiStat);
-        return -1;
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", relativeHeightTimestamp.millisecond,
-                       relativeHeightTimestamp.microsecond);
+        USER_LOG_ERROR("Get snapshot of flight control topics error, error code: 0x%08X", djiStat);
+        return djiStat;
     }
 
-    relativeHeight = altitudeFused - homePointAltitude;
+    snapshot->relativeHeight = altitudeFused - homePointAltitude;
 
-    return relativeHeight;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
 bool DjiTest_FlightControlMotorStartedCheck(void)
@@ -1388,14 +1374,17 @@ DjiTest_FlightControlMoveByPositionOffset(const T_DjiTestFlightControlVector3f o
     int outOfBounds = 0;
     int brakeCounter = 0;
     int speedFactor = 2;
+    uint32_t cycleCount = 1;
+    T_UtilPeriodic controlLoop;
+    T_DjiTestFlightControlSnapshot snapshot;
 
     //! get origin position and relative height(from home point)of aircraft.
-    T_DjiFcSubscriptionPositionFused originGPSPosition = DjiTest_FlightControlGetValueOfPositionFused();
-    dji_f32_t originHeightBaseHomePoint = DjiTest_FlightControlGetValueOfRelativeHeight();
-    if (originHeightBaseHomePoint == -1) {
-        USER_LOG_ERROR("Relative height is invalid!");
+    if (DjiTest_FlightControlGetSnapshot(&snapshot) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Get flight control topics failed!");
         return false;
     }
+    T_DjiFcSubscriptionPositionFused originGPSPosition = snapshot.positionFused;
+    dji_f32_t originHeightBaseHomePoint = snapshot.relativeHeight;
 
     T_DjiFlightControllerJoystickMode joystickMode = {
         DJI_FLIGHT_CONTROLLER_HORIZONTAL_POSITION_CONTROL_MODE,
@@ -1405,23 +1394,21 @@ DjiTest_FlightControlMoveByPositionOffset(const T_DjiTestFlightControlVector3f o
         DJI_FLIGHT_CONTROLLER_STABLE_CONTROL_MODE_ENABLE,
     };
     DjiFlightController_SetJoystickMode(joystickMode);
+    UtilPeriodic_Init(&controlLoop, cycleTimeInMs * 1000, NULL);
 
     while (elapsedTimeInMs < timeoutInMilSec) {
-        T_DjiFcSubscriptionPositionFused currentGPSPosition = DjiTest_FlightControlGetValueOfPositionFused();
-        T_DjiFcSubscriptionQuaternion currentQuaternion = DjiTest_FlightControlGetValueOfQuaternion();
-        dji_f32_t currentHeight = DjiTest_FlightControlGetValueOfRelativeHeight();
-        if (originHeightBaseHomePoint == -1) {
-            USER_LOG_ERROR("Relative height is invalid!");
+        if (DjiTest_FlightControlGetSnapshot(&snapshot) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Get flight control topics failed!");
             return false;
         }
 
-        float yawInRad = DjiTest_FlightControlQuaternionToEulerAngle(currentQuaternion).z;
+        float yawInRad = DjiTest_FlightControlQuaternionToEulerAngle(snapshot.quaternion).z;
         //! get the vector between aircraft and origin point.
 
         T_DjiTestFlightControlVector3f localOffset = DjiTest_FlightControlLocalOffsetFromGpsAndFusedHeightOffset(
-            currentGPSPosition,
+            snapshot.positionFused,
             originGPSPosition,
-            currentHeight,
+            snapshot.relativeHeight,
             originHeightBaseHomePoint);
         //! get the vector between aircraft and target point.
         T_DjiTestFlightControlVector3f offsetRemaining = DjiTest_FlightControlVector3FSub(offsetDesired, localOffset);
@@ -1437,11 +1424,11 @@ DjiTest_FlightControlMoveByPositionOffset(const T_DjiTestFlightControlVector3f o
         if (DjiTest_FlightControlVectorNorm(offsetRemaining) < posThresholdInM &&
             fabs(yawInRad / s_degToRad - yawDesiredInDeg) < yawThresholdInDeg) {
             //! 1. We are within bounds; start incrementing our in-bound counter
-            withinBoundsCounter += cycleTimeInMs;
+            withinBoundsCounter += cycleCount * cycleTimeInMs;
         } else {
             if (withinBoundsCounter != 0) {
                 //! 2. Start incrementing an out-of-bounds counter
-                outOfBounds += cycleTimeInMs;
+                outOfBounds += cycleCount * cycleTimeInMs;
             }
         }
         //! 3. Reset withinBoundsCounter if necessary
@@ -1453,14 +1440,15 @@ DjiTest_FlightControlMoveByPositionOffset(const T_DjiTestFlightControlVector3f o
         if (withinBoundsCounter >= withinControlBoundsTimeReqmt) {
             break;
         }
-        s_osalHandler->TaskSleepMs(cycleTimeInMs);
-        elapsedTimeInMs += cycleTimeInMs;
+        //! 5. Counters advance by the periods actually elapsed, including the ones skipped after an overrun
+        cycleCount = UtilPeriodic_WaitNextCycle(&controlLoop);
+        elapsedTimeInMs = UtilPeriodic_GetElapsedMs(&controlLoop);
     }
 
     while (brakeCounter < withinControlBoundsTimeReqmt) {
-        s_osalHandler->TaskSleepMs(cycleTimeInMs);
-        brakeCounter += cycleTimeInMs;
+        brakeCounter += UtilPeriodic_WaitNextCycle(&controlLoop) * cycleTimeInMs;
     }
+    UtilPeriodic_PrintStatistics(&controlLoop, "position ctrl");
 
     if (elapsedTimeInMs >= timeoutInMilSec) {
         USER_LOG_ERROR("Task timeout!");
@@ -1473,13 +1461,7 @@ DjiTest_FlightControlMoveByPositionOffset(const T_DjiTestFlightControlVector3f o
 void DjiTest_FlightControlVelocityAndYawRateCtrl(const T_DjiTestFlightControlVector3f offsetDesired, float yawRate,
                                                  uint32_t timeMs)
 {
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-    uint32_t originTime = 0;
-    uint32_t currentTime = 0;
-    uint32_t elapsedTimeInMs = 0;
-    osalHandler->GetTimeMs(&originTime);
-    osalHandler->GetTimeMs(&currentTime);
-    elapsedTimeInMs = currentTime - originTime;
+    T_UtilPeriodic controlLoop;
     T_DjiFlightControllerJoystickMode joystickMode = {
         DJI_FLIGHT_CONTROLLER_HORIZONTAL_VELOCITY_CONTROL_MODE,
         DJI_FLIGHT_CONTROLLER_VERTICAL_VELOCITY_CONTROL_MODE,
@@ -1492,12 +1474,12 @@ void DjiTest_FlightControlVelocityAndYawRateCtrl(const T_DjiTestFlightControlVec
     T_DjiFlightControllerJoystickCommand joystickCommand = {offsetDesired.x, offsetDesired.y, offsetDesired.z,
                                                             yawRate};
 
-    while (elapsedTimeInMs <= timeMs) {
+    UtilPeriodic_Init(&controlLoop, 1000000 / DJI_TEST_FLIGHT_CONTROL_JOYSTICK_CTRL_FREQ, NULL);
+    while (UtilPeriodic_GetElapsedMs(&controlLoop) <= timeMs) {
         DjiFlightController_ExecuteJoystickAction(joystickCommand);
-        osalHandler->TaskSleepMs(2);
-        osalHandler->GetTimeMs(&currentTime);
-        elapsedTimeInMs = currentTime - originTime;
+        UtilPeriodic_WaitNextCycle(&controlLoop);
     }
+    UtilPeriodic_PrintStatistics(&controlLoop, "velocity ctrl");
 }
 
 T_DjiReturnCode
@@ -27,15 +27,29 @@
 #include <dji_gimbal.h>
 #include "test_payload_gimbal_emu.h"
 #include "dji_fc_subscription.h"
+#include "fc_subscription/test_fc_subscription_cache.h"
 #include "dji_logger.h"
 #include "dji_platform.h"
 #include "utils/util_misc.h"
+#include "utils/util_periodic.h"
 
 /* Private constants ---------------------------------------------------------*/
 #define PAYLOAD_GIMBAL_EMU_TASK_STACK_SIZE  (2048)
 #define PAYLOAD_GIMBAL_TASK_FREQ            1000
 #define PAYLOAD_GIMBAL_CALIBRATION_TIME_MS  2000
 #define PAYLOAD_GIMBAL_MIN_ACTION_TIME      5
+#define PAYLOAD_GIMBAL_TASK_PERIOD_US       (1000000 / PAYLOAD_GIMBAL_TASK_FREQ)
+#define PAYLOAD_GIMBAL_QUATERNION_POLL_FREQ 20
+#define PAYLOAD_GIMBAL_STATISTICS_PRINT_INTERVAL_S  60
+#define PAYLOAD_GIMBAL_SEQLOCK_RETRY_TIMES  8
+#define PAYLOAD_GIMBAL_RAD_TO_DECIDEGREE    (180.0 / DJI_PI * 10)
+
+/* Orders the sequence accesses against the copy of the protected data, see T_TestGimbalStateSnapshot. */
+#if defined(__CC_ARM)
+#define PAYLOAD_GIMBAL_BARRIER()            __dmb(0xF)
+#else
+#define PAYLOAD_GIMBAL_BARRIER()            __sync_synchronize()
+#endif
 
 /* Private types -------------------------------------------------------------*/
 typedef enum {
@@ -44,6 +58,29 @@ typedef enum {
     TEST_GIMBAL_CONTROL_TYPE_ANGLE = 2,
 } E_TestGimbalControlType;
 
+/**
+ * @brief Gimbal state published by the gimbal task for the getters, protected by a sequence lock: the task makes the
+ * sequence odd while it copies the state and even again when done, readers retry when they see an odd sequence or a
+ * sequence changed across their copy. The task is the only writer and publishes with the attitude mutex held.
+ */
+typedef struct {
+    volatile uint32_t sequence;
+    T_DjiGimbalAttitudeInformation attitudeInformation;
+    T_DjiAttitude3d speed;
+    T_DjiAttitude3d jointAngle;
+    T_DjiAttitude3d fineTuneAngle;
+} T_TestGimbalStateSnapshot;
+
+/**
+ * @brief Latest aircraft attitude, converted from the quaternion once per received sample and read by the gimbal task
+ * through the same sequence lock scheme. Writers are serialized by a mutex, they run at the quaternion rate only.
+ */
+typedef struct {
+    volatile uint32_t sequence;
+    T_DjiAttitude3d attitude; // unit: 0.1 degree, ground coordination
+    T_DjiDataTimestamp timestamp;
+} T_TestGimbalAircraftAttitudeFeed;
+
 /* Private functions declaration ---------------------------------------------*/
 static void *UserGimbal_Task(void *arg);
 static T_DjiReturnCode GetSystemState(T_DjiGimbalSystemState *systemState);
@@ -67,12 +104,21 @@ DjiTest_GimbalCalculateSpeed(T_DjiAttitude3d originalAttitude, T_DjiAttitude3d t
 static void DjiTest_GimbalSpeedLegalization(T_DjiAttitude3d *speed);
 static T_DjiReturnCode DjiTest_GimbalCalculateGroundAttitudeBaseQuaternion(T_DjiFcSubscriptionQuaternion quaternion,
                                                                            T_DjiAttitude3d *attitude);
+static T_DjiReturnCode DjiTest_GimbalQuaternionCallback(const uint8_t *data, uint16_t dataSize,
+                                                        const T_DjiDataTimestamp *timestamp);
+static void DjiTest_GimbalUpdateAircraftAttitude(T_DjiFcSubscriptionQuaternion quaternion,
+                                                 const T_DjiDataTimestamp *timestamp);
+static bool DjiTest_GimbalReadAircraftAttitude(uint32_t *sequence, T_DjiAttitude3d *attitude);
+static T_DjiReturnCode DjiTest_GimbalRunControlCycle(const T_DjiAttitude3d *aircraftAttitude, float cycleTime);
+static void DjiTest_GimbalPublishState(void);
+static bool DjiTest_GimbalReadState(T_TestGimbalStateSnapshot *snapshot);
+static void DjiTest_GimbalPrintLoopStatistics(void);
 
 /* Private variables ---------------------------------------------------------*/
 static T_DjiTaskHandle s_userGimbalThread;
 static T_DjiGimbalCommonHandler s_commonHandler = {0};
 static T_DjiGimbalSystemState s_systemState = {0};
-static bool s_rotatingFlag = false;
+static volatile bool s_rotatingFlag = false;
 static T_DjiMutexHandle s_commonMutex = {0};
 
 static T_DjiGimbalAttitudeInformation s_attitudeInformation = {0}; // unit: 0.1 degree, ground coordination
@@ -93,6 +139,14 @@ static const T_DjiAttitude3d s_speedLimit = {1800, 1800, 1800}; // unit: 0.1 deg
 static uint32_t s_calibrationStartTime = 0; // unit: ms
 static T_DjiMutexHandle s_attitudeMutex = NULL;
 static T_DjiMutexHandle s_calibrationMutex = NULL;
+static T_DjiMutexHandle s_aircraftAttitudeFeedMutex = NULL;
+static T_TestGimbalStateSnapshot s_stateSnapshot = {0};
+static T_TestGimbalAircraftAttitudeFeed s_aircraftAttitudeFeed = {0};
+static volatile bool s_gimbalStateChangedFlag = false;
+static bool s_quaternionCallbackRegisteredFlag = false;
+static bool s_quaternionCachedFlag = false;
+static T_UtilPeriodic s_gimbalPeriodic = {0};
+static uint32_t s_gimbalControlCycleCount = 0;
 
 /* Exported functions definition ---------------------------------------------*/
 /**
@@ -149,6 +203,11 @@ T_DjiReturnCode DjiTest_GimbalStartService(void)
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
 
+    if (osalHandler->MutexCreate(&s_aircraftAttitudeFeedMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("mutex create error");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+
     djiStat = DjiGimbal_Init();
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("init gimbal module error: 0x%08llX", djiStat);
@@ -182,12 +241,28 @@ T_DjiReturnCode DjiTest_GimbalDeInit(void)
         return djiStat;
     }
 
+    if (s_quaternionCachedFlag == true) {
+        djiStat = DjiTest_FcSubscriptionCacheUnSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION);
+        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Unsubscribe topic quaternion error: 0x%08llX.", djiStat);
+            return djiStat;
+        }
+        DjiTest_FcSubscriptionCacheDeInit();
+        s_quaternionCallbackRegisteredFlag = false;
+        s_quaternionCachedFlag = false;
+    }
+
     djiStat = DjiGimbal_DeInit();
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Deinit gimbal module error: 0x%08llX.", djiStat);
         return djiStat;
     }
 
+    if (osalHandler->MutexDestroy(s_aircraftAttitudeFeedMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("mutex destroy error");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+
     if (osalHandler->MutexDestroy(s_calibrationMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex destroy error");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
@@ -351,6 +426,8 @@ T_DjiReturnCode DjiTest_GimbalRotate(E_DjiGimbalRotationMode rotationMode,
             goto out1;
     }
 
+    s_gimbalStateChangedFlag = true;
+
 out1:
     if (osalHandler->MutexUnlock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex unlock error");
@@ -380,162 +457,91 @@ static void *UserGimbal_Task(void *arg)
     static uint32_t step = 0;
     T_DjiFcSubscriptionQuaternion quaternion = {0};
     T_DjiDataTimestamp timestamp = {0};
-    T_DjiAttitude3f nextAttitude = {0};
-    T_DjiAttitude3f attitudeFTemp = {0};
+    T_DjiDataTimestamp lastPolledTimestamp = {0};
+    T_DjiAttitude3d aircraftAttitude = {0};
+    uint32_t aircraftAttitudeSequence = 0;
+    uint32_t appliedAircraftAttitudeSequence = 0;
+    bool aircraftAttitudeUpdatedFlag;
+    T_TestGimbalStateSnapshot snapshot = {0};
+    uint32_t cycleNum;
     uint32_t currentTime = 0;
     uint32_t progressTemp = 0;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
 
     USER_UTIL_UNUSED(arg);
 
-    djiStat = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION, DJI_DATA_SUBSCRIPTION_TOPIC_10_HZ,
-                                               NULL);
+    // the quaternion is shared with the flight control samples, subscribe it through the cache like they do
+    djiStat = DjiTest_FcSubscriptionCacheInit();
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        if (djiStat == DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
-            USER_LOG_WARN("Subscribe topic quaternion duplicate.");
+        USER_LOG_ERROR("Init fc subscription cache error: 0x%08llX.", djiStat);
+    } else {
+        djiStat = DjiTest_FcSubscriptionCacheSubscribe(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
+                                                       DJI_DATA_SUBSCRIPTION_TOPIC_10_HZ,
+                                                       sizeof(T_DjiFcSubscriptionQuaternion),
+                                                       DjiTest_GimbalQuaternionCallback);
+        if (djiStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_DEBUG("Subscribe topic quaternion success.");
+            s_quaternionCallbackRegisteredFlag = true;
+            s_quaternionCachedFlag = true;
+        } else if (djiStat == DJI_ERROR_SUBSCRIPTION_MODULE_CODE_TOPIC_DUPLICATE) {
+            USER_LOG_WARN("Subscribe topic quaternion duplicate, poll the latest value instead.");
+            s_quaternionCachedFlag = true;
         } else {
             USER_LOG_ERROR("Subscribe topic quaternion error.");
+            DjiTest_FcSubscriptionCacheDeInit();
         }
-    } else {
-        USER_LOG_DEBUG("Subscribe topic quaternion success.");
     }
 
+    UtilPeriodic_Init(&s_gimbalPeriodic, PAYLOAD_GIMBAL_TASK_PERIOD_US, NULL);
+
     while (1) {
-        osalHandler->TaskSleepMs(1000 / PAYLOAD_GIMBAL_TASK_FREQ);
+        cycleNum = UtilPeriodic_WaitNextCycle(&s_gimbalPeriodic);
         step++;
 
-        if (osalHandler->MutexLock(s_attitudeMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("mutex lock error");
-            continue;
-        }
-
-        if (osalHandler->MutexLock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("mutex lock error");
-            goto out2;
+        if (step % (PAYLOAD_GIMBAL_STATISTICS_PRINT_INTERVAL_S * PAYLOAD_GIMBAL_TASK_FREQ) == 0) {
+            DjiTest_GimbalPrintLoopStatistics();
         }
 
-        if (USER_UTIL_IS_WORK_TURN(step, 1, PAYLOAD_GIMBAL_TASK_FREQ)) {
-            USER_LOG_DEBUG("gimbal attitude: pitch %d, roll %d, yaw %d.", s_attitudeInformation.attitude.pitch,
-                           s_attitudeInformation.attitude.roll, s_attitudeInformation.attitude.yaw);
+        if (USER_UTIL_IS_WORK_TURN(step, 1, PAYLOAD_GIMBAL_TASK_FREQ) && DjiTest_GimbalReadState(&snapshot) == true) {
+            USER_LOG_DEBUG("gimbal attitude: pitch %d, roll %d, yaw %d.", snapshot.attitudeInformation.attitude.pitch,
+                           snapshot.attitudeInformation.attitude.roll, snapshot.attitudeInformation.attitude.yaw);
 
-            USER_LOG_DEBUG("gimbal fine tune: pitch %d, roll %d, yaw %d.", s_systemState.fineTuneAngle.pitch,
-                           s_systemState.fineTuneAngle.roll, s_systemState.fineTuneAngle.yaw);
+            USER_LOG_DEBUG("gimbal fine tune: pitch %d, roll %d, yaw %d.", snapshot.fineTuneAngle.pitch,
+                           snapshot.fineTuneAngle.roll, snapshot.fineTuneAngle.yaw);
         }
 
-        // update aircraft attitude
-        if (USER_UTIL_IS_WORK_TURN(step, 50, PAYLOAD_GIMBAL_TASK_FREQ)) {
-            djiStat = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
-                                                              (uint8_t *) &quaternion,
-                                                              sizeof(T_DjiFcSubscriptionQuaternion),
-                                                              &timestamp);
+        // poll aircraft attitude when the quaternion topic has been subscribed by others without our callback
+        if (s_quaternionCallbackRegisteredFlag != true && s_quaternionCachedFlag == true &&
+            USER_UTIL_IS_WORK_TURN(step, PAYLOAD_GIMBAL_QUATERNION_POLL_FREQ, PAYLOAD_GIMBAL_TASK_FREQ)) {
+            djiStat = DjiTest_FcSubscriptionCacheGetLatestValue(DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,
+                                                                (uint8_t *) &quaternion,
+                                                                sizeof(T_DjiFcSubscriptionQuaternion),
+                                                                &timestamp);
             if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
                 USER_LOG_ERROR("get topic quaternion value error.");
+            } else if (memcmp(&timestamp, &lastPolledTimestamp, sizeof(T_DjiDataTimestamp)) != 0) {
+                lastPolledTimestamp = timestamp;
+                DjiTest_GimbalUpdateAircraftAttitude(quaternion, &timestamp);
             }
-
-            djiStat = DjiTest_GimbalCalculateGroundAttitudeBaseQuaternion(quaternion, &s_aircraftAttitude);
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("calculate and update aircraft attitude error.");
-            }
-        }
-
-        // stable control
-        switch (s_systemState.gimbalMode) {
-            case DJI_GIMBAL_MODE_FREE:
-                break;
-            case DJI_GIMBAL_MODE_FPV:
-                s_attitudeInformation.attitude.roll += (s_aircraftAttitude.roll - s_lastAircraftAttitude.roll);
-                s_attitudeInformation.attitude.yaw += (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
-
-                s_attitudeHighPrecision.roll += (float) (s_aircraftAttitude.roll - s_lastAircraftAttitude.roll);
-                s_attitudeHighPrecision.yaw += (float) (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
-
-                if (s_rotatingFlag == true && s_controlType == TEST_GIMBAL_CONTROL_TYPE_ANGLE) {
-                    s_targetAttitude.roll += (s_aircraftAttitude.roll - s_lastAircraftAttitude.roll);
-                    s_targetAttitude.yaw += (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
-                }
-                break;
-            case DJI_GIMBAL_MODE_YAW_FOLLOW:
-                s_attitudeInformation.attitude.yaw += (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
-
-                s_attitudeHighPrecision.yaw += (float) (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
-
-                if (s_rotatingFlag == true && s_controlType == TEST_GIMBAL_CONTROL_TYPE_ANGLE) {
-                    s_targetAttitude.yaw += (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
-                }
-                break;
-            default:
-                USER_LOG_ERROR("gimbal mode invalid: %d.", s_systemState.gimbalMode);
         }
-        s_lastAircraftAttitude = s_aircraftAttitude;
-
-        attitudeFTemp.pitch = s_attitudeInformation.attitude.pitch;
-        attitudeFTemp.roll = s_attitudeInformation.attitude.roll;
-        attitudeFTemp.yaw = s_attitudeInformation.attitude.yaw;
-        DjiTest_GimbalAngleLegalization(&attitudeFTemp, s_aircraftAttitude, &s_attitudeInformation.reachLimitFlag);
-        s_attitudeInformation.attitude.pitch = attitudeFTemp.pitch;
-        s_attitudeInformation.attitude.roll = attitudeFTemp.roll;
-        s_attitudeInformation.attitude.yaw = attitudeFTemp.yaw;
-
-        DjiTest_GimbalAngleLegalization(&s_attitudeHighPrecision, s_aircraftAttitude, NULL);
-
-        attitudeFTemp.pitch = s_targetAttitude.pitch;
-        attitudeFTemp.roll = s_targetAttitude.roll;
-        attitudeFTemp.yaw = s_targetAttitude.yaw;
-        DjiTest_GimbalAngleLegalization(&attitudeFTemp, s_aircraftAttitude, NULL);
-        s_targetAttitude.pitch = attitudeFTemp.pitch;
-        s_targetAttitude.roll = attitudeFTemp.roll;
-        s_targetAttitude.yaw = attitudeFTemp.yaw;
-
-        // rotation
-        if (s_rotatingFlag != true)
-            goto out1;
 
-        nextAttitude.pitch =
-            (float) s_attitudeHighPrecision.pitch + (float) s_speed.pitch / (float) PAYLOAD_GIMBAL_TASK_FREQ;
-        nextAttitude.roll =
-            (float) s_attitudeHighPrecision.roll + (float) s_speed.roll / (float) PAYLOAD_GIMBAL_TASK_FREQ;
-        nextAttitude.yaw = (float) s_attitudeHighPrecision.yaw + (float) s_speed.yaw / (float) PAYLOAD_GIMBAL_TASK_FREQ;
-
-        if (s_controlType == TEST_GIMBAL_CONTROL_TYPE_ANGLE) {
-            nextAttitude.pitch =
-                (nextAttitude.pitch - s_targetAttitude.pitch) * s_speed.pitch >= 0 ? s_targetAttitude.pitch
-                                                                                   : nextAttitude.pitch;
-            nextAttitude.roll = (nextAttitude.roll - s_targetAttitude.roll) * s_speed.roll >= 0 ? s_targetAttitude.roll
-                                                                                                : nextAttitude.roll;
-            nextAttitude.yaw =
-                (nextAttitude.yaw - s_targetAttitude.yaw) * s_speed.yaw >= 0 ? s_targetAttitude.yaw : nextAttitude.yaw;
+        aircraftAttitudeUpdatedFlag = false;
+        if (DjiTest_GimbalReadAircraftAttitude(&aircraftAttitudeSequence, &aircraftAttitude) == true &&
+            aircraftAttitudeSequence != appliedAircraftAttitudeSequence) {
+            aircraftAttitudeUpdatedFlag = true;
         }
 
-        DjiTest_GimbalAngleLegalization(&nextAttitude, s_aircraftAttitude, &s_attitudeInformation.reachLimitFlag);
-        s_attitudeInformation.attitude.pitch = nextAttitude.pitch;
-        s_attitudeInformation.attitude.roll = nextAttitude.roll;
-        s_attitudeInformation.attitude.yaw = nextAttitude.yaw;
-
-        s_attitudeHighPrecision.pitch = nextAttitude.pitch;
-        s_attitudeHighPrecision.roll = nextAttitude.roll;
-        s_attitudeHighPrecision.yaw = nextAttitude.yaw;
-
-        if (s_controlType == TEST_GIMBAL_CONTROL_TYPE_ANGLE) {
-            if (memcmp(&s_attitudeInformation.attitude, &s_targetAttitude, sizeof(T_DjiAttitude3d)) == 0) {
-                s_rotatingFlag = false;
+        // the state only moves when rotating, when the aircraft moved or when a command changed it
+        if (aircraftAttitudeUpdatedFlag == true || s_rotatingFlag == true || s_gimbalStateChangedFlag == true) {
+            djiStat = DjiTest_GimbalRunControlCycle(aircraftAttitudeUpdatedFlag ? &aircraftAttitude : NULL,
+                                                    (float) cycleNum / (float) PAYLOAD_GIMBAL_TASK_FREQ);
+            if (djiStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS && aircraftAttitudeUpdatedFlag == true) {
+                appliedAircraftAttitudeSequence = aircraftAttitudeSequence;
             }
-        } else if (s_controlType == TEST_GIMBAL_CONTROL_TYPE_SPEED) {
-            if ((s_attitudeInformation.reachLimitFlag.pitch == true || s_speed.pitch == 0) &&
-                (s_attitudeInformation.reachLimitFlag.roll == true || s_speed.roll == 0) &&
-                (s_attitudeInformation.reachLimitFlag.yaw == true || s_speed.yaw == 0)) {
-                s_rotatingFlag = false;
-            }
-        }
-
-out1:
-        if (osalHandler->MutexUnlock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("mutex unlock error");
-            goto out2;
         }
 
-out2:
-        if (osalHandler->MutexUnlock(s_attitudeMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("mutex unlock error");
+        // calibration
+        if (s_calibrationState.calibratingFlag != true) {
             continue;
         }
 
@@ -550,7 +556,6 @@ out2:
             continue;
         }
 
-        // calibration
         if (s_calibrationState.calibratingFlag != true)
             goto unlockCalibrationMutex;
 
@@ -594,8 +599,14 @@ static T_DjiReturnCode GetSystemState(T_DjiGimbalSystemState *systemState)
 
 static T_DjiReturnCode GetAttitudeInformation(T_DjiGimbalAttitudeInformation *attitudeInformation)
 {
+    T_TestGimbalStateSnapshot snapshot;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
 
+    if (DjiTest_GimbalReadState(&snapshot) == true) {
+        *attitudeInformation = snapshot.attitudeInformation;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
     if (osalHandler->MutexLock(s_attitudeMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex lock error");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
@@ -632,8 +643,14 @@ static T_DjiReturnCode GetCalibrationState(T_DjiGimbalCalibrationState *calibrat
 
 static T_DjiReturnCode GetRotationSpeed(T_DjiAttitude3d *rotationSpeed)
 {
+    T_TestGimbalStateSnapshot snapshot;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
 
+    if (DjiTest_GimbalReadState(&snapshot) == true) {
+        *rotationSpeed = snapshot.speed;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
     if (osalHandler->MutexLock(s_attitudeMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex lock error");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
@@ -651,8 +668,14 @@ static T_DjiReturnCode GetRotationSpeed(T_DjiAttitude3d *rotationSpeed)
 
 static T_DjiReturnCode GetJointAngle(T_DjiAttitude3d *jointAngle)
 {
+    T_TestGimbalStateSnapshot snapshot;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
 
+    if (DjiTest_GimbalReadState(&snapshot) == true) {
+        *jointAngle = snapshot.jointAngle;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
     if (osalHandler->MutexLock(s_attitudeMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex lock error");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
@@ -735,6 +758,7 @@ static T_DjiReturnCode SetPitchRangeExtensionEnabled(bool enabledFlag)
     }
 
     s_systemState.pitchRangeExtensionEnabledFlag = enabledFlag;
+    s_gimbalStateChangedFlag = true;
 
     if (osalHandler->MutexUnlock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex unlock error");
@@ -787,6 +811,7 @@ static T_DjiReturnCode RestoreFactorySettings(void)
     memset(&s_systemState.smoothFactor, 0, sizeof(s_systemState.smoothFactor));
     s_systemState.maxSpeedPercentage.pitch = 1;
     s_systemState.maxSpeedPercentage.yaw = 1;
+    s_gimbalStateChangedFlag = true;
 
     if (osalHandler->MutexUnlock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex unlock error");
@@ -808,6 +833,7 @@ static T_DjiReturnCode SetMode(E_DjiGimbalMode mode)
     }
 
     s_systemState.gimbalMode = mode;
+    s_gimbalStateChangedFlag = true;
 
     if (osalHandler->MutexUnlock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex unlock error");
@@ -881,6 +907,7 @@ static T_DjiReturnCode Reset(E_DjiGimbalResetMode mode)
     DjiTest_GimbalAngleLegalization(&s_attitudeHighPrecision, s_aircraftAttitude, NULL);
 
     s_rotatingFlag = false;
+    s_gimbalStateChangedFlag = true;
 
 unlock1:
     if (osalHandler->MutexUnlock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -947,6 +974,7 @@ static T_DjiReturnCode FineTuneAngle(T_DjiAttitude3d fineTuneAngle)
     s_systemState.fineTuneAngle.pitch = attitudeFTemp.pitch;
     s_systemState.fineTuneAngle.roll = attitudeFTemp.roll;
     s_systemState.fineTuneAngle.yaw = attitudeFTemp.yaw;
+    s_gimbalStateChangedFlag = true;
 
     if (osalHandler->MutexUnlock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("mutex unlock error");
@@ -1130,19 +1158,298 @@ static T_DjiReturnCode DjiTest_GimbalCalculateGroundAttitudeBaseQuaternion(T_Dji
     }
 
     aircraftPitchInRad = asin(2 * ((double) quaternion.q0 * quaternion.q2 - (double) quaternion.q3 * quaternion.q1));
-    attitude->pitch = aircraftPitchInRad * 180 / DJI_PI * 10;
+    attitude->pitch = aircraftPitchInRad * PAYLOAD_GIMBAL_RAD_TO_DECIDEGREE;
 
     aircraftRollInRad = atan2(2 * ((double) quaternion.q0 * quaternion.q1 + (double) quaternion.q2 * quaternion.q3),
                               (double) 1 -
                               2 * ((double) quaternion.q1 * quaternion.q1 + (double) quaternion.q2 * quaternion.q2));
-    attitude->roll = aircraftRollInRad * 180 / DJI_PI * 10;
+    attitude->roll = aircraftRollInRad * PAYLOAD_GIMBAL_RAD_TO_DECIDEGREE;
 
     aircraftYawInRad = atan2(2 * ((double) quaternion.q0 * quaternion.q3 + (double) quaternion.q1 * quaternion.q2),
                              (double) 1 -
                              2 * ((double) quaternion.q2 * quaternion.q2 + (double) quaternion.q3 * quaternion.q3));
-    attitude->yaw = aircraftYawInRad * 180 / DJI_PI * 10;
+    attitude->yaw = aircraftYawInRad * PAYLOAD_GIMBAL_RAD_TO_DECIDEGREE;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_GimbalQuaternionCallback(const uint8_t *data, uint16_t dataSize,
+                                                        const T_DjiDataTimestamp *timestamp)
+{
+    T_DjiFcSubscriptionQuaternion quaternion;
+
+    if (data == NULL || dataSize < sizeof(T_DjiFcSubscriptionQuaternion)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    memcpy(&quaternion, data, sizeof(T_DjiFcSubscriptionQuaternion));
+    DjiTest_GimbalUpdateAircraftAttitude(quaternion, timestamp);
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
+/**
+ * @brief Convert a received quaternion to the ground attitude of the aircraft and publish it to the gimbal task. The
+ * trigonometry runs here, once per sample, instead of in the 1 kHz gimbal task.
+ */
+static void DjiTest_GimbalUpdateAircraftAttitude(T_DjiFcSubscriptionQuaternion quaternion,
+                                                 const T_DjiDataTimestamp *timestamp)
+{
+    T_DjiAttitude3d attitude = {0};
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (DjiTest_GimbalCalculateGroundAttitudeBaseQuaternion(quaternion, &attitude) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("calculate and update aircraft attitude error.");
+        return;
+    }
+
+    if (osalHandler->MutexLock(s_aircraftAttitudeFeedMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("mutex lock error");
+        return;
+    }
+
+    s_aircraftAttitudeFeed.sequence++;
+    PAYLOAD_GIMBAL_BARRIER();
+
+    s_aircraftAttitudeFeed.attitude = attitude;
+    if (timestamp != NULL) {
+        s_aircraftAttitudeFeed.timestamp = *timestamp;
+    }
+
+    PAYLOAD_GIMBAL_BARRIER();
+    s_aircraftAttitudeFeed.sequence++;
+
+    if (osalHandler->MutexUnlock(s_aircraftAttitudeFeedMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("mutex unlock error");
+    }
+}
+
+/**
+ * @brief Read the latest aircraft attitude without blocking the gimbal task.
+ * @param sequence: sequence of the attitude read, it only changes when a new attitude is published.
+ * @param attitude: aircraft attitude, unit: 0.1 degree.
+ * @return False if a writer kept the feed busy, the caller keeps its previous attitude and tries again next cycle.
+ */
+static bool DjiTest_GimbalReadAircraftAttitude(uint32_t *sequence, T_DjiAttitude3d *attitude)
+{
+    uint32_t sequenceBegin;
+    uint8_t retryTimes;
+
+    for (retryTimes = 0; retryTimes < PAYLOAD_GIMBAL_SEQLOCK_RETRY_TIMES; retryTimes++) {
+        sequenceBegin = s_aircraftAttitudeFeed.sequence;
+        if (sequenceBegin & 1) {
+            continue;
+        }
+
+        PAYLOAD_GIMBAL_BARRIER();
+        *attitude = s_aircraftAttitudeFeed.attitude;
+        PAYLOAD_GIMBAL_BARRIER();
+
+        if (s_aircraftAttitudeFeed.sequence == sequenceBegin) {
+            *sequence = sequenceBegin;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Run the stabilization and the rotation of one control cycle and publish the resulting state.
+ * @param aircraftAttitude: new aircraft attitude to follow, NULL if the aircraft attitude did not change.
+ * @param cycleTime: time elapsed since the previous cycle, unit: s. Cycles skipped by the scheduler are integrated
+ * here so the rotation speed holds even when the task falls behind.
+ * @return Execution result.
+ */
+static T_DjiReturnCode DjiTest_GimbalRunControlCycle(const T_DjiAttitude3d *aircraftAttitude, float cycleTime)
+{
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    T_DjiAttitude3f nextAttitude = {0};
+    T_DjiAttitude3f attitudeFTemp = {0};
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (osalHandler->MutexLock(s_attitudeMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("mutex lock error");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+
+    if (osalHandler->MutexLock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("mutex lock error");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+        goto out2;
+    }
+
+    s_gimbalStateChangedFlag = false;
+    s_gimbalControlCycleCount++;
+
+    // update aircraft attitude
+    if (aircraftAttitude != NULL) {
+        s_aircraftAttitude = *aircraftAttitude;
+    }
+
+    // stable control
+    switch (s_systemState.gimbalMode) {
+        case DJI_GIMBAL_MODE_FREE:
+            break;
+        case DJI_GIMBAL_MODE_FPV:
+            s_attitudeInformation.attitude.roll += (s_aircraftAttitude.roll - s_lastAircraftAttitude.roll);
+            s_attitudeInformation.attitude.yaw += (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
+
+            s_attitudeHighPrecision.roll += (float) (s_aircraftAttitude.roll - s_lastAircraftAttitude.roll);
+            s_attitudeHighPrecision.yaw += (float) (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
+
+            if (s_rotatingFlag == true && s_controlType == TEST_GIMBAL_CONTROL_TYPE_ANGLE) {
+                s_targetAttitude.roll += (s_aircraftAttitude.roll - s_lastAircraftAttitude.roll);
+                s_targetAttitude.yaw += (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
+            }
+            break;
+        case DJI_GIMBAL_MODE_YAW_FOLLOW:
+            s_attitudeInformation.attitude.yaw += (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
+
+            s_attitudeHighPrecision.yaw += (float) (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
+
+            if (s_rotatingFlag == true && s_controlType == TEST_GIMBAL_CONTROL_TYPE_ANGLE) {
+                s_targetAttitude.yaw += (s_aircraftAttitude.yaw - s_lastAircraftAttitude.yaw);
+            }
+            break;
+        default:
+            USER_LOG_ERROR("gimbal mode invalid: %d.", s_systemState.gimbalMode);
+    }
+    s_lastAircraftAttitude = s_aircraftAttitude;
+
+    attitudeFTemp.pitch = s_attitudeInformation.attitude.pitch;
+    attitudeFTemp.roll = s_attitudeInformation.attitude.roll;
+    attitudeFTemp.yaw = s_attitudeInformation.attitude.yaw;
+    DjiTest_GimbalAngleLegalization(&attitudeFTemp, s_aircraftAttitude, &s_attitudeInformation.reachLimitFlag);
+    s_attitudeInformation.attitude.pitch = attitudeFTemp.pitch;
+    s_attitudeInformation.attitude.roll = attitudeFTemp.roll;
+    s_attitudeInformation.attitude.yaw = attitudeFTemp.yaw;
+
+    DjiTest_GimbalAngleLegalization(&s_attitudeHighPrecision, s_aircraftAttitude, NULL);
+
+    attitudeFTemp.pitch = s_targetAttitude.pitch;
+    attitudeFTemp.roll = s_targetAttitude.roll;
+    attitudeFTemp.yaw = s_targetAttitude.yaw;
+    DjiTest_GimbalAngleLegalization(&attitudeFTemp, s_aircraftAttitude, NULL);
+    s_targetAttitude.pitch = attitudeFTemp.pitch;
+    s_targetAttitude.roll = attitudeFTemp.roll;
+    s_targetAttitude.yaw = attitudeFTemp.yaw;
+
+    // rotation
+    if (s_rotatingFlag != true)
+        goto out1;
+
+    nextAttitude.pitch = (float) s_attitudeHighPrecision.pitch + (float) s_speed.pitch * cycleTime;
+    nextAttitude.roll = (float) s_attitudeHighPrecision.roll + (float) s_speed.roll * cycleTime;
+    nextAttitude.yaw = (float) s_attitudeHighPrecision.yaw + (float) s_speed.yaw * cycleTime;
+
+    if (s_controlType == TEST_GIMBAL_CONTROL_TYPE_ANGLE) {
+        nextAttitude.pitch =
+            (nextAttitude.pitch - s_targetAttitude.pitch) * s_speed.pitch >= 0 ? s_targetAttitude.pitch
+                                                                               : nextAttitude.pitch;
+        nextAttitude.roll = (nextAttitude.roll - s_targetAttitude.roll) * s_speed.roll >= 0 ? s_targetAttitude.roll
+                                                                                            : nextAttitude.roll;
+        nextAttitude.yaw =
+            (nextAttitude.yaw - s_targetAttitude.yaw) * s_speed.yaw >= 0 ? s_targetAttitude.yaw : nextAttitude.yaw;
+    }
+
+    DjiTest_GimbalAngleLegalization(&nextAttitude, s_aircraftAttitude, &s_attitudeInformation.reachLimitFlag);
+    s_attitudeInformation.attitude.pitch = nextAttitude.pitch;
+    s_attitudeInformation.attitude.roll = nextAttitude.roll;
+    s_attitudeInformation.attitude.yaw = nextAttitude.yaw;
+
+    s_attitudeHighPrecision.pitch = nextAttitude.pitch;
+    s_attitudeHighPrecision.roll = nextAttitude.roll;
+    s_attitudeHighPrecision.yaw = nextAttitude.yaw;
+
+    if (s_controlType == TEST_GIMBAL_CONTROL_TYPE_ANGLE) {
+        if (memcmp(&s_attitudeInformation.attitude, &s_targetAttitude, sizeof(T_DjiAttitude3d)) == 0) {
+            s_rotatingFlag = false;
+        }
+    } else if (s_controlType == TEST_GIMBAL_CONTROL_TYPE_SPEED) {
+        if ((s_attitudeInformation.reachLimitFlag.pitch == true || s_speed.pitch == 0) &&
+            (s_attitudeInformation.reachLimitFlag.roll == true || s_speed.roll == 0) &&
+            (s_attitudeInformation.reachLimitFlag.yaw == true || s_speed.yaw == 0)) {
+            s_rotatingFlag = false;
+        }
+    }
+
+out1:
+    DjiTest_GimbalPublishState();
+
+    if (osalHandler->MutexUnlock(s_commonMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("mutex unlock error");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+        goto out2;
+    }
+
+out2:
+    if (osalHandler->MutexUnlock(s_attitudeMutex) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("mutex unlock error");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
+
+    return returnCode;
+}
+
+/**
+ * @brief Copy the gimbal state to the snapshot read by the getters, called with the attitude and common mutex held.
+ */
+static void DjiTest_GimbalPublishState(void)
+{
+    s_stateSnapshot.sequence++;
+    PAYLOAD_GIMBAL_BARRIER();
+
+    s_stateSnapshot.attitudeInformation = s_attitudeInformation;
+    s_stateSnapshot.speed = s_speed;
+    s_stateSnapshot.jointAngle.pitch = s_attitudeInformation.attitude.pitch - s_aircraftAttitude.pitch;
+    s_stateSnapshot.jointAngle.roll = s_attitudeInformation.attitude.roll - s_aircraftAttitude.roll;
+    s_stateSnapshot.jointAngle.yaw = s_attitudeInformation.attitude.yaw - s_aircraftAttitude.yaw;
+    s_stateSnapshot.fineTuneAngle = s_systemState.fineTuneAngle;
+
+    PAYLOAD_GIMBAL_BARRIER();
+    s_stateSnapshot.sequence++;
+}
+
+/**
+ * @brief Read the published gimbal state without taking the gimbal mutexes. The state lags the commands by at most one
+ * control cycle.
+ * @param snapshot: state read.
+ * @return False if the gimbal task kept the snapshot busy, the caller then reads the state under the mutexes.
+ */
+static bool DjiTest_GimbalReadState(T_TestGimbalStateSnapshot *snapshot)
+{
+    uint32_t sequenceBegin;
+    uint8_t retryTimes;
+
+    for (retryTimes = 0; retryTimes < PAYLOAD_GIMBAL_SEQLOCK_RETRY_TIMES; retryTimes++) {
+        sequenceBegin = s_stateSnapshot.sequence;
+        if (sequenceBegin & 1) {
+            continue;
+        }
+
+        PAYLOAD_GIMBAL_BARRIER();
+        snapshot->attitudeInformation = s_stateSnapshot.attitudeInformation;
+        snapshot->speed = s_stateSnapshot.speed;
+        snapshot->jointAngle = s_stateSnapshot.jointAngle;
+        snapshot->fineTuneAngle = s_stateSnapshot.fineTuneAngle;
+        PAYLOAD_GIMBAL_BARRIER();
+
+        if (s_stateSnapshot.sequence == sequenceBegin) {
+            snapshot->sequence = sequenceBegin;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void DjiTest_GimbalPrintLoopStatistics(void)
+{
+    UtilPeriodic_PrintStatistics(&s_gimbalPeriodic, "gimbal emu");
+    USER_LOG_INFO("[gimbal emu] control cycles %u, aircraft attitude updates %u.", s_gimbalControlCycleCount,
+                  s_aircraftAttitudeFeed.sequence / 2);
+}
+
 /****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -30,6 +30,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "dji_typedef.h"
 #include "dji_gimbal.h"
+#include "dji_fc_subscription.h"
 
 #ifdef __cplusplus
 extern "C" {
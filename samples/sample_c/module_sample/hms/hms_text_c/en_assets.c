@@ -0,0 +1,65 @@
+/* Generated by asset_packer, do not edit manually */
+#include "en_assets.h"
+
+#ifndef SYSTEM_ARCH_LINUX
+
+/* hms_text_config.json: 2783 bytes, lz4 568 bytes */
+static const uint8_t s_hmsTextEnAssetPackBlob[568] = {
+    0xF0, 0x00, 0x7B, 0x0A, 0x20, 0x20, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0x3A,
+    0x20, 0x0F, 0x00, 0xF0, 0x01, 0x20, 0x20, 0x22, 0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x22, 0x3A, 0x20,
+    0x31, 0x2C, 0x0A, 0x20, 0x20, 0x10, 0x00, 0x21, 0x69, 0x6E, 0x10, 0x00, 0x50, 0x30, 0x0A, 0x20,
+    0x20, 0x7D, 0x14, 0x00, 0xD6, 0x22, 0x68, 0x6D, 0x73, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61,
+    0x73, 0x65, 0x38, 0x00, 0x00, 0x16, 0x00, 0xF5, 0x0B, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F,
+    0x6E, 0x5F, 0x64, 0x65, 0x73, 0x63, 0x22, 0x3A, 0x20, 0x22, 0x50, 0x61, 0x79, 0x6C, 0x6F, 0x61,
+    0x64, 0x20, 0x25, 0x1A, 0x00, 0x60, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x22, 0x48, 0x00, 0x21, 0x20,
+    0x20, 0x4A, 0x00, 0xF1, 0x04, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x5F, 0x63, 0x6F, 0x64, 0x65, 0x5F,
+    0x6C, 0x69, 0x73, 0x74, 0x22, 0x3A, 0x20, 0x5B, 0x79, 0x00, 0x13, 0x20, 0x91, 0x00, 0x01, 0x85,
+    0x00, 0x00, 0x5D, 0x00, 0x06, 0x29, 0x00, 0x00, 0x5A, 0x00, 0xA3, 0x30, 0x78, 0x31, 0x45, 0x30,
+    0x32, 0x30, 0x30, 0x30, 0x30, 0x4D, 0x00, 0x05, 0x28, 0x00, 0x86, 0x69, 0x6E, 0x74, 0x65, 0x72,
+    0x66, 0x61, 0x63, 0x9C, 0x00, 0x00, 0x1B, 0x00, 0x00, 0xCA, 0x00, 0xB0, 0x65, 0x73, 0x73, 0x61,
+    0x67, 0x65, 0x5F, 0x74, 0x69, 0x74, 0x6C, 0x1D, 0x00, 0xF1, 0x06, 0x22, 0x48, 0x4D, 0x53, 0x20,
+    0x74, 0x65, 0x73, 0x74, 0x20, 0x74, 0x65, 0x78, 0x74, 0x3A, 0x20, 0x49, 0x20, 0x61, 0x6D, 0x20,
+    0x66, 0x00, 0x10, 0x20, 0x8F, 0x00, 0x20, 0x20, 0x54, 0x28, 0x00, 0x18, 0x20, 0x60, 0x00, 0x07,
+    0x45, 0x00, 0x60, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0xAF, 0x00, 0x0F, 0x47, 0x00, 0x0D, 0x12,
+    0x43, 0x2A, 0x00, 0x33, 0x20, 0x30, 0x22, 0xD8, 0x00, 0x03, 0x48, 0x01, 0x03, 0x96, 0x00, 0x4F,
+    0x66, 0x70, 0x76, 0x5F, 0xB3, 0x00, 0x0E, 0xD0, 0x6F, 0x6E, 0x5F, 0x74, 0x68, 0x65, 0x5F, 0x67,
+    0x72, 0x6F, 0x75, 0x6E, 0x64, 0xFF, 0x00, 0x0D, 0xBB, 0x00, 0x33, 0x67, 0x6F, 0x74, 0xBC, 0x00,
+    0x72, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x2C, 0x00, 0x0C, 0xBF, 0x00, 0xFC, 0x01, 0x69,
+    0x73, 0x5F, 0x6B, 0x65, 0x65, 0x70, 0x5F, 0x68, 0x69, 0x73, 0x74, 0x6F, 0x72, 0x79, 0x5F, 0x59,
+    0x00, 0x52, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x9E, 0x01, 0x03, 0xA0, 0x00, 0x13, 0x6D, 0x36, 0x01,
+    0x12, 0x69, 0x83, 0x00, 0x3F, 0x73, 0x6B, 0x79, 0x80, 0x00, 0x0C, 0x12, 0x69, 0x80, 0x00, 0x3F,
+    0x73, 0x6B, 0x79, 0x7D, 0x00, 0x0D, 0x09, 0x53, 0x00, 0x01, 0x7A, 0x00, 0x06, 0x22, 0x01, 0x03,
+    0x0A, 0x00, 0x01, 0x72, 0x02, 0x00, 0x8A, 0x00, 0x02, 0x9E, 0x02, 0x00, 0x0A, 0x00, 0x0B, 0x36,
+    0x02, 0x00, 0x8E, 0x00, 0x05, 0x0D, 0x02, 0x1F, 0x31, 0x0D, 0x02, 0x4C, 0x08, 0x60, 0x00, 0x0F,
+    0x0D, 0x02, 0x2A, 0x1F, 0x31, 0x0D, 0x02, 0x62, 0x0B, 0xBF, 0x00, 0x0F, 0x0D, 0x02, 0x5B, 0x0F,
+    0x7D, 0x00, 0x0C, 0x0F, 0x0D, 0x02, 0x3F, 0x1F, 0x32, 0x0D, 0x02, 0x4C, 0x08, 0x60, 0x00, 0x0F,
+    0x0D, 0x02, 0x2A, 0x1F, 0x32, 0x0D, 0x02, 0x62, 0x0B, 0xBF, 0x00, 0x0F, 0x0D, 0x02, 0x0D, 0x3F,
+    0x74, 0x72, 0x75, 0x19, 0x04, 0x37, 0x0F, 0x7C, 0x00, 0x0C, 0x09, 0x0C, 0x02, 0x00, 0x79, 0x00,
+    0x03, 0x0E, 0x04, 0x33, 0x20, 0x20, 0x7D, 0x0A, 0x00, 0x0F, 0x18, 0x04, 0x1C, 0x1F, 0x33, 0x0B,
+    0x02, 0x4C, 0x08, 0x60, 0x00, 0x0F, 0x0B, 0x02, 0x2A, 0x1F, 0x33, 0x0B, 0x02, 0x62, 0x0B, 0xBF,
+    0x00, 0x0F, 0x0B, 0x02, 0x5A, 0x0F, 0x7C, 0x00, 0x0C, 0x0F, 0x0B, 0x02, 0x3E, 0x1F, 0x34, 0x0B,
+    0x02, 0x4C, 0x08, 0x60, 0x00, 0x0F, 0x0B, 0x02, 0x2A, 0x1F, 0x34, 0x0B, 0x02, 0x62, 0x0B, 0xBF,
+    0x00, 0x0F, 0x0B, 0x02, 0x5A, 0x0F, 0x7C, 0x00, 0x0C, 0x0F, 0x0B, 0x02, 0x10, 0x01, 0x1E, 0x04,
+    0x70, 0x5D, 0x0A, 0x20, 0x20, 0x7D, 0x0A, 0x7D,
+};
+
+static const T_UtilAssetEntry s_hmsTextEnAssetPackEntries[1] = {
+    {"hms_text_config.json", 0x1801EC62u, 0, 568, 2783, UTIL_ASSET_COMPRESSION_LZ4},
+};
+
+static const uint16_t s_hmsTextEnAssetPackBuckets[2] = {
+    1, 0,
+};
+
+static uint8_t *s_hmsTextEnAssetPackCache[1];
+
+const T_UtilAssetPack g_hmsTextEnAssetPack = {
+    s_hmsTextEnAssetPackBlob,
+    s_hmsTextEnAssetPackEntries,
+    1,
+    s_hmsTextEnAssetPackBuckets,
+    1,
+    s_hmsTextEnAssetPackCache
+};
+
+#endif
@@ -0,0 +1,19 @@
+/* Generated by asset_packer, do not edit manually */
+#ifndef HMS_TEXT_EN_ASSET_PACK_H
+#define HMS_TEXT_EN_ASSET_PACK_H
+
+#include "utils/util_asset.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HMS_TEXT_EN_ASSET_PACK_ENTRY_COUNT        (1)
+
+extern const T_UtilAssetPack g_hmsTextEnAssetPack;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -33,7 +33,7 @@
 #include "dji_logger.h"
 #include "dji_platform.h"
 #include "dji_fc_subscription.h"
-#include "hms_text_c/en/hms_text_config_json.h"
+#include "hms_text_c/en_assets.h"
 
 /* Private constants ---------------------------------------------------------*/
 #define MAX_HMS_PRINT_COUNT              (150)
@@ -52,7 +52,7 @@ static const char *oldReplaceAlarmIdStr = "%alarmid";
 static const char *oldReplaceIndexStr = "%index";
 static const char *oldReplaceComponentIndexStr = "%component_index";
 static T_DjiHmsFileBinaryArray s_EnHmsTextConfigFileBinaryArrayList[] = {
-    {hms_text_config_json_fileName, hms_text_config_json_fileSize, hms_text_config_json_fileBinaryArray},
+    {"hms_text_config.json", 0, NULL},
 };
 static uint8_t *s_hmsJsonData = NULL;
 static E_DjiMobileAppLanguage s_hmsLanguage = DJI_MOBILE_APP_LANGUAGE_ENGLISH;
@@ -159,6 +159,14 @@ T_DjiReturnCode DjiTest_HmsCustomizationStartService(void)
     }
 #else
     //Step 2 : Set hms text Config (RTOS environment)
+    returnCode = UtilAsset_Load(&g_hmsTextEnAssetPack, s_EnHmsTextConfigFileBinaryArrayList[0].fileName,
+                                &s_EnHmsTextConfigFileBinaryArrayList[0].fileBinaryArray,
+                                &s_EnHmsTextConfigFileBinaryArrayList[0].fileSize);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Load hms text config asset error, stat = 0x%08llX", returnCode);
+        return returnCode;
+    }
+
     T_DjiHmsBinaryArrayConfig enHmsTextBinaryArrayConfig = {
         .binaryArrayCount = sizeof(s_EnHmsTextConfigFileBinaryArrayList) / sizeof(T_DjiHmsFileBinaryArray),
         .fileBinaryArrayList = s_EnHmsTextConfigFileBinaryArrayList
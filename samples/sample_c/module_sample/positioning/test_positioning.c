@@ -24,9 +24,10 @@
 
 
 /* Includes ------------------------------------------------------------------*/
+#include <string.h>
 #include <fc_subscription/test_fc_subscription.h>
 #include "test_positioning.h"
-#include "dji_positioning.h"
+#include "test_positioning_rtcm_journal.h"
 #include "dji_logger.h"
 #include "utils/util_misc.h"
 #include "dji_platform.h"
@@ -41,15 +42,38 @@
 /* Private constants ---------------------------------------------------------*/
 #define POSITIONING_TASK_FREQ                     (1)
 #define POSITIONING_TASK_STACK_SIZE               (2048)
-#define TEST_RTCM_FILE_PATH_STR_MAX_SIZE          (64)
+#define TEST_RTCM_FILE_PATH_STR_MAX_SIZE          (DJI_TEST_POSITIONING_RTCM_JOURNAL_PREFIX_MAX_SIZE)
 
 #define DJI_TEST_POSITIONING_EVENT_COUNT          (2)
 #define DJI_TEST_TIME_INTERVAL_AMONG_EVENTS_US    (200000)
 
+/* Window of the event timestamps accepted by DjiPositioning_GetPositionInformationSync(), before the newest pps. */
+#define DJI_TEST_POSITIONING_EVENT_MIN_AGE_US     (1000000)
+#define DJI_TEST_POSITIONING_EVENT_MAX_AGE_US     (2000000)
+#define DJI_TEST_POSITIONING_EVENT_POLL_MS        (100)
+
+#define DJI_TEST_RTCM_FRAME_PREAMBLE              (0xD3)
+#define DJI_TEST_RTCM_FRAME_HEADER_SIZE           (3)
+#define DJI_TEST_RTCM_FRAME_CRC_SIZE              (3)
+#define DJI_TEST_RTCM_FRAME_PAYLOAD_SIZE_MAX      (1023)
+#define DJI_TEST_RTCM_FRAME_SIZE_MAX              (DJI_TEST_RTCM_FRAME_HEADER_SIZE + DJI_TEST_RTCM_FRAME_PAYLOAD_SIZE_MAX + \
+                                                   DJI_TEST_RTCM_FRAME_CRC_SIZE)
+#define DJI_TEST_RTCM_REPLAY_BUFFER_SIZE          (2 * DJI_TEST_RTCM_FRAME_SIZE_MAX)
+#define DJI_TEST_RTCM_REPLAY_SLOW_CALLBACK_US     (1000)
+
 /* Private types -------------------------------------------------------------*/
 
 /* Private functions declaration ---------------------------------------------*/
 static void *DjiTest_PositioningTask(void *arg);
+static void *DjiTest_PositioningEventTask(void *arg);
+static uint8_t DjiTest_PositioningTakeDueEvents(uint64_t ppsNewestTriggerTimeUs, T_DjiTestPositioningEvent *batch,
+                                                T_DjiTestPositioningEvent *expiredEvents, uint8_t *expiredCount);
+static void DjiTest_PositioningRequestBatch(T_DjiTestPositioningEvent *batch, uint8_t batchCount);
+#ifndef SYSTEM_ARCH_LINUX
+static void DjiTest_PositioningPrintResult(const T_DjiTestPositioningEvent *event,
+                                           const T_DjiPositioningPositionInfo *positionInfo, T_DjiReturnCode result);
+#endif
+static uint32_t DjiTest_RtcmCrc24q(const uint8_t *data, uint32_t len);
 static T_DjiReturnCode DjiTest_ReceiveRtkOnAircraftRtcmDataCallback(uint8_t index, const uint8_t *data,
                                                                     uint16_t dataLen);
 static T_DjiReturnCode DjiTest_ReceiveRtkBaseStationRtcmDataCallback(uint8_t index, const uint8_t *data,
@@ -57,15 +81,26 @@ static T_DjiReturnCode DjiTest_ReceiveRtkBaseStationRtcmDataCallback(uint8_t ind
 
 /* Private variables ---------------------------------------------------------*/
 static T_DjiTaskHandle s_userPositioningThread;
+static T_DjiTaskHandle s_positioningEventThread;
 static int32_t s_eventIndex = 0;
-static char s_rtkOnAircraftRtcmFilePath[TEST_RTCM_FILE_PATH_STR_MAX_SIZE];
-static char s_rtkBaseStationRtcmFilePath[TEST_RTCM_FILE_PATH_STR_MAX_SIZE];
+static T_DjiMutexHandle s_positioningEventMutex = NULL;
+static T_DjiSemaHandle s_positioningEventSema = NULL;
+static DjiTestPositioningResultCallback s_positioningResultCallback = NULL;
+static T_DjiTestPositioningEvent s_positioningEventQueue[DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE];
+static T_DjiTestPositioningEvent s_positioningExpiredEvents[DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE];
+static uint16_t s_positioningEventCount = 0;
+static T_DjiTestPositioningEventStatistics s_positioningEventStatistics = {0};
 
 /* Exported functions definition ---------------------------------------------*/
 T_DjiReturnCode DjiTest_PositioningStartService(void)
 {
     T_DjiReturnCode djiStat;
+#ifndef SYSTEM_ARCH_LINUX
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+#else
+    char rtkOnAircraftRtcmFilePrefix[TEST_RTCM_FILE_PATH_STR_MAX_SIZE];
+    char rtkBaseStationRtcmFilePrefix[TEST_RTCM_FILE_PATH_STR_MAX_SIZE];
+#endif
 
     djiStat = DjiPositioning_Init();
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -76,6 +111,12 @@ T_DjiReturnCode DjiTest_PositioningStartService(void)
     DjiPositioning_SetTaskIndex(0);
 
 #ifndef SYSTEM_ARCH_LINUX
+    djiStat = DjiTest_PositioningEventServiceStart(DjiTest_PositioningPrintResult);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("positioning event service start error.");
+        return djiStat;
+    }
+
     if (osalHandler->TaskCreate("user_positioning_task", DjiTest_PositioningTask,
                                 POSITIONING_TASK_STACK_SIZE, NULL, &s_userPositioningThread) !=
         DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -87,14 +128,16 @@ T_DjiReturnCode DjiTest_PositioningStartService(void)
     struct tm *localTime = NULL;
 
     localTime = localtime(&currentTime);
-    sprintf(s_rtkOnAircraftRtcmFilePath, "rtk_on_aircraft_%04d%02d%02d_%02d-%02d-%02d.rtcm",
-            localTime->tm_year + 1900, localTime->tm_mon + 1, localTime->tm_mday,
-            localTime->tm_hour, localTime->tm_min, localTime->tm_sec);
+    strftime(rtkOnAircraftRtcmFilePrefix, sizeof(rtkOnAircraftRtcmFilePrefix), "rtk_on_aircraft_%Y%m%d_%H-%M-%S",
+             localTime);
+    strftime(rtkBaseStationRtcmFilePrefix, sizeof(rtkBaseStationRtcmFilePrefix), "rtk_base_station_%Y%m%d_%H-%M-%S",
+             localTime);
 
-    localTime = localtime(&currentTime);
-    sprintf(s_rtkBaseStationRtcmFilePath, "rtk_base_station_%04d%02d%02d_%02d-%02d-%02d.rtcm",
-            localTime->tm_year + 1900, localTime->tm_mon + 1, localTime->tm_mday,
-            localTime->tm_hour, localTime->tm_min, localTime->tm_sec);
+    djiStat = DjiTest_PositioningRtcmJournalStart(NULL, rtkOnAircraftRtcmFilePrefix, rtkBaseStationRtcmFilePrefix);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Start rtcm journal error.");
+        return djiStat;
+    }
 #endif
     djiStat = DjiPositioning_RegReceiveRtcmDataCallback(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_BASE_STATION,
                                                         DjiTest_ReceiveRtkBaseStationRtcmDataCallback);
@@ -113,6 +156,244 @@ T_DjiReturnCode DjiTest_PositioningStartService(void)
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
+/**
+ * @brief Start the task requesting the position of the submitted events, in batches of up to
+ * DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX events per request.
+ * @note Positioning module and time synchronization have to be initialized before.
+ * @param callback: called from the service task with the position of every submitted event.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_PositioningEventServiceStart(DjiTestPositioningResultCallback callback)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+
+    if (callback == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_positioningEventMutex != NULL) {
+        USER_LOG_ERROR("Positioning event service is already running.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    returnCode = osalHandler->MutexCreate(&s_positioningEventMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+    returnCode = osalHandler->SemaphoreCreate(0, &s_positioningEventSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto destroyMutex;
+    }
+
+    s_positioningResultCallback = callback;
+    s_positioningEventCount = 0;
+    memset(&s_positioningEventStatistics, 0, sizeof(s_positioningEventStatistics));
+
+    returnCode = osalHandler->TaskCreate("positioning_event", DjiTest_PositioningEventTask,
+                                         POSITIONING_TASK_STACK_SIZE, NULL, &s_positioningEventThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create positioning event task error: 0x%08llX.", returnCode);
+        goto destroySema;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+destroySema:
+    osalHandler->SemaphoreDestroy(s_positioningEventSema);
+    s_positioningEventSema = NULL;
+destroyMutex:
+    osalHandler->MutexDestroy(s_positioningEventMutex);
+    s_positioningEventMutex = NULL;
+    return returnCode;
+}
+
+/**
+ * @brief Queue events for the position service, can be called from the camera trigger handlers.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE if the queue was full and events were dropped.
+ */
+T_DjiReturnCode DjiTest_PositioningSubmitEvents(const T_DjiTestPositioningEvent *events, uint16_t count)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint16_t acceptedCount;
+
+    if (events == NULL || count == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_positioningEventMutex == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_positioningEventMutex);
+    acceptedCount = USER_UTIL_MIN(count, DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE - s_positioningEventCount);
+    memcpy(&s_positioningEventQueue[s_positioningEventCount], events, acceptedCount * sizeof(events[0]));
+    s_positioningEventCount += acceptedCount;
+    s_positioningEventStatistics.submittedCount += count;
+    s_positioningEventStatistics.droppedCount += count - acceptedCount;
+    if (s_positioningEventCount > s_positioningEventStatistics.maxQueuedCount) {
+        s_positioningEventStatistics.maxQueuedCount = s_positioningEventCount;
+    }
+    osalHandler->MutexUnlock(s_positioningEventMutex);
+
+    osalHandler->SemaphorePost(s_positioningEventSema);
+
+    if (acceptedCount != count) {
+        USER_LOG_WARN("Positioning event queue is full, %d events dropped.", count - acceptedCount);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_PositioningGetEventStatistics(T_DjiTestPositioningEventStatistics *statistics)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (statistics == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_positioningEventMutex == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_positioningEventMutex);
+    *statistics = s_positioningEventStatistics;
+    osalHandler->MutexUnlock(s_positioningEventMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Feed a recorded rtcm file to the rtk on aircraft rtcm data callback, one rtcm 3 frame per call, and measure
+ * how long the callback holds the calling thread. Stands in for the aircraft when checking the journal.
+ * @note The rtcm journal of the service is used if it is running, otherwise a journal is started for the replay.
+ * @param filePath: recorded rtcm file, such as a journal part.
+ * @param frameIntervalMs: time between two frames, 0 replays as fast as possible.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_PositioningRunRtcmReplay(const char *filePath, uint32_t frameIntervalMs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiFileSystemHandler *fileSystemHandler = DjiPlatform_GetFileSystemHandler();
+    T_DjiTestPositioningRtcmJournalStatistics journalStatistics = {0};
+    T_DjiFileHandle replayFile = NULL;
+    T_DjiReturnCode returnCode;
+    uint8_t *buffer;
+    uint32_t bufferedLen = 0;
+    uint32_t readLen = 0;
+    uint32_t offset = 0;
+    uint32_t frameLen;
+    uint32_t frameCount = 0;
+    uint32_t skippedBytes = 0;
+    uint32_t slowCallbackCount = 0;
+    uint64_t totalLatencyUs = 0;
+    uint64_t maxLatencyUs = 0;
+    uint64_t startTimeUs = 0;
+    uint64_t endTimeUs = 0;
+    bool isJournalStarted = false;
+    bool isEndOfFile = false;
+
+    if (filePath == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (fileSystemHandler == NULL || fileSystemHandler->FileOpen == NULL) {
+        USER_LOG_ERROR("File system handler is not registered, can not replay rtcm data.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    returnCode = fileSystemHandler->FileOpen(filePath, "rb", &replayFile);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Open rtcm replay file %s error: 0x%08llX.", filePath, returnCode);
+        return returnCode;
+    }
+
+    buffer = osalHandler->Malloc(DJI_TEST_RTCM_REPLAY_BUFFER_SIZE);
+    if (buffer == NULL) {
+        fileSystemHandler->FileClose(replayFile);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    if (DjiTest_PositioningRtcmJournalIsRunning() == false) {
+        returnCode = DjiTest_PositioningRtcmJournalStart(NULL, "rtk_replay_on_aircraft", "rtk_replay_base_station");
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Start rtcm journal for the replay error: 0x%08llX.", returnCode);
+            osalHandler->Free(buffer);
+            fileSystemHandler->FileClose(replayFile);
+            return returnCode;
+        }
+        isJournalStarted = true;
+    }
+
+    USER_LOG_INFO("Replay rtcm file %s, one frame every %u ms.", filePath, frameIntervalMs);
+    while (1) {
+        if (isEndOfFile == false && bufferedLen - offset < DJI_TEST_RTCM_FRAME_SIZE_MAX) {
+            memmove(buffer, &buffer[offset], bufferedLen - offset);
+            bufferedLen -= offset;
+            offset = 0;
+            readLen = 0;
+            returnCode = fileSystemHandler->FileRead(replayFile, &buffer[bufferedLen],
+                                                     DJI_TEST_RTCM_REPLAY_BUFFER_SIZE - bufferedLen, &readLen);
+            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS || readLen == 0) {
+                isEndOfFile = true;
+            }
+            bufferedLen += readLen;
+        }
+
+        if (bufferedLen - offset < DJI_TEST_RTCM_FRAME_HEADER_SIZE + DJI_TEST_RTCM_FRAME_CRC_SIZE) {
+            skippedBytes += bufferedLen - offset;
+            break;
+        }
+
+        // Resynchronize byte by byte on anything that is not a complete frame with a valid crc.
+        frameLen = DJI_TEST_RTCM_FRAME_HEADER_SIZE + (((buffer[offset + 1] & 0x03) << 8) | buffer[offset + 2]) +
+                   DJI_TEST_RTCM_FRAME_CRC_SIZE;
+        if (buffer[offset] != DJI_TEST_RTCM_FRAME_PREAMBLE || frameLen > bufferedLen - offset ||
+            DjiTest_RtcmCrc24q(&buffer[offset], frameLen - DJI_TEST_RTCM_FRAME_CRC_SIZE) !=
+            (((uint32_t) buffer[offset + frameLen - 3] << 16) | ((uint32_t) buffer[offset + frameLen - 2] << 8) |
+             buffer[offset + frameLen - 1])) {
+            offset++;
+            skippedBytes++;
+            continue;
+        }
+
+        osalHandler->GetTimeUs(&startTimeUs);
+        DjiTest_ReceiveRtkOnAircraftRtcmDataCallback(0, &buffer[offset], (uint16_t) frameLen);
+        osalHandler->GetTimeUs(&endTimeUs);
+
+        totalLatencyUs += endTimeUs - startTimeUs;
+        if (endTimeUs - startTimeUs > maxLatencyUs) {
+            maxLatencyUs = endTimeUs - startTimeUs;
+        }
+        if (endTimeUs - startTimeUs > DJI_TEST_RTCM_REPLAY_SLOW_CALLBACK_US) {
+            slowCallbackCount++;
+        }
+        frameCount++;
+        offset += frameLen;
+
+        if (frameIntervalMs > 0) {
+            osalHandler->TaskSleepMs(frameIntervalMs);
+        }
+    }
+
+    DjiTest_PositioningRtcmJournalGetStatistics(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT, &journalStatistics);
+    if (isJournalStarted) {
+        DjiTest_PositioningRtcmJournalStop();
+    }
+    osalHandler->Free(buffer);
+    fileSystemHandler->FileClose(replayFile);
+
+    USER_LOG_INFO("Replayed %u rtcm frames, %u bytes skipped, journal dropped %u of %u bytes.", frameCount,
+                  skippedBytes, journalStatistics.droppedBytes, journalStatistics.receivedBytes);
+    USER_LOG_INFO("Rtcm callback latency: average %u us, max %u us, %u calls over %u us.",
+                  frameCount > 0 ? (uint32_t) (totalLatencyUs / frameCount) : 0, (uint32_t) maxLatencyUs,
+                  slowCallbackCount, DJI_TEST_RTCM_REPLAY_SLOW_CALLBACK_US);
+
+    return frameCount > 0 ? DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS : DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+}
+
 /* Private functions definition-----------------------------------------------*/
 #ifndef __CC_ARM
 #pragma GCC diagnostic push
@@ -120,129 +401,269 @@ T_DjiReturnCode DjiTest_PositioningStartService(void)
 #pragma GCC diagnostic ignored "-Wreturn-type"
 #endif
 
+/* Stands in for the camera triggers, submits a set of events once per second. */
 static void *DjiTest_PositioningTask(void *arg)
 {
     int32_t i = 0;
-    T_DjiReturnCode djiStat;
-    uint64_t ppsNewestTriggerTimeUs = 0;
-    T_DjiPositioningEventInfo eventInfo[DJI_TEST_POSITIONING_EVENT_COUNT] = {0};
-    T_DjiPositioningPositionInfo positionInfo[DJI_TEST_POSITIONING_EVENT_COUNT] = {0};
-    T_DjiTimeSyncAircraftTime aircraftTime = {0};
+    T_DjiTestPositioningEvent events[DJI_TEST_POSITIONING_EVENT_COUNT] = {0};
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-    uint8_t totalSatelliteNumber = 0;
+    uint64_t nowUs = 0;
 
     USER_UTIL_UNUSED(arg);
 
     while (1) {
         osalHandler->TaskSleepMs(1000 / POSITIONING_TASK_FREQ);
 
-        djiStat = DjiTest_FcSubscriptionGetTotalSatelliteNumber(&totalSatelliteNumber);
-        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("get total satellite number error: 0x%08llX.", djiStat);
+        osalHandler->GetTimeUs(&nowUs);
+        for (i = 0; i < DJI_TEST_POSITIONING_EVENT_COUNT; ++i) {
+            events[i].eventSetIndex = s_eventIndex;
+            events[i].targetPointIndex = i;
+            events[i].localTimeUs = nowUs - i * DJI_TEST_TIME_INTERVAL_AMONG_EVENTS_US;
+        }
+
+        DjiTest_PositioningSubmitEvents(events, DJI_TEST_POSITIONING_EVENT_COUNT);
+        s_eventIndex++;
+    }
+}
+
+static void *DjiTest_PositioningEventTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestPositioningEvent batch[DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX];
+    T_DjiReturnCode djiStat;
+    uint64_t ppsNewestTriggerTimeUs = 0;
+    uint16_t queuedCount;
+    uint8_t expiredCount = 0;
+    uint8_t batchCount = 0;
+    uint8_t i;
+    bool isPpsErrorReported = false;
+
+    USER_UTIL_UNUSED(arg);
+
+    while (1) {
+        // A full batch may leave more due events behind, they are requested right away.
+        if (batchCount < DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX) {
+            osalHandler->SemaphoreTimedWait(s_positioningEventSema, DJI_TEST_POSITIONING_EVENT_POLL_MS);
+        }
+
+        osalHandler->MutexLock(s_positioningEventMutex);
+        queuedCount = s_positioningEventCount;
+        osalHandler->MutexUnlock(s_positioningEventMutex);
+        if (queuedCount == 0) {
+            batchCount = 0;
             continue;
         }
 
         djiStat = DjiTest_TimeSyncGetNewestPpsTriggerLocalTimeUs(&ppsNewestTriggerTimeUs);
         if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("get newest pps trigger time error: 0x%08llX.", djiStat);
+            if (isPpsErrorReported == false) {
+                USER_LOG_ERROR("get newest pps trigger time error: 0x%08llX.", djiStat);
+                isPpsErrorReported = true;
+            }
+            batchCount = 0;
             continue;
         }
+        isPpsErrorReported = false;
 
-        for (i = 0; i < DJI_TEST_POSITIONING_EVENT_COUNT; ++i) {
-            eventInfo[i].eventSetIndex = s_eventIndex;
-            eventInfo[i].targetPointIndex = i;
+        batchCount = DjiTest_PositioningTakeDueEvents(ppsNewestTriggerTimeUs, batch, s_positioningExpiredEvents,
+                                                      &expiredCount);
+        for (i = 0; i < expiredCount; ++i) {
+            s_positioningResultCallback(&s_positioningExpiredEvents[i], NULL, DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT);
+        }
 
-            djiStat = DjiTimeSync_TransferToAircraftTime(
-                ppsNewestTriggerTimeUs - 1000000 - i * DJI_TEST_TIME_INTERVAL_AMONG_EVENTS_US, &aircraftTime);
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("transfer to aircraft time error: 0x%08llX.", djiStat);
+        if (batchCount > 0) {
+            DjiTest_PositioningRequestBatch(batch, batchCount);
+        }
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
+/* Move the events in the request window out of the queue, oldest first, and the events that left it. */
+static uint8_t DjiTest_PositioningTakeDueEvents(uint64_t ppsNewestTriggerTimeUs, T_DjiTestPositioningEvent *batch,
+                                                T_DjiTestPositioningEvent *expiredEvents, uint8_t *expiredCount)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestPositioningEvent *event;
+    uint8_t batchCount = 0;
+    uint16_t keptCount = 0;
+    uint16_t i;
+    uint8_t youngestIndex;
+    uint8_t j;
+
+    *expiredCount = 0;
+
+    osalHandler->MutexLock(s_positioningEventMutex);
+    for (i = 0; i < s_positioningEventCount; ++i) {
+        event = &s_positioningEventQueue[i];
+        if (event->localTimeUs + DJI_TEST_POSITIONING_EVENT_MAX_AGE_US < ppsNewestTriggerTimeUs) {
+            expiredEvents[(*expiredCount)++] = *event;
+            continue;
+        }
+
+        if (event->localTimeUs + DJI_TEST_POSITIONING_EVENT_MIN_AGE_US <= ppsNewestTriggerTimeUs) {
+            if (batchCount < DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX) {
+                batch[batchCount++] = *event;
                 continue;
             }
 
-            eventInfo[i].eventTime = aircraftTime;
+            // Keep the oldest due events in the batch, the youngest one goes back to the queue.
+            youngestIndex = 0;
+            for (j = 1; j < batchCount; ++j) {
+                if (batch[j].localTimeUs > batch[youngestIndex].localTimeUs) {
+                    youngestIndex = j;
+                }
+            }
+            if (event->localTimeUs < batch[youngestIndex].localTimeUs) {
+                s_positioningEventQueue[keptCount++] = batch[youngestIndex];
+                batch[youngestIndex] = *event;
+                continue;
+            }
         }
 
-        djiStat = DjiPositioning_GetPositionInformationSync(DJI_TEST_POSITIONING_EVENT_COUNT, eventInfo, positionInfo);
+        s_positioningEventQueue[keptCount++] = *event;
+    }
+    s_positioningEventCount = keptCount;
+    s_positioningEventStatistics.expiredCount += *expiredCount;
+    osalHandler->MutexUnlock(s_positioningEventMutex);
+
+    return batchCount;
+}
+
+static void DjiTest_PositioningRequestBatch(T_DjiTestPositioningEvent *batch, uint8_t batchCount)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiPositioningEventInfo eventInfo[DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX] = {0};
+    T_DjiPositioningPositionInfo positionInfo[DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX] = {0};
+    T_DjiTestPositioningEvent requestedEvents[DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX];
+    T_DjiReturnCode djiStat;
+    uint64_t startTimeUs = 0;
+    uint64_t endTimeUs = 0;
+    uint8_t requestedCount = 0;
+    uint8_t failedCount = 0;
+    uint8_t totalSatelliteNumber = 0;
+    uint8_t i;
+
+    for (i = 0; i < batchCount; ++i) {
+        djiStat = DjiTimeSync_TransferToAircraftTime(batch[i].localTimeUs, &eventInfo[requestedCount].eventTime);
         if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("get position information error.");
+            USER_LOG_ERROR("transfer to aircraft time error: 0x%08llX.", djiStat);
+            s_positioningResultCallback(&batch[i], NULL, djiStat);
+            failedCount++;
             continue;
         }
 
-        USER_LOG_DEBUG("request position of target points success.");
-        USER_LOG_DEBUG("detail position information:");
-        for (i = 0; i < DJI_TEST_POSITIONING_EVENT_COUNT; ++i) {
-            USER_LOG_DEBUG("position solution property: %d.", positionInfo[i].positionSolutionProperty);
-            USER_LOG_DEBUG("pitchAttitudeAngle: %d\trollAttitudeAngle: %d\tyawAttitudeAngle: %d",
-                           positionInfo[i].uavAttitude.pitch, positionInfo[i].uavAttitude.roll,
-                           positionInfo[i].uavAttitude.yaw);
-            USER_LOG_DEBUG("northPositionOffset: %d\tearthPositionOffset: %d\tdownPositionOffset: %d",
-                           positionInfo[i].offsetBetweenMainAntennaAndTargetPoint.x,
-                           positionInfo[i].offsetBetweenMainAntennaAndTargetPoint.y,
-                           positionInfo[i].offsetBetweenMainAntennaAndTargetPoint.z);
-            USER_LOG_DEBUG("longitude: %.8f\tlatitude: %.8f\theight: %.8f",
-                           positionInfo[i].targetPointPosition.longitude,
-                           positionInfo[i].targetPointPosition.latitude,
-                           positionInfo[i].targetPointPosition.height);
-            USER_LOG_DEBUG(
-                "longStandardDeviation: %.8f\tlatStandardDeviation: %.8f\thgtStandardDeviation: %.8f",
-                positionInfo[i].targetPointPositionStandardDeviation.longitude,
-                positionInfo[i].targetPointPositionStandardDeviation.latitude,
-                positionInfo[i].targetPointPositionStandardDeviation.height);
+        eventInfo[requestedCount].eventSetIndex = batch[i].eventSetIndex;
+        eventInfo[requestedCount].targetPointIndex = batch[i].targetPointIndex;
+        requestedEvents[requestedCount++] = batch[i];
+    }
+
+    if (requestedCount > 0) {
+        djiStat = DjiTest_FcSubscriptionGetTotalSatelliteNumber(&totalSatelliteNumber);
+        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("get total satellite number error: 0x%08llX.", djiStat);
+        } else {
+            osalHandler->GetTimeUs(&startTimeUs);
+            djiStat = DjiPositioning_GetPositionInformationSync(requestedCount, eventInfo, positionInfo);
+            osalHandler->GetTimeUs(&endTimeUs);
+            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_ERROR("get position information error: 0x%08llX.", djiStat);
+            }
         }
 
-        s_eventIndex++;
+        for (i = 0; i < requestedCount; ++i) {
+            s_positioningResultCallback(&requestedEvents[i],
+                                        djiStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS ? &positionInfo[i] : NULL,
+                                        djiStat);
+        }
+        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            failedCount += requestedCount;
+            requestedCount = 0;
+        }
     }
-}
 
-#ifndef __CC_ARM
-#pragma GCC diagnostic pop
-#endif
+    osalHandler->MutexLock(s_positioningEventMutex);
+    s_positioningEventStatistics.requestCount++;
+    s_positioningEventStatistics.resolvedCount += requestedCount;
+    s_positioningEventStatistics.failedCount += failedCount;
+    if ((endTimeUs - startTimeUs) / 1000 > s_positioningEventStatistics.maxRequestTimeMs) {
+        s_positioningEventStatistics.maxRequestTimeMs = (uint32_t) ((endTimeUs - startTimeUs) / 1000);
+    }
+    osalHandler->MutexUnlock(s_positioningEventMutex);
+}
 
-static int32_t DjiTest_SaveRtcmData(char *filePath, const uint8_t *data, uint32_t len)
+#ifndef SYSTEM_ARCH_LINUX
+static void DjiTest_PositioningPrintResult(const T_DjiTestPositioningEvent *event,
+                                           const T_DjiPositioningPositionInfo *positionInfo, T_DjiReturnCode result)
 {
-#ifdef SYSTEM_ARCH_LINUX
-    FILE *fp = NULL;
-    size_t size;
-
-    fp = fopen(filePath, "ab+");
-    if (fp == NULL) {
-        printf("fopen failed!\n");
-        return -1;
+    if (result != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("get position of event set %d target point %d error: 0x%08llX.", event->eventSetIndex,
+                       event->targetPointIndex, result);
+        return;
     }
 
-    size = fwrite(data, 1, len, fp);
-    if (size != len) {
-        fclose(fp);
-        return -1;
+    USER_LOG_DEBUG("request position of event set %d target point %d success.", event->eventSetIndex,
+                   event->targetPointIndex);
+    USER_LOG_DEBUG("detail position information:");
+    USER_LOG_DEBUG("position solution property: %d.", positionInfo->positionSolutionProperty);
+    USER_LOG_DEBUG("pitchAttitudeAngle: %d\trollAttitudeAngle: %d\tyawAttitudeAngle: %d",
+                   positionInfo->uavAttitude.pitch, positionInfo->uavAttitude.roll, positionInfo->uavAttitude.yaw);
+    USER_LOG_DEBUG("northPositionOffset: %d\tearthPositionOffset: %d\tdownPositionOffset: %d",
+                   positionInfo->offsetBetweenMainAntennaAndTargetPoint.x,
+                   positionInfo->offsetBetweenMainAntennaAndTargetPoint.y,
+                   positionInfo->offsetBetweenMainAntennaAndTargetPoint.z);
+    USER_LOG_DEBUG("longitude: %.8f\tlatitude: %.8f\theight: %.8f",
+                   positionInfo->targetPointPosition.longitude,
+                   positionInfo->targetPointPosition.latitude,
+                   positionInfo->targetPointPosition.height);
+    USER_LOG_DEBUG("longStandardDeviation: %.8f\tlatStandardDeviation: %.8f\thgtStandardDeviation: %.8f",
+                   positionInfo->targetPointPositionStandardDeviation.longitude,
+                   positionInfo->targetPointPositionStandardDeviation.latitude,
+                   positionInfo->targetPointPositionStandardDeviation.height);
+}
+#endif
+
+/* Crc-24q of the rtcm 3 frames, computed over the preamble, the length and the payload. */
+static uint32_t DjiTest_RtcmCrc24q(const uint8_t *data, uint32_t len)
+{
+    uint32_t crc = 0;
+    uint32_t i;
+    uint8_t j;
+
+    for (i = 0; i < len; ++i) {
+        crc ^= (uint32_t) data[i] << 16;
+        for (j = 0; j < 8; ++j) {
+            crc <<= 1;
+            if (crc & 0x1000000) {
+                crc ^= 0x1864CFB;
+            }
+        }
     }
 
-    fflush(fp);
-    fclose(fp);
-#endif
-    return 0;
+    return crc & 0xFFFFFF;
 }
 
+/* The sdk thread only copies the data to the journal, the file is written by the journal task. */
 static T_DjiReturnCode DjiTest_ReceiveRtkOnAircraftRtcmDataCallback(uint8_t index, const uint8_t *data,
                                                                     uint16_t dataLen)
 {
-    USER_LOG_INFO("Receive rtcm data from rtk on aircraft, index: %d, len: %d", index, dataLen);
+    USER_LOG_DEBUG("Receive rtcm data from rtk on aircraft, index: %d, len: %d", index, dataLen);
+
+    DjiTest_PositioningRtcmJournalWrite(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT, data, dataLen);
 
-#ifdef SYSTEM_ARCH_LINUX
-    DjiTest_SaveRtcmData(s_rtkOnAircraftRtcmFilePath, data, dataLen);
-#endif
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
 static T_DjiReturnCode DjiTest_ReceiveRtkBaseStationRtcmDataCallback(uint8_t index, const uint8_t *data,
                                                                      uint16_t dataLen)
 {
-    USER_LOG_INFO("Receive rtcm data from rtk base station, index: %d, len: %d", index, dataLen);
+    USER_LOG_DEBUG("Receive rtcm data from rtk base station, index: %d, len: %d", index, dataLen);
+
+    DjiTest_PositioningRtcmJournalWrite(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_BASE_STATION, data, dataLen);
 
-#ifdef SYSTEM_ARCH_LINUX
-    DjiTest_SaveRtcmData(s_rtkBaseStationRtcmFilePath, data, dataLen);
-#endif
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-
 /****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
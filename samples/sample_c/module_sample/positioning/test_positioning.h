@@ -29,19 +29,55 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "dji_typedef.h"
+#include "dji_positioning.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 /* Exported constants --------------------------------------------------------*/
-
+/* DjiPositioning_GetPositionInformationSync() takes less than 5 events per request. */
+#define DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX       (4)
+#define DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE           (128)
 
 /* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Positioning event, such as a camera exposure, in local time.
+ * @note localTimeUs is in the time base of the pps trigger time given to the time synchronization module. The position
+ * of an event can only be requested between 1 and 2 seconds after it, so events are queued and their position is
+ * delivered later through the result callback.
+ */
+typedef struct {
+    uint16_t eventSetIndex;
+    uint8_t targetPointIndex;
+    uint64_t localTimeUs;
+} T_DjiTestPositioningEvent;
+
+/**
+ * @brief Position of a submitted event, positionInfo is NULL when result is not success. An event whose position was
+ * not requested in time is delivered with DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT.
+ */
+typedef void (*DjiTestPositioningResultCallback)(const T_DjiTestPositioningEvent *event,
+                                                 const T_DjiPositioningPositionInfo *positionInfo,
+                                                 T_DjiReturnCode result);
 
+typedef struct {
+    uint32_t submittedCount;
+    uint32_t droppedCount;
+    uint32_t resolvedCount;
+    uint32_t failedCount;
+    uint32_t expiredCount;
+    uint32_t requestCount;
+    uint32_t maxQueuedCount;
+    uint32_t maxRequestTimeMs;
+} T_DjiTestPositioningEventStatistics;
 
 /* Exported functions --------------------------------------------------------*/
 T_DjiReturnCode DjiTest_PositioningStartService(void);
+T_DjiReturnCode DjiTest_PositioningEventServiceStart(DjiTestPositioningResultCallback callback);
+T_DjiReturnCode DjiTest_PositioningSubmitEvents(const T_DjiTestPositioningEvent *events, uint16_t count);
+T_DjiReturnCode DjiTest_PositioningGetEventStatistics(T_DjiTestPositioningEventStatistics *statistics);
+T_DjiReturnCode DjiTest_PositioningRunRtcmReplay(const char *filePath, uint32_t frameIntervalMs);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,493 @@
+/**
+ ********************************************************************
+ * @file    test_positioning_rtcm_journal.c
+ * @brief   Buffered, size rotated journal of the rtk rtcm data, written from a background task so that
+ * the rtcm data callbacks only copy the data.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "test_positioning_rtcm_journal.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "utils/util_misc.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define DJI_TEST_RTCM_JOURNAL_DEFAULT_BUFFER_SIZE           (64 * 1024)
+#define DJI_TEST_RTCM_JOURNAL_DEFAULT_MAX_FILE_SIZE         (8 * 1024 * 1024)
+#define DJI_TEST_RTCM_JOURNAL_DEFAULT_FLUSH_PERIOD_MS       (500)
+#define DJI_TEST_RTCM_JOURNAL_DEFAULT_SYNC_PERIOD_MS        (5000)
+#define DJI_TEST_RTCM_JOURNAL_FILE_PATH_MAX_SIZE            (DJI_TEST_POSITIONING_RTCM_JOURNAL_PREFIX_MAX_SIZE + 16)
+#define DJI_TEST_RTCM_JOURNAL_TASK_STACK_SIZE               (2048)
+#define DJI_TEST_RTCM_JOURNAL_STOP_TIMEOUT_MS               (5000)
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief Ring buffer and output file of one rtcm data type.
+ * The callback only writes the free part of the ring, the writer task only reads the used part, so the data is copied
+ * and written without holding the lock, only the indexes are protected.
+ */
+typedef struct {
+    char prefix[DJI_TEST_POSITIONING_RTCM_JOURNAL_PREFIX_MAX_SIZE];
+    uint8_t *buffer;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t usedSize;
+    T_DjiFileHandle file;
+    uint32_t fileSize;
+    uint32_t fileIndex;
+    bool isSyncPending;
+    T_DjiTestPositioningRtcmJournalStatistics statistics;
+} T_DjiTestRtcmJournalChannel;
+
+/* Private functions declaration ---------------------------------------------*/
+static uint32_t DjiTest_RtcmJournalFlushChannel(T_DjiTestRtcmJournalChannel *channel);
+static T_DjiReturnCode DjiTest_RtcmJournalOpenNextFile(T_DjiTestRtcmJournalChannel *channel);
+static void DjiTest_RtcmJournalCloseFile(T_DjiTestRtcmJournalChannel *channel);
+static void DjiTest_RtcmJournalGetFilePath(const T_DjiTestRtcmJournalChannel *channel, uint32_t fileIndex,
+                                           char *filePath);
+static void DjiTest_RtcmJournalReleaseChannels(void);
+static void *DjiTest_RtcmJournalWriterTask(void *arg);
+
+/* Private variables ---------------------------------------------------------*/
+static T_DjiTestRtcmJournalChannel s_rtcmJournalChannels[DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM];
+static T_DjiTestPositioningRtcmJournalConfig s_rtcmJournalConfig;
+static T_DjiMutexHandle s_rtcmJournalMutex = NULL;
+static T_DjiSemaHandle s_rtcmJournalFlushSema = NULL;
+static T_DjiSemaHandle s_rtcmJournalStopSema = NULL;
+static T_DjiTaskHandle s_rtcmJournalWriterThread = NULL;
+static volatile bool s_isRtcmJournalRunning = false;
+static volatile bool s_isRtcmJournalStopping = false;
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Start journaling the rtcm data of both data types.
+ * @param config: journal settings, NULL selects the default ones.
+ * @param onAircraftPrefix: file path prefix of the rtk on aircraft data, parts are named "<prefix>_000.rtcm" and so on.
+ * @param baseStationPrefix: file path prefix of the rtk base station data.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_PositioningRtcmJournalStart(const T_DjiTestPositioningRtcmJournalConfig *config,
+                                                    const char *onAircraftPrefix, const char *baseStationPrefix)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiFileSystemHandler *fileSystemHandler = DjiPlatform_GetFileSystemHandler();
+    const char *prefixes[DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM];
+    T_DjiReturnCode returnCode;
+    uint8_t i;
+
+    if (onAircraftPrefix == NULL || baseStationPrefix == NULL ||
+        strlen(onAircraftPrefix) >= DJI_TEST_POSITIONING_RTCM_JOURNAL_PREFIX_MAX_SIZE ||
+        strlen(baseStationPrefix) >= DJI_TEST_POSITIONING_RTCM_JOURNAL_PREFIX_MAX_SIZE) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_isRtcmJournalRunning == true) {
+        USER_LOG_ERROR("Rtcm journal is already running.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    if (fileSystemHandler == NULL || fileSystemHandler->FileOpen == NULL) {
+        USER_LOG_ERROR("File system handler is not registered, can not journal rtcm data.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    memset(&s_rtcmJournalConfig, 0, sizeof(s_rtcmJournalConfig));
+    if (config != NULL) {
+        s_rtcmJournalConfig = *config;
+    }
+    if (s_rtcmJournalConfig.bufferSize == 0) {
+        s_rtcmJournalConfig.bufferSize = DJI_TEST_RTCM_JOURNAL_DEFAULT_BUFFER_SIZE;
+    }
+    if (s_rtcmJournalConfig.maxFileSize == 0) {
+        s_rtcmJournalConfig.maxFileSize = DJI_TEST_RTCM_JOURNAL_DEFAULT_MAX_FILE_SIZE;
+    }
+    if (s_rtcmJournalConfig.flushPeriodMs == 0) {
+        s_rtcmJournalConfig.flushPeriodMs = DJI_TEST_RTCM_JOURNAL_DEFAULT_FLUSH_PERIOD_MS;
+    }
+    if (s_rtcmJournalConfig.syncPeriodMs == 0) {
+        s_rtcmJournalConfig.syncPeriodMs = DJI_TEST_RTCM_JOURNAL_DEFAULT_SYNC_PERIOD_MS;
+    }
+
+    prefixes[DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT] = onAircraftPrefix;
+    prefixes[DJI_POSITIONING_RTCM_DATA_TYPE_RTK_BASE_STATION] = baseStationPrefix;
+    memset(s_rtcmJournalChannels, 0, sizeof(s_rtcmJournalChannels));
+    for (i = 0; i < DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM; i++) {
+        strcpy(s_rtcmJournalChannels[i].prefix, prefixes[i]);
+        s_rtcmJournalChannels[i].buffer = osalHandler->Malloc(s_rtcmJournalConfig.bufferSize);
+        if (s_rtcmJournalChannels[i].buffer == NULL) {
+            USER_LOG_ERROR("Malloc rtcm journal buffer error.");
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+            goto free;
+        }
+    }
+
+    // The lock and the flush semaphore are never destroyed, an rtcm callback racing a stop may still be using them.
+    if (s_rtcmJournalMutex == NULL) {
+        returnCode = osalHandler->MutexCreate(&s_rtcmJournalMutex);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            s_rtcmJournalMutex = NULL;
+            goto free;
+        }
+    }
+    if (s_rtcmJournalFlushSema == NULL) {
+        returnCode = osalHandler->SemaphoreCreate(0, &s_rtcmJournalFlushSema);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            s_rtcmJournalFlushSema = NULL;
+            goto free;
+        }
+    }
+    returnCode = osalHandler->SemaphoreCreate(0, &s_rtcmJournalStopSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto free;
+    }
+
+    s_isRtcmJournalStopping = false;
+    returnCode = osalHandler->TaskCreate("rtcm_journal", DjiTest_RtcmJournalWriterTask,
+                                         DJI_TEST_RTCM_JOURNAL_TASK_STACK_SIZE, NULL, &s_rtcmJournalWriterThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create rtcm journal task error: 0x%08llX.", returnCode);
+        goto destroyStopSema;
+    }
+
+    s_isRtcmJournalRunning = true;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+destroyStopSema:
+    osalHandler->SemaphoreDestroy(s_rtcmJournalStopSema);
+    s_rtcmJournalStopSema = NULL;
+free:
+    DjiTest_RtcmJournalReleaseChannels();
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_PositioningRtcmJournalStop(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    uint8_t i;
+
+    if (s_isRtcmJournalRunning == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    // New data is refused from now on, the writer task drains what is buffered before it exits.
+    osalHandler->MutexLock(s_rtcmJournalMutex);
+    s_isRtcmJournalRunning = false;
+    s_isRtcmJournalStopping = true;
+    osalHandler->MutexUnlock(s_rtcmJournalMutex);
+    osalHandler->SemaphorePost(s_rtcmJournalFlushSema);
+
+    if (osalHandler->SemaphoreTimedWait(s_rtcmJournalStopSema, DJI_TEST_RTCM_JOURNAL_STOP_TIMEOUT_MS) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Wait rtcm journal task timeout, the journal may be truncated.");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    osalHandler->TaskDestroy(s_rtcmJournalWriterThread);
+    s_rtcmJournalWriterThread = NULL;
+
+    for (i = 0; i < DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM; i++) {
+        DjiTest_RtcmJournalCloseFile(&s_rtcmJournalChannels[i]);
+        USER_LOG_INFO("Rtcm journal %s stopped: %u bytes received, %u written, %u dropped, %u files, "
+                      "max buffered %u bytes, max write %u ms.", s_rtcmJournalChannels[i].prefix,
+                      s_rtcmJournalChannels[i].statistics.receivedBytes,
+                      s_rtcmJournalChannels[i].statistics.writtenBytes,
+                      s_rtcmJournalChannels[i].statistics.droppedBytes,
+                      s_rtcmJournalChannels[i].statistics.fileCount,
+                      s_rtcmJournalChannels[i].statistics.maxBufferedBytes,
+                      s_rtcmJournalChannels[i].statistics.maxWriteTimeMs);
+    }
+
+    // A late writer takes the lock, finds the journal stopped and leaves the released buffers alone.
+    osalHandler->SemaphoreDestroy(s_rtcmJournalStopSema);
+    s_rtcmJournalStopSema = NULL;
+    DjiTest_RtcmJournalReleaseChannels();
+
+    return returnCode;
+}
+
+bool DjiTest_PositioningRtcmJournalIsRunning(void)
+{
+    return s_isRtcmJournalRunning;
+}
+
+/**
+ * @brief Queue rtcm data for the journal, only copies the data so that it can be called from the rtcm data callbacks.
+ * @note The data is dropped as a whole if it does not fit in the buffer, a journal part never holds half a chunk.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE if the data was dropped.
+ */
+T_DjiReturnCode DjiTest_PositioningRtcmJournalWrite(E_DjiPositioningRtcmDataType dataType, const uint8_t *data,
+                                                    uint16_t dataLen)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestRtcmJournalChannel *channel;
+    uint32_t firstPartLen;
+    bool isFlushNeeded;
+
+    if ((uint32_t) dataType >= DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM || (data == NULL && dataLen > 0)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_isRtcmJournalRunning == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    channel = &s_rtcmJournalChannels[dataType];
+
+    osalHandler->MutexLock(s_rtcmJournalMutex);
+    if (s_isRtcmJournalRunning == false) {
+        osalHandler->MutexUnlock(s_rtcmJournalMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    channel->statistics.receivedBytes += dataLen;
+    channel->statistics.receivedChunks++;
+    if (dataLen > s_rtcmJournalConfig.bufferSize - channel->usedSize) {
+        channel->statistics.droppedBytes += dataLen;
+        channel->statistics.droppedChunks++;
+        osalHandler->MutexUnlock(s_rtcmJournalMutex);
+        osalHandler->SemaphorePost(s_rtcmJournalFlushSema);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    firstPartLen = USER_UTIL_MIN((uint32_t) dataLen, s_rtcmJournalConfig.bufferSize - channel->head);
+    memcpy(&channel->buffer[channel->head], data, firstPartLen);
+    memcpy(channel->buffer, &data[firstPartLen], dataLen - firstPartLen);
+    channel->head = (channel->head + dataLen) % s_rtcmJournalConfig.bufferSize;
+    channel->usedSize += dataLen;
+    if (channel->usedSize > channel->statistics.maxBufferedBytes) {
+        channel->statistics.maxBufferedBytes = channel->usedSize;
+    }
+    // Wake the writer early when a quarter of the buffer is used, the periodic flush handles the usual rates.
+    isFlushNeeded = channel->usedSize >= s_rtcmJournalConfig.bufferSize / 4 &&
+                    channel->usedSize - dataLen < s_rtcmJournalConfig.bufferSize / 4;
+    osalHandler->MutexUnlock(s_rtcmJournalMutex);
+
+    if (isFlushNeeded) {
+        osalHandler->SemaphorePost(s_rtcmJournalFlushSema);
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_PositioningRtcmJournalGetStatistics(E_DjiPositioningRtcmDataType dataType,
+                                                            T_DjiTestPositioningRtcmJournalStatistics *statistics)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if ((uint32_t) dataType >= DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM || statistics == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_rtcmJournalMutex != NULL) {
+        osalHandler->MutexLock(s_rtcmJournalMutex);
+        *statistics = s_rtcmJournalChannels[dataType].statistics;
+        osalHandler->MutexUnlock(s_rtcmJournalMutex);
+    } else {
+        *statistics = s_rtcmJournalChannels[dataType].statistics;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Private functions definition-----------------------------------------------*/
+/* Write everything buffered when called, which always ends at a chunk boundary, returns the written size. */
+static uint32_t DjiTest_RtcmJournalFlushChannel(T_DjiTestRtcmJournalChannel *channel)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiFileSystemHandler *fileSystemHandler = DjiPlatform_GetFileSystemHandler();
+    T_DjiReturnCode returnCode;
+    uint32_t startTimeMs = 0;
+    uint32_t endTimeMs = 0;
+    uint32_t bufferedLen;
+    uint32_t flushLen;
+    uint32_t spanLen;
+    uint32_t realLen;
+    uint32_t tail;
+
+    osalHandler->MutexLock(s_rtcmJournalMutex);
+    bufferedLen = channel->usedSize;
+    tail = channel->tail;
+    osalHandler->MutexUnlock(s_rtcmJournalMutex);
+    if (bufferedLen == 0) {
+        return 0;
+    }
+
+    if (channel->file != NULL && channel->fileSize + bufferedLen > s_rtcmJournalConfig.maxFileSize &&
+        channel->fileSize > 0) {
+        DjiTest_RtcmJournalCloseFile(channel);
+    }
+    if (channel->file == NULL && DjiTest_RtcmJournalOpenNextFile(channel) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        // Keep the data buffered, the file is opened again on the next flush.
+        return 0;
+    }
+
+    // A failed write still releases the data, retrying would block the buffer behind a broken file.
+    osalHandler->GetTimeMs(&startTimeMs);
+    flushLen = bufferedLen;
+    while (flushLen > 0) {
+        spanLen = USER_UTIL_MIN(flushLen, s_rtcmJournalConfig.bufferSize - tail);
+        realLen = 0;
+        returnCode = fileSystemHandler->FileWrite(channel->file, &channel->buffer[tail], spanLen, &realLen);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS || realLen != spanLen) {
+            channel->statistics.writeErrorCount++;
+            USER_LOG_ERROR("Write rtcm journal %s error, %u of %u bytes written.", channel->prefix, realLen, spanLen);
+        }
+        channel->fileSize += realLen;
+        channel->statistics.writtenBytes += realLen;
+        tail = (tail + spanLen) % s_rtcmJournalConfig.bufferSize;
+        flushLen -= spanLen;
+    }
+    channel->isSyncPending = true;
+    osalHandler->GetTimeMs(&endTimeMs);
+
+    osalHandler->MutexLock(s_rtcmJournalMutex);
+    channel->usedSize -= bufferedLen;
+    channel->tail = tail;
+    if (endTimeMs - startTimeMs > channel->statistics.maxWriteTimeMs) {
+        channel->statistics.maxWriteTimeMs = endTimeMs - startTimeMs;
+    }
+    osalHandler->MutexUnlock(s_rtcmJournalMutex);
+
+    return bufferedLen;
+}
+
+static T_DjiReturnCode DjiTest_RtcmJournalOpenNextFile(T_DjiTestRtcmJournalChannel *channel)
+{
+    T_DjiFileSystemHandler *fileSystemHandler = DjiPlatform_GetFileSystemHandler();
+    char filePath[DJI_TEST_RTCM_JOURNAL_FILE_PATH_MAX_SIZE];
+    T_DjiReturnCode returnCode;
+
+    DjiTest_RtcmJournalGetFilePath(channel, channel->fileIndex, filePath);
+    returnCode = fileSystemHandler->FileOpen(filePath, "wb+", &channel->file);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Open rtcm journal file %s error: 0x%08llX.", filePath, returnCode);
+        channel->file = NULL;
+        channel->statistics.writeErrorCount++;
+        return returnCode;
+    }
+
+    channel->fileSize = 0;
+    channel->statistics.fileCount++;
+
+    if (s_rtcmJournalConfig.maxFileCount > 0 && channel->fileIndex >= s_rtcmJournalConfig.maxFileCount &&
+        fileSystemHandler->Unlink != NULL) {
+        DjiTest_RtcmJournalGetFilePath(channel, channel->fileIndex - s_rtcmJournalConfig.maxFileCount, filePath);
+        if (fileSystemHandler->Unlink(filePath) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_WARN("Remove old rtcm journal file %s error.", filePath);
+        }
+    }
+    channel->fileIndex++;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void DjiTest_RtcmJournalCloseFile(T_DjiTestRtcmJournalChannel *channel)
+{
+    T_DjiFileSystemHandler *fileSystemHandler = DjiPlatform_GetFileSystemHandler();
+
+    if (channel->file == NULL) {
+        return;
+    }
+
+    fileSystemHandler->FileSync(channel->file);
+    fileSystemHandler->FileClose(channel->file);
+    channel->file = NULL;
+    channel->isSyncPending = false;
+}
+
+static void DjiTest_RtcmJournalGetFilePath(const T_DjiTestRtcmJournalChannel *channel, uint32_t fileIndex,
+                                           char *filePath)
+{
+    snprintf(filePath, DJI_TEST_RTCM_JOURNAL_FILE_PATH_MAX_SIZE, "%s_%03u.rtcm", channel->prefix,
+             (unsigned int) fileIndex);
+}
+
+static void DjiTest_RtcmJournalReleaseChannels(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint8_t i;
+
+    for (i = 0; i < DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM; i++) {
+        if (s_rtcmJournalChannels[i].buffer != NULL) {
+            osalHandler->Free(s_rtcmJournalChannels[i].buffer);
+            s_rtcmJournalChannels[i].buffer = NULL;
+        }
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-noreturn"
+#pragma GCC diagnostic ignored "-Wreturn-type"
+#endif
+
+static void *DjiTest_RtcmJournalWriterTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiFileSystemHandler *fileSystemHandler = DjiPlatform_GetFileSystemHandler();
+    uint32_t lastSyncTimeMs = 0;
+    uint32_t nowMs = 0;
+    bool isStopping;
+    uint8_t i;
+
+    USER_UTIL_UNUSED(arg);
+
+    osalHandler->GetTimeMs(&lastSyncTimeMs);
+    while (1) {
+        osalHandler->SemaphoreTimedWait(s_rtcmJournalFlushSema, s_rtcmJournalConfig.flushPeriodMs);
+
+        // Read the stop flag before flushing, nothing is accepted any more once it is set.
+        isStopping = s_isRtcmJournalStopping;
+        for (i = 0; i < DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM; i++) {
+            DjiTest_RtcmJournalFlushChannel(&s_rtcmJournalChannels[i]);
+        }
+
+        // The sync is what stalls on a busy emmc, it is done here on its own period rather than per chunk.
+        osalHandler->GetTimeMs(&nowMs);
+        if (nowMs - lastSyncTimeMs >= s_rtcmJournalConfig.syncPeriodMs) {
+            for (i = 0; i < DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM; i++) {
+                if (s_rtcmJournalChannels[i].file != NULL && s_rtcmJournalChannels[i].isSyncPending) {
+                    fileSystemHandler->FileSync(s_rtcmJournalChannels[i].file);
+                    s_rtcmJournalChannels[i].isSyncPending = false;
+                }
+            }
+            lastSyncTimeMs = nowMs;
+        }
+
+        if (isStopping) {
+            break;
+        }
+    }
+
+    osalHandler->SemaphorePost(s_rtcmJournalStopSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,84 @@
+/**
+ ********************************************************************
+ * @file    test_positioning_rtcm_journal.h
+ * @brief   This is the header file for "test_positioning_rtcm_journal.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_POSITIONING_RTCM_JOURNAL_H
+#define TEST_POSITIONING_RTCM_JOURNAL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_positioning.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_TEST_POSITIONING_RTCM_JOURNAL_CHANNEL_NUM          (2)
+#define DJI_TEST_POSITIONING_RTCM_JOURNAL_PREFIX_MAX_SIZE      (48)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Journal settings, a zero member selects its default value.
+ * @note A journal file is closed and the next part opened once it reaches maxFileSize, parts always end between two
+ * received rtcm data chunks so that concatenating them gives back the received stream. maxFileCount only keeps the
+ * newest parts of every channel, 0 keeps all of them.
+ */
+typedef struct {
+    uint32_t bufferSize;
+    uint32_t maxFileSize;
+    uint32_t maxFileCount;
+    uint32_t flushPeriodMs;
+    uint32_t syncPeriodMs;
+} T_DjiTestPositioningRtcmJournalConfig;
+
+typedef struct {
+    uint32_t receivedBytes;
+    uint32_t receivedChunks;
+    uint32_t droppedBytes;
+    uint32_t droppedChunks;
+    uint32_t writtenBytes;
+    uint32_t writeErrorCount;
+    uint32_t fileCount;
+    uint32_t maxBufferedBytes;
+    uint32_t maxWriteTimeMs;
+} T_DjiTestPositioningRtcmJournalStatistics;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode DjiTest_PositioningRtcmJournalStart(const T_DjiTestPositioningRtcmJournalConfig *config,
+                                                    const char *onAircraftPrefix, const char *baseStationPrefix);
+T_DjiReturnCode DjiTest_PositioningRtcmJournalStop(void);
+bool DjiTest_PositioningRtcmJournalIsRunning(void);
+T_DjiReturnCode DjiTest_PositioningRtcmJournalWrite(E_DjiPositioningRtcmDataType dataType, const uint8_t *data,
+                                                    uint16_t dataLen);
+T_DjiReturnCode DjiTest_PositioningRtcmJournalGetStatistics(E_DjiPositioningRtcmDataType dataType,
+                                                            T_DjiTestPositioningRtcmJournalStatistics *statistics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_POSITIONING_RTCM_JOURNAL_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
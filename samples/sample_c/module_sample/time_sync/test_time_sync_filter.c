@@ -0,0 +1,225 @@
+/**
+ ********************************************************************
+ * @file    test_time_sync_filter.c
+ * @brief   Tracking of the pps edges in local time, estimating the drift of the local clock.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_time_sync_filter.h"
+#include <math.h>
+#include <string.h>
+
+/* Private constants ---------------------------------------------------------*/
+#define DJI_TEST_TIME_SYNC_FILTER_DEFAULT_MAX_DRIFT_PPM         (200)
+#define DJI_TEST_TIME_SYNC_FILTER_DEFAULT_OUTLIER_THRESHOLD_US  (1000)
+#define DJI_TEST_TIME_SYNC_FILTER_DEFAULT_HOLDOVER_PERIODS      (10)
+/* gains of the tracking once converged, lower values smooth more jitter but follow drift changes slower */
+#define DJI_TEST_TIME_SYNC_FILTER_ALPHA_MIN                     (0.1)
+#define DJI_TEST_TIME_SYNC_FILTER_BETA_MIN                      (0.005)
+/* the outlier check is only trusted once the period has been estimated from a few edges */
+#define DJI_TEST_TIME_SYNC_FILTER_CONVERGED_COUNT               (4)
+#define DJI_TEST_TIME_SYNC_FILTER_RESET_REJECT_COUNT            (3)
+#define DJI_TEST_TIME_SYNC_FILTER_RESIDUAL_WEIGHT               (1.0 / 16)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+
+/* Private functions declaration ---------------------------------------------*/
+static void DjiTest_TimeSyncFilterRestart(T_DjiTestTimeSyncFilter *filter, double edgeUs);
+
+/* Exported functions definition ---------------------------------------------*/
+void DjiTest_TimeSyncFilterInit(T_DjiTestTimeSyncFilter *filter, const T_DjiTestTimeSyncFilterConfig *config)
+{
+    memset(filter, 0, sizeof(T_DjiTestTimeSyncFilter));
+
+    if (config != NULL) {
+        filter->config = *config;
+    }
+    if (filter->config.maxDriftPpm == 0) {
+        filter->config.maxDriftPpm = DJI_TEST_TIME_SYNC_FILTER_DEFAULT_MAX_DRIFT_PPM;
+    }
+    if (filter->config.outlierThresholdUs == 0) {
+        filter->config.outlierThresholdUs = DJI_TEST_TIME_SYNC_FILTER_DEFAULT_OUTLIER_THRESHOLD_US;
+    }
+    if (filter->config.holdoverPeriods == 0) {
+        filter->config.holdoverPeriods = DJI_TEST_TIME_SYNC_FILTER_DEFAULT_HOLDOVER_PERIODS;
+    }
+
+    filter->periodUs = DJI_TEST_TIME_SYNC_FILTER_NOMINAL_PERIOD_US;
+}
+
+void DjiTest_TimeSyncFilterReset(T_DjiTestTimeSyncFilter *filter)
+{
+    filter->valid = false;
+    filter->periodUs = DJI_TEST_TIME_SYNC_FILTER_NOMINAL_PERIOD_US;
+    filter->trackCount = 0;
+    filter->consecutiveRejectCount = 0;
+    filter->residualMeanSquareUs = 0;
+    filter->statistics.resetCount++;
+}
+
+/**
+ * @brief Feed the local time of a pps edge.
+ * @param filter: pointer to the filter.
+ * @param edgeLocalTimeUs: local time of the edge, edges have to be fed in order.
+ * @return true if the edge was used, false if it was dropped as spurious or as an outlier.
+ */
+bool DjiTest_TimeSyncFilterUpdate(T_DjiTestTimeSyncFilter *filter, uint64_t edgeLocalTimeUs)
+{
+    double edgeUs = (double) edgeLocalTimeUs;
+    double predictedUs;
+    double residualUs;
+    double toleranceUs;
+    double periodMinUs;
+    double periodMaxUs;
+    double alpha;
+    double beta;
+    double k;
+    uint32_t periods;
+
+    if (!filter->valid) {
+        DjiTest_TimeSyncFilterRestart(filter, edgeUs);
+        return true;
+    }
+
+    /* number of pps periods since the last accepted edge, more than one when pulses were missed */
+    if (edgeUs < filter->phaseUs + filter->periodUs / 2) {
+        filter->statistics.rejectedCount++;
+        return false;
+    }
+    periods = (uint32_t) floor((edgeUs - filter->phaseUs) / filter->periodUs + 0.5);
+
+    if (periods > filter->config.holdoverPeriods) {
+        /* the pps was lost too long for the prediction to be trusted */
+        DjiTest_TimeSyncFilterReset(filter);
+        DjiTest_TimeSyncFilterRestart(filter, edgeUs);
+        return true;
+    }
+
+    predictedUs = filter->phaseUs + periods * filter->periodUs;
+    residualUs = edgeUs - predictedUs;
+
+    toleranceUs = (double) filter->config.outlierThresholdUs;
+    if (filter->trackCount < DJI_TEST_TIME_SYNC_FILTER_CONVERGED_COUNT) {
+        toleranceUs += (double) periods * DJI_TEST_TIME_SYNC_FILTER_NOMINAL_PERIOD_US * filter->config.maxDriftPpm / 1e6;
+    }
+
+    if (fabs(residualUs) > toleranceUs) {
+        filter->statistics.rejectedCount++;
+        if (++filter->consecutiveRejectCount >= DJI_TEST_TIME_SYNC_FILTER_RESET_REJECT_COUNT) {
+            /* consistently off, the pps or the local clock jumped */
+            DjiTest_TimeSyncFilterReset(filter);
+            DjiTest_TimeSyncFilterRestart(filter, edgeUs);
+            return true;
+        }
+        return false;
+    }
+
+    /*
+     * Growing memory gains first, equal to a least squares line fit of the edges seen so far, so the period converges
+     * within a few pulses, then fixed gains to keep following the drift as the temperature changes.
+     */
+    filter->trackCount++;
+    k = (double) filter->trackCount + 1;
+    alpha = 2 * (2 * k - 1) / (k * (k + 1));
+    beta = 6 / (k * (k + 1));
+    if (alpha < DJI_TEST_TIME_SYNC_FILTER_ALPHA_MIN) {
+        alpha = DJI_TEST_TIME_SYNC_FILTER_ALPHA_MIN;
+    }
+    if (beta < DJI_TEST_TIME_SYNC_FILTER_BETA_MIN) {
+        beta = DJI_TEST_TIME_SYNC_FILTER_BETA_MIN;
+    }
+
+    filter->phaseUs = predictedUs + alpha * residualUs;
+    filter->periodUs += beta * residualUs / periods;
+
+    periodMinUs = DJI_TEST_TIME_SYNC_FILTER_NOMINAL_PERIOD_US * (1 - filter->config.maxDriftPpm / 1e6);
+    periodMaxUs = DJI_TEST_TIME_SYNC_FILTER_NOMINAL_PERIOD_US * (1 + filter->config.maxDriftPpm / 1e6);
+    if (filter->periodUs < periodMinUs) {
+        filter->periodUs = periodMinUs;
+    } else if (filter->periodUs > periodMaxUs) {
+        filter->periodUs = periodMaxUs;
+    }
+
+    filter->residualMeanSquareUs += DJI_TEST_TIME_SYNC_FILTER_RESIDUAL_WEIGHT *
+                                    (residualUs * residualUs - filter->residualMeanSquareUs);
+    filter->consecutiveRejectCount = 0;
+
+    filter->statistics.acceptedCount++;
+    filter->statistics.missedCount += periods - 1;
+    filter->statistics.lastResidualUs = residualUs;
+    filter->statistics.residualRmsUs = sqrt(filter->residualMeanSquareUs);
+    filter->statistics.driftPpm = filter->periodUs - DJI_TEST_TIME_SYNC_FILTER_NOMINAL_PERIOD_US;
+
+    return true;
+}
+
+/**
+ * @brief Get the local time of the newest pps edge before a local time, extrapolated with the estimated period when
+ * the newest pulses were missed.
+ * @param filter: pointer to the filter.
+ * @param localTimeUs: current local time.
+ * @param edgeLocalTimeUs: pointer to the local time of the newest edge.
+ * @return Execution result, busy when no edge was received yet and timeout when the pps is lost.
+ */
+T_DjiReturnCode DjiTest_TimeSyncFilterGetNewestEdge(const T_DjiTestTimeSyncFilter *filter, uint64_t localTimeUs,
+                                                    uint64_t *edgeLocalTimeUs)
+{
+    double periods;
+
+    if (!filter->valid) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    if ((double) localTimeUs <= filter->phaseUs) {
+        *edgeLocalTimeUs = (uint64_t) filter->phaseUs;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    periods = floor(((double) localTimeUs - filter->phaseUs) / filter->periodUs);
+    if (periods > filter->config.holdoverPeriods) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT;
+    }
+
+    *edgeLocalTimeUs = (uint64_t) (filter->phaseUs + periods * filter->periodUs + 0.5);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+void DjiTest_TimeSyncFilterGetStatistics(const T_DjiTestTimeSyncFilter *filter,
+                                         T_DjiTestTimeSyncFilterStatistics *statistics)
+{
+    *statistics = filter->statistics;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void DjiTest_TimeSyncFilterRestart(T_DjiTestTimeSyncFilter *filter, double edgeUs)
+{
+    filter->valid = true;
+    filter->phaseUs = edgeUs;
+    filter->trackCount = 0;
+    filter->consecutiveRejectCount = 0;
+    filter->statistics.acceptedCount++;
+    filter->statistics.lastResidualUs = 0;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,87 @@
+/**
+ ********************************************************************
+ * @file    test_time_sync_filter.h
+ * @brief   This is the header file for "test_time_sync_filter.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_TIME_SYNC_FILTER_H
+#define TEST_TIME_SYNC_FILTER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_TEST_TIME_SYNC_FILTER_NOMINAL_PERIOD_US         (1000000)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    uint32_t maxDriftPpm; /*!< Largest drift accepted between the local clock and the pps, 0 selects 200 ppm. */
+    uint32_t outlierThresholdUs; /*!< Edges further than this from the prediction are dropped, 0 selects 1000 us. */
+    uint32_t holdoverPeriods; /*!< Pulses extrapolated after the last accepted edge, 0 selects 10. */
+} T_DjiTestTimeSyncFilterConfig;
+
+typedef struct {
+    uint32_t acceptedCount;
+    uint32_t rejectedCount;
+    uint32_t missedCount; /*!< Pulses skipped between two accepted edges. */
+    uint32_t resetCount;
+    double driftPpm; /*!< Rate of the local clock relative to the pps, positive when the local clock runs fast. */
+    double residualRmsUs; /*!< Distance between the measured and the predicted edges, mainly the edge jitter. */
+    double lastResidualUs;
+} T_DjiTestTimeSyncFilterStatistics;
+
+/**
+ * @brief Alpha beta tracking of the pps edges in local time. The phase is the filtered local time of the newest
+ * accepted edge and the period the local duration of one pps second, so edges missed or dropped as outliers are
+ * replaced by extrapolated ones and the jitter of the edge timestamps is smoothed out.
+ */
+typedef struct {
+    T_DjiTestTimeSyncFilterConfig config;
+    bool valid;
+    double phaseUs;
+    double periodUs;
+    double residualMeanSquareUs;
+    uint32_t trackCount;
+    uint32_t consecutiveRejectCount;
+    T_DjiTestTimeSyncFilterStatistics statistics;
+} T_DjiTestTimeSyncFilter;
+
+/* Exported functions --------------------------------------------------------*/
+void DjiTest_TimeSyncFilterInit(T_DjiTestTimeSyncFilter *filter, const T_DjiTestTimeSyncFilterConfig *config);
+void DjiTest_TimeSyncFilterReset(T_DjiTestTimeSyncFilter *filter);
+bool DjiTest_TimeSyncFilterUpdate(T_DjiTestTimeSyncFilter *filter, uint64_t edgeLocalTimeUs);
+T_DjiReturnCode DjiTest_TimeSyncFilterGetNewestEdge(const T_DjiTestTimeSyncFilter *filter, uint64_t localTimeUs,
+                                                    uint64_t *edgeLocalTimeUs);
+void DjiTest_TimeSyncFilterGetStatistics(const T_DjiTestTimeSyncFilter *filter,
+                                         T_DjiTestTimeSyncFilterStatistics *statistics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_TIME_SYNC_FILTER_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -0,0 +1,187 @@
+/**
+ ********************************************************************
+ * @file    util_asset.c
+ * @brief   Lookup and lazy decoding of the asset packs generated by tools/asset_packer.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "util_asset.h"
+#include <string.h>
+#include "util_lz4.h"
+#include "dji_platform.h"
+#include "dji_logger.h"
+
+/* Private constants ---------------------------------------------------------*/
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+/* serializes the first decode of compressed assets and the release of their copies */
+static T_DjiMutexHandle s_utilAssetMutex = NULL;
+
+/* Private functions declaration ---------------------------------------------*/
+
+/* Exported functions definition ---------------------------------------------*/
+T_DjiReturnCode UtilAsset_Init(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+
+    if (s_utilAssetMutex != NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    returnCode = osalHandler->MutexCreate(&s_utilAssetMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create asset mutex error, stat = 0x%08llX", returnCode);
+        s_utilAssetMutex = NULL;
+    }
+
+    return returnCode;
+}
+
+uint32_t UtilAsset_HashName(const char *name)
+{
+    uint32_t hash = UTIL_ASSET_NAME_HASH_OFFSET_BASIS;
+
+    while (*name != '\0') {
+        hash ^= (uint8_t) *name++;
+        hash *= UTIL_ASSET_NAME_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+const T_UtilAssetEntry *UtilAsset_Find(const T_UtilAssetPack *pack, const char *name)
+{
+    uint32_t hash;
+    uint32_t bucket;
+    uint16_t index;
+    uint32_t i;
+
+    if (pack == NULL || name == NULL) {
+        return NULL;
+    }
+
+    hash = UtilAsset_HashName(name);
+    bucket = hash & pack->bucketMask;
+
+    /* the packer keeps the table at most half full, a probe ends on an empty bucket */
+    for (i = 0; i <= pack->bucketMask; i++) {
+        index = pack->buckets[bucket];
+        if (index == 0) {
+            break;
+        }
+        if (pack->entries[index - 1].nameHash == hash && strcmp(pack->entries[index - 1].name, name) == 0) {
+            return &pack->entries[index - 1];
+        }
+        bucket = (bucket + 1) & pack->bucketMask;
+    }
+
+    return NULL;
+}
+
+T_DjiReturnCode UtilAsset_GetData(const T_UtilAssetPack *pack, const T_UtilAssetEntry *entry,
+                                  const uint8_t **data, uint32_t *size)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    uint32_t index;
+    uint8_t *decoded;
+
+    if (pack == NULL || entry == NULL || data == NULL || size == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (entry->compression == UTIL_ASSET_COMPRESSION_NONE) {
+        *data = pack->blob + entry->offset;
+        *size = entry->size;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    if (entry->compression != UTIL_ASSET_COMPRESSION_LZ4) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+    }
+
+    if (s_utilAssetMutex == NULL) {
+        USER_LOG_ERROR("Asset %s is compressed, call UtilAsset_Init first.", entry->name);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    index = (uint32_t) (entry - pack->entries);
+    osalHandler->MutexLock(s_utilAssetMutex);
+    if (pack->cache[index] == NULL) {
+        decoded = osalHandler->Malloc(entry->size);
+        if (decoded == NULL) {
+            USER_LOG_ERROR("Malloc %d bytes for asset %s failed.", entry->size, entry->name);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+        } else if (UtilLz4_DecompressBlock(pack->blob + entry->offset, entry->storedSize, decoded,
+                                           entry->size) != 0) {
+            USER_LOG_ERROR("Asset %s is corrupted.", entry->name);
+            osalHandler->Free(decoded);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        } else {
+            pack->cache[index] = decoded;
+        }
+    }
+
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        *data = pack->cache[index];
+        *size = entry->size;
+    }
+    osalHandler->MutexUnlock(s_utilAssetMutex);
+
+    return returnCode;
+}
+
+T_DjiReturnCode UtilAsset_Load(const T_UtilAssetPack *pack, const char *name, const uint8_t **data, uint32_t *size)
+{
+    const T_UtilAssetEntry *entry = UtilAsset_Find(pack, name);
+
+    if (entry == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    return UtilAsset_GetData(pack, entry, data, size);
+}
+
+void UtilAsset_ReleaseCache(const T_UtilAssetPack *pack)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint16_t i;
+
+    if (s_utilAssetMutex == NULL) {
+        return;
+    }
+
+    osalHandler->MutexLock(s_utilAssetMutex);
+    for (i = 0; i < pack->entryCount; i++) {
+        if (pack->cache[i] != NULL) {
+            osalHandler->Free(pack->cache[i]);
+            pack->cache[i] = NULL;
+        }
+    }
+    osalHandler->MutexUnlock(s_utilAssetMutex);
+}
+
+/* Private functions definition-----------------------------------------------*/
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,101 @@
+/**
+ ********************************************************************
+ * @file    util_asset.h
+ * @brief   This is the header file for "util_asset.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef UTIL_ASSET_H
+#define UTIL_ASSET_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Asset packs are generated by tools/asset_packer, the pack layout below must stay in sync with the packer. */
+#define UTIL_ASSET_NAME_HASH_OFFSET_BASIS       (2166136261u) /* 32 bit FNV-1a */
+#define UTIL_ASSET_NAME_HASH_PRIME              (16777619u)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    UTIL_ASSET_COMPRESSION_NONE = 0,
+    UTIL_ASSET_COMPRESSION_LZ4 = 1,
+} E_UtilAssetCompression;
+
+typedef struct {
+    const char *name;
+    uint32_t nameHash;
+    uint32_t offset; /*!< Offset of the stored data in the pack blob. */
+    uint32_t storedSize; /*!< Size of the stored data, compressed or not. */
+    uint32_t size; /*!< Size of the asset once decoded. */
+    uint8_t compression; /*!< See E_UtilAssetCompression. */
+} T_UtilAssetEntry;
+
+/**
+ * @brief Pack of assets embedded in the firmware: one blob holding the data of every asset, an index in the order the
+ * assets were given to the packer, and an open addressing hash table of the names for lookups in constant time.
+ */
+typedef struct {
+    const uint8_t *blob;
+    const T_UtilAssetEntry *entries;
+    uint16_t entryCount;
+    const uint16_t *buckets; /*!< Index of an entry plus one, 0 marks an empty bucket. */
+    uint16_t bucketMask; /*!< Bucket count minus one, the bucket count is a power of two. */
+    uint8_t **cache; /*!< Decoded copy of each compressed entry, NULL until the asset is first accessed. */
+} T_UtilAssetPack;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Create the lock of the decoded copies of compressed assets, call it once at startup after the osal handler
+ * is registered and before any task accesses an asset.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilAsset_Init(void);
+uint32_t UtilAsset_HashName(const char *name);
+const T_UtilAssetEntry *UtilAsset_Find(const T_UtilAssetPack *pack, const char *name);
+
+/**
+ * @brief Get the decoded data of an asset of a pack.
+ * @note Compressed assets are decoded into the heap on first access and the copy is kept until
+ * UtilAsset_ReleaseCache(), so the returned pointer can be handed to the psdk lib that keeps using it. Concurrent
+ * first accesses from several tasks get the same copy, decoding them needs UtilAsset_Init() to have been called.
+ * @param pack: pointer to the pack.
+ * @param entry: pointer to an entry of the pack.
+ * @param data: pointer to the decoded data.
+ * @param size: decoded size of the asset.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilAsset_GetData(const T_UtilAssetPack *pack, const T_UtilAssetEntry *entry,
+                                  const uint8_t **data, uint32_t *size);
+T_DjiReturnCode UtilAsset_Load(const T_UtilAssetPack *pack, const char *name, const uint8_t **data, uint32_t *size);
+void UtilAsset_ReleaseCache(const T_UtilAssetPack *pack);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTIL_ASSET_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
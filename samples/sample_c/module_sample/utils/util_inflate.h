@@ -0,0 +1,79 @@
+/**
+ ********************************************************************
+ * @file    util_inflate.h
+ * @brief   This is the header file for "util_inflate.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef UTIL_INFLATE_H
+#define UTIL_INFLATE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Parameters of the deflate format, see RFC 1951 */
+#define UTIL_INFLATE_WINDOW_SIZE        (32768)
+#define UTIL_INFLATE_MAX_MATCH          (258)
+#define UTIL_INFLATE_MIN_MATCH          (3)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Receives the decoded data, a chunk is only valid during the call.
+ * @return 0 to go on decoding, any other value stops the decoder which then returns it.
+ */
+typedef int32_t (*UtilInflateOutputFunc)(const uint8_t *data, uint32_t len, void *userData);
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Decode a raw deflate stream (no zlib or gzip header) held in memory. The decoded data is not buffered as a
+ * whole, it is handed to the output function in chunks of up to UTIL_INFLATE_WINDOW_SIZE bytes.
+ * @param src: pointer to the deflate stream.
+ * @param srcSize: size of the deflate stream.
+ * @param window: buffer of UTIL_INFLATE_WINDOW_SIZE bytes holding the history referenced by the stream.
+ * @param output: function receiving the decoded data.
+ * @param userData: user data passed to the output function.
+ * @param outSize: total size of the decoded data, can be NULL.
+ * @return 0 if the stream decodes within srcSize bytes, -1 if it is malformed, otherwise the value returned by output.
+ */
+int32_t UtilInflate_Decode(const uint8_t *src, uint32_t srcSize, uint8_t *window,
+                           UtilInflateOutputFunc output, void *userData, uint32_t *outSize);
+
+/**
+ * @brief Update the CRC-32 used by zip and gzip (reflected polynomial 0xEDB88320).
+ * @param crc: crc of the previous data, 0 for the first chunk.
+ * @param data: pointer to the data.
+ * @param len: length of the data.
+ * @return crc of all the data so far.
+ */
+uint32_t UtilInflate_Crc32(uint32_t crc, const uint8_t *data, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTIL_INFLATE_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
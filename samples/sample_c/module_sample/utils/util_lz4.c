@@ -0,0 +1,115 @@
+/**
+ ********************************************************************
+ * @file    util_lz4.c
+ * @brief   Bounds checked decoder of the lz4 block format, used for the assets packed by tools/asset_packer.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "util_lz4.h"
+#include <string.h>
+
+/* Private constants ---------------------------------------------------------*/
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+
+/* Private functions declaration ---------------------------------------------*/
+static int32_t UtilLz4_ReadLength(const uint8_t **src, const uint8_t *srcEnd, uint32_t *length);
+
+/* Exported functions definition ---------------------------------------------*/
+int32_t UtilLz4_DecompressBlock(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize)
+{
+    const uint8_t *srcEnd = src + srcSize;
+    uint8_t *out = dst;
+    uint8_t *dstEnd = dst + dstSize;
+    uint32_t literalLength;
+    uint32_t matchLength;
+    uint32_t offset;
+    uint8_t token;
+
+    while (src < srcEnd) {
+        token = *src++;
+
+        literalLength = token >> 4;
+        if (literalLength == 15 && UtilLz4_ReadLength(&src, srcEnd, &literalLength) != 0) {
+            return -1;
+        }
+        if (literalLength > (uint32_t) (srcEnd - src) || literalLength > (uint32_t) (dstEnd - out)) {
+            return -1;
+        }
+        memcpy(out, src, literalLength);
+        out += literalLength;
+        src += literalLength;
+
+        /* the last sequence of a block has no match part */
+        if (src == srcEnd) {
+            break;
+        }
+
+        if (srcEnd - src < 2) {
+            return -1;
+        }
+        offset = (uint32_t) src[0] | ((uint32_t) src[1] << 8);
+        src += 2;
+        if (offset == 0 || offset > (uint32_t) (out - dst)) {
+            return -1;
+        }
+
+        matchLength = token & 0x0F;
+        if (matchLength == 15 && UtilLz4_ReadLength(&src, srcEnd, &matchLength) != 0) {
+            return -1;
+        }
+        matchLength += UTIL_LZ4_MIN_MATCH;
+        if (matchLength > (uint32_t) (dstEnd - out)) {
+            return -1;
+        }
+
+        /* byte copy on purpose, the match may overlap the bytes it produces */
+        while (matchLength-- > 0) {
+            *out = *(out - offset);
+            out++;
+        }
+    }
+
+    return out == dstEnd ? 0 : -1;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static int32_t UtilLz4_ReadLength(const uint8_t **src, const uint8_t *srcEnd, uint32_t *length)
+{
+    uint8_t byte;
+
+    do {
+        if (*src >= srcEnd) {
+            return -1;
+        }
+        byte = *(*src)++;
+        if (*length > UINT32_MAX - byte) {
+            return -1;
+        }
+        *length += byte;
+    } while (byte == 255);
+
+    return 0;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
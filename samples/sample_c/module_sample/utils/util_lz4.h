@@ -0,0 +1,62 @@
+/**
+ ********************************************************************
+ * @file    util_lz4.h
+ * @brief   This is the header file for "util_lz4.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef UTIL_LZ4_H
+#define UTIL_LZ4_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Parameters of the lz4 block format, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md */
+#define UTIL_LZ4_MIN_MATCH              (4)
+#define UTIL_LZ4_LAST_LITERALS          (5)
+#define UTIL_LZ4_MF_LIMIT               (12)
+#define UTIL_LZ4_MAX_DISTANCE           (65535)
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Decode one lz4 block (raw block format, no frame header).
+ * @param src: pointer to the compressed block.
+ * @param srcSize: size of the compressed block.
+ * @param dst: pointer to the output buffer.
+ * @param dstSize: exact size of the decoded data.
+ * @return 0 if the block decodes to exactly dstSize bytes, -1 if the block is malformed.
+ */
+int32_t UtilLz4_DecompressBlock(const uint8_t *src, uint32_t srcSize, uint8_t *dst, uint32_t dstSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTIL_LZ4_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
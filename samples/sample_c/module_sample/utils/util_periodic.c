@@ -0,0 +1,200 @@
+/**
+ ********************************************************************
+ * @file    util_periodic.c
+ * @brief
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "util_periodic.h"
+#include "dji_platform.h"
+#include "dji_logger.h"
+
+/* Private constants ---------------------------------------------------------*/
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static const uint32_t s_jitterBucketUpperBoundUs[UTIL_PERIODIC_JITTER_BUCKET_NUM - 1] = {
+    100, 200, 500, 1000, 2000, 5000, 10000
+};
+static T_UtilPeriodicClock s_defaultClock;
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode UtilPeriodic_OsalGetTimeUs(uint64_t *us);
+static T_DjiReturnCode UtilPeriodic_OsalSleepUntilUs(uint64_t deadlineUs);
+static void UtilPeriodic_RecordJitter(T_UtilPeriodic *pthis, uint32_t jitterUs);
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Set the clock used by the executors initialized without one. The platform registers it with the OSAL
+ * handler when it can sleep on finer deadlines than the millisecond task sleep.
+ * @param clock: default time source, NULL members keep using the OSAL handler.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilPeriodic_SetDefaultClock(const T_UtilPeriodicClock *clock)
+{
+    if (clock == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    s_defaultClock = *clock;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Start a periodic schedule, the first deadline is one period after the call.
+ * @param pthis: executor to initialize.
+ * @param periodUs: cycle period, in microseconds.
+ * @param clock: time source, NULL to use the default clock.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilPeriodic_Init(T_UtilPeriodic *pthis, uint32_t periodUs, const T_UtilPeriodicClock *clock)
+{
+    T_DjiReturnCode returnCode;
+
+    if (pthis == NULL || periodUs == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    memset(pthis, 0, sizeof(T_UtilPeriodic));
+    if (clock != NULL) {
+        pthis->clock = *clock;
+    }
+    if (pthis->clock.GetTimeUs == NULL) {
+        pthis->clock.GetTimeUs = s_defaultClock.GetTimeUs != NULL ? s_defaultClock.GetTimeUs :
+                                 UtilPeriodic_OsalGetTimeUs;
+    }
+    if (pthis->clock.SleepUntilUs == NULL) {
+        pthis->clock.SleepUntilUs = s_defaultClock.SleepUntilUs != NULL ? s_defaultClock.SleepUntilUs :
+                                    UtilPeriodic_OsalSleepUntilUs;
+    }
+
+    returnCode = pthis->clock.GetTimeUs(&pthis->startTimeUs);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    pthis->periodUs = periodUs;
+    pthis->nextDeadlineUs = pthis->startTimeUs + periodUs;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Wait for the next deadline of the schedule. Deadlines are kept on the absolute grid start + n * period, so
+ * the time spent in the cycle body and the sleep granularity never accumulate into drift. When the caller is late by
+ * one or more whole periods the missed deadlines are skipped instead of being run back to back.
+ * @param pthis: executor.
+ * @return Number of periods the schedule advanced, 1 for an on time cycle, 1 + skipped cycles after an overrun.
+ */
+uint32_t UtilPeriodic_WaitNextCycle(T_UtilPeriodic *pthis)
+{
+    uint64_t nowUs = 0;
+    uint64_t lateUs;
+    uint32_t missedCycles = 0;
+
+    pthis->clock.GetTimeUs(&nowUs);
+    if (nowUs > pthis->nextDeadlineUs) {
+        pthis->overrunCount++;
+    } else if (nowUs < pthis->nextDeadlineUs) {
+        pthis->clock.SleepUntilUs(pthis->nextDeadlineUs);
+        pthis->clock.GetTimeUs(&nowUs);
+    }
+
+    if (nowUs >= pthis->nextDeadlineUs) {
+        lateUs = nowUs - pthis->nextDeadlineUs;
+        missedCycles = (uint32_t) (lateUs / pthis->periodUs);
+        UtilPeriodic_RecordJitter(pthis, (uint32_t) (lateUs - (uint64_t) missedCycles * pthis->periodUs));
+    } else {
+        UtilPeriodic_RecordJitter(pthis, (uint32_t) (pthis->nextDeadlineUs - nowUs));
+    }
+
+    pthis->skippedCycleCount += missedCycles;
+    pthis->cycleCount++;
+    pthis->nextDeadlineUs += (uint64_t) (missedCycles + 1) * pthis->periodUs;
+
+    return missedCycles + 1;
+}
+
+/**
+ * @brief Get the time elapsed since the executor was started, measured on its clock.
+ * @param pthis: executor.
+ * @return Elapsed time, in milliseconds.
+ */
+uint32_t UtilPeriodic_GetElapsedMs(T_UtilPeriodic *pthis)
+{
+    uint64_t nowUs = 0;
+
+    pthis->clock.GetTimeUs(&nowUs);
+    if (nowUs < pthis->startTimeUs) {
+        return 0;
+    }
+
+    return (uint32_t) ((nowUs - pthis->startTimeUs) / 1000);
+}
+
+void UtilPeriodic_PrintStatistics(const T_UtilPeriodic *pthis, const char *name)
+{
+    USER_LOG_INFO("[%s] period %u us, cycles %u, overruns %u, skipped %u, max jitter %u us.", name, pthis->periodUs,
+                  pthis->cycleCount, pthis->overrunCount, pthis->skippedCycleCount, pthis->maxJitterUs);
+    USER_LOG_INFO("[%s] jitter <100us:%u <200us:%u <500us:%u <1ms:%u <2ms:%u <5ms:%u <10ms:%u >=10ms:%u", name,
+                  pthis->jitterHistogram[0], pthis->jitterHistogram[1], pthis->jitterHistogram[2],
+                  pthis->jitterHistogram[3], pthis->jitterHistogram[4], pthis->jitterHistogram[5],
+                  pthis->jitterHistogram[6], pthis->jitterHistogram[7]);
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode UtilPeriodic_OsalGetTimeUs(uint64_t *us)
+{
+    return DjiPlatform_GetOsalHandler()->GetTimeUs(us);
+}
+
+static T_DjiReturnCode UtilPeriodic_OsalSleepUntilUs(uint64_t deadlineUs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint64_t nowUs = 0;
+
+    osalHandler->GetTimeUs(&nowUs);
+    if (nowUs >= deadlineUs) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    // Round up, waking late by less than a millisecond is absorbed by the next deadline, waking early is not.
+    return osalHandler->TaskSleepMs((uint32_t) ((deadlineUs - nowUs + 999) / 1000));
+}
+
+static void UtilPeriodic_RecordJitter(T_UtilPeriodic *pthis, uint32_t jitterUs)
+{
+    uint8_t bucket = 0;
+
+    while (bucket < UTIL_PERIODIC_JITTER_BUCKET_NUM - 1 && jitterUs >= s_jitterBucketUpperBoundUs[bucket]) {
+        bucket++;
+    }
+
+    pthis->jitterHistogram[bucket]++;
+    if (jitterUs > pthis->maxJitterUs) {
+        pthis->maxJitterUs = jitterUs;
+    }
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,76 @@
+/**
+ ********************************************************************
+ * @file    util_periodic.h
+ * @brief   This is the header file for "util_periodic.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef UTIL_PERIODIC_H
+#define UTIL_PERIODIC_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* Jitter buckets, upper bounds are 100us, 200us, 500us, 1ms, 2ms, 5ms, 10ms and unbounded. */
+#define UTIL_PERIODIC_JITTER_BUCKET_NUM     (8)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Time source of the periodic executor. Members left NULL are taken from the default clock, see
+ * UtilPeriodic_SetDefaultClock, or else from the microsecond clock and the task sleep of the OSAL handler. A simulated
+ * clock can be plugged in to run the executor without a scheduler.
+ */
+typedef struct {
+    T_DjiReturnCode (*GetTimeUs)(uint64_t *us);
+    T_DjiReturnCode (*SleepUntilUs)(uint64_t deadlineUs);
+} T_UtilPeriodicClock;
+
+typedef struct {
+    uint32_t periodUs;
+    uint64_t startTimeUs;
+    uint64_t nextDeadlineUs;
+    uint32_t cycleCount;
+    uint32_t overrunCount;
+    uint32_t skippedCycleCount;
+    uint32_t maxJitterUs;
+    uint32_t jitterHistogram[UTIL_PERIODIC_JITTER_BUCKET_NUM];
+    T_UtilPeriodicClock clock;
+} T_UtilPeriodic;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode UtilPeriodic_SetDefaultClock(const T_UtilPeriodicClock *clock);
+T_DjiReturnCode UtilPeriodic_Init(T_UtilPeriodic *pthis, uint32_t periodUs, const T_UtilPeriodicClock *clock);
+uint32_t UtilPeriodic_WaitNextCycle(T_UtilPeriodic *pthis);
+uint32_t UtilPeriodic_GetElapsedMs(T_UtilPeriodic *pthis);
+void UtilPeriodic_PrintStatistics(const T_UtilPeriodic *pthis, const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTIL_PERIODIC_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -0,0 +1,395 @@
+/**
+ ********************************************************************
+ * @file    util_timer.c
+ * @brief   One shot deadline timers served by a single task, the task sleeps until the earliest
+ * deadline and does not wake at all while no timer is armed.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "util_timer.h"
+#include "dji_logger.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define UTIL_TIMER_SERVICE_EXIT_TIMEOUT_MS      (1000)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode UtilTimer_OsalGetTimeUs(uint64_t *us);
+static void UtilTimer_Unlink(T_UtilTimerService *pthis, T_UtilTimer *timer);
+static void *UtilTimer_ServiceTask(void *arg);
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Initialize a timer service. Timers can be armed right away, they fire once the service task is started or
+ * whenever UtilTimer_ServiceRunExpired is called.
+ * @param pthis: service to initialize.
+ * @param clock: time source, NULL to use the OSAL clock.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilTimer_ServiceInit(T_UtilTimerService *pthis, const T_UtilTimerClock *clock)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+
+    if (pthis == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    memset(pthis, 0, sizeof(T_UtilTimerService));
+    if (clock != NULL) {
+        pthis->clock = *clock;
+    }
+    if (pthis->clock.GetTimeUs == NULL) {
+        pthis->clock.GetTimeUs = UtilTimer_OsalGetTimeUs;
+    }
+
+    returnCode = osalHandler->MutexCreate(&pthis->mutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create timer service mutex error: 0x%08llX.", returnCode);
+        return returnCode;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &pthis->wakeSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create timer service semaphore error: 0x%08llX.", returnCode);
+        goto destroyMutex;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &pthis->exitSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create timer service semaphore error: 0x%08llX.", returnCode);
+        goto destroyWakeSema;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+destroyWakeSema:
+    osalHandler->SemaphoreDestroy(pthis->wakeSema);
+    pthis->wakeSema = NULL;
+destroyMutex:
+    osalHandler->MutexDestroy(pthis->mutex);
+    pthis->mutex = NULL;
+    return returnCode;
+}
+
+/**
+ * @brief Start the task firing the timers of the service.
+ * @param pthis: initialized service.
+ * @param name: task name.
+ * @param stackSize: task stack size, the timer callbacks run on this stack.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilTimer_ServiceStart(T_UtilTimerService *pthis, const char *name, uint32_t stackSize)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+
+    if (pthis == NULL || pthis->mutex == NULL || pthis->isRunning == true) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    pthis->isRunning = true;
+    returnCode = osalHandler->TaskCreate(name, UtilTimer_ServiceTask, stackSize, pthis, &pthis->task);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create timer service task error: 0x%08llX.", returnCode);
+        pthis->isRunning = false;
+        return returnCode;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Stop the service task if it was started, disarm every timer and release the service.
+ * @param pthis: service.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilTimer_ServiceDeInit(T_UtilTimerService *pthis)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    if (pthis == NULL || pthis->mutex == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (pthis->isRunning == true) {
+        pthis->isRunning = false;
+        osalHandler->SemaphorePost(pthis->wakeSema);
+        if (osalHandler->SemaphoreTimedWait(pthis->exitSema, UTIL_TIMER_SERVICE_EXIT_TIMEOUT_MS) !=
+            DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Wait timer service task exit timeout.");
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        }
+        osalHandler->TaskDestroy(pthis->task);
+        pthis->task = NULL;
+    }
+
+    osalHandler->MutexLock(pthis->mutex);
+    while (pthis->head != NULL) {
+        UtilTimer_Unlink(pthis, pthis->head);
+    }
+    osalHandler->MutexUnlock(pthis->mutex);
+
+    osalHandler->SemaphoreDestroy(pthis->exitSema);
+    osalHandler->SemaphoreDestroy(pthis->wakeSema);
+    osalHandler->MutexDestroy(pthis->mutex);
+    pthis->exitSema = NULL;
+    pthis->wakeSema = NULL;
+    pthis->mutex = NULL;
+
+    return returnCode;
+}
+
+/**
+ * @brief Fire every timer whose deadline is not later than the current time, in deadline order. Callbacks run without
+ * the service lock held, they may arm or stop any timer, including their own. A timer stopped by another task while
+ * its callback is already being dispatched is not recalled, callbacks re-check the state they act on.
+ * @param pthis: service.
+ * @param nextDeadlineUs: earliest deadline still armed after the call, UTIL_TIMER_NO_DEADLINE when none is. May be
+ * NULL.
+ * @return Number of timers fired.
+ */
+uint32_t UtilTimer_ServiceRunExpired(T_UtilTimerService *pthis, uint64_t *nextDeadlineUs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_UtilTimer *timer;
+    UtilTimerCallback callback;
+    void *callbackArg;
+    uint64_t nowUs = 0;
+    uint32_t firedCount = 0;
+
+    pthis->clock.GetTimeUs(&nowUs);
+
+    osalHandler->MutexLock(pthis->mutex);
+    pthis->wakeupCount++;
+    // Timers armed by the callbacks of this pass carry its wakeup count and are left to the next pass, so a callback
+    // re-arming itself with no delay cannot hold the service forever.
+    while (pthis->head != NULL && pthis->head->deadlineUs <= nowUs &&
+           pthis->head->armedWakeup != pthis->wakeupCount) {
+        timer = pthis->head;
+        UtilTimer_Unlink(pthis, timer);
+        if (nowUs - timer->deadlineUs > pthis->maxLateUs) {
+            pthis->maxLateUs = (uint32_t) (nowUs - timer->deadlineUs);
+        }
+        pthis->firedCount++;
+        firedCount++;
+
+        callback = timer->callback;
+        callbackArg = timer->arg;
+        osalHandler->MutexUnlock(pthis->mutex);
+        callback(callbackArg);
+        osalHandler->MutexLock(pthis->mutex);
+    }
+
+    if (nextDeadlineUs != NULL) {
+        *nextDeadlineUs = pthis->head != NULL ? pthis->head->deadlineUs : UTIL_TIMER_NO_DEADLINE;
+    }
+    osalHandler->MutexUnlock(pthis->mutex);
+
+    return firedCount;
+}
+
+/**
+ * @brief Get the current time of the service clock, the base of the deadlines given to UtilTimer_StartAt.
+ * @param pthis: service.
+ * @param us: current time, in microseconds.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilTimer_GetTimeUs(T_UtilTimerService *pthis, uint64_t *us)
+{
+    return pthis->clock.GetTimeUs(us);
+}
+
+void UtilTimer_PrintStatistics(const T_UtilTimerService *pthis, const char *name)
+{
+    USER_LOG_INFO("[%s] wakeups %u, timers fired %u, max late %u us.", name, pthis->wakeupCount, pthis->firedCount,
+                  pthis->maxLateUs);
+}
+
+void UtilTimer_Init(T_UtilTimer *timer, UtilTimerCallback callback, void *arg)
+{
+    memset(timer, 0, sizeof(T_UtilTimer));
+    timer->callback = callback;
+    timer->arg = arg;
+}
+
+/**
+ * @brief Arm a timer to fire after a delay, re-arming an armed timer moves its deadline.
+ * @param pthis: service.
+ * @param timer: timer initialized with UtilTimer_Init.
+ * @param delayMs: delay from now, 0 fires on the next pass of the service.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilTimer_Start(T_UtilTimerService *pthis, T_UtilTimer *timer, uint32_t delayMs)
+{
+    uint64_t nowUs = 0;
+    T_DjiReturnCode returnCode;
+
+    returnCode = pthis->clock.GetTimeUs(&nowUs);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    return UtilTimer_StartAt(pthis, timer, nowUs + (uint64_t) delayMs * 1000);
+}
+
+/**
+ * @brief Arm a timer to fire at an absolute deadline of the service clock. Periodic timers re-arm at their previous
+ * deadline plus the period, so the dispatch latency never accumulates.
+ * @param pthis: service.
+ * @param timer: timer initialized with UtilTimer_Init.
+ * @param deadlineUs: deadline, in microseconds, a deadline in the past fires on the next pass of the service.
+ * @return Execution result.
+ */
+T_DjiReturnCode UtilTimer_StartAt(T_UtilTimerService *pthis, T_UtilTimer *timer, uint64_t deadlineUs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_UtilTimer **link;
+    bool isEarliest;
+
+    if (pthis == NULL || timer == NULL || timer->callback == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    osalHandler->MutexLock(pthis->mutex);
+    if (timer->isArmed == true) {
+        UtilTimer_Unlink(pthis, timer);
+    }
+
+    // Sorted by deadline, timers with the same deadline fire in the order they were armed.
+    link = &pthis->head;
+    while (*link != NULL && (*link)->deadlineUs <= deadlineUs) {
+        link = &(*link)->next;
+    }
+    timer->deadlineUs = deadlineUs;
+    timer->armedWakeup = pthis->wakeupCount;
+    timer->next = *link;
+    timer->isArmed = true;
+    *link = timer;
+    isEarliest = (pthis->head == timer);
+    osalHandler->MutexUnlock(pthis->mutex);
+
+    // The task only has to recompute its sleep when the earliest deadline moved forward.
+    if (isEarliest == true && pthis->isRunning == true) {
+        osalHandler->SemaphorePost(pthis->wakeSema);
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode UtilTimer_Stop(T_UtilTimerService *pthis, T_UtilTimer *timer)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (pthis == NULL || timer == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    // The task is not woken, at worst it wakes once for a deadline that is gone and goes back to sleep.
+    osalHandler->MutexLock(pthis->mutex);
+    if (timer->isArmed == true) {
+        UtilTimer_Unlink(pthis, timer);
+    }
+    osalHandler->MutexUnlock(pthis->mutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+bool UtilTimer_IsArmed(T_UtilTimerService *pthis, const T_UtilTimer *timer)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    bool isArmed;
+
+    osalHandler->MutexLock(pthis->mutex);
+    isArmed = timer->isArmed;
+    osalHandler->MutexUnlock(pthis->mutex);
+
+    return isArmed;
+}
+
+uint32_t UtilTimer_GetArmedCount(T_UtilTimerService *pthis)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_UtilTimer *timer;
+    uint32_t armedCount = 0;
+
+    osalHandler->MutexLock(pthis->mutex);
+    for (timer = pthis->head; timer != NULL; timer = timer->next) {
+        armedCount++;
+    }
+    osalHandler->MutexUnlock(pthis->mutex);
+
+    return armedCount;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode UtilTimer_OsalGetTimeUs(uint64_t *us)
+{
+    return DjiPlatform_GetOsalHandler()->GetTimeUs(us);
+}
+
+static void UtilTimer_Unlink(T_UtilTimerService *pthis, T_UtilTimer *timer)
+{
+    T_UtilTimer **link = &pthis->head;
+
+    while (*link != NULL && *link != timer) {
+        link = &(*link)->next;
+    }
+    if (*link != NULL) {
+        *link = timer->next;
+    }
+    timer->next = NULL;
+    timer->isArmed = false;
+}
+
+static void *UtilTimer_ServiceTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_UtilTimerService *pthis = (T_UtilTimerService *) arg;
+    uint64_t nextDeadlineUs = UTIL_TIMER_NO_DEADLINE;
+    uint64_t nowUs = 0;
+
+    while (pthis->isRunning == true) {
+        UtilTimer_ServiceRunExpired(pthis, &nextDeadlineUs);
+        if (nextDeadlineUs == UTIL_TIMER_NO_DEADLINE) {
+            // Nothing armed, sleep until a timer is started or the service is stopped.
+            osalHandler->SemaphoreWait(pthis->wakeSema);
+            continue;
+        }
+
+        pthis->clock.GetTimeUs(&nowUs);
+        if (nextDeadlineUs > nowUs) {
+            // Round up, a wait cut short by the millisecond granularity would only cost an empty pass.
+            osalHandler->SemaphoreTimedWait(pthis->wakeSema, (uint32_t) ((nextDeadlineUs - nowUs + 999) / 1000));
+        }
+    }
+
+    osalHandler->SemaphorePost(pthis->exitSema);
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,99 @@
+/**
+ ********************************************************************
+ * @file    util_timer.h
+ * @brief   This is the header file for "util_timer.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef UTIL_TIMER_H
+#define UTIL_TIMER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_platform.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define UTIL_TIMER_NO_DEADLINE      (UINT64_MAX)
+
+/* Exported types ------------------------------------------------------------*/
+typedef void (*UtilTimerCallback)(void *arg);
+
+/**
+ * @brief One shot timer, owned by the caller and linked into the service while it is armed. A periodic timer re-arms
+ * itself from its callback with UtilTimer_StartAt, based on its previous deadline so that the period does not drift.
+ */
+typedef struct UtilTimer {
+    struct UtilTimer *next;
+    uint64_t deadlineUs;
+    UtilTimerCallback callback;
+    void *arg;
+    uint32_t armedWakeup;
+    bool isArmed;
+} T_UtilTimer;
+
+/**
+ * @brief Time source of the timer service, GetTimeUs may be left NULL to use the monotonic microsecond clock of the
+ * OSAL handler. A simulated clock can be plugged in and the service driven by UtilTimer_ServiceRunExpired, without
+ * starting its task.
+ */
+typedef struct {
+    T_DjiReturnCode (*GetTimeUs)(uint64_t *us);
+} T_UtilTimerClock;
+
+typedef struct {
+    T_UtilTimer *head;
+    T_DjiMutexHandle mutex;
+    T_DjiSemaHandle wakeSema;
+    T_DjiSemaHandle exitSema;
+    T_DjiTaskHandle task;
+    volatile bool isRunning;
+    T_UtilTimerClock clock;
+    uint32_t wakeupCount;
+    uint32_t firedCount;
+    uint32_t maxLateUs;
+} T_UtilTimerService;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode UtilTimer_ServiceInit(T_UtilTimerService *pthis, const T_UtilTimerClock *clock);
+T_DjiReturnCode UtilTimer_ServiceStart(T_UtilTimerService *pthis, const char *name, uint32_t stackSize);
+T_DjiReturnCode UtilTimer_ServiceDeInit(T_UtilTimerService *pthis);
+uint32_t UtilTimer_ServiceRunExpired(T_UtilTimerService *pthis, uint64_t *nextDeadlineUs);
+T_DjiReturnCode UtilTimer_GetTimeUs(T_UtilTimerService *pthis, uint64_t *us);
+void UtilTimer_PrintStatistics(const T_UtilTimerService *pthis, const char *name);
+
+void UtilTimer_Init(T_UtilTimer *timer, UtilTimerCallback callback, void *arg);
+T_DjiReturnCode UtilTimer_Start(T_UtilTimerService *pthis, T_UtilTimer *timer, uint32_t delayMs);
+T_DjiReturnCode UtilTimer_StartAt(T_UtilTimerService *pthis, T_UtilTimer *timer, uint64_t deadlineUs);
+T_DjiReturnCode UtilTimer_Stop(T_UtilTimerService *pthis, T_UtilTimer *timer);
+bool UtilTimer_IsArmed(T_UtilTimerService *pthis, const T_UtilTimer *timer);
+uint32_t UtilTimer_GetArmedCount(T_UtilTimerService *pthis);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // UTIL_TIMER_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
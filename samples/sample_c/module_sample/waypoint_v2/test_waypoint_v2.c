@@ -25,6 +25,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include <widget_interaction_test/test_widget_interaction.h>
 #include "test_waypoint_v2.h"
+#include "test_waypoint_v2_mission.h"
 #include "dji_waypoint_v2.h"
 #include "dji_fc_subscription.h"
 #include "dji_logger.h"
@@ -32,6 +33,9 @@
 #include "math.h"
 
 /* Private constants ---------------------------------------------------------*/
+#define DJI_TEST_WAYPOINT_V2_POSITION_TIMEOUT_MS            (5000)
+#define DJI_TEST_WAYPOINT_V2_POSITION_CHECK_INTERVAL_MS     (100)
+#define DJI_TEST_WAYPOINT_V2_CHUNK_FINISH_TIMEOUT_MS        (10 * 60 * 1000)
 
 /* Private types -------------------------------------------------------------*/
 typedef struct {
@@ -46,8 +50,10 @@ typedef struct {
 
 /* Private values -------------------------------------------------------------*/
 static T_DjiOsalHandler *osalHandler = NULL;
-static const dji_f32_t TEST_EARTH_RADIUS = 6378137.0;
 static uint32_t s_missionID = 12345;
+static T_DjiTestWaypointV2MissionBuilder s_missionBuilder = {0};
+static T_DJIWaypointV2Action *s_chunkActions = NULL;
+static T_DjiSemaHandle s_missionFinishedSema = NULL;
 //reference note of "T_DjiWaypointV2MissionEventPush"
 static const T_DjiTestWaypointV2EventStr s_waypointV2EventStr[] = {
     {.eventID = 0x01, .eventStr = "Interrupt Event"},
@@ -75,10 +81,10 @@ static const T_DjiTestWaypointV2StateStr s_waypointV2StateStr[] = {
 /* Private functions declaration ---------------------------------------------*/
 uint8_t DJiTest_WaypointV2GetMissionEventIndex(uint8_t eventID);
 uint8_t DjiTest_WaypointV2GetMissionStateIndex(uint8_t state);
-static T_DJIWaypointV2Action *DjiTest_WaypointV2GenerateWaypointV2Actions(uint16_t actionNum);
-static T_DjiWaypointV2 *DjiTest_WaypointV2GeneratePolygonWaypointV2(dji_f32_t radius, uint16_t polygonNum);
-static void DjiTest_WaypointV2SetDefaultSetting(T_DjiWaypointV2 *waypointV2);
-static T_DjiReturnCode DjiTest_WaypointV2UploadMission(uint16_t missionNum);
+static T_DjiReturnCode DjiTest_WaypointV2GetReferencePosition(T_DjiFcSubscriptionPositionFused *positionFused);
+static T_DjiReturnCode DjiTest_WaypointV2GenerateMission(dji_f32_t radius, uint16_t polygonNum);
+static void DjiTest_WaypointV2FreeMission(void);
+static T_DjiReturnCode DjiTest_WaypointV2UploadMission(uint16_t chunkIndex);
 static T_DjiReturnCode DjiTest_WaypointV2EventCallback(T_DjiWaypointV2MissionEventPush eventData);
 static T_DjiReturnCode DjiTest_WaypointV2StateCallback(T_DjiWaypointV2MissionStatePush stateData);
 static T_DjiReturnCode DjiTest_WaypointV2Init(void);
@@ -90,6 +96,8 @@ T_DjiReturnCode DjiTest_WaypointV2RunSample(void)
     T_DjiReturnCode returnCode;
     uint32_t timeOutMs = 1000;
     uint16_t missionNum = 8;
+    uint16_t chunkNum;
+    uint16_t chunkIndex;
     T_DjiWaypointV2GlobalCruiseSpeed setGlobalCruiseSpeed = 0;
     T_DjiWaypointV2GlobalCruiseSpeed getGlobalCruiseSpeed = 0;
 
@@ -130,7 +138,12 @@ T_DjiReturnCode DjiTest_WaypointV2RunSample(void)
 
     USER_LOG_INFO("--> Step 4: Upload waypoint V2 mission\r\n");
     DjiTest_WidgetLogAppend("--> Step 4: Upload waypoint V2 mission\r\n");
-    returnCode = DjiTest_WaypointV2UploadMission(missionNum);
+    returnCode = DjiTest_WaypointV2GenerateMission(6, missionNum - 2);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Generate waypoint V2 mission failed, error code: 0x%08X", returnCode);
+        goto out;
+    }
+    returnCode = DjiTest_WaypointV2UploadMission(0);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Upload waypoint V2 mission failed, error code: 0x%08X", returnCode);
         goto out;
@@ -184,9 +197,37 @@ T_DjiReturnCode DjiTest_WaypointV2RunSample(void)
     }
     osalHandler->TaskSleepMs(50 * timeOutMs);
 
-    USER_LOG_INFO("--> Step 10: Deinit Waypoint V2 sample\r\n");
-    DjiTest_WidgetLogAppend("--> Step 10: Deinit Waypoint V2 sample\r\n");
+    USER_LOG_INFO("--> Step 10: Fly the remaining chunks of waypoint V2 mission\r\n");
+    DjiTest_WidgetLogAppend("--> Step 10: Fly the remaining chunks of waypoint V2 mission\r\n");
+    chunkNum = DjiTest_WaypointV2MissionGetChunkNum(&s_missionBuilder,
+                                                    DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT);
+    for (chunkIndex = 1; chunkIndex < chunkNum; chunkIndex++) {
+        returnCode = osalHandler->SemaphoreTimedWait(s_missionFinishedSema,
+                                                     DJI_TEST_WAYPOINT_V2_CHUNK_FINISH_TIMEOUT_MS);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Wait for chunk %d of waypoint V2 mission failed, error code: 0x%08X", chunkIndex - 1,
+                           returnCode);
+            goto out;
+        }
+
+        returnCode = DjiTest_WaypointV2UploadMission(chunkIndex);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Upload chunk %d of waypoint V2 mission failed, error code: 0x%08X", chunkIndex,
+                           returnCode);
+            goto out;
+        }
+        returnCode = DjiWaypointV2_Start();
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Start chunk %d of waypoint V2 mission failed, error code: 0x%08X", chunkIndex,
+                           returnCode);
+            goto out;
+        }
+    }
+
+    USER_LOG_INFO("--> Step 11: Deinit Waypoint V2 sample\r\n");
+    DjiTest_WidgetLogAppend("--> Step 11: Deinit Waypoint V2 sample\r\n");
 out:
+    DjiTest_WaypointV2FreeMission();
     returnCode = DjiTest_WaypointV2DeInit();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Deinit waypoint V2 sample failed, error code: 0x%08X", returnCode);
@@ -199,108 +240,6 @@ out:
 }
 
 /* Private functions definition-----------------------------------------------*/
-static T_DJIWaypointV2Action *DjiTest_WaypointV2GenerateWaypointV2Actions(uint16_t actionNum)
-{
-    T_DJIWaypointV2Action *actions = NULL;
-    uint16_t i;
-    T_DJIWaypointV2Trigger trigger = {0};
-    T_DJIWaypointV2SampleReachPointTriggerParam sampleReachPointTriggerParam = {0};
-    T_DJIWaypointV2Actuator actuator = {0};
-    T_DJIWaypointV2Action action = {0};
-
-    actions = osalHandler->Malloc(actionNum * sizeof(T_DJIWaypointV2Action));
-    if (actions == NULL) {
-        return NULL;
-    }
-
-    for (i = 0; i < actionNum; i++) {
-        sampleReachPointTriggerParam.waypointIndex = i;
-        sampleReachPointTriggerParam.terminateNum = 0;
-
-        trigger.actionTriggerType = DJI_WAYPOINT_V2_ACTION_TRIGGER_TYPE_SAMPLE_REACH_POINT;
-        trigger.sampleReachPointTriggerParam.terminateNum = sampleReachPointTriggerParam.terminateNum;
-        trigger.sampleReachPointTriggerParam.waypointIndex = sampleReachPointTriggerParam.waypointIndex;
-
-        actuator.actuatorType = DJI_WAYPOINT_V2_ACTION_ACTUATOR_TYPE_CAMERA;
-        actuator.actuatorIndex = 0;
-        actuator.cameraActuatorParam.operationType = DJI_WAYPOINT_V2_ACTION_ACTUATOR_CAMERA_OPERATION_TYPE_TAKE_PHOTO;
-
-        action.actionId = i;
-        memcpy(&action.actuator, &actuator, sizeof(actuator));
-        memcpy(&action.trigger, &trigger, sizeof(trigger));
-
-        actions[i] = action;
-    }
-
-    return actions;
-}
-
-static void DjiTest_WaypointV2SetDefaultSetting(T_DjiWaypointV2 *waypointV2)
-{
-    waypointV2->waypointType = DJI_WAYPOINT_V2_FLIGHT_PATH_MODE_GO_TO_POINT_IN_STRAIGHT_AND_STOP;
-    waypointV2->headingMode = DJI_WAYPOINT_V2_HEADING_MODE_AUTO;
-    waypointV2->config.useLocalMaxVel = 0;
-    waypointV2->config.useLocalCruiseVel = 0;
-    waypointV2->dampingDistance = 40;
-    waypointV2->heading = 0;
-    waypointV2->turnMode = DJI_WAYPOINT_V2_TURN_MODE_CLOCK_WISE;
-
-    waypointV2->pointOfInterest.positionX = 0;
-    waypointV2->pointOfInterest.positionY = 0;
-    waypointV2->pointOfInterest.positionZ = 0;
-    waypointV2->maxFlightSpeed = 9;
-    waypointV2->autoFlightSpeed = 2;
-}
-
-static T_DjiWaypointV2 *DjiTest_WaypointV2GeneratePolygonWaypointV2(dji_f32_t radius, uint16_t polygonNum)
-{
-    // Let's create a vector to store our waypoints in.
-    T_DjiReturnCode returnCode;
-    T_DjiWaypointV2 *waypointV2List = (T_DjiWaypointV2 *) osalHandler->Malloc(
-        (polygonNum + 2) * sizeof(T_DjiWaypointV2));
-    T_DjiWaypointV2 startPoint;
-    T_DjiWaypointV2 waypointV2;
-    T_DjiFcSubscriptionPositionFused positionFused = {0};
-    T_DjiDataTimestamp timestamp = {0};
-
-    osalHandler->TaskSleepMs(1000);
-    returnCode = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED,
-                                                         (uint8_t *) &positionFused,
-                                                         sizeof(T_DjiFcSubscriptionPositionFused),
-                                                         &timestamp);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get value of topic GPS Fused error");
-    } else {
-        USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", timestamp.millisecond,
-                       timestamp.microsecond);
-        USER_LOG_DEBUG("Position: %f %f %f %d.", positionFused.latitude, positionFused.longitude,
-                       positionFused.altitude,
-                       positionFused.visibleSatelliteNumber);
-    }
-
-    startPoint.latitude = positionFused.latitude;
-    startPoint.longitude = positionFused.longitude;
-    startPoint.relativeHeight = 15;
-    DjiTest_WaypointV2SetDefaultSetting(&startPoint);
-    waypointV2List[0] = startPoint;
-
-    // Iterative algorithm
-    for (int i = 0; i < polygonNum; i++) {
-        dji_f32_t angle = i * 2 * DJI_PI / polygonNum;
-        DjiTest_WaypointV2SetDefaultSetting(&waypointV2);
-        dji_f32_t X = radius * cos(angle);
-        dji_f32_t Y = radius * sin(angle);
-        waypointV2.latitude = X / TEST_EARTH_RADIUS + startPoint.latitude;
-        waypointV2.longitude = Y / (TEST_EARTH_RADIUS * cos(startPoint.latitude)) + startPoint.longitude;
-        waypointV2.relativeHeight = startPoint.relativeHeight;
-
-        waypointV2List[i + 1] = waypointV2;
-    }
-
-    waypointV2List[polygonNum + 1] = startPoint;
-    return waypointV2List;
-}
-
 uint8_t DJiTest_WaypointV2GetMissionEventIndex(uint8_t eventID)
 {
     uint8_t i;
@@ -349,6 +288,9 @@ static T_DjiReturnCode DjiTest_WaypointV2EventCallback(T_DjiWaypointV2MissionEve
         USER_LOG_INFO("[%s]: Current mission execute times is %d",
                       s_waypointV2EventStr[DJiTest_WaypointV2GetMissionEventIndex(eventData.event)].eventStr,
                       eventData.data.T_DjiWaypointV2MissionExecEvent.currentMissionExecTimes);
+        if (s_missionFinishedSema != NULL) {
+            osalHandler->SemaphorePost(s_missionFinishedSema);
+        }
     } else if (eventData.event == 0x12) {
         USER_LOG_INFO("[%s]: avoid obstacle state:%d",
                       s_waypointV2EventStr[DJiTest_WaypointV2GetMissionEventIndex(eventData.event)].eventStr,
@@ -402,6 +344,12 @@ static T_DjiReturnCode DjiTest_WaypointV2Init(void)
         return returnCode;
     }
 
+    returnCode = osalHandler->SemaphoreCreate(0, &s_missionFinishedSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create waypoint V2 mission finished semaphore error, stat:0x%08llX", returnCode);
+        return returnCode;
+    }
+
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 
 }
@@ -410,6 +358,11 @@ static T_DjiReturnCode DjiTest_WaypointV2DeInit(void)
 {
     T_DjiReturnCode returnCode;
 
+    if (s_missionFinishedSema != NULL) {
+        osalHandler->SemaphoreDestroy(s_missionFinishedSema);
+        s_missionFinishedSema = NULL;
+    }
+
     returnCode = DjiFcSubscription_DeInit();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Deinit waypoint V2 data subscription module error, stat:0x%08llX", returnCode);
@@ -425,41 +378,136 @@ static T_DjiReturnCode DjiTest_WaypointV2DeInit(void)
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-static T_DjiReturnCode DjiTest_WaypointV2UploadMission(uint16_t missionNum)
+static T_DjiReturnCode DjiTest_WaypointV2GetReferencePosition(T_DjiFcSubscriptionPositionFused *positionFused)
+{
+    T_DjiReturnCode returnCode;
+    T_DjiDataTimestamp timestamp = {0};
+    uint32_t waitTimeMs;
+
+    /* the first push of the topic may come some time after the subscription, a position of 0, 0 is not valid */
+    for (waitTimeMs = 0; waitTimeMs <= DJI_TEST_WAYPOINT_V2_POSITION_TIMEOUT_MS;
+         waitTimeMs += DJI_TEST_WAYPOINT_V2_POSITION_CHECK_INTERVAL_MS) {
+        returnCode = DjiFcSubscription_GetLatestValueOfTopic(DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED,
+                                                             (uint8_t *) positionFused,
+                                                             sizeof(T_DjiFcSubscriptionPositionFused),
+                                                             &timestamp);
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS &&
+            (positionFused->latitude != 0 || positionFused->longitude != 0)) {
+            USER_LOG_DEBUG("Timestamp: millisecond %u microsecond %u.", timestamp.millisecond,
+                           timestamp.microsecond);
+            USER_LOG_DEBUG("Position: %f %f %f %d.", positionFused->latitude, positionFused->longitude,
+                           positionFused->altitude, positionFused->visibleSatelliteNumber);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+        }
+        osalHandler->TaskSleepMs(DJI_TEST_WAYPOINT_V2_POSITION_CHECK_INTERVAL_MS);
+    }
+
+    USER_LOG_ERROR("Get value of topic GPS Fused timeout.");
+    return DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT;
+}
+
+static T_DjiReturnCode DjiTest_WaypointV2GenerateMission(dji_f32_t radius, uint16_t polygonNum)
 {
     T_DjiReturnCode returnCode;
-    uint16_t polygonNum = missionNum - 2;
-    dji_f32_t radius = 6;
+    T_DjiFcSubscriptionPositionFused positionFused = {0};
+    T_DjiTestWaypointV2MissionLocalPoint startPoint = {0};
+    T_DjiTestWaypointV2MissionPolygon polygon = {0};
+    T_DjiTestWaypointV2MissionInfo info;
+    T_DjiWaypointV2 *waypoints;
+    T_DJIWaypointV2Action *actions;
+    uint16_t waypointNum = polygonNum + 2;
     uint16_t actionNum = 5;
+
+    returnCode = DjiTest_WaypointV2GetReferencePosition(&positionFused);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    waypoints = osalHandler->Malloc(waypointNum * sizeof(T_DjiWaypointV2));
+    actions = osalHandler->Malloc(actionNum * sizeof(T_DJIWaypointV2Action));
+    s_chunkActions = osalHandler->Malloc(actionNum * sizeof(T_DJIWaypointV2Action));
+    if (waypoints == NULL || actions == NULL || s_chunkActions == NULL) {
+        osalHandler->Free(waypoints);
+        osalHandler->Free(actions);
+        DjiTest_WaypointV2FreeMission();
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    returnCode = DjiTest_WaypointV2MissionBuilderInit(&s_missionBuilder, waypoints, waypointNum, actions, actionNum,
+                                                      positionFused.latitude, positionFused.longitude);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        osalHandler->Free(waypoints);
+        osalHandler->Free(actions);
+        DjiTest_WaypointV2FreeMission();
+        return returnCode;
+    }
+    s_missionBuilder.settings.missionID = s_missionID + 10;
+    USER_LOG_DEBUG("Generate mission id:%d", s_missionBuilder.settings.missionID);
+
+    /* start at the current position, fly the polygon around it and come back */
+    polygon.radius = radius;
+    polygon.sideNum = polygonNum;
+    returnCode = DjiTest_WaypointV2MissionAddPoint(&s_missionBuilder, &startPoint);
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        returnCode = DjiTest_WaypointV2MissionAddPolygon(&s_missionBuilder, &polygon);
+    }
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        returnCode = DjiTest_WaypointV2MissionAddPoint(&s_missionBuilder, &startPoint);
+    }
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        returnCode = DjiTest_WaypointV2MissionAddPhotoActions(&s_missionBuilder, 0, actionNum - 1, 1);
+    }
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        returnCode = DjiTest_WaypointV2MissionValidate(&s_missionBuilder, &info);
+    }
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        DjiTest_WaypointV2FreeMission();
+        return returnCode;
+    }
+
+    USER_LOG_INFO("Waypoint V2 mission: %d waypoints, %d actions, %.1f m, about %d s of flight.", info.waypointNum,
+                  info.actionNum, info.totalLength, info.durationS);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void DjiTest_WaypointV2FreeMission(void)
+{
+    if (s_missionBuilder.waypoints != NULL) {
+        osalHandler->Free(s_missionBuilder.waypoints);
+    }
+    if (s_missionBuilder.actions != NULL) {
+        osalHandler->Free(s_missionBuilder.actions);
+    }
+    if (s_chunkActions != NULL) {
+        osalHandler->Free(s_chunkActions);
+    }
+
+    memset(&s_missionBuilder, 0, sizeof(T_DjiTestWaypointV2MissionBuilder));
+    s_chunkActions = NULL;
+}
+
+static T_DjiReturnCode DjiTest_WaypointV2UploadMission(uint16_t chunkIndex)
+{
+    T_DjiReturnCode returnCode;
     T_DjiWayPointV2MissionSettings missionInitSettings = {0};
-    T_DJIWaypointV2ActionList actionList = {NULL, 0};
-
-    /*! Generate actions*/
-    actionList.actions = DjiTest_WaypointV2GenerateWaypointV2Actions(actionNum);
-    actionList.actionNum = actionNum;
-
-    /*! Init waypoint settings*/
-    missionInitSettings.missionID = s_missionID + 10;
-    USER_LOG_DEBUG("Generate mission id:%d", missionInitSettings.missionID);
-    missionInitSettings.repeatTimes = 1;
-    missionInitSettings.finishedAction = DJI_WAYPOINT_V2_FINISHED_GO_HOME;
-    missionInitSettings.maxFlightSpeed = 10;
-    missionInitSettings.autoFlightSpeed = 2;
-    missionInitSettings.actionWhenRcLost = DJI_WAYPOINT_V2_MISSION_KEEP_EXECUTE_WAYPOINT_V2;
-    missionInitSettings.gotoFirstWaypointMode = DJI_WAYPOINT_V2_MISSION_GO_TO_FIRST_WAYPOINT_MODE_POINT_TO_POINT;
-    missionInitSettings.mission = DjiTest_WaypointV2GeneratePolygonWaypointV2(radius, polygonNum);
-    missionInitSettings.missTotalLen = missionNum;
-    missionInitSettings.actionList = actionList;
+
+    returnCode = DjiTest_WaypointV2MissionGetChunk(&s_missionBuilder,
+                                                   DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT,
+                                                   chunkIndex, s_chunkActions, s_missionBuilder.actionCapacity,
+                                                   &missionInitSettings);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Get chunk %d of waypoint V2 mission failed, ErrorCode:0x%lX", chunkIndex, returnCode);
+        return returnCode;
+    }
 
     returnCode = DjiWaypointV2_UploadMission(&missionInitSettings);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Init waypoint V2 mission setting failed, ErrorCode:0x%lX", returnCode);
-        goto out;
+        return returnCode;
     }
 
-out:
-    osalHandler->Free(actionList.actions);
-    return returnCode;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
 /****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
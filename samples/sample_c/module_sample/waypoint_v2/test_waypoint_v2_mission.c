@@ -0,0 +1,817 @@
+/**
+ ********************************************************************
+ * @file    test_waypoint_v2_mission.c
+ * @brief   Waypoint V2 mission builder: polygon, grid and corridor patterns converted to latitude and
+ * longitude on the WGS 84 ellipsoid, mission checks and upload chunks.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_waypoint_v2_mission.h"
+#include <math.h>
+#include <string.h>
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "utils/util_misc.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define DJI_TEST_WAYPOINT_V2_MISSION_PI                     (3.14159265358979323846)
+#define DJI_TEST_WAYPOINT_V2_MISSION_WGS84_SEMI_MAJOR_AXIS  (6378137.0)
+#define DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2   (6.69437999014e-3)
+#define DJI_TEST_WAYPOINT_V2_MISSION_HEADING_MAX            (180.0f)
+/* at turns sharper than about 150 degrees the corridor passes come closer instead of going far out of the corner */
+#define DJI_TEST_WAYPOINT_V2_MISSION_MITER_SCALE_MAX        (4.0)
+/* keeps a spacing that divides a length exactly from adding one more point through rounding */
+#define DJI_TEST_WAYPOINT_V2_MISSION_SPACING_EPSILON        (1e-9)
+
+#define DJI_TEST_WAYPOINT_V2_MISSION_BENCHMARK_LATITUDE     (22.542400) /* unit: deg */
+#define DJI_TEST_WAYPOINT_V2_MISSION_BENCHMARK_LONGITUDE    (113.942500) /* unit: deg */
+#define DJI_TEST_WAYPOINT_V2_MISSION_BENCHMARK_GRID_LINES   (50)
+
+/* Private types -------------------------------------------------------------*/
+typedef enum {
+    DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_GRID = 0,
+    DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_POLYGON,
+    DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_CORRIDOR,
+    DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_NUM,
+} E_DjiTestWaypointV2MissionPattern;
+
+/* Private values -------------------------------------------------------------*/
+static const char *s_patternNames[DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_NUM] = {"Grid", "Polygon", "Corridor"};
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode DjiTest_WaypointV2MissionAppend(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                       dji_f64_t north, dji_f64_t east);
+static dji_f64_t DjiTest_WaypointV2MissionGetDistance(const T_DjiWaypointV2 *from, const T_DjiWaypointV2 *to);
+static T_DjiReturnCode DjiTest_WaypointV2MissionGetCorridorMiter(const T_DjiTestWaypointV2MissionCorridor *corridor,
+                                                                 uint16_t index,
+                                                                 T_DjiTestWaypointV2MissionLocalPoint *miter);
+static uint16_t DjiTest_WaypointV2MissionGetActionWaypointIndex(const T_DJIWaypointV2Action *action);
+static T_DjiReturnCode DjiTest_WaypointV2MissionBuildBenchmarkPattern(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                                      E_DjiTestWaypointV2MissionPattern pattern,
+                                                                      uint16_t waypointNum);
+
+/* Exported functions definition ---------------------------------------------*/
+T_DjiReturnCode DjiTest_WaypointV2MissionBuilderInit(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                     T_DjiWaypointV2 *waypoints, uint16_t waypointCapacity,
+                                                     T_DJIWaypointV2Action *actions, uint16_t actionCapacity,
+                                                     dji_f64_t originLatitude, dji_f64_t originLongitude)
+{
+    dji_f64_t primeVerticalRadius;
+
+    if (builder == NULL || waypoints == NULL || (actions == NULL && actionCapacity != 0)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (fabs(originLatitude) > DJI_TEST_WAYPOINT_V2_MISSION_PI / 2 ||
+        fabs(originLongitude) > DJI_TEST_WAYPOINT_V2_MISSION_PI) {
+        USER_LOG_ERROR("Waypoint V2 mission origin %f %f is not in radians.", originLatitude, originLongitude);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    memset(builder, 0, sizeof(T_DjiTestWaypointV2MissionBuilder));
+    builder->waypoints = waypoints;
+    builder->waypointCapacity = waypointCapacity;
+    builder->actions = actions;
+    builder->actionCapacity = actionCapacity;
+    builder->originLatitude = originLatitude;
+    builder->originLongitude = originLongitude;
+
+    builder->originSinLatitude = sin(originLatitude);
+    builder->originCosLatitude = cos(originLatitude);
+    builder->originSinLongitude = sin(originLongitude);
+    builder->originCosLongitude = cos(originLongitude);
+    primeVerticalRadius = DJI_TEST_WAYPOINT_V2_MISSION_WGS84_SEMI_MAJOR_AXIS /
+                          sqrt(1.0 - DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2 *
+                                     builder->originSinLatitude * builder->originSinLatitude);
+    builder->originEcef[0] = primeVerticalRadius * builder->originCosLatitude * builder->originCosLongitude;
+    builder->originEcef[1] = primeVerticalRadius * builder->originCosLatitude * builder->originSinLongitude;
+    builder->originEcef[2] = primeVerticalRadius * (1.0 - DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2) *
+                             builder->originSinLatitude;
+
+    builder->waypointTemplate.relativeHeight = 15;
+    builder->waypointTemplate.waypointType = DJI_WAYPOINT_V2_FLIGHT_PATH_MODE_GO_TO_POINT_IN_STRAIGHT_AND_STOP;
+    builder->waypointTemplate.headingMode = DJI_WAYPOINT_V2_HEADING_MODE_AUTO;
+    builder->waypointTemplate.config.useLocalMaxVel = 0;
+    builder->waypointTemplate.config.useLocalCruiseVel = 0;
+    builder->waypointTemplate.dampingDistance = 40;
+    builder->waypointTemplate.heading = 0;
+    builder->waypointTemplate.turnMode = DJI_WAYPOINT_V2_TURN_MODE_CLOCK_WISE;
+    builder->waypointTemplate.maxFlightSpeed = 9;
+    builder->waypointTemplate.autoFlightSpeed = 2;
+
+    builder->settings.missionID = 0;
+    builder->settings.repeatTimes = 1;
+    builder->settings.finishedAction = DJI_WAYPOINT_V2_FINISHED_GO_HOME;
+    builder->settings.maxFlightSpeed = 10;
+    builder->settings.autoFlightSpeed = 2;
+    builder->settings.actionWhenRcLost = DJI_WAYPOINT_V2_MISSION_KEEP_EXECUTE_WAYPOINT_V2;
+    builder->settings.gotoFirstWaypointMode = DJI_WAYPOINT_V2_MISSION_GO_TO_FIRST_WAYPOINT_MODE_POINT_TO_POINT;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+void DjiTest_WaypointV2MissionLocalToGlobal(const T_DjiTestWaypointV2MissionBuilder *builder,
+                                            const T_DjiTestWaypointV2MissionLocalPoint *point,
+                                            dji_f64_t *latitude, dji_f64_t *longitude)
+{
+    const dji_f64_t semiMinorAxis = DJI_TEST_WAYPOINT_V2_MISSION_WGS84_SEMI_MAJOR_AXIS *
+                                    sqrt(1.0 - DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2);
+    dji_f64_t x;
+    dji_f64_t y;
+    dji_f64_t z;
+    dji_f64_t p;
+    dji_f64_t r;
+    dji_f64_t sinTheta;
+    dji_f64_t cosTheta;
+
+    /* tangent plane to earth centered earth fixed, with the rotation of the origin */
+    x = builder->originEcef[0] - builder->originSinLongitude * point->east -
+        builder->originSinLatitude * builder->originCosLongitude * point->north;
+    y = builder->originEcef[1] + builder->originCosLongitude * point->east -
+        builder->originSinLatitude * builder->originSinLongitude * point->north;
+    z = builder->originEcef[2] + builder->originCosLatitude * point->north;
+
+    /* back to latitude and longitude with the closed form of Bowring, exact to a millimeter near the surface */
+    p = sqrt(x * x + y * y);
+    sinTheta = z * DJI_TEST_WAYPOINT_V2_MISSION_WGS84_SEMI_MAJOR_AXIS;
+    cosTheta = p * semiMinorAxis;
+    r = sqrt(sinTheta * sinTheta + cosTheta * cosTheta);
+    sinTheta /= r;
+    cosTheta /= r;
+    *latitude = atan2(z + DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2 /
+                          (1.0 - DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2) *
+                          semiMinorAxis * sinTheta * sinTheta * sinTheta,
+                      p - DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2 *
+                          DJI_TEST_WAYPOINT_V2_MISSION_WGS84_SEMI_MAJOR_AXIS * cosTheta * cosTheta * cosTheta);
+    *longitude = p > 0 ? atan2(y, x) : builder->originLongitude;
+}
+
+T_DjiReturnCode DjiTest_WaypointV2MissionAddPoint(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                  const T_DjiTestWaypointV2MissionLocalPoint *point)
+{
+    if (builder == NULL || point == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    return DjiTest_WaypointV2MissionAppend(builder, point->north, point->east);
+}
+
+T_DjiReturnCode DjiTest_WaypointV2MissionAddPolygon(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                    const T_DjiTestWaypointV2MissionPolygon *polygon)
+{
+    dji_f64_t bearing;
+    dji_f64_t cosBearing;
+    dji_f64_t sinBearing;
+    dji_f64_t cosStep;
+    dji_f64_t sinStep;
+    dji_f64_t cosNext;
+    uint32_t pointNum;
+    uint16_t i;
+
+    if (builder == NULL || polygon == NULL || polygon->sideNum < 3 || !(polygon->radius > 0)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    pointNum = polygon->sideNum + (polygon->isClosed ? 1 : 0);
+    if (pointNum > (uint32_t) (builder->waypointCapacity - builder->waypointNum)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    /* the vertices are rotated from one to the next, the trig functions are only called for the first one and the
+     * step, the rounding error after 65535 steps stays far below a millimeter */
+    bearing = polygon->startBearing * DJI_TEST_WAYPOINT_V2_MISSION_PI / 180.0;
+    cosBearing = cos(bearing);
+    sinBearing = sin(bearing);
+    cosStep = cos(2 * DJI_TEST_WAYPOINT_V2_MISSION_PI / polygon->sideNum);
+    sinStep = sin(2 * DJI_TEST_WAYPOINT_V2_MISSION_PI / polygon->sideNum);
+
+    for (i = 0; i < polygon->sideNum; i++) {
+        DjiTest_WaypointV2MissionAppend(builder, polygon->center.north + polygon->radius * cosBearing,
+                                        polygon->center.east + polygon->radius * sinBearing);
+        cosNext = cosBearing * cosStep - sinBearing * sinStep;
+        sinBearing = sinBearing * cosStep + cosBearing * sinStep;
+        cosBearing = cosNext;
+    }
+    if (polygon->isClosed) {
+        builder->waypoints[builder->waypointNum] = builder->waypoints[builder->waypointNum - polygon->sideNum];
+        builder->waypointNum++;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_WaypointV2MissionAddGrid(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                 const T_DjiTestWaypointV2MissionGrid *grid)
+{
+    dji_f64_t heading;
+    dji_f64_t cosHeading;
+    dji_f64_t sinHeading;
+    dji_f64_t lineNum = 1;
+    dji_f64_t pointNum = 2;
+    dji_f64_t lineStep = 0;
+    dji_f64_t pointStep;
+    dji_f64_t across;
+    dji_f64_t along;
+    uint32_t i;
+    uint32_t j;
+
+    if (builder == NULL || grid == NULL || !(grid->length > 0) || !(grid->width >= 0) ||
+        !(grid->pointSpacing >= 0) || (grid->width > 0 && !(grid->lineSpacing > 0))) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (grid->width > 0) {
+        lineNum = ceil(grid->width / grid->lineSpacing - DJI_TEST_WAYPOINT_V2_MISSION_SPACING_EPSILON) + 1;
+        lineStep = grid->width / (lineNum - 1);
+    }
+    if (grid->pointSpacing > 0) {
+        pointNum = ceil(grid->length / grid->pointSpacing - DJI_TEST_WAYPOINT_V2_MISSION_SPACING_EPSILON) + 1;
+    }
+    pointStep = grid->length / (pointNum - 1);
+    if (lineNum * pointNum > builder->waypointCapacity - builder->waypointNum) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    heading = grid->heading * DJI_TEST_WAYPOINT_V2_MISSION_PI / 180.0;
+    cosHeading = cos(heading);
+    sinHeading = sin(heading);
+
+    /* lines are flown along the heading, the next line is on the right of the previous one */
+    for (i = 0; i < (uint32_t) lineNum; i++) {
+        across = i * lineStep - grid->width / 2;
+        for (j = 0; j < (uint32_t) pointNum; j++) {
+            along = (i % 2 == 0 ? j : (uint32_t) pointNum - 1 - j) * pointStep - grid->length / 2;
+            DjiTest_WaypointV2MissionAppend(builder,
+                                            grid->center.north + along * cosHeading - across * sinHeading,
+                                            grid->center.east + along * sinHeading + across * cosHeading);
+        }
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_WaypointV2MissionAddCorridor(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                     const T_DjiTestWaypointV2MissionCorridor *corridor)
+{
+    T_DjiReturnCode returnCode;
+    T_DjiTestWaypointV2MissionLocalPoint miter;
+    T_DjiTestWaypointV2MissionLocalPoint from = {0};
+    T_DjiTestWaypointV2MissionLocalPoint to;
+    const T_DjiTestWaypointV2MissionLocalPoint *centerPoint;
+    uint16_t startWaypointNum;
+    dji_f64_t offset;
+    dji_f64_t segmentLength;
+    uint32_t stepNum;
+    uint32_t k;
+    uint16_t line;
+    uint16_t i;
+
+    if (builder == NULL || corridor == NULL || corridor->centerLine == NULL || corridor->centerLinePointNum < 2 ||
+        corridor->lineNum == 0 || !(corridor->width >= 0) || !(corridor->pointSpacing >= 0)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    for (i = 0; i < corridor->centerLinePointNum; i++) {
+        returnCode = DjiTest_WaypointV2MissionGetCorridorMiter(corridor, i, &miter);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Corridor center line point %d repeats or turns back.", i);
+            return returnCode;
+        }
+    }
+
+    startWaypointNum = builder->waypointNum;
+    for (line = 0; line < corridor->lineNum; line++) {
+        offset = corridor->lineNum > 1 ? line * corridor->width / (corridor->lineNum - 1) - corridor->width / 2 : 0;
+
+        /* passes are flown forward and backward in turn, the crossover to the next pass is spaced as a segment */
+        for (i = 0; i < corridor->centerLinePointNum; i++) {
+            centerPoint = &corridor->centerLine[line % 2 == 0 ? i : corridor->centerLinePointNum - 1 - i];
+            DjiTest_WaypointV2MissionGetCorridorMiter(corridor, (uint16_t) (centerPoint - corridor->centerLine),
+                                                      &miter);
+            to.north = centerPoint->north + offset * miter.north;
+            to.east = centerPoint->east + offset * miter.east;
+
+            if (i > 0 || line > 0) {
+                segmentLength = sqrt((to.north - from.north) * (to.north - from.north) +
+                                     (to.east - from.east) * (to.east - from.east));
+                stepNum = 1;
+                if (corridor->pointSpacing > 0) {
+                    stepNum = (uint32_t) ceil(segmentLength / corridor->pointSpacing -
+                                              DJI_TEST_WAYPOINT_V2_MISSION_SPACING_EPSILON);
+                    stepNum = stepNum == 0 ? 1 : stepNum;
+                }
+                for (k = 0; k < stepNum; k++) {
+                    returnCode = DjiTest_WaypointV2MissionAppend(builder,
+                                                                 from.north + (to.north - from.north) * k / stepNum,
+                                                                 from.east + (to.east - from.east) * k / stepNum);
+                    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                        builder->waypointNum = startWaypointNum;
+                        return returnCode;
+                    }
+                }
+            }
+            from = to;
+        }
+    }
+
+    returnCode = DjiTest_WaypointV2MissionAppend(builder, from.north, from.east);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        builder->waypointNum = startWaypointNum;
+    }
+
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_WaypointV2MissionAddPhotoActions(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                         uint16_t firstWaypointIndex, uint16_t lastWaypointIndex,
+                                                         uint16_t interval)
+{
+    T_DJIWaypointV2Action *action;
+    uint32_t waypointIndex;
+
+    if (builder == NULL || interval == 0 || firstWaypointIndex > lastWaypointIndex ||
+        lastWaypointIndex >= builder->waypointNum) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if ((uint32_t) (lastWaypointIndex - firstWaypointIndex) / interval + 1 >
+        (uint32_t) (builder->actionCapacity - builder->actionNum)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    for (waypointIndex = firstWaypointIndex; waypointIndex <= lastWaypointIndex; waypointIndex += interval) {
+        action = &builder->actions[builder->actionNum];
+        memset(action, 0, sizeof(T_DJIWaypointV2Action));
+        action->actionId = builder->actionNum;
+        action->trigger.actionTriggerType = DJI_WAYPOINT_V2_ACTION_TRIGGER_TYPE_SAMPLE_REACH_POINT;
+        action->trigger.sampleReachPointTriggerParam.waypointIndex = (uint16_t) waypointIndex;
+        action->trigger.sampleReachPointTriggerParam.terminateNum = 0;
+        action->actuator.actuatorType = DJI_WAYPOINT_V2_ACTION_ACTUATOR_TYPE_CAMERA;
+        action->actuator.actuatorIndex = 0;
+        action->actuator.cameraActuatorParam.operationType =
+            DJI_WAYPOINT_V2_ACTION_ACTUATOR_CAMERA_OPERATION_TYPE_TAKE_PHOTO;
+        builder->actionNum++;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_WaypointV2MissionValidate(const T_DjiTestWaypointV2MissionBuilder *builder,
+                                                  T_DjiTestWaypointV2MissionInfo *info)
+{
+    const T_DjiWayPointV2MissionSettings *settings;
+    const T_DjiWaypointV2 *waypoint;
+    const T_DJIWaypointV2Action *action;
+    dji_f64_t segmentLength;
+    dji_f64_t totalLength = 0;
+    dji_f64_t minSegmentLength = 0;
+    dji_f64_t maxSegmentLength = 0;
+    uint16_t waypointIndex;
+    uint16_t lastWaypointIndex = 0;
+    uint32_t i;
+
+    if (builder == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    settings = &builder->settings;
+    if (builder->waypointNum < DJI_TEST_WAYPOINT_V2_MISSION_WAYPOINT_NUM_MIN) {
+        USER_LOG_ERROR("Waypoint V2 mission has %d waypoints, at least %d are needed.", builder->waypointNum,
+                       DJI_TEST_WAYPOINT_V2_MISSION_WAYPOINT_NUM_MIN);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (!(settings->maxFlightSpeed >= DJI_TEST_WAYPOINT_V2_MISSION_MAX_FLIGHT_SPEED_MIN &&
+          settings->maxFlightSpeed <= DJI_TEST_WAYPOINT_V2_MISSION_FLIGHT_SPEED_MAX &&
+          fabsf(settings->autoFlightSpeed) <= settings->maxFlightSpeed)) {
+        USER_LOG_ERROR("Waypoint V2 mission speeds %f %f are out of range.", settings->maxFlightSpeed,
+                       settings->autoFlightSpeed);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    for (i = 0; i < builder->waypointNum; i++) {
+        waypoint = &builder->waypoints[i];
+        if (!(fabs(waypoint->latitude) <= DJI_TEST_WAYPOINT_V2_MISSION_PI / 2 &&
+              fabs(waypoint->longitude) <= DJI_TEST_WAYPOINT_V2_MISSION_PI)) {
+            USER_LOG_ERROR("Waypoint %d position %f %f is not valid.", i, waypoint->latitude, waypoint->longitude);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+        }
+        if (!(waypoint->relativeHeight >= DJI_TEST_WAYPOINT_V2_MISSION_RELATIVE_HEIGHT_MIN &&
+              waypoint->relativeHeight <= DJI_TEST_WAYPOINT_V2_MISSION_RELATIVE_HEIGHT_MAX)) {
+            USER_LOG_ERROR("Waypoint %d height %f m is out of range.", i, waypoint->relativeHeight);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+        }
+        if (!(waypoint->maxFlightSpeed >= DJI_TEST_WAYPOINT_V2_MISSION_MAX_FLIGHT_SPEED_MIN &&
+              waypoint->maxFlightSpeed <= DJI_TEST_WAYPOINT_V2_MISSION_FLIGHT_SPEED_MAX &&
+              fabsf(waypoint->autoFlightSpeed) <= waypoint->maxFlightSpeed &&
+              fabsf(waypoint->heading) <= DJI_TEST_WAYPOINT_V2_MISSION_HEADING_MAX)) {
+            USER_LOG_ERROR("Waypoint %d speeds or heading are out of range.", i);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+        }
+
+        if (i == 0) {
+            continue;
+        }
+        segmentLength = DjiTest_WaypointV2MissionGetDistance(waypoint - 1, waypoint);
+        if (segmentLength < DJI_TEST_WAYPOINT_V2_MISSION_SEGMENT_LENGTH_MIN) {
+            USER_LOG_ERROR("Waypoint %d is %.2f m from the previous one, less than %.2f m.", i, segmentLength,
+                           DJI_TEST_WAYPOINT_V2_MISSION_SEGMENT_LENGTH_MIN);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+        }
+        totalLength += segmentLength;
+        minSegmentLength = (i == 1 || segmentLength < minSegmentLength) ? segmentLength : minSegmentLength;
+        maxSegmentLength = segmentLength > maxSegmentLength ? segmentLength : maxSegmentLength;
+    }
+
+    for (i = 0; i < builder->actionNum; i++) {
+        action = &builder->actions[i];
+        if (action->trigger.actionTriggerType != DJI_WAYPOINT_V2_ACTION_TRIGGER_TYPE_SAMPLE_REACH_POINT) {
+            continue;
+        }
+        waypointIndex = action->trigger.sampleReachPointTriggerParam.waypointIndex;
+        if (waypointIndex >= builder->waypointNum || waypointIndex < lastWaypointIndex) {
+            USER_LOG_ERROR("Action %d waypoint index %d is out of range or out of order.", action->actionId,
+                           waypointIndex);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+        }
+        lastWaypointIndex = waypointIndex;
+    }
+
+    if (info != NULL) {
+        info->waypointNum = builder->waypointNum;
+        info->actionNum = builder->actionNum;
+        info->totalLength = totalLength;
+        info->minSegmentLength = minSegmentLength;
+        info->maxSegmentLength = maxSegmentLength;
+        info->durationS = settings->autoFlightSpeed != 0 ?
+                          (uint32_t) (totalLength / fabsf(settings->autoFlightSpeed)) : 0;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+uint16_t DjiTest_WaypointV2MissionGetChunkNum(const T_DjiTestWaypointV2MissionBuilder *builder,
+                                              uint16_t chunkWaypointNum)
+{
+    if (builder == NULL || builder->waypointNum < DJI_TEST_WAYPOINT_V2_MISSION_WAYPOINT_NUM_MIN ||
+        chunkWaypointNum < DJI_TEST_WAYPOINT_V2_MISSION_WAYPOINT_NUM_MIN) {
+        return 0;
+    }
+
+    return (uint16_t) ((builder->waypointNum - 1 + chunkWaypointNum - 2) / (chunkWaypointNum - 1));
+}
+
+T_DjiReturnCode DjiTest_WaypointV2MissionGetChunk(const T_DjiTestWaypointV2MissionBuilder *builder,
+                                                  uint16_t chunkWaypointNum, uint16_t chunkIndex,
+                                                  T_DJIWaypointV2Action *actionBuf, uint16_t actionBufSize,
+                                                  T_DjiWayPointV2MissionSettings *settings)
+{
+    const T_DJIWaypointV2Action *action;
+    uint16_t chunkNum;
+    uint16_t startIndex;
+    uint16_t endIndex;
+    uint16_t waypointIndex;
+    uint16_t actionNum = 0;
+    uint16_t low;
+    uint16_t high;
+    uint16_t middle;
+    bool isLastChunk;
+
+    chunkNum = DjiTest_WaypointV2MissionGetChunkNum(builder, chunkWaypointNum);
+    if (chunkIndex >= chunkNum || settings == NULL || (actionBuf == NULL && actionBufSize != 0)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (chunkNum > 1 && builder->settings.repeatTimes != 1) {
+        USER_LOG_ERROR("Waypoint V2 mission split into %d chunks can not be repeated.", chunkNum);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+    }
+
+    startIndex = (uint16_t) (chunkIndex * (chunkWaypointNum - 1));
+    endIndex = (uint16_t) USER_UTIL_MIN((uint32_t) startIndex + chunkWaypointNum - 1,
+                                        (uint32_t) builder->waypointNum - 1);
+    isLastChunk = chunkIndex == chunkNum - 1;
+
+    /* the actions are sorted by waypoint index, look for the first one of the chunk */
+    low = 0;
+    high = chunkNum > 1 ? builder->actionNum : 0;
+    while (low < high) {
+        middle = (uint16_t) (low + (high - low) / 2);
+        if (DjiTest_WaypointV2MissionGetActionWaypointIndex(&builder->actions[middle]) < startIndex) {
+            low = (uint16_t) (middle + 1);
+        } else {
+            high = middle;
+        }
+    }
+
+    for (; low < builder->actionNum; low++) {
+        action = &builder->actions[low];
+        if (chunkNum > 1) {
+            if (action->trigger.actionTriggerType != DJI_WAYPOINT_V2_ACTION_TRIGGER_TYPE_SAMPLE_REACH_POINT) {
+                USER_LOG_ERROR("Only reach point actions can be split into chunks.");
+                return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+            }
+            waypointIndex = action->trigger.sampleReachPointTriggerParam.waypointIndex;
+            if (waypointIndex > endIndex || (waypointIndex == endIndex && !isLastChunk)) {
+                break;
+            }
+        }
+        if (actionNum >= actionBufSize) {
+            return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+        }
+
+        actionBuf[actionNum] = *action;
+        if (chunkNum > 1) {
+            actionBuf[actionNum].actionId = actionNum;
+            actionBuf[actionNum].trigger.sampleReachPointTriggerParam.waypointIndex -= startIndex;
+        }
+        actionNum++;
+    }
+
+    *settings = builder->settings;
+    settings->missionID = builder->settings.missionID + chunkIndex;
+    settings->mission = &builder->waypoints[startIndex];
+    settings->missTotalLen = (uint16_t) (endIndex - startIndex + 1);
+    settings->actionList.actions = actionBuf;
+    settings->actionList.actionNum = actionNum;
+    if (!isLastChunk) {
+        settings->finishedAction = DJI_WAYPOINT_V2_FINISHED_NO_ACTION;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_WaypointV2MissionRunBenchmark(uint16_t waypointNum)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestWaypointV2MissionBuilder builder;
+    T_DjiTestWaypointV2MissionInfo info;
+    T_DjiWayPointV2MissionSettings settings;
+    T_DjiWaypointV2 *waypoints = NULL;
+    T_DJIWaypointV2Action *actions = NULL;
+    T_DJIWaypointV2Action *chunkActions = NULL;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    T_DjiWaypointV2 legacyWaypoint;
+    dji_f64_t legacyError;
+    dji_f64_t maxLegacyError;
+    dji_f32_t angle;
+    dji_f32_t x;
+    dji_f32_t y;
+    uint64_t startTimeUs;
+    uint64_t endTimeUs;
+    uint32_t generateTimeUs;
+    uint32_t validateTimeUs;
+    uint32_t chunkTimeUs;
+    uint16_t chunkNum;
+    uint16_t chunkIndex;
+    uint16_t i;
+    int pattern;
+
+    if (waypointNum < DJI_TEST_WAYPOINT_V2_MISSION_BENCHMARK_GRID_LINES * 2) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    waypoints = osalHandler->Malloc(waypointNum * sizeof(T_DjiWaypointV2));
+    actions = osalHandler->Malloc(waypointNum * sizeof(T_DJIWaypointV2Action));
+    chunkActions = osalHandler->Malloc(DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT *
+                                       sizeof(T_DJIWaypointV2Action));
+    if (waypoints == NULL || actions == NULL || chunkActions == NULL) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+        goto out;
+    }
+
+    for (pattern = 0; pattern < DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_NUM; pattern++) {
+        osalHandler->GetTimeUs(&startTimeUs);
+        DjiTest_WaypointV2MissionBuilderInit(&builder, waypoints, waypointNum, actions, waypointNum,
+                                             DJI_TEST_WAYPOINT_V2_MISSION_BENCHMARK_LATITUDE *
+                                             DJI_TEST_WAYPOINT_V2_MISSION_PI / 180.0,
+                                             DJI_TEST_WAYPOINT_V2_MISSION_BENCHMARK_LONGITUDE *
+                                             DJI_TEST_WAYPOINT_V2_MISSION_PI / 180.0);
+        returnCode = DjiTest_WaypointV2MissionBuildBenchmarkPattern(&builder, pattern, waypointNum);
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            returnCode = DjiTest_WaypointV2MissionAddPhotoActions(&builder, 0, builder.waypointNum - 1, 1);
+        }
+        osalHandler->GetTimeUs(&endTimeUs);
+        generateTimeUs = (uint32_t) (endTimeUs - startTimeUs);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Build %s mission failed, error code: 0x%08llX", s_patternNames[pattern], returnCode);
+            goto out;
+        }
+
+        osalHandler->GetTimeUs(&startTimeUs);
+        returnCode = DjiTest_WaypointV2MissionValidate(&builder, &info);
+        osalHandler->GetTimeUs(&endTimeUs);
+        validateTimeUs = (uint32_t) (endTimeUs - startTimeUs);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Validate %s mission failed, error code: 0x%08llX", s_patternNames[pattern], returnCode);
+            goto out;
+        }
+
+        osalHandler->GetTimeUs(&startTimeUs);
+        chunkNum = DjiTest_WaypointV2MissionGetChunkNum(&builder,
+                                                        DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT);
+        for (chunkIndex = 0; chunkIndex < chunkNum; chunkIndex++) {
+            returnCode = DjiTest_WaypointV2MissionGetChunk(&builder,
+                                                           DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT,
+                                                           chunkIndex, chunkActions,
+                                                           DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT,
+                                                           &settings);
+            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_ERROR("Get %s mission chunk %d failed.", s_patternNames[pattern], chunkIndex);
+                goto out;
+            }
+        }
+        osalHandler->GetTimeUs(&endTimeUs);
+        chunkTimeUs = (uint32_t) (endTimeUs - startTimeUs);
+
+        USER_LOG_INFO("%s: %d waypoints, %.1f km, %d s of flight, segments %.2f to %.2f m.", s_patternNames[pattern],
+                      info.waypointNum, info.totalLength / 1000, info.durationS, info.minSegmentLength,
+                      info.maxSegmentLength);
+        USER_LOG_INFO("%s: generate %u ns, validate %u ns, split into %d chunks %u ns per waypoint.",
+                      s_patternNames[pattern], generateTimeUs * 1000 / info.waypointNum,
+                      validateTimeUs * 1000 / info.waypointNum, chunkNum, chunkTimeUs * 1000 / info.waypointNum);
+
+        if (pattern != DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_POLYGON) {
+            continue;
+        }
+
+        /* offsets the way the sample computed them before: spherical earth of equatorial radius, single precision */
+        maxLegacyError = 0;
+        legacyWaypoint = builder.waypoints[0];
+        for (i = 0; i < builder.waypointNum - 1; i++) {
+            angle = i * 2 * DJI_PI / (builder.waypointNum - 1);
+            x = waypointNum / 4.0f * cosf(angle);
+            y = waypointNum / 4.0f * sinf(angle);
+            legacyWaypoint.latitude = x / (dji_f32_t) DJI_TEST_WAYPOINT_V2_MISSION_WGS84_SEMI_MAJOR_AXIS +
+                                      builder.originLatitude;
+            legacyWaypoint.longitude = y / (DJI_TEST_WAYPOINT_V2_MISSION_WGS84_SEMI_MAJOR_AXIS *
+                                            cos(builder.originLatitude)) + builder.originLongitude;
+            legacyError = DjiTest_WaypointV2MissionGetDistance(&legacyWaypoint, &builder.waypoints[i]);
+            maxLegacyError = legacyError > maxLegacyError ? legacyError : maxLegacyError;
+        }
+        USER_LOG_INFO("%s: spherical single precision offsets are up to %.2f m away at a radius of %d m.",
+                      s_patternNames[pattern], maxLegacyError, waypointNum / 4);
+    }
+
+out:
+    osalHandler->Free(waypoints);
+    osalHandler->Free(actions);
+    osalHandler->Free(chunkActions);
+
+    return returnCode;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode DjiTest_WaypointV2MissionAppend(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                       dji_f64_t north, dji_f64_t east)
+{
+    T_DjiTestWaypointV2MissionLocalPoint point = {.north = north, .east = east};
+    T_DjiWaypointV2 *waypoint;
+
+    if (builder->waypointNum >= builder->waypointCapacity) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    waypoint = &builder->waypoints[builder->waypointNum];
+    *waypoint = builder->waypointTemplate;
+    DjiTest_WaypointV2MissionLocalToGlobal(builder, &point, &waypoint->latitude, &waypoint->longitude);
+    builder->waypointNum++;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static dji_f64_t DjiTest_WaypointV2MissionGetDistance(const T_DjiWaypointV2 *from, const T_DjiWaypointV2 *to)
+{
+    dji_f64_t midLatitude = (from->latitude + to->latitude) / 2;
+    dji_f64_t sinLatitude = sin(midLatitude);
+    dji_f64_t w = 1.0 - DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2 * sinLatitude * sinLatitude;
+    dji_f64_t primeVerticalRadius = DJI_TEST_WAYPOINT_V2_MISSION_WGS84_SEMI_MAJOR_AXIS / sqrt(w);
+    dji_f64_t deltaLongitude = to->longitude - from->longitude;
+    dji_f64_t north;
+    dji_f64_t east;
+    dji_f64_t up;
+
+    if (deltaLongitude > DJI_TEST_WAYPOINT_V2_MISSION_PI) {
+        deltaLongitude -= 2 * DJI_TEST_WAYPOINT_V2_MISSION_PI;
+    } else if (deltaLongitude < -DJI_TEST_WAYPOINT_V2_MISSION_PI) {
+        deltaLongitude += 2 * DJI_TEST_WAYPOINT_V2_MISSION_PI;
+    }
+
+    north = (to->latitude - from->latitude) * primeVerticalRadius *
+            (1.0 - DJI_TEST_WAYPOINT_V2_MISSION_WGS84_ECCENTRICITY_2) / w;
+    east = deltaLongitude * primeVerticalRadius * cos(midLatitude);
+    up = to->relativeHeight - from->relativeHeight;
+
+    return sqrt(north * north + east * east + up * up);
+}
+
+static T_DjiReturnCode DjiTest_WaypointV2MissionGetCorridorMiter(const T_DjiTestWaypointV2MissionCorridor *corridor,
+                                                                 uint16_t index,
+                                                                 T_DjiTestWaypointV2MissionLocalPoint *miter)
+{
+    const T_DjiTestWaypointV2MissionLocalPoint *points = corridor->centerLine;
+    T_DjiTestWaypointV2MissionLocalPoint normals[2];
+    uint16_t normalNum = 0;
+    dji_f64_t length;
+    dji_f64_t scale;
+    int i;
+
+    /* right hand normals of the segments before and after the point */
+    for (i = (index > 0 ? index - 1 : index); i < index + 1 && i + 1 < corridor->centerLinePointNum; i++) {
+        length = sqrt((points[i + 1].north - points[i].north) * (points[i + 1].north - points[i].north) +
+                      (points[i + 1].east - points[i].east) * (points[i + 1].east - points[i].east));
+        if (!(length > 0)) {
+            return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+        }
+        normals[normalNum].north = -(points[i + 1].east - points[i].east) / length;
+        normals[normalNum].east = (points[i + 1].north - points[i].north) / length;
+        normalNum++;
+    }
+
+    if (normalNum == 1) {
+        *miter = normals[0];
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    /* the offset point is on the bisector, far enough for both offset segments to keep their distance */
+    miter->north = normals[0].north + normals[1].north;
+    miter->east = normals[0].east + normals[1].east;
+    length = sqrt(miter->north * miter->north + miter->east * miter->east);
+    if (length < 1e-6) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    scale = 1.0 / (length / 2);
+    scale = scale > DJI_TEST_WAYPOINT_V2_MISSION_MITER_SCALE_MAX ? DJI_TEST_WAYPOINT_V2_MISSION_MITER_SCALE_MAX : scale;
+    miter->north = miter->north / length * scale;
+    miter->east = miter->east / length * scale;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static uint16_t DjiTest_WaypointV2MissionGetActionWaypointIndex(const T_DJIWaypointV2Action *action)
+{
+    if (action->trigger.actionTriggerType != DJI_WAYPOINT_V2_ACTION_TRIGGER_TYPE_SAMPLE_REACH_POINT) {
+        return 0;
+    }
+
+    return action->trigger.sampleReachPointTriggerParam.waypointIndex;
+}
+
+static T_DjiReturnCode DjiTest_WaypointV2MissionBuildBenchmarkPattern(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                                      E_DjiTestWaypointV2MissionPattern pattern,
+                                                                      uint16_t waypointNum)
+{
+    const T_DjiTestWaypointV2MissionLocalPoint centerLine[] = {
+        {0, 0}, {1000, 300}, {1800, -200}, {2600, 400}, {3500, 0},
+    };
+    T_DjiTestWaypointV2MissionGrid grid = {0};
+    T_DjiTestWaypointV2MissionPolygon polygon = {0};
+    T_DjiTestWaypointV2MissionCorridor corridor = {0};
+    dji_f64_t centerLineLength = 0;
+    uint16_t i;
+
+    switch (pattern) {
+        case DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_GRID:
+            grid.lineSpacing = 10;
+            grid.width = grid.lineSpacing * (DJI_TEST_WAYPOINT_V2_MISSION_BENCHMARK_GRID_LINES - 1);
+            grid.pointSpacing = 5;
+            grid.length = grid.pointSpacing * (waypointNum / DJI_TEST_WAYPOINT_V2_MISSION_BENCHMARK_GRID_LINES - 1);
+            grid.heading = 30;
+            return DjiTest_WaypointV2MissionAddGrid(builder, &grid);
+        case DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_POLYGON:
+            polygon.radius = waypointNum / 4.0;
+            polygon.sideNum = (uint16_t) (waypointNum - 1);
+            polygon.isClosed = true;
+            return DjiTest_WaypointV2MissionAddPolygon(builder, &polygon);
+        case DJI_TEST_WAYPOINT_V2_MISSION_PATTERN_CORRIDOR:
+            for (i = 1; i < sizeof(centerLine) / sizeof(centerLine[0]); i++) {
+                centerLineLength += sqrt((centerLine[i].north - centerLine[i - 1].north) *
+                                         (centerLine[i].north - centerLine[i - 1].north) +
+                                         (centerLine[i].east - centerLine[i - 1].east) *
+                                         (centerLine[i].east - centerLine[i - 1].east));
+            }
+            corridor.centerLine = centerLine;
+            corridor.centerLinePointNum = sizeof(centerLine) / sizeof(centerLine[0]);
+            corridor.width = 60;
+            corridor.lineNum = 4;
+            /* a tenth more length than the center line to leave room for the longer outer passes */
+            corridor.pointSpacing = centerLineLength * corridor.lineNum * 1.1 / waypointNum;
+            return DjiTest_WaypointV2MissionAddCorridor(builder, &corridor);
+        default:
+            return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,208 @@
+/**
+ ********************************************************************
+ * @file    test_waypoint_v2_mission.h
+ * @brief   This is the header file for "test_waypoint_v2_mission.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_WAYPOINT_V2_MISSION_H
+#define TEST_WAYPOINT_V2_MISSION_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_waypoint_v2_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+/* waypoint indexes of the actions and the waypoint count of a mission are 16 bits */
+#define DJI_TEST_WAYPOINT_V2_MISSION_WAYPOINT_NUM_MIN           (2)
+#define DJI_TEST_WAYPOINT_V2_MISSION_WAYPOINT_NUM_MAX           (65535)
+#define DJI_TEST_WAYPOINT_V2_MISSION_ACTION_NUM_MAX             (65535)
+#define DJI_TEST_WAYPOINT_V2_MISSION_MAX_FLIGHT_SPEED_MIN       (2.0f) /* unit: m/s */
+#define DJI_TEST_WAYPOINT_V2_MISSION_FLIGHT_SPEED_MAX           (15.0f) /* unit: m/s */
+#define DJI_TEST_WAYPOINT_V2_MISSION_RELATIVE_HEIGHT_MIN        (-200.0f) /* unit: m */
+#define DJI_TEST_WAYPOINT_V2_MISSION_RELATIVE_HEIGHT_MAX        (500.0f) /* unit: m */
+#define DJI_TEST_WAYPOINT_V2_MISSION_SEGMENT_LENGTH_MIN         (0.5) /* unit: m, closer waypoints are duplicates */
+#define DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT (200)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Position on the plane tangent to the WGS 84 ellipsoid at the mission origin, unit: m.
+ */
+typedef struct {
+    dji_f64_t north;
+    dji_f64_t east;
+} T_DjiTestWaypointV2MissionLocalPoint;
+
+/**
+ * @brief Regular polygon around a center, the first vertex is at startBearing.
+ */
+typedef struct {
+    T_DjiTestWaypointV2MissionLocalPoint center;
+    dji_f64_t radius; /*!< unit: m. */
+    dji_f64_t startBearing; /*!< Clockwise from north, unit: deg. */
+    uint16_t sideNum;
+    bool isClosed; /*!< Add the first vertex again at the end. */
+} T_DjiTestWaypointV2MissionPolygon;
+
+/**
+ * @brief Lawnmower grid: parallel lines flown back and forth, the lines and the points on them are evenly spread with
+ * a spacing no larger than the one given.
+ */
+typedef struct {
+    T_DjiTestWaypointV2MissionLocalPoint center;
+    dji_f64_t length; /*!< Length of the lines, unit: m. */
+    dji_f64_t width; /*!< Distance between the first and the last line, unit: m. */
+    dji_f64_t lineSpacing; /*!< unit: m. */
+    dji_f64_t pointSpacing; /*!< unit: m, 0 keeps the two ends of each line only. */
+    dji_f64_t heading; /*!< Direction of the first line, clockwise from north, unit: deg. */
+} T_DjiTestWaypointV2MissionGrid;
+
+/**
+ * @brief Corridor along a center line, flown back and forth in lineNum passes spread over the width.
+ */
+typedef struct {
+    const T_DjiTestWaypointV2MissionLocalPoint *centerLine;
+    uint16_t centerLinePointNum;
+    dji_f64_t width; /*!< Distance between the outermost passes, unit: m. */
+    uint16_t lineNum;
+    dji_f64_t pointSpacing; /*!< unit: m, 0 keeps the corners of each pass only. */
+} T_DjiTestWaypointV2MissionCorridor;
+
+/**
+ * @brief Mission under construction, the waypoints and actions are stored in buffers owned by the caller.
+ */
+typedef struct {
+    T_DjiWaypointV2 *waypoints;
+    uint16_t waypointCapacity;
+    uint16_t waypointNum;
+    T_DJIWaypointV2Action *actions;
+    uint16_t actionCapacity;
+    uint16_t actionNum;
+    dji_f64_t originLatitude; /*!< unit: rad. */
+    dji_f64_t originLongitude; /*!< unit: rad. */
+    dji_f64_t originSinLatitude;
+    dji_f64_t originCosLatitude;
+    dji_f64_t originSinLongitude;
+    dji_f64_t originCosLongitude;
+    dji_f64_t originEcef[3]; /*!< Earth centered earth fixed position of the origin, unit: m. */
+    T_DjiWaypointV2 waypointTemplate; /*!< Copied into every waypoint added, but for its position. */
+    T_DjiWayPointV2MissionSettings settings; /*!< Copied into every chunk, but for its waypoints and actions. */
+} T_DjiTestWaypointV2MissionBuilder;
+
+typedef struct {
+    uint16_t waypointNum;
+    uint16_t actionNum;
+    dji_f64_t totalLength; /*!< unit: m. */
+    dji_f64_t minSegmentLength; /*!< unit: m. */
+    dji_f64_t maxSegmentLength; /*!< unit: m. */
+    uint32_t durationS; /*!< Flight time at the auto flight speed, stops excluded. */
+} T_DjiTestWaypointV2MissionInfo;
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Start an empty mission around an origin, the waypoint template and the settings are set to the defaults of
+ * the waypoint V2 sample.
+ * @param builder: mission to init.
+ * @param waypoints: buffer of waypointCapacity waypoints.
+ * @param actions: buffer of actionCapacity actions, can be NULL if actionCapacity is 0.
+ * @param originLatitude: unit: rad, as pushed by DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED.
+ * @param originLongitude: unit: rad.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WaypointV2MissionBuilderInit(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                     T_DjiWaypointV2 *waypoints, uint16_t waypointCapacity,
+                                                     T_DJIWaypointV2Action *actions, uint16_t actionCapacity,
+                                                     dji_f64_t originLatitude, dji_f64_t originLongitude);
+
+/**
+ * @brief Convert a local position to the latitude and longitude of the point of the ellipsoid below it, the trig
+ * functions of the origin are the ones computed by DjiTest_WaypointV2MissionBuilderInit().
+ */
+void DjiTest_WaypointV2MissionLocalToGlobal(const T_DjiTestWaypointV2MissionBuilder *builder,
+                                            const T_DjiTestWaypointV2MissionLocalPoint *point,
+                                            dji_f64_t *latitude, dji_f64_t *longitude);
+
+/**
+ * @brief Pattern functions append their waypoints to the mission. If the mission is full, nothing is appended and
+ * DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE is returned.
+ */
+T_DjiReturnCode DjiTest_WaypointV2MissionAddPoint(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                  const T_DjiTestWaypointV2MissionLocalPoint *point);
+T_DjiReturnCode DjiTest_WaypointV2MissionAddPolygon(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                    const T_DjiTestWaypointV2MissionPolygon *polygon);
+T_DjiReturnCode DjiTest_WaypointV2MissionAddGrid(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                 const T_DjiTestWaypointV2MissionGrid *grid);
+T_DjiReturnCode DjiTest_WaypointV2MissionAddCorridor(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                     const T_DjiTestWaypointV2MissionCorridor *corridor);
+
+/**
+ * @brief Take a photo when reaching every interval-th waypoint from firstWaypointIndex to lastWaypointIndex.
+ */
+T_DjiReturnCode DjiTest_WaypointV2MissionAddPhotoActions(T_DjiTestWaypointV2MissionBuilder *builder,
+                                                         uint16_t firstWaypointIndex, uint16_t lastWaypointIndex,
+                                                         uint16_t interval);
+
+/**
+ * @brief Check the settings, every waypoint and every action against the limits of waypoint V2 before the mission
+ * is uploaded. Reach point actions have to be sorted by waypoint index for the mission to be split into chunks.
+ * @param builder: mission to check.
+ * @param info: summary of the mission, can be NULL.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER if a limit is not met.
+ */
+T_DjiReturnCode DjiTest_WaypointV2MissionValidate(const T_DjiTestWaypointV2MissionBuilder *builder,
+                                                  T_DjiTestWaypointV2MissionInfo *info);
+
+/**
+ * @brief Missions are uploaded in chunks of at most chunkWaypointNum waypoints, each chunk starts at the last
+ * waypoint of the previous one so that the aircraft flies on without a gap. An action belongs to the chunk in which
+ * its waypoint is reached first.
+ */
+uint16_t DjiTest_WaypointV2MissionGetChunkNum(const T_DjiTestWaypointV2MissionBuilder *builder,
+                                              uint16_t chunkWaypointNum);
+
+/**
+ * @brief Fill the settings to upload one chunk of a validated mission. The waypoints of the chunk are not copied, its
+ * actions are copied into actionBuf with their ids and waypoint indexes made local to the chunk.
+ * @param builder: validated mission.
+ * @param chunkWaypointNum: maximum waypoint count of a chunk.
+ * @param chunkIndex: chunk to fill.
+ * @param actionBuf: buffer of actionBufSize actions.
+ * @param settings: settings to fill, valid as long as the mission and actionBuf are.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WaypointV2MissionGetChunk(const T_DjiTestWaypointV2MissionBuilder *builder,
+                                                  uint16_t chunkWaypointNum, uint16_t chunkIndex,
+                                                  T_DJIWaypointV2Action *actionBuf, uint16_t actionBufSize,
+                                                  T_DjiWayPointV2MissionSettings *settings);
+
+T_DjiReturnCode DjiTest_WaypointV2MissionRunBenchmark(uint16_t waypointNum);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_WAYPOINT_V2_MISSION_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
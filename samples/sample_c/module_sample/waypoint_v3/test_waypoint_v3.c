@@ -26,9 +26,10 @@
 #include <utils/util_file.h>
 #include <utils/util_misc.h>
 #include "test_waypoint_v3.h"
+#include "test_waypoint_v3_kmz.h"
 #include "dji_logger.h"
 #include "dji_waypoint_v3.h"
-#include "waypoint_file_c/waypoint_v3_test_file_kmz.h"
+#include "waypoint_file_c/waypoint_v3_assets.h"
 #include "dji_fc_subscription.h"
 
 /* Private constants ---------------------------------------------------------*/
@@ -48,17 +49,19 @@ static T_DjiReturnCode DjiTest_WaypointV3WaitEndFlightStatus(T_DjiFcSubscription
 T_DjiReturnCode DjiTest_WaypointV3RunSample(void)
 {
     T_DjiReturnCode returnCode;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
     T_DjiFcSubscriptionFlightStatus flightStatus = 0;
     T_DjiDataTimestamp flightStatusTimestamp = {0};
+    T_DjiTestWaypointV3Kmz kmz = {0};
+    bool isUploadSkipped = false;
 
 #ifdef SYSTEM_ARCH_LINUX
-    FILE *kmzFile = NULL;
-    uint32_t kmzFileSize = 0;
-    uint8_t *kmzFileBuf;
-    uint16_t readLen;
+    T_DjiTestWaypointV3KmzInfo kmzInfo;
     char curFileDirPath[DJI_TEST_WAYPOINT_V3_KMZ_FILE_PATH_LEN_MAX];
     char tempPath[DJI_TEST_WAYPOINT_V3_KMZ_FILE_PATH_LEN_MAX];
+#else
+    const uint8_t *kmzFileData;
+    uint32_t kmzFileSize = 0;
+#endif
 
     returnCode = DjiWaypointV3_Init();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -78,6 +81,7 @@ T_DjiReturnCode DjiTest_WaypointV3RunSample(void)
         goto out;
     }
 
+#ifdef SYSTEM_ARCH_LINUX
     returnCode = DjiUserUtil_GetCurrentFileDirPath(__FILE__, DJI_TEST_WAYPOINT_V3_KMZ_FILE_PATH_LEN_MAX,
                                                    curFileDirPath);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -90,61 +94,66 @@ T_DjiReturnCode DjiTest_WaypointV3RunSample(void)
     snprintf(tempPath, DJI_TEST_WAYPOINT_V3_KMZ_FILE_PATH_LEN_MAX, "%s/waypoint_file/waypoint_v3_test_file.kmz",
              curFileDirPath);
 
-    kmzFile = fopen(tempPath, "r");
-    if (kmzFile == NULL) {
-        USER_LOG_ERROR("Open kmz file failed.");
+    returnCode = DjiTest_WaypointV3KmzMapFile(tempPath, &kmz);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Load kmz file failed.");
         goto out;
     }
-
-    returnCode = UtilFile_GetFileSize(kmzFile, &kmzFileSize);
+#else
+    returnCode = UtilAsset_Load(&g_waypointV3AssetPack, "waypoint_v3_test_file.kmz", &kmzFileData, &kmzFileSize);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Get kmz file size failed.");
-        goto close_file;
-    }
-
-    kmzFileBuf = osalHandler->Malloc(kmzFileSize);
-    if (kmzFileBuf == NULL) {
-        USER_LOG_ERROR("Malloc kmz file buf error.");
-        goto close_file;
-    }
-
-    readLen = fread(kmzFileBuf, 1, kmzFileSize, kmzFile);
-    if (readLen != kmzFileSize) {
-        USER_LOG_ERROR("Read kmz file data failed.");
-        goto close_file;
+        USER_LOG_ERROR("Load kmz file asset failed.");
+        goto out;
     }
 
-    returnCode = DjiWaypointV3_UploadKmzFile(kmzFileBuf, kmzFileSize);
+    returnCode = DjiTest_WaypointV3KmzFromBuffer(kmzFileData, kmzFileSize, &kmz);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Upload kmz file failed.");
-        goto close_file;
+        USER_LOG_ERROR("Load kmz file asset failed.");
+        goto out;
     }
+#endif
 
-    osalHandler->Free(kmzFileBuf);
-#else
-    returnCode = DjiWaypointV3_UploadKmzFile(waypoint_v3_test_file_kmz_fileBinaryArray,
-                                             waypoint_v3_test_file_kmz_fileSize);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Upload kmz file binary array failed.");
-        return returnCode;
-    }
+    if (DjiTest_WaypointV3KmzIsUploaded(&kmz)) {
+        USER_LOG_INFO("Kmz file is unchanged since its last upload, skip the upload.");
+        isUploadSkipped = true;
+    } else {
+#ifdef SYSTEM_ARCH_LINUX
+        /* a bad mission is rejected here rather than after a whole upload, the rtos samples only embed a known one */
+        returnCode = DjiTest_WaypointV3KmzValidate(&kmz, &kmzInfo);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Kmz file is not valid, it is not uploaded.");
+            goto out;
+        }
+        USER_LOG_INFO("Kmz file is valid: %d wayline(s), %d waypoint(s), %d bytes of xml.", kmzInfo.waylineCount,
+                      kmzInfo.waypointCount, kmzInfo.uncompressedSize);
 #endif
 
+        returnCode = DjiTest_WaypointV3KmzUpload(&kmz);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Upload kmz file failed.");
+            goto out;
+        }
+    }
+
     USER_LOG_INFO("Execute start action");
     returnCode = DjiWaypointV3_Action(DJI_WAYPOINT_V3_ACTION_START);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS && isUploadSkipped) {
+        /* the aircraft may have dropped the mission since it was uploaded, after a restart for instance */
+        USER_LOG_WARN("Execute start action failed, upload the kmz file again.");
+        DjiTest_WaypointV3KmzForgetUploaded();
+        returnCode = DjiTest_WaypointV3KmzUpload(&kmz);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Upload kmz file failed.");
+            goto out;
+        }
+        returnCode = DjiWaypointV3_Action(DJI_WAYPOINT_V3_ACTION_START);
+    }
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Execute start action failed.");
-        goto close_file;
+        goto out;
     }
 
-close_file:
-#ifdef SYSTEM_ARCH_LINUX
-    returnCode = fclose(kmzFile);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Close KMZ file failed.");
-    }
-    kmzFile = NULL;
-#endif
+    DjiTest_WaypointV3KmzRelease(&kmz);
 
     returnCode = DjiFcSubscription_SubscribeTopic(DJI_FC_SUBSCRIPTION_TOPIC_STATUS_FLIGHT,
                                                   DJI_DATA_SUBSCRIPTION_TOPIC_10_HZ,
@@ -199,11 +208,7 @@ close_file:
     USER_LOG_INFO("The aircraft is on the ground now, and motor are stoped.");
 
 out:
-#ifdef SYSTEM_ARCH_LINUX
-    if (kmzFile != NULL) {
-        fclose(kmzFile);
-    }
-#endif
+    DjiTest_WaypointV3KmzRelease(&kmz);
 
     return DjiWaypointV3_DeInit();
 }
@@ -0,0 +1,1167 @@
+/**
+ ********************************************************************
+ * @file    test_waypoint_v3_kmz.c
+ * @brief   Kmz missions of waypoint v3: mapped instead of read into the heap, checked locally before the
+ * upload, and not uploaded again while unchanged.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_waypoint_v3_kmz.h"
+#include <string.h>
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "dji_waypoint_v3.h"
+#include "utils/util_inflate.h"
+#include "utils/util_md5.h"
+#include "utils/util_misc.h"
+
+#ifdef SYSTEM_ARCH_LINUX
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* Private constants ---------------------------------------------------------*/
+/* Zip records used by kmz files, see APPNOTE.TXT of the zip format. Zip64 and multi disk archives are not used. */
+#define DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIGNATURE     (0x04034B50)
+#define DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIGNATURE   (0x02014B50)
+#define DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIGNATURE       (0x06054B50)
+#define DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIZE          (30)
+#define DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIZE        (46)
+#define DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIZE            (22)
+#define DJI_TEST_WAYPOINT_V3_KMZ_COMMENT_SIZE_MAX           (65535)
+#define DJI_TEST_WAYPOINT_V3_KMZ_FLAG_ENCRYPTED             (0x0001)
+#define DJI_TEST_WAYPOINT_V3_KMZ_METHOD_STORED              (0)
+#define DJI_TEST_WAYPOINT_V3_KMZ_METHOD_DEFLATED            (8)
+#define DJI_TEST_WAYPOINT_V3_KMZ_ENTRY_NAME_LEN_MAX         (128)
+#define DJI_TEST_WAYPOINT_V3_KMZ_XML_NAME_PREFIX_LEN        (16)
+#define DJI_TEST_WAYPOINT_V3_KMZ_NAME_HASH_OFFSET_BASIS     (2166136261u) /* 32 bit FNV-1a */
+#define DJI_TEST_WAYPOINT_V3_KMZ_NAME_HASH_PRIME            (16777619u)
+
+/* values returned by the entry output to stop the decoder */
+#define DJI_TEST_WAYPOINT_V3_KMZ_OUTPUT_XML_ERROR           (1)
+#define DJI_TEST_WAYPOINT_V3_KMZ_OUTPUT_SIZE_ERROR          (2)
+
+#define DJI_TEST_WAYPOINT_V3_KMZ_FOUND_TEMPLATE             (0x01)
+#define DJI_TEST_WAYPOINT_V3_KMZ_FOUND_WAYLINES             (0x02)
+
+#ifdef SYSTEM_ARCH_LINUX
+#define DJI_TEST_WAYPOINT_V3_KMZ_BENCHMARK_HASH_BITS        (15)
+#define DJI_TEST_WAYPOINT_V3_KMZ_BENCHMARK_PLACEMARK_LEN    (2048)
+#endif
+
+/* Private types -------------------------------------------------------------*/
+typedef enum {
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_TEXT = 0,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_MARKUP,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_NAME,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_ATTRIBUTES,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_EMPTY_TAG_END,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_INSTRUCTION,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_DECLARATION_START,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_COMMENT_START,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_COMMENT,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_CDATA,
+    DJI_TEST_WAYPOINT_V3_KMZ_XML_DECLARATION,
+} E_DjiTestWaypointV3KmzXmlState;
+
+/**
+ * @brief Streaming well formedness check of xml: tags are matched through a stack of name hashes, attributes, text
+ * and character references are not interpreted.
+ */
+typedef struct {
+    E_DjiTestWaypointV3KmzXmlState state;
+    bool isClosingTag;
+    bool hasRoot;
+    uint8_t quote;
+    uint8_t endMatchCount; /*!< Characters of the end sequence of a comment, instruction or cdata seen so far. */
+    uint8_t depth;
+    uint16_t nameLength;
+    uint32_t nameHash;
+    char namePrefix[DJI_TEST_WAYPOINT_V3_KMZ_XML_NAME_PREFIX_LEN];
+    uint32_t stackHash[DJI_TEST_WAYPOINT_V3_KMZ_XML_DEPTH_MAX];
+    uint16_t stackLength[DJI_TEST_WAYPOINT_V3_KMZ_XML_DEPTH_MAX];
+    uint32_t offset;
+    uint32_t elementCount;
+    uint32_t folderCount;
+    uint32_t placemarkCount;
+} T_DjiTestWaypointV3KmzXmlScanner;
+
+typedef struct {
+    char name[DJI_TEST_WAYPOINT_V3_KMZ_ENTRY_NAME_LEN_MAX];
+    uint32_t expectedSize;
+    uint32_t size;
+    uint32_t crc;
+    bool isXml;
+    T_DjiTestWaypointV3KmzXmlScanner xml;
+} T_DjiTestWaypointV3KmzEntryCheck;
+
+typedef struct {
+    uint8_t window[UTIL_INFLATE_WINDOW_SIZE];
+    T_DjiTestWaypointV3KmzEntryCheck entry;
+} T_DjiTestWaypointV3KmzValidateContext;
+
+#ifdef SYSTEM_ARCH_LINUX
+typedef struct {
+    uint8_t *buf;
+    uint32_t size;
+    uint32_t bitBuf;
+    uint32_t bitCount;
+} T_DjiTestWaypointV3KmzBitWriter;
+#endif
+
+/* Private values -------------------------------------------------------------*/
+static uint8_t s_uploadedKmzHash[DJI_TEST_WAYPOINT_V3_KMZ_HASH_SIZE];
+static bool s_isUploadedKmzHashValid = false;
+
+#ifdef SYSTEM_ARCH_LINUX
+static const uint16_t s_deflateLengthBase[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t s_deflateLengthExtraBits[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t s_deflateDistanceBase[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577
+};
+static const uint8_t s_deflateDistanceExtraBits[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+static const char *s_benchmarkTemplateXml =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<kml xmlns=\"http://www.opengis.net/kml/2.2\" xmlns:wpml=\"http://www.dji.com/wpmz/1.0.3\">\n"
+    "  <Document>\n"
+    "    <wpml:createTime>1675066321000</wpml:createTime>\n"
+    "    <wpml:missionConfig>\n"
+    "      <wpml:flyToWaylineMode>safely</wpml:flyToWaylineMode>\n"
+    "      <wpml:finishAction>goHome</wpml:finishAction>\n"
+    "    </wpml:missionConfig>\n"
+    "  </Document>\n"
+    "</kml>\n";
+#endif
+
+/* Private functions declaration ---------------------------------------------*/
+static uint16_t DjiTest_WaypointV3KmzReadU16(const uint8_t *data);
+static uint32_t DjiTest_WaypointV3KmzReadU32(const uint8_t *data);
+static bool DjiTest_WaypointV3KmzHasSuffix(const char *name, const char *suffix);
+static void DjiTest_WaypointV3KmzHash(T_DjiTestWaypointV3Kmz *kmz);
+static T_DjiReturnCode DjiTest_WaypointV3KmzCheckEntry(const T_DjiTestWaypointV3Kmz *kmz, uint32_t centralOffset,
+                                                       uint32_t centralEnd, uint32_t *offset,
+                                                       T_DjiTestWaypointV3KmzValidateContext *context);
+static int32_t DjiTest_WaypointV3KmzEntryOutput(const uint8_t *data, uint32_t len, void *userData);
+static bool DjiTest_WaypointV3KmzIsXmlSpace(uint8_t c);
+static bool DjiTest_WaypointV3KmzIsXmlNameChar(uint8_t c);
+static int32_t DjiTest_WaypointV3KmzScanXml(T_DjiTestWaypointV3KmzXmlScanner *xml, const uint8_t *data, uint32_t len);
+static int32_t DjiTest_WaypointV3KmzEndXmlTag(T_DjiTestWaypointV3KmzXmlScanner *xml, bool isEmptyElement);
+#ifdef SYSTEM_ARCH_LINUX
+static void DjiTest_WaypointV3KmzWriteU16(uint8_t *data, uint16_t value);
+static void DjiTest_WaypointV3KmzWriteU32(uint8_t *data, uint32_t value);
+static void DjiTest_WaypointV3KmzPutBits(T_DjiTestWaypointV3KmzBitWriter *writer, uint32_t value, uint32_t count);
+static void DjiTest_WaypointV3KmzPutCode(T_DjiTestWaypointV3KmzBitWriter *writer, uint32_t code, uint32_t len);
+static void DjiTest_WaypointV3KmzPutLiteral(T_DjiTestWaypointV3KmzBitWriter *writer, uint32_t symbol);
+static T_DjiReturnCode DjiTest_WaypointV3KmzDeflate(const uint8_t *src, uint32_t srcSize,
+                                                    uint8_t **dst, uint32_t *dstSize);
+static uint32_t DjiTest_WaypointV3KmzGenerateWaylines(char *buf, uint32_t bufSize, uint32_t waypointCount);
+static T_DjiReturnCode DjiTest_WaypointV3KmzWriteFile(const char *filePath, uint32_t waypointCount,
+                                                      uint32_t *xmlSize);
+#endif
+
+/* Exported functions definition ---------------------------------------------*/
+#ifdef SYSTEM_ARCH_LINUX
+T_DjiReturnCode DjiTest_WaypointV3KmzMapFile(const char *filePath, T_DjiTestWaypointV3Kmz *kmz)
+{
+    struct stat fileStat;
+    void *mapped;
+    int fd;
+
+    memset(kmz, 0, sizeof(T_DjiTestWaypointV3Kmz));
+
+    fd = open(filePath, O_RDONLY);
+    if (fd < 0) {
+        USER_LOG_ERROR("Open kmz file %s failed.", filePath);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIZE
+        || (uint64_t) fileStat.st_size > UINT32_MAX) {
+        USER_LOG_ERROR("Kmz file %s is empty or too large.", filePath);
+        close(fd);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    /* the mapping outlives the descriptor, the file must not be truncated while it is mapped */
+    mapped = mmap(NULL, (size_t) fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        USER_LOG_ERROR("Map kmz file %s failed.", filePath);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    madvise(mapped, (size_t) fileStat.st_size, MADV_SEQUENTIAL);
+
+    kmz->data = mapped;
+    kmz->size = (uint32_t) fileStat.st_size;
+    kmz->isMapped = true;
+    DjiTest_WaypointV3KmzHash(kmz);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+#endif
+
+T_DjiReturnCode DjiTest_WaypointV3KmzFromBuffer(const uint8_t *data, uint32_t size, T_DjiTestWaypointV3Kmz *kmz)
+{
+    memset(kmz, 0, sizeof(T_DjiTestWaypointV3Kmz));
+
+    if (data == NULL || size == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    kmz->data = data;
+    kmz->size = size;
+    kmz->isMapped = false;
+    DjiTest_WaypointV3KmzHash(kmz);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+void DjiTest_WaypointV3KmzRelease(T_DjiTestWaypointV3Kmz *kmz)
+{
+#ifdef SYSTEM_ARCH_LINUX
+    if (kmz->isMapped && kmz->data != NULL) {
+        munmap((void *) kmz->data, kmz->size);
+    }
+#endif
+
+    memset(kmz, 0, sizeof(T_DjiTestWaypointV3Kmz));
+}
+
+T_DjiReturnCode DjiTest_WaypointV3KmzValidate(const T_DjiTestWaypointV3Kmz *kmz, T_DjiTestWaypointV3KmzInfo *info)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestWaypointV3KmzValidateContext *context;
+    T_DjiTestWaypointV3KmzInfo kmzInfo = {0};
+    const uint8_t *data = kmz->data;
+    const uint8_t *record;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    uint32_t endRecordOffset;
+    uint32_t centralOffset;
+    uint32_t centralSize;
+    uint32_t searchEnd;
+    uint32_t offset;
+    uint16_t entryNum;
+    uint16_t i;
+    uint8_t foundFiles = 0;
+
+    if (kmz->data == NULL || kmz->size < DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIZE) {
+        USER_LOG_ERROR("Kmz is too small to be a zip archive.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    /* the end of central directory record is the last one of the archive, only followed by its comment */
+    endRecordOffset = kmz->size - DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIZE;
+    searchEnd = endRecordOffset > DJI_TEST_WAYPOINT_V3_KMZ_COMMENT_SIZE_MAX ?
+                endRecordOffset - DJI_TEST_WAYPOINT_V3_KMZ_COMMENT_SIZE_MAX : 0;
+    while (DjiTest_WaypointV3KmzReadU32(data + endRecordOffset) != DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIGNATURE
+           || DjiTest_WaypointV3KmzReadU16(data + endRecordOffset + 20) !=
+              kmz->size - endRecordOffset - DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIZE) {
+        if (endRecordOffset == searchEnd) {
+            USER_LOG_ERROR("Kmz has no zip end of central directory record.");
+            return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+        }
+        endRecordOffset--;
+    }
+
+    record = data + endRecordOffset;
+    entryNum = DjiTest_WaypointV3KmzReadU16(record + 10);
+    centralSize = DjiTest_WaypointV3KmzReadU32(record + 12);
+    centralOffset = DjiTest_WaypointV3KmzReadU32(record + 16);
+    if (DjiTest_WaypointV3KmzReadU16(record + 4) != 0 || DjiTest_WaypointV3KmzReadU16(record + 6) != 0
+        || DjiTest_WaypointV3KmzReadU16(record + 8) != entryNum) {
+        USER_LOG_ERROR("Kmz is a multi disk zip archive, which is not supported.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (entryNum == 0xFFFF || centralSize == 0xFFFFFFFF || centralOffset == 0xFFFFFFFF) {
+        USER_LOG_ERROR("Kmz is a zip64 archive, which is not supported.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (centralOffset > endRecordOffset || centralSize != endRecordOffset - centralOffset) {
+        USER_LOG_ERROR("Kmz central directory is out of the archive, offset %u size %u.", centralOffset, centralSize);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    context = osalHandler->Malloc(sizeof(T_DjiTestWaypointV3KmzValidateContext));
+    if (context == NULL) {
+        USER_LOG_ERROR("Malloc kmz validate context error.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    offset = centralOffset;
+    for (i = 0; i < entryNum; i++) {
+        returnCode = DjiTest_WaypointV3KmzCheckEntry(kmz, centralOffset, endRecordOffset, &offset, context);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            goto out;
+        }
+
+        kmzInfo.entryCount++;
+        kmzInfo.uncompressedSize += context->entry.size;
+        kmzInfo.elementCount += context->entry.xml.elementCount;
+        if (strcmp(context->entry.name, DJI_TEST_WAYPOINT_V3_KMZ_TEMPLATE_FILE_NAME) == 0) {
+            foundFiles |= DJI_TEST_WAYPOINT_V3_KMZ_FOUND_TEMPLATE;
+        } else if (strcmp(context->entry.name, DJI_TEST_WAYPOINT_V3_KMZ_WAYLINES_FILE_NAME) == 0) {
+            foundFiles |= DJI_TEST_WAYPOINT_V3_KMZ_FOUND_WAYLINES;
+            kmzInfo.waylineCount = context->entry.xml.folderCount;
+            kmzInfo.waypointCount = context->entry.xml.placemarkCount;
+        }
+    }
+
+    returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    if (offset != endRecordOffset) {
+        USER_LOG_ERROR("Kmz central directory holds more than the %d entries of the end record.", entryNum);
+        goto out;
+    }
+    if ((foundFiles & DJI_TEST_WAYPOINT_V3_KMZ_FOUND_TEMPLATE) == 0) {
+        USER_LOG_ERROR("Kmz has no %s.", DJI_TEST_WAYPOINT_V3_KMZ_TEMPLATE_FILE_NAME);
+        goto out;
+    }
+    if ((foundFiles & DJI_TEST_WAYPOINT_V3_KMZ_FOUND_WAYLINES) == 0) {
+        USER_LOG_ERROR("Kmz has no %s.", DJI_TEST_WAYPOINT_V3_KMZ_WAYLINES_FILE_NAME);
+        goto out;
+    }
+    if (kmzInfo.waylineCount == 0 || kmzInfo.waypointCount == 0) {
+        USER_LOG_ERROR("Kmz %s has no wayline or no waypoint.", DJI_TEST_WAYPOINT_V3_KMZ_WAYLINES_FILE_NAME);
+        goto out;
+    }
+
+    returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    if (info != NULL) {
+        *info = kmzInfo;
+    }
+
+out:
+    osalHandler->Free(context);
+
+    return returnCode;
+}
+
+bool DjiTest_WaypointV3KmzIsUploaded(const T_DjiTestWaypointV3Kmz *kmz)
+{
+    return s_isUploadedKmzHashValid && memcmp(s_uploadedKmzHash, kmz->hash, sizeof(s_uploadedKmzHash)) == 0;
+}
+
+T_DjiReturnCode DjiTest_WaypointV3KmzUpload(const T_DjiTestWaypointV3Kmz *kmz)
+{
+    T_DjiReturnCode returnCode;
+
+    /* whatever the aircraft holds after a failed upload, it is not the last mission uploaded */
+    s_isUploadedKmzHashValid = false;
+
+    returnCode = DjiWaypointV3_UploadKmzFile(kmz->data, kmz->size);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    memcpy(s_uploadedKmzHash, kmz->hash, sizeof(s_uploadedKmzHash));
+    s_isUploadedKmzHashValid = true;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+void DjiTest_WaypointV3KmzForgetUploaded(void)
+{
+    s_isUploadedKmzHashValid = false;
+}
+
+#ifdef SYSTEM_ARCH_LINUX
+/**
+ * @brief Compare reading synthetic kmz files of increasing size into the heap, as the waypoint v3 sample used to,
+ * with mapping and hashing them, and measure the throughput of the local validation.
+ * @param filePath: path of the synthetic kmz file, removed at the end of each run.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WaypointV3KmzRunBenchmark(const char *filePath)
+{
+    const uint32_t waypointCounts[] = {100, 1000, 5000, 20000};
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestWaypointV3KmzInfo info;
+    T_DjiTestWaypointV3Kmz kmz;
+    T_DjiTestWaypointV3Kmz truncatedKmz;
+    T_DjiReturnCode returnCode;
+    FILE *file;
+    uint8_t *fileBuf;
+    uint32_t fileSize;
+    uint32_t xmlSize;
+    uint32_t readTimeUs;
+    uint32_t mapTimeUs;
+    uint32_t validateTimeUs;
+    uint32_t rejectTimeUs;
+    uint64_t startTimeUs;
+    uint64_t endTimeUs;
+    size_t readLen;
+    uint8_t i;
+
+    for (i = 0; i < sizeof(waypointCounts) / sizeof(waypointCounts[0]); i++) {
+        returnCode = DjiTest_WaypointV3KmzWriteFile(filePath, waypointCounts[i], &xmlSize);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
+
+        /* the way the sample loaded the kmz before: the whole file copied into the heap */
+        osalHandler->GetTimeUs(&startTimeUs);
+        file = fopen(filePath, "rb");
+        if (file == NULL) {
+            USER_LOG_ERROR("Open kmz benchmark file failed.");
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            goto removeFile;
+        }
+        fseek(file, 0, SEEK_END);
+        fileSize = (uint32_t) ftell(file);
+        fseek(file, 0, SEEK_SET);
+        fileBuf = osalHandler->Malloc(fileSize);
+        if (fileBuf == NULL) {
+            fclose(file);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+            goto removeFile;
+        }
+        readLen = fread(fileBuf, 1, fileSize, file);
+        fclose(file);
+        osalHandler->Free(fileBuf);
+        osalHandler->GetTimeUs(&endTimeUs);
+        readTimeUs = (uint32_t) (endTimeUs - startTimeUs);
+        if (readLen != fileSize) {
+            USER_LOG_ERROR("Read kmz benchmark file failed.");
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            goto removeFile;
+        }
+
+        osalHandler->GetTimeUs(&startTimeUs);
+        returnCode = DjiTest_WaypointV3KmzMapFile(filePath, &kmz);
+        osalHandler->GetTimeUs(&endTimeUs);
+        mapTimeUs = (uint32_t) (endTimeUs - startTimeUs);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            goto removeFile;
+        }
+
+        osalHandler->GetTimeUs(&startTimeUs);
+        returnCode = DjiTest_WaypointV3KmzValidate(&kmz, &info);
+        osalHandler->GetTimeUs(&endTimeUs);
+        validateTimeUs = (uint32_t) (endTimeUs - startTimeUs);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS || info.waypointCount != waypointCounts[i]) {
+            USER_LOG_ERROR("Synthetic kmz of %u waypoints is not valid.", waypointCounts[i]);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            goto releaseKmz;
+        }
+
+        /* a kmz cut short must be rejected locally instead of costing an upload */
+        osalHandler->GetTimeUs(&startTimeUs);
+        DjiTest_WaypointV3KmzFromBuffer(kmz.data, kmz.size - 1, &truncatedKmz);
+        returnCode = DjiTest_WaypointV3KmzValidate(&truncatedKmz, NULL);
+        osalHandler->GetTimeUs(&endTimeUs);
+        rejectTimeUs = (uint32_t) (endTimeUs - startTimeUs);
+        DjiTest_WaypointV3KmzRelease(&truncatedKmz);
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Truncated synthetic kmz of %u waypoints is not rejected.", waypointCounts[i]);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            goto releaseKmz;
+        }
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+        USER_LOG_INFO("Kmz of %u waypoints, %u KB (xml %u KB): read into heap %u us (%u KB of heap), map and hash "
+                      "%u us, validate %u us (%u MB/s of xml), truncated copy rejected in %u us.",
+                      info.waypointCount, kmz.size / 1024, xmlSize / 1024, readTimeUs, fileSize / 1024, mapTimeUs,
+                      validateTimeUs, (uint32_t) ((uint64_t) info.uncompressedSize / USER_UTIL_MAX(validateTimeUs, 1)),
+                      rejectTimeUs);
+
+releaseKmz:
+        DjiTest_WaypointV3KmzRelease(&kmz);
+removeFile:
+        remove(filePath);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
+    }
+
+    USER_LOG_INFO("An unchanged kmz only costs the map and hash time, its validation and upload are skipped.");
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+#endif
+
+/* Private functions definition-----------------------------------------------*/
+static uint16_t DjiTest_WaypointV3KmzReadU16(const uint8_t *data)
+{
+    return (uint16_t) (data[0] | (data[1] << 8));
+}
+
+static uint32_t DjiTest_WaypointV3KmzReadU32(const uint8_t *data)
+{
+    return (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static bool DjiTest_WaypointV3KmzHasSuffix(const char *name, const char *suffix)
+{
+    size_t nameLen = strlen(name);
+    size_t suffixLen = strlen(suffix);
+
+    return nameLen >= suffixLen && strcmp(name + nameLen - suffixLen, suffix) == 0;
+}
+
+static void DjiTest_WaypointV3KmzHash(T_DjiTestWaypointV3Kmz *kmz)
+{
+    MD5_CTX md5Ctx;
+
+    UtilMd5_Init(&md5Ctx);
+    UtilMd5_Update(&md5Ctx, kmz->data, kmz->size);
+    UtilMd5_Final(&md5Ctx, kmz->hash);
+}
+
+static T_DjiReturnCode DjiTest_WaypointV3KmzCheckEntry(const T_DjiTestWaypointV3Kmz *kmz, uint32_t centralOffset,
+                                                       uint32_t centralEnd, uint32_t *offset,
+                                                       T_DjiTestWaypointV3KmzValidateContext *context)
+{
+    T_DjiTestWaypointV3KmzEntryCheck *entry = &context->entry;
+    const uint8_t *header = kmz->data + *offset;
+    const uint8_t *localHeader;
+    uint32_t compressedSize;
+    uint32_t localOffset;
+    uint32_t dataOffset;
+    uint32_t crc;
+    uint16_t flags;
+    uint16_t method;
+    uint16_t nameLength;
+    uint32_t recordLength;
+    int32_t result;
+
+    if (centralEnd - *offset < DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIZE
+        || DjiTest_WaypointV3KmzReadU32(header) != DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIGNATURE) {
+        USER_LOG_ERROR("Kmz central directory is corrupted at offset %u.", *offset);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    flags = DjiTest_WaypointV3KmzReadU16(header + 8);
+    method = DjiTest_WaypointV3KmzReadU16(header + 10);
+    crc = DjiTest_WaypointV3KmzReadU32(header + 16);
+    compressedSize = DjiTest_WaypointV3KmzReadU32(header + 20);
+    nameLength = DjiTest_WaypointV3KmzReadU16(header + 28);
+    localOffset = DjiTest_WaypointV3KmzReadU32(header + 42);
+    recordLength = DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIZE + nameLength
+                   + DjiTest_WaypointV3KmzReadU16(header + 30) + DjiTest_WaypointV3KmzReadU16(header + 32);
+    if (recordLength > centralEnd - *offset) {
+        USER_LOG_ERROR("Kmz central directory is corrupted at offset %u.", *offset);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    *offset += recordLength;
+
+    memset(entry, 0, sizeof(T_DjiTestWaypointV3KmzEntryCheck));
+    entry->expectedSize = DjiTest_WaypointV3KmzReadU32(header + 24);
+    if (nameLength == 0 || nameLength >= sizeof(entry->name)) {
+        USER_LOG_ERROR("Kmz entry name length %d is not supported.", nameLength);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    memcpy(entry->name, header + DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIZE, nameLength);
+    entry->name[nameLength] = '\0';
+    if (strlen(entry->name) != nameLength || entry->name[0] == '/' || strstr(entry->name, "..") != NULL
+        || strchr(entry->name, '\\') != NULL) {
+        USER_LOG_ERROR("Kmz entry %s has an unsafe path.", entry->name);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if ((flags & DJI_TEST_WAYPOINT_V3_KMZ_FLAG_ENCRYPTED) != 0) {
+        USER_LOG_ERROR("Kmz entry %s is encrypted.", entry->name);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    /* entry data lies between its local header and the central directory */
+    if (localOffset > centralOffset || centralOffset - localOffset < DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIZE) {
+        USER_LOG_ERROR("Kmz entry %s local header is out of the archive.", entry->name);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    localHeader = kmz->data + localOffset;
+    dataOffset = localOffset + DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIZE
+                 + DjiTest_WaypointV3KmzReadU16(localHeader + 26) + DjiTest_WaypointV3KmzReadU16(localHeader + 28);
+    if (DjiTest_WaypointV3KmzReadU32(localHeader) != DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIGNATURE
+        || DjiTest_WaypointV3KmzReadU16(localHeader + 26) != nameLength || dataOffset > centralOffset
+        || memcmp(localHeader + DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIZE, entry->name, nameLength) != 0) {
+        USER_LOG_ERROR("Kmz entry %s local header does not match the central directory.", entry->name);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (compressedSize > centralOffset - dataOffset) {
+        USER_LOG_ERROR("Kmz entry %s data is out of the archive.", entry->name);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    entry->isXml = DjiTest_WaypointV3KmzHasSuffix(entry->name, ".kml")
+                   || DjiTest_WaypointV3KmzHasSuffix(entry->name, ".wpml");
+
+    if (method == DJI_TEST_WAYPOINT_V3_KMZ_METHOD_STORED) {
+        result = compressedSize == entry->expectedSize ?
+                 DjiTest_WaypointV3KmzEntryOutput(kmz->data + dataOffset, compressedSize, entry) :
+                 DJI_TEST_WAYPOINT_V3_KMZ_OUTPUT_SIZE_ERROR;
+    } else if (method == DJI_TEST_WAYPOINT_V3_KMZ_METHOD_DEFLATED) {
+        result = UtilInflate_Decode(kmz->data + dataOffset, compressedSize, context->window,
+                                    DjiTest_WaypointV3KmzEntryOutput, entry, NULL);
+    } else {
+        USER_LOG_ERROR("Kmz entry %s compression method %d is not supported.", entry->name, method);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (result == DJI_TEST_WAYPOINT_V3_KMZ_OUTPUT_XML_ERROR) {
+        USER_LOG_ERROR("Kmz entry %s is not well formed xml at byte %u.", entry->name, entry->xml.offset);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (result != 0) {
+        USER_LOG_ERROR("Kmz entry %s data is corrupted.", entry->name);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (entry->size != entry->expectedSize || entry->crc != crc) {
+        USER_LOG_ERROR("Kmz entry %s size %u crc 0x%08X does not match the expected size %u crc 0x%08X.",
+                       entry->name, entry->size, entry->crc, entry->expectedSize, crc);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+    if (entry->isXml && (entry->xml.state != DJI_TEST_WAYPOINT_V3_KMZ_XML_TEXT || entry->xml.depth != 0
+                         || !entry->xml.hasRoot)) {
+        USER_LOG_ERROR("Kmz entry %s xml ends before its root element is closed.", entry->name);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static int32_t DjiTest_WaypointV3KmzEntryOutput(const uint8_t *data, uint32_t len, void *userData)
+{
+    T_DjiTestWaypointV3KmzEntryCheck *entry = userData;
+
+    /* never decode more than announced, a crafted entry could otherwise inflate without end */
+    if (len > entry->expectedSize - entry->size) {
+        return DJI_TEST_WAYPOINT_V3_KMZ_OUTPUT_SIZE_ERROR;
+    }
+
+    entry->crc = UtilInflate_Crc32(entry->crc, data, len);
+    entry->size += len;
+
+    if (entry->isXml && DjiTest_WaypointV3KmzScanXml(&entry->xml, data, len) != 0) {
+        return DJI_TEST_WAYPOINT_V3_KMZ_OUTPUT_XML_ERROR;
+    }
+
+    return 0;
+}
+
+static bool DjiTest_WaypointV3KmzIsXmlSpace(uint8_t c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static bool DjiTest_WaypointV3KmzIsXmlNameChar(uint8_t c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == ':' || c == '_'
+           || c == '-' || c == '.' || c >= 0x80;
+}
+
+static int32_t DjiTest_WaypointV3KmzScanXml(T_DjiTestWaypointV3KmzXmlScanner *xml, const uint8_t *data, uint32_t len)
+{
+    const uint8_t *next;
+    uint32_t i;
+    uint8_t c;
+
+    for (i = 0; i < len; i++, xml->offset++) {
+        c = data[i];
+
+        switch (xml->state) {
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_TEXT:
+                /* text inside the root element is not checked, skip it up to the next markup */
+                if (c != '<' && xml->depth > 0) {
+                    next = memchr(data + i, '<', len - i);
+                    if (next == NULL) {
+                        xml->offset += len - i;
+                        return 0;
+                    }
+                    xml->offset += (uint32_t) (next - (data + i));
+                    i = (uint32_t) (next - data);
+                    c = '<';
+                }
+                if (c == '<') {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_MARKUP;
+                } else if (xml->depth == 0 && !DjiTest_WaypointV3KmzIsXmlSpace(c)) {
+                    return -1;
+                }
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_MARKUP:
+                xml->nameHash = DJI_TEST_WAYPOINT_V3_KMZ_NAME_HASH_OFFSET_BASIS;
+                xml->nameLength = 0;
+                if (c == '/') {
+                    xml->isClosingTag = true;
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_NAME;
+                } else if (c == '?') {
+                    xml->endMatchCount = 0;
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_INSTRUCTION;
+                } else if (c == '!') {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_DECLARATION_START;
+                } else if (DjiTest_WaypointV3KmzIsXmlNameChar(c) && !(c >= '0' && c <= '9') && c != '-' && c != '.') {
+                    xml->isClosingTag = false;
+                    xml->namePrefix[0] = (char) c;
+                    xml->nameHash = (xml->nameHash ^ c) * DJI_TEST_WAYPOINT_V3_KMZ_NAME_HASH_PRIME;
+                    xml->nameLength = 1;
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_NAME;
+                } else {
+                    return -1;
+                }
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_NAME:
+                if (DjiTest_WaypointV3KmzIsXmlNameChar(c)) {
+                    if (xml->nameLength < DJI_TEST_WAYPOINT_V3_KMZ_XML_NAME_PREFIX_LEN) {
+                        xml->namePrefix[xml->nameLength] = (char) c;
+                    }
+                    xml->nameHash = (xml->nameHash ^ c) * DJI_TEST_WAYPOINT_V3_KMZ_NAME_HASH_PRIME;
+                    xml->nameLength++;
+                } else if (xml->nameLength == 0) {
+                    return -1;
+                } else if (DjiTest_WaypointV3KmzIsXmlSpace(c)) {
+                    xml->quote = 0;
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_ATTRIBUTES;
+                } else if (c == '>') {
+                    if (DjiTest_WaypointV3KmzEndXmlTag(xml, false) != 0) {
+                        return -1;
+                    }
+                } else if (c == '/' && !xml->isClosingTag) {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_EMPTY_TAG_END;
+                } else {
+                    return -1;
+                }
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_ATTRIBUTES:
+                if (xml->quote != 0) {
+                    if (c == xml->quote) {
+                        xml->quote = 0;
+                    } else if (c == '<') {
+                        return -1;
+                    }
+                } else if (c == '>') {
+                    if (DjiTest_WaypointV3KmzEndXmlTag(xml, false) != 0) {
+                        return -1;
+                    }
+                } else if (xml->isClosingTag) {
+                    if (!DjiTest_WaypointV3KmzIsXmlSpace(c)) {
+                        return -1;
+                    }
+                } else if (c == '"' || c == '\'') {
+                    xml->quote = c;
+                } else if (c == '/') {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_EMPTY_TAG_END;
+                } else if (c == '<') {
+                    return -1;
+                }
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_EMPTY_TAG_END:
+                if (c != '>' || DjiTest_WaypointV3KmzEndXmlTag(xml, true) != 0) {
+                    return -1;
+                }
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_INSTRUCTION:
+                if (c == '>' && xml->endMatchCount == 1) {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_TEXT;
+                }
+                xml->endMatchCount = c == '?' ? 1 : 0;
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_DECLARATION_START:
+                xml->endMatchCount = 0;
+                if (c == '-') {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_COMMENT_START;
+                } else if (c == '[' && xml->depth > 0) {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_CDATA;
+                } else {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_DECLARATION;
+                }
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_COMMENT_START:
+                if (c != '-') {
+                    return -1;
+                }
+                xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_COMMENT;
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_COMMENT:
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_CDATA:
+                /* comments end with "-->", cdata sections with "]]>" */
+                if (c == (xml->state == DJI_TEST_WAYPOINT_V3_KMZ_XML_COMMENT ? '-' : ']')) {
+                    xml->endMatchCount = USER_UTIL_MIN(xml->endMatchCount + 1, 2);
+                } else {
+                    if (c == '>' && xml->endMatchCount == 2) {
+                        xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_TEXT;
+                    }
+                    xml->endMatchCount = 0;
+                }
+                break;
+            case DJI_TEST_WAYPOINT_V3_KMZ_XML_DECLARATION:
+                if (c == '>') {
+                    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_TEXT;
+                }
+                break;
+            default:
+                return -1;
+        }
+    }
+
+    return 0;
+}
+
+static int32_t DjiTest_WaypointV3KmzEndXmlTag(T_DjiTestWaypointV3KmzXmlScanner *xml, bool isEmptyElement)
+{
+    xml->state = DJI_TEST_WAYPOINT_V3_KMZ_XML_TEXT;
+
+    if (xml->isClosingTag) {
+        if (xml->depth == 0) {
+            return -1;
+        }
+        xml->depth--;
+        return xml->stackHash[xml->depth] == xml->nameHash && xml->stackLength[xml->depth] == xml->nameLength ? 0 : -1;
+    }
+
+    if (xml->depth == 0) {
+        if (xml->hasRoot) {
+            return -1;
+        }
+        xml->hasRoot = true;
+    }
+
+    xml->elementCount++;
+    if (xml->nameLength == strlen("Folder") && memcmp(xml->namePrefix, "Folder", xml->nameLength) == 0) {
+        xml->folderCount++;
+    } else if (xml->nameLength == strlen("Placemark") && memcmp(xml->namePrefix, "Placemark", xml->nameLength) == 0) {
+        xml->placemarkCount++;
+    }
+
+    if (isEmptyElement) {
+        return 0;
+    }
+
+    if (xml->depth >= DJI_TEST_WAYPOINT_V3_KMZ_XML_DEPTH_MAX) {
+        return -1;
+    }
+    xml->stackHash[xml->depth] = xml->nameHash;
+    xml->stackLength[xml->depth] = xml->nameLength;
+    xml->depth++;
+
+    return 0;
+}
+
+#ifdef SYSTEM_ARCH_LINUX
+static void DjiTest_WaypointV3KmzWriteU16(uint8_t *data, uint16_t value)
+{
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+}
+
+static void DjiTest_WaypointV3KmzWriteU32(uint8_t *data, uint32_t value)
+{
+    DjiTest_WaypointV3KmzWriteU16(data, (uint16_t) value);
+    DjiTest_WaypointV3KmzWriteU16(data + 2, (uint16_t) (value >> 16));
+}
+
+static void DjiTest_WaypointV3KmzPutBits(T_DjiTestWaypointV3KmzBitWriter *writer, uint32_t value, uint32_t count)
+{
+    writer->bitBuf |= value << writer->bitCount;
+    writer->bitCount += count;
+    while (writer->bitCount >= 8) {
+        writer->buf[writer->size++] = (uint8_t) writer->bitBuf;
+        writer->bitBuf >>= 8;
+        writer->bitCount -= 8;
+    }
+}
+
+static void DjiTest_WaypointV3KmzPutCode(T_DjiTestWaypointV3KmzBitWriter *writer, uint32_t code, uint32_t len)
+{
+    uint32_t reversed = 0;
+    uint32_t i;
+
+    /* huffman codes are packed msb first, unlike the other fields of the stream */
+    for (i = 0; i < len; i++) {
+        reversed = (reversed << 1) | ((code >> i) & 1);
+    }
+    DjiTest_WaypointV3KmzPutBits(writer, reversed, len);
+}
+
+static void DjiTest_WaypointV3KmzPutLiteral(T_DjiTestWaypointV3KmzBitWriter *writer, uint32_t symbol)
+{
+    /* fixed huffman code of the literal/length alphabet, RFC 1951 section 3.2.6 */
+    if (symbol < 144) {
+        DjiTest_WaypointV3KmzPutCode(writer, 0x30 + symbol, 8);
+    } else if (symbol < 256) {
+        DjiTest_WaypointV3KmzPutCode(writer, 0x190 + symbol - 144, 9);
+    } else if (symbol < 280) {
+        DjiTest_WaypointV3KmzPutCode(writer, symbol - 256, 7);
+    } else {
+        DjiTest_WaypointV3KmzPutCode(writer, 0xC0 + symbol - 280, 8);
+    }
+}
+
+/**
+ * @brief Minimal deflate encoder for the synthetic kmz files: one block with the fixed huffman codes and greedy
+ * matches found through a hash of the next three bytes.
+ */
+static T_DjiReturnCode DjiTest_WaypointV3KmzDeflate(const uint8_t *src, uint32_t srcSize,
+                                                    uint8_t **dst, uint32_t *dstSize)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestWaypointV3KmzBitWriter writer = {0};
+    const uint32_t hashSize = 1u << DJI_TEST_WAYPOINT_V3_KMZ_BENCHMARK_HASH_BITS;
+    uint32_t *head;
+    uint32_t candidate;
+    uint32_t matchLength;
+    uint32_t maxLength;
+    uint32_t distance;
+    uint32_t hash;
+    uint32_t pos = 0;
+    uint32_t k;
+    int32_t index;
+
+    /* a literal takes at most 9 bits */
+    writer.buf = osalHandler->Malloc(srcSize / 8 * 9 + 16);
+    head = osalHandler->Malloc(hashSize * sizeof(uint32_t));
+    if (writer.buf == NULL || head == NULL) {
+        osalHandler->Free(writer.buf);
+        osalHandler->Free(head);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+    /* positions are stored plus one, 0 marks an empty bucket */
+    memset(head, 0, hashSize * sizeof(uint32_t));
+
+    DjiTest_WaypointV3KmzPutBits(&writer, 1, 1);
+    DjiTest_WaypointV3KmzPutBits(&writer, 1, 2);
+
+    while (pos < srcSize) {
+        matchLength = 0;
+        distance = 0;
+        if (srcSize - pos >= UTIL_INFLATE_MIN_MATCH) {
+            hash = ((src[pos] << 10) ^ (src[pos + 1] << 5) ^ src[pos + 2]) & (hashSize - 1);
+            candidate = head[hash];
+            head[hash] = pos + 1;
+            if (candidate != 0 && pos - (candidate - 1) <= UTIL_INFLATE_WINDOW_SIZE) {
+                candidate--;
+                maxLength = USER_UTIL_MIN(srcSize - pos, UTIL_INFLATE_MAX_MATCH);
+                while (matchLength < maxLength && src[candidate + matchLength] == src[pos + matchLength]) {
+                    matchLength++;
+                }
+                distance = pos - candidate;
+            }
+        }
+
+        if (matchLength < UTIL_INFLATE_MIN_MATCH) {
+            DjiTest_WaypointV3KmzPutLiteral(&writer, src[pos]);
+            pos++;
+            continue;
+        }
+
+        for (index = 28; s_deflateLengthBase[index] > matchLength; index--) {
+        }
+        DjiTest_WaypointV3KmzPutLiteral(&writer, 257 + index);
+        DjiTest_WaypointV3KmzPutBits(&writer, matchLength - s_deflateLengthBase[index],
+                                     s_deflateLengthExtraBits[index]);
+        for (index = 29; s_deflateDistanceBase[index] > distance; index--) {
+        }
+        DjiTest_WaypointV3KmzPutCode(&writer, index, 5);
+        DjiTest_WaypointV3KmzPutBits(&writer, distance - s_deflateDistanceBase[index],
+                                     s_deflateDistanceExtraBits[index]);
+
+        for (k = 1; k < matchLength && srcSize - (pos + k) >= UTIL_INFLATE_MIN_MATCH; k++) {
+            hash = ((src[pos + k] << 10) ^ (src[pos + k + 1] << 5) ^ src[pos + k + 2]) & (hashSize - 1);
+            head[hash] = pos + k + 1;
+        }
+        pos += matchLength;
+    }
+
+    DjiTest_WaypointV3KmzPutLiteral(&writer, 256);
+    DjiTest_WaypointV3KmzPutBits(&writer, 0, 7);
+
+    osalHandler->Free(head);
+    *dst = writer.buf;
+    *dstSize = writer.size;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static uint32_t DjiTest_WaypointV3KmzGenerateWaylines(char *buf, uint32_t bufSize, uint32_t waypointCount)
+{
+    uint32_t len = 0;
+    uint32_t i;
+
+    len += snprintf(buf + len, bufSize - len,
+                    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                    "<kml xmlns=\"http://www.opengis.net/kml/2.2\" xmlns:wpml=\"http://www.dji.com/wpmz/1.0.3\">\n"
+                    "  <Document>\n"
+                    "    <Folder>\n"
+                    "      <wpml:templateId>0</wpml:templateId>\n"
+                    "      <wpml:waylineId>0</wpml:waylineId>\n"
+                    "      <wpml:autoFlightSpeed>5</wpml:autoFlightSpeed>\n");
+
+    /* survey lines of 100 waypoints back and forth */
+    for (i = 0; i < waypointCount && bufSize - len > DJI_TEST_WAYPOINT_V3_KMZ_BENCHMARK_PLACEMARK_LEN; i++) {
+        len += snprintf(buf + len, bufSize - len,
+                        "      <Placemark>\n"
+                        "        <Point>\n"
+                        "          <coordinates>\n"
+                        "            %.9f,%.9f\n"
+                        "          </coordinates>\n"
+                        "        </Point>\n"
+                        "        <wpml:index>%u</wpml:index>\n"
+                        "        <wpml:executeHeight>%u</wpml:executeHeight>\n"
+                        "        <wpml:waypointSpeed>5</wpml:waypointSpeed>\n"
+                        "        <wpml:waypointHeadingParam>\n"
+                        "          <wpml:waypointHeadingMode>followWayline</wpml:waypointHeadingMode>\n"
+                        "        </wpml:waypointHeadingParam>\n"
+                        "        <wpml:waypointTurnParam>\n"
+                        "          <wpml:waypointTurnMode>toPointAndStopWithDiscontinuityCurvature"
+                        "</wpml:waypointTurnMode>\n"
+                        "          <wpml:waypointTurnDampingDist>0</wpml:waypointTurnDampingDist>\n"
+                        "        </wpml:waypointTurnParam>\n"
+                        "        <wpml:actionGroup>\n"
+                        "          <wpml:actionGroupId>%u</wpml:actionGroupId>\n"
+                        "          <wpml:actionGroupStartIndex>%u</wpml:actionGroupStartIndex>\n"
+                        "          <wpml:actionGroupEndIndex>%u</wpml:actionGroupEndIndex>\n"
+                        "          <wpml:actionGroupMode>sequence</wpml:actionGroupMode>\n"
+                        "          <wpml:actionTrigger>\n"
+                        "            <wpml:actionTriggerType>reachPoint</wpml:actionTriggerType>\n"
+                        "          </wpml:actionTrigger>\n"
+                        "          <wpml:action>\n"
+                        "            <wpml:actionId>0</wpml:actionId>\n"
+                        "            <wpml:actionActuatorFunc>takePhoto</wpml:actionActuatorFunc>\n"
+                        "          </wpml:action>\n"
+                        "        </wpml:actionGroup>\n"
+                        "      </Placemark>\n",
+                        113.94255 + ((i / 100) % 2 == 0 ? i % 100 : 99 - i % 100) * 0.00005,
+                        22.57765 + (i / 100) * 0.00005, i, 100 + i % 7, i, i, i);
+    }
+
+    len += snprintf(buf + len, bufSize - len,
+                    "    </Folder>\n"
+                    "  </Document>\n"
+                    "</kml>\n");
+
+    return len;
+}
+
+static T_DjiReturnCode DjiTest_WaypointV3KmzWriteFile(const char *filePath, uint32_t waypointCount,
+                                                      uint32_t *xmlSize)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    const char *names[] = {DJI_TEST_WAYPOINT_V3_KMZ_TEMPLATE_FILE_NAME, DJI_TEST_WAYPOINT_V3_KMZ_WAYLINES_FILE_NAME};
+    const uint8_t *contents[2];
+    uint32_t sizes[2];
+    uint8_t *compressed[2] = {NULL, NULL};
+    uint32_t compressedSizes[2];
+    uint32_t crcs[2];
+    uint32_t localOffsets[2];
+    uint8_t header[DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIZE];
+    uint32_t waylinesBufSize = waypointCount * DJI_TEST_WAYPOINT_V3_KMZ_BENCHMARK_PLACEMARK_LEN + 1024;
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    uint32_t centralOffset;
+    uint32_t offset = 0;
+    uint16_t nameLength;
+    char *waylines;
+    FILE *file;
+    uint8_t i;
+
+    waylines = osalHandler->Malloc(waylinesBufSize);
+    if (waylines == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+    }
+
+    contents[0] = (const uint8_t *) s_benchmarkTemplateXml;
+    sizes[0] = strlen(s_benchmarkTemplateXml);
+    contents[1] = (const uint8_t *) waylines;
+    sizes[1] = DjiTest_WaypointV3KmzGenerateWaylines(waylines, waylinesBufSize, waypointCount);
+    *xmlSize = sizes[0] + sizes[1];
+
+    for (i = 0; i < 2; i++) {
+        crcs[i] = UtilInflate_Crc32(0, contents[i], sizes[i]);
+        returnCode = DjiTest_WaypointV3KmzDeflate(contents[i], sizes[i], &compressed[i], &compressedSizes[i]);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            goto out;
+        }
+    }
+
+    file = fopen(filePath, "wb");
+    if (file == NULL) {
+        USER_LOG_ERROR("Create kmz benchmark file %s failed.", filePath);
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        goto out;
+    }
+
+    /* local headers and data, then the central directory, then its end record */
+    for (i = 0; i < 2; i++) {
+        nameLength = (uint16_t) strlen(names[i]);
+        memset(header, 0, sizeof(header));
+        DjiTest_WaypointV3KmzWriteU32(header, DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIGNATURE);
+        DjiTest_WaypointV3KmzWriteU16(header + 4, 20);
+        DjiTest_WaypointV3KmzWriteU16(header + 8, DJI_TEST_WAYPOINT_V3_KMZ_METHOD_DEFLATED);
+        DjiTest_WaypointV3KmzWriteU32(header + 14, crcs[i]);
+        DjiTest_WaypointV3KmzWriteU32(header + 18, compressedSizes[i]);
+        DjiTest_WaypointV3KmzWriteU32(header + 22, sizes[i]);
+        DjiTest_WaypointV3KmzWriteU16(header + 26, nameLength);
+        fwrite(header, 1, DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIZE, file);
+        fwrite(names[i], 1, nameLength, file);
+        fwrite(compressed[i], 1, compressedSizes[i], file);
+        localOffsets[i] = offset;
+        offset += DJI_TEST_WAYPOINT_V3_KMZ_LOCAL_HEADER_SIZE + nameLength + compressedSizes[i];
+    }
+
+    centralOffset = offset;
+    for (i = 0; i < 2; i++) {
+        nameLength = (uint16_t) strlen(names[i]);
+        memset(header, 0, sizeof(header));
+        DjiTest_WaypointV3KmzWriteU32(header, DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIGNATURE);
+        DjiTest_WaypointV3KmzWriteU16(header + 4, 20);
+        DjiTest_WaypointV3KmzWriteU16(header + 6, 20);
+        DjiTest_WaypointV3KmzWriteU16(header + 10, DJI_TEST_WAYPOINT_V3_KMZ_METHOD_DEFLATED);
+        DjiTest_WaypointV3KmzWriteU32(header + 16, crcs[i]);
+        DjiTest_WaypointV3KmzWriteU32(header + 20, compressedSizes[i]);
+        DjiTest_WaypointV3KmzWriteU32(header + 24, sizes[i]);
+        DjiTest_WaypointV3KmzWriteU16(header + 28, nameLength);
+        DjiTest_WaypointV3KmzWriteU32(header + 42, localOffsets[i]);
+        fwrite(header, 1, DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIZE, file);
+        fwrite(names[i], 1, nameLength, file);
+        offset += DJI_TEST_WAYPOINT_V3_KMZ_CENTRAL_HEADER_SIZE + nameLength;
+    }
+
+    memset(header, 0, sizeof(header));
+    DjiTest_WaypointV3KmzWriteU32(header, DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIGNATURE);
+    DjiTest_WaypointV3KmzWriteU16(header + 8, 2);
+    DjiTest_WaypointV3KmzWriteU16(header + 10, 2);
+    DjiTest_WaypointV3KmzWriteU32(header + 12, offset - centralOffset);
+    DjiTest_WaypointV3KmzWriteU32(header + 16, centralOffset);
+    fwrite(header, 1, DJI_TEST_WAYPOINT_V3_KMZ_END_RECORD_SIZE, file);
+
+    if (ferror(file) != 0) {
+        USER_LOG_ERROR("Write kmz benchmark file %s failed.", filePath);
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    fclose(file);
+
+out:
+    for (i = 0; i < 2; i++) {
+        osalHandler->Free(compressed[i]);
+    }
+    osalHandler->Free(waylines);
+
+    return returnCode;
+}
+#endif
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
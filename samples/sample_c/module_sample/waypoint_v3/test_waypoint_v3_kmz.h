@@ -0,0 +1,102 @@
+/**
+ ********************************************************************
+ * @file    test_waypoint_v3_kmz.h
+ * @brief   This is the header file for "test_waypoint_v3_kmz.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_WAYPOINT_V3_KMZ_H
+#define TEST_WAYPOINT_V3_KMZ_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_TEST_WAYPOINT_V3_KMZ_HASH_SIZE              (16) /* md5 of the whole kmz file */
+#define DJI_TEST_WAYPOINT_V3_KMZ_XML_DEPTH_MAX          (32)
+#define DJI_TEST_WAYPOINT_V3_KMZ_TEMPLATE_FILE_NAME     "wpmz/template.kml"
+#define DJI_TEST_WAYPOINT_V3_KMZ_WAYLINES_FILE_NAME     "wpmz/waylines.wpml"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Kmz mission in memory, either a file mapped read only or a buffer owned by the caller.
+ */
+typedef struct {
+    const uint8_t *data;
+    uint32_t size;
+    bool isMapped;
+    uint8_t hash[DJI_TEST_WAYPOINT_V3_KMZ_HASH_SIZE];
+} T_DjiTestWaypointV3Kmz;
+
+typedef struct {
+    uint16_t entryCount;
+    uint32_t uncompressedSize;
+    uint32_t elementCount; /*!< Xml elements of all the kml and wpml entries. */
+    uint32_t waylineCount; /*!< Folder elements of the waylines file. */
+    uint32_t waypointCount; /*!< Placemark elements of the waylines file. */
+} T_DjiTestWaypointV3KmzInfo;
+
+/* Exported functions --------------------------------------------------------*/
+#ifdef SYSTEM_ARCH_LINUX
+/**
+ * @brief Map a kmz file read only and hash it, the file is not copied into the heap.
+ * @param filePath: path of the kmz file.
+ * @param kmz: kmz to fill, release it with DjiTest_WaypointV3KmzRelease().
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WaypointV3KmzMapFile(const char *filePath, T_DjiTestWaypointV3Kmz *kmz);
+#endif
+T_DjiReturnCode DjiTest_WaypointV3KmzFromBuffer(const uint8_t *data, uint32_t size, T_DjiTestWaypointV3Kmz *kmz);
+void DjiTest_WaypointV3KmzRelease(T_DjiTestWaypointV3Kmz *kmz);
+
+/**
+ * @brief Check a kmz locally before it is uploaded: the zip central directory and local headers, the size and crc of
+ * every entry, and that the kml and wpml entries are well formed xml. Entries are decoded in chunks through a 32 KB
+ * window, none of them is decoded into memory as a whole.
+ * @param kmz: kmz to check.
+ * @param info: content of the kmz, can be NULL.
+ * @return Execution result, DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER if the kmz is malformed.
+ */
+T_DjiReturnCode DjiTest_WaypointV3KmzValidate(const T_DjiTestWaypointV3Kmz *kmz, T_DjiTestWaypointV3KmzInfo *info);
+
+/**
+ * @brief Whether the kmz is the last one uploaded successfully by DjiTest_WaypointV3KmzUpload() in this run of the
+ * application, in which case the aircraft already holds the mission.
+ */
+bool DjiTest_WaypointV3KmzIsUploaded(const T_DjiTestWaypointV3Kmz *kmz);
+T_DjiReturnCode DjiTest_WaypointV3KmzUpload(const T_DjiTestWaypointV3Kmz *kmz);
+void DjiTest_WaypointV3KmzForgetUploaded(void);
+
+#ifdef SYSTEM_ARCH_LINUX
+T_DjiReturnCode DjiTest_WaypointV3KmzRunBenchmark(const char *filePath);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_WAYPOINT_V3_KMZ_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -1,14 +1,10 @@
-/* Generated by file2c, do not edit manually */
-#ifndef __waypoint_v3_test_file_kmz_h_included
-#define __waypoint_v3_test_file_kmz_h_included
+/* Generated by asset_packer, do not edit manually */
+#include "waypoint_v3_assets.h"
 
-#include <stdint.h>
+#ifndef SYSTEM_ARCH_LINUX
 
-/* Contents of file waypoint_v3_test_file.kmz */
-#define waypoint_v3_test_file_kmz_fileName        "waypoint_v3_test_file.kmz"
-#define waypoint_v3_test_file_kmz_fileSize        3856
-
-static const uint8_t waypoint_v3_test_file_kmz_fileBinaryArray[3856] = {
+/* waypoint_v3_test_file.kmz: 3856 bytes */
+static const uint8_t s_waypointV3AssetPackBlob[3856] = {
     0x50, 0x4B, 0x03, 0x04, 0x14, 0x00, 0x08, 0x08, 0x08, 0x00, 0x8A, 0x81, 0x3E, 0x56, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x77, 0x70,
     0x6D, 0x7A, 0x2F, 0x74, 0x65, 0x6D, 0x70, 0x6C, 0x61, 0x74, 0x65, 0x2E, 0x6B, 0x6D, 0x6C, 0xED,
@@ -249,7 +245,26 @@ static const uint8_t waypoint_v3_test_file_kmz_fileBinaryArray[3856] = {
     0x00, 0x00, 0x7E, 0x6A, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x10, 0x07, 0x00, 0x00, 0x77, 0x70, 0x6D, 0x7A, 0x2F, 0x77, 0x61, 0x79,
     0x6C, 0x69, 0x6E, 0x65, 0x73, 0x2E, 0x77, 0x70, 0x6D, 0x6C, 0x50, 0x4B, 0x05, 0x06, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7B, 0x0E, 0x00, 0x00, 0x00, 0x00
+    0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x7B, 0x0E, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const T_UtilAssetEntry s_waypointV3AssetPackEntries[1] = {
+    {"waypoint_v3_test_file.kmz", 0xB4639478u, 0, 3856, 3856, UTIL_ASSET_COMPRESSION_NONE},
+};
+
+static const uint16_t s_waypointV3AssetPackBuckets[2] = {
+    1, 0,
+};
+
+static uint8_t *s_waypointV3AssetPackCache[1];
+
+const T_UtilAssetPack g_waypointV3AssetPack = {
+    s_waypointV3AssetPackBlob,
+    s_waypointV3AssetPackEntries,
+    1,
+    s_waypointV3AssetPackBuckets,
+    1,
+    s_waypointV3AssetPackCache
 };
 
-#endif    /* __waypoint_v3_test_file_kmz_h_included */
+#endif
@@ -0,0 +1,19 @@
+/* Generated by asset_packer, do not edit manually */
+#ifndef WAYPOINT_V3_ASSET_PACK_H
+#define WAYPOINT_V3_ASSET_PACK_H
+
+#include "utils/util_asset.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WAYPOINT_V3_ASSET_PACK_ENTRY_COUNT        (1)
+
+extern const T_UtilAssetPack g_waypointV3AssetPack;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -25,34 +25,40 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "file_binary_array_list_en.h"
+#include "widget_file_c/en_big_screen_assets.h"
 
-#include "widget_file_c/en_big_screen/icon_button1_png.h"
-#include "widget_file_c/en_big_screen/icon_button2_png.h"
-#include "widget_file_c/en_big_screen/icon_list_item1_png.h"
-#include "widget_file_c/en_big_screen/icon_list_item2_png.h"
-#include "widget_file_c/en_big_screen/icon_scale_png.h"
-#include "widget_file_c/en_big_screen/icon_switch_select_png.h"
-#include "widget_file_c/en_big_screen/icon_switch_unselect_png.h"
-#include "widget_file_c/en_big_screen/widget_config_json.h"
+#ifndef SYSTEM_ARCH_LINUX
 
 /* Private constants ---------------------------------------------------------*/
 
-/* Export types -------------------------------------------------------------*/
-// English language file binary array list
-static T_DjiWidgetFileBinaryArray s_EnWidgetFileBinaryArrayList[] = {
-    {widget_config_json_fileName, widget_config_json_fileSize, widget_config_json_fileBinaryArray},
-
-    {icon_button1_png_fileName, icon_button1_png_fileSize, icon_button1_png_fileBinaryArray},
-    {icon_button2_png_fileName, icon_button2_png_fileSize, icon_button2_png_fileBinaryArray},
-    {icon_list_item1_png_fileName, icon_list_item1_png_fileSize, icon_list_item1_png_fileBinaryArray},
-    {icon_list_item2_png_fileName, icon_list_item2_png_fileSize, icon_list_item2_png_fileBinaryArray},
-    {icon_scale_png_fileName, icon_scale_png_fileSize, icon_scale_png_fileBinaryArray},
-    {icon_switch_select_png_fileName, icon_switch_select_png_fileSize, icon_switch_select_png_fileBinaryArray},
-    {icon_switch_unselect_png_fileName, icon_switch_unselect_png_fileSize, icon_switch_unselect_png_fileBinaryArray}
-};
-
-/* Export values -------------------------------------------------------------*/
-uint32_t g_EnBinaryArrayCount = sizeof(s_EnWidgetFileBinaryArrayList) / sizeof(T_DjiWidgetFileBinaryArray);
-T_DjiWidgetFileBinaryArray * g_EnFileBinaryArrayList = s_EnWidgetFileBinaryArrayList;
+/* Private values -------------------------------------------------------------*/
+// English language file binary array list, filled from the asset pack on first use
+static T_DjiWidgetFileBinaryArray s_EnWidgetFileBinaryArrayList[WIDGET_EN_BIG_SCREEN_ASSET_PACK_ENTRY_COUNT];
+
+/* Exported functions definition ---------------------------------------------*/
+T_DjiReturnCode DjiTest_GetEnWidgetBinaryArrayConfig(T_DjiWidgetBinaryArrayConfig *config)
+{
+    T_DjiReturnCode returnCode;
+    const T_UtilAssetEntry *entry;
+    uint16_t i;
+
+    for (i = 0; i < g_widgetEnBigScreenAssetPack.entryCount; i++) {
+        entry = &g_widgetEnBigScreenAssetPack.entries[i];
+        returnCode = UtilAsset_GetData(&g_widgetEnBigScreenAssetPack, entry,
+                                       &s_EnWidgetFileBinaryArrayList[i].fileBinaryArray,
+                                       &s_EnWidgetFileBinaryArrayList[i].fileSize);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
+        s_EnWidgetFileBinaryArrayList[i].fileName = (char *) entry->name;
+    }
+
+    config->binaryArrayCount = g_widgetEnBigScreenAssetPack.entryCount;
+    config->fileBinaryArrayList = s_EnWidgetFileBinaryArrayList;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+#endif
 
 /****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -45,8 +45,12 @@ extern "C" {
 
 /* Exported functions --------------------------------------------------------*/
 
-extern uint32_t g_EnBinaryArrayCount;
-extern T_DjiWidgetFileBinaryArray * g_EnFileBinaryArrayList;
+/**
+ * @brief Get the english big screen ui config embedded for the rtos samples.
+ * @param config: pointer to the config to fill.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_GetEnWidgetBinaryArrayConfig(T_DjiWidgetBinaryArrayConfig *config);
 
 #ifdef __cplusplus
 }
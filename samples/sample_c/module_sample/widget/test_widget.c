@@ -31,35 +31,33 @@
 #include <stdio.h>
 #include "dji_sdk_config.h"
 #include "file_binary_array_list_en.h"
+#include "test_widget_floating_window.h"
+#include "test_widget_value_store.h"
 
 /* Private constants ---------------------------------------------------------*/
 #define WIDGET_DIR_PATH_LEN_MAX         (256)
-#define WIDGET_TASK_STACK_SIZE          (2048)
 
 /* Private types -------------------------------------------------------------*/
 
 /* Private functions declaration ---------------------------------------------*/
-static void *DjiTest_WidgetTask(void *arg);
-static T_DjiReturnCode DjiTestWidget_SetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t value,
-                                                    void *userData);
-static T_DjiReturnCode DjiTestWidget_GetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t *value,
-                                                    void *userData);
+static void DjiTestWidget_OnWidgetValueChange(uint32_t index, const T_DjiTestWidgetValue *value, void *userData);
 
 /* Private values ------------------------------------------------------------*/
-static T_DjiTaskHandle s_widgetTestThread;
 static bool s_isWidgetFileDirPathConfigured = false;
 static char s_widgetFileDirPath[DJI_FILE_PATH_SIZE_MAX] = {0};
 
+static T_DjiTestWidgetValueStore s_widgetValueStore;
+
 static const T_DjiWidgetHandlerListItem s_widgetHandlerList[] = {
-    {0, DJI_WIDGET_TYPE_BUTTON,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {1, DJI_WIDGET_TYPE_LIST,          DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {2, DJI_WIDGET_TYPE_SWITCH,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {3, DJI_WIDGET_TYPE_SCALE,         DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {4, DJI_WIDGET_TYPE_BUTTON,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {5, DJI_WIDGET_TYPE_SCALE,         DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {6, DJI_WIDGET_TYPE_INT_INPUT_BOX, DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {7, DJI_WIDGET_TYPE_SWITCH,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {8, DJI_WIDGET_TYPE_LIST,          DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
+    {0, DJI_WIDGET_TYPE_BUTTON,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {1, DJI_WIDGET_TYPE_LIST,          DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {2, DJI_WIDGET_TYPE_SWITCH,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {3, DJI_WIDGET_TYPE_SCALE,         DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {4, DJI_WIDGET_TYPE_BUTTON,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {5, DJI_WIDGET_TYPE_SCALE,         DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {6, DJI_WIDGET_TYPE_INT_INPUT_BOX, DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {7, DJI_WIDGET_TYPE_SWITCH,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {8, DJI_WIDGET_TYPE_LIST,          DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
 };
 
 static const char *s_widgetTypeNameArray[] = {
@@ -72,13 +70,11 @@ static const char *s_widgetTypeNameArray[] = {
 };
 
 static const uint32_t s_widgetHandlerListCount = sizeof(s_widgetHandlerList) / sizeof(T_DjiWidgetHandlerListItem);
-static int32_t s_widgetValueList[sizeof(s_widgetHandlerList) / sizeof(T_DjiWidgetHandlerListItem)] = {0};
 
 /* Exported functions definition ---------------------------------------------*/
 T_DjiReturnCode DjiTest_WidgetStartService(void)
 {
     T_DjiReturnCode djiStat;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
 
     //Step 1 : Init DJI Widget
     djiStat = DjiWidget_Init();
@@ -135,10 +131,13 @@ T_DjiReturnCode DjiTest_WidgetStartService(void)
     }
 #else
     //Step 2 : Set UI Config (RTOS environment)
-    T_DjiWidgetBinaryArrayConfig enWidgetBinaryArrayConfig = {
-        .binaryArrayCount = g_EnBinaryArrayCount,
-        .fileBinaryArrayList = g_EnFileBinaryArrayList
-    };
+    T_DjiWidgetBinaryArrayConfig enWidgetBinaryArrayConfig = {0};
+
+    djiStat = DjiTest_GetEnWidgetBinaryArrayConfig(&enWidgetBinaryArrayConfig);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Load widget ui config assets error, stat = 0x%08llX", djiStat);
+        return djiStat;
+    }
 
     //set default ui config
     djiStat = DjiWidget_RegDefaultUiConfigByBinaryArray(&enWidgetBinaryArrayConfig);
@@ -147,18 +146,26 @@ T_DjiReturnCode DjiTest_WidgetStartService(void)
         return djiStat;
     }
 #endif
-    //Step 3 : Set widget handler list
+    //Step 3 : Set widget handler list, the widget values are kept by the value store
+    djiStat = DjiTest_WidgetValueStoreInit(&s_widgetValueStore, s_widgetHandlerList, s_widgetHandlerListCount);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Init widget value store error, stat = 0x%08llX", djiStat);
+        return djiStat;
+    }
+    DjiTest_WidgetValueStoreRegObserver(&s_widgetValueStore, DJI_TEST_WIDGET_VALUE_STORE_ANY_INDEX,
+                                        DjiTestWidget_OnWidgetValueChange, NULL);
+
     djiStat = DjiWidget_RegHandlerList(s_widgetHandlerList, s_widgetHandlerListCount);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Set widget handler list error, stat = 0x%08llX", djiStat);
         return djiStat;
     }
 
-    //Step 4 : Run widget api sample task
-    if (osalHandler->TaskCreate("user_widget_task", DjiTest_WidgetTask, WIDGET_TASK_STACK_SIZE, NULL,
-                                &s_widgetTestThread) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Dji widget test task create error.");
-        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    //Step 4 : Run widget floating window task
+    djiStat = DjiTest_WidgetFloatingWindowStart(NULL, NULL);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Dji widget floating window start error, stat = 0x%08llX", djiStat);
+        return djiStat;
     }
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
@@ -175,77 +182,20 @@ T_DjiReturnCode DjiTest_WidgetSetConfigFilePath(const char *path)
 
 __attribute__((weak)) void DjiTest_WidgetLogAppend(const char *fmt, ...)
 {
+    va_list args;
 
+    va_start(args, fmt);
+    DjiTest_WidgetFloatingWindowAppendLogV(fmt, args);
+    va_end(args);
 }
 
-#ifndef __CC_ARM
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmissing-noreturn"
-#pragma GCC diagnostic ignored "-Wreturn-type"
-#pragma GCC diagnostic ignored "-Wformat"
-#endif
-
 /* Private functions definition-----------------------------------------------*/
-static void *DjiTest_WidgetTask(void *arg)
-{
-    char message[DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN];
-    uint32_t sysTimeMs = 0;
-    T_DjiReturnCode djiStat;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-
-    USER_UTIL_UNUSED(arg);
-
-    while (1) {
-        djiStat = osalHandler->GetTimeMs(&sysTimeMs);
-        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("Get system time ms error, stat = 0x%08llX", djiStat);
-        }
-
-#ifndef USER_FIRMWARE_MAJOR_VERSION
-        snprintf(message, DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN, "System time : %u ms", sysTimeMs);
-#else
-        snprintf(message, DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN,
-                 "System time : %u ms\r\nVersion: v%02d.%02d.%02d.%02d\r\nBuild time: %s %s", sysTimeMs,
-                 USER_FIRMWARE_MAJOR_VERSION, USER_FIRMWARE_MINOR_VERSION,
-                 USER_FIRMWARE_MODIFY_VERSION, USER_FIRMWARE_DEBUG_VERSION,
-                 __DATE__, __TIME__);
-#endif
-
-
-        djiStat = DjiWidgetFloatingWindow_ShowMessage(message);
-        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("Floating window show message error, stat = 0x%08llX", djiStat);
-        }
-
-        osalHandler->TaskSleepMs(1000);
-    }
-}
-
-#ifndef __CC_ARM
-#pragma GCC diagnostic pop
-#endif
-
-static T_DjiReturnCode DjiTestWidget_SetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t value,
-                                                    void *userData)
+static void DjiTestWidget_OnWidgetValueChange(uint32_t index, const T_DjiTestWidgetValue *value, void *userData)
 {
     USER_UTIL_UNUSED(userData);
 
     USER_LOG_INFO("Set widget value, widgetType = %s, widgetIndex = %d ,widgetValue = %d",
-                  s_widgetTypeNameArray[widgetType], index, value);
-    s_widgetValueList[index] = value;
-
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
-}
-
-static T_DjiReturnCode DjiTestWidget_GetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t *value,
-                                                    void *userData)
-{
-    USER_UTIL_UNUSED(userData);
-    USER_UTIL_UNUSED(widgetType);
-
-    *value = s_widgetValueList[index];
-
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+                  s_widgetTypeNameArray[value->type], index, value->value);
 }
 
 /****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
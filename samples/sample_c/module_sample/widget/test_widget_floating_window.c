@@ -0,0 +1,565 @@
+/**
+ ********************************************************************
+ * @file    test_widget_floating_window.c
+ * @brief   Floating window of the widget samples, showing the system time and the last lines of the widget log.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "test_widget_floating_window.h"
+#include "dji_widget.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "utils/util_misc.h"
+#include "dji_sdk_config.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define WIDGET_FLOATING_WINDOW_TASK_STACK_SIZE          (2048)
+#define WIDGET_FLOATING_WINDOW_STOP_TIMEOUT_MS          (2000)
+#define WIDGET_FLOATING_WINDOW_MIN_UPDATE_INTERVAL_MS   (200)
+#define WIDGET_FLOATING_WINDOW_REFRESH_INTERVAL_MS      (1000)
+#define WIDGET_LOG_RING_MASK                            (DJI_TEST_WIDGET_LOG_RING_SIZE - 1)
+#define WIDGET_LOG_READ_RETRY_TIMES                     (4)
+
+#define WIDGET_STRESS_TEST_WRITER_NUM_MAX               (8)
+#define WIDGET_STRESS_TEST_TASK_STACK_SIZE              (2048)
+#define WIDGET_STRESS_TEST_WRITER_BURST_LINES           (4)
+#define WIDGET_STRESS_TEST_SHOW_MESSAGE_TIME_MS         (2)
+
+/* Orders the slot sequence accesses against the copy of the line, the log is shared by tasks without locks. */
+#if defined(__CC_ARM)
+#define WIDGET_LOG_BARRIER()                            __dmb(0xF)
+#else
+#define WIDGET_LOG_BARRIER()                            __sync_synchronize()
+#endif
+
+/* Private types -------------------------------------------------------------*/
+/**
+ * @brief A line of the log ring. Appending takes a ticket from the ring head, the line of ticket t goes to slot
+ * t % DJI_TEST_WIDGET_LOG_RING_SIZE and its sequence is 2t + 1 while the line is written, 2t + 2 once it is complete.
+ * A reader only takes a line whose sequence is the complete value of its ticket before and after the copy.
+ */
+typedef struct {
+    volatile uint32_t sequence;
+    char content[DJI_TEST_WIDGET_LOG_LINE_SIZE_MAX];
+} T_DjiTestWidgetLogSlot;
+
+typedef struct {
+    uint32_t runIndex;
+    uint32_t writerCount;
+    uint32_t messageCount;
+    uint32_t tornLineCount;
+    uint32_t disorderedLineCount;
+    uint32_t lastLineIndex[WIDGET_STRESS_TEST_WRITER_NUM_MAX];
+    bool isLineSeen[WIDGET_STRESS_TEST_WRITER_NUM_MAX];
+} T_DjiTestWidgetStressTestMock;
+
+/* Private functions declaration ---------------------------------------------*/
+static void DjiTest_WidgetFloatingWindowAppendLog(const char *fmt, ...);
+static bool DjiTest_WidgetLogReadLine(uint32_t ticket, char *line);
+static void DjiTest_WidgetFloatingWindowRender(char *message, uint32_t messageSize);
+static void *DjiTest_WidgetFloatingWindowTask(void *arg);
+static T_DjiReturnCode DjiTest_WidgetStressTestShowMessage(const char *str);
+static void *DjiTest_WidgetStressTestWriterTask(void *arg);
+
+/* Private variables ---------------------------------------------------------*/
+static T_DjiTestWidgetLogSlot s_widgetLogRing[DJI_TEST_WIDGET_LOG_RING_SIZE];
+static volatile uint32_t s_widgetLogTicket = 0;
+static volatile uint32_t s_widgetLogCommitCount = 0;
+static volatile uint32_t s_widgetLogDroppedCount = 0;
+
+static T_DjiTestWidgetFloatingWindowConfig s_floatingWindowConfig;
+static T_DjiTestWidgetFloatingWindowBackend s_floatingWindowBackend;
+static T_DjiTestWidgetFloatingWindowStatistics s_floatingWindowStatistics;
+static char s_floatingWindowLastMessage[DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN];
+static T_DjiSemaHandle s_floatingWindowSema = NULL;
+static T_DjiSemaHandle s_floatingWindowStopSema = NULL;
+static T_DjiTaskHandle s_floatingWindowThread = NULL;
+static volatile bool s_isFloatingWindowStopping = false;
+static volatile uint32_t s_isFloatingWindowWakePending = 0;
+static volatile uint32_t s_floatingWindowPostingCount = 0;
+
+static T_DjiTestWidgetStressTestMock s_widgetStressTestMock;
+static T_DjiSemaHandle s_widgetStressTestDoneSema = NULL;
+static volatile bool s_isWidgetStressTestStopping = false;
+static uint32_t s_widgetStressTestRunCount = 0;
+
+static const T_DjiTestWidgetFloatingWindowConfig s_floatingWindowDefaultConfig = {
+    .minUpdateIntervalMs = WIDGET_FLOATING_WINDOW_MIN_UPDATE_INTERVAL_MS,
+    .refreshIntervalMs = WIDGET_FLOATING_WINDOW_REFRESH_INTERVAL_MS,
+};
+
+static const T_DjiTestWidgetFloatingWindowBackend s_floatingWindowDefaultBackend = {
+    .ShowMessage = DjiWidgetFloatingWindow_ShowMessage,
+};
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Append a line to the widget log, callable from any task and before the floating window is started.
+ * @note The line is formatted in place in the ring without allocation or lock. It is dropped if a writer still holds
+ * its slot, which needs DJI_TEST_WIDGET_LOG_RING_SIZE lines appended while that writer formats its own.
+ * @param fmt: format of the line, the line is truncated to DJI_TEST_WIDGET_LOG_LINE_SIZE_MAX - 1 characters.
+ * @param args: arguments of the format.
+ */
+void DjiTest_WidgetFloatingWindowAppendLogV(const char *fmt, va_list args)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t ticket = __sync_fetch_and_add(&s_widgetLogTicket, 1);
+    T_DjiTestWidgetLogSlot *slot = &s_widgetLogRing[ticket & WIDGET_LOG_RING_MASK];
+    uint32_t sequence = slot->sequence;
+    T_DjiSemaHandle sema;
+
+    if ((sequence & 1) != 0 || (int32_t) (sequence - (ticket * 2 + 1)) > 0 ||
+        !__sync_bool_compare_and_swap(&slot->sequence, sequence, ticket * 2 + 1)) {
+        __sync_fetch_and_add(&s_widgetLogDroppedCount, 1);
+        return;
+    }
+
+    WIDGET_LOG_BARRIER();
+    vsnprintf(slot->content, sizeof(slot->content), fmt, args);
+    WIDGET_LOG_BARRIER();
+    slot->sequence = ticket * 2 + 2;
+    __sync_fetch_and_add(&s_widgetLogCommitCount, 1);
+
+    // Stop waits for the appenders counted here before it destroys the semaphore they may post.
+    __sync_fetch_and_add(&s_floatingWindowPostingCount, 1);
+    sema = s_floatingWindowSema;
+    if (sema != NULL && __sync_lock_test_and_set(&s_isFloatingWindowWakePending, 1) == 0) {
+        osalHandler->SemaphorePost(sema);
+    }
+    __sync_fetch_and_sub(&s_floatingWindowPostingCount, 1);
+}
+
+/**
+ * @brief Start the task updating the floating window, it only sends a message when its content changed.
+ * @param config: update rate, NULL selects a 200 ms coalescing interval and a 1 s system time refresh.
+ * @param backend: floating window calls to use, NULL selects the DjiWidgetFloatingWindow interface.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WidgetFloatingWindowStart(const T_DjiTestWidgetFloatingWindowConfig *config,
+                                                  const T_DjiTestWidgetFloatingWindowBackend *backend)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+
+    if (s_floatingWindowThread != NULL) {
+        USER_LOG_ERROR("Widget floating window is already running.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    s_floatingWindowConfig = config != NULL ? *config : s_floatingWindowDefaultConfig;
+    s_floatingWindowBackend = backend != NULL ? *backend : s_floatingWindowDefaultBackend;
+    memset(&s_floatingWindowStatistics, 0, sizeof(s_floatingWindowStatistics));
+    memset(s_floatingWindowLastMessage, 0, sizeof(s_floatingWindowLastMessage));
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_floatingWindowStopSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget floating window semaphore create error: 0x%08llX.", returnCode);
+        return returnCode;
+    }
+    returnCode = osalHandler->SemaphoreCreate(0, &s_floatingWindowSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget floating window semaphore create error: 0x%08llX.", returnCode);
+        goto destroyStopSema;
+    }
+
+    s_isFloatingWindowStopping = false;
+    s_isFloatingWindowWakePending = 0;
+    returnCode = osalHandler->TaskCreate("widget_window", DjiTest_WidgetFloatingWindowTask,
+                                         WIDGET_FLOATING_WINDOW_TASK_STACK_SIZE, NULL, &s_floatingWindowThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget floating window task create error: 0x%08llX.", returnCode);
+        goto destroySema;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+destroySema:
+    osalHandler->SemaphoreDestroy(s_floatingWindowSema);
+    s_floatingWindowSema = NULL;
+destroyStopSema:
+    osalHandler->SemaphoreDestroy(s_floatingWindowStopSema);
+    s_floatingWindowStopSema = NULL;
+    s_floatingWindowThread = NULL;
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_WidgetFloatingWindowStop(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    T_DjiSemaHandle sema = s_floatingWindowSema;
+
+    if (s_floatingWindowThread == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    s_isFloatingWindowStopping = true;
+    osalHandler->SemaphorePost(sema);
+    if (osalHandler->SemaphoreTimedWait(s_floatingWindowStopSema, WIDGET_FLOATING_WINDOW_STOP_TIMEOUT_MS) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Wait widget floating window task timeout.");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    osalHandler->TaskDestroy(s_floatingWindowThread);
+    s_floatingWindowThread = NULL;
+
+    s_floatingWindowSema = NULL;
+    WIDGET_LOG_BARRIER();
+    while (s_floatingWindowPostingCount != 0) {
+        osalHandler->TaskSleepMs(1);
+    }
+    osalHandler->SemaphoreDestroy(sema);
+    osalHandler->SemaphoreDestroy(s_floatingWindowStopSema);
+    s_floatingWindowStopSema = NULL;
+
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_WidgetFloatingWindowGetStatistics(T_DjiTestWidgetFloatingWindowStatistics *statistics)
+{
+    if (statistics == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    *statistics = s_floatingWindowStatistics;
+    statistics->appendedLineCount = s_widgetLogCommitCount;
+    statistics->droppedLineCount = s_widgetLogDroppedCount;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Run writer tasks appending log lines as fast as they can against a mocked floating window, which checks
+ * that every line it receives is complete and in order and that no more messages are sent than the update interval
+ * allows. The message count is compared with the system time refresh alone, the rate of the former polling task. A
+ * running floating window is restarted afterwards.
+ * @param writerCount: number of writer tasks, up to 8.
+ * @param durationMs: duration of the test.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WidgetFloatingWindowRunStressTest(uint8_t writerCount, uint32_t durationMs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    const T_DjiTestWidgetFloatingWindowConfig *config = &s_floatingWindowDefaultConfig;
+    T_DjiTestWidgetFloatingWindowConfig savedConfig = s_floatingWindowConfig;
+    T_DjiTestWidgetFloatingWindowBackend savedBackend = s_floatingWindowBackend;
+    T_DjiTestWidgetFloatingWindowBackend mockBackend = {.ShowMessage = DjiTest_WidgetStressTestShowMessage};
+    T_DjiTestWidgetFloatingWindowStatistics statistics;
+    T_DjiTaskHandle writerThreads[WIDGET_STRESS_TEST_WRITER_NUM_MAX];
+    bool isFloatingWindowRunning = s_floatingWindowThread != NULL;
+    uint32_t appendedLineCount = s_widgetLogCommitCount;
+    uint32_t droppedLineCount = s_widgetLogDroppedCount;
+    uint32_t startMs = 0;
+    uint32_t stopMs = 0;
+    uint32_t maxMessageCount;
+    uint32_t refreshMessageCount;
+    T_DjiReturnCode returnCode;
+    uint8_t createdWriterCount;
+    uint8_t i;
+
+    if (writerCount == 0 || writerCount > WIDGET_STRESS_TEST_WRITER_NUM_MAX) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (isFloatingWindowRunning) {
+        DjiTest_WidgetFloatingWindowStop();
+    }
+
+    memset(&s_widgetStressTestMock, 0, sizeof(s_widgetStressTestMock));
+    s_widgetStressTestMock.runIndex = ++s_widgetStressTestRunCount;
+    s_widgetStressTestMock.writerCount = writerCount;
+    returnCode = osalHandler->SemaphoreCreate(0, &s_widgetStressTestDoneSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget stress test semaphore create error: 0x%08llX.", returnCode);
+        goto restart;
+    }
+
+    osalHandler->GetTimeMs(&startMs);
+    returnCode = DjiTest_WidgetFloatingWindowStart(config, &mockBackend);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        goto destroySema;
+    }
+
+    s_isWidgetStressTestStopping = false;
+    for (i = 0; i < writerCount; i++) {
+        returnCode = osalHandler->TaskCreate("widget_writer", DjiTest_WidgetStressTestWriterTask,
+                                             WIDGET_STRESS_TEST_TASK_STACK_SIZE, (void *) (uintptr_t) i,
+                                             &writerThreads[i]);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Widget stress test writer task create error: 0x%08llX.", returnCode);
+            break;
+        }
+    }
+
+    if (i == writerCount) {
+        osalHandler->TaskSleepMs(durationMs);
+    }
+
+    s_isWidgetStressTestStopping = true;
+    for (createdWriterCount = i; i > 0; i--) {
+        osalHandler->SemaphoreWait(s_widgetStressTestDoneSema);
+    }
+    for (i = 0; i < createdWriterCount; i++) {
+        osalHandler->TaskDestroy(writerThreads[i]);
+    }
+
+    /* Let the window send the last lines before it is stopped. */
+    osalHandler->TaskSleepMs(config->minUpdateIntervalMs * 2);
+    DjiTest_WidgetFloatingWindowGetStatistics(&statistics);
+    DjiTest_WidgetFloatingWindowStop();
+    osalHandler->GetTimeMs(&stopMs);
+
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        /* The first message is sent right away, then at most one per interval until the window is stopped. */
+        maxMessageCount = (stopMs - startMs) / config->minUpdateIntervalMs + 1;
+        refreshMessageCount = config->refreshIntervalMs != 0 ? durationMs / config->refreshIntervalMs : 0;
+        USER_LOG_INFO("Widget floating window stress test in %u ms: %d writers appended %u lines (%u dropped), "
+                      "%u messages sent (at most %u), the %u ms refresh alone sends %u, %u torn lines, %u lines "
+                      "out of order.", durationMs, writerCount, statistics.appendedLineCount - appendedLineCount,
+                      statistics.droppedLineCount - droppedLineCount, statistics.messageCount, maxMessageCount,
+                      config->refreshIntervalMs, refreshMessageCount, s_widgetStressTestMock.tornLineCount,
+                      s_widgetStressTestMock.disorderedLineCount);
+        if (s_widgetStressTestMock.tornLineCount != 0 || s_widgetStressTestMock.disorderedLineCount != 0 ||
+            statistics.messageCount > maxMessageCount) {
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+        }
+    }
+
+destroySema:
+    osalHandler->SemaphoreDestroy(s_widgetStressTestDoneSema);
+    s_widgetStressTestDoneSema = NULL;
+restart:
+    if (isFloatingWindowRunning) {
+        DjiTest_WidgetFloatingWindowStart(&savedConfig, &savedBackend);
+    }
+
+    return returnCode;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void DjiTest_WidgetFloatingWindowAppendLog(const char *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    DjiTest_WidgetFloatingWindowAppendLogV(fmt, args);
+    va_end(args);
+}
+
+static bool DjiTest_WidgetLogReadLine(uint32_t ticket, char *line)
+{
+    const T_DjiTestWidgetLogSlot *slot = &s_widgetLogRing[ticket & WIDGET_LOG_RING_MASK];
+    uint32_t sequence;
+    uint8_t retry;
+
+    for (retry = 0; retry < WIDGET_LOG_READ_RETRY_TIMES; retry++) {
+        sequence = slot->sequence;
+        if (sequence != ticket * 2 + 2) {
+            /* Still written, its commit makes the window dirty again, or already overwritten by a newer line. */
+            return false;
+        }
+        WIDGET_LOG_BARRIER();
+        memcpy(line, slot->content, DJI_TEST_WIDGET_LOG_LINE_SIZE_MAX);
+        WIDGET_LOG_BARRIER();
+        if (slot->sequence == sequence) {
+            line[DJI_TEST_WIDGET_LOG_LINE_SIZE_MAX - 1] = '\0';
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void DjiTest_WidgetFloatingWindowRender(char *message, uint32_t messageSize)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    char line[DJI_TEST_WIDGET_LOG_LINE_SIZE_MAX];
+    uint32_t sysTimeMs = 0;
+    uint32_t ticket;
+    uint32_t head;
+    int length = 0;
+
+    message[0] = '\0';
+    if (s_floatingWindowConfig.refreshIntervalMs != 0) {
+        osalHandler->GetTimeMs(&sysTimeMs);
+        length += snprintf(message, messageSize, "System time : %u ms", sysTimeMs);
+    }
+#ifdef USER_FIRMWARE_MAJOR_VERSION
+    length += snprintf(message + length, messageSize - length, "%sVersion: v%02d.%02d.%02d.%02d\r\nBuild time: %s %s",
+                       length != 0 ? "\r\n" : "", USER_FIRMWARE_MAJOR_VERSION, USER_FIRMWARE_MINOR_VERSION,
+                       USER_FIRMWARE_MODIFY_VERSION, USER_FIRMWARE_DEBUG_VERSION, __DATE__, __TIME__);
+#endif
+
+    head = s_widgetLogTicket;
+    WIDGET_LOG_BARRIER();
+    ticket = head > DJI_TEST_WIDGET_LOG_DISPLAY_LINE_NUM ? head - DJI_TEST_WIDGET_LOG_DISPLAY_LINE_NUM : 0;
+    for (; ticket != head && length < (int) messageSize - 1; ticket++) {
+        if (DjiTest_WidgetLogReadLine(ticket, line)) {
+            length += snprintf(message + length, messageSize - length, "%s%s", length != 0 ? "\r\n" : "", line);
+        }
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-noreturn"
+#pragma GCC diagnostic ignored "-Wreturn-type"
+#endif
+
+static void *DjiTest_WidgetFloatingWindowTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    char message[DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN];
+    uint32_t renderedCommitCount = 0;
+    uint32_t commitCount;
+    uint32_t lastUpdateMs = 0;
+    uint32_t nowMs = 0;
+    uint32_t elapsedMs;
+    uint32_t waitMs;
+    bool isRendered = false;
+    bool isDirty;
+    T_DjiReturnCode returnCode;
+
+    USER_UTIL_UNUSED(arg);
+
+    while (s_isFloatingWindowStopping == false) {
+        /* Cleared before the commit count is read, so a line committed from now on posts the semaphore again. */
+        __sync_lock_release(&s_isFloatingWindowWakePending);
+        WIDGET_LOG_BARRIER();
+        commitCount = s_widgetLogCommitCount;
+        osalHandler->GetTimeMs(&nowMs);
+        elapsedMs = nowMs - lastUpdateMs;
+
+        isDirty = isRendered == false || commitCount != renderedCommitCount ||
+                  (s_floatingWindowConfig.refreshIntervalMs != 0 &&
+                   elapsedMs >= s_floatingWindowConfig.refreshIntervalMs);
+
+        if (isDirty && (isRendered == false || elapsedMs >= s_floatingWindowConfig.minUpdateIntervalMs)) {
+            DjiTest_WidgetFloatingWindowRender(message, sizeof(message));
+            s_floatingWindowStatistics.renderCount++;
+            renderedCommitCount = commitCount;
+            lastUpdateMs = nowMs;
+            isRendered = true;
+
+            if (strcmp(message, s_floatingWindowLastMessage) != 0) {
+                returnCode = s_floatingWindowBackend.ShowMessage(message);
+                if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                    USER_LOG_ERROR("Floating window show message error, stat = 0x%08llX", returnCode);
+                    s_floatingWindowStatistics.messageErrorCount++;
+                } else {
+                    s_floatingWindowStatistics.messageCount++;
+                    strcpy(s_floatingWindowLastMessage, message);
+                }
+            }
+            continue;
+        }
+
+        if (isDirty) {
+            waitMs = s_floatingWindowConfig.minUpdateIntervalMs - elapsedMs;
+        } else if (s_floatingWindowConfig.refreshIntervalMs != 0) {
+            waitMs = s_floatingWindowConfig.refreshIntervalMs - elapsedMs;
+        } else {
+            osalHandler->SemaphoreWait(s_floatingWindowSema);
+            continue;
+        }
+        osalHandler->SemaphoreTimedWait(s_floatingWindowSema, waitMs);
+    }
+
+    osalHandler->SemaphorePost(s_floatingWindowStopSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+static void *DjiTest_WidgetStressTestWriterTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t writerIndex = (uint32_t) (uintptr_t) arg;
+    uint32_t lineIndex = 0;
+
+    while (s_isWidgetStressTestStopping == false) {
+        DjiTest_WidgetFloatingWindowAppendLog("run %u writer %u line %u", s_widgetStressTestMock.runIndex,
+                                              writerIndex, lineIndex);
+        lineIndex++;
+        if (lineIndex % WIDGET_STRESS_TEST_WRITER_BURST_LINES == 0) {
+            osalHandler->TaskSleepMs(1);
+        }
+    }
+
+    osalHandler->SemaphorePost(s_widgetStressTestDoneSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
+static T_DjiReturnCode DjiTest_WidgetStressTestShowMessage(const char *str)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    bool isLineSeen[WIDGET_STRESS_TEST_WRITER_NUM_MAX] = {0};
+    uint32_t lineIndex[WIDGET_STRESS_TEST_WRITER_NUM_MAX];
+    const char *line = str;
+    const char *lineEnd;
+    uint32_t runIndex;
+    uint32_t writerIndex;
+    uint32_t index;
+    int consumed;
+
+    for (; line != NULL; line = lineEnd != NULL ? lineEnd + 2 : NULL) {
+        lineEnd = strstr(line, "\r\n");
+        /* The ring may still hold the lines of a previous run or of other tasks when the test starts. */
+        if (strncmp(line, "run ", strlen("run ")) != 0 ||
+            (sscanf(line, "run %u ", &runIndex) == 1 && runIndex != s_widgetStressTestMock.runIndex)) {
+            continue;
+        }
+
+        consumed = 0;
+        if (sscanf(line, "run %u writer %u line %u%n", &runIndex, &writerIndex, &index, &consumed) != 3 ||
+            line + consumed != (lineEnd != NULL ? lineEnd : line + strlen(line)) ||
+            writerIndex >= s_widgetStressTestMock.writerCount) {
+            s_widgetStressTestMock.tornLineCount++;
+            continue;
+        }
+
+        /* Lines of a writer are shown in order within a message and never go back across messages. */
+        if ((isLineSeen[writerIndex] && index <= lineIndex[writerIndex]) ||
+            (s_widgetStressTestMock.isLineSeen[writerIndex] &&
+             index < s_widgetStressTestMock.lastLineIndex[writerIndex])) {
+            s_widgetStressTestMock.disorderedLineCount++;
+        }
+        isLineSeen[writerIndex] = true;
+        lineIndex[writerIndex] = index;
+        s_widgetStressTestMock.isLineSeen[writerIndex] = true;
+        s_widgetStressTestMock.lastLineIndex[writerIndex] = index;
+    }
+
+    s_widgetStressTestMock.messageCount++;
+    osalHandler->TaskSleepMs(WIDGET_STRESS_TEST_SHOW_MESSAGE_TIME_MS);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
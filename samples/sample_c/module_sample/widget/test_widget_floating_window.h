@@ -0,0 +1,84 @@
+/**
+ ********************************************************************
+ * @file    test_widget_floating_window.h
+ * @brief   This is the header file for "test_widget_floating_window.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_WIDGET_FLOATING_WINDOW_H
+#define TEST_WIDGET_FLOATING_WINDOW_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdarg.h>
+#include "dji_typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_TEST_WIDGET_LOG_LINE_SIZE_MAX           (40)
+#define DJI_TEST_WIDGET_LOG_DISPLAY_LINE_NUM        (5)
+/* Lines kept by the log ring, a power of two larger than the displayed lines so slow writers are not overtaken. */
+#define DJI_TEST_WIDGET_LOG_RING_SIZE               (16)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Floating window calls going over the link, the DjiWidgetFloatingWindow interface by default, replaced by a
+ * mock in the stress test.
+ */
+typedef struct {
+    T_DjiReturnCode (*ShowMessage)(const char *str);
+} T_DjiTestWidgetFloatingWindowBackend;
+
+/**
+ * @brief Update rate of the floating window. New log lines are coalesced into at most one message per
+ * minUpdateIntervalMs, the system time line is refreshed every refreshIntervalMs, 0 removes it from the message so
+ * that it is only sent for new log lines.
+ */
+typedef struct {
+    uint32_t minUpdateIntervalMs;
+    uint32_t refreshIntervalMs;
+} T_DjiTestWidgetFloatingWindowConfig;
+
+typedef struct {
+    uint32_t appendedLineCount;
+    uint32_t droppedLineCount;
+    uint32_t renderCount;
+    uint32_t messageCount;
+    uint32_t messageErrorCount;
+} T_DjiTestWidgetFloatingWindowStatistics;
+
+/* Exported functions --------------------------------------------------------*/
+void DjiTest_WidgetFloatingWindowAppendLogV(const char *fmt, va_list args);
+T_DjiReturnCode DjiTest_WidgetFloatingWindowStart(const T_DjiTestWidgetFloatingWindowConfig *config,
+                                                  const T_DjiTestWidgetFloatingWindowBackend *backend);
+T_DjiReturnCode DjiTest_WidgetFloatingWindowStop(void);
+T_DjiReturnCode DjiTest_WidgetFloatingWindowGetStatistics(T_DjiTestWidgetFloatingWindowStatistics *statistics);
+T_DjiReturnCode DjiTest_WidgetFloatingWindowRunStressTest(uint8_t writerCount, uint32_t durationMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_WIDGET_FLOATING_WINDOW_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
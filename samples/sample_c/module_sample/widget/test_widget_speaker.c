@@ -24,6 +24,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "test_widget_speaker.h"
+#include "test_widget_speaker_sink.h"
 #include "dji_logger.h"
 #include <stdlib.h>
 #include <errno.h>
@@ -31,6 +32,7 @@
 #include <stdio.h>
 #include "utils/util_misc.h"
 #include "utils/util_md5.h"
+#include "utils/util_buffer.h"
 #include <dji_aircraft_info.h>
 
 #ifdef OPUS_INSTALLED
@@ -42,15 +44,10 @@
 /* Private constants ---------------------------------------------------------*/
 #define WIDGET_SPEAKER_TASK_STACK_SIZE          (2048)
 
-/*! Attention: replace your audio device name here. */
-#define WIDGET_SPEAKER_USB_AUDIO_DEVICE_NAME    "alsa_output.usb-C-Media_Electronics_Inc._USB_Audio_Device-00.analog-stereo"
-
-#define WIDGET_SPEAKER_AUDIO_OPUS_FILE_NAME     "test_audio.opus"
-#define WIDGET_SPEAKER_AUDIO_PCM_FILE_NAME      "test_audio.pcm"
-
 #define WIDGET_SPEAKER_TTS_FILE_NAME            "test_tts.txt"
 #define WIDGET_SPEAKER_TTS_OUTPUT_FILE_NAME     "tts_audio.wav"
 #define WIDGET_SPEAKER_TTS_FILE_MAX_SIZE        (3000)
+#define WIDGET_SPEAKER_TTS_WAV_HEADER_SIZE      (44)
 
 /* The frame size is hardcoded for this sample code but it doesn't have to be */
 #define WIDGET_SPEAKER_AUDIO_OPUS_MAX_PACKET_SIZE          (3 * 1276)
@@ -61,11 +58,50 @@
 #define WIDGET_SPEAKER_AUDIO_OPUS_DECODE_FRAME_SIZE_8KBPS  (40)
 #define WIDGET_SPEAKER_AUDIO_OPUS_DECODE_BITRATE_8KBPS     (8000)
 
+/* Received voice is kept in memory so it can be decoded while transmitting and replayed in loop mode. */
+#define WIDGET_SPEAKER_VOICE_CLIP_MAX_SIZE      (4 * 1024 * 1024)
+/* About one second of decoded audio between the decoder and the sink, must be a power of two. */
+#define WIDGET_SPEAKER_PCM_RING_BUFFER_SIZE     (32 * 1024)
+#define WIDGET_SPEAKER_SINK_PERIOD_FRAMES       (320)
+#define WIDGET_SPEAKER_LOOP_PLAY_INTERVAL_MS    (1000)
+
+/*! Attention: use DJI_TEST_WIDGET_SPEAKER_SINK_NULL or DJI_TEST_WIDGET_SPEAKER_SINK_FILE to test without audio device. */
+#ifdef ALSA_INSTALLED
+#define WIDGET_SPEAKER_SINK_TYPE                DJI_TEST_WIDGET_SPEAKER_SINK_ALSA
+#else
+#define WIDGET_SPEAKER_SINK_TYPE                DJI_TEST_WIDGET_SPEAKER_SINK_FILE
+#endif
+
 /* The speaker initialization parameters */
 #define WIDGET_SPEAKER_DEFAULT_VOLUME                (60)
 #define EKHO_INSTALLED                               (1)
 
 /* Private types -------------------------------------------------------------*/
+#ifdef SYSTEM_ARCH_LINUX
+typedef struct {
+    uint8_t *data;
+    uint32_t size;
+    uint32_t capacity;
+    bool isComplete;
+    MD5_CTX md5Ctx;
+} T_DjiTestSpeakerVoiceClip;
+
+typedef struct {
+    /* Owned by the speaker task. */
+    bool isActive;
+    bool isLoopWaiting;
+    uint32_t nextStartTimeMs;
+    E_DjiWidgetSpeakerWorkMode source;
+    uint32_t decodeOffset;
+    FILE *ttsAudioFile;
+    /* Shared with the sink task and the widget callbacks, protected by s_audioMutex. */
+    bool isRestartRequested;
+    bool isDropRequested;
+    bool isSourceEnd;
+    uint32_t sessionId;
+    uint32_t drainedSessionId;
+} T_DjiTestSpeakerPlayback;
+#endif
 
 /* Private values -------------------------------------------------------------*/
 static T_DjiWidgetSpeakerHandler s_speakerHandler = {0};
@@ -73,11 +109,26 @@ static T_DjiMutexHandle s_speakerMutex = {0};
 static T_DjiWidgetSpeakerState s_speakerState = {0};
 static T_DjiTaskHandle s_widgetSpeakerTestThread;
 
-static FILE *s_audioFile = NULL;
 static FILE *s_ttsFile = NULL;
-static bool s_isDecodeFinished = true;
 static uint16_t s_decodeBitrate = 0;
 
+#ifdef SYSTEM_ARCH_LINUX
+static T_DjiTaskHandle s_widgetSpeakerSinkThread;
+static T_DjiMutexHandle s_audioMutex;
+static T_DjiSemaHandle s_decodeSema;
+static T_DjiSemaHandle s_sinkSema;
+static const T_DjiTestWidgetSpeakerSink *s_speakerSink = NULL;
+static T_DjiTestSpeakerVoiceClip s_voiceClip = {0};
+static T_DjiTestSpeakerPlayback s_playback = {0};
+static T_UtilBuffer s_pcmRingBuffer;
+static uint8_t s_pcmRingBufferData[WIDGET_SPEAKER_PCM_RING_BUFFER_SIZE];
+static volatile float s_volumeGain = 1.0f;
+#endif
+
+#ifdef OPUS_INSTALLED
+static OpusDecoder *s_opusDecoder = NULL;
+#endif
+
 /* Private functions declaration ---------------------------------------------*/
 static void SetSpeakerState(E_DjiWidgetSpeakerState speakerState);
 static T_DjiReturnCode GetSpeakerState(T_DjiWidgetSpeakerState *speakerState);
@@ -92,11 +143,20 @@ static T_DjiReturnCode ReceiveAudioData(E_DjiWidgetTransmitDataEvent event,
                                         uint32_t offset, uint8_t *buf, uint16_t size);
 #ifdef SYSTEM_ARCH_LINUX
 static void *DjiTest_WidgetSpeakerTask(void *arg);
-static uint32_t DjiTest_GetVoicePlayProcessId(void);
-static uint32_t DjiTest_KillVoicePlayProcess(uint32_t pid);
-static T_DjiReturnCode DjiTest_DecodeAudioData(void);
-static T_DjiReturnCode DjiTest_PlayAudioData(void);
-static T_DjiReturnCode DjiTest_PlayTtsData(void);
+static void *DjiTest_WidgetSpeakerSinkTask(void *arg);
+static T_DjiReturnCode DjiTest_InitAudioPipeline(void);
+static void DjiTest_ResetVoiceClip(void);
+static T_DjiReturnCode DjiTest_AppendVoiceClip(uint32_t offset, const uint8_t *buf, uint16_t size);
+static T_DjiReturnCode DjiTest_FinishVoiceClip(const uint8_t *md5Sum, uint16_t size);
+static void DjiTest_RequestPlaybackRestart(void);
+static T_DjiReturnCode DjiTest_StartPlayback(E_DjiWidgetSpeakerWorkMode workMode);
+static void DjiTest_StopPlayback(bool isDropNeeded);
+static bool DjiTest_IsPlaybackFinished(void);
+static void DjiTest_FillPcmRingBuffer(void);
+static T_DjiReturnCode DjiTest_DecodeVoiceFrame(int16_t *pcm, uint32_t *frameCount, bool *isSourceEnd);
+static T_DjiReturnCode DjiTest_ReadTtsFrame(int16_t *pcm, uint32_t *frameCount, bool *isSourceEnd);
+static T_DjiReturnCode DjiTest_ConvertTtsData(void);
+static void DjiTest_ApplyVolume(int16_t *samples, uint32_t sampleCount);
 static T_DjiReturnCode DjiTest_CheckFileMd5Sum(const char *path, uint8_t *buf, uint16_t size);
 #endif
 
@@ -121,6 +181,15 @@ T_DjiReturnCode DjiTest_WidgetSpeakerStartService(void)
         return returnCode;
     }
 
+#ifdef SYSTEM_ARCH_LINUX
+    /* The pipeline has to exist before the handler is registered, voice data may arrive right after. */
+    returnCode = DjiTest_InitAudioPipeline();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Init speaker audio pipeline error: 0x%08llX", returnCode);
+        return returnCode;
+    }
+#endif
+
     returnCode = DjiWidget_RegSpeakerHandler(&s_speakerHandler);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Register speaker handler error: 0x%08llX", returnCode);
@@ -156,6 +225,13 @@ T_DjiReturnCode DjiTest_WidgetSpeakerStartService(void)
         USER_LOG_ERROR("Dji widget speaker test task create error.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
     }
+
+    if (osalHandler->TaskCreate("user_widget_speaker_sink_task", DjiTest_WidgetSpeakerSinkTask,
+                                WIDGET_SPEAKER_TASK_STACK_SIZE, NULL,
+                                &s_widgetSpeakerSinkThread) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Dji widget speaker sink task create error.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    }
 #endif
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
@@ -164,210 +240,411 @@ T_DjiReturnCode DjiTest_WidgetSpeakerStartService(void)
 /* Private functions definition-----------------------------------------------*/
 #ifdef SYSTEM_ARCH_LINUX
 
-static uint32_t DjiTest_GetVoicePlayProcessId(void)
+static T_DjiReturnCode DjiTest_InitAudioPipeline(void)
 {
-    FILE *fp;
-    char cmdStr[128];
-    uint32_t pid;
-    int ret;
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+#ifdef OPUS_INSTALLED
+    int32_t err;
+#endif
 
-    snprintf(cmdStr, 128, "pgrep ffplay");
-    fp = popen(cmdStr, "r");
-    if (fp == NULL) {
-        USER_LOG_ERROR("fp is null.");
-        return 0;
+    returnCode = osalHandler->MutexCreate(&s_audioMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create speaker audio mutex error: 0x%08llX", returnCode);
+        return returnCode;
     }
 
-    ret = fscanf(fp, "%u", &pid);
-    if (ret <= 0) {
-        pid = 0;
+    returnCode = osalHandler->SemaphoreCreate(0, &s_decodeSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create speaker decode semaphore error: 0x%08llX", returnCode);
+        return returnCode;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_sinkSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create speaker sink semaphore error: 0x%08llX", returnCode);
+        return returnCode;
+    }
+
+    UtilBuffer_Init(&s_pcmRingBuffer, s_pcmRingBufferData, sizeof(s_pcmRingBufferData));
+    DjiTest_ResetVoiceClip();
+
+#ifdef OPUS_INSTALLED
+    s_opusDecoder = opus_decoder_create(WIDGET_SPEAKER_AUDIO_OPUS_SAMPLE_RATE, WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS,
+                                        &err);
+    if (err < 0) {
+        USER_LOG_ERROR("Create opus decoder error: %s", opus_strerror(err));
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+#endif
+
+    s_speakerSink = DjiTest_WidgetSpeakerGetSink(WIDGET_SPEAKER_SINK_TYPE);
+    if (s_speakerSink == NULL ||
+        s_speakerSink->Open(WIDGET_SPEAKER_AUDIO_OPUS_SAMPLE_RATE, WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_WARN("Open speaker sink %d failed, audio will be discarded.", WIDGET_SPEAKER_SINK_TYPE);
+        s_speakerSink = DjiTest_WidgetSpeakerGetSink(DJI_TEST_WIDGET_SPEAKER_SINK_NULL);
+        s_speakerSink->Open(WIDGET_SPEAKER_AUDIO_OPUS_SAMPLE_RATE, WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS);
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void DjiTest_ResetVoiceClip(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    osalHandler->MutexLock(s_audioMutex);
+    s_voiceClip.size = 0;
+    s_voiceClip.isComplete = false;
+    UtilMd5_Init(&s_voiceClip.md5Ctx);
+    osalHandler->MutexUnlock(s_audioMutex);
+}
+
+static T_DjiReturnCode DjiTest_AppendVoiceClip(uint32_t offset, const uint8_t *buf, uint16_t size)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    uint32_t capacity;
+    uint8_t *data;
+
+    osalHandler->MutexLock(s_audioMutex);
+    if (offset != s_voiceClip.size) {
+        USER_LOG_ERROR("Voice data is not continuous, expect offset %d but %d.", s_voiceClip.size, offset);
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
         goto out;
     }
 
+    if (s_voiceClip.size + size > s_voiceClip.capacity) {
+        if (s_voiceClip.size + size > WIDGET_SPEAKER_VOICE_CLIP_MAX_SIZE) {
+            USER_LOG_ERROR("Voice data is larger than %d bytes.", WIDGET_SPEAKER_VOICE_CLIP_MAX_SIZE);
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+            goto out;
+        }
+
+        /* Grow by doubling, but never reserve more than the largest clip that is accepted. */
+        capacity = USER_UTIL_MAX(s_voiceClip.capacity * 2, s_voiceClip.size + size);
+        capacity = USER_UTIL_MIN(capacity, WIDGET_SPEAKER_VOICE_CLIP_MAX_SIZE);
+
+        data = realloc(s_voiceClip.data, capacity);
+        if (data == NULL) {
+            USER_LOG_ERROR("Malloc voice data buffer error.");
+            returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
+            goto out;
+        }
+        s_voiceClip.data = data;
+        s_voiceClip.capacity = capacity;
+    }
+
+    memcpy(s_voiceClip.data + s_voiceClip.size, buf, size);
+    s_voiceClip.size += size;
+    UtilMd5_Update(&s_voiceClip.md5Ctx, (uint8_t *) buf, size);
+
 out:
-    pclose(fp);
+    osalHandler->MutexUnlock(s_audioMutex);
+    osalHandler->SemaphorePost(s_decodeSema);
 
-    return pid;
+    return returnCode;
 }
 
-static uint32_t DjiTest_KillVoicePlayProcess(uint32_t pid)
+static T_DjiReturnCode DjiTest_FinishVoiceClip(const uint8_t *md5Sum, uint16_t size)
 {
-    FILE *fp;
-    char cmdStr[128];
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint8_t clipMd5Sum[16] = {0};
+
+    osalHandler->MutexLock(s_audioMutex);
+    s_voiceClip.isComplete = true;
+    UtilMd5_Final(&s_voiceClip.md5Ctx, clipMd5Sum);
+    osalHandler->MutexUnlock(s_audioMutex);
+    osalHandler->SemaphorePost(s_decodeSema);
 
-    snprintf(cmdStr, 128, "kill %d", pid);
-    fp = popen(cmdStr, "r");
-    if (fp == NULL) {
-        USER_LOG_ERROR("fp is null.");
-        return 0;
+    if (size != sizeof(clipMd5Sum)) {
+        USER_LOG_ERROR("MD5 sum length error");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
     }
 
-    pclose(fp);
+    if (memcmp(clipMd5Sum, md5Sum, sizeof(clipMd5Sum)) != 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
 
-    return pid;
+    USER_LOG_INFO("MD5 sum check success");
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-static T_DjiReturnCode DjiTest_DecodeAudioData(void)
+static void DjiTest_RequestPlaybackRestart(void)
 {
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    osalHandler->MutexLock(s_audioMutex);
+    s_playback.isRestartRequested = true;
+    osalHandler->MutexUnlock(s_audioMutex);
+    osalHandler->SemaphorePost(s_decodeSema);
+}
+
+static T_DjiReturnCode DjiTest_StartPlayback(E_DjiWidgetSpeakerWorkMode workMode)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiAircraftInfoBaseInfo aircraftInfoBaseInfo;
+    T_DjiReturnCode returnCode;
+
+    returnCode = DjiAircraftInfo_GetBaseInfo(&aircraftInfoBaseInfo);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("get aircraft base info error");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    /* These aircraft send text to speech as encoded voice data. */
+    if (aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M3E ||
+        aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M3T ||
+        aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M3D ||
+        aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M3TD) {
+        workMode = DJI_WIDGET_SPEAKER_WORK_MODE_VOICE;
+    }
+
+    if (workMode == DJI_WIDGET_SPEAKER_WORK_MODE_VOICE) {
+        s_playback.decodeOffset = 0;
 #ifdef OPUS_INSTALLED
-    FILE *fin;
-    FILE *fout;
-    OpusDecoder *decoder;
-    opus_int16 out[WIDGET_SPEAKER_AUDIO_OPUS_MAX_FRAME_SIZE * WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS];
-    uint8_t cbits[WIDGET_SPEAKER_AUDIO_OPUS_MAX_PACKET_SIZE];
-    int32_t nbBytes;
-    int32_t err;
+        opus_decoder_ctl(s_opusDecoder, OPUS_RESET_STATE);
+#endif
+    } else {
+        returnCode = DjiTest_ConvertTtsData();
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
 
-    /*! Attention: you can use "ffmpeg -i xxx.mp3 -ar 16000 -ac 1 out.wav" and use opus-tools to generate opus file for test */
-    fin = fopen(WIDGET_SPEAKER_AUDIO_OPUS_FILE_NAME, "r");
-    if (fin == NULL) {
-        fprintf(stderr, "failed to open input file: %s\n", strerror(errno));
-        return EXIT_FAILURE;
+        s_playback.ttsAudioFile = fopen(WIDGET_SPEAKER_TTS_OUTPUT_FILE_NAME, "rb");
+        if (s_playback.ttsAudioFile == NULL) {
+            USER_LOG_ERROR("Open tts audio file error: %s", strerror(errno));
+            return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+        }
+        fseek(s_playback.ttsAudioFile, WIDGET_SPEAKER_TTS_WAV_HEADER_SIZE, SEEK_SET);
     }
 
-    /* Create a new decoder state. */
-    decoder = opus_decoder_create(WIDGET_SPEAKER_AUDIO_OPUS_SAMPLE_RATE, WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS, &err);
-    if (err < 0) {
-        fprintf(stderr, "failed to create decoder: %s\n", opus_strerror(err));
-        goto close_fin;
+    osalHandler->MutexLock(s_audioMutex);
+    s_playback.isSourceEnd = false;
+    s_playback.sessionId++;
+    osalHandler->MutexUnlock(s_audioMutex);
+
+    s_playback.source = workMode;
+    s_playback.isActive = true;
+    USER_LOG_INFO("Start Playing...");
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void DjiTest_StopPlayback(bool isDropNeeded)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (isDropNeeded) {
+        osalHandler->MutexLock(s_audioMutex);
+        UtilBuffer_Init(&s_pcmRingBuffer, s_pcmRingBufferData, sizeof(s_pcmRingBufferData));
+        s_playback.isDropRequested = true;
+        s_playback.isSourceEnd = false;
+        s_playback.sessionId++;
+        s_playback.drainedSessionId = s_playback.sessionId;
+        osalHandler->MutexUnlock(s_audioMutex);
+        osalHandler->SemaphorePost(s_sinkSema);
     }
 
-    fout = fopen(WIDGET_SPEAKER_AUDIO_PCM_FILE_NAME, "w");
-    if (fout == NULL) {
-        fprintf(stderr, "failed to open output file: %s\n", strerror(errno));
-        goto close_fin;
+    if (s_playback.ttsAudioFile != NULL) {
+        fclose(s_playback.ttsAudioFile);
+        s_playback.ttsAudioFile = NULL;
     }
 
-    while (1) {
-        int i;
-        unsigned char pcm_bytes[WIDGET_SPEAKER_AUDIO_OPUS_MAX_FRAME_SIZE * WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS * 2];
-        int frame_size;
-
-        /* Read a 16 bits/sample audio frame. */
-        nbBytes = fread(cbits, 1, s_decodeBitrate / WIDGET_SPEAKER_AUDIO_OPUS_DECODE_BITRATE_8KBPS *
-                                  WIDGET_SPEAKER_AUDIO_OPUS_DECODE_FRAME_SIZE_8KBPS, fin);
-        if (feof(fin))
+    s_playback.isActive = false;
+}
+
+static bool DjiTest_IsPlaybackFinished(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    bool isFinished;
+
+    osalHandler->MutexLock(s_audioMutex);
+    isFinished = s_playback.isSourceEnd && s_playback.drainedSessionId == s_playback.sessionId;
+    osalHandler->MutexUnlock(s_audioMutex);
+
+    return isFinished;
+}
+
+static void DjiTest_FillPcmRingBuffer(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    static int16_t pcm[WIDGET_SPEAKER_AUDIO_OPUS_MAX_FRAME_SIZE * WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS];
+    T_DjiReturnCode returnCode;
+    uint32_t frameCount;
+    uint16_t unusedSize;
+    bool isSourceEnd = false;
+
+    while (!isSourceEnd) {
+        osalHandler->MutexLock(s_audioMutex);
+        unusedSize = UtilBuffer_GetUnusedSize(&s_pcmRingBuffer);
+        osalHandler->MutexUnlock(s_audioMutex);
+
+        /* The sink task wakes this task again once it has made room. */
+        if (unusedSize < sizeof(pcm)) {
             break;
+        }
 
-        /* Decode the data. In this example, frame_size will be constant because
-           the encoder is using a constant frame size. However, that may not
-           be the case for all encoders, so the decoder must always check
-           the frame size returned. */
-        frame_size = opus_decode(decoder, cbits, nbBytes, out, WIDGET_SPEAKER_AUDIO_OPUS_MAX_FRAME_SIZE, 0);
-        if (frame_size < 0) {
-            fprintf(stderr, "decoder failed: %s\n", opus_strerror(frame_size));
-            goto close_fout;
+        frameCount = 0;
+        if (s_playback.source == DJI_WIDGET_SPEAKER_WORK_MODE_VOICE) {
+            returnCode = DjiTest_DecodeVoiceFrame(pcm, &frameCount, &isSourceEnd);
+        } else {
+            returnCode = DjiTest_ReadTtsFrame(pcm, &frameCount, &isSourceEnd);
         }
 
-        USER_LOG_DEBUG("decode data to file: %d\r\n", frame_size * WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS);
-        /* Convert to little-endian ordering. */
-        for (i = 0; i < WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS * frame_size; i++) {
-            pcm_bytes[2 * i] = out[i] & 0xFF;
-            pcm_bytes[2 * i + 1] = (out[i] >> 8) & 0xFF;
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            isSourceEnd = true;
+        }
+
+        if (frameCount == 0) {
+            /* Waiting for more voice data to be transmitted. */
+            if (!isSourceEnd) {
+                break;
+            }
+            continue;
         }
-        /* Write the decoded audio to file. */
-        fwrite(pcm_bytes, sizeof(short), frame_size * WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS, fout);
-    }
 
-    USER_LOG_INFO("Decode Finished...");
-    s_isDecodeFinished = true;
+        osalHandler->MutexLock(s_audioMutex);
+        UtilBuffer_Put(&s_pcmRingBuffer, (uint8_t *) pcm,
+                       frameCount * WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS * sizeof(int16_t));
+        osalHandler->MutexUnlock(s_audioMutex);
+        osalHandler->SemaphorePost(s_sinkSema);
+    }
 
-decode_data_failed:
-    opus_decoder_destroy(decoder);
-create_decoder_failed:
-    fclose(fout);
-open_pcm_audio_failed:
-    fclose(fin);
-#endif
-    return EXIT_SUCCESS;
+    if (isSourceEnd) {
+        osalHandler->MutexLock(s_audioMutex);
+        s_playback.isSourceEnd = true;
+        osalHandler->MutexUnlock(s_audioMutex);
+        osalHandler->SemaphorePost(s_sinkSema);
+    }
+}
 
+static T_DjiReturnCode DjiTest_DecodeVoiceFrame(int16_t *pcm, uint32_t *frameCount, bool *isSourceEnd)
+{
 #ifdef OPUS_INSTALLED
-close_fout:
-    fclose(fout);
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint8_t packet[WIDGET_SPEAKER_AUDIO_OPUS_MAX_PACKET_SIZE];
+    uint32_t packetSize;
+    int32_t decodedFrameCount;
+
+    /* Voice data is encoded with constant bitrate, every packet has the same size. */
+    packetSize = USER_UTIL_MAX(s_decodeBitrate, WIDGET_SPEAKER_AUDIO_OPUS_DECODE_BITRATE_8KBPS) /
+                 WIDGET_SPEAKER_AUDIO_OPUS_DECODE_BITRATE_8KBPS * WIDGET_SPEAKER_AUDIO_OPUS_DECODE_FRAME_SIZE_8KBPS;
+    packetSize = USER_UTIL_MIN(packetSize, sizeof(packet));
+
+    osalHandler->MutexLock(s_audioMutex);
+    if (s_playback.decodeOffset + packetSize > s_voiceClip.size) {
+        *isSourceEnd = s_voiceClip.isComplete;
+        osalHandler->MutexUnlock(s_audioMutex);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+    memcpy(packet, s_voiceClip.data + s_playback.decodeOffset, packetSize);
+    osalHandler->MutexUnlock(s_audioMutex);
+
+    s_playback.decodeOffset += packetSize;
+
+    /* Decode the data. In this example, frame size will be constant because the encoder is using a constant frame
+       size. However, that may not be the case for all encoders, so the decoder must always check the frame size
+       returned. */
+    decodedFrameCount = opus_decode(s_opusDecoder, packet, (int32_t) packetSize, pcm,
+                                    WIDGET_SPEAKER_AUDIO_OPUS_MAX_FRAME_SIZE, 0);
+    if (decodedFrameCount < 0) {
+        USER_LOG_ERROR("Decoder failed: %s", opus_strerror(decodedFrameCount));
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
 
-close_fin:
-    fclose(fin);
+    *frameCount = (uint32_t) decodedFrameCount;
 
-    return EXIT_FAILURE;
-#endif
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+#else
+    USER_UTIL_UNUSED(pcm);
+    USER_LOG_WARN("Opus is not installed, voice data can not be decoded.");
+    *frameCount = 0;
+    *isSourceEnd = true;
 
+    return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+#endif
 }
 
-static T_DjiReturnCode DjiTest_PlayAudioData(void)
+static T_DjiReturnCode DjiTest_ReadTtsFrame(int16_t *pcm, uint32_t *frameCount, bool *isSourceEnd)
 {
-    char cmdStr[128];
+    size_t readFrameCount;
 
-    memset(cmdStr, 0, sizeof(cmdStr));
-    USER_LOG_INFO("Start Playing...");
+    if (s_playback.ttsAudioFile == NULL) {
+        *isSourceEnd = true;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
 
-    snprintf(cmdStr, sizeof(cmdStr), "ffplay -nodisp -autoexit -ar 16000 -ac 1 -f s16le -i %s 2>/dev/null",
-             WIDGET_SPEAKER_AUDIO_PCM_FILE_NAME);
+    readFrameCount = fread(pcm, sizeof(int16_t) * WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS,
+                           WIDGET_SPEAKER_SINK_PERIOD_FRAMES, s_playback.ttsAudioFile);
+    *frameCount = (uint32_t) readFrameCount;
+    *isSourceEnd = readFrameCount < WIDGET_SPEAKER_SINK_PERIOD_FRAMES;
 
-    return DjiUserUtil_RunSystemCmd(cmdStr);
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-static T_DjiReturnCode DjiTest_PlayTtsData(void)
+static T_DjiReturnCode DjiTest_ConvertTtsData(void)
 {
     FILE *txtFile;
     uint8_t data[WIDGET_SPEAKER_TTS_FILE_MAX_SIZE] = {0};
     int32_t readLen;
     char cmdStr[WIDGET_SPEAKER_TTS_FILE_MAX_SIZE + 128];
-    T_DjiAircraftInfoBaseInfo aircraftInfoBaseInfo;
     T_DjiReturnCode returnCode;
 
-    returnCode = DjiAircraftInfo_GetBaseInfo(&aircraftInfoBaseInfo);
-    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("get aircraft base info error");
-        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    txtFile = fopen(WIDGET_SPEAKER_TTS_FILE_NAME, "r");
+    if (txtFile == NULL) {
+        USER_LOG_ERROR("failed to open input file: %s\n", strerror(errno));
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
     }
 
-    if (aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M3E ||
-        aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M3T ||
-        aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M3D ||
-        aircraftInfoBaseInfo.aircraftType == DJI_AIRCRAFT_TYPE_M3TD) {
-        return DjiTest_PlayAudioData();
-    } else {
-        txtFile = fopen(WIDGET_SPEAKER_TTS_FILE_NAME, "r");
-        if (txtFile == NULL) {
-            USER_LOG_ERROR("failed to open input file: %s\n", strerror(errno));
-            return EXIT_FAILURE;
-        }
-
-        readLen = fread(data, 1, WIDGET_SPEAKER_TTS_FILE_MAX_SIZE - 1, txtFile);
-        if (readLen <= 0) {
-            USER_LOG_ERROR("Read tts file failed, error code: %d", readLen);
-            fclose(txtFile);
-            return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
-        }
+    readLen = fread(data, 1, WIDGET_SPEAKER_TTS_FILE_MAX_SIZE - 1, txtFile);
+    if (readLen <= 0) {
+        USER_LOG_ERROR("Read tts file failed, error code: %d", readLen);
+        fclose(txtFile);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
 
-        data[readLen] = '\0';
+    data[readLen] = '\0';
 
-        fclose(txtFile);
+    fclose(txtFile);
 
-        USER_LOG_INFO("Read tts file success, len: %d", readLen);
-        USER_LOG_INFO("Content: %s", data);
+    USER_LOG_INFO("Read tts file success, len: %d", readLen);
+    USER_LOG_INFO("Content: %s", data);
 
-        memset(cmdStr, 0, sizeof(cmdStr));
+    memset(cmdStr, 0, sizeof(cmdStr));
 
-        SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_IN_TTS_CONVERSION);
+    SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_IN_TTS_CONVERSION);
 
 #if EKHO_INSTALLED
-        /*! Attention: you can use other tts opensource function to convert txt to speech, example used ekho v7.5 */
-        snprintf(cmdStr, sizeof(cmdStr), " ekho %s -s 20 -p 20 -a 100 -o %s", data,
-                 WIDGET_SPEAKER_TTS_OUTPUT_FILE_NAME);
+    /*! Attention: you can use other tts opensource function to convert txt to speech, example used ekho v7.5 */
+    snprintf(cmdStr, sizeof(cmdStr), " ekho %s -s 20 -p 20 -a 100 -o %s", data,
+             WIDGET_SPEAKER_TTS_OUTPUT_FILE_NAME);
+    returnCode = DjiUserUtil_RunSystemCmd(cmdStr);
 #else
-        USER_LOG_WARN(
-        "Ekho is not installed, please visit https://www.eguidedog.net/ekho.php to install it or use other TTS tools to convert audio");
+    USER_LOG_WARN(
+    "Ekho is not installed, please visit https://www.eguidedog.net/ekho.php to install it or use other TTS tools to convert audio");
+    returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
 #endif
-        DjiUserUtil_RunSystemCmd(cmdStr);
 
-        SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_PLAYING);
-        USER_LOG_INFO("Start TTS Playing...");
-        memset(cmdStr, 0, sizeof(cmdStr));
-        snprintf(cmdStr, sizeof(cmdStr), "ffplay -nodisp -autoexit -ar 16000 -ac 1 -f s16le -i %s 2>/dev/null",
-                 WIDGET_SPEAKER_TTS_OUTPUT_FILE_NAME);
+    SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_PLAYING);
+
+    return returnCode;
+}
+
+static void DjiTest_ApplyVolume(int16_t *samples, uint32_t sampleCount)
+{
+    float gain = s_volumeGain;
+    float sample;
+
+    if (gain == 1.0f) {
+        return;
+    }
 
-        return DjiUserUtil_RunSystemCmd(cmdStr);
+    for (uint32_t i = 0; i < sampleCount; i++) {
+        sample = (float) samples[i] * gain;
+        samples[i] = (int16_t) USER_UTIL_MAX(-32768.0f, USER_UTIL_MIN(32767.0f, sample));
     }
 }
 
@@ -440,6 +717,11 @@ static void SetSpeakerState(E_DjiWidgetSpeakerState speakerState)
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
     }
+
+#ifdef SYSTEM_ARCH_LINUX
+    /* The playback task sleeps until an event, a state change is one. */
+    osalHandler->SemaphorePost(s_decodeSema);
+#endif
 }
 
 static T_DjiReturnCode GetSpeakerState(T_DjiWidgetSpeakerState *speakerState)
@@ -512,20 +794,14 @@ static T_DjiReturnCode SetPlayMode(E_DjiWidgetSpeakerPlayMode playMode)
 
 static T_DjiReturnCode StartPlay(void)
 {
-    uint32_t pid;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    USER_LOG_INFO("Start widget speaker play");
+    SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_PLAYING);
 
 #ifdef SYSTEM_ARCH_LINUX
-    pid = DjiTest_GetVoicePlayProcessId();
-    if (pid != 0) {
-        DjiTest_KillVoicePlayProcess(pid);
-    }
+    /* Play from the beginning even if a previous play is still running. */
+    DjiTest_RequestPlaybackRestart();
 #endif
 
-    osalHandler->TaskSleepMs(5);
-    USER_LOG_INFO("Start widget speaker play");
-    SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_PLAYING);
-
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
@@ -533,7 +809,6 @@ static T_DjiReturnCode StopPlay(void)
 {
     T_DjiReturnCode returnCode;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-    uint32_t pid;
 
     returnCode = osalHandler->MutexLock(s_speakerMutex);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -544,19 +819,16 @@ static T_DjiReturnCode StopPlay(void)
     USER_LOG_INFO("Stop widget speaker play");
     s_speakerState.state = DJI_WIDGET_SPEAKER_STATE_IDEL;
 
-#ifdef SYSTEM_ARCH_LINUX
-    pid = DjiTest_GetVoicePlayProcessId();
-    if (pid != 0) {
-        DjiTest_KillVoicePlayProcess(pid);
-    }
-#endif
-
     returnCode = osalHandler->MutexUnlock(s_speakerMutex);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("unlock mutex error: 0x%08llX.", returnCode);
         return returnCode;
     }
 
+#ifdef SYSTEM_ARCH_LINUX
+    osalHandler->SemaphorePost(s_decodeSema);
+#endif
+
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
@@ -564,8 +836,6 @@ static T_DjiReturnCode SetVolume(uint8_t volume)
 {
     T_DjiReturnCode returnCode;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-    char cmdStr[128];
-    int32_t ret = 0;
     float realVolume;
 
     returnCode = osalHandler->MutexLock(s_speakerMutex);
@@ -579,22 +849,11 @@ static T_DjiReturnCode SetVolume(uint8_t volume)
 
     USER_LOG_INFO("Set widget speaker volume: %d", volume);
 
-#ifdef PLATFORM_ARCH_x86_64
-    snprintf(cmdStr, sizeof(cmdStr), "pactl list | grep %s -q", WIDGET_SPEAKER_USB_AUDIO_DEVICE_NAME);
-    ret = system(cmdStr);
-    if (ret == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        memset(cmdStr, 0, sizeof(cmdStr));
-        snprintf(cmdStr, sizeof(cmdStr), "pactl set-sink-volume %s %d%%", WIDGET_SPEAKER_USB_AUDIO_DEVICE_NAME,
-                 (int32_t) realVolume);
-
-        returnCode = DjiUserUtil_RunSystemCmd(cmdStr);
-        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("Set widget speaker volume error: %d", ret);
-        }
-    } else {
-        USER_LOG_WARN("No audio device found, please add audio device and init speaker volume here.");
-    }
+#ifdef SYSTEM_ARCH_LINUX
+    /* Volume is applied to the decoded samples, so it works the same for every sink. */
+    s_volumeGain = realVolume / 100.0f;
 #else
+    USER_UTIL_UNUSED(realVolume);
     USER_LOG_WARN("No audio device found, please add audio device and init speaker volume here!!!");
 #endif
 
@@ -659,53 +918,42 @@ static T_DjiReturnCode ReceiveTtsData(E_DjiWidgetTransmitDataEvent event,
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
+/* Voice data is kept in memory and decoded by the speaker task as it arrives, playback can start before the
+ * transmission has finished. */
 static T_DjiReturnCode ReceiveAudioData(E_DjiWidgetTransmitDataEvent event,
                                         uint32_t offset, uint8_t *buf, uint16_t size)
 {
-    uint16_t writeLen;
     T_DjiReturnCode returnCode;
     T_DjiWidgetTransDataContent transDataContent = {0};
 
     if (event == DJI_WIDGET_TRANSMIT_DATA_EVENT_START) {
-        s_isDecodeFinished = false;
+        memcpy(&transDataContent, buf, USER_UTIL_MIN(size, sizeof(transDataContent)));
+        s_decodeBitrate = transDataContent.transDataStartContent.fileDecodeBitrate;
+        USER_LOG_INFO("Create voice file: %s, decoder bitrate: %d.", transDataContent.transDataStartContent.fileName,
+                      transDataContent.transDataStartContent.fileDecodeBitrate);
+
 #ifdef SYSTEM_ARCH_LINUX
-        USER_LOG_INFO("Create voice file.");
-        s_audioFile = fopen(WIDGET_SPEAKER_AUDIO_OPUS_FILE_NAME, "wb");
-        if (s_audioFile == NULL) {
-            USER_LOG_ERROR("Create tts file error.");
-        }
+        DjiTest_ResetVoiceClip();
+        DjiTest_RequestPlaybackRestart();
+#endif
         if (s_speakerState.state != DJI_WIDGET_SPEAKER_STATE_PLAYING) {
             SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_TRANSMITTING);
         }
-#endif
-
-        memcpy(&transDataContent, buf, size);
-        s_decodeBitrate = transDataContent.transDataStartContent.fileDecodeBitrate;
-        USER_LOG_INFO("Create voice file: %s, decoder bitrate: %d.", transDataContent.transDataStartContent.fileName,
-                      transDataContent.transDataStartContent.fileDecodeBitrate);
     } else if (event == DJI_WIDGET_TRANSMIT_DATA_EVENT_TRANSMIT) {
-        USER_LOG_INFO("Transmit voice file, offset: %d, size: %d", offset, size);
+        USER_LOG_DEBUG("Transmit voice file, offset: %d, size: %d", offset, size);
 #ifdef SYSTEM_ARCH_LINUX
-        if (s_audioFile != NULL) {
-            fseek(s_audioFile, offset, SEEK_SET);
-            writeLen = fwrite(buf, 1, size, s_audioFile);
-            if (writeLen != size) {
-                USER_LOG_ERROR("Write tts file error %d", writeLen);
-            }
+        returnCode = DjiTest_AppendVoiceClip(offset, buf, size);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Append voice data error: 0x%08llX.", returnCode);
         }
 #endif
         if (s_speakerState.state != DJI_WIDGET_SPEAKER_STATE_PLAYING) {
             SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_TRANSMITTING);
         }
     } else if (event == DJI_WIDGET_TRANSMIT_DATA_EVENT_FINISH) {
-        USER_LOG_INFO("Close voice file.");
-        if (s_audioFile != NULL) {
-            fclose(s_audioFile);
-            s_audioFile = NULL;
-        }
-
+        USER_LOG_INFO("Voice file transmit finished.");
 #ifdef SYSTEM_ARCH_LINUX
-        returnCode = DjiTest_CheckFileMd5Sum(WIDGET_SPEAKER_AUDIO_OPUS_FILE_NAME, buf, size);
+        returnCode = DjiTest_FinishVoiceClip(buf, size);
         if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
             USER_LOG_ERROR("File md5 sum check failed");
             return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
@@ -714,9 +962,6 @@ static T_DjiReturnCode ReceiveAudioData(E_DjiWidgetTransmitDataEvent event,
         if (s_speakerState.state != DJI_WIDGET_SPEAKER_STATE_PLAYING) {
             SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_IDEL);
         }
-#ifdef SYSTEM_ARCH_LINUX
-        DjiTest_DecodeAudioData();
-#endif
     }
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
@@ -733,60 +978,136 @@ static void *DjiTest_WidgetSpeakerTask(void *arg)
 {
     T_DjiReturnCode djiReturnCode;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiWidgetSpeakerState speakerState;
+    bool isRestartRequested;
+    uint32_t nowMs;
 
     USER_UTIL_UNUSED(arg);
 
     while (1) {
-        osalHandler->TaskSleepMs(10);
-
-        if (s_speakerState.state == DJI_WIDGET_SPEAKER_STATE_PLAYING) {
-            if (s_speakerState.playMode == DJI_WIDGET_SPEAKER_PLAY_MODE_LOOP_PLAYBACK) {
-                if (s_speakerState.workMode == DJI_WIDGET_SPEAKER_WORK_MODE_VOICE) {
-                    USER_LOG_DEBUG("Waiting opus decoder finished...");
-                    while (s_isDecodeFinished == false) {
-                        osalHandler->TaskSleepMs(1);
-                    }
-                    djiReturnCode = DjiTest_PlayAudioData();
-                    if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                        USER_LOG_ERROR("Play audio data failed, error: 0x%08llX.", djiReturnCode);
-                    }
-                } else {
-                    djiReturnCode = DjiTest_PlayTtsData();
-                    if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                        USER_LOG_ERROR("Play tts data failed, error: 0x%08llX.", djiReturnCode);
-                    }
-                }
-                osalHandler->TaskSleepMs(1000);
-            } else {
-                if (s_speakerState.workMode == DJI_WIDGET_SPEAKER_WORK_MODE_VOICE) {
-                    USER_LOG_DEBUG("Waiting opus decoder finished...");
-                    while (s_isDecodeFinished == false) {
-                        osalHandler->TaskSleepMs(1);
-                    }
-                    djiReturnCode = DjiTest_PlayAudioData();
-                    if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                        USER_LOG_ERROR("Play audio data failed, error: 0x%08llX.", djiReturnCode);
-                    }
-                } else {
-                    djiReturnCode = DjiTest_PlayTtsData();
-                    if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                        USER_LOG_ERROR("Play tts data failed, error: 0x%08llX.", djiReturnCode);
-                    }
-                }
+        /* Woken by new voice data, play state changes and the sink task making room in the ring buffer, the only
+         * timed wait is the pause between two loop plays. */
+        if (s_playback.isLoopWaiting) {
+            osalHandler->GetTimeMs(&nowMs);
+            if ((int32_t) (s_playback.nextStartTimeMs - nowMs) > 0) {
+                osalHandler->SemaphoreTimedWait(s_decodeSema, s_playback.nextStartTimeMs - nowMs);
+            }
+        } else {
+            osalHandler->SemaphoreWait(s_decodeSema);
+        }
 
-                djiReturnCode = osalHandler->MutexLock(s_speakerMutex);
-                if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    USER_LOG_ERROR("lock mutex error: 0x%08llX.", djiReturnCode);
-                }
+        djiReturnCode = GetSpeakerState(&speakerState);
+        if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            continue;
+        }
 
-                if (s_speakerState.playMode == DJI_WIDGET_SPEAKER_PLAY_MODE_SINGLE_PLAY) {
-                    s_speakerState.state = DJI_WIDGET_SPEAKER_STATE_IDEL;
-                }
+        osalHandler->MutexLock(s_audioMutex);
+        isRestartRequested = s_playback.isRestartRequested;
+        s_playback.isRestartRequested = false;
+        osalHandler->MutexUnlock(s_audioMutex);
 
-                djiReturnCode = osalHandler->MutexUnlock(s_speakerMutex);
-                if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    USER_LOG_ERROR("unlock mutex error: 0x%08llX.", djiReturnCode);
+        if (isRestartRequested || speakerState.state != DJI_WIDGET_SPEAKER_STATE_PLAYING) {
+            if (s_playback.isActive) {
+                DjiTest_StopPlayback(true);
+            }
+            s_playback.isLoopWaiting = false;
+        }
+
+        if (speakerState.state != DJI_WIDGET_SPEAKER_STATE_PLAYING) {
+            continue;
+        }
+
+        if (!s_playback.isActive) {
+            osalHandler->GetTimeMs(&nowMs);
+            if (s_playback.isLoopWaiting && (int32_t) (s_playback.nextStartTimeMs - nowMs) > 0) {
+                continue;
+            }
+            s_playback.isLoopWaiting = false;
+
+            djiReturnCode = DjiTest_StartPlayback(speakerState.workMode);
+            if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_ERROR("Start playback failed, error: 0x%08llX.", djiReturnCode);
+                SetSpeakerState(DJI_WIDGET_SPEAKER_STATE_IDEL);
+                continue;
+            }
+        }
+
+        DjiTest_FillPcmRingBuffer();
+
+        if (!DjiTest_IsPlaybackFinished()) {
+            continue;
+        }
+
+        DjiTest_StopPlayback(false);
+
+        if (speakerState.playMode == DJI_WIDGET_SPEAKER_PLAY_MODE_LOOP_PLAYBACK) {
+            osalHandler->GetTimeMs(&nowMs);
+            s_playback.nextStartTimeMs = nowMs + WIDGET_SPEAKER_LOOP_PLAY_INTERVAL_MS;
+            s_playback.isLoopWaiting = true;
+            continue;
+        }
+
+        djiReturnCode = osalHandler->MutexLock(s_speakerMutex);
+        if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("lock mutex error: 0x%08llX.", djiReturnCode);
+        }
+
+        if (s_speakerState.playMode == DJI_WIDGET_SPEAKER_PLAY_MODE_SINGLE_PLAY) {
+            s_speakerState.state = DJI_WIDGET_SPEAKER_STATE_IDEL;
+        }
+
+        djiReturnCode = osalHandler->MutexUnlock(s_speakerMutex);
+        if (djiReturnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("unlock mutex error: 0x%08llX.", djiReturnCode);
+        }
+    }
+}
+
+static void *DjiTest_WidgetSpeakerSinkTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    static int16_t samples[WIDGET_SPEAKER_SINK_PERIOD_FRAMES * WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS];
+    uint16_t readLen;
+    uint32_t sessionId;
+    bool isDropRequested;
+    bool isDrainNeeded;
+
+    USER_UTIL_UNUSED(arg);
+
+    while (1) {
+        osalHandler->SemaphoreWait(s_sinkSema);
+
+        while (1) {
+            osalHandler->MutexLock(s_audioMutex);
+            isDropRequested = s_playback.isDropRequested;
+            s_playback.isDropRequested = false;
+            readLen = UtilBuffer_Get(&s_pcmRingBuffer, (uint8_t *) samples, sizeof(samples));
+            sessionId = s_playback.sessionId;
+            isDrainNeeded = readLen == 0 && s_playback.isSourceEnd && s_playback.drainedSessionId != sessionId;
+            osalHandler->MutexUnlock(s_audioMutex);
+
+            if (isDropRequested) {
+                s_speakerSink->Drop();
+            }
+
+            if (readLen == 0) {
+                if (isDrainNeeded) {
+                    s_speakerSink->Drain();
+                    osalHandler->MutexLock(s_audioMutex);
+                    s_playback.drainedSessionId = sessionId;
+                    osalHandler->MutexUnlock(s_audioMutex);
+                    osalHandler->SemaphorePost(s_decodeSema);
                 }
+                break;
+            }
+
+            /* Room was made in the ring buffer, let the decoder refill it while this period plays. */
+            osalHandler->SemaphorePost(s_decodeSema);
+
+            DjiTest_ApplyVolume(samples, readLen / sizeof(int16_t));
+            if (s_speakerSink->Write(samples, readLen / sizeof(int16_t) / WIDGET_SPEAKER_AUDIO_OPUS_CHANNELS) !=
+                DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_ERROR("Write speaker sink error.");
             }
         }
     }
@@ -0,0 +1,336 @@
+/**
+ ********************************************************************
+ * @file    test_widget_speaker_sink.c
+ * @brief
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_widget_speaker_sink.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "utils/util_misc.h"
+
+#ifdef SYSTEM_ARCH_LINUX
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+
+#endif
+
+#ifdef ALSA_INSTALLED
+
+#include <alsa/asoundlib.h>
+
+#endif
+
+/* Private constants ---------------------------------------------------------*/
+/*! Attention: the file sink writes here unless DjiTest_WidgetSpeakerSetSinkFilePath selects another file. */
+#define WIDGET_SPEAKER_SINK_FILE_PATH_DEFAULT   "/tmp/dji_widget_speaker_out.pcm"
+
+/*! Attention: replace your audio device name here, see "aplay -L" for the available devices. */
+#define WIDGET_SPEAKER_SINK_ALSA_DEVICE_NAME    "default"
+#define WIDGET_SPEAKER_SINK_ALSA_LATENCY_US     (100000)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static uint32_t s_sinkSampleRate = 0;
+static uint8_t s_sinkChannels = 0;
+
+#ifdef SYSTEM_ARCH_LINUX
+static FILE *s_sinkFile = NULL;
+static char s_sinkFilePath[DJI_FILE_PATH_SIZE_MAX] = WIDGET_SPEAKER_SINK_FILE_PATH_DEFAULT;
+#endif
+
+#ifdef ALSA_INSTALLED
+static snd_pcm_t *s_sinkPcm = NULL;
+#endif
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode DjiTest_NullSinkOpen(uint32_t sampleRate, uint8_t channels);
+static T_DjiReturnCode DjiTest_NullSinkWrite(const int16_t *samples, uint32_t frameCount);
+static T_DjiReturnCode DjiTest_NullSinkNoop(void);
+
+#ifdef SYSTEM_ARCH_LINUX
+static T_DjiReturnCode DjiTest_FileSinkOpen(uint32_t sampleRate, uint8_t channels);
+static T_DjiReturnCode DjiTest_FileSinkWrite(const int16_t *samples, uint32_t frameCount);
+static T_DjiReturnCode DjiTest_FileSinkDrain(void);
+static T_DjiReturnCode DjiTest_FileSinkClose(void);
+#endif
+
+#ifdef ALSA_INSTALLED
+static T_DjiReturnCode DjiTest_AlsaSinkOpen(uint32_t sampleRate, uint8_t channels);
+static T_DjiReturnCode DjiTest_AlsaSinkWrite(const int16_t *samples, uint32_t frameCount);
+static T_DjiReturnCode DjiTest_AlsaSinkDrain(void);
+static T_DjiReturnCode DjiTest_AlsaSinkDrop(void);
+static T_DjiReturnCode DjiTest_AlsaSinkClose(void);
+#endif
+
+static const T_DjiTestWidgetSpeakerSink s_nullSink = {
+    .Open = DjiTest_NullSinkOpen,
+    .Write = DjiTest_NullSinkWrite,
+    .Drain = DjiTest_NullSinkNoop,
+    .Drop = DjiTest_NullSinkNoop,
+    .Close = DjiTest_NullSinkNoop,
+};
+
+#ifdef SYSTEM_ARCH_LINUX
+static const T_DjiTestWidgetSpeakerSink s_fileSink = {
+    .Open = DjiTest_FileSinkOpen,
+    .Write = DjiTest_FileSinkWrite,
+    .Drain = DjiTest_FileSinkDrain,
+    .Drop = DjiTest_FileSinkDrain,
+    .Close = DjiTest_FileSinkClose,
+};
+#endif
+
+#ifdef ALSA_INSTALLED
+static const T_DjiTestWidgetSpeakerSink s_alsaSink = {
+    .Open = DjiTest_AlsaSinkOpen,
+    .Write = DjiTest_AlsaSinkWrite,
+    .Drain = DjiTest_AlsaSinkDrain,
+    .Drop = DjiTest_AlsaSinkDrop,
+    .Close = DjiTest_AlsaSinkClose,
+};
+#endif
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Get the output sink of the given type.
+ * @param sinkType: type of sink.
+ * @return Pointer to the sink, NULL if the sink is not supported by this build.
+ */
+const T_DjiTestWidgetSpeakerSink *DjiTest_WidgetSpeakerGetSink(E_DjiTestWidgetSpeakerSinkType sinkType)
+{
+    switch (sinkType) {
+        case DJI_TEST_WIDGET_SPEAKER_SINK_NULL:
+            return &s_nullSink;
+#ifdef SYSTEM_ARCH_LINUX
+        case DJI_TEST_WIDGET_SPEAKER_SINK_FILE:
+            return &s_fileSink;
+#endif
+#ifdef ALSA_INSTALLED
+        case DJI_TEST_WIDGET_SPEAKER_SINK_ALSA:
+            return &s_alsaSink;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+/**
+ * @brief Select the file the file sink writes to, takes effect on the next open of the sink.
+ * @param filePath: path of the raw pcm output file.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WidgetSpeakerSetSinkFilePath(const char *filePath)
+{
+#ifdef SYSTEM_ARCH_LINUX
+    if (filePath == NULL || strlen(filePath) == 0 || strlen(filePath) >= sizeof(s_sinkFilePath)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    strcpy(s_sinkFilePath, filePath);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+#else
+    USER_UTIL_UNUSED(filePath);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+#endif
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode DjiTest_NullSinkOpen(uint32_t sampleRate, uint8_t channels)
+{
+    if (sampleRate == 0 || channels == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    s_sinkSampleRate = sampleRate;
+    s_sinkChannels = channels;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_NullSinkWrite(const int16_t *samples, uint32_t frameCount)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    (void) samples;
+
+    /* Take as long as a device would, so playback state and timing behave the same without audio hardware. */
+    osalHandler->TaskSleepMs(frameCount * 1000 / s_sinkSampleRate);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_NullSinkNoop(void)
+{
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+#ifdef SYSTEM_ARCH_LINUX
+
+static T_DjiReturnCode DjiTest_FileSinkOpen(uint32_t sampleRate, uint8_t channels)
+{
+    s_sinkFile = fopen(s_sinkFilePath, "wb");
+    if (s_sinkFile == NULL) {
+        USER_LOG_ERROR("Open speaker sink file %s error: %s.", s_sinkFilePath, strerror(errno));
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    s_sinkSampleRate = sampleRate;
+    s_sinkChannels = channels;
+    USER_LOG_INFO("Speaker audio is written to %s, play it with \"aplay -f S16_LE -r %d -c %d %s\".",
+                  s_sinkFilePath, sampleRate, channels, s_sinkFilePath);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_FileSinkWrite(const int16_t *samples, uint32_t frameCount)
+{
+    if (s_sinkFile == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    if (fwrite(samples, sizeof(int16_t) * s_sinkChannels, frameCount, s_sinkFile) != frameCount) {
+        USER_LOG_ERROR("Write speaker sink file error: %s.", strerror(errno));
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_FileSinkDrain(void)
+{
+    if (s_sinkFile != NULL) {
+        fflush(s_sinkFile);
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_FileSinkClose(void)
+{
+    if (s_sinkFile != NULL) {
+        fclose(s_sinkFile);
+        s_sinkFile = NULL;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+#endif
+
+#ifdef ALSA_INSTALLED
+
+static T_DjiReturnCode DjiTest_AlsaSinkOpen(uint32_t sampleRate, uint8_t channels)
+{
+    int ret;
+
+    ret = snd_pcm_open(&s_sinkPcm, WIDGET_SPEAKER_SINK_ALSA_DEVICE_NAME, SND_PCM_STREAM_PLAYBACK, 0);
+    if (ret < 0) {
+        USER_LOG_ERROR("Open alsa device %s error: %s.", WIDGET_SPEAKER_SINK_ALSA_DEVICE_NAME, snd_strerror(ret));
+        s_sinkPcm = NULL;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    ret = snd_pcm_set_params(s_sinkPcm, SND_PCM_FORMAT_S16_LE, SND_PCM_ACCESS_RW_INTERLEAVED, channels, sampleRate,
+                             1, WIDGET_SPEAKER_SINK_ALSA_LATENCY_US);
+    if (ret < 0) {
+        USER_LOG_ERROR("Set alsa device params error: %s.", snd_strerror(ret));
+        snd_pcm_close(s_sinkPcm);
+        s_sinkPcm = NULL;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    s_sinkSampleRate = sampleRate;
+    s_sinkChannels = channels;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_AlsaSinkWrite(const int16_t *samples, uint32_t frameCount)
+{
+    snd_pcm_sframes_t written;
+
+    if (s_sinkPcm == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    while (frameCount > 0) {
+        written = snd_pcm_writei(s_sinkPcm, samples, frameCount);
+        if (written < 0) {
+            /* Underrun between two clips is expected, recover and keep going. */
+            written = snd_pcm_recover(s_sinkPcm, (int) written, 1);
+            if (written < 0) {
+                USER_LOG_ERROR("Write alsa device error: %s.", snd_strerror((int) written));
+                return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            }
+            continue;
+        }
+
+        samples += written * s_sinkChannels;
+        frameCount -= written;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_AlsaSinkDrain(void)
+{
+    if (s_sinkPcm == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    snd_pcm_drain(s_sinkPcm);
+
+    return snd_pcm_prepare(s_sinkPcm) < 0 ? DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR
+                                          : DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_AlsaSinkDrop(void)
+{
+    if (s_sinkPcm == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    snd_pcm_drop(s_sinkPcm);
+
+    return snd_pcm_prepare(s_sinkPcm) < 0 ? DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR
+                                          : DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_AlsaSinkClose(void)
+{
+    if (s_sinkPcm != NULL) {
+        snd_pcm_close(s_sinkPcm);
+        s_sinkPcm = NULL;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+#endif
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,67 @@
+/**
+ ********************************************************************
+ * @file    test_widget_speaker_sink.h
+ * @brief   This is the header file for "test_widget_speaker_sink.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_WIDGET_SPEAKER_SINK_H
+#define TEST_WIDGET_SPEAKER_SINK_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    DJI_TEST_WIDGET_SPEAKER_SINK_NULL = 0, /*!< Discard samples, paced in real time like an audio device. */
+    DJI_TEST_WIDGET_SPEAKER_SINK_FILE,     /*!< Append samples to a raw s16le file, useful to check decoded audio. */
+    DJI_TEST_WIDGET_SPEAKER_SINK_ALSA,     /*!< Play samples on an ALSA pcm device, requires ALSA_INSTALLED. */
+} E_DjiTestWidgetSpeakerSinkType;
+
+/**
+ * @brief Output of decoded speaker audio. Samples are interleaved signed 16 bits, Write may block until the device
+ * accepts them, which is what paces the playback.
+ */
+typedef struct {
+    T_DjiReturnCode (*Open)(uint32_t sampleRate, uint8_t channels);
+    T_DjiReturnCode (*Write)(const int16_t *samples, uint32_t frameCount);
+    T_DjiReturnCode (*Drain)(void);
+    T_DjiReturnCode (*Drop)(void);
+    T_DjiReturnCode (*Close)(void);
+} T_DjiTestWidgetSpeakerSink;
+
+/* Exported functions --------------------------------------------------------*/
+const T_DjiTestWidgetSpeakerSink *DjiTest_WidgetSpeakerGetSink(E_DjiTestWidgetSpeakerSinkType sinkType);
+T_DjiReturnCode DjiTest_WidgetSpeakerSetSinkFilePath(const char *filePath);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_WIDGET_SPEAKER_SINK_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
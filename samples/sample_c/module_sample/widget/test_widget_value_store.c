@@ -0,0 +1,654 @@
+/**
+ ********************************************************************
+ * @file    test_widget_value_store.c
+ * @brief   Widget values updated by the widget handlers and pushed to observers from a dispatch task.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "test_widget_value_store.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "utils/util_misc.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define WIDGET_VALUE_STORE_TASK_STACK_SIZE          (2048)
+#define WIDGET_VALUE_STORE_STOP_TIMEOUT_MS          (2000)
+#define WIDGET_VALUE_STORE_READ_RETRY_TIMES         (8)
+
+#define WIDGET_BENCHMARK_TASK_STACK_SIZE            (2048)
+#define WIDGET_BENCHMARK_TICK_US                    (2000)
+#define WIDGET_BENCHMARK_SWITCH_PERIOD_TICKS        (250)
+#define WIDGET_BENCHMARK_BUTTON_PERIOD_TICKS        (1500)
+#define WIDGET_BENCHMARK_ACTION_TIME_MS             (1000)
+#define WIDGET_BENCHMARK_SCALE_INDEX                (0)
+#define WIDGET_BENCHMARK_SWITCH_INDEX               (1)
+#define WIDGET_BENCHMARK_BUTTON_INDEX               (2)
+
+/* Orders the slot lock accesses against the copy of the slot, see T_DjiTestWidgetValueSlot. */
+#if defined(__CC_ARM)
+#define WIDGET_VALUE_STORE_BARRIER()                __dmb(0xF)
+#else
+#define WIDGET_VALUE_STORE_BARRIER()                __sync_synchronize()
+#endif
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    bool isInline;
+    volatile bool isStopping;
+    uint32_t actionCount;
+    uint32_t eventCount;
+    uint32_t maxHandlerTimeUs;
+    uint32_t maxScaleLatencyUs;
+    uint64_t totalScaleLatencyUs;
+    uint32_t scaleLatencyCount;
+} T_DjiTestWidgetValueBenchmark;
+
+/* Private functions declaration ---------------------------------------------*/
+static bool DjiTest_WidgetValueStoreReadSlot(const T_DjiTestWidgetValueSlot *slot, T_DjiTestWidgetValue *value);
+static void DjiTest_WidgetValueStoreNotify(T_DjiTestWidgetValueStore *store, uint32_t index,
+                                           const T_DjiTestWidgetValue *value);
+static bool DjiTest_WidgetValueStoreDispatch(T_DjiTestWidgetValueStore *store);
+static void *DjiTest_WidgetValueStoreTask(void *arg);
+static void DjiTest_WidgetValueBenchmarkObserver(uint32_t index, const T_DjiTestWidgetValue *value, void *userData);
+static void DjiTest_WidgetValueBenchmarkEmit(E_DjiWidgetType widgetType, uint32_t index, int32_t value,
+                                             uint64_t scheduledTimeUs);
+static void *DjiTest_WidgetValueBenchmarkSourceTask(void *arg);
+static void *DjiTest_WidgetValueBenchmarkActionTask(void *arg);
+
+/* Private variables ---------------------------------------------------------*/
+static T_DjiTestWidgetValueStore s_widgetBenchmarkStore;
+static T_DjiTestWidgetValueBenchmark s_widgetBenchmark;
+static T_DjiSemaHandle s_widgetBenchmarkActionSema = NULL;
+static T_DjiSemaHandle s_widgetBenchmarkDoneSema = NULL;
+
+static const T_DjiWidgetHandlerListItem s_widgetBenchmarkHandlerList[] = {
+    {WIDGET_BENCHMARK_SCALE_INDEX,  DJI_WIDGET_TYPE_SCALE,
+        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetBenchmarkStore)},
+    {WIDGET_BENCHMARK_SWITCH_INDEX, DJI_WIDGET_TYPE_SWITCH,
+        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetBenchmarkStore)},
+    {WIDGET_BENCHMARK_BUTTON_INDEX, DJI_WIDGET_TYPE_BUTTON,
+        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetBenchmarkStore)},
+};
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Initialize the store with the widgets of a handler list and start its dispatch task.
+ * @param store: store to initialize, the user data of the items of the list.
+ * @param widgetHandlerList: handler list registered to the widget module.
+ * @param itemCount: number of items of the list.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WidgetValueStoreInit(T_DjiTestWidgetValueStore *store,
+                                             const T_DjiWidgetHandlerListItem *widgetHandlerList, uint32_t itemCount)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+    uint32_t i;
+
+    if (store == NULL || widgetHandlerList == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    memset(store, 0, sizeof(T_DjiTestWidgetValueStore));
+    for (i = 0; i < itemCount; i++) {
+        if (widgetHandlerList[i].widgetIndex >= DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX) {
+            USER_LOG_ERROR("Widget index %d out of the value store.", widgetHandlerList[i].widgetIndex);
+            return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+        }
+        store->slots[widgetHandlerList[i].widgetIndex].isUsed = true;
+        store->slots[widgetHandlerList[i].widgetIndex].type = widgetHandlerList[i].widgetType;
+    }
+
+    returnCode = osalHandler->SemaphoreCreate(0, &store->dispatchSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget value store semaphore create error: 0x%08llX.", returnCode);
+        return returnCode;
+    }
+    returnCode = osalHandler->SemaphoreCreate(0, &store->stopSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget value store semaphore create error: 0x%08llX.", returnCode);
+        goto destroySema;
+    }
+
+    returnCode = osalHandler->TaskCreate("widget_value", DjiTest_WidgetValueStoreTask,
+                                         WIDGET_VALUE_STORE_TASK_STACK_SIZE, store, &store->dispatchThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget value store task create error: 0x%08llX.", returnCode);
+        goto destroyStopSema;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+destroyStopSema:
+    osalHandler->SemaphoreDestroy(store->stopSema);
+    store->stopSema = NULL;
+destroySema:
+    osalHandler->SemaphoreDestroy(store->dispatchSema);
+    store->dispatchSema = NULL;
+    return returnCode;
+}
+
+T_DjiReturnCode DjiTest_WidgetValueStoreDeInit(T_DjiTestWidgetValueStore *store)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    if (store == NULL || store->dispatchThread == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    store->isStopping = true;
+    osalHandler->SemaphorePost(store->dispatchSema);
+    if (osalHandler->SemaphoreTimedWait(store->stopSema, WIDGET_VALUE_STORE_STOP_TIMEOUT_MS) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Wait widget value store task timeout.");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    osalHandler->TaskDestroy(store->dispatchThread);
+    store->dispatchThread = NULL;
+
+    osalHandler->SemaphoreDestroy(store->stopSema);
+    osalHandler->SemaphoreDestroy(store->dispatchSema);
+    store->stopSema = NULL;
+    store->dispatchSema = NULL;
+
+    return returnCode;
+}
+
+/**
+ * @brief Set handler of the widget handler list, it only updates the value and wakes the dispatch task up.
+ * @note A store has a single writer, the widget module calling this handler.
+ */
+T_DjiReturnCode DjiTest_WidgetValueStoreSetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t value,
+                                                       void *userData)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestWidgetValueStore *store = (T_DjiTestWidgetValueStore *) userData;
+    T_DjiTestWidgetValueSlot *slot;
+    uint64_t setTimeUs = 0;
+    uint64_t doneTimeUs = 0;
+
+    if (store == NULL || index >= DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX || !store->slots[index].isUsed) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    USER_UTIL_UNUSED(widgetType);
+    slot = &store->slots[index];
+    osalHandler->GetTimeUs(&setTimeUs);
+
+    slot->lock++;
+    WIDGET_VALUE_STORE_BARRIER();
+    if (slot->type == DJI_WIDGET_TYPE_BUTTON && value == DJI_WIDGET_BUTTON_STATE_PRESS_DOWN) {
+        slot->pressCount++;
+    }
+    slot->value = value;
+    slot->sequence++;
+    slot->setTimeUs = setTimeUs;
+    WIDGET_VALUE_STORE_BARRIER();
+    slot->lock++;
+
+    __sync_fetch_and_add(&store->changeSequence, 1);
+    if (__sync_lock_test_and_set(&store->isDispatchPending, 1) == 0 && store->dispatchSema != NULL) {
+        osalHandler->SemaphorePost(store->dispatchSema);
+    }
+
+    osalHandler->GetTimeUs(&doneTimeUs);
+    store->statistics.setCount++;
+    if (doneTimeUs - setTimeUs > store->statistics.maxSetTimeUs) {
+        store->statistics.maxSetTimeUs = (uint32_t) (doneTimeUs - setTimeUs);
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Get handler of the widget handler list.
+ */
+T_DjiReturnCode DjiTest_WidgetValueStoreGetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t *value,
+                                                       void *userData)
+{
+    T_DjiTestWidgetValueStore *store = (T_DjiTestWidgetValueStore *) userData;
+
+    if (store == NULL || value == NULL || index >= DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX ||
+        !store->slots[index].isUsed) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    USER_UTIL_UNUSED(widgetType);
+    *value = store->slots[index].value;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_WidgetValueStoreGetValue(T_DjiTestWidgetValueStore *store, uint32_t index,
+                                                 T_DjiTestWidgetValue *value)
+{
+    if (store == NULL || value == NULL || index >= DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX ||
+        !store->slots[index].isUsed) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (!DjiTest_WidgetValueStoreReadSlot(&store->slots[index], value)) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Get the number of sets of all the widgets of the store, a change of it means some widget changed.
+ */
+uint32_t DjiTest_WidgetValueStoreGetChangeSequence(const T_DjiTestWidgetValueStore *store)
+{
+    return store != NULL ? store->changeSequence : 0;
+}
+
+/**
+ * @brief Register an observer of a widget, or of every widget with DJI_TEST_WIDGET_VALUE_STORE_ANY_INDEX.
+ * @note Observers can not be removed, they are notified in the order of their registration.
+ */
+T_DjiReturnCode DjiTest_WidgetValueStoreRegObserver(T_DjiTestWidgetValueStore *store, uint32_t index,
+                                                    DjiTestWidgetValueObserver observer, void *userData)
+{
+    T_DjiTestWidgetValueObserverItem *item;
+
+    if (store == NULL || observer == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (store->observerCount >= DJI_TEST_WIDGET_VALUE_STORE_OBSERVER_NUM_MAX) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    item = &store->observers[store->observerCount];
+    item->index = index;
+    item->observer = observer;
+    item->userData = userData;
+    WIDGET_VALUE_STORE_BARRIER();
+    store->observerCount++;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_WidgetValueStoreGetStatistics(const T_DjiTestWidgetValueStore *store,
+                                                      T_DjiTestWidgetValueStoreStatistics *statistics)
+{
+    if (store == NULL || statistics == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    *statistics = store->statistics;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Compare a mocked widget event source whose 1 s button action runs inside the widget handler, as the widget
+ * interaction sample used to, with the value store dispatching to an observer and the action running on its own task.
+ * The source moves a scale at 500 Hz, toggles a switch every 500 ms and presses a button every 3 s.
+ * @param durationMs: duration of each of the two runs.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_WidgetValueStoreRunBenchmark(uint32_t durationMs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestWidgetValueStoreStatistics statistics;
+    T_DjiTestWidgetValueBenchmark inlineResult;
+    T_DjiTaskHandle sourceThread = NULL;
+    T_DjiTaskHandle actionThread = NULL;
+    T_DjiReturnCode returnCode;
+    uint8_t run;
+
+    returnCode = osalHandler->SemaphoreCreate(0, &s_widgetBenchmarkDoneSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget value benchmark semaphore create error: 0x%08llX.", returnCode);
+        return returnCode;
+    }
+    returnCode = osalHandler->SemaphoreCreate(0, &s_widgetBenchmarkActionSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Widget value benchmark semaphore create error: 0x%08llX.", returnCode);
+        goto destroyDoneSema;
+    }
+
+    memset(&inlineResult, 0, sizeof(inlineResult));
+    memset(&statistics, 0, sizeof(statistics));
+    for (run = 0; run < 2; run++) {
+        memset(&s_widgetBenchmark, 0, sizeof(s_widgetBenchmark));
+        s_widgetBenchmark.isInline = run == 0;
+
+        if (!s_widgetBenchmark.isInline) {
+            returnCode = DjiTest_WidgetValueStoreInit(&s_widgetBenchmarkStore, s_widgetBenchmarkHandlerList,
+                                                      sizeof(s_widgetBenchmarkHandlerList) /
+                                                      sizeof(T_DjiWidgetHandlerListItem));
+            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                break;
+            }
+            DjiTest_WidgetValueStoreRegObserver(&s_widgetBenchmarkStore, DJI_TEST_WIDGET_VALUE_STORE_ANY_INDEX,
+                                                DjiTest_WidgetValueBenchmarkObserver, NULL);
+
+            returnCode = osalHandler->TaskCreate("widget_action", DjiTest_WidgetValueBenchmarkActionTask,
+                                                 WIDGET_BENCHMARK_TASK_STACK_SIZE, NULL, &actionThread);
+            if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+                USER_LOG_ERROR("Widget value benchmark task create error: 0x%08llX.", returnCode);
+                DjiTest_WidgetValueStoreDeInit(&s_widgetBenchmarkStore);
+                break;
+            }
+        }
+
+        returnCode = osalHandler->TaskCreate("widget_source", DjiTest_WidgetValueBenchmarkSourceTask,
+                                             WIDGET_BENCHMARK_TASK_STACK_SIZE, NULL, &sourceThread);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Widget value benchmark task create error: 0x%08llX.", returnCode);
+        } else {
+            osalHandler->TaskSleepMs(durationMs);
+        }
+
+        s_widgetBenchmark.isStopping = true;
+        if (sourceThread != NULL) {
+            osalHandler->SemaphoreWait(s_widgetBenchmarkDoneSema);
+            osalHandler->TaskDestroy(sourceThread);
+            sourceThread = NULL;
+        }
+        if (actionThread != NULL) {
+            osalHandler->SemaphorePost(s_widgetBenchmarkActionSema);
+            osalHandler->SemaphoreWait(s_widgetBenchmarkDoneSema);
+            osalHandler->TaskDestroy(actionThread);
+            actionThread = NULL;
+        }
+
+        if (s_widgetBenchmark.isInline) {
+            inlineResult = s_widgetBenchmark;
+        } else {
+            DjiTest_WidgetValueStoreGetStatistics(&s_widgetBenchmarkStore, &statistics);
+            DjiTest_WidgetValueStoreDeInit(&s_widgetBenchmarkStore);
+        }
+
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            break;
+        }
+    }
+
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_INFO("Widget actions in handler: %u events, %u actions, max handler time %u us, scale latency avg "
+                      "%u us max %u us.", inlineResult.eventCount, inlineResult.actionCount,
+                      inlineResult.maxHandlerTimeUs,
+                      (uint32_t) (inlineResult.totalScaleLatencyUs / USER_UTIL_MAX(inlineResult.scaleLatencyCount, 1)),
+                      inlineResult.maxScaleLatencyUs);
+        USER_LOG_INFO("Widget value store: %u events, %u actions, max handler time %u us, %u notifications "
+                      "(%u sets coalesced), dispatch latency avg %u us max %u us.", statistics.setCount,
+                      s_widgetBenchmark.actionCount, statistics.maxSetTimeUs, statistics.notifyCount,
+                      statistics.coalescedCount,
+                      (uint32_t) (statistics.totalDispatchLatencyUs /
+                                  USER_UTIL_MAX(statistics.dispatchLatencyCount, 1)),
+                      statistics.maxDispatchLatencyUs);
+    }
+
+    osalHandler->SemaphoreDestroy(s_widgetBenchmarkActionSema);
+    s_widgetBenchmarkActionSema = NULL;
+destroyDoneSema:
+    osalHandler->SemaphoreDestroy(s_widgetBenchmarkDoneSema);
+    s_widgetBenchmarkDoneSema = NULL;
+
+    return returnCode;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static bool DjiTest_WidgetValueStoreReadSlot(const T_DjiTestWidgetValueSlot *slot, T_DjiTestWidgetValue *value)
+{
+    uint32_t lock;
+    uint8_t retry;
+
+    for (retry = 0; retry < WIDGET_VALUE_STORE_READ_RETRY_TIMES; retry++) {
+        lock = slot->lock;
+        if ((lock & 1) != 0) {
+            continue;
+        }
+        WIDGET_VALUE_STORE_BARRIER();
+        value->type = slot->type;
+        value->value = slot->value;
+        value->sequence = slot->sequence;
+        value->pressCount = slot->pressCount;
+        value->setTimeUs = slot->setTimeUs;
+        WIDGET_VALUE_STORE_BARRIER();
+        if (slot->lock == lock) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void DjiTest_WidgetValueStoreNotify(T_DjiTestWidgetValueStore *store, uint32_t index,
+                                           const T_DjiTestWidgetValue *value)
+{
+    uint32_t observerCount = store->observerCount;
+    uint32_t i;
+
+    WIDGET_VALUE_STORE_BARRIER();
+    for (i = 0; i < observerCount; i++) {
+        if (store->observers[i].index == index || store->observers[i].index == DJI_TEST_WIDGET_VALUE_STORE_ANY_INDEX) {
+            store->observers[i].observer(index, value, store->observers[i].userData);
+            store->statistics.notifyCount++;
+        }
+    }
+}
+
+/**
+ * @brief Notify the changes of every widget set since the last dispatch.
+ * @return False if a widget could not be read because it was being set, the dispatch has to be run again.
+ */
+static bool DjiTest_WidgetValueStoreDispatch(T_DjiTestWidgetValueStore *store)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestWidgetValueSlot *slot;
+    T_DjiTestWidgetValue value;
+    T_DjiTestWidgetValue press;
+    uint64_t nowUs = 0;
+    uint32_t latencyUs;
+    bool isComplete = true;
+    uint32_t index;
+
+    for (index = 0; index < DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX; index++) {
+        slot = &store->slots[index];
+        if (!slot->isUsed || slot->sequence == slot->dispatchedSequence) {
+            continue;
+        }
+
+        if (!DjiTest_WidgetValueStoreReadSlot(slot, &value)) {
+            isComplete = false;
+            continue;
+        }
+
+        osalHandler->GetTimeUs(&nowUs);
+        latencyUs = (uint32_t) (nowUs - value.setTimeUs);
+        store->statistics.totalDispatchLatencyUs += latencyUs;
+        store->statistics.dispatchLatencyCount++;
+        if (latencyUs > store->statistics.maxDispatchLatencyUs) {
+            store->statistics.maxDispatchLatencyUs = latencyUs;
+        }
+        store->statistics.coalescedCount += value.sequence - slot->dispatchedSequence - 1;
+        slot->dispatchedSequence = value.sequence;
+
+        /* Presses are never coalesced, a press and release set within one dispatch still triggers the action. */
+        if (value.type == DJI_WIDGET_TYPE_BUTTON) {
+            press = value;
+            press.value = DJI_WIDGET_BUTTON_STATE_PRESS_DOWN;
+            while (slot->dispatchedPressCount != value.pressCount) {
+                slot->dispatchedPressCount++;
+                press.pressCount = slot->dispatchedPressCount;
+                DjiTest_WidgetValueStoreNotify(store, index, &press);
+                slot->dispatchedValue = DJI_WIDGET_BUTTON_STATE_PRESS_DOWN;
+            }
+        }
+
+        if (value.value != slot->dispatchedValue) {
+            DjiTest_WidgetValueStoreNotify(store, index, &value);
+            slot->dispatchedValue = value.value;
+        }
+    }
+
+    return isComplete;
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-noreturn"
+#pragma GCC diagnostic ignored "-Wreturn-type"
+#endif
+
+static void *DjiTest_WidgetValueStoreTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestWidgetValueStore *store = (T_DjiTestWidgetValueStore *) arg;
+
+    while (1) {
+        osalHandler->SemaphoreWait(store->dispatchSema);
+        if (store->isStopping) {
+            break;
+        }
+
+        /* Cleared before the slots are read, so a value set from now on wakes the task up again. */
+        __sync_lock_release(&store->isDispatchPending);
+        WIDGET_VALUE_STORE_BARRIER();
+        if (!DjiTest_WidgetValueStoreDispatch(store) &&
+            __sync_lock_test_and_set(&store->isDispatchPending, 1) == 0) {
+            osalHandler->SemaphorePost(store->dispatchSema);
+        }
+    }
+
+    osalHandler->SemaphorePost(store->stopSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+static void *DjiTest_WidgetValueBenchmarkSourceTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint64_t startTimeUs = 0;
+    uint64_t scheduledTimeUs;
+    uint64_t nowUs = 0;
+    uint32_t tick;
+
+    USER_UTIL_UNUSED(arg);
+
+    osalHandler->GetTimeUs(&startTimeUs);
+    for (tick = 0; s_widgetBenchmark.isStopping == false; tick++) {
+        scheduledTimeUs = startTimeUs + (uint64_t) tick * WIDGET_BENCHMARK_TICK_US;
+        osalHandler->GetTimeUs(&nowUs);
+        if (nowUs < scheduledTimeUs) {
+            osalHandler->TaskSleepMs((uint32_t) ((scheduledTimeUs - nowUs + 999) / 1000));
+        }
+
+        DjiTest_WidgetValueBenchmarkEmit(DJI_WIDGET_TYPE_SCALE, WIDGET_BENCHMARK_SCALE_INDEX,
+                                         (int32_t) (tick % 101), scheduledTimeUs);
+        if (tick % WIDGET_BENCHMARK_SWITCH_PERIOD_TICKS == 0) {
+            DjiTest_WidgetValueBenchmarkEmit(DJI_WIDGET_TYPE_SWITCH, WIDGET_BENCHMARK_SWITCH_INDEX,
+                                             (int32_t) ((tick / WIDGET_BENCHMARK_SWITCH_PERIOD_TICKS) % 2),
+                                             scheduledTimeUs);
+        }
+        if (tick % WIDGET_BENCHMARK_BUTTON_PERIOD_TICKS == 0) {
+            DjiTest_WidgetValueBenchmarkEmit(DJI_WIDGET_TYPE_BUTTON, WIDGET_BENCHMARK_BUTTON_INDEX,
+                                             DJI_WIDGET_BUTTON_STATE_PRESS_DOWN, scheduledTimeUs);
+            DjiTest_WidgetValueBenchmarkEmit(DJI_WIDGET_TYPE_BUTTON, WIDGET_BENCHMARK_BUTTON_INDEX,
+                                             DJI_WIDGET_BUTTON_STATE_RELEASE_UP, scheduledTimeUs);
+        }
+    }
+
+    osalHandler->SemaphorePost(s_widgetBenchmarkDoneSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+static void *DjiTest_WidgetValueBenchmarkActionTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    USER_UTIL_UNUSED(arg);
+
+    while (1) {
+        osalHandler->SemaphoreWait(s_widgetBenchmarkActionSema);
+        if (s_widgetBenchmark.isStopping) {
+            break;
+        }
+        osalHandler->TaskSleepMs(WIDGET_BENCHMARK_ACTION_TIME_MS);
+        s_widgetBenchmark.actionCount++;
+    }
+
+    osalHandler->SemaphorePost(s_widgetBenchmarkDoneSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
+static void DjiTest_WidgetValueBenchmarkEmit(E_DjiWidgetType widgetType, uint32_t index, int32_t value,
+                                             uint64_t scheduledTimeUs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint64_t startTimeUs = 0;
+    uint64_t doneTimeUs = 0;
+    uint32_t latencyUs;
+
+    s_widgetBenchmark.eventCount++;
+    osalHandler->GetTimeUs(&startTimeUs);
+    if (!s_widgetBenchmark.isInline) {
+        DjiTest_WidgetValueStoreSetWidgetValue(widgetType, index, value, &s_widgetBenchmarkStore);
+        return;
+    }
+
+    /* The old way: the handler runs the action itself before it returns. */
+    if (widgetType == DJI_WIDGET_TYPE_BUTTON && value == DJI_WIDGET_BUTTON_STATE_PRESS_DOWN) {
+        osalHandler->TaskSleepMs(WIDGET_BENCHMARK_ACTION_TIME_MS);
+        s_widgetBenchmark.actionCount++;
+    }
+    osalHandler->GetTimeUs(&doneTimeUs);
+
+    if (doneTimeUs - startTimeUs > s_widgetBenchmark.maxHandlerTimeUs) {
+        s_widgetBenchmark.maxHandlerTimeUs = (uint32_t) (doneTimeUs - startTimeUs);
+    }
+    if (widgetType == DJI_WIDGET_TYPE_SCALE) {
+        latencyUs = (uint32_t) (doneTimeUs - scheduledTimeUs);
+        s_widgetBenchmark.totalScaleLatencyUs += latencyUs;
+        s_widgetBenchmark.scaleLatencyCount++;
+        if (latencyUs > s_widgetBenchmark.maxScaleLatencyUs) {
+            s_widgetBenchmark.maxScaleLatencyUs = latencyUs;
+        }
+    }
+}
+
+static void DjiTest_WidgetValueBenchmarkObserver(uint32_t index, const T_DjiTestWidgetValue *value, void *userData)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    USER_UTIL_UNUSED(userData);
+
+    if (index == WIDGET_BENCHMARK_BUTTON_INDEX && value->value == DJI_WIDGET_BUTTON_STATE_PRESS_DOWN) {
+        osalHandler->SemaphorePost(s_widgetBenchmarkActionSema);
+    }
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,137 @@
+/**
+ ********************************************************************
+ * @file    test_widget_value_store.h
+ * @brief   This is the header file for "test_widget_value_store.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_WIDGET_VALUE_STORE_H
+#define TEST_WIDGET_VALUE_STORE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_platform.h"
+#include "dji_widget.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX      (32)
+#define DJI_TEST_WIDGET_VALUE_STORE_OBSERVER_NUM_MAX    (8)
+#define DJI_TEST_WIDGET_VALUE_STORE_ANY_INDEX           (0xFFFFFFFF)
+
+/* Handlers and user data of a widget handler list item whose value is kept by a store. */
+#define DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(store)     DjiTest_WidgetValueStoreSetWidgetValue, \
+                                                        DjiTest_WidgetValueStoreGetWidgetValue, (store)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    E_DjiWidgetType type;
+    int32_t value;
+    /* Number of times the widget was set since the store was initialized. */
+    uint32_t sequence;
+    /* Number of button presses since the store was initialized, buttons only. */
+    uint32_t pressCount;
+    uint64_t setTimeUs;
+} T_DjiTestWidgetValue;
+
+/**
+ * @brief Prototype of callback function notified from the dispatch task of the store when a widget changed.
+ * @note Values set faster than they are dispatched are coalesced, an observer gets the latest value and a sequence
+ * telling how many sets it covers. Buttons are notified once per press with DJI_WIDGET_BUTTON_STATE_PRESS_DOWN, then
+ * with DJI_WIDGET_BUTTON_STATE_RELEASE_UP when released. An observer must not block, heavy actions belong to a task of
+ * the application.
+ */
+typedef void (*DjiTestWidgetValueObserver)(uint32_t index, const T_DjiTestWidgetValue *value, void *userData);
+
+typedef struct {
+    uint32_t setCount;
+    uint32_t maxSetTimeUs;
+    uint32_t notifyCount;
+    uint32_t coalescedCount;
+    uint32_t maxDispatchLatencyUs;
+    uint64_t totalDispatchLatencyUs;
+    uint32_t dispatchLatencyCount;
+} T_DjiTestWidgetValueStoreStatistics;
+
+typedef struct {
+    volatile uint32_t lock;
+    bool isUsed;
+    E_DjiWidgetType type;
+    int32_t value;
+    uint32_t sequence;
+    uint32_t pressCount;
+    uint64_t setTimeUs;
+    uint32_t dispatchedSequence;
+    uint32_t dispatchedPressCount;
+    int32_t dispatchedValue;
+} T_DjiTestWidgetValueSlot;
+
+typedef struct {
+    uint32_t index;
+    DjiTestWidgetValueObserver observer;
+    void *userData;
+} T_DjiTestWidgetValueObserverItem;
+
+/**
+ * @brief Values of the widgets of a handler list, owned by the application and given as the user data of every item of
+ * the list, whose set and get handlers are DjiTest_WidgetValueStoreSetWidgetValue and
+ * DjiTest_WidgetValueStoreGetWidgetValue. The members are private to test_widget_value_store.c.
+ */
+typedef struct {
+    T_DjiTestWidgetValueSlot slots[DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX];
+    T_DjiTestWidgetValueObserverItem observers[DJI_TEST_WIDGET_VALUE_STORE_OBSERVER_NUM_MAX];
+    volatile uint32_t observerCount;
+    volatile uint32_t changeSequence;
+    volatile uint32_t isDispatchPending;
+    volatile bool isStopping;
+    T_DjiSemaHandle dispatchSema;
+    T_DjiSemaHandle stopSema;
+    T_DjiTaskHandle dispatchThread;
+    T_DjiTestWidgetValueStoreStatistics statistics;
+} T_DjiTestWidgetValueStore;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode DjiTest_WidgetValueStoreInit(T_DjiTestWidgetValueStore *store,
+                                             const T_DjiWidgetHandlerListItem *widgetHandlerList, uint32_t itemCount);
+T_DjiReturnCode DjiTest_WidgetValueStoreDeInit(T_DjiTestWidgetValueStore *store);
+T_DjiReturnCode DjiTest_WidgetValueStoreSetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t value,
+                                                       void *userData);
+T_DjiReturnCode DjiTest_WidgetValueStoreGetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t *value,
+                                                       void *userData);
+T_DjiReturnCode DjiTest_WidgetValueStoreGetValue(T_DjiTestWidgetValueStore *store, uint32_t index,
+                                                 T_DjiTestWidgetValue *value);
+uint32_t DjiTest_WidgetValueStoreGetChangeSequence(const T_DjiTestWidgetValueStore *store);
+T_DjiReturnCode DjiTest_WidgetValueStoreRegObserver(T_DjiTestWidgetValueStore *store, uint32_t index,
+                                                    DjiTestWidgetValueObserver observer, void *userData);
+T_DjiReturnCode DjiTest_WidgetValueStoreGetStatistics(const T_DjiTestWidgetValueStore *store,
+                                                      T_DjiTestWidgetValueStoreStatistics *statistics);
+T_DjiReturnCode DjiTest_WidgetValueStoreRunBenchmark(uint32_t durationMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_WIDGET_VALUE_STORE_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
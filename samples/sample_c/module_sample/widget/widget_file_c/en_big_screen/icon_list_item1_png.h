@@ -1,174 +0,0 @@
-/* Generated by file2c, do not edit manually */
-#ifndef __icon_list_item1_png_h_included
-#define __icon_list_item1_png_h_included
-
-#include <stdint.h>
-
-/* Contents of file icon_list_item1.png */
-#define icon_list_item1_png_fileName        "icon_list_item1.png"
-#define icon_list_item1_png_fileSize        2556
-
-static const uint8_t icon_list_item1_png_fileBinaryArray[2556] = {
-    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77,
-    0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
-    0x09, 0xB6, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x4B, 0x68, 0x14, 0x49, 0x18, 0xC7,
-    0x2B, 0xC9, 0x26, 0x46, 0xB3, 0x9A, 0xB8, 0x6A, 0x7C, 0xC1, 0x62, 0x2E, 0x6A, 0x50, 0x04, 0x89,
-    0x28, 0x22, 0x88, 0x08, 0x2E, 0x01, 0x41, 0x51, 0x41, 0x0F, 0x1E, 0x3C, 0x88, 0x37, 0x1F, 0xE0,
-    0x12, 0xF1, 0xA2, 0x07, 0xBD, 0x99, 0xC3, 0xFA, 0x3A, 0x09, 0x1E, 0x3C, 0x78, 0x50, 0x50, 0x51,
-    0x10, 0xDC, 0x0D, 0x78, 0x8A, 0x07, 0xD1, 0xF8, 0xC6, 0x9B, 0xE0, 0x1E, 0x7C, 0x67, 0x91, 0x2C,
-    0x79, 0x98, 0x87, 0x66, 0xEB, 0x5F, 0x99, 0x7F, 0x6F, 0x75, 0x4D, 0x4D, 0x66, 0x7A, 0x3A, 0xFD,
-    0x98, 0x99, 0xFA, 0xA0, 0xE6, 0xAB, 0xC7, 0x57, 0x55, 0x5D, 0xBF, 0xAF, 0xAB, 0xBA, 0x67, 0xBA,
-    0x66, 0xA6, 0x4A, 0xE4, 0x96, 0x2A, 0xA3, 0xC8, 0x4C, 0x1B, 0xC5, 0x22, 0x5F, 0xB9, 0x69, 0x5F,
-    0xEA, 0xE9, 0xF1, 0x3C, 0x03, 0x30, 0xCB, 0xCD, 0xB4, 0xAA, 0x6E, 0x83, 0xC6, 0x3C, 0x6A, 0x18,
-    0x32, 0x0E, 0xCD, 0xB8, 0x9E, 0x8F, 0x78, 0x25, 0x8B, 0x0E, 0x17, 0x71, 0xA6, 0xA9, 0xC1, 0x86,
-    0x71, 0x6A, 0xC5, 0xEB, 0x27, 0xF5, 0x3A, 0xF1, 0x42, 0xB0, 0xA6, 0xAE, 0x96, 0xC5, 0x04, 0x4F,
-    0x8D, 0x1A, 0x7A, 0x7C, 0xA2, 0x85, 0xCA, 0x7D, 0x05, 0x54, 0x82, 0x65, 0x9C, 0xFA, 0x47, 0x0E,
-    0x2C, 0xCA, 0x5E, 0x77, 0x00, 0xEC, 0x74, 0xF8, 0x04, 0x0F, 0x6D, 0x8B, 0xEB, 0xB6, 0x39, 0xFA,
-    0xA8, 0x88, 0x6C, 0x13, 0x3C, 0x80, 0x23, 0x20, 0x1F, 0x1A, 0x9C, 0x18, 0x87, 0x66, 0x5A, 0x46,
-    0x85, 0xA0, 0x03, 0x90, 0xA9, 0x03, 0x05, 0xF0, 0x1A, 0x19, 0x08, 0x1F, 0x71, 0xA6, 0xA1, 0x61,
-    0x4B, 0xA7, 0xC8, 0xA8, 0x12, 0xD6, 0x67, 0xBA, 0xDC, 0x35, 0xC1, 0x63, 0x9C, 0x3A, 0xE0, 0xEF,
-    0x32, 0x0D, 0xF0, 0xD0, 0x8C, 0x23, 0x0D, 0xA1, 0x63, 0xC8, 0x6A, 0x9C, 0x0E, 0x98, 0x28, 0xFE,
-    0x1F, 0x2C, 0x81, 0x43, 0xC3, 0x86, 0x41, 0xCF, 0xAF, 0x64, 0x27, 0x4C, 0x06, 0x9F, 0xE0, 0xC7,
-    0x24, 0x37, 0x06, 0xE4, 0x51, 0xE8, 0x04, 0x95, 0x06, 0x58, 0x80, 0x64, 0xE0, 0x99, 0x4F, 0xF0,
-    0xB5, 0xB2, 0xCC, 0x0C, 0xA8, 0x43, 0x47, 0xD0, 0x09, 0x32, 0xCB, 0x9B, 0x41, 0x88, 0x57, 0x82,
-    0xD0, 0x09, 0x04, 0xAA, 0x83, 0x1F, 0x95, 0x00, 0x18, 0xC0, 0x14, 0x71, 0x5D, 0x38, 0x23, 0xBC,
-    0x25, 0x08, 0x85, 0xA6, 0x13, 0x00, 0xBE, 0x4E, 0x86, 0x69, 0x86, 0x46, 0x3E, 0x9D, 0xC0, 0x25,
-    0x0A, 0x75, 0x2B, 0x51, 0xB8, 0xF4, 0x00, 0x28, 0x1C, 0x80, 0x33, 0x1E, 0xB0, 0x47, 0x64, 0x18,
-    0x96, 0x01, 0x27, 0x2A, 0xD9, 0xC0, 0x96, 0xF6, 0xC8, 0xA3, 0x03, 0x95, 0x01, 0x40, 0x02, 0x6C,
-    0xBD, 0x0C, 0x3F, 0xCB, 0xF0, 0x8B, 0x0C, 0x0B, 0x65, 0x68, 0x91, 0xA1, 0x75, 0xFF, 0xFE, 0xFD,
-    0xED, 0xEF, 0xDE, 0xBD, 0xFB, 0x73, 0x78, 0x78, 0xB8, 0x77, 0xDC, 0xC9, 0xA4, 0x04, 0xC0, 0x08,
-    0xAC, 0xC0, 0x0C, 0xEC, 0x32, 0x0C, 0xC1, 0x12, 0x4C, 0xC1, 0x16, 0x8C, 0xC1, 0x1A, 0xCC, 0x95,
-    0x73, 0x10, 0x81, 0xA7, 0x70, 0xB6, 0xCF, 0x90, 0xA1, 0x51, 0x86, 0x66, 0x19, 0x7E, 0x95, 0x61,
-    0x19, 0x1A, 0x1A, 0x1D, 0x1D, 0xED, 0x9B, 0xB4, 0x57, 0x57, 0x98, 0x45, 0x00, 0xCC, 0x32, 0x4E,
-    0x58, 0x96, 0x61, 0x09, 0xA6, 0x60, 0x0B, 0xC6, 0x60, 0x0D, 0xE6, 0xD5, 0xF0, 0x00, 0x3D, 0x81,
-    0x65, 0x85, 0xCB, 0x0E, 0xBC, 0x34, 0x5D, 0x86, 0x06, 0xE9, 0xCD, 0xCE, 0x45, 0x8B, 0x16, 0xFD,
-    0x26, 0xE3, 0x4E, 0x02, 0x12, 0x78, 0xFF, 0xFE, 0xFD, 0x5F, 0x8B, 0x17, 0x2F, 0xEE, 0x90, 0xD5,
-    0x06, 0x64, 0x18, 0x92, 0xE1, 0x9B, 0x0C, 0x58, 0x9E, 0xB0, 0x4C, 0x61, 0xB9, 0x1A, 0x07, 0x7C,
-    0x08, 0x1C, 0xC1, 0xC0, 0x19, 0xA1, 0x9C, 0x31, 0x77, 0xEE, 0xDC, 0x36, 0x65, 0xE1, 0x5E, 0x02,
-    0x13, 0xC8, 0xB0, 0xC3, 0xD9, 0x0E, 0x96, 0xEA, 0x8C, 0x97, 0x9A, 0x9C, 0xA1, 0xD5, 0xD9, 0x0F,
-    0xCD, 0x4C, 0xC2, 0xC7, 0x6C, 0x50, 0x33, 0xA2, 0xAE, 0xAE, 0x6E, 0x0E, 0x0C, 0x9C, 0x04, 0x27,
-    0x90, 0x61, 0x07, 0xF8, 0xE4, 0x69, 0x3A, 0xC1, 0x73, 0x00, 0x5B, 0xB7, 0x39, 0x82, 0x65, 0x4E,
-    0x17, 0x47, 0x00, 0xF0, 0xB3, 0xC0, 0xB3, 0x29, 0x2E, 0x41, 0x48, 0xEB, 0xF0, 0x39, 0x13, 0x50,
-    0xD1, 0x49, 0x38, 0x02, 0x60, 0x48, 0x07, 0x80, 0x2B, 0x39, 0xAB, 0x56, 0x99, 0x81, 0x04, 0x0A,
-    0x20, 0x34, 0x80, 0xD6, 0x1D, 0xA4, 0x0A, 0xDD, 0x4B, 0x60, 0x02, 0x64, 0x4C, 0xAE, 0x68, 0xC0,
-    0x63, 0x4D, 0xC0, 0x5E, 0x46, 0xA6, 0x79, 0xC2, 0x67, 0x79, 0xE0, 0x5E, 0x5D, 0x05, 0x8F, 0x00,
-    0x18, 0xD2, 0x09, 0xC8, 0xF4, 0xB1, 0xB6, 0x01, 0xA6, 0x81, 0xD7, 0x82, 0x8B, 0x4C, 0x19, 0x81,
-    0x2C, 0xB6, 0x36, 0x07, 0xA0, 0x37, 0x18, 0x32, 0x4C, 0x59, 0xEF, 0x15, 0xDA, 0x10, 0x39, 0x66,
-    0xC1, 0x07, 0x8F, 0x5C, 0x0E, 0xA8, 0x50, 0x56, 0xF1, 0x0F, 0xDB, 0x39, 0x20, 0x7E, 0xE6, 0xBE,
-    0x1E, 0x9D, 0x03, 0x7C, 0x38, 0xE2, 0x4F, 0x38, 0x07, 0xC4, 0xCF, 0xDC, 0xD7, 0xA3, 0x73, 0x80,
-    0x0F, 0x47, 0xFC, 0x09, 0xE7, 0x80, 0xF8, 0x99, 0xFB, 0x7A, 0x74, 0x0E, 0xF0, 0xE1, 0x88, 0x3F,
-    0xE1, 0x1C, 0x10, 0x3F, 0x73, 0x5F, 0x8F, 0xCE, 0x01, 0x3E, 0x1C, 0xF1, 0x27, 0xF0, 0x51, 0x69,
-    0x6A, 0x64, 0x68, 0x68, 0x48, 0xDC, 0xBA, 0x75, 0x4B, 0x3C, 0x7C, 0xF8, 0x50, 0x7C, 0xFC, 0xF8,
-    0x51, 0x1D, 0xD7, 0x82, 0x05, 0x0B, 0xC4, 0xBA, 0x75, 0xEB, 0xC4, 0x8E, 0x1D, 0x3B, 0xC4, 0xF4,
-    0xE9, 0x78, 0x48, 0x57, 0x5E, 0x82, 0xB7, 0xC7, 0xFC, 0xB8, 0x14, 0x0F, 0x0E, 0xB0, 0x03, 0x02,
-    0xCF, 0x2C, 0xF1, 0xF0, 0x78, 0x96, 0x0C, 0x8D, 0xF2, 0x61, 0xE7, 0x5F, 0x52, 0x47, 0x2E, 0x2F,
-    0x5E, 0xBC, 0x10, 0xE7, 0xCF, 0x9F, 0x17, 0x5F, 0xBE, 0x7C, 0xB1, 0xF6, 0x35, 0x6F, 0xDE, 0x3C,
-    0x71, 0xF8, 0xF0, 0x61, 0xB1, 0x6A, 0xD5, 0x2A, 0x6B, 0x79, 0x5A, 0x33, 0xAB, 0xAA, 0xAA, 0xF0,
-    0x38, 0xB7, 0x4F, 0x86, 0x7F, 0x65, 0xE8, 0x97, 0x61, 0x50, 0x06, 0xEC, 0x98, 0xC0, 0x63, 0xC9,
-    0xEF, 0xA9, 0x58, 0x82, 0x00, 0xFF, 0xC4, 0x89, 0x13, 0x39, 0xE1, 0xCB, 0x03, 0x55, 0x65, 0xB0,
-    0x79, 0xF9, 0xF2, 0x25, 0x92, 0x65, 0x23, 0x89, 0x3B, 0x00, 0xCB, 0x0E, 0xCE, 0xFC, 0x42, 0xE5,
-    0xDC, 0xB9, 0x73, 0x02, 0x75, 0xCA, 0x45, 0x12, 0x77, 0x00, 0xD6, 0xFC, 0x5C, 0xCB, 0x8E, 0x0D,
-    0x32, 0x6C, 0x51, 0xA7, 0x5C, 0x24, 0x71, 0x07, 0xE0, 0x82, 0x1B, 0x54, 0x8A, 0xA9, 0x13, 0xB4,
-    0x8F, 0xB8, 0xEC, 0x13, 0xBF, 0x0B, 0xE2, 0xDD, 0x4E, 0x90, 0x01, 0x17, 0x53, 0x27, 0x57, 0xFB,
-    0xDB, 0xB7, 0x6F, 0xCF, 0x55, 0xE4, 0xCB, 0xBF, 0x7D, 0xFB, 0xB6, 0x2F, 0x3D, 0x55, 0x89, 0xC4,
-    0x67, 0xC0, 0xB7, 0x6F, 0xD8, 0xAB, 0x14, 0x4C, 0x8A, 0xA9, 0x13, 0xAC, 0x87, 0xF8, 0xAC, 0x13,
-    0x77, 0x40, 0x7C, 0x43, 0x4D, 0x67, 0x4F, 0xCE, 0x01, 0x09, 0xFB, 0x25, 0xF1, 0x6B, 0x40, 0x31,
-    0xE3, 0x97, 0x6F, 0x6E, 0x8A, 0xA9, 0x66, 0xAD, 0x13, 0xD5, 0xDA, 0x6E, 0xED, 0xCC, 0x92, 0xE9,
-    0x66, 0x80, 0x05, 0x4A, 0x9C, 0x59, 0xCE, 0x01, 0x71, 0xD2, 0xB6, 0xF4, 0x55, 0x92, 0x0E, 0x98,
-    0xCA, 0x25, 0xC8, 0xC2, 0x24, 0xD6, 0xAC, 0x92, 0xBC, 0x06, 0x4C, 0x05, 0xA1, 0x42, 0xEF, 0xFF,
-    0xD9, 0x57, 0x54, 0xD7, 0x8A, 0x92, 0x9C, 0x01, 0x84, 0x52, 0x0E, 0xBA, 0x24, 0x1D, 0x50, 0x4E,
-    0x4B, 0x50, 0x49, 0x3A, 0xA0, 0x1C, 0xCE, 0x7C, 0x8E, 0xA1, 0x24, 0xAF, 0x01, 0x53, 0x31, 0x03,
-    0xA2, 0x5A, 0xD3, 0x09, 0xB6, 0x50, 0xED, 0x66, 0x40, 0xA1, 0xA4, 0x22, 0xB2, 0x8B, 0x6C, 0x06,
-    0xEC, 0xD9, 0xB3, 0x47, 0xE8, 0x1F, 0x9A, 0xE1, 0x41, 0xCA, 0x92, 0x25, 0x4B, 0x22, 0x1A, 0xC6,
-    0x44, 0xB3, 0x6F, 0xDF, 0xBE, 0x15, 0x47, 0x8E, 0x1C, 0xF1, 0xFA, 0xA8, 0xAF, 0xAF, 0x17, 0xD7,
-    0xAE, 0x5D, 0xF3, 0xD2, 0x69, 0x8C, 0x44, 0x36, 0x03, 0xE6, 0xCC, 0xF1, 0x7F, 0xB7, 0xAF, 0xB7,
-    0xB7, 0xD7, 0x3A, 0x7E, 0x40, 0x0A, 0x2A, 0xB9, 0xEA, 0x98, 0x7D, 0x98, 0xC7, 0x10, 0xB4, 0x9F,
-    0x38, 0xEC, 0x23, 0x9B, 0x01, 0x4D, 0x4D, 0x4D, 0x42, 0x7E, 0xC7, 0xD8, 0x1B, 0x43, 0xAE, 0xA7,
-    0x5E, 0xD8, 0xF5, 0x80, 0x33, 0x37, 0x88, 0x2C, 0x5C, 0x88, 0x2F, 0x9E, 0x67, 0x8B, 0xD9, 0x07,
-    0x8E, 0xC1, 0x94, 0xA0, 0xF7, 0xFF, 0xAC, 0x1F, 0xD5, 0x35, 0x23, 0xB2, 0x19, 0xB0, 0x74, 0xE9,
-    0x52, 0x1E, 0xBB, 0xD2, 0x8F, 0x1F, 0x3F, 0xF6, 0xA5, 0x99, 0xC0, 0x96, 0x93, 0xA0, 0xB2, 0x76,
-    0xED, 0x5A, 0x6B, 0x95, 0x47, 0x8F, 0x1E, 0xF9, 0xF2, 0xCD, 0x63, 0xF0, 0x15, 0xA6, 0x24, 0x11,
-    0x99, 0x03, 0x4C, 0x48, 0xCF, 0x9E, 0x3D, 0x13, 0x03, 0x03, 0xF8, 0xC2, 0xB8, 0x5F, 0xB0, 0xDF,
-    0x07, 0x5B, 0x4E, 0x0A, 0x95, 0xF9, 0xF3, 0xE7, 0x0B, 0xDB, 0x59, 0x8C, 0xB6, 0x9F, 0x3F, 0x7F,
-    0xEE, 0x6B, 0xC6, 0x3C, 0x06, 0x5F, 0x61, 0x4A, 0x12, 0x91, 0x39, 0x60, 0xF9, 0xF2, 0xE5, 0x62,
-    0xE6, 0xCC, 0x99, 0xDE, 0x30, 0xC7, 0xC6, 0xC6, 0xAC, 0x0F, 0xD3, 0xB1, 0xD9, 0x0A, 0xFB, 0x7D,
-    0x0A, 0x15, 0x5C, 0x64, 0xA7, 0x4D, 0xC3, 0xF6, 0x25, 0xBF, 0xDC, 0xBC, 0x79, 0x53, 0xA0, 0x0F,
-    0x0A, 0xFA, 0xC6, 0x31, 0xA4, 0x5D, 0x22, 0xDD, 0x98, 0x75, 0xFD, 0xFA, 0x75, 0x71, 0xF5, 0xEA,
-    0x55, 0x8F, 0x41, 0x6D, 0x6D, 0xAD, 0xB8, 0x70, 0xE1, 0x82, 0xB0, 0xAD, 0xE1, 0xF9, 0x36, 0x66,
-    0x35, 0x37, 0x37, 0xAB, 0x3B, 0x9C, 0x95, 0x2B, 0x57, 0x7A, 0xED, 0x31, 0xF2, 0xE1, 0xC3, 0x07,
-    0x71, 0xE8, 0xD0, 0x21, 0x21, 0x7F, 0x20, 0x83, 0x59, 0x62, 0xEF, 0xDE, 0xBD, 0x62, 0xF7, 0xEE,
-    0xDD, 0x5E, 0x3A, 0xA9, 0x88, 0x7C, 0xCF, 0x92, 0xDC, 0xC6, 0xAC, 0x6D, 0xDB, 0xB6, 0x89, 0xC6,
-    0x46, 0xFC, 0x40, 0xC8, 0x84, 0x00, 0x50, 0x67, 0x67, 0xA7, 0x75, 0x5F, 0x0F, 0x76, 0xBC, 0xC1,
-    0x39, 0xB8, 0x7D, 0xC5, 0xED, 0x2A, 0xEE, 0x74, 0x10, 0x10, 0x47, 0x1E, 0xF6, 0x0E, 0xD9, 0xE0,
-    0x63, 0x8F, 0x10, 0xDA, 0xD4, 0xE1, 0xCF, 0x9A, 0x35, 0x4B, 0xA0, 0xEF, 0x52, 0x90, 0x48, 0x67,
-    0x00, 0x00, 0x74, 0x75, 0x75, 0x89, 0x8B, 0x17, 0x2F, 0xFA, 0x58, 0x00, 0xF6, 0xC9, 0x93, 0x27,
-    0x05, 0x66, 0x44, 0x18, 0x01, 0xF4, 0x53, 0xA7, 0x4E, 0x09, 0xCC, 0x1E, 0x5D, 0x0E, 0x1E, 0x3C,
-    0x28, 0xB6, 0x6C, 0xD9, 0xA2, 0x67, 0x25, 0x16, 0x4F, 0x74, 0x06, 0x60, 0xD4, 0x00, 0xB1, 0x69,
-    0xD3, 0x26, 0x1F, 0x00, 0x00, 0xEB, 0xE8, 0xE8, 0x10, 0xF2, 0xE7, 0x5C, 0x7C, 0xF9, 0x41, 0x12,
-    0xA8, 0x8B, 0x36, 0x4C, 0xF8, 0xE8, 0x2B, 0x2D, 0xF0, 0x0B, 0x19, 0x4F, 0xE4, 0x33, 0x00, 0x07,
-    0x31, 0x32, 0x32, 0x22, 0x8E, 0x1F, 0x3F, 0x2E, 0xDE, 0xBC, 0x79, 0xE3, 0x3B, 0x26, 0x5C, 0x80,
-    0x77, 0xED, 0xDA, 0x25, 0xB6, 0x6E, 0xDD, 0x2A, 0x66, 0xCC, 0xC0, 0x9E, 0xE0, 0xFC, 0x32, 0x38,
-    0x38, 0x28, 0xEE, 0xDE, 0xBD, 0x2B, 0x6E, 0xDC, 0xB8, 0x91, 0xB5, 0x94, 0xB5, 0xB4, 0xB4, 0x88,
-    0x33, 0x67, 0xCE, 0x08, 0xF9, 0x2B, 0x25, 0x59, 0x0D, 0xD9, 0xEE, 0x9C, 0xB2, 0x8C, 0x26, 0xC9,
-    0x28, 0xF6, 0x7D, 0x40, 0xBE, 0x19, 0x10, 0x8B, 0x03, 0x30, 0x2E, 0x80, 0x3B, 0x7D, 0xFA, 0xB4,
-    0x78, 0xFD, 0xFA, 0x75, 0xD6, 0x30, 0x1B, 0x1A, 0x1A, 0xC4, 0xE6, 0xCD, 0x9B, 0x45, 0x5B, 0x5B,
-    0x9B, 0x5A, 0xE7, 0xCD, 0xA5, 0x09, 0x4B, 0xCD, 0xAB, 0x57, 0xAF, 0x44, 0x4F, 0x4F, 0x8F, 0xB8,
-    0x7F, 0xFF, 0xBE, 0xF5, 0x76, 0xB6, 0xB5, 0xB5, 0x55, 0x6D, 0xF0, 0x45, 0x5B, 0x36, 0xA9, 0x78,
-    0x07, 0x00, 0x0A, 0x66, 0xC2, 0xD9, 0xB3, 0x67, 0xC5, 0x83, 0x07, 0x0F, 0x6C, 0x8C, 0x54, 0x5E,
-    0x75, 0x75, 0xB5, 0xBA, 0x70, 0xCF, 0x9E, 0x3D, 0x5B, 0xA5, 0xBF, 0x7E, 0xFD, 0x2A, 0xFA, 0xFA,
-    0xFA, 0xC4, 0x8F, 0x1F, 0xDE, 0x0F, 0x0D, 0x66, 0xD5, 0x5D, 0xBF, 0x7E, 0xBD, 0x38, 0x7A, 0xF4,
-    0xA8, 0xF5, 0xCC, 0xA7, 0x71, 0x5A, 0x1D, 0x10, 0xD9, 0x47, 0x11, 0x1C, 0xB8, 0xAE, 0xB1, 0x34,
-    0x1C, 0x3B, 0x76, 0x4C, 0x74, 0x77, 0x77, 0x8B, 0x4B, 0x97, 0x2E, 0x29, 0xB0, 0x7A, 0x39, 0xE2,
-    0x00, 0x0D, 0xE8, 0x08, 0xF9, 0x04, 0x77, 0x3B, 0x07, 0x0E, 0x1C, 0x10, 0x1B, 0x37, 0x6E, 0xCC,
-    0x67, 0x9A, 0xDA, 0xF2, 0xD8, 0x96, 0x20, 0x93, 0x40, 0x7F, 0x7F, 0xBF, 0xB8, 0x73, 0xE7, 0x8E,
-    0xB8, 0x77, 0xEF, 0x9E, 0xD5, 0x11, 0xA6, 0xBD, 0x9E, 0x06, 0xF8, 0xF6, 0xF6, 0x76, 0x75, 0xAB,
-    0xA9, 0xBF, 0xD9, 0xD3, 0x6D, 0xD2, 0x12, 0x4F, 0xCD, 0x35, 0x20, 0x17, 0x10, 0xBC, 0x7B, 0xC5,
-    0x92, 0xF4, 0xE4, 0xC9, 0x13, 0x75, 0x7D, 0xF8, 0xFC, 0xF9, 0xB3, 0xD5, 0x14, 0x1F, 0x57, 0xAC,
-    0x58, 0xB1, 0x42, 0xAC, 0x5E, 0xBD, 0x5A, 0x6C, 0xD8, 0xB0, 0x21, 0xF4, 0x2D, 0xAC, 0xB5, 0x93,
-    0x08, 0x32, 0x53, 0xEF, 0x00, 0x73, 0xCC, 0xF8, 0x48, 0xE1, 0xCA, 0x95, 0x2B, 0xBE, 0xEC, 0x7D,
-    0xFB, 0xF6, 0x89, 0x9D, 0x3B, 0x77, 0xFA, 0xF2, 0x4A, 0x25, 0x91, 0xCF, 0x01, 0x91, 0x7D, 0x16,
-    0x54, 0x2C, 0x20, 0xDB, 0x2D, 0xA4, 0x2D, 0xAF, 0xD8, 0xF6, 0xD3, 0x56, 0x2F, 0xD6, 0x8B, 0x70,
-    0x12, 0x83, 0x0F, 0x7B, 0xF7, 0xC3, 0x63, 0x2E, 0xF6, 0x7D, 0x00, 0xEB, 0xE7, 0xD2, 0xA9, 0x9B,
-    0x01, 0xB9, 0x0E, 0xB4, 0x5C, 0xF3, 0x9D, 0x03, 0x12, 0xF6, 0xAC, 0x73, 0x40, 0xC2, 0x0E, 0x28,
-    0xFB, 0x6B, 0x40, 0x54, 0x6B, 0xF7, 0x54, 0xF9, 0xCD, 0xCD, 0x80, 0xA9, 0x22, 0x59, 0x64, 0x3B,
-    0x89, 0xBD, 0x13, 0x2E, 0xF2, 0x78, 0x4B, 0xAE, 0x5A, 0xC9, 0xBD, 0x0F, 0x28, 0x39, 0xC2, 0x21,
-    0x0F, 0xD8, 0x2D, 0x41, 0x21, 0x01, 0x86, 0xAD, 0xEE, 0x1C, 0x10, 0x96, 0x60, 0xC8, 0xFA, 0xCE,
-    0x01, 0x21, 0x01, 0x86, 0xAD, 0xEE, 0x1C, 0x10, 0x96, 0x60, 0xC8, 0xFA, 0xB9, 0x1C, 0xC0, 0xBF,
-    0x5C, 0xF2, 0xFE, 0x6A, 0x29, 0x64, 0x3F, 0x95, 0x5C, 0x7D, 0x52, 0x96, 0x36, 0x07, 0x38, 0xE8,
-    0xD1, 0x9D, 0x2E, 0x59, 0x6C, 0xE9, 0x00, 0x16, 0xE8, 0x1A, 0x0F, 0x61, 0x73, 0x3F, 0x88, 0x8D,
-    0xEE, 0x20, 0xCB, 0xAD, 0x65, 0x72, 0xD4, 0xD9, 0x62, 0x8C, 0x2A, 0x0D, 0x07, 0xD8, 0x0A, 0x90,
-    0x87, 0xE0, 0x1C, 0x20, 0x21, 0x84, 0x14, 0x30, 0x24, 0xCF, 0x2C, 0xD6, 0x9C, 0x01, 0xE8, 0x83,
-    0x46, 0xF4, 0x18, 0xFF, 0x1B, 0x31, 0x64, 0xFF, 0x15, 0x5F, 0x9D, 0x1C, 0xC9, 0x95, 0x9C, 0x15,
-    0x18, 0xDD, 0x01, 0xC8, 0x60, 0x21, 0x8C, 0xF9, 0xDF, 0x88, 0xCA, 0xD0, 0xBD, 0x14, 0x4D, 0x00,
-    0x5B, 0xB6, 0xC1, 0x52, 0x9F, 0x09, 0x5E, 0x63, 0x74, 0x80, 0x0D, 0xBC, 0xFA, 0x63, 0x4A, 0xB9,
-    0x97, 0xE7, 0x1F, 0xCF, 0xDA, 0x45, 0x02, 0x11, 0xC8, 0xB0, 0xE3, 0xBF, 0xE6, 0x59, 0x1D, 0x61,
-    0x3A, 0x00, 0x8E, 0xE0, 0xD9, 0x8F, 0x8A, 0x23, 0xF2, 0x7B, 0x57, 0x3D, 0x81, 0x7A, 0x75, 0xC6,
-    0x1E, 0x81, 0x0C, 0x3B, 0xFE, 0x75, 0xA1, 0x39, 0x0B, 0xC0, 0xDA, 0xF7, 0x17, 0x26, 0x3A, 0x7C,
-    0x75, 0xF6, 0xCB, 0xF2, 0x61, 0xB9, 0x8B, 0xF9, 0x0F, 0xB9, 0x75, 0x04, 0x3F, 0x3A, 0xEA, 0x24,
-    0x00, 0x01, 0x30, 0x03, 0x3B, 0x59, 0x85, 0x3F, 0xD2, 0x6A, 0xCE, 0x00, 0xD5, 0x9A, 0xFE, 0x47,
-    0x6D, 0xF8, 0x68, 0x3A, 0x2B, 0x3C, 0x7D, 0xFA, 0x74, 0x40, 0xEE, 0x44, 0xEE, 0x5A, 0xB3, 0x66,
-    0x4D, 0xB3, 0xFC, 0x66, 0x4A, 0x53, 0x4D, 0x4D, 0x4D, 0x61, 0xBB, 0x68, 0x03, 0x1C, 0x6C, 0x39,
-    0x99, 0x62, 0xD9, 0xF9, 0xF4, 0xE9, 0x53, 0xF7, 0xEF, 0x52, 0x2E, 0x5F, 0xBE, 0xFC, 0xB7, 0x1C,
-    0x1B, 0x1C, 0xC0, 0x59, 0xA0, 0x3B, 0x41, 0x5D, 0x13, 0x74, 0xE0, 0x58, 0x8E, 0x10, 0xF0, 0x94,
-    0x0C, 0x01, 0x5B, 0x8C, 0x11, 0xF0, 0x7D, 0x20, 0x5D, 0x63, 0x53, 0x3F, 0xCA, 0xCD, 0x7F, 0x87,
-    0x93, 0x59, 0x15, 0x27, 0x5C, 0x35, 0xB8, 0x6C, 0x73, 0xE5, 0x00, 0x70, 0x82, 0xA7, 0x46, 0x1E,
-    0xCA, 0x11, 0x60, 0xAF, 0x1C, 0xA0, 0x3F, 0x92, 0x44, 0x63, 0x6C, 0x10, 0xEB, 0x15, 0xBF, 0xEF,
-    0x83, 0x3C, 0xDE, 0x11, 0xA1, 0x11, 0xC2, 0x87, 0x03, 0xE0, 0x40, 0x5E, 0x47, 0x10, 0xAF, 0x24,
-    0x01, 0x17, 0x88, 0x02, 0x29, 0x35, 0x18, 0x91, 0x13, 0xD8, 0x99, 0x01, 0x65, 0xB4, 0x65, 0x5D,
-    0x05, 0xD3, 0x4B, 0x64, 0x0C, 0xA4, 0xF2, 0x04, 0x65, 0xA8, 0xC4, 0x86, 0xE1, 0x00, 0xFE, 0xD8,
-    0x37, 0xE1, 0xEB, 0xE0, 0xF5, 0xB8, 0xD7, 0x48, 0x19, 0x46, 0x74, 0x66, 0x64, 0x04, 0x4D, 0x27,
-    0x90, 0x17, 0xCF, 0x78, 0x3D, 0x5F, 0x77, 0xC2, 0xB8, 0x3E, 0x03, 0xC0, 0x89, 0x8D, 0x91, 0x19,
-    0xD3, 0x6C, 0x10, 0x67, 0xBB, 0x7E, 0xE6, 0xEB, 0xC0, 0xF5, 0x38, 0xEB, 0x97, 0xB3, 0x06, 0x1B,
-    0x0A, 0x39, 0x41, 0x83, 0x15, 0x4F, 0x5A, 0xC6, 0x99, 0x26, 0x7C, 0xD6, 0x53, 0x4B, 0x08, 0x13,
-    0x00, 0x48, 0x88, 0xD0, 0x80, 0x4D, 0x6D, 0x8B, 0xEB, 0xB6, 0x6C, 0xA3, 0x12, 0x35, 0x1D, 0x01,
-    0x4D, 0x47, 0x10, 0x34, 0xB4, 0x1E, 0x37, 0x6D, 0x3D, 0xE0, 0x00, 0x67, 0x02, 0x65, 0x9A, 0xF0,
-    0x91, 0x66, 0xA0, 0x3D, 0x6D, 0x90, 0xAE, 0x64, 0x21, 0x7C, 0x30, 0x60, 0x9C, 0x1A, 0x0E, 0x80,
-    0xE8, 0xF0, 0xBD, 0xB4, 0x0D, 0x20, 0xF3, 0xA8, 0x61, 0xCC, 0x38, 0x34, 0xE3, 0x7A, 0x3E, 0xE2,
-    0x95, 0x2C, 0x84, 0x0B, 0x06, 0x04, 0xCF, 0x38, 0xB9, 0xD0, 0x86, 0x5A, 0xE5, 0xEB, 0x30, 0x69,
-    0x48, 0x6D, 0x96, 0x99, 0x69, 0xDA, 0x51, 0xE7, 0x2B, 0xA7, 0x5D, 0xB9, 0x68, 0x1F, 0x48, 0xCB,
-    0xA0, 0xCC, 0x72, 0x33, 0xAD, 0xAA, 0xFC, 0x07, 0x9A, 0xB8, 0xA2, 0x7E, 0x27, 0xE3, 0x05, 0x8D,
-    0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-#endif    /* __icon_list_item1_png_h_included */
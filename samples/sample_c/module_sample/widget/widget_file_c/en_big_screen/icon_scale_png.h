@@ -1,167 +0,0 @@
-/* Generated by file2c, do not edit manually */
-#ifndef __icon_scale_png_h_included
-#define __icon_scale_png_h_included
-
-#include <stdint.h>
-
-/* Contents of file icon_scale.png */
-#define icon_scale_png_fileName        "icon_scale.png"
-#define icon_scale_png_fileSize        2440
-
-static const uint8_t icon_scale_png_fileBinaryArray[2440] = {
-    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77,
-    0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
-    0x09, 0x42, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x3D, 0x6C, 0x14, 0x47, 0x18, 0x86,
-    0xC7, 0x7F, 0xB1, 0x63, 0x62, 0x40, 0x60, 0x59, 0xA0, 0x28, 0x41, 0x58, 0x71, 0x65, 0xD1, 0x20,
-    0x04, 0x28, 0xA2, 0x43, 0x4A, 0x13, 0x22, 0x6A, 0x6A, 0x0A, 0x6A, 0x90, 0x50, 0x08, 0xA4, 0x8A,
-    0x82, 0x80, 0x06, 0x8A, 0x54, 0x29, 0xA8, 0xA1, 0x04, 0xC9, 0x69, 0xA2, 0xD0, 0x11, 0x09, 0x08,
-    0x94, 0x69, 0xB1, 0x1C, 0x09, 0x03, 0x12, 0x20, 0x62, 0x02, 0x21, 0xF8, 0x2F, 0xF3, 0xAC, 0xEF,
-    0x5D, 0xCD, 0xCD, 0xFD, 0xAC, 0xEF, 0x67, 0x77, 0xD6, 0xBE, 0xF9, 0xA4, 0xF1, 0xCC, 0xCE, 0xEC,
-    0x7C, 0xB3, 0xF3, 0xBC, 0x33, 0xB3, 0x7B, 0xB7, 0xEB, 0xDB, 0x3E, 0xD3, 0xDC, 0xFA, 0xBC, 0x62,
-    0x7F, 0xDB, 0x2B, 0x36, 0x59, 0xE5, 0xFE, 0xFE, 0x1B, 0x75, 0x7B, 0x35, 0xE3, 0xC0, 0xFD, 0x72,
-    0x7F, 0x3B, 0xAD, 0xDE, 0x08, 0x98, 0xF2, 0x15, 0x53, 0x41, 0x69, 0x62, 0xA5, 0xDD, 0x7C, 0xD2,
-    0xBD, 0x68, 0x2E, 0x5C, 0xD2, 0xDA, 0x56, 0x0C, 0x13, 0xA5, 0x15, 0xA7, 0x9C, 0x06, 0xD3, 0xD4,
-    0x5A, 0x42, 0x60, 0xDD, 0x58, 0xC0, 0xFD, 0x98, 0x1A, 0xCA, 0xF3, 0xDC, 0xF4, 0xD4, 0x26, 0x50,
-    0x05, 0x56, 0x69, 0x3F, 0xF6, 0x81, 0x68, 0xFF, 0xBA, 0x23, 0x59, 0x50, 0xDD, 0xB8, 0xDF, 0x7A,
-    0x50, 0x20, 0x9F, 0xB4, 0xCA, 0x71, 0x4E, 0xBA, 0x17, 0x4D, 0x20, 0x05, 0x7C, 0xC5, 0x42, 0x20,
-    0x4D, 0xAC, 0xA0, 0x32, 0x37, 0x86, 0x15, 0xDB, 0xA6, 0xDE, 0x0C, 0x10, 0x58, 0x01, 0x1F, 0xB0,
-    0xFB, 0x91, 0xF6, 0x63, 0x57, 0x08, 0x7C, 0x61, 0xBD, 0x22, 0x44, 0x02, 0x6F, 0xAD, 0xCB, 0x29,
-    0x70, 0xF2, 0x80, 0xBE, 0xDC, 0x20, 0xA6, 0x4C, 0x96, 0xD6, 0x97, 0x00, 0x82, 0xAE, 0x58, 0xC0,
-    0x81, 0x4E, 0x18, 0xAA, 0xC4, 0xEC, 0xAF, 0x3C, 0x09, 0xA4, 0x3A, 0xB6, 0x28, 0xB1, 0xCD, 0x2E,
-    0x42, 0x0A, 0xCF, 0xF6, 0x96, 0xB4, 0xC0, 0x0B, 0x3E, 0x02, 0x2C, 0xD9, 0x40, 0xBC, 0x68, 0x03,
-    0x3C, 0x48, 0x63, 0xAE, 0x08, 0x6C, 0xAF, 0x4A, 0x00, 0x36, 0x30, 0x76, 0x76, 0xE1, 0x03, 0xDE,
-    0x0F, 0xD4, 0x91, 0x10, 0xAE, 0x08, 0x36, 0xBB, 0xE7, 0x66, 0x80, 0x0F, 0x1F, 0xF0, 0x04, 0xC0,
-    0x13, 0xE0, 0x43, 0xEC, 0x1A, 0x22, 0xA4, 0x22, 0x02, 0x52, 0x23, 0x58, 0xB1, 0x04, 0x00, 0xFC,
-    0x47, 0x95, 0x30, 0xEC, 0xA4, 0xC9, 0xD3, 0x8C, 0xD0, 0xB2, 0xA4, 0xBA, 0xB6, 0xA8, 0x67, 0xCC,
-    0x1D, 0xFD, 0x8C, 0x70, 0x8D, 0xF8, 0x0F, 0x36, 0xAD, 0x00, 0x4B, 0xD8, 0xC8, 0x54, 0xC7, 0xCD,
-    0x4B, 0x47, 0x3D, 0x62, 0x00, 0x77, 0x8B, 0x0D, 0xDB, 0x6C, 0x98, 0xB0, 0xE1, 0x33, 0x1B, 0xA6,
-    0x6C, 0xD8, 0x77, 0xEA, 0xD4, 0xA9, 0x6F, 0x1E, 0x3F, 0x7E, 0x3C, 0xB3, 0xB0, 0xB0, 0x30, 0xBB,
-    0xBA, 0xBA, 0xBA, 0x6C, 0x43, 0xB4, 0x6A, 0x02, 0xCB, 0xB0, 0x81, 0x11, 0xAC, 0x60, 0x56, 0x61,
-    0x07, 0x43, 0x58, 0xC2, 0x14, 0xB6, 0x30, 0x86, 0x75, 0x2A, 0x0E, 0x6A, 0xB0, 0xC1, 0xA8, 0x1E,
-    0xB1, 0x61, 0xCC, 0x86, 0x71, 0x1B, 0x3E, 0xB5, 0xE1, 0x0B, 0x1B, 0xF6, 0xDD, 0xBA, 0x75, 0xEB,
-    0xDB, 0xA5, 0xA5, 0xA5, 0xB7, 0xD5, 0xED, 0xC5, 0xAD, 0x46, 0x04, 0x60, 0x05, 0x33, 0xD8, 0x55,
-    0x18, 0xC2, 0x12, 0xA6, 0xB0, 0x85, 0x31, 0xAC, 0x13, 0x01, 0xDC, 0x25, 0x84, 0x0C, 0x9D, 0x70,
-    0xD9, 0x81, 0x65, 0x67, 0xC4, 0xAA, 0x39, 0x79, 0xFA, 0xF4, 0xE9, 0x9F, 0x06, 0x06, 0x06, 0x46,
-    0xED, 0x76, 0xB4, 0x75, 0x10, 0xE8, 0xEF, 0xEF, 0x1F, 0x9A, 0x9A, 0x9A, 0xFA, 0xF2, 0xF9, 0xF3,
-    0xE7, 0xBF, 0x3D, 0x7A, 0xF4, 0x68, 0xC1, 0x56, 0xD1, 0x09, 0x9A, 0x58, 0xE7, 0x80, 0xE4, 0x3C,
-    0xA0, 0xD1, 0x4F, 0xCC, 0xB4, 0x00, 0x3C, 0x53, 0xE4, 0x63, 0x1B, 0x00, 0xBE, 0xC5, 0x4E, 0xA9,
-    0x1F, 0xF7, 0xEE, 0xDD, 0xFB, 0xB5, 0x4D, 0x47, 0x6B, 0x91, 0xC0, 0xEC, 0xEC, 0xEC, 0x2F, 0x93,
-    0x93, 0x93, 0xDF, 0xDB, 0x6A, 0x6F, 0x6D, 0x78, 0x67, 0xC3, 0xBF, 0x36, 0x70, 0x7E, 0xE0, 0xC4,
-    0xCC, 0xC9, 0x7A, 0x95, 0x51, 0x8F, 0x21, 0x80, 0xC4, 0xD0, 0x65, 0x66, 0x72, 0x4E, 0x18, 0x1F,
-    0x1F, 0x9F, 0x4E, 0xF6, 0x88, 0x7F, 0x5A, 0x26, 0x50, 0x61, 0xA7, 0x35, 0x5F, 0x5C, 0x93, 0xA5,
-    0xA7, 0xC2, 0x3B, 0x59, 0x87, 0x70, 0x2C, 0x01, 0x5C, 0x11, 0x92, 0x19, 0x31, 0x36, 0x36, 0xF6,
-    0x79, 0xCB, 0x2D, 0xC7, 0x0A, 0x09, 0x81, 0x0A, 0x3B, 0x56, 0x15, 0x58, 0xBA, 0xCB, 0xBD, 0x78,
-    0xA7, 0x02, 0x08, 0x99, 0x0A, 0x74, 0x3E, 0x50, 0x25, 0x95, 0xC7, 0xB8, 0x35, 0x02, 0x3E, 0x47,
-    0xF1, 0x4D, 0xBD, 0x68, 0x09, 0x22, 0x43, 0x85, 0xE4, 0x29, 0x20, 0x40, 0xB4, 0xCE, 0x08, 0x68,
-    0x10, 0x8B, 0xA9, 0x38, 0x27, 0x5E, 0xC9, 0x24, 0x03, 0x73, 0x63, 0xD2, 0x6E, 0x59, 0xB2, 0x43,
-    0xFC, 0xD3, 0x16, 0x01, 0x97, 0xA5, 0xCB, 0x18, 0x67, 0x7D, 0x40, 0xC6, 0x6A, 0x0A, 0x2A, 0x79,
-    0x2A, 0x4F, 0x76, 0x8A, 0x7F, 0xDA, 0x22, 0xA0, 0x81, 0x5C, 0x8F, 0x71, 0xCD, 0x39, 0x80, 0x16,
-    0xB4, 0x63, 0x5B, 0xAD, 0xC5, 0x4A, 0x4D, 0x09, 0xD4, 0xB0, 0x6D, 0x34, 0xC2, 0xD9, 0x51, 0xA1,
-    0xA9, 0xC7, 0x58, 0x98, 0x49, 0x40, 0x1C, 0x6B, 0xE0, 0x53, 0xB3, 0x91, 0x00, 0x99, 0x5E, 0xE3,
-    0x0E, 0xDD, 0x21, 0x10, 0x05, 0xE8, 0x0E, 0xC7, 0xB6, 0xBD, 0xF0, 0x01, 0x61, 0x43, 0xDA, 0xF1,
-    0xE3, 0xC7, 0xAB, 0x8E, 0xFB, 0xF6, 0xED, 0xDB, 0x55, 0xDB, 0x1B, 0x65, 0x23, 0xCE, 0x80, 0xC0,
-    0x4A, 0x45, 0x01, 0xA2, 0x00, 0x81, 0x09, 0x04, 0x6E, 0x3E, 0xCE, 0x80, 0x28, 0x40, 0x60, 0x02,
-    0x81, 0x9B, 0x0F, 0x36, 0x03, 0x1E, 0x3E, 0x7C, 0x68, 0xEE, 0xDE, 0xBD, 0x1B, 0xB8, 0xFB, 0x26,
-    0x39, 0x06, 0x8E, 0x25, 0x94, 0x05, 0xB9, 0x0C, 0xA5, 0xC3, 0x97, 0x2F, 0x5F, 0x36, 0x2B, 0x2B,
-    0xDC, 0x9D, 0x33, 0xE6, 0xC8, 0x91, 0x23, 0x41, 0xFA, 0xCF, 0x00, 0xB8, 0x7A, 0xF5, 0xAA, 0xB1,
-    0xB7, 0x10, 0xCD, 0xB9, 0x73, 0xE7, 0xCC, 0x81, 0x03, 0x07, 0x0A, 0x3F, 0x0E, 0x3E, 0x1E, 0xF3,
-    0x75, 0x29, 0x41, 0xF7, 0x81, 0xB9, 0x15, 0xF9, 0x89, 0x0D, 0x5B, 0x6D, 0xD8, 0x66, 0x6F, 0x3C,
-    0xFF, 0x6A, 0xE3, 0xAE, 0x99, 0xE0, 0x2F, 0x2E, 0xAE, 0x3D, 0x2E, 0x63, 0xEF, 0x35, 0x9B, 0x33,
-    0x67, 0xCE, 0x14, 0x2E, 0x82, 0xE0, 0x2F, 0x2F, 0xF3, 0x34, 0x89, 0xED, 0xFC, 0xD0, 0x50, 0x2E,
-    0x22, 0xF4, 0xF5, 0xF5, 0x7D, 0x65, 0xDD, 0xFF, 0x6D, 0x03, 0xF7, 0x86, 0xFF, 0xB1, 0x81, 0x5B,
-    0x93, 0xFF, 0xD9, 0x00, 0x80, 0xE5, 0xC2, 0x97, 0xA0, 0xF7, 0xEF, 0xDF, 0xA7, 0x23, 0xDF, 0x1E,
-    0x80, 0x01, 0x00, 0xA3, 0xB0, 0xC8, 0xE5, 0xC8, 0x87, 0xCF, 0x71, 0x30, 0x1B, 0x39, 0xB6, 0xA2,
-    0xAD, 0x70, 0x01, 0x58, 0x6E, 0x18, 0xF1, 0x8C, 0x7C, 0x59, 0x91, 0x22, 0xD4, 0x83, 0x1F, 0x6A,
-    0x16, 0xD2, 0xFF, 0xC2, 0x05, 0xA0, 0xD1, 0x66, 0x22, 0xDC, 0xBB, 0x77, 0x8F, 0x5D, 0x72, 0x31,
-    0x7C, 0x33, 0xDB, 0xB4, 0xEC, 0xD0, 0x48, 0x48, 0xF8, 0xB4, 0x1F, 0x44, 0x00, 0x1A, 0xAE, 0x27,
-    0xC2, 0xF6, 0xED, 0xDB, 0xCD, 0x9E, 0x3D, 0x7B, 0x28, 0xCE, 0xC5, 0xF0, 0x4D, 0x1B, 0xB2, 0xD0,
-    0xF0, 0x39, 0x8E, 0x60, 0x02, 0xD0, 0xB8, 0x2B, 0xC2, 0xCE, 0x9D, 0x3B, 0xCD, 0xC5, 0x8B, 0x17,
-    0xCD, 0xEE, 0xDD, 0xBB, 0x29, 0xCA, 0xC5, 0xF0, 0x4D, 0x1B, 0xB4, 0x55, 0x06, 0xF8, 0x74, 0xB2,
-    0xF0, 0xAB, 0xA0, 0x7A, 0x64, 0x59, 0x1A, 0x18, 0x9D, 0x59, 0xF0, 0x5F, 0xBE, 0x7C, 0x69, 0xEE,
-    0xDF, 0xBF, 0x6F, 0xB8, 0x92, 0x7A, 0xF6, 0xEC, 0x99, 0x79, 0xF5, 0xEA, 0x55, 0xE2, 0x6E, 0xC7,
-    0x8E, 0x1D, 0x66, 0xD7, 0xAE, 0x5D, 0xC9, 0x65, 0xE4, 0xA1, 0x43, 0x87, 0x12, 0xC0, 0xF5, 0xDA,
-    0x51, 0xDE, 0xD3, 0xA7, 0x4F, 0xCD, 0xDC, 0xDC, 0x9C, 0x39, 0x7C, 0xF8, 0xB0, 0xB2, 0x72, 0x8B,
-    0xB3, 0xAE, 0x82, 0x4A, 0x21, 0x40, 0x56, 0xEF, 0x01, 0x7D, 0xE3, 0xC6, 0x0D, 0x73, 0xE7, 0xCE,
-    0x9D, 0xAA, 0xF5, 0xBB, 0x5E, 0x3D, 0x46, 0xF6, 0xD1, 0xA3, 0x47, 0xCD, 0x89, 0x13, 0x27, 0x0C,
-    0xC2, 0x84, 0xB6, 0x0D, 0x2F, 0xC0, 0x83, 0x07, 0x0F, 0xCC, 0xB5, 0x6B, 0xD7, 0xCC, 0xBB, 0x77,
-    0x5C, 0x3E, 0xAF, 0xDF, 0x46, 0x47, 0x47, 0x8D, 0x7D, 0xA6, 0xD5, 0x1C, 0x3C, 0x78, 0x70, 0xFD,
-    0x95, 0x72, 0xD8, 0x33, 0x4B, 0x80, 0xA0, 0xE7, 0x80, 0xAC, 0xFE, 0xCE, 0xCC, 0xCC, 0x98, 0x4B,
-    0x97, 0x2E, 0xB5, 0x0C, 0x1F, 0xBF, 0x08, 0x46, 0x5D, 0x7C, 0x94, 0xD9, 0x4A, 0x2B, 0x00, 0x23,
-    0xFF, 0xFA, 0xF5, 0xEB, 0x55, 0x1F, 0xDA, 0x5A, 0x05, 0xC9, 0x87, 0x2B, 0x7C, 0xE0, 0xAB, 0xAC,
-    0x56, 0x4A, 0x01, 0x58, 0xF3, 0x59, 0x76, 0xF4, 0x5D, 0x51, 0x27, 0xF0, 0xF0, 0x81, 0x2F, 0x9D,
-    0xB0, 0x3B, 0xF1, 0x95, 0x47, 0xDD, 0x52, 0x0A, 0xC0, 0x09, 0xB7, 0xD5, 0x35, 0xBF, 0x19, 0x1C,
-    0x7C, 0xE1, 0xB3, 0x8C, 0x56, 0x3A, 0x01, 0xB8, 0xD4, 0xE4, 0x6A, 0xA7, 0xDB, 0x86, 0x4F, 0x7C,
-    0x97, 0xCD, 0x4A, 0x27, 0x00, 0xD7, 0xF9, 0xEE, 0x57, 0x05, 0xDD, 0x02, 0x86, 0x4F, 0x7C, 0x97,
-    0xCD, 0x4A, 0x27, 0x40, 0x9E, 0x37, 0x47, 0xF2, 0xF4, 0xDD, 0xAE, 0xB0, 0xB9, 0xDD, 0x90, 0xF1,
-    0x9F, 0xDB, 0xF1, 0x0F, 0xB0, 0xD1, 0x73, 0x3C, 0x7C, 0xC2, 0xCD, 0xCB, 0x9A, 0xF9, 0x6E, 0xF7,
-    0x78, 0x3B, 0x3D, 0xD6, 0xD2, 0xCD, 0x80, 0x3C, 0xAF, 0x56, 0xF2, 0xF4, 0xDD, 0xAE, 0x10, 0xA5,
-    0x13, 0xA0, 0xDD, 0x8E, 0x6C, 0xD4, 0x7A, 0xA5, 0x13, 0x20, 0xCF, 0xEF, 0x6F, 0xF2, 0xF4, 0xDD,
-    0xEE, 0x00, 0xC8, 0xED, 0x1C, 0xD0, 0x68, 0x8D, 0xCF, 0x3A, 0x50, 0xBE, 0xD5, 0x7C, 0xF2, 0xE4,
-    0x49, 0xD6, 0x6E, 0x6D, 0x95, 0xE3, 0xBB, 0x91, 0xB5, 0x7B, 0xBC, 0x8D, 0xFC, 0xAD, 0x37, 0xBF,
-    0x74, 0x33, 0x20, 0xCF, 0x27, 0x13, 0xF2, 0xF4, 0xBD, 0x5E, 0xE0, 0xFE, 0x7E, 0xA5, 0x13, 0x80,
-    0xEF, 0xF3, 0xF9, 0x4A, 0xB9, 0xDB, 0x86, 0x4F, 0x7C, 0x97, 0xCD, 0x4A, 0x27, 0x00, 0x77, 0xAB,
-    0xF8, 0x3E, 0xBF, 0xDB, 0x86, 0x4F, 0x7C, 0x97, 0xCD, 0x4A, 0x27, 0x00, 0x80, 0xB8, 0x99, 0xC2,
-    0xF7, 0xF9, 0xDD, 0x32, 0x7C, 0xE1, 0xB3, 0x8C, 0x56, 0x4A, 0x01, 0xB8, 0x5A, 0xE1, 0x66, 0x0A,
-    0x4F, 0xAC, 0x75, 0x6A, 0xF8, 0xC0, 0x57, 0x19, 0xAF, 0x80, 0xE8, 0x5B, 0xE7, 0x3D, 0xEC, 0x94,
-    0x50, 0x83, 0xFA, 0xDC, 0xC9, 0x3A, 0x79, 0xF2, 0x64, 0x47, 0x22, 0x00, 0x1F, 0x1F, 0xA1, 0xEF,
-    0x8A, 0x35, 0xE8, 0x62, 0x92, 0x9D, 0xDB, 0x65, 0x68, 0xB3, 0x46, 0xD7, 0x5B, 0x76, 0xEC, 0xD8,
-    0x31, 0x33, 0x31, 0x31, 0xB1, 0xA1, 0x6F, 0x49, 0x66, 0xF5, 0x35, 0xDE, 0x94, 0xCF, 0x22, 0xD4,
-    0x61, 0x79, 0xD6, 0x3D, 0xE1, 0x52, 0x08, 0x10, 0x1F, 0x4B, 0x29, 0xF0, 0xE9, 0x68, 0x7F, 0x40,
-    0xE9, 0x59, 0x4D, 0x9E, 0x58, 0xCB, 0xFB, 0xC1, 0x2C, 0xDA, 0xE6, 0x99, 0xA0, 0x0B, 0x17, 0x2E,
-    0x98, 0xD7, 0xAF, 0x5F, 0x17, 0xF2, 0x54, 0x76, 0xD6, 0x0C, 0x08, 0x7A, 0x12, 0x16, 0x7C, 0x6E,
-    0x96, 0x70, 0xB7, 0x0A, 0x30, 0x00, 0xCA, 0xCB, 0x04, 0x9F, 0xB6, 0x68, 0xB3, 0xE8, 0xA7, 0xB2,
-    0xEB, 0xF5, 0x2B, 0x98, 0x00, 0x2E, 0x7C, 0x1D, 0x18, 0xA3, 0x92, 0x27, 0xD6, 0xF2, 0x32, 0x7C,
-    0xD3, 0x86, 0xAC, 0x0C, 0x22, 0x04, 0x11, 0xA0, 0x1E, 0x7C, 0x3D, 0xAB, 0x99, 0xE7, 0xE3, 0x82,
-    0xF8, 0x0E, 0xF9, 0x68, 0xBC, 0x84, 0x77, 0xE3, 0xC2, 0x05, 0x68, 0x06, 0x9F, 0x87, 0x75, 0xF3,
-    0x36, 0xF7, 0x81, 0x60, 0xB5, 0x15, 0x72, 0x26, 0x14, 0x2E, 0xC0, 0xC8, 0xC8, 0x48, 0xD5, 0x87,
-    0x2B, 0x8D, 0xFC, 0x22, 0xE0, 0x0B, 0x78, 0x3D, 0x11, 0xF8, 0xD0, 0xC6, 0xB1, 0x15, 0x6D, 0x41,
-    0x2E, 0x43, 0xF5, 0x7F, 0x62, 0x3C, 0x34, 0xD5, 0xEE, 0xFF, 0x87, 0xF9, 0xF7, 0x70, 0xDB, 0xF9,
-    0x3E, 0x5F, 0xB3, 0x11, 0xF8, 0x79, 0xFD, 0x93, 0x5E, 0xD6, 0x55, 0x50, 0x90, 0x4F, 0xC2, 0x7C,
-    0x2F, 0x4F, 0x87, 0xF9, 0x9F, 0xAC, 0x22, 0x47, 0xBE, 0x3F, 0xBA, 0xD5, 0x36, 0x23, 0x3F, 0xD4,
-    0xBD, 0x82, 0x20, 0x02, 0x00, 0x22, 0x54, 0x87, 0x1B, 0x89, 0xE0, 0xE7, 0x17, 0xB5, 0x5D, 0xF8,
-    0x39, 0xA0, 0xA8, 0x8E, 0x6D, 0x94, 0x76, 0xA2, 0x00, 0x81, 0x95, 0x8A, 0x02, 0x44, 0x01, 0x02,
-    0x13, 0x08, 0xDC, 0x7C, 0x9C, 0x01, 0x81, 0x05, 0x08, 0x76, 0x15, 0xD4, 0x69, 0xBF, 0xDB, 0xB9,
-    0xEE, 0xEF, 0xB4, 0xCD, 0x3C, 0xEA, 0xC7, 0x19, 0x90, 0x07, 0xD5, 0x16, 0x7C, 0x46, 0x01, 0x5A,
-    0x80, 0x95, 0xC7, 0xAE, 0x8D, 0x04, 0xD0, 0xDB, 0x7E, 0x92, 0xD7, 0x6C, 0xE4, 0xD1, 0x70, 0x0F,
-    0xF9, 0x6C, 0xCA, 0xB2, 0x9E, 0x00, 0x11, 0x7A, 0x7E, 0xA3, 0xA3, 0x86, 0xAD, 0x04, 0x50, 0x81,
-    0x1B, 0x93, 0x5E, 0xFB, 0x49, 0xAB, 0xFC, 0x0E, 0xA8, 0x17, 0x3C, 0x57, 0xBD, 0xB4, 0xC7, 0x76,
-    0xD8, 0x65, 0x9C, 0x3C, 0x17, 0x54, 0x95, 0x51, 0xD9, 0x41, 0xF0, 0x55, 0xD6, 0x0B, 0xA0, 0xF2,
-    0xEA, 0xA3, 0xCB, 0x52, 0x3C, 0xD3, 0x58, 0x33, 0x80, 0xC6, 0xC9, 0xD4, 0xCE, 0xA8, 0x46, 0x58,
-    0xFB, 0x3D, 0x2F, 0x9B, 0x88, 0xD6, 0x36, 0x01, 0x18, 0x8A, 0xA7, 0x3F, 0x1B, 0x6A, 0x9E, 0x8C,
-    0x73, 0x45, 0xA0, 0xA2, 0x2A, 0xB7, 0xDD, 0x7A, 0x8F, 0x57, 0xD4, 0x20, 0x16, 0x47, 0xF1, 0x4D,
-    0xB1, 0x68, 0x06, 0xA8, 0x40, 0x33, 0x80, 0x0A, 0xBC, 0xE7, 0x6A, 0xF1, 0xCD, 0x9B, 0x37, 0x7F,
-    0xA5, 0x7B, 0xC7, 0x44, 0x4B, 0x04, 0x2A, 0xEC, 0xF4, 0xCE, 0x30, 0x5F, 0x04, 0x58, 0xA7, 0x33,
-    0x40, 0x02, 0xB8, 0x8A, 0x21, 0xC0, 0x87, 0x17, 0x2F, 0x5E, 0xFC, 0xD9, 0x52, 0xAB, 0x71, 0xE7,
-    0x94, 0x40, 0x85, 0x1D, 0x2F, 0x6E, 0x83, 0x25, 0x02, 0xF8, 0x22, 0xA4, 0x02, 0x50, 0x49, 0xA3,
-    0x1F, 0x11, 0x92, 0xD1, 0x6F, 0xE3, 0x0F, 0x57, 0xAE, 0x5C, 0xF9, 0xD9, 0xDE, 0xB4, 0x6E, 0xED,
-    0xB7, 0x62, 0xF0, 0xD6, 0xE3, 0x06, 0x33, 0xD8, 0x59, 0x0C, 0xEE, 0x9B, 0xF3, 0x60, 0x4B, 0x48,
-    0x46, 0x3F, 0x88, 0xDC, 0x7F, 0x45, 0xE1, 0xFE, 0xB0, 0x02, 0x4B, 0x13, 0xE9, 0x7E, 0xFB, 0x2E,
-    0xC4, 0xB7, 0xFB, 0xF7, 0xEF, 0x9F, 0xE7, 0xDD, 0x88, 0xF6, 0xDE, 0x29, 0xBF, 0x2D, 0x1A, 0x2D,
-    0x83, 0x00, 0xF0, 0xED, 0xCF, 0xE4, 0xFC, 0x70, 0xF6, 0xEC, 0xD9, 0x3F, 0xEC, 0xAE, 0xFC, 0x46,
-    0x28, 0x81, 0xA5, 0x28, 0xF9, 0xAD, 0x50, 0x1B, 0xA7, 0x42, 0x20, 0x80, 0xA0, 0x13, 0x63, 0x3A,
-    0x2F, 0x68, 0xDB, 0xDC, 0xBC, 0x79, 0x73, 0x96, 0x17, 0x53, 0x4E, 0x4F, 0x4F, 0x6F, 0x1D, 0x1C,
-    0x1C, 0xFC, 0x68, 0x78, 0x78, 0x98, 0x1F, 0x75, 0x4D, 0xCB, 0x93, 0x5A, 0xF1, 0xCF, 0x8A, 0x5D,
-    0xF3, 0xE7, 0xE6, 0xE7, 0xE7, 0x7F, 0x3F, 0x7F, 0xFE, 0xFC, 0x77, 0x15, 0xF8, 0xFC, 0x10, 0x29,
-    0xF0, 0x99, 0x05, 0x04, 0x2D, 0x43, 0x5A, 0xF2, 0xAB, 0xE0, 0x03, 0x14, 0xF8, 0x88, 0xC2, 0xB7,
-    0xA4, 0x8C, 0x76, 0xDE, 0x83, 0x48, 0x88, 0x2F, 0x74, 0xB6, 0x10, 0x3C, 0x13, 0x44, 0x46, 0xB3,
-    0xC0, 0x32, 0xC2, 0x05, 0x9B, 0xD8, 0x85, 0x5F, 0xF7, 0x64, 0x0C, 0xE8, 0x74, 0x3D, 0xAA, 0xA4,
-    0xE5, 0xD0, 0x6E, 0x26, 0x46, 0x39, 0x79, 0x3A, 0x2F, 0xE0, 0x94, 0x7A, 0x08, 0x85, 0x60, 0x5A,
-    0xAE, 0x6C, 0xB2, 0x67, 0x66, 0x85, 0x98, 0x89, 0x8D, 0x98, 0xC1, 0x48, 0x9C, 0xB4, 0xE4, 0x28,
-    0xF6, 0x4F, 0xC0, 0xD4, 0xAD, 0x79, 0xA7, 0xBC, 0x1C, 0x02, 0x53, 0x86, 0x73, 0x57, 0x00, 0xC0,
-    0xFB, 0xF0, 0xDD, 0xE5, 0xC8, 0x4D, 0xCB, 0xC7, 0x66, 0x8A, 0x05, 0x9F, 0x3E, 0x25, 0x10, 0x6D,
-    0x2C, 0x46, 0x9A, 0x09, 0x88, 0x40, 0x1A, 0xF8, 0xCA, 0x73, 0x05, 0xB0, 0xD9, 0x6B, 0xA6, 0x1B,
-    0x32, 0xAE, 0x53, 0x4A, 0x70, 0x88, 0xB9, 0x0D, 0x00, 0x1D, 0x87, 0x82, 0xAF, 0x25, 0xCB, 0x05,
-    0xEE, 0xA6, 0xA9, 0xBF, 0x59, 0xCD, 0xE5, 0x45, 0x1A, 0x5E, 0x8A, 0x05, 0xDA, 0x8F, 0xB5, 0x8F,
-    0x98, 0x26, 0x3E, 0x5C, 0x60, 0x4A, 0x13, 0xFB, 0x41, 0x4B, 0x8D, 0x96, 0x1B, 0xC5, 0x6E, 0x9D,
-    0xCD, 0x0A, 0xBB, 0x59, 0xBF, 0x12, 0x88, 0x15, 0xF8, 0x12, 0x40, 0xB1, 0x66, 0x05, 0xDB, 0x7E,
-    0xC0, 0x27, 0x79, 0x35, 0x6B, 0xB6, 0x0F, 0xD4, 0x17, 0xC2, 0xDD, 0x56, 0x7D, 0xD5, 0x61, 0xBB,
-    0x17, 0x4D, 0x70, 0xE9, 0xBB, 0xD2, 0xF5, 0x62, 0x95, 0xBB, 0x71, 0x8D, 0x00, 0x14, 0x62, 0x82,
-    0xAA, 0xD8, 0xCF, 0xAB, 0x97, 0x9F, 0x54, 0xEC, 0xC1, 0x3F, 0xC9, 0x48, 0xAE, 0xF4, 0x5B, 0xE0,
-    0xD9, 0xF4, 0xF3, 0xFD, 0xBC, 0xA4, 0x8A, 0x0B, 0x32, 0xC9, 0xF0, 0xFE, 0xF8, 0xE5, 0xFE, 0xB6,
-    0xB7, 0x7B, 0x2A, 0x9C, 0x9F, 0xBF, 0xD9, 0xB6, 0x5D, 0xB8, 0xF5, 0xFA, 0xE6, 0x97, 0xFB, 0xDB,
-    0x69, 0x9D, 0xFF, 0x01, 0xE6, 0xF9, 0x19, 0xD7, 0x4A, 0xC7, 0x0D, 0x5C, 0x00, 0x00, 0x00, 0x00,
-    0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-#endif    /* __icon_scale_png_h_included */
@@ -1,173 +0,0 @@
-/* Generated by file2c, do not edit manually */
-#ifndef __icon_switch_select_png_h_included
-#define __icon_switch_select_png_h_included
-
-#include <stdint.h>
-
-/* Contents of file icon_switch_select.png */
-#define icon_switch_select_png_fileName        "icon_switch_select.png"
-#define icon_switch_select_png_fileSize        2529
-
-static const uint8_t icon_switch_select_png_fileBinaryArray[2529] = {
-    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77,
-    0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
-    0x09, 0x9B, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x5B, 0x6C, 0x54, 0x45, 0x18, 0xC7,
-    0xA7, 0xDB, 0x1B, 0xB7, 0x52, 0xA3, 0x05, 0x8A, 0x04, 0x42, 0xAB, 0x25, 0x26, 0x05, 0xD3, 0x34,
-    0x88, 0x11, 0x21, 0x26, 0xC6, 0x88, 0xD7, 0x68, 0xA2, 0xBC, 0x11, 0x12, 0x9F, 0x48, 0x78, 0x23,
-    0x82, 0xC6, 0xC6, 0x04, 0x83, 0xC6, 0x04, 0x13, 0x13, 0x0D, 0xD1, 0x04, 0x9F, 0x7C, 0x20, 0x86,
-    0x04, 0x1F, 0x78, 0xA8, 0x68, 0x50, 0xF1, 0x86, 0x18, 0x45, 0x50, 0x04, 0x34, 0xA4, 0x81, 0x72,
-    0x91, 0x42, 0xA1, 0x2A, 0xB4, 0x5C, 0x4A, 0xBB, 0x17, 0xBF, 0xFF, 0xE9, 0xFE, 0x4F, 0xA6, 0xB3,
-    0x67, 0xBB, 0xEC, 0xE9, 0xB9, 0x74, 0xBB, 0xF3, 0x25, 0xDF, 0xCE, 0x7D, 0xCE, 0x99, 0xDF, 0x37,
-    0xF3, 0xCD, 0xEE, 0x9E, 0x73, 0x76, 0x2B, 0xD4, 0xD8, 0x52, 0x61, 0x14, 0x9B, 0x69, 0xA3, 0x58,
-    0x15, 0x2A, 0x37, 0xEB, 0x97, 0x6A, 0x3A, 0x53, 0xE0, 0xC4, 0xCD, 0x72, 0x33, 0xED, 0x36, 0xCF,
-    0x07, 0x8C, 0xF9, 0x0C, 0xD1, 0x80, 0x71, 0x84, 0x8C, 0xEB, 0xF9, 0x88, 0x97, 0xA3, 0xE8, 0x70,
-    0x11, 0x67, 0x9A, 0x21, 0x98, 0x30, 0xCE, 0xD0, 0xE5, 0x54, 0xE5, 0xC6, 0x46, 0x22, 0x04, 0xAB,
-    0x87, 0x04, 0x6E, 0x86, 0x68, 0xC1, 0x3C, 0xA3, 0x9B, 0xB2, 0x4A, 0x02, 0x2A, 0xC1, 0x32, 0x6E,
-    0x86, 0x26, 0x10, 0xD6, 0xF7, 0x9C, 0xC9, 0x84, 0xAA, 0x87, 0x09, 0xE9, 0x81, 0x8A, 0x7C, 0xC4,
-    0x59, 0x8E, 0xCE, 0x11, 0x2F, 0x47, 0x21, 0x48, 0x02, 0x4F, 0x0B, 0x04, 0xC4, 0x11, 0x52, 0x59,
-    0xA6, 0x87, 0x60, 0x85, 0xB4, 0xF2, 0x5A, 0x01, 0x04, 0x4B, 0xE0, 0x95, 0x52, 0x0F, 0x71, 0x33,
-    0xD4, 0x0D, 0x81, 0xBE, 0x20, 0xE5, 0x62, 0x08, 0x07, 0xDE, 0xC8, 0x90, 0x5D, 0xE0, 0xC8, 0x03,
-    0xF4, 0x54, 0x9E, 0x10, 0x65, 0x14, 0xB7, 0x3D, 0x0D, 0x40, 0xE8, 0x0C, 0x09, 0x1C, 0xD0, 0xA1,
-    0xD5, 0xD9, 0x10, 0xF5, 0x99, 0x47, 0x03, 0xB1, 0x8D, 0x14, 0x39, 0x32, 0xD9, 0x8D, 0xE0, 0xC2,
-    0x93, 0xD1, 0x22, 0x4E, 0xF0, 0x84, 0x0F, 0x03, 0x24, 0x45, 0x11, 0x0E, 0x8B, 0x82, 0x07, 0xE2,
-    0x10, 0xDD, 0x08, 0x48, 0x67, 0x68, 0x00, 0x24, 0x20, 0xA8, 0xAC, 0xC3, 0x07, 0x78, 0x53, 0xD1,
-    0x86, 0x86, 0xD0, 0x8D, 0x20, 0xD9, 0x65, 0xB7, 0x02, 0x4C, 0xF8, 0x00, 0x0F, 0x05, 0x78, 0x28,
-    0xF8, 0x20, 0xD4, 0x05, 0x46, 0x70, 0x8D, 0x08, 0x90, 0x9C, 0xC1, 0x0C, 0x69, 0x00, 0x80, 0xAF,
-    0xC9, 0x6A, 0xAD, 0x16, 0x47, 0x1E, 0x57, 0x04, 0xDD, 0x12, 0xDB, 0x4A, 0x51, 0xD9, 0x88, 0x3E,
-    0xFB, 0x31, 0xC3, 0x39, 0xE3, 0x87, 0x24, 0x4E, 0x05, 0x4B, 0xB0, 0xA1, 0xB0, 0x8D, 0x9E, 0xE7,
-    0xCE, 0x7A, 0x18, 0x03, 0x70, 0xA7, 0x8B, 0xD6, 0x8B, 0xCE, 0x16, 0x9D, 0x2F, 0xDA, 0x22, 0xBA,
-    0x64, 0xDD, 0xBA, 0x75, 0xCF, 0x9E, 0x3A, 0x75, 0xAA, 0xB3, 0xBF, 0xBF, 0xBF, 0x3B, 0x93, 0xC9,
-    0xA4, 0x44, 0xAD, 0x8C, 0x26, 0x90, 0x02, 0x1B, 0x30, 0x02, 0x2B, 0x30, 0xCB, 0xB2, 0x03, 0x43,
-    0xB0, 0x04, 0x53, 0xB0, 0x05, 0x63, 0xB0, 0x76, 0x8D, 0x03, 0x6B, 0x20, 0x81, 0x59, 0x3D, 0x45,
-    0xB4, 0x4E, 0xB4, 0x41, 0x74, 0x9E, 0xE8, 0xBD, 0xA2, 0x4B, 0x76, 0xEF, 0xDE, 0xFD, 0x6A, 0x32,
-    0x99, 0xBC, 0x3E, 0xFA, 0x78, 0x36, 0x95, 0x8F, 0x00, 0x58, 0x81, 0x19, 0xD8, 0x65, 0x19, 0x82,
-    0x25, 0x98, 0x82, 0x2D, 0x18, 0x83, 0xB5, 0x63, 0x00, 0xDD, 0x85, 0x20, 0x83, 0x1B, 0x2E, 0x2A,
-    0xC0, 0xED, 0x4C, 0x11, 0x6B, 0x36, 0x6F, 0xD8, 0xB0, 0x61, 0x5B, 0x65, 0x65, 0xE5, 0x34, 0x49,
-    0x5B, 0xB9, 0x0D, 0x02, 0x89, 0x44, 0xA2, 0xBA, 0xA5, 0xA5, 0x65, 0x79, 0x6F, 0x6F, 0xEF, 0x57,
-    0x87, 0x0E, 0x1D, 0xEA, 0x97, 0x26, 0xDC, 0xA0, 0x11, 0x72, 0x0F, 0x70, 0xF6, 0x01, 0xCE, 0x7E,
-    0x84, 0x58, 0x16, 0x00, 0x8F, 0x25, 0x32, 0x55, 0x14, 0xC0, 0xA7, 0xCB, 0x92, 0x7A, 0xAB, 0xA9,
-    0xA9, 0xE9, 0x69, 0x89, 0x5B, 0x29, 0x92, 0x40, 0x77, 0x77, 0xF7, 0x67, 0xCD, 0xCD, 0xCD, 0xAF,
-    0x4B, 0xB3, 0xEB, 0xA2, 0x37, 0x44, 0x6F, 0x8A, 0x62, 0x7F, 0xC0, 0xC6, 0x8C, 0xCD, 0x3A, 0x83,
-    0x59, 0x0F, 0x81, 0x01, 0x68, 0x0C, 0xBE, 0xCD, 0x74, 0xF6, 0x84, 0x86, 0x86, 0x86, 0x56, 0xA7,
-    0x86, 0x7D, 0x29, 0x9A, 0x40, 0x96, 0x1D, 0x7D, 0x3E, 0xB9, 0x3A, 0xAE, 0x27, 0xCB, 0xDB, 0xF1,
-    0x43, 0xE8, 0x98, 0x06, 0xD0, 0x8D, 0xE0, 0xAC, 0x88, 0xBA, 0xBA, 0xBA, 0x05, 0x45, 0x1F, 0xD9,
-    0x36, 0x70, 0x08, 0x64, 0xD9, 0xC1, 0xAB, 0x80, 0xA5, 0xEE, 0xEE, 0xC9, 0xDB, 0x35, 0x00, 0x91,
-    0xB1, 0x80, 0xFB, 0x01, 0x1B, 0xB1, 0xDC, 0x86, 0xC5, 0x11, 0x30, 0x39, 0x92, 0xAF, 0xDB, 0x0B,
-    0x5D, 0x10, 0x32, 0x58, 0x88, 0x3C, 0x2A, 0x0C, 0x60, 0x65, 0x7C, 0x04, 0x38, 0x89, 0xC9, 0x94,
-    0x9C, 0x9D, 0x5E, 0x91, 0x89, 0x0C, 0x88, 0x1E, 0x22, 0xAE, 0x97, 0x39, 0x15, 0xEC, 0x8B, 0x2F,
-    0x02, 0x3A, 0x4B, 0x9D, 0x31, 0x3A, 0xAB, 0x00, 0x64, 0x48, 0x4E, 0x41, 0x36, 0x8F, 0xE5, 0x4E,
-    0x25, 0xFB, 0xE2, 0x8B, 0x00, 0x27, 0xB2, 0x17, 0xE3, 0x9C, 0x3D, 0x00, 0x47, 0x60, 0x45, 0x5F,
-    0x47, 0xB3, 0x8D, 0xC6, 0x24, 0x90, 0xC3, 0x36, 0xDF, 0x0C, 0x47, 0x45, 0xEA, 0x98, 0x3D, 0xDA,
-    0xC2, 0x82, 0x04, 0xC8, 0x31, 0x07, 0x3E, 0x5A, 0xE6, 0x33, 0x40, 0xC1, 0x5E, 0x6D, 0x85, 0x60,
-    0x08, 0x58, 0x03, 0x04, 0xC3, 0xD1, 0x77, 0x2F, 0xD6, 0x00, 0xBE, 0xD1, 0x05, 0xD3, 0xD0, 0x1A,
-    0x20, 0x18, 0x8E, 0xBE, 0x7B, 0xB1, 0x06, 0xF0, 0x8D, 0x2E, 0x98, 0x86, 0xD6, 0x00, 0xC1, 0x70,
-    0xF4, 0xDD, 0x8B, 0x35, 0x80, 0x6F, 0x74, 0xC1, 0x34, 0xB4, 0x06, 0x08, 0x86, 0xA3, 0xEF, 0x5E,
-    0x4A, 0xCA, 0x00, 0x27, 0xFB, 0x33, 0x6A, 0xDF, 0x79, 0x5C, 0x50, 0x52, 0xEA, 0xBD, 0x3F, 0x92,
-    0xEA, 0x99, 0x3D, 0xB7, 0x54, 0xDB, 0xAE, 0x41, 0xF5, 0x53, 0xEF, 0x48, 0x9E, 0x6F, 0x0A, 0x31,
-    0x36, 0xC4, 0xF7, 0xD4, 0x13, 0x52, 0x06, 0xE5, 0x1E, 0x83, 0x1F, 0x2E, 0xA4, 0xD5, 0xE1, 0xCB,
-    0x69, 0x75, 0xE4, 0x9F, 0xB4, 0x3A, 0xFA, 0x6F, 0x5A, 0x0D, 0x0C, 0x65, 0xD4, 0xC2, 0xBA, 0x84,
-    0x7A, 0x74, 0x5E, 0xAD, 0xFA, 0xBD, 0x2F, 0xAD, 0x8E, 0x49, 0x1E, 0x64, 0xD7, 0xC9, 0x94, 0x7A,
-    0x68, 0x4E, 0x49, 0xCD, 0x25, 0x97, 0xF9, 0x84, 0x32, 0x40, 0xBF, 0x5C, 0xA8, 0xDB, 0xF7, 0x77,
-    0x4A, 0x7D, 0x7E, 0x36, 0xA5, 0xBE, 0x13, 0xF8, 0x83, 0x49, 0xF7, 0xF6, 0x19, 0xF7, 0x84, 0xBD,
-    0x22, 0xA8, 0xFF, 0xE6, 0xB2, 0x6A, 0x35, 0x7D, 0x42, 0x8D, 0xC6, 0xEB, 0x4C, 0x73, 0xF3, 0x26,
-    0xC4, 0x29, 0x1F, 0xFF, 0x2F, 0xA3, 0x3E, 0x3C, 0x36, 0xAC, 0xF6, 0x9E, 0x4B, 0xAB, 0xE1, 0xF4,
-    0xED, 0x41, 0xD7, 0x87, 0x72, 0x53, 0x0C, 0xB5, 0x47, 0x8C, 0xB0, 0xBA, 0xB9, 0xF4, 0x2E, 0x5F,
-    0xC4, 0x6A, 0x80, 0x83, 0x97, 0xD2, 0xEA, 0x83, 0x63, 0x49, 0xF5, 0x6D, 0x0F, 0xEE, 0x69, 0x1A,
-    0x9F, 0x7C, 0x2A, 0x6E, 0xC8, 0x1A, 0xE0, 0x36, 0x19, 0x5E, 0x91, 0xFB, 0x02, 0x3A, 0x7E, 0x1E,
-    0x52, 0x7B, 0xCE, 0x8C, 0x1F, 0x3C, 0x0F, 0xF9, 0x8B, 0x18, 0xB3, 0x6F, 0x50, 0x6E, 0xBE, 0xC1,
-    0x5D, 0x37, 0x25, 0x24, 0x91, 0xAF, 0x80, 0xEF, 0xC5, 0xB7, 0x6F, 0xFC, 0x69, 0x48, 0x5D, 0xBA,
-    0x51, 0xBC, 0xAB, 0x19, 0x8B, 0xAB, 0xDC, 0x24, 0xA5, 0xF6, 0x5F, 0x48, 0xA9, 0xE7, 0x9B, 0xC6,
-    0x76, 0x43, 0x0B, 0x77, 0xE0, 0xCE, 0x10, 0xFF, 0x72, 0x7A, 0x0D, 0xEE, 0xD8, 0x09, 0x4E, 0x22,
-    0x7D, 0xEB, 0xB0, 0xED, 0x68, 0x52, 0xAD, 0xFD, 0xFA, 0x56, 0xE0, 0xF0, 0x89, 0x03, 0xEF, 0x9A,
-    0x4A, 0x4D, 0x22, 0x33, 0xC0, 0x47, 0x7F, 0x26, 0xD5, 0xBB, 0x47, 0x70, 0x3F, 0x52, 0x78, 0xB2,
-    0xFF, 0x62, 0x70, 0x2E, 0x2D, 0xBC, 0xB3, 0x1C, 0xDD, 0x73, 0x24, 0x06, 0xD8, 0xD1, 0x95, 0x52,
-    0x6F, 0x1F, 0x0E, 0x17, 0x3E, 0x86, 0xD5, 0x2B, 0x6E, 0xAD, 0xEB, 0x6A, 0xB0, 0xAE, 0x6D, 0x34,
-    0xAE, 0xE0, 0x53, 0xA1, 0xEF, 0x01, 0x00, 0xF2, 0xC6, 0xC1, 0xF0, 0xE1, 0x13, 0xCD, 0xAF, 0xF2,
-    0xC1, 0xAD, 0xA5, 0x3E, 0xFF, 0x3E, 0x10, 0xB4, 0x0F, 0xE7, 0x71, 0xFD, 0x86, 0xA1, 0xAF, 0x80,
-    0xCD, 0x02, 0x3F, 0xE9, 0xE3, 0xBD, 0xBD, 0xDF, 0x01, 0x75, 0x5D, 0x2D, 0xAD, 0x7D, 0x20, 0x54,
-    0x03, 0x74, 0xCA, 0xDB, 0xCC, 0x03, 0x11, 0xFB, 0xE5, 0xAE, 0x2B, 0xA5, 0xE5, 0x82, 0x42, 0x35,
-    0xC0, 0xC7, 0x27, 0xA2, 0xDF, 0x14, 0xED, 0x0A, 0xC8, 0xFA, 0x8E, 0xCB, 0xF2, 0xA1, 0x08, 0x5F,
-    0xA4, 0x45, 0x2D, 0x17, 0x65, 0x23, 0x1E, 0x88, 0x6E, 0xCB, 0x19, 0xF7, 0xF0, 0x42, 0x5B, 0x01,
-    0x5F, 0x9E, 0x4B, 0xA9, 0xB4, 0x7C, 0x38, 0x8A, 0x43, 0x7A, 0xAE, 0xC7, 0x73, 0x5C, 0x3F, 0x63,
-    0x0D, 0xCD, 0x00, 0x71, 0x7E, 0x47, 0x3F, 0x30, 0x6C, 0x0D, 0xA0, 0xE0, 0x0A, 0xE2, 0x92, 0x52,
-    0x72, 0x41, 0xA1, 0x7D, 0x0E, 0xB8, 0x7C, 0x33, 0x3E, 0x03, 0x5C, 0x1B, 0x63, 0x05, 0x94, 0xCD,
-    0x77, 0x41, 0x97, 0x07, 0xE3, 0x34, 0x40, 0x5C, 0x6B, 0xAF, 0xF8, 0xE3, 0x86, 0xB6, 0x07, 0x14,
-    0x7F, 0x2A, 0xE5, 0xD9, 0x22, 0x34, 0x03, 0xCC, 0x9A, 0xE2, 0x79, 0x33, 0x70, 0x24, 0x94, 0x67,
-    0xE0, 0xA9, 0xAC, 0x12, 0x91, 0xD0, 0xF6, 0x80, 0x59, 0x53, 0x2B, 0xD4, 0xE9, 0x81, 0x78, 0x28,
-    0xCC, 0xA8, 0xCE, 0x6F, 0xFC, 0xB2, 0xF9, 0x2E, 0x68, 0xCE, 0xB4, 0xFC, 0x10, 0xC2, 0x36, 0xCB,
-    0xCC, 0x12, 0x5A, 0x01, 0xA1, 0xB9, 0xA0, 0x07, 0x67, 0x87, 0xD6, 0x75, 0x41, 0xFB, 0x8D, 0xB5,
-    0x02, 0x0A, 0x36, 0x8E, 0xB8, 0x42, 0x68, 0x94, 0x56, 0xCD, 0xAF, 0x54, 0x15, 0x15, 0xF1, 0xAC,
-    0x82, 0xBB, 0xA7, 0xC7, 0x73, 0x5C, 0x3F, 0xB6, 0x0B, 0xCD, 0x00, 0xB3, 0xE5, 0xD2, 0x69, 0xDB,
-    0x5D, 0xD1, 0x83, 0x68, 0x14, 0xD7, 0x57, 0x67, 0x5D, 0xD0, 0xC8, 0x5C, 0x58, 0xB3, 0x28, 0xB4,
-    0x3D, 0x3E, 0xEF, 0x64, 0x6B, 0xA9, 0x0F, 0x6D, 0x4E, 0xE5, 0x3D, 0xE6, 0x78, 0x0A, 0x42, 0x3D,
-    0xDB, 0x17, 0xE4, 0x46, 0xA9, 0xF6, 0x59, 0xA1, 0x1E, 0x22, 0x67, 0xEC, 0x2D, 0x77, 0x44, 0xBF,
-    0xEA, 0x72, 0x4E, 0xA2, 0x88, 0x8C, 0xD0, 0xE9, 0x6C, 0x79, 0xA0, 0x46, 0x25, 0x22, 0xDC, 0x0B,
-    0x4A, 0x6D, 0x05, 0x84, 0xEE, 0x23, 0x16, 0xDF, 0x59, 0xA1, 0x36, 0xB6, 0x55, 0xA9, 0x77, 0x7E,
-    0x8B, 0xE6, 0x4B, 0xFA, 0xA5, 0x05, 0x56, 0x5C, 0xD9, 0x7C, 0x17, 0xA4, 0xAF, 0xC2, 0xF5, 0xAD,
-    0x55, 0x6A, 0xFD, 0xE2, 0xF0, 0x77, 0x46, 0x7C, 0xF6, 0x68, 0xA9, 0xB7, 0x2E, 0x48, 0x67, 0xEF,
-    0xC6, 0x5F, 0x91, 0x55, 0xF0, 0xD2, 0x7D, 0xE1, 0x2E, 0xB8, 0x95, 0x73, 0xF3, 0xDF, 0x0D, 0xE1,
-    0x9E, 0xC8, 0x04, 0x8B, 0x84, 0xBE, 0x07, 0xE8, 0xE3, 0xDD, 0xBC, 0xB4, 0x5A, 0xBD, 0xBF, 0xA2,
-    0x46, 0xD5, 0xD7, 0x84, 0x33, 0x4B, 0x57, 0xCE, 0x8D, 0x74, 0x38, 0xFA, 0xD0, 0x7C, 0xC7, 0xC3,
-    0x9D, 0x92, 0x1E, 0xA7, 0xF5, 0xDC, 0xC2, 0x4A, 0xB5, 0x4C, 0x3E, 0x25, 0xBF, 0x7C, 0x60, 0x38,
-    0xD0, 0x3B, 0x26, 0xF0, 0xA1, 0xEF, 0xE1, 0xC6, 0xC2, 0x2B, 0xA0, 0x6C, 0xBE, 0x0B, 0xF2, 0x60,
-    0xEF, 0x66, 0xCD, 0x15, 0x5F, 0xFD, 0xC9, 0x63, 0x35, 0x6A, 0xFB, 0x23, 0xB5, 0xAA, 0xAD, 0x21,
-    0x98, 0x59, 0x0B, 0xA3, 0x96, 0xDA, 0x9D, 0xD1, 0x00, 0x12, 0xCC, 0xE8, 0x5D, 0xB4, 0xC5, 0x45,
-    0x56, 0xCD, 0x4F, 0xA8, 0xDD, 0x4F, 0xD4, 0x8A, 0x31, 0x6A, 0xD5, 0x0A, 0xF1, 0xDF, 0xE3, 0xF9,
-    0xEA, 0xE2, 0xC5, 0x7B, 0x0A, 0xCF, 0xFE, 0xE2, 0xCE, 0x2E, 0x9A, 0xDA, 0x91, 0xBB, 0x20, 0xAF,
-    0x61, 0x2D, 0x6F, 0x4C, 0xA8, 0xE5, 0x8D, 0x35, 0x72, 0x1D, 0x59, 0xA9, 0xBD, 0xF2, 0x88, 0xD2,
-    0x17, 0xF2, 0xB4, 0x0B, 0xEE, 0xF7, 0xBF, 0xDD, 0x3B, 0xEA, 0xA6, 0x56, 0x55, 0xA8, 0xA7, 0x16,
-    0x58, 0x03, 0x78, 0xB1, 0x2D, 0x2A, 0xAF, 0x51, 0x7E, 0x28, 0x73, 0xED, 0xA2, 0x4A, 0x47, 0xAF,
-    0xCA, 0x43, 0x1C, 0xDF, 0x9C, 0x4F, 0xA9, 0xC3, 0xF2, 0x30, 0xDE, 0x51, 0x79, 0x48, 0xEF, 0x2F,
-    0x79, 0x8C, 0x69, 0x30, 0xE5, 0x7D, 0x99, 0xF3, 0x49, 0x81, 0x5F, 0x8A, 0xCF, 0x87, 0x01, 0xCE,
-    0x84, 0x58, 0x01, 0x5E, 0x56, 0xAA, 0x97, 0x1F, 0x7B, 0xC4, 0xC3, 0x16, 0x7C, 0xE0, 0x02, 0xEC,
-    0x4F, 0xC8, 0x6D, 0x87, 0x67, 0xAF, 0x8D, 0x18, 0xE1, 0x7E, 0xD9, 0x3B, 0x2E, 0xC9, 0x85, 0xFF,
-    0xF3, 0x72, 0xF7, 0xC5, 0xEA, 0x12, 0x75, 0x3F, 0x18, 0x37, 0xDE, 0x0F, 0x62, 0xED, 0x42, 0xF1,
-    0x49, 0x09, 0xBF, 0x96, 0x8B, 0x1F, 0x6C, 0x9D, 0x21, 0x3A, 0x53, 0xB4, 0x5E, 0x9E, 0x3C, 0xD9,
-    0x2B, 0xA1, 0x15, 0x9F, 0x04, 0x64, 0x5F, 0x7B, 0x5C, 0x9A, 0x5E, 0x15, 0xC5, 0x2F, 0xE8, 0x5E,
-    0x13, 0xC5, 0x0F, 0xB8, 0xDE, 0x12, 0xC5, 0x57, 0x03, 0xA9, 0x58, 0x37, 0x61, 0x39, 0x81, 0xB2,
-    0x17, 0x6B, 0x80, 0x98, 0xA7, 0x80, 0x35, 0x80, 0x35, 0x40, 0xCC, 0x04, 0x62, 0x3E, 0xBC, 0x5D,
-    0x01, 0xD6, 0x00, 0x31, 0x13, 0x88, 0xF9, 0xF0, 0x76, 0x05, 0x58, 0x03, 0xC4, 0x4C, 0x20, 0xE6,
-    0xC3, 0xE7, 0x5B, 0x01, 0xF8, 0xB8, 0x49, 0x8D, 0xF9, 0x14, 0x4B, 0xFE, 0xF0, 0xE4, 0x38, 0xF2,
-    0x11, 0xDE, 0x18, 0x8E, 0x97, 0x01, 0x3C, 0x2B, 0x1A, 0xED, 0x6C, 0xD2, 0x1F, 0x81, 0x1C, 0xB6,
-    0x34, 0x00, 0x0B, 0xF4, 0x10, 0xF1, 0xE8, 0x9F, 0xB2, 0xF3, 0x37, 0xB0, 0x89, 0xDC, 0x0A, 0x0C,
-    0xC1, 0x52, 0x67, 0x8B, 0xF3, 0x75, 0xD2, 0x30, 0x80, 0x57, 0x01, 0xF2, 0xD8, 0x10, 0x95, 0xAD,
-    0xF8, 0x27, 0xA0, 0xB3, 0xCC, 0x61, 0xCD, 0x15, 0x80, 0xEE, 0x51, 0xC8, 0xCA, 0x80, 0x0F, 0x8D,
-    0xFE, 0x41, 0x5F, 0x39, 0xE8, 0x24, 0x13, 0x30, 0x24, 0x4F, 0x4E, 0x6A, 0x1A, 0x22, 0xE7, 0x8A,
-    0x98, 0x6E, 0x04, 0x34, 0x64, 0xE3, 0x49, 0xC6, 0x24, 0xB2, 0xE1, 0x70, 0x12, 0x93, 0x23, 0xF9,
-    0xBA, 0x27, 0xC0, 0x15, 0xC0, 0x02, 0x84, 0x6C, 0xE4, 0xFC, 0x29, 0xE5, 0xC0, 0xC0, 0xC0, 0x59,
-    0xB7, 0xB6, 0x8D, 0x14, 0x45, 0x20, 0xCB, 0x0E, 0x5F, 0x3B, 0x83, 0xA5, 0x69, 0x04, 0xB0, 0x76,
-    0x57, 0x00, 0x0D, 0x40, 0xF8, 0xA8, 0x8C, 0x46, 0x43, 0x7D, 0x7D, 0x7D, 0xC7, 0x51, 0xD1, 0x4A,
-    0xF1, 0x04, 0xB2, 0xEC, 0xF0, 0xC7, 0x6D, 0x34, 0x80, 0x69, 0x04, 0xD7, 0x00, 0xE8, 0x9D, 0xB3,
-    0x1F, 0x46, 0x70, 0x66, 0xBF, 0x84, 0x43, 0x5B, 0xB7, 0x6E, 0xDD, 0x9E, 0x4A, 0xA5, 0x70, 0x11,
-    0xC1, 0x4A, 0x11, 0x04, 0xC0, 0x0C, 0xEC, 0xA4, 0x09, 0x0C, 0xC0, 0x55, 0x00, 0xB6, 0x50, 0x67,
-    0xF6, 0x4B, 0xE8, 0x5C, 0x09, 0x43, 0x08, 0xC1, 0xD5, 0x31, 0x2A, 0x5C, 0x13, 0xE2, 0x09, 0xF9,
-    0x2F, 0xC4, 0xEB, 0xED, 0xED, 0xED, 0x3D, 0xF8, 0x6F, 0x44, 0xFC, 0x47, 0xA2, 0xE4, 0x59, 0x29,
-    0x40, 0x00, 0xF0, 0x3B, 0x3B, 0x3B, 0xB7, 0x6C, 0xDA, 0xB4, 0xE9, 0xA0, 0x54, 0xC5, 0xD5, 0x2F,
-    0x5E, 0x01, 0x73, 0xAE, 0x82, 0x49, 0xDA, 0x35, 0x04, 0x2E, 0x45, 0x12, 0x3A, 0x42, 0x08, 0xF7,
-    0x05, 0xA6, 0xD5, 0xCE, 0x9D, 0x3B, 0xBB, 0xF1, 0xC7, 0x94, 0xAD, 0xAD, 0xAD, 0x33, 0xAB, 0xAA,
-    0xAA, 0x6A, 0x6A, 0x6B, 0x6B, 0x71, 0xB9, 0xD2, 0x2D, 0x77, 0x5A, 0xD9, 0x97, 0xB4, 0xF8, 0xFC,
-    0x33, 0x3D, 0x3D, 0x3D, 0x3F, 0x76, 0x74, 0x74, 0xBC, 0x96, 0x85, 0x2F, 0x3F, 0x59, 0xE2, 0xC0,
-    0xC7, 0x2A, 0x80, 0xC2, 0x05, 0x41, 0xE9, 0xF2, 0x47, 0xC1, 0x07, 0x50, 0xC0, 0x87, 0x51, 0x70,
-    0xB1, 0x1E, 0xB3, 0x1D, 0xFF, 0x83, 0x08, 0xB5, 0x7F, 0xE8, 0x2C, 0x10, 0x0C, 0x21, 0x44, 0xCC,
-    0x66, 0x82, 0xC5, 0x0C, 0x27, 0x6C, 0x84, 0x98, 0xF9, 0x4C, 0xD3, 0x0D, 0x8D, 0xDA, 0x07, 0x00,
-    0xDA, 0xF5, 0x47, 0xD9, 0x38, 0x3B, 0x94, 0xA4, 0x23, 0x28, 0x47, 0x1E, 0xF7, 0x05, 0x74, 0x8A,
-    0x76, 0x30, 0x14, 0x0C, 0x46, 0x77, 0x25, 0xD1, 0xB2, 0x59, 0x15, 0x64, 0x46, 0x36, 0x64, 0x06,
-    0x46, 0xE4, 0x04, 0xE0, 0xBA, 0x8E, 0x02, 0x2F, 0x65, 0x68, 0x9B, 0xF3, 0x9F, 0xF2, 0xEC, 0x50,
-    0xCA, 0x5C, 0x41, 0xE7, 0xBA, 0x01, 0x00, 0xDE, 0x84, 0xAF, 0xBB, 0x23, 0x3D, 0xEE, 0x76, 0x32,
-    0x89, 0x22, 0x84, 0x8F, 0x21, 0x39, 0x10, 0x25, 0x24, 0x23, 0xAE, 0x04, 0x18, 0x01, 0x71, 0x18,
-    0x80, 0x79, 0xBA, 0x01, 0x24, 0x7B, 0x44, 0x78, 0x5F, 0x90, 0xDE, 0x29, 0x4A, 0xD0, 0x21, 0x44,
-    0x3F, 0x00, 0xA0, 0xA3, 0x43, 0xC2, 0xA7, 0xCB, 0xD2, 0x81, 0xEB, 0x71, 0xB4, 0x9F, 0xAC, 0xA2,
-    0xF3, 0x42, 0x1C, 0xBC, 0x18, 0x12, 0xB4, 0x19, 0xB2, 0x0E, 0x99, 0x3A, 0x7D, 0xE8, 0xC0, 0x18,
-    0x47, 0x68, 0x2A, 0x5D, 0x0D, 0xDD, 0x0D, 0x43, 0xBD, 0xCD, 0x64, 0x85, 0x3D, 0xD6, 0xB8, 0x1C,
-    0x88, 0x59, 0xF8, 0x34, 0x00, 0x43, 0xAE, 0x0A, 0xA4, 0x4D, 0x45, 0x9F, 0xC8, 0xCB, 0xF1, 0xD9,
-    0x26, 0x50, 0xD3, 0x10, 0x7A, 0x9A, 0xED, 0xD9, 0x06, 0xE9, 0x72, 0x14, 0xC2, 0xC5, 0xD8, 0x19,
-    0xF7, 0x0A, 0x59, 0xAE, 0x87, 0x39, 0x06, 0x40, 0x21, 0x84, 0x50, 0x19, 0x9A, 0x79, 0x5E, 0xF9,
-    0x4E, 0xC3, 0x32, 0x7C, 0x71, 0x66, 0x72, 0x76, 0xDC, 0x04, 0x8F, 0xA4, 0x99, 0x6F, 0xE6, 0x39,
-    0x4D, 0x74, 0x90, 0x4E, 0x86, 0xF1, 0x62, 0x96, 0x9B, 0x69, 0xA3, 0xBA, 0x6B, 0x38, 0x33, 0x7F,
-    0xB2, 0xA5, 0x75, 0xB8, 0x5E, 0x63, 0x33, 0xCB, 0xCD, 0xB4, 0xDB, 0xE6, 0x7F, 0x62, 0xCE, 0x22,
-    0x70, 0x90, 0xCB, 0xAB, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60,
-    0x82
-};
-
-#endif    /* __icon_switch_select_png_h_included */
@@ -0,0 +1,19 @@
+/* Generated by asset_packer, do not edit manually */
+#ifndef WIDGET_EN_BIG_SCREEN_ASSET_PACK_H
+#define WIDGET_EN_BIG_SCREEN_ASSET_PACK_H
+
+#include "utils/util_asset.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define WIDGET_EN_BIG_SCREEN_ASSET_PACK_ENTRY_COUNT        (8)
+
+extern const T_UtilAssetPack g_widgetEnBigScreenAssetPack;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -45,8 +45,12 @@ extern "C" {
 
 /* Exported functions --------------------------------------------------------*/
 
-extern uint32_t g_testEnBinaryArrayCount;
-extern T_DjiWidgetFileBinaryArray * g_testEnFileBinaryArrayList;
+/**
+ * @brief Get the english big screen ui config embedded in the firmware.
+ * @param config: pointer to the config to fill.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_GetTestEnWidgetBinaryArrayConfig(T_DjiWidgetBinaryArrayConfig *config);
 
 #ifdef __cplusplus
 }
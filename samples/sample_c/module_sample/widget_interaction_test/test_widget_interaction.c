@@ -45,16 +45,14 @@
 #include <payload_collaboration/test_payload_collaboration.h>
 #include <waypoint_v3/test_waypoint_v3.h>
 #include "dji_sdk_config.h"
-#include "hms/hms_text_c/en/hms_text_config_json.h"
 #include "dji_hms.h"
+#include "widget/test_widget_floating_window.h"
+#include "widget/test_widget_value_store.h"
 
 /* Private constants ---------------------------------------------------------*/
 #define WIDGET_DIR_PATH_LEN_MAX         (256)
 #define WIDGET_TASK_STACK_SIZE          (2048)
 
-#define WIDGET_LOG_STRING_MAX_SIZE      (40)
-#define WIDGET_LOG_LINE_MAX_NUM         (5)
-
 #define DJI_HMS_ERROR_CODE_VALUE0    0x1E020000
 #define DJI_HMS_ERROR_CODE_VALUE1    0x1E020001
 #define DJI_HMS_ERROR_CODE_VALUE2    0x1E020002
@@ -111,51 +109,43 @@ typedef enum {
     E_DJI_HMS_ERROR_LEVEL_INDEX5,
 } E_DjiExtensionPortHmsErrorLevelIndex;
 
-typedef struct {
-    bool valid;
-    char content[WIDGET_LOG_STRING_MAX_SIZE];
-} T_DjiTestWidgetLog;
-
 /* Private functions declaration ---------------------------------------------*/
-static void *DjiTest_WidgetTask(void *arg);
 static void *DjiTest_WidgetInteractionTask(void *arg);
-static T_DjiReturnCode DjiTestWidget_SetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t value,
-                                                    void *userData);
-static T_DjiReturnCode DjiTestWidget_GetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t *value,
-                                                    void *userData);
+static void DjiTestWidget_OnWidgetValueChange(uint32_t index, const T_DjiTestWidgetValue *value, void *userData);
+static uint32_t DjiTestWidget_GetHmsErrorCode(void);
+static E_DjiHmsErrorLevel DjiTestWidget_GetHmsErrorLevel(void);
 static T_DjiReturnCode DjiTestWidget_TriggerChangeAlias(void);
 
 /* Private values ------------------------------------------------------------*/
-static T_DjiTaskHandle s_widgetTestThread;
 static T_DjiTaskHandle s_widgetInteractionTestThread;
 static E_DjiExtensionPortSampleIndex s_extensionPortSampleIndex = E_DJI_SAMPLE_INDEX_FC_SUBSCRIPTION;
 static E_DjiExtensionPortHmsErrorCodeIndex s_extensionPortErrcodeIndex = E_DJI_HMS_ERROR_CODE_INDEX1;
 static E_DjiExtensionPortHmsErrorLevelIndex s_extensionPortErrLevelIndex = E_DJI_HMS_ERROR_LEVEL_INDEX1;
-static bool s_isInjectErrcode = false;
-static bool s_isEliminateErrcode = false;
 static bool s_isallowRunFlightControlSample = false;
-static bool s_isSampleStart = false;
+static volatile bool s_isSampleRunning = false;
+static T_DjiSemaHandle s_widgetSampleSema = NULL;
 static E_DjiMountPosition s_mountPosition = DJI_MOUNT_POSITION_PAYLOAD_PORT_NO1;
-static T_DjiTestWidgetLog s_djiTestWidgetLog[WIDGET_LOG_LINE_MAX_NUM] = {0};
 static T_DjiAircraftInfoBaseInfo s_aircraftInfoBaseInfo = {0};
 static bool s_isAliasChanged = false;
 
+static T_DjiTestWidgetValueStore s_widgetValueStore;
+
 static const T_DjiWidgetHandlerListItem s_widgetHandlerList[] = {
-    {0,  DJI_WIDGET_TYPE_BUTTON,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {1,  DJI_WIDGET_TYPE_LIST,          DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {2,  DJI_WIDGET_TYPE_SWITCH,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {3,  DJI_WIDGET_TYPE_SCALE,         DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {4,  DJI_WIDGET_TYPE_BUTTON,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {5,  DJI_WIDGET_TYPE_SCALE,         DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {6,  DJI_WIDGET_TYPE_INT_INPUT_BOX, DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {7,  DJI_WIDGET_TYPE_SWITCH,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {8,  DJI_WIDGET_TYPE_LIST,          DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {9,  DJI_WIDGET_TYPE_LIST,          DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {10, DJI_WIDGET_TYPE_BUTTON,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {11, DJI_WIDGET_TYPE_LIST,          DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {12, DJI_WIDGET_TYPE_LIST,          DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {13, DJI_WIDGET_TYPE_BUTTON,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
-    {14, DJI_WIDGET_TYPE_BUTTON,        DjiTestWidget_SetWidgetValue, DjiTestWidget_GetWidgetValue, NULL},
+    {0,  DJI_WIDGET_TYPE_BUTTON,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {1,  DJI_WIDGET_TYPE_LIST,          DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {2,  DJI_WIDGET_TYPE_SWITCH,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {3,  DJI_WIDGET_TYPE_SCALE,         DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {4,  DJI_WIDGET_TYPE_BUTTON,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {5,  DJI_WIDGET_TYPE_SCALE,         DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {6,  DJI_WIDGET_TYPE_INT_INPUT_BOX, DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {7,  DJI_WIDGET_TYPE_SWITCH,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {8,  DJI_WIDGET_TYPE_LIST,          DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {9,  DJI_WIDGET_TYPE_LIST,          DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {10, DJI_WIDGET_TYPE_BUTTON,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {11, DJI_WIDGET_TYPE_LIST,          DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {12, DJI_WIDGET_TYPE_LIST,          DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {13, DJI_WIDGET_TYPE_BUTTON,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
+    {14, DJI_WIDGET_TYPE_BUTTON,        DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_widgetValueStore)},
 };
 
 static const char *s_widgetTypeNameArray[] = {
@@ -168,7 +158,6 @@ static const char *s_widgetTypeNameArray[] = {
 };
 
 static const uint32_t s_widgetHandlerListCount = sizeof(s_widgetHandlerList) / sizeof(T_DjiWidgetHandlerListItem);
-static int32_t s_widgetValueList[sizeof(s_widgetHandlerList) / sizeof(T_DjiWidgetHandlerListItem)] = {0};
 static bool s_isWidgetFileDirPathConfigured = false;
 static char s_widgetFileDirPath[DJI_FILE_PATH_SIZE_MAX] = {0};
 
@@ -176,27 +165,10 @@ static char s_widgetFileDirPath[DJI_FILE_PATH_SIZE_MAX] = {0};
 void DjiTest_WidgetLogAppend(const char *fmt, ...)
 {
     va_list args;
-    char string[WIDGET_LOG_STRING_MAX_SIZE];
-    int32_t i;
 
     va_start(args, fmt);
-    vsnprintf(string, WIDGET_LOG_STRING_MAX_SIZE, fmt, args);
+    DjiTest_WidgetFloatingWindowAppendLogV(fmt, args);
     va_end(args);
-
-    for (i = 0; i < WIDGET_LOG_LINE_MAX_NUM; ++i) {
-        if (s_djiTestWidgetLog[i].valid == false) {
-            s_djiTestWidgetLog[i].valid = true;
-            strcpy(s_djiTestWidgetLog[i].content, string);
-            break;
-        }
-    }
-
-    if (i == WIDGET_LOG_LINE_MAX_NUM) {
-        for (i = 0; i < WIDGET_LOG_LINE_MAX_NUM - 1; i++) {
-            strcpy(s_djiTestWidgetLog[i].content, s_djiTestWidgetLog[i + 1].content);
-        }
-        strcpy(s_djiTestWidgetLog[WIDGET_LOG_LINE_MAX_NUM - 1].content, string);
-    }
 }
 
 T_DjiReturnCode DjiTest_WidgetInteractionStartService(void)
@@ -259,10 +231,13 @@ T_DjiReturnCode DjiTest_WidgetInteractionStartService(void)
     }
 #else
     //Step 2 : Set UI Config (RTOS environment)
-    T_DjiWidgetBinaryArrayConfig enWidgetBinaryArrayConfig = {
-        .binaryArrayCount = g_testEnBinaryArrayCount,
-        .fileBinaryArrayList = g_testEnFileBinaryArrayList
-    };
+    T_DjiWidgetBinaryArrayConfig enWidgetBinaryArrayConfig = {0};
+
+    djiStat = DjiTest_GetTestEnWidgetBinaryArrayConfig(&enWidgetBinaryArrayConfig);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Load widget ui config assets error, stat = 0x%08llX", djiStat);
+        return djiStat;
+    }
 
     //set default ui config
     djiStat = DjiWidget_RegDefaultUiConfigByBinaryArray(&enWidgetBinaryArrayConfig);
@@ -271,18 +246,32 @@ T_DjiReturnCode DjiTest_WidgetInteractionStartService(void)
         return djiStat;
     }
 #endif
-    //Step 3 : Set widget handler list
+    //Step 3 : Set widget handler list, the widget values are kept by the value store
+    djiStat = DjiTest_WidgetValueStoreInit(&s_widgetValueStore, s_widgetHandlerList, s_widgetHandlerListCount);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Init widget value store error, stat = 0x%08llX", djiStat);
+        return djiStat;
+    }
+    DjiTest_WidgetValueStoreRegObserver(&s_widgetValueStore, DJI_TEST_WIDGET_VALUE_STORE_ANY_INDEX,
+                                        DjiTestWidget_OnWidgetValueChange, NULL);
+
     djiStat = DjiWidget_RegHandlerList(s_widgetHandlerList, s_widgetHandlerListCount);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("Set widget handler list error, stat = 0x%08llX", djiStat);
         return djiStat;
     }
 
-    //Step 4 : Run widget api sample task
-    if (osalHandler->TaskCreate("user_widget_task", DjiTest_WidgetTask, WIDGET_TASK_STACK_SIZE, NULL,
-                                &s_widgetTestThread) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Dji widget test task create error.");
-        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    //Step 4 : Run widget floating window and widget api sample task
+    djiStat = DjiTest_WidgetFloatingWindowStart(NULL, NULL);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Dji widget floating window start error, stat = 0x%08llX", djiStat);
+        return djiStat;
+    }
+
+    djiStat = osalHandler->SemaphoreCreate(0, &s_widgetSampleSema);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Dji widget sample semaphore create error, stat = 0x%08llX", djiStat);
+        return djiStat;
     }
 
     if (osalHandler->TaskCreate("user_widget_task", DjiTest_WidgetInteractionTask, WIDGET_TASK_STACK_SIZE, NULL,
@@ -303,58 +292,7 @@ T_DjiReturnCode DjiTest_WidgetInteractionSetConfigFilePath(const char *path)
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
-#ifndef __CC_ARM
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmissing-noreturn"
-#pragma GCC diagnostic ignored "-Wreturn-type"
-#pragma GCC diagnostic ignored "-Wformat"
-#endif
-
 /* Private functions definition-----------------------------------------------*/
-static void *DjiTest_WidgetTask(void *arg)
-{
-    char message[DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN];
-    uint32_t sysTimeMs = 0;
-    T_DjiReturnCode djiStat;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-
-    USER_UTIL_UNUSED(arg);
-
-    while (1) {
-        djiStat = osalHandler->GetTimeMs(&sysTimeMs);
-        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("Get system time ms error, stat = 0x%08llX", djiStat);
-        }
-#ifndef USER_FIRMWARE_MAJOR_VERSION
-        snprintf(message, DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN,
-                 "System time : %u ms \r\n%s \r\n%s \r\n%s \r\n%s \r\n%s \r\n",
-                 sysTimeMs,
-                 s_djiTestWidgetLog[0].content,
-                 s_djiTestWidgetLog[1].content,
-                 s_djiTestWidgetLog[2].content,
-                 s_djiTestWidgetLog[3].content,
-                 s_djiTestWidgetLog[4].content);
-#else
-        snprintf(message, DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN,
-                 "System time : %u ms\r\nVersion: v%02d.%02d.%02d.%02d\r\nBuild time: %s %s", sysTimeMs,
-                 USER_FIRMWARE_MAJOR_VERSION, USER_FIRMWARE_MINOR_VERSION,
-                 USER_FIRMWARE_MODIFY_VERSION, USER_FIRMWARE_DEBUG_VERSION,
-                 __DATE__, __TIME__);
-#endif
-
-        djiStat = DjiWidgetFloatingWindow_ShowMessage(message);
-        if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-            USER_LOG_ERROR("Floating window show message error, stat = 0x%08llX", djiStat);
-        }
-
-        osalHandler->TaskSleepMs(200);
-    }
-}
-
-#ifndef __CC_ARM
-#pragma GCC diagnostic pop
-#endif
-
 #ifndef __CC_ARM
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmissing-noreturn"
@@ -366,8 +304,6 @@ static void *DjiTest_WidgetInteractionTask(void *arg)
 {
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
     T_DjiReturnCode returnCode;
-    uint32_t errorCode;
-    E_DjiHmsErrorLevel errorLevel;
 
     returnCode = DjiAircraftInfo_GetBaseInfo(&s_aircraftInfoBaseInfo);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -376,87 +312,9 @@ static void *DjiTest_WidgetInteractionTask(void *arg)
     }
 
     while (1) {
-        osalHandler->TaskSleepMs(100);
-
-        if (s_isInjectErrcode == true && s_isEliminateErrcode == false) {
-            switch (s_extensionPortErrcodeIndex) {
-                case E_DJI_HMS_ERROR_CODE_INDEX1:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE0;
-                    break;
-                case E_DJI_HMS_ERROR_CODE_INDEX2:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE1;
-                    break;
-                case E_DJI_HMS_ERROR_CODE_INDEX3:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE2;
-                    break;
-                case E_DJI_HMS_ERROR_CODE_INDEX4:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE3;
-                    break;
-                case E_DJI_HMS_ERROR_CODE_INDEX5:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE4;
-                    break;
-                default:
-                    break;
-            }
-            switch (s_extensionPortErrLevelIndex) {
-                case E_DJI_HMS_ERROR_LEVEL_INDEX1:
-                    errorLevel = DJI_HMS_ERROR_LEVEL_NONE;
-                    break;
-                case E_DJI_HMS_ERROR_LEVEL_INDEX2:
-                    errorLevel = DJI_HMS_ERROR_LEVEL_HINT;
-                    break;
-                case E_DJI_HMS_ERROR_LEVEL_INDEX3:
-                    errorLevel = DJI_HMS_ERROR_LEVEL_WARN;
-                    break;
-                case E_DJI_HMS_ERROR_LEVEL_INDEX4:
-                    errorLevel = DJI_HMS_ERROR_LEVEL_CRITICAL;
-                    break;
-                case E_DJI_HMS_ERROR_LEVEL_INDEX5:
-                    errorLevel = DJI_HMS_ERROR_LEVEL_FATAL;
-                    break;
-                default:
-                    break;
-            }
-            DjiHmsCustomization_InjectHmsErrorCode(errorCode, errorLevel);
-            osalHandler->TaskSleepMs(500);
-            s_isInjectErrcode = false;
-            s_isEliminateErrcode = false;
-            continue;
-        }
-        if (s_isEliminateErrcode == true && s_isInjectErrcode == false) {
-            switch (s_extensionPortErrcodeIndex) {
-                case E_DJI_HMS_ERROR_CODE_INDEX1:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE0;
-                    break;
-                case E_DJI_HMS_ERROR_CODE_INDEX2:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE1;
-                    break;
-                case E_DJI_HMS_ERROR_CODE_INDEX3:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE2;
-                    break;
-                case E_DJI_HMS_ERROR_CODE_INDEX4:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE3;
-                    break;
-                case E_DJI_HMS_ERROR_CODE_INDEX5:
-                    errorCode = DJI_HMS_ERROR_CODE_VALUE4;
-                    break;
-                default:
-                    break;
-            }
-            DjiHmsCustomization_EliminateHmsErrorCode(errorCode);
-            osalHandler->TaskSleepMs(500);
-            s_isInjectErrcode = false;
-            s_isEliminateErrcode = false;
-            continue;
-        }
-
-        if (s_isSampleStart != true) {
-            continue;
-        }
+        /* Posted by the start button, the sample runs here so that the other widgets are still served meanwhile. */
+        osalHandler->SemaphoreWait(s_widgetSampleSema);
 
-        osalHandler->TaskSleepMs(500);
-
-        s_isSampleStart = false;
         printf("\r\n");
         USER_LOG_INFO("--------------------------------------------------------------------------------------------->");
         DjiTest_WidgetLogAppend("-> Sample Start");
@@ -611,6 +469,7 @@ static void *DjiTest_WidgetInteractionTask(void *arg)
 
         USER_LOG_INFO("--------------------------------------------------------------------------------------------->");
         DjiTest_WidgetLogAppend("-> Sample End");
+        s_isSampleRunning = false;
     }
 }
 
@@ -618,69 +477,108 @@ static void *DjiTest_WidgetInteractionTask(void *arg)
 #pragma GCC diagnostic pop
 #endif
 
-static T_DjiReturnCode DjiTestWidget_SetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t value,
-                                                    void *userData)
+static void DjiTestWidget_OnWidgetValueChange(uint32_t index, const T_DjiTestWidgetValue *value, void *userData)
 {
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    bool isPressed = value->type == DJI_WIDGET_TYPE_BUTTON && value->value == DJI_WIDGET_BUTTON_STATE_PRESS_DOWN;
+
     USER_UTIL_UNUSED(userData);
 
     DjiTest_WidgetLogAppend("SetWidget type:%s index:%d value:%d",
-                            s_widgetTypeNameArray[widgetType], index, value);
+                            s_widgetTypeNameArray[value->type], index, value->value);
     USER_LOG_INFO("Set widget value, widgetType = %s, widgetIndex = %d ,widgetValue = %d",
-                  s_widgetTypeNameArray[widgetType], index, value);
-    s_widgetValueList[index] = value;
+                  s_widgetTypeNameArray[value->type], index, value->value);
 
-    if (widgetType == DJI_WIDGET_TYPE_SWITCH && index == 7) {
-        s_isallowRunFlightControlSample = value;
+    if (value->type == DJI_WIDGET_TYPE_SWITCH && index == 7) {
+        s_isallowRunFlightControlSample = value->value;
     }
 
-    if (widgetType == DJI_WIDGET_TYPE_LIST && index == 8) {
-        s_mountPosition = value + 1;
+    if (value->type == DJI_WIDGET_TYPE_LIST && index == 8) {
+        s_mountPosition = value->value + 1;
     }
 
-    if (widgetType == DJI_WIDGET_TYPE_LIST && index == 9) {
-        s_extensionPortSampleIndex = value;
+    if (value->type == DJI_WIDGET_TYPE_LIST && index == 9) {
+        s_extensionPortSampleIndex = value->value;
     }
 
-    if (widgetType == DJI_WIDGET_TYPE_BUTTON && index == 10) {
-        if (value == 1) {
-            s_isSampleStart = true;
+    if (isPressed && index == 10) {
+        if (s_isSampleRunning == true) {
+            DjiTest_WidgetLogAppend("Sample is running, please wait");
+        } else {
+            s_isSampleRunning = true;
+            osalHandler->SemaphorePost(s_widgetSampleSema);
         }
     }
 
-    if (widgetType == DJI_WIDGET_TYPE_LIST && index == 11) {
-        s_extensionPortErrcodeIndex = value;
+    if (value->type == DJI_WIDGET_TYPE_LIST && index == 11) {
+        s_extensionPortErrcodeIndex = value->value;
     }
 
-    if (widgetType == DJI_WIDGET_TYPE_LIST && index == 12) {
-        s_extensionPortErrLevelIndex = value;
+    if (value->type == DJI_WIDGET_TYPE_LIST && index == 12) {
+        s_extensionPortErrLevelIndex = value->value;
     }
 
-    if (widgetType == DJI_WIDGET_TYPE_BUTTON && index == 13) {
-        if (value == 1) {
-            s_isInjectErrcode = true;
-            s_isEliminateErrcode = false;
-        }
+    if (isPressed && index == 13) {
+        DjiHmsCustomization_InjectHmsErrorCode(DjiTestWidget_GetHmsErrorCode(), DjiTestWidget_GetHmsErrorLevel());
     }
 
-    if (widgetType == DJI_WIDGET_TYPE_BUTTON && index == 14) {
-        if (value == 1) {
-            s_isInjectErrcode = false;
-            s_isEliminateErrcode = true;
-        }
+    if (isPressed && index == 14) {
+        DjiHmsCustomization_EliminateHmsErrorCode(DjiTestWidget_GetHmsErrorCode());
     }
+}
 
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+static uint32_t DjiTestWidget_GetHmsErrorCode(void)
+{
+    uint32_t errorCode = DJI_HMS_ERROR_CODE_VALUE0;
+
+    switch (s_extensionPortErrcodeIndex) {
+        case E_DJI_HMS_ERROR_CODE_INDEX1:
+            errorCode = DJI_HMS_ERROR_CODE_VALUE0;
+            break;
+        case E_DJI_HMS_ERROR_CODE_INDEX2:
+            errorCode = DJI_HMS_ERROR_CODE_VALUE1;
+            break;
+        case E_DJI_HMS_ERROR_CODE_INDEX3:
+            errorCode = DJI_HMS_ERROR_CODE_VALUE2;
+            break;
+        case E_DJI_HMS_ERROR_CODE_INDEX4:
+            errorCode = DJI_HMS_ERROR_CODE_VALUE3;
+            break;
+        case E_DJI_HMS_ERROR_CODE_INDEX5:
+            errorCode = DJI_HMS_ERROR_CODE_VALUE4;
+            break;
+        default:
+            break;
+    }
+
+    return errorCode;
 }
 
-static T_DjiReturnCode DjiTestWidget_GetWidgetValue(E_DjiWidgetType widgetType, uint32_t index, int32_t *value,
-                                                    void *userData)
+static E_DjiHmsErrorLevel DjiTestWidget_GetHmsErrorLevel(void)
 {
-    USER_UTIL_UNUSED(userData);
-    USER_UTIL_UNUSED(widgetType);
+    E_DjiHmsErrorLevel errorLevel = DJI_HMS_ERROR_LEVEL_NONE;
 
-    *value = s_widgetValueList[index];
+    switch (s_extensionPortErrLevelIndex) {
+        case E_DJI_HMS_ERROR_LEVEL_INDEX1:
+            errorLevel = DJI_HMS_ERROR_LEVEL_NONE;
+            break;
+        case E_DJI_HMS_ERROR_LEVEL_INDEX2:
+            errorLevel = DJI_HMS_ERROR_LEVEL_HINT;
+            break;
+        case E_DJI_HMS_ERROR_LEVEL_INDEX3:
+            errorLevel = DJI_HMS_ERROR_LEVEL_WARN;
+            break;
+        case E_DJI_HMS_ERROR_LEVEL_INDEX4:
+            errorLevel = DJI_HMS_ERROR_LEVEL_CRITICAL;
+            break;
+        case E_DJI_HMS_ERROR_LEVEL_INDEX5:
+            errorLevel = DJI_HMS_ERROR_LEVEL_FATAL;
+            break;
+        default:
+            break;
+    }
 
-    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    return errorLevel;
 }
 
 static T_DjiReturnCode DjiTestWidget_TriggerChangeAlias(void)
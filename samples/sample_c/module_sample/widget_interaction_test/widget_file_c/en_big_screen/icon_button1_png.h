@@ -1,148 +0,0 @@
-/* Generated by file2c, do not edit manually */
-#ifndef __icon_button1_png_h_included
-#define __icon_button1_png_h_included
-
-#include <stdint.h>
-
-/* Contents of file icon_button1.png */
-#define icon_button1_png_fileName        "icon_button1.png"
-#define icon_button1_png_fileSize        2137
-
-static const uint8_t icon_button1_png_fileBinaryArray[2137] = {
-    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77,
-    0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
-    0x08, 0x13, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x3D, 0x6F, 0x14, 0x47, 0x18, 0xC7,
-    0xCF, 0x6F, 0x98, 0x84, 0x18, 0x04, 0xB2, 0xD2, 0x44, 0x89, 0x84, 0x15, 0x0B, 0x24, 0x8B, 0x86,
-    0x32, 0x1F, 0xC0, 0x20, 0x45, 0xF9, 0x18, 0x40, 0x4D, 0x81, 0x42, 0x50, 0xAA, 0x28, 0x05, 0xD4,
-    0xA9, 0x02, 0x5F, 0x80, 0x92, 0xC2, 0x29, 0xB0, 0xD2, 0xA6, 0x8A, 0x28, 0x23, 0x41, 0x83, 0x95,
-    0x14, 0x96, 0x90, 0x10, 0x28, 0x26, 0xE4, 0x05, 0x7C, 0x38, 0xF3, 0x1B, 0xF6, 0xBF, 0x1A, 0xCF,
-    0xED, 0xEE, 0xDD, 0xEE, 0x3D, 0xF6, 0xEE, 0xF9, 0x66, 0xA4, 0xF1, 0xBC, 0x3E, 0xCF, 0xCE, 0xFE,
-    0xFE, 0x33, 0xFB, 0x18, 0x9D, 0xB9, 0x9D, 0xE9, 0x55, 0xA7, 0x99, 0x68, 0x38, 0x6E, 0x47, 0xC3,
-    0xBD, 0x61, 0xE3, 0xF1, 0xFC, 0x49, 0x6D, 0xEF, 0x0D, 0x59, 0x78, 0x3C, 0x1E, 0xB7, 0x73, 0xF3,
-    0x32, 0x60, 0xEA, 0x57, 0x89, 0x81, 0xEA, 0x94, 0xAA, 0x87, 0xFD, 0xD4, 0xA7, 0x31, 0x85, 0x70,
-    0xA9, 0xAB, 0xAD, 0x12, 0x26, 0xAA, 0xAB, 0xCC, 0x39, 0xCD, 0xE7, 0xB5, 0xF7, 0x15, 0x81, 0x0D,
-    0x4B, 0x01, 0x8F, 0x4B, 0x2C, 0xD4, 0x17, 0xB9, 0x99, 0xAA, 0x26, 0x50, 0x05, 0x56, 0xF5, 0xB8,
-    0x8C, 0x81, 0x68, 0x7E, 0xE1, 0x4E, 0x16, 0xD4, 0xB0, 0x9C, 0x75, 0x1E, 0x94, 0xE9, 0xA7, 0xAE,
-    0x71, 0x9C, 0x53, 0x9F, 0xC6, 0x24, 0x90, 0x02, 0xFE, 0xCE, 0x41, 0xA0, 0x4E, 0xA9, 0xAC, 0xB1,
-    0xB0, 0x84, 0x15, 0xED, 0x5E, 0xD1, 0x09, 0x10, 0x58, 0x01, 0x9F, 0x73, 0xF3, 0xA8, 0xC7, 0x65,
-    0x28, 0x04, 0xBE, 0x48, 0xD3, 0x22, 0x84, 0x87, 0xF7, 0xFE, 0x96, 0x73, 0xE0, 0xF4, 0x01, 0xBD,
-    0x5F, 0x52, 0x32, 0xA6, 0x94, 0xDB, 0x4B, 0x00, 0x41, 0x57, 0x29, 0xE0, 0x40, 0x27, 0x2F, 0x64,
-    0x25, 0xF3, 0xD5, 0x27, 0x81, 0x64, 0xE3, 0x86, 0x7C, 0x3A, 0xEA, 0x22, 0xE4, 0xF0, 0xDC, 0xDD,
-    0x52, 0x17, 0x78, 0xC1, 0x47, 0x80, 0x5D, 0x97, 0x29, 0xDF, 0xBA, 0x0C, 0x0F, 0xEA, 0xA4, 0x50,
-    0x04, 0xDA, 0x7B, 0x12, 0x80, 0x06, 0x89, 0xC9, 0x21, 0x7C, 0xC0, 0xC7, 0x19, 0x1B, 0x09, 0x11,
-    0x8A, 0xE0, 0xBA, 0xA7, 0xEE, 0x04, 0xC4, 0xF0, 0x01, 0x4F, 0x06, 0x3C, 0x19, 0x3E, 0x94, 0x61,
-    0x42, 0x84, 0x5C, 0x44, 0x40, 0x6A, 0x07, 0xAB, 0x94, 0x00, 0x80, 0x3F, 0x96, 0xE5, 0xC5, 0xA0,
-    0x4E, 0x9F, 0x4E, 0x84, 0x1E, 0x4B, 0xB2, 0x75, 0x43, 0x53, 0x93, 0xC2, 0xDD, 0xCF, 0x0E, 0xD7,
-    0x8E, 0x7F, 0xE3, 0xEA, 0xCA, 0xB0, 0x84, 0x8D, 0x92, 0x6C, 0xC2, 0xBE, 0x7C, 0xD7, 0x23, 0x06,
-    0x70, 0x4F, 0xB8, 0x7C, 0xCA, 0xE5, 0x8F, 0x5D, 0xFE, 0xD4, 0xE5, 0x55, 0x97, 0x2F, 0x5C, 0xBB,
-    0x76, 0xED, 0xAB, 0xA7, 0x4F, 0x9F, 0x6E, 0xEC, 0xEC, 0xEC, 0x6C, 0xED, 0xED, 0xED, 0xF5, 0x5D,
-    0x4E, 0x69, 0x3F, 0x81, 0x3E, 0x6C, 0x60, 0x04, 0x2B, 0x98, 0x65, 0xEC, 0x60, 0x08, 0x4B, 0x98,
-    0xC2, 0x16, 0xC6, 0xB0, 0xCE, 0xC5, 0x41, 0x0D, 0x1A, 0xEC, 0xEA, 0xE3, 0x2E, 0x2F, 0xB9, 0xBC,
-    0xEC, 0xF2, 0x27, 0x2E, 0x7F, 0xEE, 0xF2, 0x85, 0x07, 0x0F, 0x1E, 0x7C, 0xBD, 0xBB, 0xBB, 0xFB,
-    0x7A, 0xFF, 0xF5, 0x52, 0xAB, 0x8C, 0x00, 0xAC, 0x60, 0x06, 0xBB, 0x8C, 0x21, 0x2C, 0x61, 0x0A,
-    0x5B, 0x18, 0xC3, 0xDA, 0x0B, 0x10, 0x3E, 0x42, 0xE8, 0x50, 0xC0, 0x65, 0x02, 0x8F, 0x9D, 0xE3,
-    0x4E, 0xCD, 0x95, 0xEB, 0xD7, 0xAF, 0xFF, 0x30, 0x37, 0x37, 0xF7, 0xA1, 0x6B, 0xA7, 0x34, 0x02,
-    0x81, 0xD9, 0xD9, 0xD9, 0x85, 0xD5, 0xD5, 0xD5, 0x2F, 0x9E, 0x3D, 0x7B, 0xF6, 0xF3, 0xA3, 0x47,
-    0x8F, 0x76, 0x9C, 0x89, 0x02, 0x34, 0xA5, 0x62, 0x80, 0x8F, 0x03, 0xDA, 0xFD, 0x94, 0x1C, 0x0B,
-    0xC0, 0x73, 0x44, 0x3E, 0x70, 0x19, 0xE0, 0x27, 0xDC, 0x91, 0xFA, 0xFE, 0xEC, 0xD9, 0xB3, 0x5F,
-    0xBA, 0x7A, 0x4A, 0x35, 0x09, 0x6C, 0x6D, 0x6D, 0xFD, 0xB4, 0xB2, 0xB2, 0xF2, 0xAD, 0x33, 0x7B,
-    0xED, 0xF2, 0xDF, 0x2E, 0xFF, 0xE3, 0x32, 0xF1, 0x81, 0xC0, 0x4C, 0xB0, 0xDE, 0x63, 0xD7, 0x93,
-    0x10, 0x40, 0x62, 0xE8, 0xD7, 0x4C, 0x1F, 0x13, 0x96, 0x97, 0x97, 0xD7, 0xFC, 0x8C, 0xF4, 0xA3,
-    0x36, 0x81, 0x8C, 0x9D, 0x9E, 0xF9, 0xE2, 0xEA, 0x1F, 0x3D, 0x19, 0x6F, 0xFF, 0x1C, 0xC2, 0xB1,
-    0x04, 0x08, 0x45, 0xF0, 0x27, 0x62, 0x69, 0x69, 0xE9, 0xB3, 0xDA, 0x57, 0x4E, 0x06, 0x9E, 0x40,
-    0xC6, 0x8E, 0xA7, 0x0A, 0x2C, 0xC3, 0xC7, 0xBD, 0x78, 0xE7, 0x02, 0x08, 0x99, 0x06, 0x14, 0x0F,
-    0x64, 0xA4, 0xF1, 0x54, 0xD6, 0x23, 0x10, 0x73, 0x14, 0xDF, 0xDC, 0x8B, 0x1E, 0x41, 0x74, 0x68,
-    0x90, 0x3E, 0x65, 0x04, 0x48, 0x69, 0x3C, 0x02, 0xDA, 0xC4, 0x62, 0x2A, 0xCE, 0xDE, 0x2B, 0x9D,
-    0x74, 0x90, 0xC2, 0x92, 0x7A, 0x38, 0xE6, 0x27, 0xA4, 0x1F, 0x8D, 0x08, 0x84, 0x2C, 0x43, 0xC6,
-    0x38, 0x9B, 0x01, 0x32, 0x69, 0x60, 0x20, 0xEB, 0xD3, 0xB8, 0x9F, 0x94, 0x7E, 0x34, 0x22, 0xA0,
-    0x8D, 0x5C, 0xC4, 0x78, 0x20, 0x06, 0x70, 0x05, 0x4D, 0x6C, 0x74, 0xB5, 0x64, 0x54, 0x49, 0x60,
-    0x80, 0x6D, 0xD9, 0x0E, 0x67, 0xA2, 0x72, 0xA5, 0xC7, 0x34, 0x38, 0x94, 0x80, 0x38, 0x0E, 0xC0,
-    0xC7, 0xB2, 0x4C, 0x80, 0xA1, 0x5E, 0xD3, 0x04, 0x1B, 0x02, 0x49, 0x00, 0x1B, 0x8E, 0x8D, 0xBD,
-    0x24, 0x01, 0x1A, 0xA3, 0xB3, 0x31, 0x4C, 0x02, 0xD8, 0x70, 0x6C, 0xEC, 0x25, 0x09, 0xD0, 0x18,
-    0x9D, 0x8D, 0x61, 0x12, 0xC0, 0x86, 0x63, 0x63, 0x2F, 0x49, 0x80, 0xC6, 0xE8, 0x6C, 0x0C, 0x93,
-    0x00, 0x36, 0x1C, 0x1B, 0x7B, 0x99, 0x28, 0x01, 0x1E, 0x3E, 0x7C, 0xD8, 0xF8, 0x46, 0x8B, 0x0C,
-    0xAD, 0xFD, 0x15, 0x5D, 0x63, 0x58, 0xDF, 0xC4, 0x08, 0xF0, 0xE4, 0xC9, 0x93, 0xDE, 0xBD, 0x7B,
-    0xF7, 0x86, 0xDD, 0xCF, 0xC8, 0xE3, 0xD6, 0xFE, 0x46, 0xBE, 0x70, 0x34, 0x71, 0x22, 0x04, 0x78,
-    0xF9, 0xF2, 0x65, 0xEF, 0xF6, 0xED, 0xDB, 0xBD, 0xB7, 0x6F, 0xF9, 0x24, 0x6F, 0xFC, 0x64, 0xED,
-    0x6F, 0x9C, 0x15, 0x75, 0x5E, 0x00, 0xF7, 0x17, 0x06, 0x1E, 0xFE, 0x8B, 0x17, 0x2F, 0xC6, 0xB9,
-    0xCF, 0xDC, 0xD6, 0xDA, 0x5F, 0xEE, 0xB8, 0x61, 0xA5, 0xF3, 0x02, 0xDC, 0xBD, 0x7B, 0xB7, 0xF7,
-    0xF8, 0xF1, 0xE3, 0x86, 0xB7, 0x37, 0x68, 0x66, 0xED, 0x6F, 0xF0, 0x0A, 0xF5, 0x7A, 0x3A, 0x2D,
-    0x00, 0x41, 0xD2, 0x32, 0x50, 0x5A, 0xFB, 0xAB, 0x87, 0xBA, 0x78, 0x76, 0x67, 0x05, 0xB0, 0x0E,
-    0x92, 0xD6, 0xFE, 0x8A, 0x71, 0xD6, 0xEF, 0xED, 0xA4, 0x00, 0xD6, 0x41, 0xD2, 0xDA, 0x5F, 0x7D,
-    0xCC, 0xE5, 0x16, 0x9D, 0x13, 0xC0, 0x3A, 0x48, 0x5A, 0xFB, 0x2B, 0x47, 0xD9, 0x6C, 0xA4, 0x73,
-    0x02, 0x58, 0x07, 0x49, 0x6B, 0x7F, 0xCD, 0x30, 0x97, 0x5B, 0x75, 0x4A, 0x80, 0xCD, 0xCD, 0x4D,
-    0xD3, 0xA0, 0x6B, 0xED, 0xAF, 0x1C, 0x63, 0xF3, 0x91, 0xCE, 0x08, 0x40, 0x90, 0x64, 0xB7, 0x5A,
-    0x25, 0x6B, 0x7F, 0x56, 0xEB, 0x8A, 0xFD, 0x74, 0x42, 0x00, 0xEB, 0x20, 0x69, 0xED, 0x2F, 0x86,
-    0x66, 0xD9, 0x6E, 0x5D, 0x00, 0xEB, 0x20, 0x69, 0xED, 0xCF, 0x12, 0x76, 0x91, 0xAF, 0xD6, 0x05,
-    0xB0, 0x0E, 0x92, 0xD6, 0xFE, 0x8A, 0xA0, 0x59, 0xF6, 0xB5, 0x2A, 0x80, 0x75, 0x90, 0xB4, 0xF6,
-    0x67, 0x09, 0xBA, 0xCC, 0x57, 0x6B, 0x02, 0x58, 0x07, 0x49, 0x6B, 0x7F, 0x65, 0xC0, 0xAC, 0xFB,
-    0x5B, 0x11, 0xC0, 0x3A, 0x48, 0x5A, 0xFB, 0xB3, 0x86, 0x5C, 0xE5, 0xEF, 0xD0, 0x05, 0xB0, 0x0E,
-    0x92, 0xD6, 0xFE, 0xAA, 0x60, 0x1D, 0xC4, 0xD8, 0xA1, 0x0B, 0x60, 0x1D, 0x24, 0xAD, 0xFD, 0x1D,
-    0x04, 0xE4, 0x2A, 0x9F, 0x87, 0x2E, 0xC0, 0xCC, 0x4C, 0xE1, 0xDF, 0xA8, 0x56, 0xAD, 0xB1, 0x72,
-    0xCC, 0xDA, 0x5F, 0xE5, 0xC5, 0x0E, 0x60, 0xF0, 0xD0, 0x05, 0xB8, 0x72, 0xE5, 0x4A, 0xEF, 0xFC,
-    0xF9, 0xF3, 0x66, 0xB7, 0x62, 0xED, 0xCF, 0x6C, 0x61, 0x23, 0x3A, 0x3A, 0x74, 0x01, 0xE6, 0xE7,
-    0xE7, 0x7B, 0x37, 0x6F, 0xDE, 0xEC, 0x9D, 0x39, 0x73, 0x66, 0xC4, 0x25, 0x56, 0x4F, 0xB3, 0xF6,
-    0x57, 0x7D, 0x35, 0xFB, 0xD1, 0x43, 0x17, 0x80, 0x5B, 0x38, 0x7D, 0xFA, 0xB4, 0x17, 0x61, 0x61,
-    0x81, 0xFF, 0x40, 0x38, 0x7E, 0xB2, 0xF6, 0x37, 0xFE, 0x8A, 0x46, 0xF7, 0xD0, 0x8A, 0x00, 0x2C,
-    0xEF, 0xDC, 0xB9, 0x73, 0xBD, 0xAB, 0x57, 0xAF, 0x8E, 0xBE, 0xD2, 0x21, 0x33, 0xAD, 0xFD, 0x0D,
-    0xB9, 0x9C, 0xD9, 0x70, 0x6B, 0x02, 0x70, 0x07, 0xEB, 0xEB, 0xEB, 0xBD, 0xCB, 0x97, 0x2F, 0x9B,
-    0xDD, 0x8C, 0xB5, 0x3F, 0xB3, 0x85, 0x55, 0x38, 0x6A, 0x55, 0x00, 0xD6, 0x65, 0x1D, 0x44, 0xAD,
-    0xFD, 0x55, 0xB0, 0x33, 0x19, 0x6A, 0x5D, 0x00, 0xEB, 0x20, 0x6A, 0xED, 0xCF, 0x84, 0x72, 0x85,
-    0x93, 0xD6, 0x05, 0x60, 0x6D, 0xD6, 0x41, 0xD4, 0xDA, 0x5F, 0x05, 0xBF, 0xB1, 0x87, 0x3A, 0x21,
-    0x00, 0x77, 0x61, 0x1D, 0x44, 0xAD, 0xFD, 0x8D, 0x4D, 0xBA, 0xC4, 0x41, 0x67, 0x04, 0x60, 0x7D,
-    0x04, 0xD1, 0x4B, 0x97, 0x2E, 0x95, 0x2C, 0xB5, 0x7E, 0xB7, 0xB5, 0xBF, 0xFA, 0x2B, 0x18, 0x6E,
-    0xD1, 0x29, 0x01, 0x58, 0x2E, 0xBF, 0x9A, 0x5A, 0xFE, 0x4B, 0xD9, 0xDA, 0xDF, 0x70, 0xA4, 0xF5,
-    0x66, 0x74, 0x4E, 0x00, 0xEB, 0x20, 0x6A, 0xED, 0xAF, 0x1E, 0xDE, 0xE1, 0xB3, 0x3B, 0x27, 0x00,
-    0x4B, 0xB6, 0x0E, 0xA2, 0xD6, 0xFE, 0x86, 0x63, 0x1D, 0x7D, 0x46, 0x27, 0x05, 0x60, 0xF9, 0xD6,
-    0x41, 0xD4, 0xDA, 0xDF, 0xE8, 0x88, 0xAB, 0x67, 0x76, 0x56, 0x00, 0x96, 0x6D, 0x1D, 0x44, 0xAD,
-    0xFD, 0x55, 0xA3, 0x1D, 0x6D, 0xB4, 0xD3, 0x02, 0x70, 0x0B, 0xD6, 0x41, 0xD4, 0xDA, 0xDF, 0x68,
-    0x98, 0xCB, 0x67, 0x75, 0x5E, 0x00, 0xEB, 0x20, 0x6A, 0xED, 0xAF, 0x1C, 0xED, 0x68, 0x23, 0x9D,
-    0x17, 0x80, 0xDB, 0xB0, 0x0E, 0xA2, 0xD6, 0xFE, 0x46, 0x43, 0x5D, 0x3C, 0x6B, 0x22, 0x04, 0x60,
-    0xE9, 0xD6, 0x41, 0xD4, 0xDA, 0x5F, 0x31, 0xDE, 0xE1, 0xBD, 0x7C, 0x40, 0xCB, 0x97, 0xCA, 0x91,
-    0xF5, 0x6D, 0xB9, 0x7C, 0x61, 0xEB, 0x47, 0x2E, 0x9F, 0x74, 0xF9, 0x94, 0xFB, 0x7A, 0xDE, 0x4D,
-    0x57, 0xA6, 0xD4, 0x90, 0x80, 0xFB, 0xCC, 0x7A, 0xDD, 0x99, 0xFE, 0xE9, 0x32, 0xDF, 0xA0, 0xFB,
-    0x97, 0xCB, 0x7C, 0x81, 0xEB, 0x7F, 0x2E, 0xF3, 0x5F, 0x3E, 0xFB, 0x13, 0x73, 0x02, 0xDC, 0x62,
-    0x8F, 0x64, 0x4A, 0x02, 0xB4, 0x2C, 0x6B, 0x12, 0x20, 0x09, 0xD0, 0x32, 0x81, 0x96, 0x2F, 0x9F,
-    0x4E, 0x40, 0x12, 0xA0, 0x65, 0x02, 0x2D, 0x5F, 0x3E, 0x9D, 0x80, 0x24, 0x40, 0xCB, 0x04, 0x5A,
-    0xBE, 0x7C, 0xD9, 0x09, 0xD0, 0xDB, 0x7E, 0xFC, 0x6B, 0x36, 0x5A, 0x5E, 0xE3, 0xA4, 0x5F, 0xBE,
-    0x92, 0x65, 0x91, 0x00, 0x09, 0xFA, 0xC1, 0x49, 0x3E, 0xC0, 0x56, 0x02, 0x68, 0x20, 0x2C, 0xA9,
-    0xF3, 0xC2, 0x99, 0x94, 0xC6, 0x23, 0xB0, 0xEF, 0xA5, 0x3D, 0xCE, 0x55, 0xC8, 0xD8, 0x7F, 0x77,
-    0xF4, 0xBE, 0x8E, 0x6C, 0x82, 0xE0, 0x6B, 0x6C, 0xBC, 0x25, 0x4C, 0xB7, 0x75, 0xC8, 0x52, 0x3C,
-    0xF3, 0x52, 0x27, 0x00, 0x44, 0x74, 0x6A, 0x32, 0xAA, 0x91, 0x79, 0x3B, 0x5C, 0x4A, 0xE3, 0x11,
-    0x80, 0xA1, 0x78, 0xC6, 0xA7, 0x61, 0xE0, 0xDB, 0xD3, 0x43, 0x11, 0x30, 0x94, 0xF1, 0x78, 0x4B,
-    0x98, 0x5E, 0x6B, 0x6D, 0x62, 0x71, 0x14, 0xDF, 0x9C, 0x88, 0x4E, 0x80, 0x06, 0x74, 0x02, 0x30,
-    0xF0, 0x2F, 0xA5, 0x7C, 0xF5, 0xEA, 0xD5, 0x1F, 0xF9, 0xEC, 0x54, 0xA9, 0x45, 0x20, 0x63, 0xA7,
-    0x77, 0x86, 0xC5, 0x22, 0xC0, 0x3A, 0x3F, 0x01, 0x12, 0x20, 0x54, 0x0C, 0x01, 0xDE, 0x3C, 0x7F,
-    0xFE, 0xFC, 0xB7, 0x5A, 0x57, 0x4D, 0x93, 0x73, 0x02, 0x19, 0x3B, 0x5E, 0xDC, 0x06, 0x4B, 0x04,
-    0x88, 0x45, 0xC8, 0x05, 0xC0, 0x48, 0xBB, 0x1F, 0x11, 0xFC, 0xEE, 0x77, 0xE5, 0x9B, 0x3B, 0x77,
-    0xEE, 0xFC, 0xD8, 0xEF, 0xF7, 0xF9, 0x10, 0x21, 0xA5, 0x1A, 0x04, 0x60, 0x06, 0x3B, 0x67, 0x12,
-    0xBE, 0x39, 0x0F, 0xB6, 0x64, 0xBF, 0xFB, 0x71, 0x17, 0xBE, 0xA6, 0x2A, 0x7C, 0xD5, 0x06, 0x8F,
-    0x26, 0xDA, 0xB3, 0xEE, 0x5D, 0x88, 0xAF, 0x2F, 0x5E, 0xBC, 0xB8, 0xCD, 0xBB, 0x11, 0x79, 0x47,
-    0x22, 0x46, 0x29, 0x55, 0x13, 0x00, 0xFE, 0xC6, 0xC6, 0xC6, 0x77, 0x37, 0x6E, 0xDC, 0xF8, 0xD5,
-    0xCD, 0xE4, 0xD3, 0x2F, 0x7D, 0x02, 0xE6, 0x3F, 0x05, 0x73, 0xED, 0x5C, 0x08, 0x04, 0x08, 0xC1,
-    0xBB, 0x66, 0x7E, 0x2A, 0xE8, 0xF7, 0xE9, 0xFE, 0xFD, 0xFB, 0x5B, 0xBC, 0x98, 0x72, 0x6D, 0x6D,
-    0xED, 0xA4, 0xFB, 0xAB, 0x82, 0x63, 0x8B, 0x8B, 0x8B, 0x7C, 0x5C, 0x99, 0x8F, 0x67, 0xD3, 0xA6,
-    0xBD, 0x78, 0xE7, 0x9E, 0xF9, 0xBF, 0x6F, 0x6F, 0x6F, 0xFF, 0x72, 0xEB, 0xD6, 0xAD, 0x6F, 0x32,
-    0xF8, 0xFF, 0x3A, 0x28, 0xC0, 0xE7, 0x14, 0x90, 0xF5, 0x18, 0xD2, 0x23, 0x7F, 0x1F, 0x7C, 0xBF,
-    0xE3, 0xDD, 0x24, 0x44, 0x09, 0x5F, 0xEC, 0xC9, 0xBB, 0x10, 0xD3, 0x0B, 0x9D, 0x1D, 0x84, 0x28,
-    0x09, 0x22, 0xBB, 0x59, 0x60, 0xD9, 0xE1, 0x82, 0x4D, 0x19, 0xC2, 0x2F, 0x0C, 0xC6, 0x80, 0xCE,
-    0x9F, 0x47, 0x59, 0x5D, 0x0E, 0x5D, 0xD3, 0x27, 0xC6, 0xE9, 0x53, 0x5C, 0xC0, 0x69, 0xF8, 0x6E,
-    0x44, 0x3D, 0xAE, 0x98, 0x3C, 0x2D, 0xA7, 0x42, 0xCC, 0xC4, 0x46, 0xCC, 0x60, 0x24, 0x4E, 0x00,
-    0x0F, 0x73, 0x1C, 0x80, 0xB1, 0x1D, 0x78, 0xA7, 0xBC, 0x1C, 0xBA, 0xB1, 0x3C, 0xE1, 0x3C, 0x14,
-    0x80, 0x13, 0x42, 0x06, 0xBC, 0xE0, 0x87, 0xE0, 0xC3, 0xBA, 0x9B, 0x72, 0xE4, 0x92, 0xE0, 0x73,
-    0x63, 0x1E, 0xA2, 0x2B, 0xC5, 0x48, 0x27, 0x01, 0x11, 0xA8, 0x23, 0x80, 0xFA, 0x42, 0x01, 0x5C,
-    0xF7, 0xFB, 0xC4, 0x4E, 0x26, 0x85, 0x4E, 0x69, 0xE3, 0x90, 0x14, 0x5E, 0x00, 0xE8, 0x38, 0x14,
-    0x7C, 0x3D, 0xB2, 0x42, 0xE0, 0x61, 0x1D, 0xFB, 0xA3, 0x9A, 0x42, 0x5E, 0xD4, 0xE1, 0xA5, 0x52,
-    0xA0, 0xE3, 0x52, 0x73, 0xC4, 0xD4, 0xFB, 0x08, 0x81, 0xA9, 0x4E, 0x19, 0x67, 0xED, 0x76, 0xED,
-    0x78, 0x95, 0xA1, 0xCD, 0x51, 0x85, 0x5D, 0x75, 0x5F, 0x1E, 0x62, 0x06, 0x5F, 0x02, 0xA8, 0xD4,
-    0xA9, 0xA0, 0x1D, 0x67, 0x7C, 0xD2, 0x37, 0xF0, 0xCC, 0x8E, 0x81, 0xC6, 0x42, 0x84, 0x6D, 0xD9,
-    0xCB, 0x86, 0xF6, 0x34, 0x26, 0xC1, 0xE5, 0xDE, 0x55, 0x2F, 0x2A, 0x35, 0x1E, 0x96, 0x03, 0x02,
-    0x30, 0x48, 0x12, 0x54, 0x95, 0x71, 0x5F, 0x51, 0xBF, 0x37, 0x9C, 0xC2, 0x1F, 0x7E, 0x27, 0x67,
-    0xF7, 0x2D, 0xF0, 0x34, 0xE3, 0xFE, 0xB8, 0xCF, 0x9B, 0x84, 0x20, 0x7D, 0x47, 0xF4, 0x23, 0x1E,
-    0x8F, 0xDB, 0xD1, 0xF4, 0x5C, 0xB8, 0xB8, 0xFF, 0xA8, 0xB5, 0x43, 0xB8, 0x45, 0xF7, 0x16, 0x8F,
-    0xC7, 0xED, 0xDC, 0xE6, 0x7F, 0xAF, 0x38, 0x18, 0xCE, 0x87, 0x25, 0x84, 0x3F, 0x00, 0x00, 0x00,
-    0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82
-};
-
-#endif    /* __icon_button1_png_h_included */
@@ -1,147 +0,0 @@
-/* Generated by file2c, do not edit manually */
-#ifndef __icon_button2_png_h_included
-#define __icon_button2_png_h_included
-
-#include <stdint.h>
-
-/* Contents of file icon_button2.png */
-#define icon_button2_png_fileName        "icon_button2.png"
-#define icon_button2_png_fileSize        2114
-
-static const uint8_t icon_button2_png_fileBinaryArray[2114] = {
-    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77,
-    0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
-    0x07, 0xFC, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x3D, 0x6F, 0x14, 0x47, 0x18, 0xC7,
-    0xCF, 0x36, 0xC6, 0x24, 0xC4, 0x20, 0x90, 0x95, 0x26, 0x4A, 0x24, 0xAC, 0x58, 0x20, 0x21, 0x1A,
-    0xCA, 0x7C, 0x00, 0x40, 0x8A, 0xF2, 0x31, 0x80, 0x9A, 0x02, 0x85, 0xA0, 0x54, 0x51, 0x0A, 0xA8,
-    0x53, 0x05, 0xBE, 0x00, 0x25, 0x85, 0x53, 0x80, 0xD2, 0xA6, 0x8A, 0x28, 0x23, 0x41, 0x83, 0x95,
-    0x14, 0x96, 0x90, 0x10, 0x28, 0x26, 0xE4, 0x05, 0xDB, 0x38, 0xCF, 0x6F, 0xBC, 0xFF, 0xD5, 0xDC,
-    0xDC, 0xDA, 0x77, 0xB7, 0xF7, 0x58, 0xBB, 0xE7, 0x9D, 0x91, 0xC6, 0xCF, 0xBC, 0x3E, 0x3B, 0xFB,
-    0xFB, 0xCF, 0xEC, 0x03, 0x9C, 0xB9, 0x9D, 0xE9, 0xED, 0x9F, 0x66, 0x92, 0xEE, 0xB4, 0x9E, 0x74,
-    0xF7, 0x86, 0xF5, 0xA7, 0xE3, 0xA7, 0xB5, 0xBE, 0x33, 0x64, 0xE1, 0x69, 0x7F, 0x5A, 0x2F, 0xA7,
-    0xEF, 0x05, 0x4C, 0xED, 0xB2, 0x4C, 0x50, 0x19, 0xAB, 0x72, 0xDC, 0x4E, 0xB9, 0x8B, 0x29, 0x86,
-    0x4B, 0x59, 0x75, 0x59, 0x98, 0xA8, 0x2C, 0x5B, 0x72, 0x3A, 0x52, 0x96, 0x76, 0x0B, 0x02, 0x1B,
-    0x5B, 0x01, 0x4F, 0x2D, 0x33, 0xD4, 0x96, 0xB8, 0xE9, 0x54, 0x15, 0xA8, 0x02, 0xAB, 0x72, 0x6A,
-    0x53, 0x20, 0x1A, 0x5F, 0xB9, 0x93, 0x05, 0x35, 0xB6, 0xB3, 0xE6, 0x41, 0x99, 0x76, 0xCA, 0xEA,
-    0xC7, 0x39, 0xE5, 0x2E, 0x26, 0x81, 0x14, 0xF0, 0xF7, 0x06, 0x81, 0x32, 0x56, 0x59, 0x7D, 0xB1,
-    0x85, 0x15, 0xF5, 0x5E, 0xD5, 0x09, 0x10, 0x58, 0x01, 0x9F, 0xB3, 0x71, 0x94, 0x53, 0x1B, 0x0B,
-    0x81, 0x2F, 0x52, 0x57, 0x84, 0x08, 0xF0, 0x76, 0x6F, 0xB9, 0x04, 0x4E, 0x1B, 0xD0, 0xB7, 0xF7,
-    0xB0, 0xF4, 0x29, 0x95, 0xF3, 0x25, 0x80, 0xA0, 0xCB, 0x0A, 0x38, 0xD0, 0xC9, 0xF3, 0x85, 0x65,
-    0xBC, 0xDA, 0x24, 0x90, 0xE6, 0x58, 0x57, 0x48, 0x87, 0x5D, 0x84, 0x12, 0x9E, 0xDD, 0x2D, 0x65,
-    0x81, 0x17, 0x7C, 0x04, 0xD8, 0xB2, 0x8C, 0xDD, 0xB4, 0x0C, 0x0F, 0xCA, 0xA4, 0x58, 0x04, 0xEA,
-    0x3B, 0x12, 0x80, 0x0A, 0x89, 0xC1, 0x31, 0x7C, 0xC0, 0xA7, 0x99, 0x39, 0x12, 0x22, 0x16, 0xC1,
-    0x9A, 0x3B, 0x77, 0x02, 0x52, 0xF8, 0x80, 0x27, 0x03, 0x9E, 0x0C, 0x1F, 0x6C, 0x9C, 0x10, 0xA1,
-    0x14, 0x11, 0x90, 0xDA, 0xC1, 0xB2, 0x12, 0x00, 0xF0, 0x47, 0x8B, 0xBC, 0x10, 0x95, 0x69, 0xD3,
-    0x89, 0xD0, 0x63, 0x49, 0x73, 0xAD, 0xAB, 0x33, 0x29, 0xDE, 0xFD, 0xEC, 0x70, 0xED, 0xF8, 0x77,
-    0x56, 0x56, 0x86, 0x25, 0x6C, 0x94, 0x34, 0x27, 0x6E, 0x2B, 0x77, 0x3D, 0x62, 0x00, 0xF7, 0xB8,
-    0xE5, 0x93, 0x96, 0x3F, 0xB6, 0xFC, 0xA9, 0xE5, 0x15, 0xCB, 0x17, 0xAE, 0x5F, 0xBF, 0xFE, 0xD5,
-    0xF3, 0xE7, 0xCF, 0x57, 0x37, 0x36, 0x36, 0xD6, 0x76, 0x76, 0x76, 0xB6, 0x2D, 0xE7, 0xD4, 0x4F,
-    0x60, 0x1B, 0x36, 0x30, 0x82, 0x15, 0xCC, 0x0A, 0x76, 0x30, 0x84, 0x25, 0x4C, 0x61, 0x0B, 0x63,
-    0x58, 0x97, 0xE2, 0xA0, 0x06, 0x15, 0x76, 0xF5, 0x31, 0xCB, 0x8B, 0x96, 0x97, 0x2C, 0x7F, 0x62,
-    0xF9, 0x73, 0xCB, 0x17, 0x1E, 0x3E, 0x7C, 0xF8, 0xF5, 0xD6, 0xD6, 0xD6, 0xDB, 0xFE, 0xEB, 0xE5,
-    0xDA, 0x5E, 0x04, 0x60, 0x05, 0x33, 0xD8, 0x15, 0x0C, 0x61, 0x09, 0x53, 0xD8, 0xC2, 0x18, 0xD6,
-    0x41, 0x80, 0xF8, 0x11, 0x42, 0x83, 0x02, 0x2E, 0x03, 0x78, 0xEC, 0x1C, 0x33, 0x35, 0x97, 0x6F,
-    0xDC, 0xB8, 0xF1, 0xC3, 0xDC, 0xDC, 0xDC, 0x87, 0x56, 0xCF, 0x69, 0x04, 0x02, 0xB3, 0xB3, 0xB3,
-    0xF3, 0x2B, 0x2B, 0x2B, 0x5F, 0xBC, 0x78, 0xF1, 0xE2, 0xE7, 0x27, 0x4F, 0x9E, 0x6C, 0xD8, 0x14,
-    0x05, 0x68, 0xAC, 0x62, 0x40, 0x88, 0x03, 0xDA, 0xFD, 0x58, 0x8E, 0x05, 0xE0, 0x39, 0x22, 0x1F,
-    0x58, 0x06, 0xF8, 0x71, 0x3B, 0x52, 0xDF, 0x9F, 0x39, 0x73, 0xE6, 0x4B, 0x2B, 0xE7, 0x34, 0x26,
-    0x81, 0xB5, 0xB5, 0xB5, 0x9F, 0x96, 0x97, 0x97, 0xBF, 0xB5, 0x69, 0x6F, 0x2D, 0xFF, 0x6D, 0xF9,
-    0x1F, 0xCB, 0xC4, 0x07, 0x02, 0x33, 0xC1, 0x7A, 0x87, 0x5D, 0x4F, 0x42, 0x00, 0x89, 0xA1, 0x3F,
-    0x66, 0x86, 0x98, 0xB0, 0xB4, 0xB4, 0x74, 0x3E, 0x8C, 0xC8, 0x3F, 0xC6, 0x26, 0x50, 0xB0, 0xD3,
-    0x33, 0x5F, 0x5C, 0xC3, 0xA3, 0xA7, 0xE0, 0x1D, 0x9E, 0x43, 0x38, 0x96, 0x00, 0xB1, 0x08, 0xE1,
-    0x44, 0x2C, 0x2E, 0x2E, 0x7E, 0x36, 0xF6, 0x95, 0xF3, 0x84, 0x40, 0xA0, 0x60, 0xC7, 0x53, 0x05,
-    0x96, 0xF1, 0xE3, 0x5E, 0xBC, 0x4B, 0x01, 0x84, 0x4C, 0x1D, 0x8A, 0x07, 0x9A, 0xA4, 0xFE, 0x6C,
-    0xC7, 0x23, 0x90, 0x72, 0x14, 0xDF, 0xD2, 0x8B, 0x1E, 0x41, 0x34, 0xA8, 0x93, 0x36, 0x65, 0x04,
-    0xC8, 0x69, 0x32, 0x02, 0xDA, 0xC4, 0x62, 0x2A, 0xCE, 0xC1, 0x2B, 0x8D, 0x34, 0x90, 0x62, 0x4B,
-    0x39, 0xEE, 0x0B, 0x03, 0xF2, 0x8F, 0x5A, 0x04, 0x62, 0x96, 0x31, 0x63, 0x9C, 0xCD, 0x00, 0x99,
-    0x34, 0xD0, 0x51, 0xB4, 0xA9, 0x3F, 0x0C, 0xCA, 0x3F, 0x6A, 0x11, 0xD0, 0x46, 0xAE, 0x62, 0x3C,
-    0x10, 0x03, 0xB8, 0x82, 0x06, 0xD6, 0xBA, 0x5A, 0x9E, 0xB4, 0x2F, 0x81, 0x01, 0xB6, 0x7B, 0xED,
-    0x70, 0x06, 0x2A, 0xEF, 0xEB, 0x31, 0x77, 0x0E, 0x25, 0x20, 0x8E, 0x03, 0xF0, 0x99, 0xB9, 0x97,
-    0x00, 0x43, 0xBD, 0xE6, 0x01, 0x3E, 0x04, 0xB2, 0x00, 0x3E, 0x1C, 0x6B, 0x7B, 0xC9, 0x02, 0xD4,
-    0x46, 0xE7, 0x33, 0x31, 0x0B, 0xE0, 0xC3, 0xB1, 0xB6, 0x97, 0x2C, 0x40, 0x6D, 0x74, 0x3E, 0x13,
-    0xB3, 0x00, 0x3E, 0x1C, 0x6B, 0x7B, 0xC9, 0x02, 0xD4, 0x46, 0xE7, 0x33, 0x31, 0x0B, 0xE0, 0xC3,
-    0xB1, 0xB6, 0x97, 0xC6, 0x04, 0x78, 0xF4, 0xE8, 0x51, 0xED, 0x45, 0x57, 0x4D, 0xF4, 0xF6, 0x57,
-    0x75, 0x8D, 0x83, 0x68, 0x6B, 0x4C, 0x80, 0xFB, 0xF7, 0xEF, 0xF7, 0x9E, 0x3D, 0x7B, 0xE6, 0x76,
-    0x4F, 0xDE, 0xFE, 0xDC, 0x16, 0x36, 0xC4, 0x51, 0x63, 0x02, 0x6C, 0x6E, 0x6E, 0xF6, 0xEE, 0xDC,
-    0xB9, 0xD3, 0x7B, 0xFD, 0xFA, 0xF5, 0x90, 0x25, 0x8E, 0xD6, 0xED, 0xED, 0x6F, 0xB4, 0xAB, 0x4E,
-    0x3E, 0xAA, 0x31, 0x01, 0x58, 0xFA, 0xAB, 0x57, 0xAF, 0x82, 0x08, 0xF6, 0x5B, 0x04, 0x93, 0xDF,
-    0xC9, 0x01, 0xF8, 0x73, 0x59, 0xD4, 0x10, 0x27, 0x8D, 0x0A, 0xC0, 0xDA, 0x9E, 0x3E, 0x7D, 0xDA,
-    0xBB, 0x77, 0xEF, 0xDE, 0x90, 0x65, 0x8E, 0xDE, 0xED, 0xED, 0x6F, 0xF4, 0x2B, 0xD7, 0x1B, 0xD9,
-    0xB8, 0x00, 0x2C, 0x9B, 0x00, 0xEA, 0x19, 0x44, 0xBD, 0xFD, 0xD5, 0x43, 0x3B, 0xDA, 0xAC, 0x56,
-    0x08, 0xC0, 0x52, 0xBD, 0x83, 0xA8, 0xB7, 0xBF, 0xD1, 0x70, 0x8E, 0x3F, 0xAA, 0x35, 0x02, 0x78,
-    0x07, 0x51, 0x6F, 0x7F, 0xE3, 0xA3, 0x1D, 0x6D, 0x46, 0x6B, 0x04, 0x60, 0xB9, 0x5D, 0x0C, 0xCA,
-    0xAD, 0x12, 0x00, 0x11, 0xBC, 0x83, 0xA8, 0xB7, 0x3F, 0xD6, 0xE8, 0x99, 0x5A, 0x27, 0x00, 0x37,
-    0x47, 0x10, 0x7D, 0xFC, 0xF8, 0xB1, 0xDB, 0x7D, 0x7A, 0xFB, 0x73, 0x5B, 0x98, 0x39, 0x6A, 0xA5,
-    0x00, 0xDC, 0x20, 0x7F, 0x34, 0xF5, 0xFC, 0x9B, 0xB2, 0xB7, 0x3F, 0x2F, 0x11, 0x5A, 0x2B, 0x80,
-    0x77, 0x10, 0xF5, 0xF6, 0x77, 0xE8, 0x05, 0xE0, 0x06, 0xBB, 0x10, 0x94, 0x5B, 0x7B, 0x02, 0xB4,
-    0xC3, 0xBC, 0x83, 0xA8, 0xB7, 0x3F, 0xAD, 0xB3, 0xAE, 0x6D, 0xBD, 0x00, 0xDC, 0x98, 0x77, 0x10,
-    0xF5, 0xF6, 0x57, 0x17, 0x3E, 0xF3, 0xA6, 0x42, 0x00, 0x16, 0xEA, 0x1D, 0x44, 0xBD, 0xFD, 0xB1,
-    0xC6, 0x3A, 0x69, 0x6A, 0x04, 0xF0, 0x0E, 0xA2, 0xDE, 0xFE, 0xEA, 0xC0, 0x67, 0xCE, 0xD4, 0x08,
-    0xC0, 0x62, 0x0F, 0x63, 0x50, 0x9E, 0x2A, 0x01, 0x10, 0xC1, 0x3B, 0x88, 0x7A, 0xFB, 0x63, 0x8D,
-    0xE3, 0xA4, 0xA9, 0x13, 0x80, 0x9B, 0x9B, 0x99, 0xA9, 0xFC, 0x3D, 0xD7, 0x71, 0xEE, 0xBB, 0x6F,
-    0xAC, 0xB7, 0xBF, 0x3E, 0xE7, 0x43, 0x2A, 0x53, 0x27, 0xC0, 0xB9, 0x73, 0xE7, 0x7A, 0x57, 0xAF,
-    0x5E, 0x1D, 0x72, 0x5B, 0xA3, 0x77, 0x7B, 0xFB, 0x1B, 0xFD, 0xCA, 0xBB, 0x23, 0xA7, 0x4A, 0x80,
-    0xD3, 0xA7, 0x4F, 0xF7, 0x6E, 0xDD, 0xBA, 0xD5, 0x3B, 0x72, 0x84, 0xFF, 0xF3, 0x36, 0x79, 0xF2,
-    0xF6, 0x57, 0x67, 0x45, 0x53, 0x23, 0xC0, 0xFC, 0xFC, 0x7C, 0x80, 0x7F, 0xEA, 0xD4, 0xA9, 0x3A,
-    0xF7, 0x39, 0x30, 0xC7, 0xDB, 0xDF, 0xC0, 0x05, 0x46, 0x6C, 0x98, 0x1A, 0x01, 0xAE, 0x5D, 0xBB,
-    0xD6, 0x3B, 0x7B, 0xF6, 0xEC, 0x88, 0xB7, 0x35, 0x7C, 0x98, 0xB7, 0xBF, 0xE1, 0x57, 0xAC, 0x1E,
-    0x31, 0x15, 0x02, 0x5C, 0xB9, 0x72, 0xA5, 0x77, 0xE9, 0xD2, 0xA5, 0xEA, 0x3B, 0xA8, 0xD1, 0xEA,
-    0xED, 0xAF, 0xC6, 0x12, 0xCA, 0x29, 0xAD, 0x17, 0xC0, 0x3B, 0x48, 0x7A, 0xFB, 0x2B, 0x49, 0xD6,
-    0x2C, 0xB4, 0x5A, 0x00, 0xEF, 0x20, 0xE9, 0xED, 0xAF, 0x26, 0xF3, 0xBE, 0x69, 0xAD, 0x15, 0xC0,
-    0x3B, 0x48, 0x7A, 0xFB, 0xEB, 0xA3, 0x38, 0x41, 0xA5, 0xB5, 0x02, 0x78, 0x07, 0x49, 0x6F, 0x7F,
-    0x13, 0x30, 0xEF, 0x9B, 0xDA, 0x4A, 0x01, 0x2E, 0x5F, 0xBE, 0xEC, 0x1A, 0x74, 0xBD, 0xFD, 0xF5,
-    0x11, 0x9C, 0xB0, 0xD2, 0x3A, 0x01, 0x08, 0x92, 0xEC, 0x56, 0xAF, 0xE4, 0xED, 0xCF, 0x6B, 0x5D,
-    0xF2, 0xD3, 0x2A, 0x01, 0xBC, 0x83, 0xA4, 0xB7, 0x3F, 0x41, 0xF3, 0xB4, 0xAD, 0x11, 0xC0, 0x3B,
-    0x48, 0x7A, 0xFB, 0xF3, 0x84, 0x1E, 0xFB, 0x6A, 0x8D, 0x00, 0xDE, 0x41, 0xD2, 0xDB, 0x5F, 0x0C,
-    0xCD, 0xB3, 0xDC, 0x0A, 0x01, 0xBC, 0x83, 0xA4, 0xB7, 0x3F, 0x4F, 0xE0, 0xA9, 0xAF, 0xC6, 0x05,
-    0xF0, 0x0E, 0x92, 0xDE, 0xFE, 0x52, 0x60, 0xDE, 0xF5, 0x46, 0x05, 0xF0, 0x0E, 0x92, 0xDE, 0xFE,
-    0xBC, 0x61, 0x57, 0xF9, 0x6B, 0x4C, 0x00, 0xEF, 0x20, 0xE9, 0xED, 0xAF, 0x0A, 0xD6, 0x41, 0xB4,
-    0x35, 0x26, 0x80, 0x77, 0x90, 0xF4, 0xF6, 0x77, 0x10, 0xB0, 0xAB, 0x7C, 0xF2, 0xE1, 0x2A, 0x5F,
-    0x2A, 0x47, 0xD6, 0xB7, 0xE5, 0xF2, 0x85, 0xAD, 0x1F, 0x59, 0x3E, 0x61, 0xF9, 0xA4, 0x7D, 0x3D,
-    0xAF, 0xDF, 0xAF, 0x29, 0x9B, 0xC3, 0xAE, 0x25, 0xFB, 0xBC, 0x99, 0x7F, 0x47, 0xFF, 0xD3, 0x32,
-    0xDF, 0xA0, 0xFB, 0x97, 0x65, 0xBE, 0xC0, 0xF5, 0x3F, 0xCB, 0x7C, 0x79, 0xEB, 0x76, 0x63, 0x27,
-    0xC0, 0x2E, 0x9E, 0x93, 0x11, 0xC8, 0x02, 0x34, 0xBC, 0x0D, 0xB2, 0x00, 0x59, 0x80, 0x86, 0x09,
-    0x34, 0x7C, 0xF9, 0x7C, 0x02, 0xB2, 0x00, 0x0D, 0x13, 0x68, 0xF8, 0xF2, 0xF9, 0x04, 0x64, 0x01,
-    0x1A, 0x26, 0xD0, 0xF0, 0xE5, 0xF7, 0x3A, 0x01, 0x7A, 0xDB, 0x4F, 0x78, 0xCD, 0x46, 0xC3, 0x6B,
-    0x9C, 0xF6, 0xCB, 0xEF, 0xCB, 0xB2, 0x4A, 0x80, 0x0C, 0xFD, 0xE0, 0x24, 0x1F, 0x60, 0x2B, 0x01,
-    0xD4, 0x11, 0x5B, 0xCA, 0xBC, 0x70, 0x26, 0xA7, 0xC9, 0x08, 0xF4, 0xBD, 0xB4, 0xC7, 0x5C, 0xC5,
-    0x8C, 0xC3, 0xDF, 0x84, 0xFB, 0x1A, 0x8A, 0x01, 0x82, 0xAF, 0xBE, 0xC9, 0x96, 0xD0, 0xED, 0xD9,
-    0x31, 0x4B, 0xF1, 0x2C, 0xAD, 0x4E, 0x00, 0x88, 0x68, 0xD4, 0x60, 0x54, 0x23, 0xF3, 0x76, 0xB8,
-    0x9C, 0x26, 0x23, 0x00, 0x43, 0xF1, 0x4C, 0x4F, 0xC3, 0xC0, 0xBF, 0x05, 0xC5, 0x22, 0x30, 0x51,
-    0x93, 0x27, 0x5B, 0x42, 0x77, 0x67, 0x6B, 0x13, 0x8B, 0xA3, 0xF8, 0x96, 0x44, 0x74, 0x02, 0xD4,
-    0xA1, 0x13, 0xC0, 0x84, 0xF0, 0x52, 0xCA, 0x37, 0x6F, 0xDE, 0xFC, 0x51, 0x8E, 0xCE, 0x85, 0xB1,
-    0x08, 0x14, 0xEC, 0xF4, 0xCE, 0xB0, 0x54, 0x04, 0x58, 0x97, 0x27, 0x40, 0x02, 0xC4, 0x8A, 0x21,
-    0xC0, 0xBB, 0x97, 0x2F, 0x5F, 0xFE, 0x36, 0xD6, 0x55, 0xF3, 0xE0, 0x92, 0x40, 0xC1, 0x8E, 0x17,
-    0xB7, 0xC1, 0x12, 0x01, 0x52, 0x11, 0x4A, 0x01, 0x98, 0xA4, 0xDD, 0x8F, 0x08, 0x61, 0xF7, 0x9B,
-    0x7D, 0x77, 0xF7, 0xEE, 0xDD, 0x1F, 0xB7, 0xB7, 0xB7, 0xF9, 0x10, 0x21, 0xA7, 0x31, 0x08, 0xC0,
-    0x0C, 0x76, 0x36, 0x05, 0x01, 0x74, 0x0A, 0x60, 0x4B, 0x0E, 0xBB, 0xDF, 0x6C, 0xF8, 0x24, 0x0C,
-    0x4B, 0x8A, 0x5F, 0xB5, 0xC1, 0xA3, 0x89, 0xFA, 0xAC, 0xBD, 0x0B, 0xF1, 0xED, 0xC5, 0x8B, 0x17,
-    0xD7, 0x79, 0x37, 0x22, 0xEF, 0x48, 0x64, 0x60, 0x4E, 0xFB, 0x13, 0x00, 0xFE, 0xEA, 0xEA, 0xEA,
-    0x77, 0x37, 0x6F, 0xDE, 0xFC, 0xD5, 0x46, 0xF2, 0xE9, 0x97, 0x3E, 0x01, 0x0B, 0x9F, 0x82, 0x59,
-    0xBD, 0x14, 0x82, 0x8F, 0x22, 0x63, 0xF0, 0x56, 0x2D, 0x4F, 0x05, 0xED, 0x21, 0x3D, 0x78, 0xF0,
-    0x60, 0x8D, 0x17, 0x53, 0x9E, 0x3F, 0x7F, 0xFE, 0x84, 0xFD, 0x07, 0xB9, 0xA3, 0x0B, 0x0B, 0x0B,
-    0x7C, 0x5C, 0x59, 0xF6, 0x17, 0xC3, 0xBA, 0x6E, 0xDE, 0xDB, 0x33, 0xFF, 0xF7, 0xF5, 0xF5, 0xF5,
-    0x5F, 0x6E, 0xDF, 0xBE, 0xFD, 0x4D, 0x01, 0xFF, 0x5F, 0x83, 0x02, 0x7C, 0x4E, 0x01, 0x59, 0x8F,
-    0x21, 0x3D, 0xF2, 0xFB, 0xE0, 0x87, 0x1D, 0x6F, 0x83, 0x10, 0x25, 0xBC, 0xC6, 0xD0, 0x2C, 0xEF,
-    0x41, 0x24, 0xE7, 0x17, 0x3A, 0x1B, 0x84, 0x24, 0x09, 0x22, 0xBB, 0x59, 0x60, 0xD9, 0xE1, 0x82,
-    0x8D, 0x8D, 0xE1, 0xEB, 0x31, 0xD4, 0x17, 0x07, 0x00, 0x5D, 0x3E, 0x8F, 0x8A, 0xB2, 0x1C, 0x5A,
-    0x35, 0x24, 0xFA, 0x69, 0x53, 0x5C, 0xC0, 0x69, 0xFC, 0x6E, 0x44, 0x3D, 0xAE, 0x18, 0xDC, 0x95,
-    0x53, 0x21, 0x66, 0x62, 0x23, 0x66, 0x30, 0x12, 0x27, 0x80, 0xC7, 0xB9, 0x0F, 0xBC, 0xF5, 0x31,
-    0x77, 0xE0, 0x9D, 0xF2, 0x72, 0x68, 0x7D, 0x65, 0xC2, 0x79, 0x2C, 0x80, 0x7E, 0x8B, 0x02, 0xF0,
-    0x82, 0x1F, 0x83, 0x8F, 0xCB, 0xA5, 0x93, 0x43, 0x54, 0x10, 0x7C, 0x6E, 0x29, 0x40, 0x34, 0x2B,
-    0x46, 0x3A, 0x09, 0x88, 0x40, 0x19, 0x01, 0xD4, 0x16, 0x0B, 0x60, 0xCD, 0xBB, 0x49, 0xFF, 0xE3,
-    0x39, 0x76, 0x4A, 0x0F, 0x0E, 0x49, 0xF1, 0x05, 0x00, 0x8F, 0x43, 0xAC, 0xC0, 0xCB, 0x5A, 0x53,
-    0x48, 0x87, 0x1D, 0xBE, 0xEE, 0x33, 0xE6, 0x45, 0x19, 0x5E, 0xB2, 0x02, 0x9D, 0x5A, 0x8D, 0x11,
-    0xD3, 0xE0, 0x23, 0x06, 0xA6, 0x32, 0x36, 0xCD, 0xDA, 0xED, 0x02, 0x2E, 0x1B, 0xCF, 0xD1, 0xE2,
-    0xBA, 0x64, 0x03, 0xC4, 0x02, 0xBE, 0x04, 0x90, 0xD5, 0xA9, 0xA0, 0x9E, 0x66, 0x18, 0xD1, 0x36,
-    0xF0, 0xCC, 0x4E, 0x81, 0xA6, 0x42, 0xC4, 0x75, 0xCD, 0xD7, 0x1C, 0xEA, 0x5D, 0x4C, 0x82, 0xCB,
-    0xBD, 0xAB, 0x5C, 0x65, 0xD5, 0x1F, 0xDB, 0x01, 0x01, 0xE8, 0x24, 0x09, 0xAA, 0x6C, 0xDA, 0x56,
-    0xD5, 0x1E, 0x26, 0x76, 0xF0, 0x47, 0xD8, 0xC9, 0xC5, 0x7D, 0x0B, 0x3C, 0xD5, 0xB4, 0x3D, 0x6D,
-    0x0B, 0x53, 0x62, 0x90, 0xA1, 0x21, 0xF9, 0x91, 0xF6, 0xA7, 0xF5, 0x64, 0x78, 0x29, 0x5C, 0xDA,
-    0x7E, 0xD8, 0xEA, 0x31, 0xDC, 0xAA, 0x7B, 0x4B, 0xFB, 0xD3, 0x7A, 0x39, 0xE7, 0x7F, 0xF1, 0x70,
-    0x18, 0xCE, 0xAA, 0xDB, 0xB2, 0x97, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42,
-    0x60, 0x82
-};
-
-#endif    /* __icon_button2_png_h_included */
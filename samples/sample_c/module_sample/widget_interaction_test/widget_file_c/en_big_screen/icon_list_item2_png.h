@@ -1,176 +0,0 @@
-/* Generated by file2c, do not edit manually */
-#ifndef __icon_list_item2_png_h_included
-#define __icon_list_item2_png_h_included
-
-#include <stdint.h>
-
-/* Contents of file icon_list_item2.png */
-#define icon_list_item2_png_fileName        "icon_list_item2.png"
-#define icon_list_item2_png_fileSize        2578
-
-static const uint8_t icon_list_item2_png_fileBinaryArray[2578] = {
-    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77,
-    0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
-    0x09, 0xCC, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x59, 0x68, 0x14, 0x49, 0x18, 0xC7,
-    0xBF, 0x1C, 0x26, 0x1B, 0xB3, 0x6E, 0xE2, 0xAA, 0xF1, 0x24, 0x1A, 0x11, 0xE2, 0x7A, 0xA0, 0x10,
-    0x51, 0x44, 0x41, 0xF1, 0x61, 0x09, 0x28, 0x22, 0x2A, 0xE2, 0x83, 0xA2, 0x22, 0xA2, 0x3E, 0x2F,
-    0xAB, 0xA0, 0x20, 0x88, 0x20, 0xE8, 0x2A, 0xFB, 0xEA, 0x8B, 0x88, 0xE0, 0x93, 0x17, 0xE2, 0x85,
-    0xEB, 0x3E, 0xA8, 0xB8, 0xA0, 0x08, 0x8B, 0xE2, 0x01, 0xE2, 0x83, 0xB8, 0x88, 0x77, 0x44, 0x13,
-    0x93, 0x68, 0xEE, 0xAD, 0x7F, 0x65, 0xFE, 0x6D, 0x75, 0x4D, 0x4F, 0xE6, 0x48, 0x66, 0x7A, 0x8E,
-    0xFA, 0xA0, 0xF2, 0xD5, 0x5D, 0x5D, 0xBF, 0x7F, 0x75, 0xCD, 0x4C, 0x4F, 0x4F, 0xA7, 0x48, 0x62,
-    0x5B, 0x91, 0x55, 0x64, 0xA7, 0xAD, 0x62, 0x89, 0x57, 0x6E, 0xD7, 0xCF, 0xF5, 0x74, 0x5F, 0x9C,
-    0x09, 0xD8, 0xE5, 0x76, 0x5A, 0x37, 0x0F, 0x82, 0xC6, 0x3C, 0x7A, 0x54, 0x64, 0x1C, 0x9E, 0x71,
-    0x33, 0x1F, 0xF1, 0x42, 0x36, 0x13, 0x2E, 0xE2, 0x4C, 0xD3, 0x83, 0x0D, 0xE3, 0xF4, 0x9A, 0x57,
-    0xA9, 0xFE, 0xDB, 0xFF, 0x87, 0x60, 0x6D, 0x5F, 0xAC, 0x8A, 0x09, 0x9E, 0x1E, 0x2D, 0xCC, 0x78,
-    0x7F, 0x0F, 0x85, 0xFB, 0x17, 0x50, 0x09, 0x96, 0x71, 0xFA, 0xDE, 0x18, 0x58, 0x74, 0x7D, 0x53,
-    0x00, 0xD4, 0x33, 0xE1, 0x13, 0x3C, 0x7C, 0x50, 0xDC, 0xAC, 0x1B, 0x63, 0x8C, 0x82, 0xC8, 0xB6,
-    0xC1, 0x03, 0x38, 0x02, 0xF2, 0xE1, 0xC1, 0x89, 0x71, 0x78, 0xA6, 0x55, 0x54, 0x84, 0x02, 0x20,
-    0xD3, 0x04, 0x0A, 0xE0, 0x25, 0x2A, 0x10, 0x3E, 0xE2, 0x4C, 0xC3, 0xA3, 0x2E, 0x45, 0x51, 0x51,
-    0x6D, 0x6C, 0xCF, 0x74, 0xBE, 0x7B, 0x82, 0xC7, 0x3C, 0x4D, 0xC0, 0x3D, 0x2A, 0x0D, 0xF0, 0xF0,
-    0x8C, 0x23, 0x0D, 0xA3, 0x30, 0x64, 0xD5, 0x47, 0x01, 0xFA, 0x8B, 0xBF, 0x83, 0x25, 0x70, 0x78,
-    0xD4, 0x61, 0x30, 0xF3, 0x0B, 0x59, 0x84, 0x81, 0xE0, 0x13, 0x7C, 0xB7, 0xE2, 0xC6, 0x80, 0x3C,
-    0x1A, 0x45, 0xD0, 0x69, 0x80, 0x05, 0x48, 0x06, 0xAE, 0x7C, 0x82, 0x1F, 0xA6, 0xCA, 0xEC, 0x80,
-    0x36, 0x14, 0x82, 0x22, 0xA8, 0x2C, 0xEF, 0x0C, 0x42, 0xBC, 0x10, 0x8C, 0x22, 0x10, 0xA8, 0x09,
-    0xBE, 0x4B, 0x01, 0x60, 0x00, 0x53, 0xC4, 0x4D, 0xE3, 0x19, 0xE1, 0x6D, 0x41, 0x28, 0xB4, 0x45,
-    0x00, 0xF8, 0x32, 0x15, 0xCA, 0x2D, 0x8F, 0x7C, 0x8A, 0xC0, 0x2D, 0x0A, 0x6D, 0x0B, 0xD1, 0xB8,
-    0xF5, 0x00, 0x28, 0x04, 0xC0, 0x8A, 0x07, 0xEC, 0x4E, 0x15, 0x3A, 0x54, 0xC0, 0x42, 0x25, 0x1B,
-    0xD4, 0x65, 0x7D, 0xE4, 0x51, 0x40, 0x5D, 0x01, 0x20, 0x01, 0xF6, 0x07, 0x15, 0x7E, 0x54, 0xE1,
-    0x67, 0x15, 0xC6, 0xAB, 0x50, 0xA7, 0xC2, 0x2F, 0x5B, 0xB7, 0x6E, 0x6D, 0x7C, 0xF5, 0xEA, 0xD5,
-    0x5F, 0x1D, 0x1D, 0x1D, 0x4D, 0x7D, 0xCE, 0x06, 0x24, 0x00, 0x46, 0x60, 0x05, 0x66, 0x60, 0x17,
-    0x61, 0x08, 0x96, 0x60, 0x0A, 0xB6, 0x60, 0x0C, 0xD6, 0x60, 0xAE, 0xC5, 0x41, 0x04, 0x4A, 0x61,
-    0xB5, 0x0F, 0x57, 0xA1, 0x4A, 0x85, 0x1A, 0x15, 0x6A, 0x55, 0xA8, 0x47, 0x47, 0x5D, 0x5D, 0x5D,
-    0xCD, 0x03, 0x8E, 0xEA, 0x0A, 0xA3, 0x08, 0x80, 0x59, 0x44, 0x84, 0xFA, 0x08, 0x4B, 0x30, 0x05,
-    0x5B, 0x30, 0x06, 0x6B, 0x30, 0x2F, 0x86, 0x02, 0x54, 0x02, 0xDB, 0x0A, 0xB7, 0x1D, 0xA8, 0x54,
-    0xA1, 0x42, 0xA5, 0x52, 0xF3, 0x8F, 0x09, 0x13, 0x26, 0xFC, 0xAA, 0xE2, 0xCE, 0x92, 0x24, 0xF0,
-    0xFA, 0xF5, 0xEB, 0xEB, 0x13, 0x27, 0x4E, 0xFC, 0x5D, 0x35, 0x6B, 0x53, 0xE1, 0xAB, 0x0A, 0xDF,
-    0x54, 0xC0, 0xF6, 0x84, 0x6D, 0x0A, 0xDB, 0x55, 0x1F, 0xE0, 0xC3, 0x20, 0x04, 0x03, 0xCF, 0x08,
-    0x2D, 0xC6, 0xE8, 0xD1, 0xA3, 0x1B, 0x74, 0x0D, 0xF7, 0x27, 0x69, 0x02, 0x11, 0x76, 0x58, 0xED,
-    0x60, 0xA9, 0x57, 0xBC, 0xF2, 0xE4, 0x0C, 0xAF, 0x57, 0x3F, 0x3C, 0x33, 0x09, 0x1F, 0x67, 0x83,
-    0x3E, 0x23, 0xCA, 0xCA, 0xCA, 0x46, 0xA1, 0x82, 0xB3, 0xE4, 0x09, 0x44, 0xD8, 0x01, 0x3E, 0x79,
-    0xDA, 0x22, 0x78, 0x02, 0xB0, 0xF7, 0x20, 0x21, 0x58, 0xE6, 0x7C, 0x6A, 0x04, 0x00, 0x3F, 0x0A,
-    0x3C, 0xBB, 0xE2, 0x16, 0x84, 0xB4, 0x09, 0x9F, 0x67, 0x02, 0x1A, 0x3A, 0x1B, 0x1C, 0x01, 0x30,
-    0xA4, 0x00, 0xE0, 0x4A, 0xCE, 0xBA, 0x57, 0x66, 0x20, 0x81, 0x02, 0x18, 0x2B, 0xC0, 0x9B, 0x02,
-    0xE9, 0x42, 0xF7, 0x27, 0x69, 0x02, 0x64, 0x4C, 0xAE, 0xE8, 0xC0, 0x63, 0x4D, 0xC0, 0x5E, 0x46,
-    0xA4, 0x7B, 0xC2, 0x67, 0x79, 0xD2, 0xA3, 0xBA, 0x06, 0x1E, 0x01, 0x30, 0xA4, 0x08, 0xC8, 0xF4,
-    0xB1, 0x0E, 0x02, 0xCC, 0x0A, 0x5E, 0x0F, 0x2E, 0x32, 0x64, 0x04, 0xA2, 0xD8, 0x06, 0x09, 0x80,
-    0xD1, 0x50, 0x91, 0x61, 0xC8, 0x46, 0x2F, 0xD0, 0x8E, 0xC8, 0x31, 0x0A, 0x3E, 0x78, 0xC4, 0x12,
-    0xA0, 0x40, 0x59, 0x65, 0x7E, 0xDA, 0x4E, 0x80, 0xCC, 0x33, 0xF7, 0x8D, 0xE8, 0x04, 0xF0, 0xE1,
-    0xC8, 0x7C, 0xC2, 0x09, 0x90, 0x79, 0xE6, 0xBE, 0x11, 0x9D, 0x00, 0x3E, 0x1C, 0x99, 0x4F, 0xE0,
-    0x63, 0x72, 0x4E, 0x99, 0xBA, 0x3A, 0x2B, 0xD7, 0xAE, 0x5D, 0x93, 0x07, 0x0F, 0x1E, 0xC8, 0xFB,
-    0xF7, 0xEF, 0xF5, 0xB1, 0xD7, 0xD4, 0xD4, 0xC8, 0xDC, 0xB9, 0x73, 0xA5, 0xB1, 0xB1, 0x51, 0xD4,
-    0xD5, 0xC7, 0x9C, 0x9A, 0x0F, 0xDE, 0x1A, 0xF1, 0xA3, 0x32, 0x2E, 0x1A, 0xE1, 0xDB, 0x2F, 0x5C,
-    0xAF, 0xC6, 0x17, 0x07, 0x3F, 0xA9, 0x50, 0xA5, 0x2E, 0x74, 0x5F, 0x57, 0x3E, 0x74, 0xEB, 0xED,
-    0xED, 0x95, 0x93, 0x27, 0x4F, 0xCA, 0xC5, 0x8B, 0x17, 0x05, 0xF1, 0x20, 0x2B, 0x2E, 0x2E, 0x96,
-    0x95, 0x2B, 0x57, 0xCA, 0xA6, 0x4D, 0x9B, 0x04, 0xF1, 0x6C, 0xB0, 0xA2, 0xA2, 0x22, 0x5C, 0xCA,
-    0x6F, 0x56, 0xA1, 0x45, 0x85, 0x56, 0x15, 0xDA, 0x55, 0xC0, 0xB7, 0x65, 0xB8, 0x24, 0xDD, 0x93,
-    0x13, 0x67, 0x80, 0x5A, 0x04, 0x72, 0xF8, 0xF0, 0x61, 0xB9, 0x73, 0xE7, 0x8E, 0x3A, 0xE6, 0xD8,
-    0x06, 0x61, 0x2E, 0x5C, 0xB8, 0x20, 0xEF, 0xDE, 0xBD, 0x93, 0xDD, 0xBB, 0x77, 0x8B, 0x9A, 0x7C,
-    0xEC, 0xCA, 0x59, 0x52, 0x92, 0x1D, 0xCB, 0x24, 0x0E, 0x8C, 0xF3, 0xE7, 0xCF, 0xC7, 0x85, 0x6F,
-    0x76, 0x01, 0xA1, 0xD0, 0x26, 0x17, 0x2C, 0xEB, 0x05, 0x68, 0x6D, 0x6D, 0x95, 0xD3, 0xA7, 0x4F,
-    0x27, 0xCD, 0x12, 0x6D, 0xD0, 0x36, 0xDB, 0x2D, 0xEB, 0x05, 0xB8, 0x7B, 0xF7, 0xAE, 0x7C, 0xFB,
-    0x86, 0x6F, 0xF2, 0x92, 0x33, 0xB4, 0x41, 0xDB, 0x6C, 0xB7, 0xAC, 0x17, 0xE0, 0xE9, 0xD3, 0xA7,
-    0x29, 0x33, 0x1C, 0x4C, 0xDB, 0x94, 0x07, 0x4D, 0xB2, 0x61, 0xD6, 0x0B, 0xD0, 0xDC, 0x8C, 0x37,
-    0x10, 0xA9, 0xD9, 0x60, 0xDA, 0xA6, 0x36, 0x62, 0xF2, 0xAD, 0xB2, 0x5E, 0x80, 0x9E, 0x1E, 0xF3,
-    0xAE, 0xBE, 0xE4, 0x26, 0x18, 0xEB, 0xED, 0x6A, 0x72, 0xBD, 0xA4, 0xB7, 0x76, 0xD6, 0x0B, 0x90,
-    0xDE, 0xE9, 0x87, 0xDF, 0x7B, 0x5E, 0x0B, 0xE0, 0x3E, 0x07, 0x84, 0xBF, 0xC0, 0xB2, 0xFE, 0x08,
-    0xF2, 0xFA, 0x0C, 0xC8, 0x7A, 0xFA, 0xEA, 0x00, 0x9D, 0x00, 0x21, 0xAB, 0xE4, 0x04, 0x70, 0x02,
-    0xA4, 0x8F, 0x80, 0x7B, 0x11, 0x4E, 0x1F, 0xDB, 0xBC, 0xE9, 0xD9, 0x6D, 0x41, 0x21, 0x4B, 0xE9,
-    0x04, 0x70, 0x02, 0x84, 0x4C, 0x20, 0xE4, 0xE1, 0xDD, 0x19, 0xE0, 0x04, 0x48, 0x1F, 0x81, 0x5C,
-    0x78, 0x17, 0x14, 0xDA, 0x77, 0xC2, 0x8F, 0x1E, 0x3D, 0x12, 0x7C, 0xD7, 0x4B, 0xAB, 0xAD, 0xAD,
-    0x95, 0xEA, 0xEA, 0x6A, 0x26, 0x87, 0xC4, 0xC7, 0x12, 0xE0, 0xD3, 0xA7, 0x4F, 0xF2, 0xF2, 0xE5,
-    0x4B, 0x6F, 0x0C, 0xD4, 0x9B, 0x3D, 0x7B, 0xB6, 0x97, 0xCE, 0x64, 0x24, 0x34, 0x01, 0x0E, 0x1D,
-    0x3A, 0x24, 0x5F, 0xBE, 0x7C, 0xF1, 0xE6, 0xBA, 0x65, 0xCB, 0x16, 0x59, 0xB5, 0x6A, 0x95, 0x97,
-    0x66, 0x64, 0xC4, 0x88, 0x11, 0x8C, 0x26, 0xED, 0x63, 0xB5, 0xBD, 0x75, 0xEB, 0x96, 0x9C, 0x38,
-    0x71, 0xC2, 0xEB, 0x0F, 0xF5, 0x4E, 0x9D, 0x3A, 0xE5, 0xA5, 0x33, 0x19, 0x09, 0xED, 0x35, 0x60,
-    0xD4, 0x28, 0xFF, 0x4F, 0xCF, 0x3E, 0x7E, 0xFC, 0x18, 0x38, 0xEF, 0x49, 0x93, 0x26, 0x05, 0xE6,
-    0x27, 0x92, 0x19, 0xAB, 0xAD, 0x3D, 0x96, 0x7D, 0x2C, 0x89, 0xF4, 0x3D, 0x54, 0x75, 0x42, 0x13,
-    0x60, 0xE4, 0xC8, 0x91, 0xBE, 0x39, 0xBC, 0x79, 0xF3, 0xC6, 0x97, 0x66, 0x62, 0xE1, 0xC2, 0x85,
-    0x8C, 0x26, 0xED, 0x17, 0x2C, 0x58, 0x10, 0xD8, 0xC6, 0x1E, 0xCB, 0x3E, 0x96, 0xC0, 0x46, 0x69,
-    0xCA, 0x0C, 0x4D, 0x80, 0xE9, 0xD3, 0xA7, 0xFB, 0xA6, 0x84, 0x3B, 0xDD, 0x82, 0xBE, 0x7C, 0xC7,
-    0x2A, 0x5E, 0xB4, 0x68, 0x91, 0xAF, 0x6E, 0x22, 0x89, 0x25, 0x4B, 0x96, 0xC8, 0xF8, 0xF1, 0xF8,
-    0x81, 0xBA, 0xDF, 0x30, 0x06, 0xC6, 0x32, 0xCD, 0x3E, 0x16, 0xB3, 0x2C, 0xDD, 0xF1, 0xD0, 0x04,
-    0x98, 0x3F, 0x7F, 0xBE, 0x6F, 0x6E, 0xEA, 0x97, 0xE5, 0x72, 0xEF, 0xDE, 0x3D, 0x5F, 0x1E, 0x13,
-    0xDB, 0xB7, 0x6F, 0x17, 0xDC, 0x7E, 0x98, 0xA8, 0x8D, 0x1B, 0x37, 0x4E, 0xB6, 0x6D, 0xDB, 0x16,
-    0x58, 0x1D, 0x63, 0x60, 0x2C, 0xD3, 0xEC, 0x63, 0x31, 0xCB, 0xD2, 0x1D, 0x0F, 0x4D, 0x80, 0xA9,
-    0x53, 0xA7, 0xCA, 0x98, 0x31, 0x63, 0x7C, 0xF3, 0x3B, 0x77, 0xEE, 0x5C, 0xE0, 0x6D, 0x87, 0x55,
-    0x55, 0x55, 0x72, 0xE0, 0xC0, 0x01, 0x99, 0x3C, 0x79, 0xB2, 0xAF, 0x7E, 0x50, 0x62, 0xCA, 0x94,
-    0x29, 0xBA, 0x6E, 0xD0, 0x0B, 0x30, 0xBE, 0x23, 0xC6, 0x18, 0xA6, 0xE1, 0x18, 0x70, 0x2C, 0x61,
-    0x59, 0x68, 0x02, 0x60, 0xC2, 0xB8, 0x8F, 0xD3, 0xB4, 0x17, 0x2F, 0x5E, 0xC8, 0xD5, 0xAB, 0x57,
-    0xCD, 0x2C, 0x2F, 0x8E, 0x55, 0x7D, 0xF4, 0xE8, 0x51, 0xD9, 0xBC, 0x79, 0x73, 0xE0, 0xD9, 0x80,
-    0x33, 0x04, 0xEF, 0xA4, 0x8E, 0x1C, 0x39, 0x12, 0x58, 0x8E, 0x8E, 0xD0, 0x37, 0xC6, 0x30, 0xCD,
-    0x3E, 0x06, 0xB3, 0x2C, 0x13, 0xF1, 0x50, 0x6F, 0xCE, 0xC5, 0x56, 0xB0, 0x73, 0xE7, 0x4E, 0xF9,
-    0xF0, 0xE1, 0x83, 0x37, 0xD7, 0x8A, 0x8A, 0x0A, 0x39, 0x78, 0xF0, 0x60, 0xDC, 0x55, 0xA9, 0x9E,
-    0xC3, 0xE0, 0xB5, 0xC3, 0x2A, 0x56, 0xCF, 0xB3, 0xF0, 0xFA, 0x08, 0x8A, 0x3C, 0x7F, 0xFE, 0x5C,
-    0xF6, 0xEC, 0xD9, 0x23, 0x5F, 0xBF, 0xE2, 0x91, 0x0D, 0xFD, 0xA6, 0x1E, 0x25, 0x20, 0xC7, 0x8E,
-    0x1D, 0x93, 0x61, 0xC3, 0x70, 0x5F, 0x72, 0x7A, 0x4C, 0x7D, 0xC6, 0x18, 0xF0, 0xE6, 0xDC, 0x50,
-    0xCF, 0x00, 0x4C, 0x7C, 0xC3, 0x86, 0x0D, 0xBE, 0x99, 0x03, 0xD0, 0xFE, 0xFD, 0xFB, 0xE5, 0xED,
-    0xDB, 0xB7, 0xBE, 0x7C, 0x3B, 0x01, 0xE0, 0x73, 0xE6, 0xCC, 0xD1, 0x21, 0x1E, 0x7C, 0xF4, 0x85,
-    0x3E, 0x4D, 0xF8, 0xE8, 0x6F, 0xE3, 0xC6, 0x8D, 0x69, 0x85, 0x6F, 0x1F, 0x73, 0x50, 0x3A, 0x54,
-    0x01, 0x70, 0x40, 0x4B, 0x97, 0x2E, 0x95, 0x65, 0xCB, 0x96, 0xF9, 0x8E, 0xED, 0xF3, 0xE7, 0xCF,
-    0xFA, 0xEE, 0xE6, 0x87, 0x0F, 0x1F, 0xFA, 0xF2, 0x53, 0x49, 0xA0, 0x0F, 0xDC, 0x29, 0x8D, 0x3E,
-    0x4D, 0xC3, 0x98, 0x18, 0x3B, 0x6C, 0x0B, 0x75, 0x0B, 0xE2, 0xE4, 0xB1, 0x15, 0xED, 0xDA, 0xB5,
-    0x4B, 0xB0, 0x4D, 0x98, 0x86, 0x4B, 0x04, 0xAB, 0x57, 0xAF, 0x96, 0xB5, 0x6B, 0xD7, 0xCA, 0xF0,
-    0xE1, 0xF8, 0xD9, 0x42, 0xE2, 0xD6, 0xDE, 0xDE, 0x2E, 0x67, 0xCF, 0x9E, 0xD5, 0x77, 0x49, 0x9B,
-    0x97, 0x3C, 0xD0, 0x43, 0x5D, 0x5D, 0x9D, 0xBE, 0xDD, 0x5D, 0x3D, 0x4C, 0x23, 0xF1, 0x0E, 0x53,
-    0xAC, 0x19, 0x6F, 0x0B, 0xCA, 0x0A, 0x01, 0x30, 0x37, 0xAC, 0x50, 0x6C, 0x13, 0xB6, 0x08, 0x28,
-    0xAB, 0xAC, 0xAC, 0x94, 0xE5, 0xCB, 0x97, 0xEB, 0x15, 0x1B, 0xEF, 0x17, 0x30, 0xF8, 0x05, 0xCD,
-    0xCD, 0x9B, 0x37, 0xE5, 0xCA, 0x95, 0x2B, 0xD2, 0xD6, 0x86, 0xC7, 0xF4, 0xF8, 0x0D, 0xEF, 0x92,
-    0x30, 0xCE, 0x50, 0x5F, 0x77, 0xF2, 0x8F, 0xF2, 0x3D, 0x95, 0x33, 0x02, 0xE0, 0x90, 0xB1, 0x6A,
-    0xF1, 0x02, 0x8C, 0x0B, 0x75, 0xB1, 0x6C, 0xEC, 0xD8, 0xB1, 0x32, 0x73, 0xE6, 0x4C, 0xC1, 0x0B,
-    0x28, 0x21, 0x42, 0xBC, 0xA6, 0xA6, 0x26, 0x79, 0xF2, 0xE4, 0x89, 0xFE, 0x71, 0x46, 0xAC, 0xB6,
-    0xB3, 0x66, 0xCD, 0x92, 0xBD, 0x7B, 0xF7, 0x26, 0x7D, 0x36, 0xC5, 0xEA, 0x2F, 0x91, 0xFC, 0x9C,
-    0x12, 0x00, 0x13, 0xEA, 0xEE, 0xEE, 0xD6, 0x5B, 0xC7, 0x99, 0x33, 0x67, 0x74, 0x3C, 0x91, 0x49,
-    0xC6, 0xAB, 0x53, 0x5A, 0x5A, 0x2A, 0x6B, 0xD6, 0xAC, 0x91, 0x75, 0xEB, 0xD6, 0x09, 0xE2, 0x99,
-    0xB4, 0x9C, 0x13, 0x80, 0x70, 0x70, 0xB9, 0x18, 0x6F, 0x11, 0x1F, 0x3F, 0x7E, 0xCC, 0xAC, 0x94,
-    0xFC, 0x8C, 0x19, 0x33, 0x64, 0xC7, 0x8E, 0x1D, 0x09, 0x7D, 0x88, 0x4B, 0x69, 0x80, 0x38, 0x8D,
-    0x72, 0x56, 0x00, 0xCE, 0x0B, 0xAF, 0x09, 0x97, 0x2E, 0x5D, 0x92, 0xDB, 0xB7, 0x6F, 0x47, 0x5D,
-    0x42, 0x60, 0x1D, 0xDB, 0xE3, 0xED, 0xED, 0xE2, 0xC5, 0x8B, 0x65, 0xC5, 0x8A, 0x15, 0x32, 0x6D,
-    0xDA, 0x34, 0xBB, 0x38, 0xA3, 0xE9, 0x9C, 0x17, 0x80, 0xB4, 0x3A, 0x3B, 0x3B, 0xE5, 0xD9, 0xB3,
-    0x67, 0x7A, 0x9F, 0xBF, 0x71, 0xE3, 0x86, 0xD8, 0x57, 0x34, 0x71, 0xE1, 0x0D, 0x6F, 0x2B, 0xB1,
-    0xE2, 0xEB, 0xEB, 0xEB, 0xA5, 0xBC, 0xBC, 0x9C, 0x4D, 0x43, 0xF5, 0xF1, 0x04, 0xC8, 0xEC, 0x86,
-    0x38, 0x08, 0x14, 0x78, 0xCB, 0x88, 0x17, 0x51, 0x84, 0x96, 0x96, 0x16, 0xB9, 0x7C, 0xF9, 0xB2,
-    0xAF, 0xB7, 0x86, 0x86, 0x06, 0x59, 0xBF, 0x7E, 0xBD, 0x2F, 0x2F, 0x17, 0x12, 0xC5, 0xB9, 0x70,
-    0x90, 0xF9, 0x7C, 0x8C, 0x4E, 0x80, 0x90, 0xD5, 0x75, 0x02, 0x38, 0x01, 0x42, 0x26, 0x10, 0xF2,
-    0xF0, 0xEE, 0x0C, 0x70, 0x02, 0x84, 0x4C, 0x20, 0xE4, 0xE1, 0xDD, 0x19, 0x10, 0xB2, 0x00, 0x59,
-    0x73, 0x35, 0x34, 0x64, 0x0E, 0x69, 0x1B, 0x3E, 0xDE, 0x07, 0x31, 0x77, 0x06, 0xA4, 0x0D, 0x7D,
-    0x62, 0x1D, 0x3B, 0x01, 0x12, 0xE3, 0x94, 0xB6, 0x5A, 0x4E, 0x80, 0xB4, 0xA1, 0x4D, 0xAC, 0x63,
-    0x27, 0x40, 0x62, 0x9C, 0xD2, 0x56, 0xCB, 0x09, 0x90, 0x36, 0xB4, 0x89, 0x75, 0x1C, 0x4B, 0x00,
-    0xDC, 0xB8, 0xCF, 0x90, 0x58, 0x4F, 0xAE, 0x56, 0x2C, 0x02, 0xE4, 0x08, 0x1F, 0x65, 0x41, 0x02,
-    0x04, 0x56, 0x8C, 0x6A, 0xE9, 0x32, 0x52, 0x21, 0x10, 0xC5, 0x96, 0x02, 0xB0, 0xC0, 0xF4, 0x78,
-    0x36, 0x64, 0xF0, 0xF3, 0x21, 0x53, 0x19, 0xBA, 0x70, 0xDB, 0x90, 0xA3, 0xC9, 0x16, 0x34, 0x74,
-    0x1A, 0x02, 0x04, 0x15, 0x20, 0x0F, 0xC1, 0x09, 0xA0, 0x20, 0x0C, 0xD2, 0xC0, 0x90, 0x3C, 0xA3,
-    0x58, 0xF3, 0x0C, 0xC0, 0x18, 0xAC, 0x44, 0xC5, 0xF8, 0xBF, 0x11, 0x07, 0x39, 0x7E, 0xC1, 0x37,
-    0x27, 0x47, 0x72, 0x25, 0x67, 0x0D, 0xC6, 0x14, 0x00, 0x19, 0x2C, 0x44, 0x65, 0xFE, 0x6F, 0x44,
-    0x5D, 0xD1, 0xFD, 0x49, 0x99, 0x00, 0xFE, 0x61, 0x1B, 0x58, 0x9A, 0x67, 0x82, 0xD7, 0x19, 0x05,
-    0x08, 0x02, 0x8F, 0x86, 0x5D, 0xEA, 0xCB, 0xF0, 0xE0, 0x1F, 0x6F, 0x79, 0x5D, 0xB8, 0x48, 0x2C,
-    0x02, 0x11, 0x76, 0xF8, 0x35, 0x08, 0x58, 0x06, 0x0A, 0x61, 0x0B, 0x00, 0x21, 0xB8, 0xFA, 0xD1,
-    0xB0, 0x53, 0xDD, 0x71, 0xF6, 0xAF, 0xF2, 0xCE, 0x52, 0x20, 0x10, 0x61, 0xC7, 0x7F, 0x5D, 0x68,
-    0x9F, 0x05, 0x60, 0xED, 0x7B, 0x60, 0x93, 0x09, 0x5F, 0xAF, 0x7E, 0x55, 0xDE, 0xB1, 0x6F, 0xDF,
-    0xBE, 0x3F, 0xD5, 0xDD, 0x6A, 0x78, 0xF0, 0xB4, 0xB3, 0x24, 0x08, 0x80, 0x19, 0xD8, 0xA9, 0x26,
-    0x7C, 0x50, 0xB7, 0x7D, 0x06, 0xE8, 0xDE, 0xF0, 0xE4, 0x74, 0x1A, 0x2E, 0x4D, 0x47, 0x85, 0xFB,
-    0xF7, 0xEF, 0xB7, 0xA9, 0x1F, 0x43, 0xFC, 0x3D, 0x6F, 0xDE, 0xBC, 0x1A, 0x75, 0xAF, 0x4D, 0x75,
-    0x49, 0x49, 0x49, 0x72, 0xB7, 0x29, 0xB3, 0xF7, 0x02, 0xF1, 0xD8, 0x76, 0xD4, 0xC3, 0xC3, 0xFF,
-    0xF9, 0x4D, 0xD9, 0xF1, 0xE3, 0xC7, 0xFF, 0x53, 0xD3, 0x86, 0x00, 0x3C, 0x0B, 0x4C, 0x11, 0xF4,
-    0x6B, 0x82, 0x09, 0x1C, 0xDB, 0x11, 0x02, 0xEE, 0x15, 0x42, 0xC0, 0xBD, 0xDB, 0x08, 0xB8, 0xC3,
-    0xC9, 0xF4, 0xFC, 0xDF, 0x88, 0x10, 0x8F, 0x6D, 0xD0, 0x4F, 0x21, 0x1A, 0x77, 0x0D, 0x6E, 0xDB,
-    0xDC, 0x39, 0x00, 0x9C, 0xE0, 0xE9, 0x91, 0x87, 0x72, 0x04, 0xD4, 0xD7, 0x02, 0x98, 0x37, 0x66,
-    0xA1, 0x33, 0x76, 0x88, 0xFD, 0x8A, 0x3F, 0x25, 0x44, 0x1E, 0xDF, 0x11, 0xA1, 0x13, 0xB4, 0x01,
-    0x7C, 0x04, 0x80, 0xE7, 0xEB, 0x48, 0xA1, 0x89, 0x00, 0x2E, 0x30, 0x0D, 0x52, 0x79, 0x30, 0x22,
-    0x27, 0xB0, 0xB3, 0x03, 0xCA, 0x58, 0x97, 0x6D, 0x35, 0x4C, 0x2F, 0x11, 0xA9, 0xA0, 0x9C, 0x67,
-    0x28, 0x43, 0x23, 0x76, 0x0C, 0x01, 0x6C, 0xF8, 0x26, 0x78, 0x33, 0xEE, 0x75, 0x92, 0x87, 0x11,
-    0x93, 0x19, 0x19, 0xC1, 0x53, 0x04, 0xF2, 0xE2, 0x8A, 0x37, 0xF3, 0x4D, 0x11, 0xFA, 0xCC, 0x33,
-    0x00, 0x9C, 0xD8, 0x19, 0x99, 0x31, 0xCD, 0x0E, 0xB1, 0xDA, 0xCD, 0x95, 0x6F, 0x02, 0x37, 0xE3,
-    0x6C, 0x9F, 0xCF, 0x1E, 0x6C, 0x68, 0xE4, 0x04, 0x0F, 0x56, 0x5C, 0xB4, 0x8C, 0x33, 0x4D, 0xF8,
-    0x6C, 0xA7, 0xB7, 0x10, 0x26, 0x00, 0x90, 0x10, 0xE1, 0x01, 0x9B, 0x3E, 0x28, 0x6E, 0xD6, 0x65,
-    0x1F, 0x85, 0xE8, 0x29, 0x04, 0x3C, 0x85, 0x20, 0x68, 0x78, 0x33, 0x6E, 0xD7, 0xF5, 0x80, 0x03,
-    0x9C, 0x0D, 0x94, 0x69, 0xC2, 0x47, 0x9A, 0x81, 0xF5, 0x59, 0x07, 0xE9, 0x42, 0x36, 0xC2, 0x07,
-    0x03, 0xC6, 0xE9, 0x21, 0x00, 0xCC, 0x84, 0xEF, 0xA5, 0x83, 0x00, 0x32, 0x8F, 0x1E, 0x95, 0x19,
-    0x87, 0x67, 0xDC, 0xCC, 0x47, 0xBC, 0x90, 0x8D, 0x70, 0xC1, 0x80, 0xE0, 0x19, 0x27, 0x17, 0xD6,
-    0xA1, 0xD7, 0xF9, 0x26, 0x4C, 0x56, 0xA4, 0xB7, 0xCB, 0xEC, 0x34, 0xEB, 0xD1, 0xC7, 0x2B, 0x67,
-    0xBD, 0x7C, 0xF1, 0x3E, 0x90, 0x01, 0x93, 0xB2, 0xCB, 0xED, 0xB4, 0x6E, 0xF2, 0x3F, 0x8E, 0x2C,
-    0xA9, 0xB8, 0x4D, 0x0C, 0xA3, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42,
-    0x60, 0x82
-};
-
-#endif    /* __icon_list_item2_png_h_included */
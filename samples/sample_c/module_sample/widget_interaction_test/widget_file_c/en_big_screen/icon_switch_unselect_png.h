@@ -1,172 +0,0 @@
-/* Generated by file2c, do not edit manually */
-#ifndef __icon_switch_unselect_png_h_included
-#define __icon_switch_unselect_png_h_included
-
-#include <stdint.h>
-
-/* Contents of file icon_switch_unselect.png */
-#define icon_switch_unselect_png_fileName        "icon_switch_unselect.png"
-#define icon_switch_unselect_png_fileSize        2514
-
-static const uint8_t icon_switch_unselect_png_fileBinaryArray[2514] = {
-    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52,
-    0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77,
-    0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00,
-    0x09, 0x8C, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x49, 0x68, 0x54, 0x49, 0x1C, 0xC6,
-    0x2B, 0x8B, 0x93, 0x68, 0x12, 0x77, 0x07, 0x64, 0x54, 0x30, 0x4E, 0x14, 0x8D, 0x51, 0x11, 0x0F,
-    0xA2, 0x20, 0x8A, 0x30, 0x07, 0x43, 0xF0, 0xE2, 0x51, 0x6F, 0x82, 0x5E, 0x45, 0x64, 0x88, 0x0C,
-    0x08, 0xE3, 0x5C, 0xBC, 0x29, 0x03, 0x42, 0xBC, 0x78, 0x10, 0x41, 0x14, 0x41, 0x21, 0x03, 0x32,
-    0x8C, 0x37, 0xF7, 0x51, 0x71, 0x21, 0xEE, 0x18, 0x26, 0xEE, 0xB8, 0x8E, 0xEB, 0x24, 0x9A, 0x64,
-    0xFE, 0x5F, 0xD9, 0xDF, 0xA3, 0xBA, 0x7A, 0x7F, 0x76, 0xBD, 0xEE, 0x97, 0xAE, 0x3F, 0x54, 0x6A,
-    0xAF, 0xEA, 0xF7, 0xFB, 0x6A, 0x49, 0xBF, 0xAD, 0xAB, 0x54, 0x76, 0xAB, 0xB2, 0xB2, 0xED, 0xB8,
-    0x95, 0xAD, 0x72, 0xE5, 0xDB, 0xE5, 0xE3, 0x1A, 0x1F, 0xCE, 0xF1, 0xC1, 0xED, 0x7C, 0x3B, 0x1E,
-    0x54, 0xCF, 0x04, 0x8C, 0xE9, 0xF4, 0x51, 0x81, 0x61, 0xF8, 0x0C, 0x9B, 0xE9, 0x08, 0x57, 0xA2,
-    0x99, 0x70, 0x11, 0x66, 0x9C, 0x3E, 0x98, 0x30, 0x4C, 0x3F, 0xE0, 0x54, 0x1B, 0x84, 0xBE, 0x06,
-    0x08, 0xD6, 0xF4, 0x09, 0xDC, 0xF6, 0x51, 0x83, 0x69, 0x56, 0x33, 0x15, 0x15, 0x05, 0x54, 0x82,
-    0x65, 0xD8, 0xF6, 0x6D, 0x20, 0x2C, 0x9F, 0x76, 0x24, 0x13, 0xAA, 0xE9, 0x57, 0x4B, 0x0B, 0x74,
-    0x48, 0x47, 0x98, 0xF9, 0x68, 0x1C, 0xE1, 0x4A, 0x34, 0x82, 0x24, 0xF0, 0x21, 0x81, 0x80, 0x30,
-    0x7C, 0x3A, 0xE6, 0x99, 0x3E, 0x58, 0x21, 0xAE, 0xD2, 0xCD, 0x00, 0x82, 0x25, 0xF0, 0x1A, 0x29,
-    0x87, 0xB0, 0xED, 0x9B, 0x42, 0xA0, 0x2D, 0x58, 0xA5, 0x08, 0xA1, 0xE1, 0x7D, 0x3D, 0xE4, 0x00,
-    0x38, 0xD2, 0x00, 0x7D, 0x30, 0x83, 0x8F, 0x3C, 0x5A, 0x50, 0x9F, 0x02, 0x10, 0x3A, 0x7D, 0x02,
-    0x07, 0x74, 0xB8, 0x51, 0x09, 0x1F, 0xE5, 0x99, 0x46, 0x81, 0x58, 0x47, 0xB2, 0xB4, 0x8D, 0x74,
-    0x11, 0x02, 0x78, 0x72, 0xB4, 0x08, 0x13, 0x3C, 0xE1, 0x43, 0x80, 0x2F, 0xE2, 0xE0, 0x7F, 0x16,
-    0x07, 0x1E, 0x08, 0xC3, 0x4C, 0x11, 0x10, 0x1F, 0xA6, 0x00, 0x88, 0xC0, 0x50, 0xD8, 0x84, 0x0F,
-    0xF0, 0xB6, 0x43, 0x1D, 0x0A, 0x61, 0x8A, 0x20, 0xC9, 0x15, 0x37, 0x03, 0x6C, 0xF8, 0x00, 0x0F,
-    0x07, 0xF0, 0x70, 0xE0, 0x03, 0xDF, 0x34, 0x88, 0x10, 0x88, 0x08, 0x90, 0x1C, 0xC1, 0xF4, 0x29,
-    0x00, 0xC0, 0x7F, 0x97, 0x70, 0x75, 0x46, 0x18, 0x69, 0x9C, 0x11, 0x5C, 0x96, 0x58, 0x57, 0xB2,
-    0x2A, 0xC6, 0xCC, 0xD1, 0x8F, 0x11, 0xCE, 0x11, 0x3F, 0x20, 0x61, 0x3A, 0xB0, 0x04, 0x1B, 0x1A,
-    0xEB, 0x98, 0x69, 0xC1, 0xA8, 0x87, 0x18, 0x80, 0xDB, 0x20, 0x6E, 0x9C, 0xB8, 0xEF, 0xC5, 0x4D,
-    0x17, 0xD7, 0x22, 0xAE, 0x6D, 0xD3, 0xA6, 0x4D, 0x1D, 0xF7, 0xEF, 0xDF, 0xEF, 0x7E, 0xFB, 0xF6,
-    0x6D, 0xEF, 0xF0, 0xF0, 0xF0, 0xA0, 0x38, 0x6F, 0xC9, 0x04, 0x06, 0xC1, 0x06, 0x8C, 0xC0, 0x0A,
-    0xCC, 0x12, 0xEC, 0xC0, 0x10, 0x2C, 0xC1, 0x14, 0x6C, 0xC1, 0x18, 0xAC, 0x03, 0x71, 0xA0, 0x06,
-    0x22, 0x18, 0xD5, 0xF5, 0xE2, 0x9A, 0xC4, 0x4D, 0x16, 0xF7, 0x83, 0xB8, 0x1F, 0xC5, 0xB5, 0x1D,
-    0x3B, 0x76, 0xEC, 0xE7, 0x2F, 0x5F, 0xBE, 0x7C, 0x48, 0xEE, 0xCF, 0xC7, 0x32, 0x11, 0x00, 0x2B,
-    0x30, 0x03, 0xBB, 0x04, 0x43, 0xB0, 0x04, 0x53, 0xB0, 0x05, 0x63, 0xB0, 0xD6, 0x02, 0x98, 0x4B,
-    0x08, 0x12, 0xB8, 0xE1, 0xA2, 0x00, 0x96, 0x9D, 0x7A, 0x51, 0xB3, 0x79, 0xCB, 0x96, 0x2D, 0xBF,
-    0xD7, 0xD4, 0xD4, 0x8C, 0x91, 0xB8, 0xB7, 0x3C, 0x08, 0x54, 0x57, 0x57, 0x8F, 0x6A, 0x69, 0x69,
-    0x59, 0xF6, 0xEC, 0xD9, 0xB3, 0xBF, 0x2E, 0x5D, 0xBA, 0xF4, 0x56, 0xAA, 0x70, 0x83, 0x86, 0xCF,
-    0x3D, 0x40, 0xEF, 0x03, 0x1C, 0xFD, 0xF0, 0x31, 0x2D, 0x00, 0x1E, 0x53, 0x64, 0xB4, 0x38, 0x00,
-    0x6F, 0x90, 0x29, 0xF5, 0xDB, 0xCC, 0x99, 0x33, 0xDB, 0x25, 0xEC, 0xAD, 0x40, 0x02, 0xBD, 0xBD,
-    0xBD, 0x7F, 0x34, 0x37, 0x37, 0xFF, 0x22, 0xD5, 0x3E, 0x88, 0xFB, 0x28, 0xEE, 0x93, 0x38, 0xEC,
-    0x0F, 0xD8, 0x98, 0xB1, 0x59, 0x0F, 0x63, 0xD4, 0xC3, 0x20, 0x00, 0xC5, 0xE0, 0xBF, 0x99, 0x7A,
-    0x4F, 0x98, 0x3C, 0x79, 0x72, 0xAB, 0x2E, 0xE1, 0xFF, 0x14, 0x4C, 0x20, 0xC1, 0x8E, 0x6B, 0x3E,
-    0xB9, 0xEA, 0xA5, 0x27, 0xC1, 0x5B, 0xAF, 0x43, 0x68, 0x98, 0x02, 0x98, 0x22, 0xE8, 0x19, 0xD1,
-    0xD4, 0xD4, 0x34, 0xA3, 0xE0, 0x9E, 0x7D, 0x05, 0x4D, 0x20, 0xC1, 0x0E, 0xAB, 0x0A, 0x58, 0x9A,
-    0xCB, 0x3D, 0x79, 0x07, 0x02, 0x10, 0x19, 0x33, 0xB8, 0x1F, 0xB0, 0x12, 0xF3, 0xBD, 0x5F, 0x18,
-    0x01, 0x9B, 0x23, 0xF9, 0x06, 0xAD, 0x70, 0x09, 0x42, 0x02, 0x33, 0x91, 0x46, 0x07, 0x01, 0xBC,
-    0x7D, 0x1B, 0x01, 0x0E, 0x62, 0x32, 0x25, 0x67, 0xDD, 0x2A, 0x12, 0x91, 0x00, 0x33, 0x7D, 0x84,
-    0xCD, 0x3C, 0x5D, 0xC0, 0xFF, 0x09, 0x45, 0xC0, 0x64, 0x69, 0x32, 0x46, 0x63, 0x55, 0x80, 0x0C,
-    0x4B, 0xC9, 0x48, 0xA4, 0x31, 0x5F, 0x17, 0xF2, 0x7F, 0x42, 0x11, 0xE0, 0x40, 0x4E, 0xC7, 0x38,
-    0x65, 0x0F, 0x40, 0x0F, 0x2C, 0x18, 0xAA, 0x37, 0x5F, 0x29, 0x2B, 0x81, 0x14, 0xB6, 0x99, 0x46,
-    0x38, 0x0A, 0xD2, 0x65, 0x6D, 0xD1, 0x67, 0xE6, 0x24, 0x40, 0x8E, 0x29, 0xF0, 0x51, 0x33, 0x93,
-    0x00, 0x39, 0x5B, 0xF5, 0x05, 0x8A, 0x43, 0xC0, 0x0B, 0x50, 0x1C, 0x8E, 0xA1, 0x5B, 0xF1, 0x02,
-    0x84, 0x46, 0x57, 0x9C, 0x8A, 0x5E, 0x80, 0xE2, 0x70, 0x0C, 0xDD, 0x8A, 0x17, 0x20, 0x34, 0xBA,
-    0xE2, 0x54, 0xF4, 0x02, 0x14, 0x87, 0x63, 0xE8, 0x56, 0xBC, 0x00, 0xA1, 0xD1, 0x15, 0xA7, 0xA2,
-    0x17, 0xA0, 0x38, 0x1C, 0x43, 0xB7, 0x12, 0x2B, 0x01, 0x1E, 0x3D, 0x7A, 0xA4, 0x2E, 0x5E, 0xBC,
-    0xA8, 0x0F, 0xF6, 0xD0, 0xA1, 0x43, 0x4A, 0xAE, 0xD4, 0xA9, 0xF5, 0xEB, 0xD7, 0xAB, 0xEB, 0xD7,
-    0xAF, 0x87, 0x06, 0x50, 0xEA, 0x8A, 0x38, 0x4F, 0x5D, 0x96, 0x36, 0x30, 0x30, 0xA0, 0xAE, 0x5C,
-    0xB9, 0xA2, 0x6E, 0xDD, 0xBA, 0xA5, 0xEE, 0xDE, 0xBD, 0xAB, 0xEE, 0xDD, 0xBB, 0xA7, 0x3E, 0x7E,
-    0xFC, 0xA8, 0xA6, 0x4E, 0x9D, 0xAA, 0x96, 0x2C, 0x59, 0xA2, 0x6E, 0xDF, 0xBE, 0xAD, 0xE4, 0x6A,
-    0x9D, 0xFE, 0xEC, 0x27, 0x4F, 0x9E, 0x54, 0x6D, 0x6D, 0xB8, 0xFC, 0x1A, 0x3F, 0x2B, 0x2B, 0x01,
-    0x00, 0xF8, 0xC2, 0x85, 0x0B, 0xEA, 0xEC, 0xD9, 0xB3, 0xEA, 0xF2, 0xE5, 0xCB, 0x0A, 0x22, 0xE4,
-    0x63, 0x67, 0xCE, 0x9C, 0x51, 0x9B, 0x37, 0x6F, 0x56, 0xF5, 0xF5, 0xB8, 0xDE, 0x1D, 0x2F, 0x2B,
-    0x0B, 0x01, 0xE4, 0xDA, 0xA9, 0x3A, 0x72, 0xE4, 0x88, 0x3A, 0x7F, 0xFE, 0xBC, 0x92, 0x3B, 0x0A,
-    0x0A, 0x26, 0xD8, 0xDF, 0xDF, 0xAF, 0x4E, 0x9F, 0x3E, 0xAD, 0x56, 0xAF, 0x5E, 0x5D, 0x70, 0xDD,
-    0x52, 0x57, 0x28, 0xA9, 0x00, 0x37, 0x6E, 0xDC, 0xD0, 0xE0, 0x31, 0xDA, 0xBF, 0xD5, 0xB0, 0x0C,
-    0x79, 0x01, 0xF2, 0xA4, 0xF8, 0xFE, 0xFD, 0x7B, 0xB5, 0x77, 0xEF, 0x5E, 0x3D, 0x6A, 0xF3, 0xAC,
-    0x92, 0xB3, 0x18, 0xC4, 0x7C, 0xF3, 0xE6, 0x8D, 0x1A, 0x3F, 0x7E, 0x7C, 0xCE, 0xB2, 0xE5, 0x54,
-    0x20, 0xF2, 0x19, 0x80, 0x8D, 0x75, 0xF7, 0xEE, 0xDD, 0xEA, 0xF5, 0xEB, 0xD7, 0x45, 0xE5, 0x20,
-    0x37, 0x49, 0xE9, 0x4D, 0x7B, 0xE5, 0xCA, 0x95, 0x59, 0xDB, 0x5D, 0xBB, 0x76, 0x6D, 0xD6, 0xFC,
-    0x5C, 0x99, 0xC7, 0x8F, 0x1F, 0xCF, 0x55, 0xA4, 0xA0, 0xFC, 0x48, 0xFF, 0x0D, 0x3D, 0x7C, 0xF8,
-    0xB0, 0xDA, 0xB1, 0x63, 0x47, 0xD1, 0xE1, 0xF3, 0x88, 0x21, 0x6E, 0xDC, 0x2C, 0x32, 0x01, 0xE4,
-    0x56, 0x3D, 0x75, 0xF0, 0xE0, 0x41, 0xA7, 0x7C, 0xAE, 0x5E, 0xBD, 0xEA, 0xB4, 0x7D, 0x17, 0x8D,
-    0x47, 0x22, 0xC0, 0x89, 0x13, 0x27, 0xD4, 0xFE, 0xFD, 0xFB, 0x5D, 0x7C, 0xFE, 0xA4, 0x36, 0x5F,
-    0xBD, 0x7A, 0xA5, 0x1E, 0x3C, 0x78, 0x90, 0x94, 0x56, 0xEE, 0x11, 0xE7, 0x7B, 0x00, 0x80, 0xEC,
-    0xDB, 0xB7, 0x2F, 0x32, 0x0E, 0x37, 0x6F, 0xDE, 0x54, 0xD3, 0xA7, 0xE3, 0x86, 0xE4, 0xF4, 0x56,
-    0xEC, 0x35, 0x3C, 0x7D, 0x2F, 0xF9, 0xA7, 0x3A, 0x9F, 0x01, 0x5D, 0x5D, 0x5D, 0x6A, 0x70, 0x10,
-    0xB7, 0xCE, 0x47, 0x63, 0x7D, 0x7D, 0x7D, 0xD1, 0x74, 0x54, 0xA4, 0x5E, 0x9C, 0x0A, 0x70, 0xEA,
-    0xD4, 0xA9, 0xC8, 0xCF, 0xD3, 0x3C, 0x7C, 0xF8, 0xB0, 0x48, 0x68, 0xA2, 0x69, 0xC6, 0xA9, 0x00,
-    0xDD, 0xDD, 0xDD, 0xD1, 0x1C, 0x85, 0xD1, 0x8B, 0x9F, 0x01, 0x09, 0x18, 0xF8, 0x52, 0x84, 0x13,
-    0x69, 0x51, 0xDB, 0xCB, 0x97, 0x2F, 0xF5, 0x49, 0xBB, 0xA8, 0xFB, 0x0D, 0xDB, 0x9F, 0xB3, 0x19,
-    0x80, 0xF3, 0x3A, 0xF8, 0x72, 0x54, 0x0A, 0x7B, 0xFE, 0xFC, 0x79, 0x29, 0xBA, 0x0D, 0xD5, 0xA7,
-    0x33, 0x01, 0x4A, 0x79, 0x8E, 0x1E, 0x67, 0x55, 0xE3, 0x62, 0xCE, 0x04, 0xC0, 0x52, 0x50, 0x2A,
-    0x8B, 0x93, 0x00, 0xCE, 0xBE, 0x07, 0x14, 0xFB, 0x5C, 0x4F, 0x21, 0x62, 0x7E, 0xFA, 0x84, 0x27,
-    0x81, 0xD2, 0x5B, 0xC5, 0x9C, 0x0B, 0xC2, 0x26, 0x5C, 0x2A, 0x8B, 0xD3, 0x0C, 0x70, 0xB6, 0x04,
-    0x95, 0x0A, 0x7E, 0xDC, 0xFA, 0x75, 0x26, 0x40, 0x29, 0xCF, 0xCB, 0x8F, 0x19, 0x13, 0x9F, 0x27,
-    0x6A, 0x9D, 0xED, 0x01, 0x13, 0x26, 0x4C, 0x50, 0x4F, 0x9E, 0x3C, 0x29, 0xC9, 0x80, 0x1C, 0x3D,
-    0x1A, 0x4F, 0xD9, 0xA6, 0xB7, 0x8A, 0x39, 0x17, 0x34, 0x71, 0xE2, 0xC4, 0xF4, 0x04, 0x22, 0x48,
-    0x6D, 0x68, 0xC0, 0x1B, 0x01, 0xE2, 0x61, 0xCE, 0x96, 0xA0, 0xF9, 0xF3, 0xE7, 0x97, 0x8C, 0x40,
-    0xB6, 0x19, 0x50, 0xB2, 0x0F, 0x95, 0xA1, 0x63, 0x67, 0x02, 0x2C, 0x5D, 0xBA, 0x54, 0x55, 0x55,
-    0xA5, 0x7D, 0x28, 0x24, 0xC3, 0x47, 0x29, 0x5E, 0xF2, 0x94, 0x29, 0x53, 0x8A, 0xD7, 0x98, 0xE3,
-    0x96, 0x9C, 0x09, 0x80, 0x3D, 0x40, 0xDE, 0x97, 0xE0, 0xF8, 0xE3, 0xA7, 0x36, 0x3F, 0x69, 0xD2,
-    0x24, 0x15, 0xA7, 0x4D, 0xD8, 0x99, 0x00, 0x40, 0xB3, 0x66, 0xCD, 0x9A, 0x54, 0x42, 0x8E, 0x53,
-    0x66, 0xCC, 0x88, 0xD7, 0x83, 0xFD, 0x4E, 0x05, 0x58, 0xB5, 0x6A, 0x95, 0x9A, 0x33, 0x67, 0x8E,
-    0x63, 0xE4, 0xC9, 0xCD, 0x4F, 0x9B, 0x36, 0x2D, 0x39, 0xA1, 0xCC, 0x63, 0x4E, 0x05, 0xC0, 0xB1,
-    0xCB, 0xEB, 0x6E, 0x22, 0xDD, 0x0B, 0xE2, 0x36, 0x03, 0x9C, 0x7D, 0x0F, 0xE0, 0xC0, 0x9B, 0x35,
-    0x6B, 0x96, 0xBE, 0x83, 0xF9, 0xC0, 0x81, 0x03, 0x4C, 0x72, 0xEA, 0xCF, 0x9D, 0x3B, 0x37, 0x6B,
-    0xFB, 0x15, 0x73, 0x2E, 0xC8, 0xA4, 0xB0, 0x6E, 0xDD, 0x3A, 0x05, 0xE7, 0xDA, 0xF0, 0xDD, 0x23,
-    0xDB, 0x05, 0x79, 0xD7, 0xFD, 0x87, 0x69, 0xDF, 0xF9, 0x12, 0xC4, 0x0F, 0xB5, 0x61, 0xC3, 0x06,
-    0xD5, 0xD1, 0xD1, 0xC1, 0xA8, 0x13, 0x7F, 0xD1, 0xA2, 0x45, 0x4E, 0xDA, 0x75, 0xD9, 0x68, 0x64,
-    0x02, 0xE0, 0x20, 0x36, 0x6E, 0xDC, 0xA8, 0xB6, 0x6E, 0xDD, 0xAA, 0x5C, 0x7D, 0x53, 0x8D, 0xA3,
-    0x00, 0xCE, 0xF7, 0x00, 0x7B, 0xF4, 0xAC, 0x58, 0xB1, 0x42, 0xCD, 0x9B, 0x37, 0x4F, 0xED, 0xD9,
-    0xB3, 0x47, 0x5D, 0xBB, 0x76, 0xCD, 0xCE, 0x0E, 0x1D, 0xC7, 0x97, 0xBE, 0x85, 0x0B, 0x17, 0xE6,
-    0xAC, 0x5F, 0x31, 0xE7, 0x82, 0xB2, 0x91, 0x90, 0x57, 0x79, 0xA9, 0x9D, 0x3B, 0x77, 0xAA, 0xCE,
-    0xCE, 0x4E, 0x35, 0x7B, 0xF6, 0xEC, 0x6C, 0x45, 0xF3, 0xCE, 0x83, 0xA8, 0xA5, 0x3C, 0x03, 0x9B,
-    0xF7, 0x07, 0xB5, 0x0A, 0x46, 0x3E, 0x03, 0xCC, 0xFE, 0x71, 0xBA, 0x02, 0x0E, 0x33, 0xE1, 0xE8,
-    0xD1, 0xA3, 0x0A, 0xF7, 0x76, 0x86, 0xBD, 0x90, 0x1F, 0xC7, 0x67, 0x03, 0xC0, 0xA2, 0xA4, 0x02,
-    0x50, 0x8C, 0x05, 0x0B, 0x16, 0x28, 0x38, 0x5C, 0x47, 0x3E, 0x77, 0xEE, 0x9C, 0x76, 0x3D, 0x3D,
-    0x3D, 0x79, 0xDF, 0x51, 0x57, 0x57, 0x57, 0xA7, 0x96, 0x2F, 0x5F, 0xCE, 0xE6, 0x62, 0xE5, 0x97,
-    0x85, 0x00, 0x24, 0x86, 0xF3, 0x38, 0xED, 0xED, 0xED, 0xDA, 0xE1, 0x21, 0x0E, 0x3C, 0x11, 0x79,
-    0xE7, 0xCE, 0x1D, 0xFD, 0x90, 0x1E, 0x1E, 0x63, 0xFA, 0xFC, 0x19, 0x6F, 0x7B, 0x4C, 0xB5, 0x65,
-    0xCB, 0x96, 0xC5, 0xF2, 0xF9, 0x30, 0x1C, 0x49, 0x59, 0x09, 0x60, 0xA2, 0x6D, 0x6C, 0x6C, 0x54,
-    0x78, 0xD8, 0x82, 0x0F, 0x5C, 0x0C, 0x0D, 0x0D, 0x29, 0xDC, 0xF5, 0xF6, 0xF4, 0xE9, 0x53, 0x5D,
-    0x0C, 0x27, 0xFA, 0x70, 0xE1, 0x1F, 0xF7, 0x00, 0xC5, 0x75, 0xF9, 0xC1, 0x81, 0xE0, 0x7C, 0x31,
-    0x5E, 0x2A, 0x07, 0x87, 0xD7, 0x2B, 0xE2, 0x6D, 0xB9, 0xB8, 0x9E, 0xD7, 0x28, 0x6E, 0xAC, 0xB8,
-    0x71, 0xB2, 0x26, 0xFF, 0x29, 0xBE, 0xB7, 0x90, 0x04, 0xE4, 0xBF, 0xB3, 0x9F, 0xA4, 0xEA, 0xBF,
-    0xE2, 0xF0, 0x06, 0xDD, 0xF7, 0xE2, 0x70, 0xD3, 0x52, 0xBF, 0x38, 0x4C, 0xE7, 0xC1, 0x48, 0xBF,
-    0x07, 0x48, 0x87, 0xDE, 0x2C, 0x02, 0x5E, 0x00, 0x0B, 0x48, 0xD4, 0x51, 0x2F, 0x40, 0xD4, 0xC4,
-    0xAD, 0xFE, 0xBC, 0x00, 0x16, 0x90, 0xA8, 0xA3, 0x5E, 0x80, 0xA8, 0x89, 0x5B, 0xFD, 0x79, 0x01,
-    0x2C, 0x20, 0x51, 0x47, 0xBD, 0x00, 0x51, 0x13, 0xB7, 0xFA, 0xF3, 0x02, 0x58, 0x40, 0xA2, 0x8E,
-    0x66, 0x12, 0x80, 0xBF, 0xF6, 0x53, 0x9A, 0x47, 0x5C, 0xA2, 0xA6, 0xE0, 0xB6, 0xBF, 0xAC, 0x2C,
-    0xD3, 0x09, 0xE0, 0xA1, 0xBB, 0x13, 0x24, 0x85, 0x2D, 0x05, 0x60, 0x86, 0xE9, 0x23, 0x8C, 0x1F,
-    0x9C, 0xF1, 0xF6, 0x6D, 0x04, 0xC0, 0x10, 0x2C, 0x4D, 0xB6, 0x68, 0x51, 0xC7, 0x21, 0x40, 0xBA,
-    0x0C, 0xA4, 0xB1, 0x22, 0x0A, 0x7B, 0x0B, 0x4F, 0xC0, 0x64, 0x99, 0xC2, 0x9A, 0x33, 0x00, 0xCD,
-    0x23, 0x93, 0x85, 0x01, 0x1F, 0x2E, 0xBA, 0x47, 0xDC, 0xA5, 0xB3, 0x11, 0x6A, 0x60, 0x48, 0x9E,
-    0x1C, 0xD4, 0x14, 0x22, 0xE5, 0xED, 0xE9, 0xA6, 0x08, 0xA8, 0xC8, 0xCA, 0x23, 0x94, 0x8D, 0xF3,
-    0xC3, 0xE2, 0x20, 0x26, 0x47, 0xF2, 0x0D, 0x3A, 0xE6, 0x0C, 0x60, 0x06, 0x7C, 0x56, 0xC2, 0xCB,
-    0xDB, 0x3E, 0xBF, 0x7B, 0xF7, 0xAE, 0x2F, 0x28, 0xED, 0x03, 0x05, 0x11, 0x48, 0xB0, 0xE3, 0x6F,
-    0x86, 0xD9, 0x22, 0x80, 0x75, 0x30, 0x03, 0x28, 0x00, 0xE1, 0xA3, 0x30, 0x04, 0x18, 0x78, 0xF1,
-    0xE2, 0x45, 0x0F, 0x0A, 0x7A, 0x2B, 0x9C, 0x40, 0x82, 0x1D, 0x5E, 0xFD, 0x08, 0x96, 0x60, 0x6A,
-    0x8B, 0x10, 0x08, 0x80, 0xD6, 0x39, 0xFA, 0x21, 0x82, 0x1E, 0xFD, 0xE2, 0x0F, 0xEC, 0xDA, 0xB5,
-    0xAB, 0x4B, 0xDE, 0x76, 0x12, 0x9F, 0x27, 0x9F, 0x71, 0x24, 0x65, 0x60, 0x60, 0x06, 0x76, 0xF2,
-    0x51, 0x20, 0x00, 0x67, 0x01, 0xD8, 0xC2, 0xE9, 0xD1, 0x2F, 0xBE, 0xBE, 0x12, 0x06, 0x1F, 0x66,
-    0xFE, 0xD4, 0x06, 0x96, 0x26, 0xC4, 0xAB, 0xE5, 0xB7, 0x10, 0x3F, 0x2C, 0x5E, 0xBC, 0xF8, 0x31,
-    0x7E, 0x1B, 0x11, 0xBF, 0x91, 0x88, 0x82, 0xDE, 0xB2, 0x13, 0x00, 0x7C, 0x79, 0x51, 0xC9, 0xAF,
-    0xDB, 0xB6, 0x6D, 0xFB, 0x5B, 0x4A, 0xE2, 0xEA, 0x17, 0xAF, 0x80, 0xE9, 0xAB, 0x60, 0x12, 0x0F,
-    0x84, 0xC0, 0xA5, 0x48, 0x13, 0xBC, 0x44, 0x83, 0x59, 0x81, 0x74, 0x6D, 0xF2, 0x9A, 0xE0, 0x5E,
-    0xFC, 0x30, 0x65, 0x6B, 0x6B, 0xEB, 0xD8, 0xDA, 0xDA, 0xDA, 0xEF, 0xE4, 0x2E, 0x04, 0x5C, 0xAE,
-    0x0C, 0xF2, 0x13, 0xC5, 0x2A, 0xDD, 0x1B, 0x92, 0x35, 0xFF, 0x9F, 0xC7, 0x8F, 0x1F, 0x9F, 0xDE,
-    0xBE, 0x7D, 0x7B, 0x67, 0x02, 0xFE, 0x7F, 0x02, 0x05, 0xF0, 0x31, 0x0B, 0xE0, 0xB8, 0x0C, 0x71,
-    0xC9, 0x4F, 0x82, 0xAF, 0x47, 0xBC, 0x14, 0x82, 0x28, 0xB8, 0x58, 0x8F, 0xD1, 0x8E, 0xDF, 0x41,
-    0x84, 0xC3, 0xB5, 0x62, 0x86, 0xE1, 0x23, 0x8F, 0xD7, 0x92, 0x39, 0x5B, 0x2A, 0x4D, 0x10, 0x42,
-    0xC4, 0x68, 0x26, 0x58, 0x8C, 0x70, 0xC2, 0x86, 0x6F, 0xC2, 0xE7, 0x32, 0x94, 0xB4, 0x0F, 0x00,
-    0x74, 0xB0, 0x1E, 0x25, 0xC2, 0x6C, 0x50, 0xA2, 0xDA, 0x90, 0x8F, 0x34, 0xEE, 0x0B, 0x68, 0x14,
-    0xF5, 0x20, 0x00, 0xE0, 0x53, 0x00, 0x09, 0x56, 0xCC, 0xAC, 0x20, 0x33, 0xB2, 0x21, 0x33, 0x30,
-    0x22, 0x27, 0x00, 0x37, 0x5D, 0x12, 0x78, 0xC9, 0x43, 0xDD, 0x94, 0xDF, 0x94, 0x67, 0x83, 0x92,
-    0x17, 0x18, 0x1A, 0x37, 0x05, 0x30, 0x47, 0x3E, 0xE1, 0x9B, 0xA3, 0xDF, 0x0C, 0x07, 0x8D, 0x8C,
-    0xA0, 0x00, 0xE1, 0xE3, 0x90, 0x34, 0x44, 0xF1, 0xC9, 0x88, 0x33, 0x01, 0x22, 0x20, 0x0C, 0x01,
-    0x98, 0x66, 0x0A, 0x20, 0xC9, 0x5F, 0x8D, 0xF7, 0x05, 0x99, 0x8D, 0x22, 0x07, 0x0D, 0xC2, 0xCC,
-    0x0E, 0x00, 0x1E, 0x0D, 0x72, 0xE4, 0x73, 0xC9, 0x32, 0x81, 0x9B, 0x61, 0xD4, 0x1F, 0xA9, 0x66,
-    0xF2, 0x42, 0x18, 0xBC, 0xE8, 0x13, 0xB4, 0xED, 0xB3, 0x0C, 0x99, 0xEA, 0x36, 0x4C, 0x60, 0x0C,
-    0xC3, 0xB7, 0x1D, 0x97, 0x1A, 0x8E, 0x78, 0xFA, 0x66, 0x9D, 0x91, 0x0A, 0x3B, 0xDB, 0x71, 0x69,
-    0x88, 0x09, 0xF8, 0x14, 0x80, 0x3E, 0x67, 0x05, 0xE2, 0xB6, 0x43, 0x9B, 0x48, 0x4B, 0x59, 0xB3,
-    0x6D, 0xA0, 0xB6, 0x10, 0x66, 0x9C, 0xF5, 0x59, 0x07, 0xF1, 0x4A, 0x34, 0xC2, 0xC5, 0xB1, 0x33,
-    0x9C, 0xCE, 0x67, 0xBE, 0xE9, 0xA7, 0x08, 0x80, 0x4C, 0x18, 0xA1, 0xD2, 0xB7, 0xD3, 0xD2, 0xA5,
-    0xEB, 0x8A, 0x15, 0xF8, 0x47, 0x8F, 0xE4, 0xC4, 0x71, 0x13, 0x3C, 0xA2, 0x76, 0xBA, 0x9D, 0xA6,
-    0xAB, 0x98, 0x20, 0x75, 0x82, 0xF5, 0xC7, 0xCE, 0xB7, 0xE3, 0x56, 0xF1, 0x40, 0x38, 0x3B, 0x7D,
-    0xA4, 0xC5, 0x4D, 0xB8, 0xE9, 0x8E, 0xCD, 0xCE, 0xB7, 0xE3, 0x41, 0x9D, 0xFF, 0x01, 0xB2, 0x15,
-    0x34, 0x9A, 0xBC, 0x3E, 0x46, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42,
-    0x60, 0x82
-};
-
-#endif    /* __icon_switch_unselect_png_h_included */
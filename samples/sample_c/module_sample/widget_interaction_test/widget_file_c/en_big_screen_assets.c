@@ -0,0 +1,1218 @@
+/* Generated by asset_packer, do not edit manually */
+#include "en_big_screen_assets.h"
+
+/* widget_config.json: 7177 bytes, lz4 1986 bytes */
+/* icon_button1.png: 2137 bytes */
+/* icon_button2.png: 2114 bytes */
+/* icon_list_item1.png: 2556 bytes */
+/* icon_list_item2.png: 2578 bytes */
+/* icon_scale.png: 2440 bytes */
+/* icon_switch_select.png: 2529 bytes */
+/* icon_switch_unselect.png: 2514 bytes */
+static const uint8_t s_widgetInteractionEnBigScreenAssetPackBlob[18854] = {
+    0xF0, 0x00, 0x7B, 0x0A, 0x20, 0x20, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0x3A,
+    0x20, 0x0F, 0x00, 0xF0, 0x01, 0x20, 0x20, 0x22, 0x6D, 0x61, 0x6A, 0x6F, 0x72, 0x22, 0x3A, 0x20,
+    0x31, 0x2C, 0x0A, 0x20, 0x20, 0x10, 0x00, 0x21, 0x69, 0x6E, 0x10, 0x00, 0x50, 0x30, 0x0A, 0x20,
+    0x20, 0x7D, 0x14, 0x00, 0xF6, 0x00, 0x22, 0x6D, 0x61, 0x69, 0x6E, 0x5F, 0x69, 0x6E, 0x74, 0x65,
+    0x72, 0x66, 0x61, 0x63, 0x65, 0x3A, 0x00, 0xF5, 0x00, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x69, 0x6E,
+    0x67, 0x5F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x19, 0x00, 0xB0, 0x20, 0x20, 0x22, 0x69, 0x73,
+    0x5F, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x2E, 0x00, 0x41, 0x74, 0x72, 0x75, 0x65, 0x5B, 0x00, 0x01,
+    0x4E, 0x00, 0x90, 0x20, 0x20, 0x22, 0x73, 0x70, 0x65, 0x61, 0x6B, 0x65, 0x74, 0x00, 0x02, 0x83,
+    0x00, 0x08, 0x30, 0x00, 0x70, 0x5F, 0x74, 0x74, 0x73, 0x22, 0x3A, 0x20, 0x34, 0x00, 0x00, 0x7C,
+    0x00, 0x01, 0x92, 0x00, 0x05, 0x4D, 0x00, 0x41, 0x5F, 0x76, 0x6F, 0x69, 0x81, 0x00, 0x00, 0x1F,
+    0x00, 0x09, 0x53, 0x00, 0xF1, 0x00, 0x77, 0x69, 0x64, 0x67, 0x65, 0x74, 0x5F, 0x6C, 0x69, 0x73,
+    0x74, 0x22, 0x3A, 0x20, 0x5B, 0x1C, 0x00, 0x13, 0x20, 0xE2, 0x00, 0x01, 0x44, 0x00, 0x03, 0x21,
+    0x00, 0x94, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x22, 0x3A, 0x20, 0x30, 0x5D, 0x00, 0x33, 0x20, 0x20,
+    0x22, 0x1B, 0x00, 0x30, 0x74, 0x79, 0x70, 0xAE, 0x00, 0x8E, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F,
+    0x6E, 0x22, 0x21, 0x00, 0x31, 0x6E, 0x61, 0x6D, 0x21, 0x00, 0x1D, 0x42, 0x21, 0x00, 0xC0, 0x69,
+    0x63, 0x6F, 0x6E, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x5F, 0x73, 0x65, 0x80, 0x00, 0x04, 0xD7, 0x00,
+    0x01, 0x7A, 0x00, 0x06, 0x1D, 0x00, 0x00, 0x41, 0x00, 0xD1, 0x5F, 0x73, 0x65, 0x6C, 0x65, 0x63,
+    0x74, 0x65, 0x64, 0x22, 0x3A, 0x20, 0x22, 0x1B, 0x00, 0x02, 0x70, 0x00, 0x57, 0x31, 0x2E, 0x70,
+    0x6E, 0x67, 0x75, 0x00, 0x00, 0x14, 0x01, 0x05, 0x56, 0x00, 0x01, 0x39, 0x00, 0x2F, 0x75, 0x6E,
+    0x3B, 0x00, 0x0A, 0x03, 0xF3, 0x00, 0x03, 0xB4, 0x01, 0x00, 0x7A, 0x00, 0xF2, 0x01, 0x20, 0x20,
+    0x22, 0x63, 0x75, 0x73, 0x74, 0x6F, 0x6D, 0x69, 0x7A, 0x65, 0x5F, 0x72, 0x63, 0x5F, 0x69, 0x00,
+    0x87, 0x73, 0x5F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0xAE, 0x01, 0x00, 0x2D, 0x00, 0x0D, 0xB2,
+    0x01, 0x06, 0x00, 0x01, 0x00, 0x14, 0x02, 0x30, 0x61, 0x70, 0x70, 0xE9, 0x01, 0x02, 0x3B, 0x00,
+    0xC1, 0x5F, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x5F, 0x6F, 0x72, 0x64, 0xC7, 0x01, 0x00,
+    0x2B, 0x02, 0x00, 0x45, 0x00, 0x33, 0x20, 0x20, 0x7D, 0x87, 0x00, 0x03, 0xEB, 0x01, 0x0F, 0x83,
+    0x01, 0x09, 0x03, 0x70, 0x02, 0x00, 0x38, 0x00, 0x0C, 0x83, 0x01, 0x01, 0xC7, 0x01, 0x06, 0x81,
+    0x00, 0x04, 0x1F, 0x00, 0x00, 0x07, 0x01, 0x00, 0x37, 0x01, 0x10, 0x4C, 0xE6, 0x01, 0x07, 0x1F,
+    0x00, 0x00, 0x2F, 0x00, 0x57, 0x5F, 0x69, 0x74, 0x65, 0x6D, 0xFB, 0x01, 0x00, 0x57, 0x00, 0x08,
+    0x87, 0x01, 0x00, 0x50, 0x01, 0x44, 0x74, 0x65, 0x6D, 0x5F, 0x44, 0x00, 0x10, 0x49, 0x0D, 0x00,
+    0x19, 0x31, 0x71, 0x01, 0x00, 0x23, 0x00, 0x05, 0x73, 0x01, 0x0E, 0xC9, 0x01, 0x00, 0x52, 0x00,
+    0x02, 0xB2, 0x01, 0x01, 0xEA, 0x01, 0x00, 0x49, 0x00, 0x0E, 0xCD, 0x01, 0x05, 0x8B, 0x00, 0x0E,
+    0xD0, 0x01, 0x0F, 0x40, 0x00, 0x01, 0x0F, 0xD4, 0x01, 0x00, 0x0B, 0x42, 0x00, 0x03, 0x50, 0x01,
+    0x00, 0x3D, 0x00, 0x06, 0x5E, 0x01, 0x00, 0x0E, 0x00, 0x05, 0x62, 0x01, 0x00, 0x0D, 0x00, 0x0F,
+    0xEA, 0x00, 0x0E, 0x1F, 0x32, 0xEA, 0x00, 0x47, 0x1D, 0x32, 0xBA, 0x02, 0x00, 0x92, 0x00, 0x0C,
+    0x2A, 0x01, 0x0F, 0xEA, 0x00, 0x09, 0x02, 0x42, 0x00, 0x0F, 0xEA, 0x00, 0x07, 0x05, 0x1A, 0x00,
+    0x17, 0x5D, 0xF5, 0x01, 0x0F, 0xDB, 0x02, 0x54, 0x15, 0x31, 0x7D, 0x00, 0x0F, 0xDB, 0x02, 0x18,
+    0x17, 0x32, 0xA8, 0x00, 0x0B, 0x5E, 0x04, 0x67, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x8E, 0x01,
+    0x0C, 0xDD, 0x02, 0x1D, 0x53, 0x21, 0x00, 0x01, 0x26, 0x04, 0x01, 0x74, 0x02, 0x0E, 0x95, 0x02,
+    0x0C, 0x67, 0x01, 0x0D, 0x23, 0x04, 0x02, 0x70, 0x00, 0x03, 0xA9, 0x02, 0x0D, 0xAA, 0x01, 0x0C,
+    0x3F, 0x00, 0x0F, 0xA6, 0x01, 0x00, 0x03, 0x41, 0x00, 0x04, 0x1A, 0x00, 0x01, 0x43, 0x00, 0x06,
+    0x14, 0x01, 0x07, 0xE9, 0x00, 0x0F, 0x91, 0x01, 0x54, 0x16, 0x32, 0x7D, 0x00, 0x03, 0x0A, 0x00,
+    0x05, 0x0A, 0x03, 0x06, 0x06, 0x03, 0x04, 0x55, 0x01, 0x13, 0x69, 0xEF, 0x05, 0x17, 0x33, 0xA8,
+    0x00, 0x0C, 0x91, 0x01, 0x4F, 0x63, 0x61, 0x6C, 0x65, 0x90, 0x01, 0x09, 0x0C, 0x20, 0x00, 0x0F,
+    0x8F, 0x01, 0x2B, 0x00, 0x4E, 0x00, 0x01, 0x44, 0x01, 0x06, 0x92, 0x00, 0x09, 0x78, 0x04, 0x01,
+    0x57, 0x04, 0x04, 0x6D, 0x01, 0x07, 0x26, 0x06, 0x15, 0x73, 0x39, 0x00, 0x03, 0xF6, 0x00, 0x0F,
+    0xE9, 0x05, 0x62, 0x16, 0x33, 0x7D, 0x00, 0x03, 0x0A, 0x00, 0x02, 0x16, 0x03, 0x15, 0x5D, 0x2C,
+    0x08, 0x03, 0x22, 0x06, 0x0F, 0x2E, 0x08, 0x00, 0xD0, 0x74, 0x65, 0x78, 0x74, 0x5F, 0x69, 0x6E,
+    0x70, 0x75, 0x74, 0x5F, 0x62, 0x6F, 0x84, 0x07, 0x04, 0xAF, 0x01, 0x04, 0xAD, 0x01, 0x00, 0xFB,
+    0x00, 0x00, 0xDF, 0x05, 0x50, 0x54, 0x65, 0x78, 0x74, 0x49, 0x28, 0x00, 0x35, 0x42, 0x6F, 0x78,
+    0x99, 0x01, 0xD0, 0x22, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x68, 0x6F, 0x6C, 0x64, 0x65, 0x72, 0x5F,
+    0x4B, 0x00, 0x00, 0x2A, 0x00, 0x71, 0x50, 0x6C, 0x65, 0x61, 0x73, 0x65, 0x20, 0x55, 0x00, 0x76,
+    0x20, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0xCB, 0x01, 0x0D, 0xD2, 0x06, 0x01, 0xB2, 0x00, 0x03,
+    0x2D, 0x02, 0x04, 0x74, 0x00, 0x00, 0x6E, 0x05, 0x07, 0x36, 0x06, 0x04, 0x93, 0x00, 0x06, 0x16,
+    0x08, 0x04, 0x42, 0x02, 0x16, 0x34, 0xB0, 0x01, 0x04, 0x3C, 0x00, 0x0F, 0x31, 0x08, 0x1C, 0x25,
+    0x20, 0x34, 0xCD, 0x00, 0x0F, 0x9A, 0x07, 0x57, 0x11, 0x34, 0xF5, 0x00, 0x00, 0x91, 0x05, 0x02,
+    0xA9, 0x01, 0x07, 0x36, 0x02, 0x0F, 0xEC, 0x00, 0x07, 0x1F, 0x35, 0xEC, 0x00, 0x07, 0x01, 0x87,
+    0x02, 0x08, 0xC8, 0x00, 0x03, 0x4E, 0x03, 0x04, 0xBC, 0x01, 0x10, 0x53, 0xA7, 0x02, 0x28, 0x20,
+    0x35, 0x22, 0x00, 0x0F, 0x18, 0x04, 0x54, 0x1F, 0x35, 0xEA, 0x00, 0x21, 0x1F, 0x36, 0xEA, 0x00,
+    0x07, 0x28, 0x69, 0x6E, 0xAE, 0x02, 0x0E, 0x28, 0x00, 0x04, 0xF2, 0x00, 0x81, 0x49, 0x6E, 0x74,
+    0x65, 0x67, 0x65, 0x72, 0x20, 0xB2, 0x02, 0x68, 0x20, 0x42, 0x6F, 0x78, 0x20, 0x36, 0xFE, 0x00,
+    0x09, 0x47, 0x00, 0x40, 0x5F, 0x68, 0x69, 0x6E, 0x20, 0x0A, 0x83, 0x22, 0x75, 0x6E, 0x69, 0x74,
+    0x3A, 0x73, 0x22, 0xB3, 0x00, 0x03, 0x94, 0x02, 0x0F, 0x2D, 0x09, 0x09, 0x1E, 0x37, 0x81, 0x00,
+    0x04, 0x7F, 0x02, 0x02, 0xA1, 0x05, 0x08, 0x74, 0x00, 0x0B, 0x94, 0x01, 0xF0, 0x22, 0x55, 0x6E,
+    0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x20, 0x63, 0x6F, 0x6E, 0x74,
+    0x72, 0x6F, 0x6C, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+    0x20, 0x28, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x20, 0x61, 0x74, 0x74, 0x65, 0x6E, 0x14,
+    0x00, 0x1F, 0x29, 0x9D, 0x00, 0x18, 0x1F, 0x38, 0x9D, 0x00, 0x07, 0x01, 0x60, 0x03, 0x0E, 0x1F,
+    0x00, 0x04, 0x3D, 0x01, 0x03, 0xC1, 0x03, 0x11, 0x53, 0x14, 0x0B, 0xA1, 0x20, 0x50, 0x61, 0x79,
+    0x6C, 0x6F, 0x61, 0x64, 0x20, 0x49, 0xB6, 0x05, 0x07, 0x36, 0x00, 0x00, 0x46, 0x00, 0x0F, 0xE1,
+    0x09, 0x1D, 0x12, 0x70, 0x4D, 0x00, 0x11, 0x5F, 0xC1, 0x03, 0x14, 0x31, 0xCE, 0x00, 0x01, 0x0A,
+    0x03, 0x06, 0x5A, 0x00, 0x08, 0x73, 0x01, 0x00, 0x1B, 0x00, 0x20, 0x22, 0x69, 0x17, 0x0A, 0x04,
+    0x9E, 0x00, 0x09, 0x43, 0x00, 0x1F, 0x32, 0x43, 0x00, 0x2F, 0x19, 0x33, 0x43, 0x00, 0x03, 0xFD,
+    0x01, 0x20, 0x20, 0x20, 0x3D, 0x05, 0x00, 0x7D, 0x00, 0x0F, 0x07, 0x02, 0x10, 0x16, 0x39, 0xBB,
+    0x00, 0x13, 0x22, 0xE6, 0x01, 0x04, 0x07, 0x02, 0x00, 0x24, 0x01, 0x0F, 0x05, 0x02, 0x08, 0x0A,
+    0x6A, 0x01, 0x4A, 0x53, 0x61, 0x6D, 0x70, 0xF6, 0x06, 0x00, 0x3F, 0x00, 0x0F, 0x63, 0x01, 0x1D,
+    0xF0, 0x04, 0x30, 0x31, 0x5F, 0x74, 0x65, 0x73, 0x74, 0x5F, 0x66, 0x63, 0x5F, 0x73, 0x75, 0x62,
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x3B, 0x02, 0x09, 0xE6, 0x00, 0x06, 0xB1, 0x00, 0x0F, 0x6C, 0x01,
+    0x0B, 0x22, 0x30, 0x32, 0x4C, 0x00, 0x50, 0x77, 0x61, 0x79, 0x70, 0x6F, 0x35, 0x03, 0x1F, 0x76,
+    0x71, 0x01, 0x23, 0x2C, 0x30, 0x33, 0x48, 0x00, 0x0A, 0x76, 0x01, 0x0F, 0x90, 0x00, 0x16, 0x12,
+    0x34, 0x48, 0x00, 0x02, 0x36, 0x03, 0xFF, 0x06, 0x5F, 0x63, 0x74, 0x72, 0x6C, 0x5F, 0x74, 0x61,
+    0x6B, 0x65, 0x6F, 0x66, 0x66, 0x5F, 0x6C, 0x61, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0xE8, 0x00, 0x23,
+    0x1E, 0x35, 0x58, 0x00, 0x40, 0x70, 0x6F, 0x73, 0x69, 0x39, 0x01, 0x01, 0x66, 0x00, 0x0F, 0x56,
+    0x00, 0x23, 0x1E, 0x36, 0x56, 0x00, 0x5F, 0x66, 0x6F, 0x72, 0x63, 0x65, 0xAC, 0x00, 0x2B, 0x1E,
+    0x37, 0x56, 0x00, 0x8F, 0x76, 0x65, 0x6C, 0x6F, 0x63, 0x69, 0x74, 0x79, 0xAC, 0x00, 0x28, 0x1E,
+    0x38, 0x56, 0x00, 0x20, 0x61, 0x72, 0x8F, 0x04, 0x4F, 0x5F, 0x66, 0x6C, 0x79, 0x58, 0x01, 0x26,
+    0x1E, 0x39, 0x56, 0x00, 0xDF, 0x73, 0x65, 0x74, 0x5F, 0x67, 0x65, 0x74, 0x5F, 0x70, 0x61, 0x72,
+    0x61, 0x6D, 0x58, 0x01, 0x22, 0x22, 0x31, 0x30, 0x56, 0x00, 0x8F, 0x68, 0x6D, 0x73, 0x5F, 0x69,
+    0x6E, 0x66, 0x6F, 0x45, 0x00, 0x23, 0xFF, 0x0B, 0x31, 0x5F, 0x67, 0x69, 0x6D, 0x62, 0x61, 0x6C,
+    0x5F, 0x6D, 0x61, 0x6E, 0x61, 0x67, 0x65, 0x72, 0x5F, 0x66, 0x72, 0x65, 0x65, 0x5F, 0x6D, 0x6F,
+    0x64, 0x65, 0x50, 0x00, 0x23, 0x1C, 0x32, 0x50, 0x00, 0xAF, 0x79, 0x61, 0x77, 0x5F, 0x66, 0x6F,
+    0x6C, 0x6C, 0x6F, 0x77, 0x56, 0x00, 0x28, 0x03, 0x39, 0x03, 0x8F, 0x6C, 0x69, 0x76, 0x65, 0x76,
+    0x69, 0x65, 0x77, 0x9B, 0x00, 0x23, 0x03, 0x36, 0x03, 0x5F, 0x70, 0x65, 0x72, 0x63, 0x65, 0x0D,
+    0x04, 0x27, 0x13, 0x31, 0x25, 0x03, 0x00, 0xC1, 0x01, 0x04, 0x85, 0x05, 0x45, 0x61, 0x6C, 0x69,
+    0x61, 0x32, 0x07, 0x09, 0x2F, 0x05, 0x00, 0x0D, 0x00, 0x15, 0x7B, 0x4E, 0x05, 0x00, 0x0E, 0x00,
+    0x0A, 0xC7, 0x05, 0x13, 0x31, 0x1D, 0x03, 0xB0, 0x63, 0x61, 0x6D, 0x6D, 0x67, 0x72, 0x2D, 0x73,
+    0x65, 0x74, 0x2F, 0x16, 0x02, 0xDF, 0x73, 0x68, 0x75, 0x74, 0x74, 0x65, 0x72, 0x5F, 0x73, 0x70,
+    0x65, 0x65, 0x64, 0xEE, 0x00, 0x23, 0x03, 0x20, 0x03, 0x0B, 0x59, 0x00, 0x7F, 0x61, 0x70, 0x65,
+    0x72, 0x74, 0x75, 0x72, 0xDD, 0x01, 0x24, 0x03, 0x1E, 0x03, 0x0B, 0x54, 0x00, 0x2F, 0x65, 0x76,
+    0xA2, 0x00, 0x23, 0x03, 0x16, 0x03, 0x0B, 0x4E, 0x00, 0x2F, 0x69, 0x73, 0xCA, 0x02, 0x23, 0x13,
+    0x32, 0x0F, 0x03, 0x03, 0x4F, 0x00, 0x61, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x5F, 0xAF, 0x05, 0x0F,
+    0x9E, 0x00, 0x22, 0x13, 0x32, 0x40, 0x06, 0x03, 0x4F, 0x00, 0x7F, 0x74, 0x61, 0x70, 0x5F, 0x7A,
+    0x6F, 0x6F, 0xAA, 0x03, 0x23, 0x13, 0x32, 0x40, 0x06, 0x03, 0x4C, 0x00, 0x7F, 0x6F, 0x70, 0x74,
+    0x69, 0x63, 0x61, 0x6C, 0x50, 0x00, 0x28, 0x03, 0x0F, 0x03, 0x03, 0x50, 0x00, 0xBF, 0x73, 0x69,
+    0x6E, 0x67, 0x6C, 0x65, 0x5F, 0x70, 0x68, 0x6F, 0x74, 0x3B, 0x01, 0x24, 0x03, 0x1A, 0x03, 0x03,
+    0x50, 0x00, 0x5F, 0x62, 0x75, 0x72, 0x73, 0x74, 0x4F, 0x00, 0x29, 0x03, 0x22, 0x03, 0x03, 0x4F,
+    0x00, 0x01, 0x6F, 0x0D, 0x3F, 0x76, 0x61, 0x6C, 0x52, 0x00, 0x29, 0x0A, 0x26, 0x03, 0x31, 0x72,
+    0x65, 0x63, 0xDE, 0x13, 0x5F, 0x5F, 0x76, 0x69, 0x64, 0x65, 0xF3, 0x00, 0x24, 0x0A, 0x1F, 0x03,
+    0xA0, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x5F, 0x64, 0x6F, 0x77, 0x6E, 0xE5, 0x09, 0x0F, 0x31, 0x02,
+    0x23, 0x0A, 0x1D, 0x03, 0xB9, 0x74, 0x68, 0x65, 0x72, 0x6D, 0x6F, 0x6D, 0x65, 0x74, 0x72, 0x79,
+    0x4F, 0x00, 0x05, 0x0C, 0x04, 0x0F, 0x5A, 0x09, 0x18, 0x1F, 0x31, 0x12, 0x16, 0x29, 0x34, 0x52,
+    0x75, 0x6E, 0x81, 0x00, 0x0F, 0xC5, 0x09, 0x10, 0x1F, 0x31, 0xFA, 0x14, 0x27, 0x0A, 0xC6, 0x09,
+    0x40, 0x45, 0x72, 0x72, 0x63, 0x45, 0x06, 0x06, 0xD4, 0x08, 0x1F, 0x22, 0xC7, 0x09, 0x22, 0x94,
+    0x78, 0x31, 0x45, 0x30, 0x32, 0x30, 0x30, 0x30, 0x30, 0xC5, 0x00, 0x00, 0x44, 0x05, 0x05, 0xC9,
+    0x00, 0x00, 0x0D, 0x00, 0x0F, 0x5F, 0x05, 0x09, 0x14, 0x30, 0x3F, 0x00, 0x0F, 0x65, 0x0B, 0x23,
+    0x05, 0x3F, 0x00, 0x0F, 0xF0, 0x09, 0x24, 0x04, 0x7E, 0x00, 0x0F, 0xE7, 0x09, 0x24, 0x04, 0x3F,
+    0x00, 0x19, 0x34, 0xFC, 0x00, 0x0F, 0x42, 0x02, 0x22, 0x0F, 0xF6, 0x13, 0x08, 0x00, 0x97, 0x01,
+    0x0F, 0x9D, 0x0B, 0x16, 0x88, 0x45, 0x72, 0x72, 0x4C, 0x65, 0x76, 0x65, 0x6C, 0x31, 0x00, 0x00,
+    0x41, 0x00, 0x0F, 0x9F, 0x0B, 0x1D, 0x70, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x6C, 0x4B, 0x00,
+    0x0F, 0xDA, 0x01, 0x23, 0x07, 0x41, 0x00, 0x0F, 0xDC, 0x01, 0x23, 0x07, 0x41, 0x00, 0x0F, 0xDE,
+    0x01, 0x23, 0x07, 0x41, 0x00, 0x0F, 0xE0, 0x01, 0x23, 0x07, 0x41, 0x00, 0x0F, 0xE2, 0x01, 0x30,
+    0x0F, 0x47, 0x14, 0x08, 0x02, 0x5D, 0x19, 0x08, 0xB3, 0x01, 0x03, 0xA0, 0x0D, 0x04, 0x4D, 0x0E,
+    0x64, 0x49, 0x6E, 0x6A, 0x65, 0x63, 0x74, 0x66, 0x02, 0x05, 0x5E, 0x03, 0x06, 0x5A, 0x03, 0x04,
+    0xD1, 0x0D, 0x01, 0xB1, 0x0E, 0x00, 0x90, 0x1B, 0x0F, 0x73, 0x12, 0x29, 0x85, 0x45, 0x6C, 0x69,
+    0x6D, 0x69, 0x6E, 0x61, 0x74, 0x85, 0x08, 0x02, 0xFF, 0x11, 0x70, 0x5D, 0x0A, 0x20, 0x20, 0x7D,
+    0x0A, 0x7D, 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48,
+    0x44, 0x52, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2,
+    0x98, 0x77, 0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9,
+    0x00, 0x00, 0x08, 0x13, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x3D, 0x6F, 0x14, 0x47,
+    0x18, 0xC7, 0xCF, 0x6F, 0x98, 0x84, 0x18, 0x04, 0xB2, 0xD2, 0x44, 0x89, 0x84, 0x15, 0x0B, 0x24,
+    0x8B, 0x86, 0x32, 0x1F, 0xC0, 0x20, 0x45, 0xF9, 0x18, 0x40, 0x4D, 0x81, 0x42, 0x50, 0xAA, 0x28,
+    0x05, 0xD4, 0xA9, 0x02, 0x5F, 0x80, 0x92, 0xC2, 0x29, 0xB0, 0xD2, 0xA6, 0x8A, 0x28, 0x23, 0x41,
+    0x83, 0x95, 0x14, 0x96, 0x90, 0x10, 0x28, 0x26, 0xE4, 0x05, 0x7C, 0x38, 0xF3, 0x1B, 0xF6, 0xBF,
+    0x1A, 0xCF, 0xED, 0xEE, 0xDD, 0xEE, 0x3D, 0xF6, 0xEE, 0xF9, 0x66, 0xA4, 0xF1, 0xBC, 0x3E, 0xCF,
+    0xCE, 0xFE, 0xFE, 0x33, 0xFB, 0x18, 0x9D, 0xB9, 0x9D, 0xE9, 0x55, 0xA7, 0x99, 0x68, 0x38, 0x6E,
+    0x47, 0xC3, 0xBD, 0x61, 0xE3, 0xF1, 0xFC, 0x49, 0x6D, 0xEF, 0x0D, 0x59, 0x78, 0x3C, 0x1E, 0xB7,
+    0x73, 0xF3, 0x32, 0x60, 0xEA, 0x57, 0x89, 0x81, 0xEA, 0x94, 0xAA, 0x87, 0xFD, 0xD4, 0xA7, 0x31,
+    0x85, 0x70, 0xA9, 0xAB, 0xAD, 0x12, 0x26, 0xAA, 0xAB, 0xCC, 0x39, 0xCD, 0xE7, 0xB5, 0xF7, 0x15,
+    0x81, 0x0D, 0x4B, 0x01, 0x8F, 0x4B, 0x2C, 0xD4, 0x17, 0xB9, 0x99, 0xAA, 0x26, 0x50, 0x05, 0x56,
+    0xF5, 0xB8, 0x8C, 0x81, 0x68, 0x7E, 0xE1, 0x4E, 0x16, 0xD4, 0xB0, 0x9C, 0x75, 0x1E, 0x94, 0xE9,
+    0xA7, 0xAE, 0x71, 0x9C, 0x53, 0x9F, 0xC6, 0x24, 0x90, 0x02, 0xFE, 0xCE, 0x41, 0xA0, 0x4E, 0xA9,
+    0xAC, 0xB1, 0xB0, 0x84, 0x15, 0xED, 0x5E, 0xD1, 0x09, 0x10, 0x58, 0x01, 0x9F, 0x73, 0xF3, 0xA8,
+    0xC7, 0x65, 0x28, 0x04, 0xBE, 0x48, 0xD3, 0x22, 0x84, 0x87, 0xF7, 0xFE, 0x96, 0x73, 0xE0, 0xF4,
+    0x01, 0xBD, 0x5F, 0x52, 0x32, 0xA6, 0x94, 0xDB, 0x4B, 0x00, 0x41, 0x57, 0x29, 0xE0, 0x40, 0x27,
+    0x2F, 0x64, 0x25, 0xF3, 0xD5, 0x27, 0x81, 0x64, 0xE3, 0x86, 0x7C, 0x3A, 0xEA, 0x22, 0xE4, 0xF0,
+    0xDC, 0xDD, 0x52, 0x17, 0x78, 0xC1, 0x47, 0x80, 0x5D, 0x97, 0x29, 0xDF, 0xBA, 0x0C, 0x0F, 0xEA,
+    0xA4, 0x50, 0x04, 0xDA, 0x7B, 0x12, 0x80, 0x06, 0x89, 0xC9, 0x21, 0x7C, 0xC0, 0xC7, 0x19, 0x1B,
+    0x09, 0x11, 0x8A, 0xE0, 0xBA, 0xA7, 0xEE, 0x04, 0xC4, 0xF0, 0x01, 0x4F, 0x06, 0x3C, 0x19, 0x3E,
+    0x94, 0x61, 0x42, 0x84, 0x5C, 0x44, 0x40, 0x6A, 0x07, 0xAB, 0x94, 0x00, 0x80, 0x3F, 0x96, 0xE5,
+    0xC5, 0xA0, 0x4E, 0x9F, 0x4E, 0x84, 0x1E, 0x4B, 0xB2, 0x75, 0x43, 0x53, 0x93, 0xC2, 0xDD, 0xCF,
+    0x0E, 0xD7, 0x8E, 0x7F, 0xE3, 0xEA, 0xCA, 0xB0, 0x84, 0x8D, 0x92, 0x6C, 0xC2, 0xBE, 0x7C, 0xD7,
+    0x23, 0x06, 0x70, 0x4F, 0xB8, 0x7C, 0xCA, 0xE5, 0x8F, 0x5D, 0xFE, 0xD4, 0xE5, 0x55, 0x97, 0x2F,
+    0x5C, 0xBB, 0x76, 0xED, 0xAB, 0xA7, 0x4F, 0x9F, 0x6E, 0xEC, 0xEC, 0xEC, 0x6C, 0xED, 0xED, 0xED,
+    0xF5, 0x5D, 0x4E, 0x69, 0x3F, 0x81, 0x3E, 0x6C, 0x60, 0x04, 0x2B, 0x98, 0x65, 0xEC, 0x60, 0x08,
+    0x4B, 0x98, 0xC2, 0x16, 0xC6, 0xB0, 0xCE, 0xC5, 0x41, 0x0D, 0x1A, 0xEC, 0xEA, 0xE3, 0x2E, 0x2F,
+    0xB9, 0xBC, 0xEC, 0xF2, 0x27, 0x2E, 0x7F, 0xEE, 0xF2, 0x85, 0x07, 0x0F, 0x1E, 0x7C, 0xBD, 0xBB,
+    0xBB, 0xFB, 0x7A, 0xFF, 0xF5, 0x52, 0xAB, 0x8C, 0x00, 0xAC, 0x60, 0x06, 0xBB, 0x8C, 0x21, 0x2C,
+    0x61, 0x0A, 0x5B, 0x18, 0xC3, 0xDA, 0x0B, 0x10, 0x3E, 0x42, 0xE8, 0x50, 0xC0, 0x65, 0x02, 0x8F,
+    0x9D, 0xE3, 0x4E, 0xCD, 0x95, 0xEB, 0xD7, 0xAF, 0xFF, 0x30, 0x37, 0x37, 0xF7, 0xA1, 0x6B, 0xA7,
+    0x34, 0x02, 0x81, 0xD9, 0xD9, 0xD9, 0x85, 0xD5, 0xD5, 0xD5, 0x2F, 0x9E, 0x3D, 0x7B, 0xF6, 0xF3,
+    0xA3, 0x47, 0x8F, 0x76, 0x9C, 0x89, 0x02, 0x34, 0xA5, 0x62, 0x80, 0x8F, 0x03, 0xDA, 0xFD, 0x94,
+    0x1C, 0x0B, 0xC0, 0x73, 0x44, 0x3E, 0x70, 0x19, 0xE0, 0x27, 0xDC, 0x91, 0xFA, 0xFE, 0xEC, 0xD9,
+    0xB3, 0x5F, 0xBA, 0x7A, 0x4A, 0x35, 0x09, 0x6C, 0x6D, 0x6D, 0xFD, 0xB4, 0xB2, 0xB2, 0xF2, 0xAD,
+    0x33, 0x7B, 0xED, 0xF2, 0xDF, 0x2E, 0xFF, 0xE3, 0x32, 0xF1, 0x81, 0xC0, 0x4C, 0xB0, 0xDE, 0x63,
+    0xD7, 0x93, 0x10, 0x40, 0x62, 0xE8, 0xD7, 0x4C, 0x1F, 0x13, 0x96, 0x97, 0x97, 0xD7, 0xFC, 0x8C,
+    0xF4, 0xA3, 0x36, 0x81, 0x8C, 0x9D, 0x9E, 0xF9, 0xE2, 0xEA, 0x1F, 0x3D, 0x19, 0x6F, 0xFF, 0x1C,
+    0xC2, 0xB1, 0x04, 0x08, 0x45, 0xF0, 0x27, 0x62, 0x69, 0x69, 0xE9, 0xB3, 0xDA, 0x57, 0x4E, 0x06,
+    0x9E, 0x40, 0xC6, 0x8E, 0xA7, 0x0A, 0x2C, 0xC3, 0xC7, 0xBD, 0x78, 0xE7, 0x02, 0x08, 0x99, 0x06,
+    0x14, 0x0F, 0x64, 0xA4, 0xF1, 0x54, 0xD6, 0x23, 0x10, 0x73, 0x14, 0xDF, 0xDC, 0x8B, 0x1E, 0x41,
+    0x74, 0x68, 0x90, 0x3E, 0x65, 0x04, 0x48, 0x69, 0x3C, 0x02, 0xDA, 0xC4, 0x62, 0x2A, 0xCE, 0xDE,
+    0x2B, 0x9D, 0x74, 0x90, 0xC2, 0x92, 0x7A, 0x38, 0xE6, 0x27, 0xA4, 0x1F, 0x8D, 0x08, 0x84, 0x2C,
+    0x43, 0xC6, 0x38, 0x9B, 0x01, 0x32, 0x69, 0x60, 0x20, 0xEB, 0xD3, 0xB8, 0x9F, 0x94, 0x7E, 0x34,
+    0x22, 0xA0, 0x8D, 0x5C, 0xC4, 0x78, 0x20, 0x06, 0x70, 0x05, 0x4D, 0x6C, 0x74, 0xB5, 0x64, 0x54,
+    0x49, 0x60, 0x80, 0x6D, 0xD9, 0x0E, 0x67, 0xA2, 0x72, 0xA5, 0xC7, 0x34, 0x38, 0x94, 0x80, 0x38,
+    0x0E, 0xC0, 0xC7, 0xB2, 0x4C, 0x80, 0xA1, 0x5E, 0xD3, 0x04, 0x1B, 0x02, 0x49, 0x00, 0x1B, 0x8E,
+    0x8D, 0xBD, 0x24, 0x01, 0x1A, 0xA3, 0xB3, 0x31, 0x4C, 0x02, 0xD8, 0x70, 0x6C, 0xEC, 0x25, 0x09,
+    0xD0, 0x18, 0x9D, 0x8D, 0x61, 0x12, 0xC0, 0x86, 0x63, 0x63, 0x2F, 0x49, 0x80, 0xC6, 0xE8, 0x6C,
+    0x0C, 0x93, 0x00, 0x36, 0x1C, 0x1B, 0x7B, 0x99, 0x28, 0x01, 0x1E, 0x3E, 0x7C, 0xD8, 0xF8, 0x46,
+    0x8B, 0x0C, 0xAD, 0xFD, 0x15, 0x5D, 0x63, 0x58, 0xDF, 0xC4, 0x08, 0xF0, 0xE4, 0xC9, 0x93, 0xDE,
+    0xBD, 0x7B, 0xF7, 0x86, 0xDD, 0xCF, 0xC8, 0xE3, 0xD6, 0xFE, 0x46, 0xBE, 0x70, 0x34, 0x71, 0x22,
+    0x04, 0x78, 0xF9, 0xF2, 0x65, 0xEF, 0xF6, 0xED, 0xDB, 0xBD, 0xB7, 0x6F, 0xF9, 0x24, 0x6F, 0xFC,
+    0x64, 0xED, 0x6F, 0x9C, 0x15, 0x75, 0x5E, 0x00, 0xF7, 0x17, 0x06, 0x1E, 0xFE, 0x8B, 0x17, 0x2F,
+    0xC6, 0xB9, 0xCF, 0xDC, 0xD6, 0xDA, 0x5F, 0xEE, 0xB8, 0x61, 0xA5, 0xF3, 0x02, 0xDC, 0xBD, 0x7B,
+    0xB7, 0xF7, 0xF8, 0xF1, 0xE3, 0x86, 0xB7, 0x37, 0x68, 0x66, 0xED, 0x6F, 0xF0, 0x0A, 0xF5, 0x7A,
+    0x3A, 0x2D, 0x00, 0x41, 0xD2, 0x32, 0x50, 0x5A, 0xFB, 0xAB, 0x87, 0xBA, 0x78, 0x76, 0x67, 0x05,
+    0xB0, 0x0E, 0x92, 0xD6, 0xFE, 0x8A, 0x71, 0xD6, 0xEF, 0xED, 0xA4, 0x00, 0xD6, 0x41, 0xD2, 0xDA,
+    0x5F, 0x7D, 0xCC, 0xE5, 0x16, 0x9D, 0x13, 0xC0, 0x3A, 0x48, 0x5A, 0xFB, 0x2B, 0x47, 0xD9, 0x6C,
+    0xA4, 0x73, 0x02, 0x58, 0x07, 0x49, 0x6B, 0x7F, 0xCD, 0x30, 0x97, 0x5B, 0x75, 0x4A, 0x80, 0xCD,
+    0xCD, 0x4D, 0xD3, 0xA0, 0x6B, 0xED, 0xAF, 0x1C, 0x63, 0xF3, 0x91, 0xCE, 0x08, 0x40, 0x90, 0x64,
+    0xB7, 0x5A, 0x25, 0x6B, 0x7F, 0x56, 0xEB, 0x8A, 0xFD, 0x74, 0x42, 0x00, 0xEB, 0x20, 0x69, 0xED,
+    0x2F, 0x86, 0x66, 0xD9, 0x6E, 0x5D, 0x00, 0xEB, 0x20, 0x69, 0xED, 0xCF, 0x12, 0x76, 0x91, 0xAF,
+    0xD6, 0x05, 0xB0, 0x0E, 0x92, 0xD6, 0xFE, 0x8A, 0xA0, 0x59, 0xF6, 0xB5, 0x2A, 0x80, 0x75, 0x90,
+    0xB4, 0xF6, 0x67, 0x09, 0xBA, 0xCC, 0x57, 0x6B, 0x02, 0x58, 0x07, 0x49, 0x6B, 0x7F, 0x65, 0xC0,
+    0xAC, 0xFB, 0x5B, 0x11, 0xC0, 0x3A, 0x48, 0x5A, 0xFB, 0xB3, 0x86, 0x5C, 0xE5, 0xEF, 0xD0, 0x05,
+    0xB0, 0x0E, 0x92, 0xD6, 0xFE, 0xAA, 0x60, 0x1D, 0xC4, 0xD8, 0xA1, 0x0B, 0x60, 0x1D, 0x24, 0xAD,
+    0xFD, 0x1D, 0x04, 0xE4, 0x2A, 0x9F, 0x87, 0x2E, 0xC0, 0xCC, 0x4C, 0xE1, 0xDF, 0xA8, 0x56, 0xAD,
+    0xB1, 0x72, 0xCC, 0xDA, 0x5F, 0xE5, 0xC5, 0x0E, 0x60, 0xF0, 0xD0, 0x05, 0xB8, 0x72, 0xE5, 0x4A,
+    0xEF, 0xFC, 0xF9, 0xF3, 0x66, 0xB7, 0x62, 0xED, 0xCF, 0x6C, 0x61, 0x23, 0x3A, 0x3A, 0x74, 0x01,
+    0xE6, 0xE7, 0xE7, 0x7B, 0x37, 0x6F, 0xDE, 0xEC, 0x9D, 0x39, 0x73, 0x66, 0xC4, 0x25, 0x56, 0x4F,
+    0xB3, 0xF6, 0x57, 0x7D, 0x35, 0xFB, 0xD1, 0x43, 0x17, 0x80, 0x5B, 0x38, 0x7D, 0xFA, 0xB4, 0x17,
+    0x61, 0x61, 0x81, 0xFF, 0x40, 0x38, 0x7E, 0xB2, 0xF6, 0x37, 0xFE, 0x8A, 0x46, 0xF7, 0xD0, 0x8A,
+    0x00, 0x2C, 0xEF, 0xDC, 0xB9, 0x73, 0xBD, 0xAB, 0x57, 0xAF, 0x8E, 0xBE, 0xD2, 0x21, 0x33, 0xAD,
+    0xFD, 0x0D, 0xB9, 0x9C, 0xD9, 0x70, 0x6B, 0x02, 0x70, 0x07, 0xEB, 0xEB, 0xEB, 0xBD, 0xCB, 0x97,
+    0x2F, 0x9B, 0xDD, 0x8C, 0xB5, 0x3F, 0xB3, 0x85, 0x55, 0x38, 0x6A, 0x55, 0x00, 0xD6, 0x65, 0x1D,
+    0x44, 0xAD, 0xFD, 0x55, 0xB0, 0x33, 0x19, 0x6A, 0x5D, 0x00, 0xEB, 0x20, 0x6A, 0xED, 0xCF, 0x84,
+    0x72, 0x85, 0x93, 0xD6, 0x05, 0x60, 0x6D, 0xD6, 0x41, 0xD4, 0xDA, 0x5F, 0x05, 0xBF, 0xB1, 0x87,
+    0x3A, 0x21, 0x00, 0x77, 0x61, 0x1D, 0x44, 0xAD, 0xFD, 0x8D, 0x4D, 0xBA, 0xC4, 0x41, 0x67, 0x04,
+    0x60, 0x7D, 0x04, 0xD1, 0x4B, 0x97, 0x2E, 0x95, 0x2C, 0xB5, 0x7E, 0xB7, 0xB5, 0xBF, 0xFA, 0x2B,
+    0x18, 0x6E, 0xD1, 0x29, 0x01, 0x58, 0x2E, 0xBF, 0x9A, 0x5A, 0xFE, 0x4B, 0xD9, 0xDA, 0xDF, 0x70,
+    0xA4, 0xF5, 0x66, 0x74, 0x4E, 0x00, 0xEB, 0x20, 0x6A, 0xED, 0xAF, 0x1E, 0xDE, 0xE1, 0xB3, 0x3B,
+    0x27, 0x00, 0x4B, 0xB6, 0x0E, 0xA2, 0xD6, 0xFE, 0x86, 0x63, 0x1D, 0x7D, 0x46, 0x27, 0x05, 0x60,
+    0xF9, 0xD6, 0x41, 0xD4, 0xDA, 0xDF, 0xE8, 0x88, 0xAB, 0x67, 0x76, 0x56, 0x00, 0x96, 0x6D, 0x1D,
+    0x44, 0xAD, 0xFD, 0x55, 0xA3, 0x1D, 0x6D, 0xB4, 0xD3, 0x02, 0x70, 0x0B, 0xD6, 0x41, 0xD4, 0xDA,
+    0xDF, 0x68, 0x98, 0xCB, 0x67, 0x75, 0x5E, 0x00, 0xEB, 0x20, 0x6A, 0xED, 0xAF, 0x1C, 0xED, 0x68,
+    0x23, 0x9D, 0x17, 0x80, 0xDB, 0xB0, 0x0E, 0xA2, 0xD6, 0xFE, 0x46, 0x43, 0x5D, 0x3C, 0x6B, 0x22,
+    0x04, 0x60, 0xE9, 0xD6, 0x41, 0xD4, 0xDA, 0x5F, 0x31, 0xDE, 0xE1, 0xBD, 0x7C, 0x40, 0xCB, 0x97,
+    0xCA, 0x91, 0xF5, 0x6D, 0xB9, 0x7C, 0x61, 0xEB, 0x47, 0x2E, 0x9F, 0x74, 0xF9, 0x94, 0xFB, 0x7A,
+    0xDE, 0x4D, 0x57, 0xA6, 0xD4, 0x90, 0x80, 0xFB, 0xCC, 0x7A, 0xDD, 0x99, 0xFE, 0xE9, 0x32, 0xDF,
+    0xA0, 0xFB, 0x97, 0xCB, 0x7C, 0x81, 0xEB, 0x7F, 0x2E, 0xF3, 0x5F, 0x3E, 0xFB, 0x13, 0x73, 0x02,
+    0xDC, 0x62, 0x8F, 0x64, 0x4A, 0x02, 0xB4, 0x2C, 0x6B, 0x12, 0x20, 0x09, 0xD0, 0x32, 0x81, 0x96,
+    0x2F, 0x9F, 0x4E, 0x40, 0x12, 0xA0, 0x65, 0x02, 0x2D, 0x5F, 0x3E, 0x9D, 0x80, 0x24, 0x40, 0xCB,
+    0x04, 0x5A, 0xBE, 0x7C, 0xD9, 0x09, 0xD0, 0xDB, 0x7E, 0xFC, 0x6B, 0x36, 0x5A, 0x5E, 0xE3, 0xA4,
+    0x5F, 0xBE, 0x92, 0x65, 0x91, 0x00, 0x09, 0xFA, 0xC1, 0x49, 0x3E, 0xC0, 0x56, 0x02, 0x68, 0x20,
+    0x2C, 0xA9, 0xF3, 0xC2, 0x99, 0x94, 0xC6, 0x23, 0xB0, 0xEF, 0xA5, 0x3D, 0xCE, 0x55, 0xC8, 0xD8,
+    0x7F, 0x77, 0xF4, 0xBE, 0x8E, 0x6C, 0x82, 0xE0, 0x6B, 0x6C, 0xBC, 0x25, 0x4C, 0xB7, 0x75, 0xC8,
+    0x52, 0x3C, 0xF3, 0x52, 0x27, 0x00, 0x44, 0x74, 0x6A, 0x32, 0xAA, 0x91, 0x79, 0x3B, 0x5C, 0x4A,
+    0xE3, 0x11, 0x80, 0xA1, 0x78, 0xC6, 0xA7, 0x61, 0xE0, 0xDB, 0xD3, 0x43, 0x11, 0x30, 0x94, 0xF1,
+    0x78, 0x4B, 0x98, 0x5E, 0x6B, 0x6D, 0x62, 0x71, 0x14, 0xDF, 0x9C, 0x88, 0x4E, 0x80, 0x06, 0x74,
+    0x02, 0x30, 0xF0, 0x2F, 0xA5, 0x7C, 0xF5, 0xEA, 0xD5, 0x1F, 0xF9, 0xEC, 0x54, 0xA9, 0x45, 0x20,
+    0x63, 0xA7, 0x77, 0x86, 0xC5, 0x22, 0xC0, 0x3A, 0x3F, 0x01, 0x12, 0x20, 0x54, 0x0C, 0x01, 0xDE,
+    0x3C, 0x7F, 0xFE, 0xFC, 0xB7, 0x5A, 0x57, 0x4D, 0x93, 0x73, 0x02, 0x19, 0x3B, 0x5E, 0xDC, 0x06,
+    0x4B, 0x04, 0x88, 0x45, 0xC8, 0x05, 0xC0, 0x48, 0xBB, 0x1F, 0x11, 0xFC, 0xEE, 0x77, 0xE5, 0x9B,
+    0x3B, 0x77, 0xEE, 0xFC, 0xD8, 0xEF, 0xF7, 0xF9, 0x10, 0x21, 0xA5, 0x1A, 0x04, 0x60, 0x06, 0x3B,
+    0x67, 0x12, 0xBE, 0x39, 0x0F, 0xB6, 0x64, 0xBF, 0xFB, 0x71, 0x17, 0xBE, 0xA6, 0x2A, 0x7C, 0xD5,
+    0x06, 0x8F, 0x26, 0xDA, 0xB3, 0xEE, 0x5D, 0x88, 0xAF, 0x2F, 0x5E, 0xBC, 0xB8, 0xCD, 0xBB, 0x11,
+    0x79, 0x47, 0x22, 0x46, 0x29, 0x55, 0x13, 0x00, 0xFE, 0xC6, 0xC6, 0xC6, 0x77, 0x37, 0x6E, 0xDC,
+    0xF8, 0xD5, 0xCD, 0xE4, 0xD3, 0x2F, 0x7D, 0x02, 0xE6, 0x3F, 0x05, 0x73, 0xED, 0x5C, 0x08, 0x04,
+    0x08, 0xC1, 0xBB, 0x66, 0x7E, 0x2A, 0xE8, 0xF7, 0xE9, 0xFE, 0xFD, 0xFB, 0x5B, 0xBC, 0x98, 0x72,
+    0x6D, 0x6D, 0xED, 0xA4, 0xFB, 0xAB, 0x82, 0x63, 0x8B, 0x8B, 0x8B, 0x7C, 0x5C, 0x99, 0x8F, 0x67,
+    0xD3, 0xA6, 0xBD, 0x78, 0xE7, 0x9E, 0xF9, 0xBF, 0x6F, 0x6F, 0x6F, 0xFF, 0x72, 0xEB, 0xD6, 0xAD,
+    0x6F, 0x32, 0xF8, 0xFF, 0x3A, 0x28, 0xC0, 0xE7, 0x14, 0x90, 0xF5, 0x18, 0xD2, 0x23, 0x7F, 0x1F,
+    0x7C, 0xBF, 0xE3, 0xDD, 0x24, 0x44, 0x09, 0x5F, 0xEC, 0xC9, 0xBB, 0x10, 0xD3, 0x0B, 0x9D, 0x1D,
+    0x84, 0x28, 0x09, 0x22, 0xBB, 0x59, 0x60, 0xD9, 0xE1, 0x82, 0x4D, 0x19, 0xC2, 0x2F, 0x0C, 0xC6,
+    0x80, 0xCE, 0x9F, 0x47, 0x59, 0x5D, 0x0E, 0x5D, 0xD3, 0x27, 0xC6, 0xE9, 0x53, 0x5C, 0xC0, 0x69,
+    0xF8, 0x6E, 0x44, 0x3D, 0xAE, 0x98, 0x3C, 0x2D, 0xA7, 0x42, 0xCC, 0xC4, 0x46, 0xCC, 0x60, 0x24,
+    0x4E, 0x00, 0x0F, 0x73, 0x1C, 0x80, 0xB1, 0x1D, 0x78, 0xA7, 0xBC, 0x1C, 0xBA, 0xB1, 0x3C, 0xE1,
+    0x3C, 0x14, 0x80, 0x13, 0x42, 0x06, 0xBC, 0xE0, 0x87, 0xE0, 0xC3, 0xBA, 0x9B, 0x72, 0xE4, 0x92,
+    0xE0, 0x73, 0x63, 0x1E, 0xA2, 0x2B, 0xC5, 0x48, 0x27, 0x01, 0x11, 0xA8, 0x23, 0x80, 0xFA, 0x42,
+    0x01, 0x5C, 0xF7, 0xFB, 0xC4, 0x4E, 0x26, 0x85, 0x4E, 0x69, 0xE3, 0x90, 0x14, 0x5E, 0x00, 0xE8,
+    0x38, 0x14, 0x7C, 0x3D, 0xB2, 0x42, 0xE0, 0x61, 0x1D, 0xFB, 0xA3, 0x9A, 0x42, 0x5E, 0xD4, 0xE1,
+    0xA5, 0x52, 0xA0, 0xE3, 0x52, 0x73, 0xC4, 0xD4, 0xFB, 0x08, 0x81, 0xA9, 0x4E, 0x19, 0x67, 0xED,
+    0x76, 0xED, 0x78, 0x95, 0xA1, 0xCD, 0x51, 0x85, 0x5D, 0x75, 0x5F, 0x1E, 0x62, 0x06, 0x5F, 0x02,
+    0xA8, 0xD4, 0xA9, 0xA0, 0x1D, 0x67, 0x7C, 0xD2, 0x37, 0xF0, 0xCC, 0x8E, 0x81, 0xC6, 0x42, 0x84,
+    0x6D, 0xD9, 0xCB, 0x86, 0xF6, 0x34, 0x26, 0xC1, 0xE5, 0xDE, 0x55, 0x2F, 0x2A, 0x35, 0x1E, 0x96,
+    0x03, 0x02, 0x30, 0x48, 0x12, 0x54, 0x95, 0x71, 0x5F, 0x51, 0xBF, 0x37, 0x9C, 0xC2, 0x1F, 0x7E,
+    0x27, 0x67, 0xF7, 0x2D, 0xF0, 0x34, 0xE3, 0xFE, 0xB8, 0xCF, 0x9B, 0x84, 0x20, 0x7D, 0x47, 0xF4,
+    0x23, 0x1E, 0x8F, 0xDB, 0xD1, 0xF4, 0x5C, 0xB8, 0xB8, 0xFF, 0xA8, 0xB5, 0x43, 0xB8, 0x45, 0xF7,
+    0x16, 0x8F, 0xC7, 0xED, 0xDC, 0xE6, 0x7F, 0xAF, 0x38, 0x18, 0xCE, 0x87, 0x25, 0x84, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 0x89, 0x50, 0x4E, 0x47, 0x0D,
+    0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x60, 0x00,
+    0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77, 0x38, 0x00, 0x00, 0x00, 0x01,
+    0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x07, 0xFC, 0x49, 0x44, 0x41,
+    0x54, 0x78, 0x01, 0xED, 0x9D, 0x3D, 0x6F, 0x14, 0x47, 0x18, 0xC7, 0xCF, 0x36, 0xC6, 0x24, 0xC4,
+    0x20, 0x90, 0x95, 0x26, 0x4A, 0x24, 0xAC, 0x58, 0x20, 0x21, 0x1A, 0xCA, 0x7C, 0x00, 0x40, 0x8A,
+    0xF2, 0x31, 0x80, 0x9A, 0x02, 0x85, 0xA0, 0x54, 0x51, 0x0A, 0xA8, 0x53, 0x05, 0xBE, 0x00, 0x25,
+    0x85, 0x53, 0x80, 0xD2, 0xA6, 0x8A, 0x28, 0x23, 0x41, 0x83, 0x95, 0x14, 0x96, 0x90, 0x10, 0x28,
+    0x26, 0xE4, 0x05, 0xDB, 0x38, 0xCF, 0x6F, 0xBC, 0xFF, 0xD5, 0xDC, 0xDC, 0xDA, 0x77, 0xB7, 0xF7,
+    0x58, 0xBB, 0xE7, 0x9D, 0x91, 0xC6, 0xCF, 0xBC, 0x3E, 0x3B, 0xFB, 0xFB, 0xCF, 0xEC, 0x03, 0x9C,
+    0xB9, 0x9D, 0xE9, 0xED, 0x9F, 0x66, 0x92, 0xEE, 0xB4, 0x9E, 0x74, 0xF7, 0x86, 0xF5, 0xA7, 0xE3,
+    0xA7, 0xB5, 0xBE, 0x33, 0x64, 0xE1, 0x69, 0x7F, 0x5A, 0x2F, 0xA7, 0xEF, 0x05, 0x4C, 0xED, 0xB2,
+    0x4C, 0x50, 0x19, 0xAB, 0x72, 0xDC, 0x4E, 0xB9, 0x8B, 0x29, 0x86, 0x4B, 0x59, 0x75, 0x59, 0x98,
+    0xA8, 0x2C, 0x5B, 0x72, 0x3A, 0x52, 0x96, 0x76, 0x0B, 0x02, 0x1B, 0x5B, 0x01, 0x4F, 0x2D, 0x33,
+    0xD4, 0x96, 0xB8, 0xE9, 0x54, 0x15, 0xA8, 0x02, 0xAB, 0x72, 0x6A, 0x53, 0x20, 0x1A, 0x5F, 0xB9,
+    0x93, 0x05, 0x35, 0xB6, 0xB3, 0xE6, 0x41, 0x99, 0x76, 0xCA, 0xEA, 0xC7, 0x39, 0xE5, 0x2E, 0x26,
+    0x81, 0x14, 0xF0, 0xF7, 0x06, 0x81, 0x32, 0x56, 0x59, 0x7D, 0xB1, 0x85, 0x15, 0xF5, 0x5E, 0xD5,
+    0x09, 0x10, 0x58, 0x01, 0x9F, 0xB3, 0x71, 0x94, 0x53, 0x1B, 0x0B, 0x81, 0x2F, 0x52, 0x57, 0x84,
+    0x08, 0xF0, 0x76, 0x6F, 0xB9, 0x04, 0x4E, 0x1B, 0xD0, 0xB7, 0xF7, 0xB0, 0xF4, 0x29, 0x95, 0xF3,
+    0x25, 0x80, 0xA0, 0xCB, 0x0A, 0x38, 0xD0, 0xC9, 0xF3, 0x85, 0x65, 0xBC, 0xDA, 0x24, 0x90, 0xE6,
+    0x58, 0x57, 0x48, 0x87, 0x5D, 0x84, 0x12, 0x9E, 0xDD, 0x2D, 0x65, 0x81, 0x17, 0x7C, 0x04, 0xD8,
+    0xB2, 0x8C, 0xDD, 0xB4, 0x0C, 0x0F, 0xCA, 0xA4, 0x58, 0x04, 0xEA, 0x3B, 0x12, 0x80, 0x0A, 0x89,
+    0xC1, 0x31, 0x7C, 0xC0, 0xA7, 0x99, 0x39, 0x12, 0x22, 0x16, 0xC1, 0x9A, 0x3B, 0x77, 0x02, 0x52,
+    0xF8, 0x80, 0x27, 0x03, 0x9E, 0x0C, 0x1F, 0x6C, 0x9C, 0x10, 0xA1, 0x14, 0x11, 0x90, 0xDA, 0xC1,
+    0xB2, 0x12, 0x00, 0xF0, 0x47, 0x8B, 0xBC, 0x10, 0x95, 0x69, 0xD3, 0x89, 0xD0, 0x63, 0x49, 0x73,
+    0xAD, 0xAB, 0x33, 0x29, 0xDE, 0xFD, 0xEC, 0x70, 0xED, 0xF8, 0x77, 0x56, 0x56, 0x86, 0x25, 0x6C,
+    0x94, 0x34, 0x27, 0x6E, 0x2B, 0x77, 0x3D, 0x62, 0x00, 0xF7, 0xB8, 0xE5, 0x93, 0x96, 0x3F, 0xB6,
+    0xFC, 0xA9, 0xE5, 0x15, 0xCB, 0x17, 0xAE, 0x5F, 0xBF, 0xFE, 0xD5, 0xF3, 0xE7, 0xCF, 0x57, 0x37,
+    0x36, 0x36, 0xD6, 0x76, 0x76, 0x76, 0xB6, 0x2D, 0xE7, 0xD4, 0x4F, 0x60, 0x1B, 0x36, 0x30, 0x82,
+    0x15, 0xCC, 0x0A, 0x76, 0x30, 0x84, 0x25, 0x4C, 0x61, 0x0B, 0x63, 0x58, 0x97, 0xE2, 0xA0, 0x06,
+    0x15, 0x76, 0xF5, 0x31, 0xCB, 0x8B, 0x96, 0x97, 0x2C, 0x7F, 0x62, 0xF9, 0x73, 0xCB, 0x17, 0x1E,
+    0x3E, 0x7C, 0xF8, 0xF5, 0xD6, 0xD6, 0xD6, 0xDB, 0xFE, 0xEB, 0xE5, 0xDA, 0x5E, 0x04, 0x60, 0x05,
+    0x33, 0xD8, 0x15, 0x0C, 0x61, 0x09, 0x53, 0xD8, 0xC2, 0x18, 0xD6, 0x41, 0x80, 0xF8, 0x11, 0x42,
+    0x83, 0x02, 0x2E, 0x03, 0x78, 0xEC, 0x1C, 0x33, 0x35, 0x97, 0x6F, 0xDC, 0xB8, 0xF1, 0xC3, 0xDC,
+    0xDC, 0xDC, 0x87, 0x56, 0xCF, 0x69, 0x04, 0x02, 0xB3, 0xB3, 0xB3, 0xF3, 0x2B, 0x2B, 0x2B, 0x5F,
+    0xBC, 0x78, 0xF1, 0xE2, 0xE7, 0x27, 0x4F, 0x9E, 0x6C, 0xD8, 0x14, 0x05, 0x68, 0xAC, 0x62, 0x40,
+    0x88, 0x03, 0xDA, 0xFD, 0x58, 0x8E, 0x05, 0xE0, 0x39, 0x22, 0x1F, 0x58, 0x06, 0xF8, 0x71, 0x3B,
+    0x52, 0xDF, 0x9F, 0x39, 0x73, 0xE6, 0x4B, 0x2B, 0xE7, 0x34, 0x26, 0x81, 0xB5, 0xB5, 0xB5, 0x9F,
+    0x96, 0x97, 0x97, 0xBF, 0xB5, 0x69, 0x6F, 0x2D, 0xFF, 0x6D, 0xF9, 0x1F, 0xCB, 0xC4, 0x07, 0x02,
+    0x33, 0xC1, 0x7A, 0x87, 0x5D, 0x4F, 0x42, 0x00, 0x89, 0xA1, 0x3F, 0x66, 0x86, 0x98, 0xB0, 0xB4,
+    0xB4, 0x74, 0x3E, 0x8C, 0xC8, 0x3F, 0xC6, 0x26, 0x50, 0xB0, 0xD3, 0x33, 0x5F, 0x5C, 0xC3, 0xA3,
+    0xA7, 0xE0, 0x1D, 0x9E, 0x43, 0x38, 0x96, 0x00, 0xB1, 0x08, 0xE1, 0x44, 0x2C, 0x2E, 0x2E, 0x7E,
+    0x36, 0xF6, 0x95, 0xF3, 0x84, 0x40, 0xA0, 0x60, 0xC7, 0x53, 0x05, 0x96, 0xF1, 0xE3, 0x5E, 0xBC,
+    0x4B, 0x01, 0x84, 0x4C, 0x1D, 0x8A, 0x07, 0x9A, 0xA4, 0xFE, 0x6C, 0xC7, 0x23, 0x90, 0x72, 0x14,
+    0xDF, 0xD2, 0x8B, 0x1E, 0x41, 0x34, 0xA8, 0x93, 0x36, 0x65, 0x04, 0xC8, 0x69, 0x32, 0x02, 0xDA,
+    0xC4, 0x62, 0x2A, 0xCE, 0xC1, 0x2B, 0x8D, 0x34, 0x90, 0x62, 0x4B, 0x39, 0xEE, 0x0B, 0x03, 0xF2,
+    0x8F, 0x5A, 0x04, 0x62, 0x96, 0x31, 0x63, 0x9C, 0xCD, 0x00, 0x99, 0x34, 0xD0, 0x51, 0xB4, 0xA9,
+    0x3F, 0x0C, 0xCA, 0x3F, 0x6A, 0x11, 0xD0, 0x46, 0xAE, 0x62, 0x3C, 0x10, 0x03, 0xB8, 0x82, 0x06,
+    0xD6, 0xBA, 0x5A, 0x9E, 0xB4, 0x2F, 0x81, 0x01, 0xB6, 0x7B, 0xED, 0x70, 0x06, 0x2A, 0xEF, 0xEB,
+    0x31, 0x77, 0x0E, 0x25, 0x20, 0x8E, 0x03, 0xF0, 0x99, 0xB9, 0x97, 0x00, 0x43, 0xBD, 0xE6, 0x01,
+    0x3E, 0x04, 0xB2, 0x00, 0x3E, 0x1C, 0x6B, 0x7B, 0xC9, 0x02, 0xD4, 0x46, 0xE7, 0x33, 0x31, 0x0B,
+    0xE0, 0xC3, 0xB1, 0xB6, 0x97, 0x2C, 0x40, 0x6D, 0x74, 0x3E, 0x13, 0xB3, 0x00, 0x3E, 0x1C, 0x6B,
+    0x7B, 0xC9, 0x02, 0xD4, 0x46, 0xE7, 0x33, 0x31, 0x0B, 0xE0, 0xC3, 0xB1, 0xB6, 0x97, 0xC6, 0x04,
+    0x78, 0xF4, 0xE8, 0x51, 0xED, 0x45, 0x57, 0x4D, 0xF4, 0xF6, 0x57, 0x75, 0x8D, 0x83, 0x68, 0x6B,
+    0x4C, 0x80, 0xFB, 0xF7, 0xEF, 0xF7, 0x9E, 0x3D, 0x7B, 0xE6, 0x76, 0x4F, 0xDE, 0xFE, 0xDC, 0x16,
+    0x36, 0xC4, 0x51, 0x63, 0x02, 0x6C, 0x6E, 0x6E, 0xF6, 0xEE, 0xDC, 0xB9, 0xD3, 0x7B, 0xFD, 0xFA,
+    0xF5, 0x90, 0x25, 0x8E, 0xD6, 0xED, 0xED, 0x6F, 0xB4, 0xAB, 0x4E, 0x3E, 0xAA, 0x31, 0x01, 0x58,
+    0xFA, 0xAB, 0x57, 0xAF, 0x82, 0x08, 0xF6, 0x5B, 0x04, 0x93, 0xDF, 0xC9, 0x01, 0xF8, 0x73, 0x59,
+    0xD4, 0x10, 0x27, 0x8D, 0x0A, 0xC0, 0xDA, 0x9E, 0x3E, 0x7D, 0xDA, 0xBB, 0x77, 0xEF, 0xDE, 0x90,
+    0x65, 0x8E, 0xDE, 0xED, 0xED, 0x6F, 0xF4, 0x2B, 0xD7, 0x1B, 0xD9, 0xB8, 0x00, 0x2C, 0x9B, 0x00,
+    0xEA, 0x19, 0x44, 0xBD, 0xFD, 0xD5, 0x43, 0x3B, 0xDA, 0xAC, 0x56, 0x08, 0xC0, 0x52, 0xBD, 0x83,
+    0xA8, 0xB7, 0xBF, 0xD1, 0x70, 0x8E, 0x3F, 0xAA, 0x35, 0x02, 0x78, 0x07, 0x51, 0x6F, 0x7F, 0xE3,
+    0xA3, 0x1D, 0x6D, 0x46, 0x6B, 0x04, 0x60, 0xB9, 0x5D, 0x0C, 0xCA, 0xAD, 0x12, 0x00, 0x11, 0xBC,
+    0x83, 0xA8, 0xB7, 0x3F, 0xD6, 0xE8, 0x99, 0x5A, 0x27, 0x00, 0x37, 0x47, 0x10, 0x7D, 0xFC, 0xF8,
+    0xB1, 0xDB, 0x7D, 0x7A, 0xFB, 0x73, 0x5B, 0x98, 0x39, 0x6A, 0xA5, 0x00, 0xDC, 0x20, 0x7F, 0x34,
+    0xF5, 0xFC, 0x9B, 0xB2, 0xB7, 0x3F, 0x2F, 0x11, 0x5A, 0x2B, 0x80, 0x77, 0x10, 0xF5, 0xF6, 0x77,
+    0xE8, 0x05, 0xE0, 0x06, 0xBB, 0x10, 0x94, 0x5B, 0x7B, 0x02, 0xB4, 0xC3, 0xBC, 0x83, 0xA8, 0xB7,
+    0x3F, 0xAD, 0xB3, 0xAE, 0x6D, 0xBD, 0x00, 0xDC, 0x98, 0x77, 0x10, 0xF5, 0xF6, 0x57, 0x17, 0x3E,
+    0xF3, 0xA6, 0x42, 0x00, 0x16, 0xEA, 0x1D, 0x44, 0xBD, 0xFD, 0xB1, 0xC6, 0x3A, 0x69, 0x6A, 0x04,
+    0xF0, 0x0E, 0xA2, 0xDE, 0xFE, 0xEA, 0xC0, 0x67, 0xCE, 0xD4, 0x08, 0xC0, 0x62, 0x0F, 0x63, 0x50,
+    0x9E, 0x2A, 0x01, 0x10, 0xC1, 0x3B, 0x88, 0x7A, 0xFB, 0x63, 0x8D, 0xE3, 0xA4, 0xA9, 0x13, 0x80,
+    0x9B, 0x9B, 0x99, 0xA9, 0xFC, 0x3D, 0xD7, 0x71, 0xEE, 0xBB, 0x6F, 0xAC, 0xB7, 0xBF, 0x3E, 0xE7,
+    0x43, 0x2A, 0x53, 0x27, 0xC0, 0xB9, 0x73, 0xE7, 0x7A, 0x57, 0xAF, 0x5E, 0x1D, 0x72, 0x5B, 0xA3,
+    0x77, 0x7B, 0xFB, 0x1B, 0xFD, 0xCA, 0xBB, 0x23, 0xA7, 0x4A, 0x80, 0xD3, 0xA7, 0x4F, 0xF7, 0x6E,
+    0xDD, 0xBA, 0xD5, 0x3B, 0x72, 0x84, 0xFF, 0xF3, 0x36, 0x79, 0xF2, 0xF6, 0x57, 0x67, 0x45, 0x53,
+    0x23, 0xC0, 0xFC, 0xFC, 0x7C, 0x80, 0x7F, 0xEA, 0xD4, 0xA9, 0x3A, 0xF7, 0x39, 0x30, 0xC7, 0xDB,
+    0xDF, 0xC0, 0x05, 0x46, 0x6C, 0x98, 0x1A, 0x01, 0xAE, 0x5D, 0xBB, 0xD6, 0x3B, 0x7B, 0xF6, 0xEC,
+    0x88, 0xB7, 0x35, 0x7C, 0x98, 0xB7, 0xBF, 0xE1, 0x57, 0xAC, 0x1E, 0x31, 0x15, 0x02, 0x5C, 0xB9,
+    0x72, 0xA5, 0x77, 0xE9, 0xD2, 0xA5, 0xEA, 0x3B, 0xA8, 0xD1, 0xEA, 0xED, 0xAF, 0xC6, 0x12, 0xCA,
+    0x29, 0xAD, 0x17, 0xC0, 0x3B, 0x48, 0x7A, 0xFB, 0x2B, 0x49, 0xD6, 0x2C, 0xB4, 0x5A, 0x00, 0xEF,
+    0x20, 0xE9, 0xED, 0xAF, 0x26, 0xF3, 0xBE, 0x69, 0xAD, 0x15, 0xC0, 0x3B, 0x48, 0x7A, 0xFB, 0xEB,
+    0xA3, 0x38, 0x41, 0xA5, 0xB5, 0x02, 0x78, 0x07, 0x49, 0x6F, 0x7F, 0x13, 0x30, 0xEF, 0x9B, 0xDA,
+    0x4A, 0x01, 0x2E, 0x5F, 0xBE, 0xEC, 0x1A, 0x74, 0xBD, 0xFD, 0xF5, 0x11, 0x9C, 0xB0, 0xD2, 0x3A,
+    0x01, 0x08, 0x92, 0xEC, 0x56, 0xAF, 0xE4, 0xED, 0xCF, 0x6B, 0x5D, 0xF2, 0xD3, 0x2A, 0x01, 0xBC,
+    0x83, 0xA4, 0xB7, 0x3F, 0x41, 0xF3, 0xB4, 0xAD, 0x11, 0xC0, 0x3B, 0x48, 0x7A, 0xFB, 0xF3, 0x84,
+    0x1E, 0xFB, 0x6A, 0x8D, 0x00, 0xDE, 0x41, 0xD2, 0xDB, 0x5F, 0x0C, 0xCD, 0xB3, 0xDC, 0x0A, 0x01,
+    0xBC, 0x83, 0xA4, 0xB7, 0x3F, 0x4F, 0xE0, 0xA9, 0xAF, 0xC6, 0x05, 0xF0, 0x0E, 0x92, 0xDE, 0xFE,
+    0x52, 0x60, 0xDE, 0xF5, 0x46, 0x05, 0xF0, 0x0E, 0x92, 0xDE, 0xFE, 0xBC, 0x61, 0x57, 0xF9, 0x6B,
+    0x4C, 0x00, 0xEF, 0x20, 0xE9, 0xED, 0xAF, 0x0A, 0xD6, 0x41, 0xB4, 0x35, 0x26, 0x80, 0x77, 0x90,
+    0xF4, 0xF6, 0x77, 0x10, 0xB0, 0xAB, 0x7C, 0xF2, 0xE1, 0x2A, 0x5F, 0x2A, 0x47, 0xD6, 0xB7, 0xE5,
+    0xF2, 0x85, 0xAD, 0x1F, 0x59, 0x3E, 0x61, 0xF9, 0xA4, 0x7D, 0x3D, 0xAF, 0xDF, 0xAF, 0x29, 0x9B,
+    0xC3, 0xAE, 0x25, 0xFB, 0xBC, 0x99, 0x7F, 0x47, 0xFF, 0xD3, 0x32, 0xDF, 0xA0, 0xFB, 0x97, 0x65,
+    0xBE, 0xC0, 0xF5, 0x3F, 0xCB, 0x7C, 0x79, 0xEB, 0x76, 0x63, 0x27, 0xC0, 0x2E, 0x9E, 0x93, 0x11,
+    0xC8, 0x02, 0x34, 0xBC, 0x0D, 0xB2, 0x00, 0x59, 0x80, 0x86, 0x09, 0x34, 0x7C, 0xF9, 0x7C, 0x02,
+    0xB2, 0x00, 0x0D, 0x13, 0x68, 0xF8, 0xF2, 0xF9, 0x04, 0x64, 0x01, 0x1A, 0x26, 0xD0, 0xF0, 0xE5,
+    0xF7, 0x3A, 0x01, 0x7A, 0xDB, 0x4F, 0x78, 0xCD, 0x46, 0xC3, 0x6B, 0x9C, 0xF6, 0xCB, 0xEF, 0xCB,
+    0xB2, 0x4A, 0x80, 0x0C, 0xFD, 0xE0, 0x24, 0x1F, 0x60, 0x2B, 0x01, 0xD4, 0x11, 0x5B, 0xCA, 0xBC,
+    0x70, 0x26, 0xA7, 0xC9, 0x08, 0xF4, 0xBD, 0xB4, 0xC7, 0x5C, 0xC5, 0x8C, 0xC3, 0xDF, 0x84, 0xFB,
+    0x1A, 0x8A, 0x01, 0x82, 0xAF, 0xBE, 0xC9, 0x96, 0xD0, 0xED, 0xD9, 0x31, 0x4B, 0xF1, 0x2C, 0xAD,
+    0x4E, 0x00, 0x88, 0x68, 0xD4, 0x60, 0x54, 0x23, 0xF3, 0x76, 0xB8, 0x9C, 0x26, 0x23, 0x00, 0x43,
+    0xF1, 0x4C, 0x4F, 0xC3, 0xC0, 0xBF, 0x05, 0xC5, 0x22, 0x30, 0x51, 0x93, 0x27, 0x5B, 0x42, 0x77,
+    0x67, 0x6B, 0x13, 0x8B, 0xA3, 0xF8, 0x96, 0x44, 0x74, 0x02, 0xD4, 0xA1, 0x13, 0xC0, 0x84, 0xF0,
+    0x52, 0xCA, 0x37, 0x6F, 0xDE, 0xFC, 0x51, 0x8E, 0xCE, 0x85, 0xB1, 0x08, 0x14, 0xEC, 0xF4, 0xCE,
+    0xB0, 0x54, 0x04, 0x58, 0x97, 0x27, 0x40, 0x02, 0xC4, 0x8A, 0x21, 0xC0, 0xBB, 0x97, 0x2F, 0x5F,
+    0xFE, 0x36, 0xD6, 0x55, 0xF3, 0xE0, 0x92, 0x40, 0xC1, 0x8E, 0x17, 0xB7, 0xC1, 0x12, 0x01, 0x52,
+    0x11, 0x4A, 0x01, 0x98, 0xA4, 0xDD, 0x8F, 0x08, 0x61, 0xF7, 0x9B, 0x7D, 0x77, 0xF7, 0xEE, 0xDD,
+    0x1F, 0xB7, 0xB7, 0xB7, 0xF9, 0x10, 0x21, 0xA7, 0x31, 0x08, 0xC0, 0x0C, 0x76, 0x36, 0x05, 0x01,
+    0x74, 0x0A, 0x60, 0x4B, 0x0E, 0xBB, 0xDF, 0x6C, 0xF8, 0x24, 0x0C, 0x4B, 0x8A, 0x5F, 0xB5, 0xC1,
+    0xA3, 0x89, 0xFA, 0xAC, 0xBD, 0x0B, 0xF1, 0xED, 0xC5, 0x8B, 0x17, 0xD7, 0x79, 0x37, 0x22, 0xEF,
+    0x48, 0x64, 0x60, 0x4E, 0xFB, 0x13, 0x00, 0xFE, 0xEA, 0xEA, 0xEA, 0x77, 0x37, 0x6F, 0xDE, 0xFC,
+    0xD5, 0x46, 0xF2, 0xE9, 0x97, 0x3E, 0x01, 0x0B, 0x9F, 0x82, 0x59, 0xBD, 0x14, 0x82, 0x8F, 0x22,
+    0x63, 0xF0, 0x56, 0x2D, 0x4F, 0x05, 0xED, 0x21, 0x3D, 0x78, 0xF0, 0x60, 0x8D, 0x17, 0x53, 0x9E,
+    0x3F, 0x7F, 0xFE, 0x84, 0xFD, 0x07, 0xB9, 0xA3, 0x0B, 0x0B, 0x0B, 0x7C, 0x5C, 0x59, 0xF6, 0x17,
+    0xC3, 0xBA, 0x6E, 0xDE, 0xDB, 0x33, 0xFF, 0xF7, 0xF5, 0xF5, 0xF5, 0x5F, 0x6E, 0xDF, 0xBE, 0xFD,
+    0x4D, 0x01, 0xFF, 0x5F, 0x83, 0x02, 0x7C, 0x4E, 0x01, 0x59, 0x8F, 0x21, 0x3D, 0xF2, 0xFB, 0xE0,
+    0x87, 0x1D, 0x6F, 0x83, 0x10, 0x25, 0xBC, 0xC6, 0xD0, 0x2C, 0xEF, 0x41, 0x24, 0xE7, 0x17, 0x3A,
+    0x1B, 0x84, 0x24, 0x09, 0x22, 0xBB, 0x59, 0x60, 0xD9, 0xE1, 0x82, 0x8D, 0x8D, 0xE1, 0xEB, 0x31,
+    0xD4, 0x17, 0x07, 0x00, 0x5D, 0x3E, 0x8F, 0x8A, 0xB2, 0x1C, 0x5A, 0x35, 0x24, 0xFA, 0x69, 0x53,
+    0x5C, 0xC0, 0x69, 0xFC, 0x6E, 0x44, 0x3D, 0xAE, 0x18, 0xDC, 0x95, 0x53, 0x21, 0x66, 0x62, 0x23,
+    0x66, 0x30, 0x12, 0x27, 0x80, 0xC7, 0xB9, 0x0F, 0xBC, 0xF5, 0x31, 0x77, 0xE0, 0x9D, 0xF2, 0x72,
+    0x68, 0x7D, 0x65, 0xC2, 0x79, 0x2C, 0x80, 0x7E, 0x8B, 0x02, 0xF0, 0x82, 0x1F, 0x83, 0x8F, 0xCB,
+    0xA5, 0x93, 0x43, 0x54, 0x10, 0x7C, 0x6E, 0x29, 0x40, 0x34, 0x2B, 0x46, 0x3A, 0x09, 0x88, 0x40,
+    0x19, 0x01, 0xD4, 0x16, 0x0B, 0x60, 0xCD, 0xBB, 0x49, 0xFF, 0xE3, 0x39, 0x76, 0x4A, 0x0F, 0x0E,
+    0x49, 0xF1, 0x05, 0x00, 0x8F, 0x43, 0xAC, 0xC0, 0xCB, 0x5A, 0x53, 0x48, 0x87, 0x1D, 0xBE, 0xEE,
+    0x33, 0xE6, 0x45, 0x19, 0x5E, 0xB2, 0x02, 0x9D, 0x5A, 0x8D, 0x11, 0xD3, 0xE0, 0x23, 0x06, 0xA6,
+    0x32, 0x36, 0xCD, 0xDA, 0xED, 0x02, 0x2E, 0x1B, 0xCF, 0xD1, 0xE2, 0xBA, 0x64, 0x03, 0xC4, 0x02,
+    0xBE, 0x04, 0x90, 0xD5, 0xA9, 0xA0, 0x9E, 0x66, 0x18, 0xD1, 0x36, 0xF0, 0xCC, 0x4E, 0x81, 0xA6,
+    0x42, 0xC4, 0x75, 0xCD, 0xD7, 0x1C, 0xEA, 0x5D, 0x4C, 0x82, 0xCB, 0xBD, 0xAB, 0x5C, 0x65, 0xD5,
+    0x1F, 0xDB, 0x01, 0x01, 0xE8, 0x24, 0x09, 0xAA, 0x6C, 0xDA, 0x56, 0xD5, 0x1E, 0x26, 0x76, 0xF0,
+    0x47, 0xD8, 0xC9, 0xC5, 0x7D, 0x0B, 0x3C, 0xD5, 0xB4, 0x3D, 0x6D, 0x0B, 0x53, 0x62, 0x90, 0xA1,
+    0x21, 0xF9, 0x91, 0xF6, 0xA7, 0xF5, 0x64, 0x78, 0x29, 0x5C, 0xDA, 0x7E, 0xD8, 0xEA, 0x31, 0xDC,
+    0xAA, 0x7B, 0x4B, 0xFB, 0xD3, 0x7A, 0x39, 0xE7, 0x7F, 0xF1, 0x70, 0x18, 0xCE, 0xAA, 0xDB, 0xB2,
+    0x97, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 0x89, 0x50, 0x4E,
+    0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77, 0x38, 0x00, 0x00,
+    0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x09, 0xB6, 0x49,
+    0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x4B, 0x68, 0x14, 0x49, 0x18, 0xC7, 0x2B, 0xC9, 0x26,
+    0x46, 0xB3, 0x9A, 0xB8, 0x6A, 0x7C, 0xC1, 0x62, 0x2E, 0x6A, 0x50, 0x04, 0x89, 0x28, 0x22, 0x88,
+    0x08, 0x2E, 0x01, 0x41, 0x51, 0x41, 0x0F, 0x1E, 0x3C, 0x88, 0x37, 0x1F, 0xE0, 0x12, 0xF1, 0xA2,
+    0x07, 0xBD, 0x99, 0xC3, 0xFA, 0x3A, 0x09, 0x1E, 0x3C, 0x78, 0x50, 0x50, 0x51, 0x10, 0xDC, 0x0D,
+    0x78, 0x8A, 0x07, 0xD1, 0xF8, 0xC6, 0x9B, 0xE0, 0x1E, 0x7C, 0x67, 0x91, 0x2C, 0x79, 0x98, 0x87,
+    0x66, 0xEB, 0x5F, 0x99, 0x7F, 0x6F, 0x75, 0x4D, 0x4D, 0x66, 0x7A, 0x3A, 0xFD, 0x98, 0x99, 0xFA,
+    0xA0, 0xE6, 0xAB, 0xC7, 0x57, 0x55, 0x5D, 0xBF, 0xAF, 0xAB, 0xBA, 0x67, 0xBA, 0x66, 0xA6, 0x4A,
+    0xE4, 0x96, 0x2A, 0xA3, 0xC8, 0x4C, 0x1B, 0xC5, 0x22, 0x5F, 0xB9, 0x69, 0x5F, 0xEA, 0xE9, 0xF1,
+    0x3C, 0x03, 0x30, 0xCB, 0xCD, 0xB4, 0xAA, 0x6E, 0x83, 0xC6, 0x3C, 0x6A, 0x18, 0x32, 0x0E, 0xCD,
+    0xB8, 0x9E, 0x8F, 0x78, 0x25, 0x8B, 0x0E, 0x17, 0x71, 0xA6, 0xA9, 0xC1, 0x86, 0x71, 0x6A, 0xC5,
+    0xEB, 0x27, 0xF5, 0x3A, 0xF1, 0x42, 0xB0, 0xA6, 0xAE, 0x96, 0xC5, 0x04, 0x4F, 0x8D, 0x1A, 0x7A,
+    0x7C, 0xA2, 0x85, 0xCA, 0x7D, 0x05, 0x54, 0x82, 0x65, 0x9C, 0xFA, 0x47, 0x0E, 0x2C, 0xCA, 0x5E,
+    0x77, 0x00, 0xEC, 0x74, 0xF8, 0x04, 0x0F, 0x6D, 0x8B, 0xEB, 0xB6, 0x39, 0xFA, 0xA8, 0x88, 0x6C,
+    0x13, 0x3C, 0x80, 0x23, 0x20, 0x1F, 0x1A, 0x9C, 0x18, 0x87, 0x66, 0x5A, 0x46, 0x85, 0xA0, 0x03,
+    0x90, 0xA9, 0x03, 0x05, 0xF0, 0x1A, 0x19, 0x08, 0x1F, 0x71, 0xA6, 0xA1, 0x61, 0x4B, 0xA7, 0xC8,
+    0xA8, 0x12, 0xD6, 0x67, 0xBA, 0xDC, 0x35, 0xC1, 0x63, 0x9C, 0x3A, 0xE0, 0xEF, 0x32, 0x0D, 0xF0,
+    0xD0, 0x8C, 0x23, 0x0D, 0xA1, 0x63, 0xC8, 0x6A, 0x9C, 0x0E, 0x98, 0x28, 0xFE, 0x1F, 0x2C, 0x81,
+    0x43, 0xC3, 0x86, 0x41, 0xCF, 0xAF, 0x64, 0x27, 0x4C, 0x06, 0x9F, 0xE0, 0xC7, 0x24, 0x37, 0x06,
+    0xE4, 0x51, 0xE8, 0x04, 0x95, 0x06, 0x58, 0x80, 0x64, 0xE0, 0x99, 0x4F, 0xF0, 0xB5, 0xB2, 0xCC,
+    0x0C, 0xA8, 0x43, 0x47, 0xD0, 0x09, 0x32, 0xCB, 0x9B, 0x41, 0x88, 0x57, 0x82, 0xD0, 0x09, 0x04,
+    0xAA, 0x83, 0x1F, 0x95, 0x00, 0x18, 0xC0, 0x14, 0x71, 0x5D, 0x38, 0x23, 0xBC, 0x25, 0x08, 0x85,
+    0xA6, 0x13, 0x00, 0xBE, 0x4E, 0x86, 0x69, 0x86, 0x46, 0x3E, 0x9D, 0xC0, 0x25, 0x0A, 0x75, 0x2B,
+    0x51, 0xB8, 0xF4, 0x00, 0x28, 0x1C, 0x80, 0x33, 0x1E, 0xB0, 0x47, 0x64, 0x18, 0x96, 0x01, 0x27,
+    0x2A, 0xD9, 0xC0, 0x96, 0xF6, 0xC8, 0xA3, 0x03, 0x95, 0x01, 0x40, 0x02, 0x6C, 0xBD, 0x0C, 0x3F,
+    0xCB, 0xF0, 0x8B, 0x0C, 0x0B, 0x65, 0x68, 0x91, 0xA1, 0x75, 0xFF, 0xFE, 0xFD, 0xED, 0xEF, 0xDE,
+    0xBD, 0xFB, 0x73, 0x78, 0x78, 0xB8, 0x77, 0xDC, 0xC9, 0xA4, 0x04, 0xC0, 0x08, 0xAC, 0xC0, 0x0C,
+    0xEC, 0x32, 0x0C, 0xC1, 0x12, 0x4C, 0xC1, 0x16, 0x8C, 0xC1, 0x1A, 0xCC, 0x95, 0x73, 0x10, 0x81,
+    0xA7, 0x70, 0xB6, 0xCF, 0x90, 0xA1, 0x51, 0x86, 0x66, 0x19, 0x7E, 0x95, 0x61, 0x19, 0x1A, 0x1A,
+    0x1D, 0x1D, 0xED, 0x9B, 0xB4, 0x57, 0x57, 0x98, 0x45, 0x00, 0xCC, 0x32, 0x4E, 0x58, 0x96, 0x61,
+    0x09, 0xA6, 0x60, 0x0B, 0xC6, 0x60, 0x0D, 0xE6, 0xD5, 0xF0, 0x00, 0x3D, 0x81, 0x65, 0x85, 0xCB,
+    0x0E, 0xBC, 0x34, 0x5D, 0x86, 0x06, 0xE9, 0xCD, 0xCE, 0x45, 0x8B, 0x16, 0xFD, 0x26, 0xE3, 0x4E,
+    0x02, 0x12, 0x78, 0xFF, 0xFE, 0xFD, 0x5F, 0x8B, 0x17, 0x2F, 0xEE, 0x90, 0xD5, 0x06, 0x64, 0x18,
+    0x92, 0xE1, 0x9B, 0x0C, 0x58, 0x9E, 0xB0, 0x4C, 0x61, 0xB9, 0x1A, 0x07, 0x7C, 0x08, 0x1C, 0xC1,
+    0xC0, 0x19, 0xA1, 0x9C, 0x31, 0x77, 0xEE, 0xDC, 0x36, 0x65, 0xE1, 0x5E, 0x02, 0x13, 0xC8, 0xB0,
+    0xC3, 0xD9, 0x0E, 0x96, 0xEA, 0x8C, 0x97, 0x9A, 0x9C, 0xA1, 0xD5, 0xD9, 0x0F, 0xCD, 0x4C, 0xC2,
+    0xC7, 0x6C, 0x50, 0x33, 0xA2, 0xAE, 0xAE, 0x6E, 0x0E, 0x0C, 0x9C, 0x04, 0x27, 0x90, 0x61, 0x07,
+    0xF8, 0xE4, 0x69, 0x3A, 0xC1, 0x73, 0x00, 0x5B, 0xB7, 0x39, 0x82, 0x65, 0x4E, 0x17, 0x47, 0x00,
+    0xF0, 0xB3, 0xC0, 0xB3, 0x29, 0x2E, 0x41, 0x48, 0xEB, 0xF0, 0x39, 0x13, 0x50, 0xD1, 0x49, 0x38,
+    0x02, 0x60, 0x48, 0x07, 0x80, 0x2B, 0x39, 0xAB, 0x56, 0x99, 0x81, 0x04, 0x0A, 0x20, 0x34, 0x80,
+    0xD6, 0x1D, 0xA4, 0x0A, 0xDD, 0x4B, 0x60, 0x02, 0x64, 0x4C, 0xAE, 0x68, 0xC0, 0x63, 0x4D, 0xC0,
+    0x5E, 0x46, 0xA6, 0x79, 0xC2, 0x67, 0x79, 0xE0, 0x5E, 0x5D, 0x05, 0x8F, 0x00, 0x18, 0xD2, 0x09,
+    0xC8, 0xF4, 0xB1, 0xB6, 0x01, 0xA6, 0x81, 0xD7, 0x82, 0x8B, 0x4C, 0x19, 0x81, 0x2C, 0xB6, 0x36,
+    0x07, 0xA0, 0x37, 0x18, 0x32, 0x4C, 0x59, 0xEF, 0x15, 0xDA, 0x10, 0x39, 0x66, 0xC1, 0x07, 0x8F,
+    0x5C, 0x0E, 0xA8, 0x50, 0x56, 0xF1, 0x0F, 0xDB, 0x39, 0x20, 0x7E, 0xE6, 0xBE, 0x1E, 0x9D, 0x03,
+    0x7C, 0x38, 0xE2, 0x4F, 0x38, 0x07, 0xC4, 0xCF, 0xDC, 0xD7, 0xA3, 0x73, 0x80, 0x0F, 0x47, 0xFC,
+    0x09, 0xE7, 0x80, 0xF8, 0x99, 0xFB, 0x7A, 0x74, 0x0E, 0xF0, 0xE1, 0x88, 0x3F, 0xE1, 0x1C, 0x10,
+    0x3F, 0x73, 0x5F, 0x8F, 0xCE, 0x01, 0x3E, 0x1C, 0xF1, 0x27, 0xF0, 0x51, 0x69, 0x6A, 0x64, 0x68,
+    0x68, 0x48, 0xDC, 0xBA, 0x75, 0x4B, 0x3C, 0x7C, 0xF8, 0x50, 0x7C, 0xFC, 0xF8, 0x51, 0x1D, 0xD7,
+    0x82, 0x05, 0x0B, 0xC4, 0xBA, 0x75, 0xEB, 0xC4, 0x8E, 0x1D, 0x3B, 0xC4, 0xF4, 0xE9, 0x78, 0x48,
+    0x57, 0x5E, 0x82, 0xB7, 0xC7, 0xFC, 0xB8, 0x14, 0x0F, 0x0E, 0xB0, 0x03, 0x02, 0xCF, 0x2C, 0xF1,
+    0xF0, 0x78, 0x96, 0x0C, 0x8D, 0xF2, 0x61, 0xE7, 0x5F, 0x52, 0x47, 0x2E, 0x2F, 0x5E, 0xBC, 0x10,
+    0xE7, 0xCF, 0x9F, 0x17, 0x5F, 0xBE, 0x7C, 0xB1, 0xF6, 0x35, 0x6F, 0xDE, 0x3C, 0x71, 0xF8, 0xF0,
+    0x61, 0xB1, 0x6A, 0xD5, 0x2A, 0x6B, 0x79, 0x5A, 0x33, 0xAB, 0xAA, 0xAA, 0xF0, 0x38, 0xB7, 0x4F,
+    0x86, 0x7F, 0x65, 0xE8, 0x97, 0x61, 0x50, 0x06, 0xEC, 0x98, 0xC0, 0x63, 0xC9, 0xEF, 0xA9, 0x58,
+    0x82, 0x00, 0xFF, 0xC4, 0x89, 0x13, 0x39, 0xE1, 0xCB, 0x03, 0x55, 0x65, 0xB0, 0x79, 0xF9, 0xF2,
+    0x25, 0x92, 0x65, 0x23, 0x89, 0x3B, 0x00, 0xCB, 0x0E, 0xCE, 0xFC, 0x42, 0xE5, 0xDC, 0xB9, 0x73,
+    0x02, 0x75, 0xCA, 0x45, 0x12, 0x77, 0x00, 0xD6, 0xFC, 0x5C, 0xCB, 0x8E, 0x0D, 0x32, 0x6C, 0x51,
+    0xA7, 0x5C, 0x24, 0x71, 0x07, 0xE0, 0x82, 0x1B, 0x54, 0x8A, 0xA9, 0x13, 0xB4, 0x8F, 0xB8, 0xEC,
+    0x13, 0xBF, 0x0B, 0xE2, 0xDD, 0x4E, 0x90, 0x01, 0x17, 0x53, 0x27, 0x57, 0xFB, 0xDB, 0xB7, 0x6F,
+    0xCF, 0x55, 0xE4, 0xCB, 0xBF, 0x7D, 0xFB, 0xB6, 0x2F, 0x3D, 0x55, 0x89, 0xC4, 0x67, 0xC0, 0xB7,
+    0x6F, 0xD8, 0xAB, 0x14, 0x4C, 0x8A, 0xA9, 0x13, 0xAC, 0x87, 0xF8, 0xAC, 0x13, 0x77, 0x40, 0x7C,
+    0x43, 0x4D, 0x67, 0x4F, 0xCE, 0x01, 0x09, 0xFB, 0x25, 0xF1, 0x6B, 0x40, 0x31, 0xE3, 0x97, 0x6F,
+    0x6E, 0x8A, 0xA9, 0x66, 0xAD, 0x13, 0xD5, 0xDA, 0x6E, 0xED, 0xCC, 0x92, 0xE9, 0x66, 0x80, 0x05,
+    0x4A, 0x9C, 0x59, 0xCE, 0x01, 0x71, 0xD2, 0xB6, 0xF4, 0x55, 0x92, 0x0E, 0x98, 0xCA, 0x25, 0xC8,
+    0xC2, 0x24, 0xD6, 0xAC, 0x92, 0xBC, 0x06, 0x4C, 0x05, 0xA1, 0x42, 0xEF, 0xFF, 0xD9, 0x57, 0x54,
+    0xD7, 0x8A, 0x92, 0x9C, 0x01, 0x84, 0x52, 0x0E, 0xBA, 0x24, 0x1D, 0x50, 0x4E, 0x4B, 0x50, 0x49,
+    0x3A, 0xA0, 0x1C, 0xCE, 0x7C, 0x8E, 0xA1, 0x24, 0xAF, 0x01, 0x53, 0x31, 0x03, 0xA2, 0x5A, 0xD3,
+    0x09, 0xB6, 0x50, 0xED, 0x66, 0x40, 0xA1, 0xA4, 0x22, 0xB2, 0x8B, 0x6C, 0x06, 0xEC, 0xD9, 0xB3,
+    0x47, 0xE8, 0x1F, 0x9A, 0xE1, 0x41, 0xCA, 0x92, 0x25, 0x4B, 0x22, 0x1A, 0xC6, 0x44, 0xB3, 0x6F,
+    0xDF, 0xBE, 0x15, 0x47, 0x8E, 0x1C, 0xF1, 0xFA, 0xA8, 0xAF, 0xAF, 0x17, 0xD7, 0xAE, 0x5D, 0xF3,
+    0xD2, 0x69, 0x8C, 0x44, 0x36, 0x03, 0xE6, 0xCC, 0xF1, 0x7F, 0xB7, 0xAF, 0xB7, 0xB7, 0xD7, 0x3A,
+    0x7E, 0x40, 0x0A, 0x2A, 0xB9, 0xEA, 0x98, 0x7D, 0x98, 0xC7, 0x10, 0xB4, 0x9F, 0x38, 0xEC, 0x23,
+    0x9B, 0x01, 0x4D, 0x4D, 0x4D, 0x42, 0x7E, 0xC7, 0xD8, 0x1B, 0x43, 0xAE, 0xA7, 0x5E, 0xD8, 0xF5,
+    0x80, 0x33, 0x37, 0x88, 0x2C, 0x5C, 0x88, 0x2F, 0x9E, 0x67, 0x8B, 0xD9, 0x07, 0x8E, 0xC1, 0x94,
+    0xA0, 0xF7, 0xFF, 0xAC, 0x1F, 0xD5, 0x35, 0x23, 0xB2, 0x19, 0xB0, 0x74, 0xE9, 0x52, 0x1E, 0xBB,
+    0xD2, 0x8F, 0x1F, 0x3F, 0xF6, 0xA5, 0x99, 0xC0, 0x96, 0x93, 0xA0, 0xB2, 0x76, 0xED, 0x5A, 0x6B,
+    0x95, 0x47, 0x8F, 0x1E, 0xF9, 0xF2, 0xCD, 0x63, 0xF0, 0x15, 0xA6, 0x24, 0x11, 0x99, 0x03, 0x4C,
+    0x48, 0xCF, 0x9E, 0x3D, 0x13, 0x03, 0x03, 0xF8, 0xC2, 0xB8, 0x5F, 0xB0, 0xDF, 0x07, 0x5B, 0x4E,
+    0x0A, 0x95, 0xF9, 0xF3, 0xE7, 0x0B, 0xDB, 0x59, 0x8C, 0xB6, 0x9F, 0x3F, 0x7F, 0xEE, 0x6B, 0xC6,
+    0x3C, 0x06, 0x5F, 0x61, 0x4A, 0x12, 0x91, 0x39, 0x60, 0xF9, 0xF2, 0xE5, 0x62, 0xE6, 0xCC, 0x99,
+    0xDE, 0x30, 0xC7, 0xC6, 0xC6, 0xAC, 0x0F, 0xD3, 0xB1, 0xD9, 0x0A, 0xFB, 0x7D, 0x0A, 0x15, 0x5C,
+    0x64, 0xA7, 0x4D, 0xC3, 0xF6, 0x25, 0xBF, 0xDC, 0xBC, 0x79, 0x53, 0xA0, 0x0F, 0x0A, 0xFA, 0xC6,
+    0x31, 0xA4, 0x5D, 0x22, 0xDD, 0x98, 0x75, 0xFD, 0xFA, 0x75, 0x71, 0xF5, 0xEA, 0x55, 0x8F, 0x41,
+    0x6D, 0x6D, 0xAD, 0xB8, 0x70, 0xE1, 0x82, 0xB0, 0xAD, 0xE1, 0xF9, 0x36, 0x66, 0x35, 0x37, 0x37,
+    0xAB, 0x3B, 0x9C, 0x95, 0x2B, 0x57, 0x7A, 0xED, 0x31, 0xF2, 0xE1, 0xC3, 0x07, 0x71, 0xE8, 0xD0,
+    0x21, 0x21, 0x7F, 0x20, 0x83, 0x59, 0x62, 0xEF, 0xDE, 0xBD, 0x62, 0xF7, 0xEE, 0xDD, 0x5E, 0x3A,
+    0xA9, 0x88, 0x7C, 0xCF, 0x92, 0xDC, 0xC6, 0xAC, 0x6D, 0xDB, 0xB6, 0x89, 0xC6, 0x46, 0xFC, 0x40,
+    0xC8, 0x84, 0x00, 0x50, 0x67, 0x67, 0xA7, 0x75, 0x5F, 0x0F, 0x76, 0xBC, 0xC1, 0x39, 0xB8, 0x7D,
+    0xC5, 0xED, 0x2A, 0xEE, 0x74, 0x10, 0x10, 0x47, 0x1E, 0xF6, 0x0E, 0xD9, 0xE0, 0x63, 0x8F, 0x10,
+    0xDA, 0xD4, 0xE1, 0xCF, 0x9A, 0x35, 0x4B, 0xA0, 0xEF, 0x52, 0x90, 0x48, 0x67, 0x00, 0x00, 0x74,
+    0x75, 0x75, 0x89, 0x8B, 0x17, 0x2F, 0xFA, 0x58, 0x00, 0xF6, 0xC9, 0x93, 0x27, 0x05, 0x66, 0x44,
+    0x18, 0x01, 0xF4, 0x53, 0xA7, 0x4E, 0x09, 0xCC, 0x1E, 0x5D, 0x0E, 0x1E, 0x3C, 0x28, 0xB6, 0x6C,
+    0xD9, 0xA2, 0x67, 0x25, 0x16, 0x4F, 0x74, 0x06, 0x60, 0xD4, 0x00, 0xB1, 0x69, 0xD3, 0x26, 0x1F,
+    0x00, 0x00, 0xEB, 0xE8, 0xE8, 0x10, 0xF2, 0xE7, 0x5C, 0x7C, 0xF9, 0x41, 0x12, 0xA8, 0x8B, 0x36,
+    0x4C, 0xF8, 0xE8, 0x2B, 0x2D, 0xF0, 0x0B, 0x19, 0x4F, 0xE4, 0x33, 0x00, 0x07, 0x31, 0x32, 0x32,
+    0x22, 0x8E, 0x1F, 0x3F, 0x2E, 0xDE, 0xBC, 0x79, 0xE3, 0x3B, 0x26, 0x5C, 0x80, 0x77, 0xED, 0xDA,
+    0x25, 0xB6, 0x6E, 0xDD, 0x2A, 0x66, 0xCC, 0xC0, 0x9E, 0xE0, 0xFC, 0x32, 0x38, 0x38, 0x28, 0xEE,
+    0xDE, 0xBD, 0x2B, 0x6E, 0xDC, 0xB8, 0x91, 0xB5, 0x94, 0xB5, 0xB4, 0xB4, 0x88, 0x33, 0x67, 0xCE,
+    0x08, 0xF9, 0x2B, 0x25, 0x59, 0x0D, 0xD9, 0xEE, 0x9C, 0xB2, 0x8C, 0x26, 0xC9, 0x28, 0xF6, 0x7D,
+    0x40, 0xBE, 0x19, 0x10, 0x8B, 0x03, 0x30, 0x2E, 0x80, 0x3B, 0x7D, 0xFA, 0xB4, 0x78, 0xFD, 0xFA,
+    0x75, 0xD6, 0x30, 0x1B, 0x1A, 0x1A, 0xC4, 0xE6, 0xCD, 0x9B, 0x45, 0x5B, 0x5B, 0x9B, 0x5A, 0xE7,
+    0xCD, 0xA5, 0x09, 0x4B, 0xCD, 0xAB, 0x57, 0xAF, 0x44, 0x4F, 0x4F, 0x8F, 0xB8, 0x7F, 0xFF, 0xBE,
+    0xF5, 0x76, 0xB6, 0xB5, 0xB5, 0x55, 0x6D, 0xF0, 0x45, 0x5B, 0x36, 0xA9, 0x78, 0x07, 0x00, 0x0A,
+    0x66, 0xC2, 0xD9, 0xB3, 0x67, 0xC5, 0x83, 0x07, 0x0F, 0x6C, 0x8C, 0x54, 0x5E, 0x75, 0x75, 0xB5,
+    0xBA, 0x70, 0xCF, 0x9E, 0x3D, 0x5B, 0xA5, 0xBF, 0x7E, 0xFD, 0x2A, 0xFA, 0xFA, 0xFA, 0xC4, 0x8F,
+    0x1F, 0xDE, 0x0F, 0x0D, 0x66, 0xD5, 0x5D, 0xBF, 0x7E, 0xBD, 0x38, 0x7A, 0xF4, 0xA8, 0xF5, 0xCC,
+    0xA7, 0x71, 0x5A, 0x1D, 0x10, 0xD9, 0x47, 0x11, 0x1C, 0xB8, 0xAE, 0xB1, 0x34, 0x1C, 0x3B, 0x76,
+    0x4C, 0x74, 0x77, 0x77, 0x8B, 0x4B, 0x97, 0x2E, 0x29, 0xB0, 0x7A, 0x39, 0xE2, 0x00, 0x0D, 0xE8,
+    0x08, 0xF9, 0x04, 0x77, 0x3B, 0x07, 0x0E, 0x1C, 0x10, 0x1B, 0x37, 0x6E, 0xCC, 0x67, 0x9A, 0xDA,
+    0xF2, 0xD8, 0x96, 0x20, 0x93, 0x40, 0x7F, 0x7F, 0xBF, 0xB8, 0x73, 0xE7, 0x8E, 0xB8, 0x77, 0xEF,
+    0x9E, 0xD5, 0x11, 0xA6, 0xBD, 0x9E, 0x06, 0xF8, 0xF6, 0xF6, 0x76, 0x75, 0xAB, 0xA9, 0xBF, 0xD9,
+    0xD3, 0x6D, 0xD2, 0x12, 0x4F, 0xCD, 0x35, 0x20, 0x17, 0x10, 0xBC, 0x7B, 0xC5, 0x92, 0xF4, 0xE4,
+    0xC9, 0x13, 0x75, 0x7D, 0xF8, 0xFC, 0xF9, 0xB3, 0xD5, 0x14, 0x1F, 0x57, 0xAC, 0x58, 0xB1, 0x42,
+    0xAC, 0x5E, 0xBD, 0x5A, 0x6C, 0xD8, 0xB0, 0x21, 0xF4, 0x2D, 0xAC, 0xB5, 0x93, 0x08, 0x32, 0x53,
+    0xEF, 0x00, 0x73, 0xCC, 0xF8, 0x48, 0xE1, 0xCA, 0x95, 0x2B, 0xBE, 0xEC, 0x7D, 0xFB, 0xF6, 0x89,
+    0x9D, 0x3B, 0x77, 0xFA, 0xF2, 0x4A, 0x25, 0x91, 0xCF, 0x01, 0x91, 0x7D, 0x16, 0x54, 0x2C, 0x20,
+    0xDB, 0x2D, 0xA4, 0x2D, 0xAF, 0xD8, 0xF6, 0xD3, 0x56, 0x2F, 0xD6, 0x8B, 0x70, 0x12, 0x83, 0x0F,
+    0x7B, 0xF7, 0xC3, 0x63, 0x2E, 0xF6, 0x7D, 0x00, 0xEB, 0xE7, 0xD2, 0xA9, 0x9B, 0x01, 0xB9, 0x0E,
+    0xB4, 0x5C, 0xF3, 0x9D, 0x03, 0x12, 0xF6, 0xAC, 0x73, 0x40, 0xC2, 0x0E, 0x28, 0xFB, 0x6B, 0x40,
+    0x54, 0x6B, 0xF7, 0x54, 0xF9, 0xCD, 0xCD, 0x80, 0xA9, 0x22, 0x59, 0x64, 0x3B, 0x89, 0xBD, 0x13,
+    0x2E, 0xF2, 0x78, 0x4B, 0xAE, 0x5A, 0xC9, 0xBD, 0x0F, 0x28, 0x39, 0xC2, 0x21, 0x0F, 0xD8, 0x2D,
+    0x41, 0x21, 0x01, 0x86, 0xAD, 0xEE, 0x1C, 0x10, 0x96, 0x60, 0xC8, 0xFA, 0xCE, 0x01, 0x21, 0x01,
+    0x86, 0xAD, 0xEE, 0x1C, 0x10, 0x96, 0x60, 0xC8, 0xFA, 0xB9, 0x1C, 0xC0, 0xBF, 0x5C, 0xF2, 0xFE,
+    0x6A, 0x29, 0x64, 0x3F, 0x95, 0x5C, 0x7D, 0x52, 0x96, 0x36, 0x07, 0x38, 0xE8, 0xD1, 0x9D, 0x2E,
+    0x59, 0x6C, 0xE9, 0x00, 0x16, 0xE8, 0x1A, 0x0F, 0x61, 0x73, 0x3F, 0x88, 0x8D, 0xEE, 0x20, 0xCB,
+    0xAD, 0x65, 0x72, 0xD4, 0xD9, 0x62, 0x8C, 0x2A, 0x0D, 0x07, 0xD8, 0x0A, 0x90, 0x87, 0xE0, 0x1C,
+    0x20, 0x21, 0x84, 0x14, 0x30, 0x24, 0xCF, 0x2C, 0xD6, 0x9C, 0x01, 0xE8, 0x83, 0x46, 0xF4, 0x18,
+    0xFF, 0x1B, 0x31, 0x64, 0xFF, 0x15, 0x5F, 0x9D, 0x1C, 0xC9, 0x95, 0x9C, 0x15, 0x18, 0xDD, 0x01,
+    0xC8, 0x60, 0x21, 0x8C, 0xF9, 0xDF, 0x88, 0xCA, 0xD0, 0xBD, 0x14, 0x4D, 0x00, 0x5B, 0xB6, 0xC1,
+    0x52, 0x9F, 0x09, 0x5E, 0x63, 0x74, 0x80, 0x0D, 0xBC, 0xFA, 0x63, 0x4A, 0xB9, 0x97, 0xE7, 0x1F,
+    0xCF, 0xDA, 0x45, 0x02, 0x11, 0xC8, 0xB0, 0xE3, 0xBF, 0xE6, 0x59, 0x1D, 0x61, 0x3A, 0x00, 0x8E,
+    0xE0, 0xD9, 0x8F, 0x8A, 0x23, 0xF2, 0x7B, 0x57, 0x3D, 0x81, 0x7A, 0x75, 0xC6, 0x1E, 0x81, 0x0C,
+    0x3B, 0xFE, 0x75, 0xA1, 0x39, 0x0B, 0xC0, 0xDA, 0xF7, 0x17, 0x26, 0x3A, 0x7C, 0x75, 0xF6, 0xCB,
+    0xF2, 0x61, 0xB9, 0x8B, 0xF9, 0x0F, 0xB9, 0x75, 0x04, 0x3F, 0x3A, 0xEA, 0x24, 0x00, 0x01, 0x30,
+    0x03, 0x3B, 0x59, 0x85, 0x3F, 0xD2, 0x6A, 0xCE, 0x00, 0xD5, 0x9A, 0xFE, 0x47, 0x6D, 0xF8, 0x68,
+    0x3A, 0x2B, 0x3C, 0x7D, 0xFA, 0x74, 0x40, 0xEE, 0x44, 0xEE, 0x5A, 0xB3, 0x66, 0x4D, 0xB3, 0xFC,
+    0x66, 0x4A, 0x53, 0x4D, 0x4D, 0x4D, 0x61, 0xBB, 0x68, 0x03, 0x1C, 0x6C, 0x39, 0x99, 0x62, 0xD9,
+    0xF9, 0xF4, 0xE9, 0x53, 0xF7, 0xEF, 0x52, 0x2E, 0x5F, 0xBE, 0xFC, 0xB7, 0x1C, 0x1B, 0x1C, 0xC0,
+    0x59, 0xA0, 0x3B, 0x41, 0x5D, 0x13, 0x74, 0xE0, 0x58, 0x8E, 0x10, 0xF0, 0x94, 0x0C, 0x01, 0x5B,
+    0x8C, 0x11, 0xF0, 0x7D, 0x20, 0x5D, 0x63, 0x53, 0x3F, 0xCA, 0xCD, 0x7F, 0x87, 0x93, 0x59, 0x15,
+    0x27, 0x5C, 0x35, 0xB8, 0x6C, 0x73, 0xE5, 0x00, 0x70, 0x82, 0xA7, 0x46, 0x1E, 0xCA, 0x11, 0x60,
+    0xAF, 0x1C, 0xA0, 0x3F, 0x92, 0x44, 0x63, 0x6C, 0x10, 0xEB, 0x15, 0xBF, 0xEF, 0x83, 0x3C, 0xDE,
+    0x11, 0xA1, 0x11, 0xC2, 0x87, 0x03, 0xE0, 0x40, 0x5E, 0x47, 0x10, 0xAF, 0x24, 0x01, 0x17, 0x88,
+    0x02, 0x29, 0x35, 0x18, 0x91, 0x13, 0xD8, 0x99, 0x01, 0x65, 0xB4, 0x65, 0x5D, 0x05, 0xD3, 0x4B,
+    0x64, 0x0C, 0xA4, 0xF2, 0x04, 0x65, 0xA8, 0xC4, 0x86, 0xE1, 0x00, 0xFE, 0xD8, 0x37, 0xE1, 0xEB,
+    0xE0, 0xF5, 0xB8, 0xD7, 0x48, 0x19, 0x46, 0x74, 0x66, 0x64, 0x04, 0x4D, 0x27, 0x90, 0x17, 0xCF,
+    0x78, 0x3D, 0x5F, 0x77, 0xC2, 0xB8, 0x3E, 0x03, 0xC0, 0x89, 0x8D, 0x91, 0x19, 0xD3, 0x6C, 0x10,
+    0x67, 0xBB, 0x7E, 0xE6, 0xEB, 0xC0, 0xF5, 0x38, 0xEB, 0x97, 0xB3, 0x06, 0x1B, 0x0A, 0x39, 0x41,
+    0x83, 0x15, 0x4F, 0x5A, 0xC6, 0x99, 0x26, 0x7C, 0xD6, 0x53, 0x4B, 0x08, 0x13, 0x00, 0x48, 0x88,
+    0xD0, 0x80, 0x4D, 0x6D, 0x8B, 0xEB, 0xB6, 0x6C, 0xA3, 0x12, 0x35, 0x1D, 0x01, 0x4D, 0x47, 0x10,
+    0x34, 0xB4, 0x1E, 0x37, 0x6D, 0x3D, 0xE0, 0x00, 0x67, 0x02, 0x65, 0x9A, 0xF0, 0x91, 0x66, 0xA0,
+    0x3D, 0x6D, 0x90, 0xAE, 0x64, 0x21, 0x7C, 0x30, 0x60, 0x9C, 0x1A, 0x0E, 0x80, 0xE8, 0xF0, 0xBD,
+    0xB4, 0x0D, 0x20, 0xF3, 0xA8, 0x61, 0xCC, 0x38, 0x34, 0xE3, 0x7A, 0x3E, 0xE2, 0x95, 0x2C, 0x84,
+    0x0B, 0x06, 0x04, 0xCF, 0x38, 0xB9, 0xD0, 0x86, 0x5A, 0xE5, 0xEB, 0x30, 0x69, 0x48, 0x6D, 0x96,
+    0x99, 0x69, 0xDA, 0x51, 0xE7, 0x2B, 0xA7, 0x5D, 0xB9, 0x68, 0x1F, 0x48, 0xCB, 0xA0, 0xCC, 0x72,
+    0x33, 0xAD, 0xAA, 0xFC, 0x07, 0x9A, 0xB8, 0xA2, 0x7E, 0x27, 0xE3, 0x05, 0x8D, 0x00, 0x00, 0x00,
+    0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A,
+    0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+    0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77, 0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52,
+    0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x09, 0xCC, 0x49, 0x44, 0x41, 0x54, 0x78,
+    0x01, 0xED, 0x9D, 0x59, 0x68, 0x14, 0x49, 0x18, 0xC7, 0xBF, 0x1C, 0x26, 0x1B, 0xB3, 0x6E, 0xE2,
+    0xAA, 0xF1, 0x24, 0x1A, 0x11, 0xE2, 0x7A, 0xA0, 0x10, 0x51, 0x44, 0x41, 0xF1, 0x61, 0x09, 0x28,
+    0x22, 0x2A, 0xE2, 0x83, 0xA2, 0x22, 0xA2, 0x3E, 0x2F, 0xAB, 0xA0, 0x20, 0x88, 0x20, 0xE8, 0x2A,
+    0xFB, 0xEA, 0x8B, 0x88, 0xE0, 0x93, 0x17, 0xE2, 0x85, 0xEB, 0x3E, 0xA8, 0xB8, 0xA0, 0x08, 0x8B,
+    0xE2, 0x01, 0xE2, 0x83, 0xB8, 0x88, 0x77, 0x44, 0x13, 0x93, 0x68, 0xEE, 0xAD, 0x7F, 0x65, 0xFE,
+    0x6D, 0x75, 0x4D, 0x4F, 0xE6, 0x48, 0x66, 0x7A, 0x8E, 0xFA, 0xA0, 0xF2, 0xD5, 0x5D, 0x5D, 0xBF,
+    0x7F, 0x75, 0xCD, 0x4C, 0x4F, 0x4F, 0xA7, 0x48, 0x62, 0x5B, 0x91, 0x55, 0x64, 0xA7, 0xAD, 0x62,
+    0x89, 0x57, 0x6E, 0xD7, 0xCF, 0xF5, 0x74, 0x5F, 0x9C, 0x09, 0xD8, 0xE5, 0x76, 0x5A, 0x37, 0x0F,
+    0x82, 0xC6, 0x3C, 0x7A, 0x54, 0x64, 0x1C, 0x9E, 0x71, 0x33, 0x1F, 0xF1, 0x42, 0x36, 0x13, 0x2E,
+    0xE2, 0x4C, 0xD3, 0x83, 0x0D, 0xE3, 0xF4, 0x9A, 0x57, 0xA9, 0xFE, 0xDB, 0xFF, 0x87, 0x60, 0x6D,
+    0x5F, 0xAC, 0x8A, 0x09, 0x9E, 0x1E, 0x2D, 0xCC, 0x78, 0x7F, 0x0F, 0x85, 0xFB, 0x17, 0x50, 0x09,
+    0x96, 0x71, 0xFA, 0xDE, 0x18, 0x58, 0x74, 0x7D, 0x53, 0x00, 0xD4, 0x33, 0xE1, 0x13, 0x3C, 0x7C,
+    0x50, 0xDC, 0xAC, 0x1B, 0x63, 0x8C, 0x82, 0xC8, 0xB6, 0xC1, 0x03, 0x38, 0x02, 0xF2, 0xE1, 0xC1,
+    0x89, 0x71, 0x78, 0xA6, 0x55, 0x54, 0x84, 0x02, 0x20, 0xD3, 0x04, 0x0A, 0xE0, 0x25, 0x2A, 0x10,
+    0x3E, 0xE2, 0x4C, 0xC3, 0xA3, 0x2E, 0x45, 0x51, 0x51, 0x6D, 0x6C, 0xCF, 0x74, 0xBE, 0x7B, 0x82,
+    0xC7, 0x3C, 0x4D, 0xC0, 0x3D, 0x2A, 0x0D, 0xF0, 0xF0, 0x8C, 0x23, 0x0D, 0xA3, 0x30, 0x64, 0xD5,
+    0x47, 0x01, 0xFA, 0x8B, 0xBF, 0x83, 0x25, 0x70, 0x78, 0xD4, 0x61, 0x30, 0xF3, 0x0B, 0x59, 0x84,
+    0x81, 0xE0, 0x13, 0x7C, 0xB7, 0xE2, 0xC6, 0x80, 0x3C, 0x1A, 0x45, 0xD0, 0x69, 0x80, 0x05, 0x48,
+    0x06, 0xAE, 0x7C, 0x82, 0x1F, 0xA6, 0xCA, 0xEC, 0x80, 0x36, 0x14, 0x82, 0x22, 0xA8, 0x2C, 0xEF,
+    0x0C, 0x42, 0xBC, 0x10, 0x8C, 0x22, 0x10, 0xA8, 0x09, 0xBE, 0x4B, 0x01, 0x60, 0x00, 0x53, 0xC4,
+    0x4D, 0xE3, 0x19, 0xE1, 0x6D, 0x41, 0x28, 0xB4, 0x45, 0x00, 0xF8, 0x32, 0x15, 0xCA, 0x2D, 0x8F,
+    0x7C, 0x8A, 0xC0, 0x2D, 0x0A, 0x6D, 0x0B, 0xD1, 0xB8, 0xF5, 0x00, 0x28, 0x04, 0xC0, 0x8A, 0x07,
+    0xEC, 0x4E, 0x15, 0x3A, 0x54, 0xC0, 0x42, 0x25, 0x1B, 0xD4, 0x65, 0x7D, 0xE4, 0x51, 0x40, 0x5D,
+    0x01, 0x20, 0x01, 0xF6, 0x07, 0x15, 0x7E, 0x54, 0xE1, 0x67, 0x15, 0xC6, 0xAB, 0x50, 0xA7, 0xC2,
+    0x2F, 0x5B, 0xB7, 0x6E, 0x6D, 0x7C, 0xF5, 0xEA, 0xD5, 0x5F, 0x1D, 0x1D, 0x1D, 0x4D, 0x7D, 0xCE,
+    0x06, 0x24, 0x00, 0x46, 0x60, 0x05, 0x66, 0x60, 0x17, 0x61, 0x08, 0x96, 0x60, 0x0A, 0xB6, 0x60,
+    0x0C, 0xD6, 0x60, 0xAE, 0xC5, 0x41, 0x04, 0x4A, 0x61, 0xB5, 0x0F, 0x57, 0xA1, 0x4A, 0x85, 0x1A,
+    0x15, 0x6A, 0x55, 0xA8, 0x47, 0x47, 0x5D, 0x5D, 0x5D, 0xCD, 0x03, 0x8E, 0xEA, 0x0A, 0xA3, 0x08,
+    0x80, 0x59, 0x44, 0x84, 0xFA, 0x08, 0x4B, 0x30, 0x05, 0x5B, 0x30, 0x06, 0x6B, 0x30, 0x2F, 0x86,
+    0x02, 0x54, 0x02, 0xDB, 0x0A, 0xB7, 0x1D, 0xA8, 0x54, 0xA1, 0x42, 0xA5, 0x52, 0xF3, 0x8F, 0x09,
+    0x13, 0x26, 0xFC, 0xAA, 0xE2, 0xCE, 0x92, 0x24, 0xF0, 0xFA, 0xF5, 0xEB, 0xEB, 0x13, 0x27, 0x4E,
+    0xFC, 0x5D, 0x35, 0x6B, 0x53, 0xE1, 0xAB, 0x0A, 0xDF, 0x54, 0xC0, 0xF6, 0x84, 0x6D, 0x0A, 0xDB,
+    0x55, 0x1F, 0xE0, 0xC3, 0x20, 0x04, 0x03, 0xCF, 0x08, 0x2D, 0xC6, 0xE8, 0xD1, 0xA3, 0x1B, 0x74,
+    0x0D, 0xF7, 0x27, 0x69, 0x02, 0x11, 0x76, 0x58, 0xED, 0x60, 0xA9, 0x57, 0xBC, 0xF2, 0xE4, 0x0C,
+    0xAF, 0x57, 0x3F, 0x3C, 0x33, 0x09, 0x1F, 0x67, 0x83, 0x3E, 0x23, 0xCA, 0xCA, 0xCA, 0x46, 0xA1,
+    0x82, 0xB3, 0xE4, 0x09, 0x44, 0xD8, 0x01, 0x3E, 0x79, 0xDA, 0x22, 0x78, 0x02, 0xB0, 0xF7, 0x20,
+    0x21, 0x58, 0xE6, 0x7C, 0x6A, 0x04, 0x00, 0x3F, 0x0A, 0x3C, 0xBB, 0xE2, 0x16, 0x84, 0xB4, 0x09,
+    0x9F, 0x67, 0x02, 0x1A, 0x3A, 0x1B, 0x1C, 0x01, 0x30, 0xA4, 0x00, 0xE0, 0x4A, 0xCE, 0xBA, 0x57,
+    0x66, 0x20, 0x81, 0x02, 0x18, 0x2B, 0xC0, 0x9B, 0x02, 0xE9, 0x42, 0xF7, 0x27, 0x69, 0x02, 0x64,
+    0x4C, 0xAE, 0xE8, 0xC0, 0x63, 0x4D, 0xC0, 0x5E, 0x46, 0xA4, 0x7B, 0xC2, 0x67, 0x79, 0xD2, 0xA3,
+    0xBA, 0x06, 0x1E, 0x01, 0x30, 0xA4, 0x08, 0xC8, 0xF4, 0xB1, 0x0E, 0x02, 0xCC, 0x0A, 0x5E, 0x0F,
+    0x2E, 0x32, 0x64, 0x04, 0xA2, 0xD8, 0x06, 0x09, 0x80, 0xD1, 0x50, 0x91, 0x61, 0xC8, 0x46, 0x2F,
+    0xD0, 0x8E, 0xC8, 0x31, 0x0A, 0x3E, 0x78, 0xC4, 0x12, 0xA0, 0x40, 0x59, 0x65, 0x7E, 0xDA, 0x4E,
+    0x80, 0xCC, 0x33, 0xF7, 0x8D, 0xE8, 0x04, 0xF0, 0xE1, 0xC8, 0x7C, 0xC2, 0x09, 0x90, 0x79, 0xE6,
+    0xBE, 0x11, 0x9D, 0x00, 0x3E, 0x1C, 0x99, 0x4F, 0xE0, 0x63, 0x72, 0x4E, 0x99, 0xBA, 0x3A, 0x2B,
+    0xD7, 0xAE, 0x5D, 0x93, 0x07, 0x0F, 0x1E, 0xC8, 0xFB, 0xF7, 0xEF, 0xF5, 0xB1, 0xD7, 0xD4, 0xD4,
+    0xC8, 0xDC, 0xB9, 0x73, 0xA5, 0xB1, 0xB1, 0x51, 0xD4, 0xD5, 0xC7, 0x9C, 0x9A, 0x0F, 0xDE, 0x1A,
+    0xF1, 0xA3, 0x32, 0x2E, 0x1A, 0xE1, 0xDB, 0x2F, 0x5C, 0xAF, 0xC6, 0x17, 0x07, 0x3F, 0xA9, 0x50,
+    0xA5, 0x2E, 0x74, 0x5F, 0x57, 0x3E, 0x74, 0xEB, 0xED, 0xED, 0x95, 0x93, 0x27, 0x4F, 0xCA, 0xC5,
+    0x8B, 0x17, 0x05, 0xF1, 0x20, 0x2B, 0x2E, 0x2E, 0x96, 0x95, 0x2B, 0x57, 0xCA, 0xA6, 0x4D, 0x9B,
+    0x04, 0xF1, 0x6C, 0xB0, 0xA2, 0xA2, 0x22, 0x5C, 0xCA, 0x6F, 0x56, 0xA1, 0x45, 0x85, 0x56, 0x15,
+    0xDA, 0x55, 0xC0, 0xB7, 0x65, 0xB8, 0x24, 0xDD, 0x93, 0x13, 0x67, 0x80, 0x5A, 0x04, 0x72, 0xF8,
+    0xF0, 0x61, 0xB9, 0x73, 0xE7, 0x8E, 0x3A, 0xE6, 0xD8, 0x06, 0x61, 0x2E, 0x5C, 0xB8, 0x20, 0xEF,
+    0xDE, 0xBD, 0x93, 0xDD, 0xBB, 0x77, 0x8B, 0x9A, 0x7C, 0xEC, 0xCA, 0x59, 0x52, 0x92, 0x1D, 0xCB,
+    0x24, 0x0E, 0x8C, 0xF3, 0xE7, 0xCF, 0xC7, 0x85, 0x6F, 0x76, 0x01, 0xA1, 0xD0, 0x26, 0x17, 0x2C,
+    0xEB, 0x05, 0x68, 0x6D, 0x6D, 0x95, 0xD3, 0xA7, 0x4F, 0x27, 0xCD, 0x12, 0x6D, 0xD0, 0x36, 0xDB,
+    0x2D, 0xEB, 0x05, 0xB8, 0x7B, 0xF7, 0xAE, 0x7C, 0xFB, 0x86, 0x6F, 0xF2, 0x92, 0x33, 0xB4, 0x41,
+    0xDB, 0x6C, 0xB7, 0xAC, 0x17, 0xE0, 0xE9, 0xD3, 0xA7, 0x29, 0x33, 0x1C, 0x4C, 0xDB, 0x94, 0x07,
+    0x4D, 0xB2, 0x61, 0xD6, 0x0B, 0xD0, 0xDC, 0x8C, 0x37, 0x10, 0xA9, 0xD9, 0x60, 0xDA, 0xA6, 0x36,
+    0x62, 0xF2, 0xAD, 0xB2, 0x5E, 0x80, 0x9E, 0x1E, 0xF3, 0xAE, 0xBE, 0xE4, 0x26, 0x18, 0xEB, 0xED,
+    0x6A, 0x72, 0xBD, 0xA4, 0xB7, 0x76, 0xD6, 0x0B, 0x90, 0xDE, 0xE9, 0x87, 0xDF, 0x7B, 0x5E, 0x0B,
+    0xE0, 0x3E, 0x07, 0x84, 0xBF, 0xC0, 0xB2, 0xFE, 0x08, 0xF2, 0xFA, 0x0C, 0xC8, 0x7A, 0xFA, 0xEA,
+    0x00, 0x9D, 0x00, 0x21, 0xAB, 0xE4, 0x04, 0x70, 0x02, 0xA4, 0x8F, 0x80, 0x7B, 0x11, 0x4E, 0x1F,
+    0xDB, 0xBC, 0xE9, 0xD9, 0x6D, 0x41, 0x21, 0x4B, 0xE9, 0x04, 0x70, 0x02, 0x84, 0x4C, 0x20, 0xE4,
+    0xE1, 0xDD, 0x19, 0xE0, 0x04, 0x48, 0x1F, 0x81, 0x5C, 0x78, 0x17, 0x14, 0xDA, 0x77, 0xC2, 0x8F,
+    0x1E, 0x3D, 0x12, 0x7C, 0xD7, 0x4B, 0xAB, 0xAD, 0xAD, 0x95, 0xEA, 0xEA, 0x6A, 0x26, 0x87, 0xC4,
+    0xC7, 0x12, 0xE0, 0xD3, 0xA7, 0x4F, 0xF2, 0xF2, 0xE5, 0x4B, 0x6F, 0x0C, 0xD4, 0x9B, 0x3D, 0x7B,
+    0xB6, 0x97, 0xCE, 0x64, 0x24, 0x34, 0x01, 0x0E, 0x1D, 0x3A, 0x24, 0x5F, 0xBE, 0x7C, 0xF1, 0xE6,
+    0xBA, 0x65, 0xCB, 0x16, 0x59, 0xB5, 0x6A, 0x95, 0x97, 0x66, 0x64, 0xC4, 0x88, 0x11, 0x8C, 0x26,
+    0xED, 0x63, 0xB5, 0xBD, 0x75, 0xEB, 0x96, 0x9C, 0x38, 0x71, 0xC2, 0xEB, 0x0F, 0xF5, 0x4E, 0x9D,
+    0x3A, 0xE5, 0xA5, 0x33, 0x19, 0x09, 0xED, 0x35, 0x60, 0xD4, 0x28, 0xFF, 0x4F, 0xCF, 0x3E, 0x7E,
+    0xFC, 0x18, 0x38, 0xEF, 0x49, 0x93, 0x26, 0x05, 0xE6, 0x27, 0x92, 0x19, 0xAB, 0xAD, 0x3D, 0x96,
+    0x7D, 0x2C, 0x89, 0xF4, 0x3D, 0x54, 0x75, 0x42, 0x13, 0x60, 0xE4, 0xC8, 0x91, 0xBE, 0x39, 0xBC,
+    0x79, 0xF3, 0xC6, 0x97, 0x66, 0x62, 0xE1, 0xC2, 0x85, 0x8C, 0x26, 0xED, 0x17, 0x2C, 0x58, 0x10,
+    0xD8, 0xC6, 0x1E, 0xCB, 0x3E, 0x96, 0xC0, 0x46, 0x69, 0xCA, 0x0C, 0x4D, 0x80, 0xE9, 0xD3, 0xA7,
+    0xFB, 0xA6, 0x84, 0x3B, 0xDD, 0x82, 0xBE, 0x7C, 0xC7, 0x2A, 0x5E, 0xB4, 0x68, 0x91, 0xAF, 0x6E,
+    0x22, 0x89, 0x25, 0x4B, 0x96, 0xC8, 0xF8, 0xF1, 0xF8, 0x81, 0xBA, 0xDF, 0x30, 0x06, 0xC6, 0x32,
+    0xCD, 0x3E, 0x16, 0xB3, 0x2C, 0xDD, 0xF1, 0xD0, 0x04, 0x98, 0x3F, 0x7F, 0xBE, 0x6F, 0x6E, 0xEA,
+    0x97, 0xE5, 0x72, 0xEF, 0xDE, 0x3D, 0x5F, 0x1E, 0x13, 0xDB, 0xB7, 0x6F, 0x17, 0xDC, 0x7E, 0x98,
+    0xA8, 0x8D, 0x1B, 0x37, 0x4E, 0xB6, 0x6D, 0xDB, 0x16, 0x58, 0x1D, 0x63, 0x60, 0x2C, 0xD3, 0xEC,
+    0x63, 0x31, 0xCB, 0xD2, 0x1D, 0x0F, 0x4D, 0x80, 0xA9, 0x53, 0xA7, 0xCA, 0x98, 0x31, 0x63, 0x7C,
+    0xF3, 0x3B, 0x77, 0xEE, 0x5C, 0xE0, 0x6D, 0x87, 0x55, 0x55, 0x55, 0x72, 0xE0, 0xC0, 0x01, 0x99,
+    0x3C, 0x79, 0xB2, 0xAF, 0x7E, 0x50, 0x62, 0xCA, 0x94, 0x29, 0xBA, 0x6E, 0xD0, 0x0B, 0x30, 0xBE,
+    0x23, 0xC6, 0x18, 0xA6, 0xE1, 0x18, 0x70, 0x2C, 0x61, 0x59, 0x68, 0x02, 0x60, 0xC2, 0xB8, 0x8F,
+    0xD3, 0xB4, 0x17, 0x2F, 0x5E, 0xC8, 0xD5, 0xAB, 0x57, 0xCD, 0x2C, 0x2F, 0x8E, 0x55, 0x7D, 0xF4,
+    0xE8, 0x51, 0xD9, 0xBC, 0x79, 0x73, 0xE0, 0xD9, 0x80, 0x33, 0x04, 0xEF, 0xA4, 0x8E, 0x1C, 0x39,
+    0x12, 0x58, 0x8E, 0x8E, 0xD0, 0x37, 0xC6, 0x30, 0xCD, 0x3E, 0x06, 0xB3, 0x2C, 0x13, 0xF1, 0x50,
+    0x6F, 0xCE, 0xC5, 0x56, 0xB0, 0x73, 0xE7, 0x4E, 0xF9, 0xF0, 0xE1, 0x83, 0x37, 0xD7, 0x8A, 0x8A,
+    0x0A, 0x39, 0x78, 0xF0, 0x60, 0xDC, 0x55, 0xA9, 0x9E, 0xC3, 0xE0, 0xB5, 0xC3, 0x2A, 0x56, 0xCF,
+    0xB3, 0xF0, 0xFA, 0x08, 0x8A, 0x3C, 0x7F, 0xFE, 0x5C, 0xF6, 0xEC, 0xD9, 0x23, 0x5F, 0xBF, 0xE2,
+    0x91, 0x0D, 0xFD, 0xA6, 0x1E, 0x25, 0x20, 0xC7, 0x8E, 0x1D, 0x93, 0x61, 0xC3, 0x70, 0x5F, 0x72,
+    0x7A, 0x4C, 0x7D, 0xC6, 0x18, 0xF0, 0xE6, 0xDC, 0x50, 0xCF, 0x00, 0x4C, 0x7C, 0xC3, 0x86, 0x0D,
+    0xBE, 0x99, 0x03, 0xD0, 0xFE, 0xFD, 0xFB, 0xE5, 0xED, 0xDB, 0xB7, 0xBE, 0x7C, 0x3B, 0x01, 0xE0,
+    0x73, 0xE6, 0xCC, 0xD1, 0x21, 0x1E, 0x7C, 0xF4, 0x85, 0x3E, 0x4D, 0xF8, 0xE8, 0x6F, 0xE3, 0xC6,
+    0x8D, 0x69, 0x85, 0x6F, 0x1F, 0x73, 0x50, 0x3A, 0x54, 0x01, 0x70, 0x40, 0x4B, 0x97, 0x2E, 0x95,
+    0x65, 0xCB, 0x96, 0xF9, 0x8E, 0xED, 0xF3, 0xE7, 0xCF, 0xFA, 0xEE, 0xE6, 0x87, 0x0F, 0x1F, 0xFA,
+    0xF2, 0x53, 0x49, 0xA0, 0x0F, 0xDC, 0x29, 0x8D, 0x3E, 0x4D, 0xC3, 0x98, 0x18, 0x3B, 0x6C, 0x0B,
+    0x75, 0x0B, 0xE2, 0xE4, 0xB1, 0x15, 0xED, 0xDA, 0xB5, 0x4B, 0xB0, 0x4D, 0x98, 0x86, 0x4B, 0x04,
+    0xAB, 0x57, 0xAF, 0x96, 0xB5, 0x6B, 0xD7, 0xCA, 0xF0, 0xE1, 0xF8, 0xD9, 0x42, 0xE2, 0xD6, 0xDE,
+    0xDE, 0x2E, 0x67, 0xCF, 0x9E, 0xD5, 0x77, 0x49, 0x9B, 0x97, 0x3C, 0xD0, 0x43, 0x5D, 0x5D, 0x9D,
+    0xBE, 0xDD, 0x5D, 0x3D, 0x4C, 0x23, 0xF1, 0x0E, 0x53, 0xAC, 0x19, 0x6F, 0x0B, 0xCA, 0x0A, 0x01,
+    0x30, 0x37, 0xAC, 0x50, 0x6C, 0x13, 0xB6, 0x08, 0x28, 0xAB, 0xAC, 0xAC, 0x94, 0xE5, 0xCB, 0x97,
+    0xEB, 0x15, 0x1B, 0xEF, 0x17, 0x30, 0xF8, 0x05, 0xCD, 0xCD, 0x9B, 0x37, 0xE5, 0xCA, 0x95, 0x2B,
+    0xD2, 0xD6, 0x86, 0xC7, 0xF4, 0xF8, 0x0D, 0xEF, 0x92, 0x30, 0xCE, 0x50, 0x5F, 0x77, 0xF2, 0x8F,
+    0xF2, 0x3D, 0x95, 0x33, 0x02, 0xE0, 0x90, 0xB1, 0x6A, 0xF1, 0x02, 0x8C, 0x0B, 0x75, 0xB1, 0x6C,
+    0xEC, 0xD8, 0xB1, 0x32, 0x73, 0xE6, 0x4C, 0xC1, 0x0B, 0x28, 0x21, 0x42, 0xBC, 0xA6, 0xA6, 0x26,
+    0x79, 0xF2, 0xE4, 0x89, 0xFE, 0x71, 0x46, 0xAC, 0xB6, 0xB3, 0x66, 0xCD, 0x92, 0xBD, 0x7B, 0xF7,
+    0x26, 0x7D, 0x36, 0xC5, 0xEA, 0x2F, 0x91, 0xFC, 0x9C, 0x12, 0x00, 0x13, 0xEA, 0xEE, 0xEE, 0xD6,
+    0x5B, 0xC7, 0x99, 0x33, 0x67, 0x74, 0x3C, 0x91, 0x49, 0xC6, 0xAB, 0x53, 0x5A, 0x5A, 0x2A, 0x6B,
+    0xD6, 0xAC, 0x91, 0x75, 0xEB, 0xD6, 0x09, 0xE2, 0x99, 0xB4, 0x9C, 0x13, 0x80, 0x70, 0x70, 0xB9,
+    0x18, 0x6F, 0x11, 0x1F, 0x3F, 0x7E, 0xCC, 0xAC, 0x94, 0xFC, 0x8C, 0x19, 0x33, 0x64, 0xC7, 0x8E,
+    0x1D, 0x09, 0x7D, 0x88, 0x4B, 0x69, 0x80, 0x38, 0x8D, 0x72, 0x56, 0x00, 0xCE, 0x0B, 0xAF, 0x09,
+    0x97, 0x2E, 0x5D, 0x92, 0xDB, 0xB7, 0x6F, 0x47, 0x5D, 0x42, 0x60, 0x1D, 0xDB, 0xE3, 0xED, 0xED,
+    0xE2, 0xC5, 0x8B, 0x65, 0xC5, 0x8A, 0x15, 0x32, 0x6D, 0xDA, 0x34, 0xBB, 0x38, 0xA3, 0xE9, 0x9C,
+    0x17, 0x80, 0xB4, 0x3A, 0x3B, 0x3B, 0xE5, 0xD9, 0xB3, 0x67, 0x7A, 0x9F, 0xBF, 0x71, 0xE3, 0x86,
+    0xD8, 0x57, 0x34, 0x71, 0xE1, 0x0D, 0x6F, 0x2B, 0xB1, 0xE2, 0xEB, 0xEB, 0xEB, 0xA5, 0xBC, 0xBC,
+    0x9C, 0x4D, 0x43, 0xF5, 0xF1, 0x04, 0xC8, 0xEC, 0x86, 0x38, 0x08, 0x14, 0x78, 0xCB, 0x88, 0x17,
+    0x51, 0x84, 0x96, 0x96, 0x16, 0xB9, 0x7C, 0xF9, 0xB2, 0xAF, 0xB7, 0x86, 0x86, 0x06, 0x59, 0xBF,
+    0x7E, 0xBD, 0x2F, 0x2F, 0x17, 0x12, 0xC5, 0xB9, 0x70, 0x90, 0xF9, 0x7C, 0x8C, 0x4E, 0x80, 0x90,
+    0xD5, 0x75, 0x02, 0x38, 0x01, 0x42, 0x26, 0x10, 0xF2, 0xF0, 0xEE, 0x0C, 0x70, 0x02, 0x84, 0x4C,
+    0x20, 0xE4, 0xE1, 0xDD, 0x19, 0x10, 0xB2, 0x00, 0x59, 0x73, 0x35, 0x34, 0x64, 0x0E, 0x69, 0x1B,
+    0x3E, 0xDE, 0x07, 0x31, 0x77, 0x06, 0xA4, 0x0D, 0x7D, 0x62, 0x1D, 0x3B, 0x01, 0x12, 0xE3, 0x94,
+    0xB6, 0x5A, 0x4E, 0x80, 0xB4, 0xA1, 0x4D, 0xAC, 0x63, 0x27, 0x40, 0x62, 0x9C, 0xD2, 0x56, 0xCB,
+    0x09, 0x90, 0x36, 0xB4, 0x89, 0x75, 0x1C, 0x4B, 0x00, 0xDC, 0xB8, 0xCF, 0x90, 0x58, 0x4F, 0xAE,
+    0x56, 0x2C, 0x02, 0xE4, 0x08, 0x1F, 0x65, 0x41, 0x02, 0x04, 0x56, 0x8C, 0x6A, 0xE9, 0x32, 0x52,
+    0x21, 0x10, 0xC5, 0x96, 0x02, 0xB0, 0xC0, 0xF4, 0x78, 0x36, 0x64, 0xF0, 0xF3, 0x21, 0x53, 0x19,
+    0xBA, 0x70, 0xDB, 0x90, 0xA3, 0xC9, 0x16, 0x34, 0x74, 0x1A, 0x02, 0x04, 0x15, 0x20, 0x0F, 0xC1,
+    0x09, 0xA0, 0x20, 0x0C, 0xD2, 0xC0, 0x90, 0x3C, 0xA3, 0x58, 0xF3, 0x0C, 0xC0, 0x18, 0xAC, 0x44,
+    0xC5, 0xF8, 0xBF, 0x11, 0x07, 0x39, 0x7E, 0xC1, 0x37, 0x27, 0x47, 0x72, 0x25, 0x67, 0x0D, 0xC6,
+    0x14, 0x00, 0x19, 0x2C, 0x44, 0x65, 0xFE, 0x6F, 0x44, 0x5D, 0xD1, 0xFD, 0x49, 0x99, 0x00, 0xFE,
+    0x61, 0x1B, 0x58, 0x9A, 0x67, 0x82, 0xD7, 0x19, 0x05, 0x08, 0x02, 0x8F, 0x86, 0x5D, 0xEA, 0xCB,
+    0xF0, 0xE0, 0x1F, 0x6F, 0x79, 0x5D, 0xB8, 0x48, 0x2C, 0x02, 0x11, 0x76, 0xF8, 0x35, 0x08, 0x58,
+    0x06, 0x0A, 0x61, 0x0B, 0x00, 0x21, 0xB8, 0xFA, 0xD1, 0xB0, 0x53, 0xDD, 0x71, 0xF6, 0xAF, 0xF2,
+    0xCE, 0x52, 0x20, 0x10, 0x61, 0xC7, 0x7F, 0x5D, 0x68, 0x9F, 0x05, 0x60, 0xED, 0x7B, 0x60, 0x93,
+    0x09, 0x5F, 0xAF, 0x7E, 0x55, 0xDE, 0xB1, 0x6F, 0xDF, 0xBE, 0x3F, 0xD5, 0xDD, 0x6A, 0x78, 0xF0,
+    0xB4, 0xB3, 0x24, 0x08, 0x80, 0x19, 0xD8, 0xA9, 0x26, 0x7C, 0x50, 0xB7, 0x7D, 0x06, 0xE8, 0xDE,
+    0xF0, 0xE4, 0x74, 0x1A, 0x2E, 0x4D, 0x47, 0x85, 0xFB, 0xF7, 0xEF, 0xB7, 0xA9, 0x1F, 0x43, 0xFC,
+    0x3D, 0x6F, 0xDE, 0xBC, 0x1A, 0x75, 0xAF, 0x4D, 0x75, 0x49, 0x49, 0x49, 0x72, 0xB7, 0x29, 0xB3,
+    0xF7, 0x02, 0xF1, 0xD8, 0x76, 0xD4, 0xC3, 0xC3, 0xFF, 0xF9, 0x4D, 0xD9, 0xF1, 0xE3, 0xC7, 0xFF,
+    0x53, 0xD3, 0x86, 0x00, 0x3C, 0x0B, 0x4C, 0x11, 0xF4, 0x6B, 0x82, 0x09, 0x1C, 0xDB, 0x11, 0x02,
+    0xEE, 0x15, 0x42, 0xC0, 0xBD, 0xDB, 0x08, 0xB8, 0xC3, 0xC9, 0xF4, 0xFC, 0xDF, 0x88, 0x10, 0x8F,
+    0x6D, 0xD0, 0x4F, 0x21, 0x1A, 0x77, 0x0D, 0x6E, 0xDB, 0xDC, 0x39, 0x00, 0x9C, 0xE0, 0xE9, 0x91,
+    0x87, 0x72, 0x04, 0xD4, 0xD7, 0x02, 0x98, 0x37, 0x66, 0xA1, 0x33, 0x76, 0x88, 0xFD, 0x8A, 0x3F,
+    0x25, 0x44, 0x1E, 0xDF, 0x11, 0xA1, 0x13, 0xB4, 0x01, 0x7C, 0x04, 0x80, 0xE7, 0xEB, 0x48, 0xA1,
+    0x89, 0x00, 0x2E, 0x30, 0x0D, 0x52, 0x79, 0x30, 0x22, 0x27, 0xB0, 0xB3, 0x03, 0xCA, 0x58, 0x97,
+    0x6D, 0x35, 0x4C, 0x2F, 0x11, 0xA9, 0xA0, 0x9C, 0x67, 0x28, 0x43, 0x23, 0x76, 0x0C, 0x01, 0x6C,
+    0xF8, 0x26, 0x78, 0x33, 0xEE, 0x75, 0x92, 0x87, 0x11, 0x93, 0x19, 0x19, 0xC1, 0x53, 0x04, 0xF2,
+    0xE2, 0x8A, 0x37, 0xF3, 0x4D, 0x11, 0xFA, 0xCC, 0x33, 0x00, 0x9C, 0xD8, 0x19, 0x99, 0x31, 0xCD,
+    0x0E, 0xB1, 0xDA, 0xCD, 0x95, 0x6F, 0x02, 0x37, 0xE3, 0x6C, 0x9F, 0xCF, 0x1E, 0x6C, 0x68, 0xE4,
+    0x04, 0x0F, 0x56, 0x5C, 0xB4, 0x8C, 0x33, 0x4D, 0xF8, 0x6C, 0xA7, 0xB7, 0x10, 0x26, 0x00, 0x90,
+    0x10, 0xE1, 0x01, 0x9B, 0x3E, 0x28, 0x6E, 0xD6, 0x65, 0x1F, 0x85, 0xE8, 0x29, 0x04, 0x3C, 0x85,
+    0x20, 0x68, 0x78, 0x33, 0x6E, 0xD7, 0xF5, 0x80, 0x03, 0x9C, 0x0D, 0x94, 0x69, 0xC2, 0x47, 0x9A,
+    0x81, 0xF5, 0x59, 0x07, 0xE9, 0x42, 0x36, 0xC2, 0x07, 0x03, 0xC6, 0xE9, 0x21, 0x00, 0xCC, 0x84,
+    0xEF, 0xA5, 0x83, 0x00, 0x32, 0x8F, 0x1E, 0x95, 0x19, 0x87, 0x67, 0xDC, 0xCC, 0x47, 0xBC, 0x90,
+    0x8D, 0x70, 0xC1, 0x80, 0xE0, 0x19, 0x27, 0x17, 0xD6, 0xA1, 0xD7, 0xF9, 0x26, 0x4C, 0x56, 0xA4,
+    0xB7, 0xCB, 0xEC, 0x34, 0xEB, 0xD1, 0xC7, 0x2B, 0x67, 0xBD, 0x7C, 0xF1, 0x3E, 0x90, 0x01, 0x93,
+    0xB2, 0xCB, 0xED, 0xB4, 0x6E, 0xF2, 0x3F, 0x8E, 0x2C, 0xA9, 0xB8, 0x4D, 0x0C, 0xA3, 0xEB, 0x00,
+    0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 0x89, 0x50, 0x4E, 0x47, 0x0D,
+    0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x60, 0x00,
+    0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00, 0xE2, 0x98, 0x77, 0x38, 0x00, 0x00, 0x00, 0x01,
+    0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C, 0xE9, 0x00, 0x00, 0x09, 0x42, 0x49, 0x44, 0x41,
+    0x54, 0x78, 0x01, 0xED, 0x9D, 0x3D, 0x6C, 0x14, 0x47, 0x18, 0x86, 0xC7, 0x7F, 0xB1, 0x63, 0x62,
+    0x40, 0x60, 0x59, 0xA0, 0x28, 0x41, 0x58, 0x71, 0x65, 0xD1, 0x20, 0x04, 0x28, 0xA2, 0x43, 0x4A,
+    0x13, 0x22, 0x6A, 0x6A, 0x0A, 0x6A, 0x90, 0x50, 0x08, 0xA4, 0x8A, 0x82, 0x80, 0x06, 0x8A, 0x54,
+    0x29, 0xA8, 0xA1, 0x04, 0xC9, 0x69, 0xA2, 0xD0, 0x11, 0x09, 0x08, 0x94, 0x69, 0xB1, 0x1C, 0x09,
+    0x03, 0x12, 0x20, 0x62, 0x02, 0x21, 0xF8, 0x2F, 0xF3, 0xAC, 0xEF, 0x5D, 0xCD, 0xCD, 0xFD, 0xAC,
+    0xEF, 0x67, 0x77, 0xD6, 0xBE, 0xF9, 0xA4, 0xF1, 0xCC, 0xCE, 0xEC, 0x7C, 0xB3, 0xF3, 0xBC, 0x33,
+    0xB3, 0x7B, 0xB7, 0xEB, 0xDB, 0x3E, 0xD3, 0xDC, 0xFA, 0xBC, 0x62, 0x7F, 0xDB, 0x2B, 0x36, 0x59,
+    0xE5, 0xFE, 0xFE, 0x1B, 0x75, 0x7B, 0x35, 0xE3, 0xC0, 0xFD, 0x72, 0x7F, 0x3B, 0xAD, 0xDE, 0x08,
+    0x98, 0xF2, 0x15, 0x53, 0x41, 0x69, 0x62, 0xA5, 0xDD, 0x7C, 0xD2, 0xBD, 0x68, 0x2E, 0x5C, 0xD2,
+    0xDA, 0x56, 0x0C, 0x13, 0xA5, 0x15, 0xA7, 0x9C, 0x06, 0xD3, 0xD4, 0x5A, 0x42, 0x60, 0xDD, 0x58,
+    0xC0, 0xFD, 0x98, 0x1A, 0xCA, 0xF3, 0xDC, 0xF4, 0xD4, 0x26, 0x50, 0x05, 0x56, 0x69, 0x3F, 0xF6,
+    0x81, 0x68, 0xFF, 0xBA, 0x23, 0x59, 0x50, 0xDD, 0xB8, 0xDF, 0x7A, 0x50, 0x20, 0x9F, 0xB4, 0xCA,
+    0x71, 0x4E, 0xBA, 0x17, 0x4D, 0x20, 0x05, 0x7C, 0xC5, 0x42, 0x20, 0x4D, 0xAC, 0xA0, 0x32, 0x37,
+    0x86, 0x15, 0xDB, 0xA6, 0xDE, 0x0C, 0x10, 0x58, 0x01, 0x1F, 0xB0, 0xFB, 0x91, 0xF6, 0x63, 0x57,
+    0x08, 0x7C, 0x61, 0xBD, 0x22, 0x44, 0x02, 0x6F, 0xAD, 0xCB, 0x29, 0x70, 0xF2, 0x80, 0xBE, 0xDC,
+    0x20, 0xA6, 0x4C, 0x96, 0xD6, 0x97, 0x00, 0x82, 0xAE, 0x58, 0xC0, 0x81, 0x4E, 0x18, 0xAA, 0xC4,
+    0xEC, 0xAF, 0x3C, 0x09, 0xA4, 0x3A, 0xB6, 0x28, 0xB1, 0xCD, 0x2E, 0x42, 0x0A, 0xCF, 0xF6, 0x96,
+    0xB4, 0xC0, 0x0B, 0x3E, 0x02, 0x2C, 0xD9, 0x40, 0xBC, 0x68, 0x03, 0x3C, 0x48, 0x63, 0xAE, 0x08,
+    0x6C, 0xAF, 0x4A, 0x00, 0x36, 0x30, 0x76, 0x76, 0xE1, 0x03, 0xDE, 0x0F, 0xD4, 0x91, 0x10, 0xAE,
+    0x08, 0x36, 0xBB, 0xE7, 0x66, 0x80, 0x0F, 0x1F, 0xF0, 0x04, 0xC0, 0x13, 0xE0, 0x43, 0xEC, 0x1A,
+    0x22, 0xA4, 0x22, 0x02, 0x52, 0x23, 0x58, 0xB1, 0x04, 0x00, 0xFC, 0x47, 0x95, 0x30, 0xEC, 0xA4,
+    0xC9, 0xD3, 0x8C, 0xD0, 0xB2, 0xA4, 0xBA, 0xB6, 0xA8, 0x67, 0xCC, 0x1D, 0xFD, 0x8C, 0x70, 0x8D,
+    0xF8, 0x0F, 0x36, 0xAD, 0x00, 0x4B, 0xD8, 0xC8, 0x54, 0xC7, 0xCD, 0x4B, 0x47, 0x3D, 0x62, 0x00,
+    0x77, 0x8B, 0x0D, 0xDB, 0x6C, 0x98, 0xB0, 0xE1, 0x33, 0x1B, 0xA6, 0x6C, 0xD8, 0x77, 0xEA, 0xD4,
+    0xA9, 0x6F, 0x1E, 0x3F, 0x7E, 0x3C, 0xB3, 0xB0, 0xB0, 0x30, 0xBB, 0xBA, 0xBA, 0xBA, 0x6C, 0x43,
+    0xB4, 0x6A, 0x02, 0xCB, 0xB0, 0x81, 0x11, 0xAC, 0x60, 0x56, 0x61, 0x07, 0x43, 0x58, 0xC2, 0x14,
+    0xB6, 0x30, 0x86, 0x75, 0x2A, 0x0E, 0x6A, 0xB0, 0xC1, 0xA8, 0x1E, 0xB1, 0x61, 0xCC, 0x86, 0x71,
+    0x1B, 0x3E, 0xB5, 0xE1, 0x0B, 0x1B, 0xF6, 0xDD, 0xBA, 0x75, 0xEB, 0xDB, 0xA5, 0xA5, 0xA5, 0xB7,
+    0xD5, 0xED, 0xC5, 0xAD, 0x46, 0x04, 0x60, 0x05, 0x33, 0xD8, 0x55, 0x18, 0xC2, 0x12, 0xA6, 0xB0,
+    0x85, 0x31, 0xAC, 0x13, 0x01, 0xDC, 0x25, 0x84, 0x0C, 0x9D, 0x70, 0xD9, 0x81, 0x65, 0x67, 0xC4,
+    0xAA, 0x39, 0x79, 0xFA, 0xF4, 0xE9, 0x9F, 0x06, 0x06, 0x06, 0x46, 0xED, 0x76, 0xB4, 0x75, 0x10,
+    0xE8, 0xEF, 0xEF, 0x1F, 0x9A, 0x9A, 0x9A, 0xFA, 0xF2, 0xF9, 0xF3, 0xE7, 0xBF, 0x3D, 0x7A, 0xF4,
+    0x68, 0xC1, 0x56, 0xD1, 0x09, 0x9A, 0x58, 0xE7, 0x80, 0xE4, 0x3C, 0xA0, 0xD1, 0x4F, 0xCC, 0xB4,
+    0x00, 0x3C, 0x53, 0xE4, 0x63, 0x1B, 0x00, 0xBE, 0xC5, 0x4E, 0xA9, 0x1F, 0xF7, 0xEE, 0xDD, 0xFB,
+    0xB5, 0x4D, 0x47, 0x6B, 0x91, 0xC0, 0xEC, 0xEC, 0xEC, 0x2F, 0x93, 0x93, 0x93, 0xDF, 0xDB, 0x6A,
+    0x6F, 0x6D, 0x78, 0x67, 0xC3, 0xBF, 0x36, 0x70, 0x7E, 0xE0, 0xC4, 0xCC, 0xC9, 0x7A, 0x95, 0x51,
+    0x8F, 0x21, 0x80, 0xC4, 0xD0, 0x65, 0x66, 0x72, 0x4E, 0x18, 0x1F, 0x1F, 0x9F, 0x4E, 0xF6, 0x88,
+    0x7F, 0x5A, 0x26, 0x50, 0x61, 0xA7, 0x35, 0x5F, 0x5C, 0x93, 0xA5, 0xA7, 0xC2, 0x3B, 0x59, 0x87,
+    0x70, 0x2C, 0x01, 0x5C, 0x11, 0x92, 0x19, 0x31, 0x36, 0x36, 0xF6, 0x79, 0xCB, 0x2D, 0xC7, 0x0A,
+    0x09, 0x81, 0x0A, 0x3B, 0x56, 0x15, 0x58, 0xBA, 0xCB, 0xBD, 0x78, 0xA7, 0x02, 0x08, 0x99, 0x0A,
+    0x74, 0x3E, 0x50, 0x25, 0x95, 0xC7, 0xB8, 0x35, 0x02, 0x3E, 0x47, 0xF1, 0x4D, 0xBD, 0x68, 0x09,
+    0x22, 0x43, 0x85, 0xE4, 0x29, 0x20, 0x40, 0xB4, 0xCE, 0x08, 0x68, 0x10, 0x8B, 0xA9, 0x38, 0x27,
+    0x5E, 0xC9, 0x24, 0x03, 0x73, 0x63, 0xD2, 0x6E, 0x59, 0xB2, 0x43, 0xFC, 0xD3, 0x16, 0x01, 0x97,
+    0xA5, 0xCB, 0x18, 0x67, 0x7D, 0x40, 0xC6, 0x6A, 0x0A, 0x2A, 0x79, 0x2A, 0x4F, 0x76, 0x8A, 0x7F,
+    0xDA, 0x22, 0xA0, 0x81, 0x5C, 0x8F, 0x71, 0xCD, 0x39, 0x80, 0x16, 0xB4, 0x63, 0x5B, 0xAD, 0xC5,
+    0x4A, 0x4D, 0x09, 0xD4, 0xB0, 0x6D, 0x34, 0xC2, 0xD9, 0x51, 0xA1, 0xA9, 0xC7, 0x58, 0x98, 0x49,
+    0x40, 0x1C, 0x6B, 0xE0, 0x53, 0xB3, 0x91, 0x00, 0x99, 0x5E, 0xE3, 0x0E, 0xDD, 0x21, 0x10, 0x05,
+    0xE8, 0x0E, 0xC7, 0xB6, 0xBD, 0xF0, 0x01, 0x61, 0x43, 0xDA, 0xF1, 0xE3, 0xC7, 0xAB, 0x8E, 0xFB,
+    0xF6, 0xED, 0xDB, 0x55, 0xDB, 0x1B, 0x65, 0x23, 0xCE, 0x80, 0xC0, 0x4A, 0x45, 0x01, 0xA2, 0x00,
+    0x81, 0x09, 0x04, 0x6E, 0x3E, 0xCE, 0x80, 0x28, 0x40, 0x60, 0x02, 0x81, 0x9B, 0x0F, 0x36, 0x03,
+    0x1E, 0x3E, 0x7C, 0x68, 0xEE, 0xDE, 0xBD, 0x1B, 0xB8, 0xFB, 0x26, 0x39, 0x06, 0x8E, 0x25, 0x94,
+    0x05, 0xB9, 0x0C, 0xA5, 0xC3, 0x97, 0x2F, 0x5F, 0x36, 0x2B, 0x2B, 0xDC, 0x9D, 0x33, 0xE6, 0xC8,
+    0x91, 0x23, 0x41, 0xFA, 0xCF, 0x00, 0xB8, 0x7A, 0xF5, 0xAA, 0xB1, 0xB7, 0x10, 0xCD, 0xB9, 0x73,
+    0xE7, 0xCC, 0x81, 0x03, 0x07, 0x0A, 0x3F, 0x0E, 0x3E, 0x1E, 0xF3, 0x75, 0x29, 0x41, 0xF7, 0x81,
+    0xB9, 0x15, 0xF9, 0x89, 0x0D, 0x5B, 0x6D, 0xD8, 0x66, 0x6F, 0x3C, 0xFF, 0x6A, 0xE3, 0xAE, 0x99,
+    0xE0, 0x2F, 0x2E, 0xAE, 0x3D, 0x2E, 0x63, 0xEF, 0x35, 0x9B, 0x33, 0x67, 0xCE, 0x14, 0x2E, 0x82,
+    0xE0, 0x2F, 0x2F, 0xF3, 0x34, 0x89, 0xED, 0xFC, 0xD0, 0x50, 0x2E, 0x22, 0xF4, 0xF5, 0xF5, 0x7D,
+    0x65, 0xDD, 0xFF, 0x6D, 0x03, 0xF7, 0x86, 0xFF, 0xB1, 0x81, 0x5B, 0x93, 0xFF, 0xD9, 0x00, 0x80,
+    0xE5, 0xC2, 0x97, 0xA0, 0xF7, 0xEF, 0xDF, 0xA7, 0x23, 0xDF, 0x1E, 0x80, 0x01, 0x00, 0xA3, 0xB0,
+    0xC8, 0xE5, 0xC8, 0x87, 0xCF, 0x71, 0x30, 0x1B, 0x39, 0xB6, 0xA2, 0xAD, 0x70, 0x01, 0x58, 0x6E,
+    0x18, 0xF1, 0x8C, 0x7C, 0x59, 0x91, 0x22, 0xD4, 0x83, 0x1F, 0x6A, 0x16, 0xD2, 0xFF, 0xC2, 0x05,
+    0xA0, 0xD1, 0x66, 0x22, 0xDC, 0xBB, 0x77, 0x8F, 0x5D, 0x72, 0x31, 0x7C, 0x33, 0xDB, 0xB4, 0xEC,
+    0xD0, 0x48, 0x48, 0xF8, 0xB4, 0x1F, 0x44, 0x00, 0x1A, 0xAE, 0x27, 0xC2, 0xF6, 0xED, 0xDB, 0xCD,
+    0x9E, 0x3D, 0x7B, 0x28, 0xCE, 0xC5, 0xF0, 0x4D, 0x1B, 0xB2, 0xD0, 0xF0, 0x39, 0x8E, 0x60, 0x02,
+    0xD0, 0xB8, 0x2B, 0xC2, 0xCE, 0x9D, 0x3B, 0xCD, 0xC5, 0x8B, 0x17, 0xCD, 0xEE, 0xDD, 0xBB, 0x29,
+    0xCA, 0xC5, 0xF0, 0x4D, 0x1B, 0xB4, 0x55, 0x06, 0xF8, 0x74, 0xB2, 0xF0, 0xAB, 0xA0, 0x7A, 0x64,
+    0x59, 0x1A, 0x18, 0x9D, 0x59, 0xF0, 0x5F, 0xBE, 0x7C, 0x69, 0xEE, 0xDF, 0xBF, 0x6F, 0xB8, 0x92,
+    0x7A, 0xF6, 0xEC, 0x99, 0x79, 0xF5, 0xEA, 0x55, 0xE2, 0x6E, 0xC7, 0x8E, 0x1D, 0x66, 0xD7, 0xAE,
+    0x5D, 0xC9, 0x65, 0xE4, 0xA1, 0x43, 0x87, 0x12, 0xC0, 0xF5, 0xDA, 0x51, 0xDE, 0xD3, 0xA7, 0x4F,
+    0xCD, 0xDC, 0xDC, 0x9C, 0x39, 0x7C, 0xF8, 0xB0, 0xB2, 0x72, 0x8B, 0xB3, 0xAE, 0x82, 0x4A, 0x21,
+    0x40, 0x56, 0xEF, 0x01, 0x7D, 0xE3, 0xC6, 0x0D, 0x73, 0xE7, 0xCE, 0x9D, 0xAA, 0xF5, 0xBB, 0x5E,
+    0x3D, 0x46, 0xF6, 0xD1, 0xA3, 0x47, 0xCD, 0x89, 0x13, 0x27, 0x0C, 0xC2, 0x84, 0xB6, 0x0D, 0x2F,
+    0xC0, 0x83, 0x07, 0x0F, 0xCC, 0xB5, 0x6B, 0xD7, 0xCC, 0xBB, 0x77, 0x5C, 0x3E, 0xAF, 0xDF, 0x46,
+    0x47, 0x47, 0x8D, 0x7D, 0xA6, 0xD5, 0x1C, 0x3C, 0x78, 0x70, 0xFD, 0x95, 0x72, 0xD8, 0x33, 0x4B,
+    0x80, 0xA0, 0xE7, 0x80, 0xAC, 0xFE, 0xCE, 0xCC, 0xCC, 0x98, 0x4B, 0x97, 0x2E, 0xB5, 0x0C, 0x1F,
+    0xBF, 0x08, 0x46, 0x5D, 0x7C, 0x94, 0xD9, 0x4A, 0x2B, 0x00, 0x23, 0xFF, 0xFA, 0xF5, 0xEB, 0x55,
+    0x1F, 0xDA, 0x5A, 0x05, 0xC9, 0x87, 0x2B, 0x7C, 0xE0, 0xAB, 0xAC, 0x56, 0x4A, 0x01, 0x58, 0xF3,
+    0x59, 0x76, 0xF4, 0x5D, 0x51, 0x27, 0xF0, 0xF0, 0x81, 0x2F, 0x9D, 0xB0, 0x3B, 0xF1, 0x95, 0x47,
+    0xDD, 0x52, 0x0A, 0xC0, 0x09, 0xB7, 0xD5, 0x35, 0xBF, 0x19, 0x1C, 0x7C, 0xE1, 0xB3, 0x8C, 0x56,
+    0x3A, 0x01, 0xB8, 0xD4, 0xE4, 0x6A, 0xA7, 0xDB, 0x86, 0x4F, 0x7C, 0x97, 0xCD, 0x4A, 0x27, 0x00,
+    0xD7, 0xF9, 0xEE, 0x57, 0x05, 0xDD, 0x02, 0x86, 0x4F, 0x7C, 0x97, 0xCD, 0x4A, 0x27, 0x40, 0x9E,
+    0x37, 0x47, 0xF2, 0xF4, 0xDD, 0xAE, 0xB0, 0xB9, 0xDD, 0x90, 0xF1, 0x9F, 0xDB, 0xF1, 0x0F, 0xB0,
+    0xD1, 0x73, 0x3C, 0x7C, 0xC2, 0xCD, 0xCB, 0x9A, 0xF9, 0x6E, 0xF7, 0x78, 0x3B, 0x3D, 0xD6, 0xD2,
+    0xCD, 0x80, 0x3C, 0xAF, 0x56, 0xF2, 0xF4, 0xDD, 0xAE, 0x10, 0xA5, 0x13, 0xA0, 0xDD, 0x8E, 0x6C,
+    0xD4, 0x7A, 0xA5, 0x13, 0x20, 0xCF, 0xEF, 0x6F, 0xF2, 0xF4, 0xDD, 0xEE, 0x00, 0xC8, 0xED, 0x1C,
+    0xD0, 0x68, 0x8D, 0xCF, 0x3A, 0x50, 0xBE, 0xD5, 0x7C, 0xF2, 0xE4, 0x49, 0xD6, 0x6E, 0x6D, 0x95,
+    0xE3, 0xBB, 0x91, 0xB5, 0x7B, 0xBC, 0x8D, 0xFC, 0xAD, 0x37, 0xBF, 0x74, 0x33, 0x20, 0xCF, 0x27,
+    0x13, 0xF2, 0xF4, 0xBD, 0x5E, 0xE0, 0xFE, 0x7E, 0xA5, 0x13, 0x80, 0xEF, 0xF3, 0xF9, 0x4A, 0xB9,
+    0xDB, 0x86, 0x4F, 0x7C, 0x97, 0xCD, 0x4A, 0x27, 0x00, 0x77, 0xAB, 0xF8, 0x3E, 0xBF, 0xDB, 0x86,
+    0x4F, 0x7C, 0x97, 0xCD, 0x4A, 0x27, 0x00, 0x80, 0xB8, 0x99, 0xC2, 0xF7, 0xF9, 0xDD, 0x32, 0x7C,
+    0xE1, 0xB3, 0x8C, 0x56, 0x4A, 0x01, 0xB8, 0x5A, 0xE1, 0x66, 0x0A, 0x4F, 0xAC, 0x75, 0x6A, 0xF8,
+    0xC0, 0x57, 0x19, 0xAF, 0x80, 0xE8, 0x5B, 0xE7, 0x3D, 0xEC, 0x94, 0x50, 0x83, 0xFA, 0xDC, 0xC9,
+    0x3A, 0x79, 0xF2, 0x64, 0x47, 0x22, 0x00, 0x1F, 0x1F, 0xA1, 0xEF, 0x8A, 0x35, 0xE8, 0x62, 0x92,
+    0x9D, 0xDB, 0x65, 0x68, 0xB3, 0x46, 0xD7, 0x5B, 0x76, 0xEC, 0xD8, 0x31, 0x33, 0x31, 0x31, 0xB1,
+    0xA1, 0x6F, 0x49, 0x66, 0xF5, 0x35, 0xDE, 0x94, 0xCF, 0x22, 0xD4, 0x61, 0x79, 0xD6, 0x3D, 0xE1,
+    0x52, 0x08, 0x10, 0x1F, 0x4B, 0x29, 0xF0, 0xE9, 0x68, 0x7F, 0x40, 0xE9, 0x59, 0x4D, 0x9E, 0x58,
+    0xCB, 0xFB, 0xC1, 0x2C, 0xDA, 0xE6, 0x99, 0xA0, 0x0B, 0x17, 0x2E, 0x98, 0xD7, 0xAF, 0x5F, 0x17,
+    0xF2, 0x54, 0x76, 0xD6, 0x0C, 0x08, 0x7A, 0x12, 0x16, 0x7C, 0x6E, 0x96, 0x70, 0xB7, 0x0A, 0x30,
+    0x00, 0xCA, 0xCB, 0x04, 0x9F, 0xB6, 0x68, 0xB3, 0xE8, 0xA7, 0xB2, 0xEB, 0xF5, 0x2B, 0x98, 0x00,
+    0x2E, 0x7C, 0x1D, 0x18, 0xA3, 0x92, 0x27, 0xD6, 0xF2, 0x32, 0x7C, 0xD3, 0x86, 0xAC, 0x0C, 0x22,
+    0x04, 0x11, 0xA0, 0x1E, 0x7C, 0x3D, 0xAB, 0x99, 0xE7, 0xE3, 0x82, 0xF8, 0x0E, 0xF9, 0x68, 0xBC,
+    0x84, 0x77, 0xE3, 0xC2, 0x05, 0x68, 0x06, 0x9F, 0x87, 0x75, 0xF3, 0x36, 0xF7, 0x81, 0x60, 0xB5,
+    0x15, 0x72, 0x26, 0x14, 0x2E, 0xC0, 0xC8, 0xC8, 0x48, 0xD5, 0x87, 0x2B, 0x8D, 0xFC, 0x22, 0xE0,
+    0x0B, 0x78, 0x3D, 0x11, 0xF8, 0xD0, 0xC6, 0xB1, 0x15, 0x6D, 0x41, 0x2E, 0x43, 0xF5, 0x7F, 0x62,
+    0x3C, 0x34, 0xD5, 0xEE, 0xFF, 0x87, 0xF9, 0xF7, 0x70, 0xDB, 0xF9, 0x3E, 0x5F, 0xB3, 0x11, 0xF8,
+    0x79, 0xFD, 0x93, 0x5E, 0xD6, 0x55, 0x50, 0x90, 0x4F, 0xC2, 0x7C, 0x2F, 0x4F, 0x87, 0xF9, 0x9F,
+    0xAC, 0x22, 0x47, 0xBE, 0x3F, 0xBA, 0xD5, 0x36, 0x23, 0x3F, 0xD4, 0xBD, 0x82, 0x20, 0x02, 0x00,
+    0x22, 0x54, 0x87, 0x1B, 0x89, 0xE0, 0xE7, 0x17, 0xB5, 0x5D, 0xF8, 0x39, 0xA0, 0xA8, 0x8E, 0x6D,
+    0x94, 0x76, 0xA2, 0x00, 0x81, 0x95, 0x8A, 0x02, 0x44, 0x01, 0x02, 0x13, 0x08, 0xDC, 0x7C, 0x9C,
+    0x01, 0x81, 0x05, 0x08, 0x76, 0x15, 0xD4, 0x69, 0xBF, 0xDB, 0xB9, 0xEE, 0xEF, 0xB4, 0xCD, 0x3C,
+    0xEA, 0xC7, 0x19, 0x90, 0x07, 0xD5, 0x16, 0x7C, 0x46, 0x01, 0x5A, 0x80, 0x95, 0xC7, 0xAE, 0x8D,
+    0x04, 0xD0, 0xDB, 0x7E, 0x92, 0xD7, 0x6C, 0xE4, 0xD1, 0x70, 0x0F, 0xF9, 0x6C, 0xCA, 0xB2, 0x9E,
+    0x00, 0x11, 0x7A, 0x7E, 0xA3, 0xA3, 0x86, 0xAD, 0x04, 0x50, 0x81, 0x1B, 0x93, 0x5E, 0xFB, 0x49,
+    0xAB, 0xFC, 0x0E, 0xA8, 0x17, 0x3C, 0x57, 0xBD, 0xB4, 0xC7, 0x76, 0xD8, 0x65, 0x9C, 0x3C, 0x17,
+    0x54, 0x95, 0x51, 0xD9, 0x41, 0xF0, 0x55, 0xD6, 0x0B, 0xA0, 0xF2, 0xEA, 0xA3, 0xCB, 0x52, 0x3C,
+    0xD3, 0x58, 0x33, 0x80, 0xC6, 0xC9, 0xD4, 0xCE, 0xA8, 0x46, 0x58, 0xFB, 0x3D, 0x2F, 0x9B, 0x88,
+    0xD6, 0x36, 0x01, 0x18, 0x8A, 0xA7, 0x3F, 0x1B, 0x6A, 0x9E, 0x8C, 0x73, 0x45, 0xA0, 0xA2, 0x2A,
+    0xB7, 0xDD, 0x7A, 0x8F, 0x57, 0xD4, 0x20, 0x16, 0x47, 0xF1, 0x4D, 0xB1, 0x68, 0x06, 0xA8, 0x40,
+    0x33, 0x80, 0x0A, 0xBC, 0xE7, 0x6A, 0xF1, 0xCD, 0x9B, 0x37, 0x7F, 0xA5, 0x7B, 0xC7, 0x44, 0x4B,
+    0x04, 0x2A, 0xEC, 0xF4, 0xCE, 0x30, 0x5F, 0x04, 0x58, 0xA7, 0x33, 0x40, 0x02, 0xB8, 0x8A, 0x21,
+    0xC0, 0x87, 0x17, 0x2F, 0x5E, 0xFC, 0xD9, 0x52, 0xAB, 0x71, 0xE7, 0x94, 0x40, 0x85, 0x1D, 0x2F,
+    0x6E, 0x83, 0x25, 0x02, 0xF8, 0x22, 0xA4, 0x02, 0x50, 0x49, 0xA3, 0x1F, 0x11, 0x92, 0xD1, 0x6F,
+    0xE3, 0x0F, 0x57, 0xAE, 0x5C, 0xF9, 0xD9, 0xDE, 0xB4, 0x6E, 0xED, 0xB7, 0x62, 0xF0, 0xD6, 0xE3,
+    0x06, 0x33, 0xD8, 0x59, 0x0C, 0xEE, 0x9B, 0xF3, 0x60, 0x4B, 0x48, 0x46, 0x3F, 0x88, 0xDC, 0x7F,
+    0x45, 0xE1, 0xFE, 0xB0, 0x02, 0x4B, 0x13, 0xE9, 0x7E, 0xFB, 0x2E, 0xC4, 0xB7, 0xFB, 0xF7, 0xEF,
+    0x9F, 0xE7, 0xDD, 0x88, 0xF6, 0xDE, 0x29, 0xBF, 0x2D, 0x1A, 0x2D, 0x83, 0x00, 0xF0, 0xED, 0xCF,
+    0xE4, 0xFC, 0x70, 0xF6, 0xEC, 0xD9, 0x3F, 0xEC, 0xAE, 0xFC, 0x46, 0x28, 0x81, 0xA5, 0x28, 0xF9,
+    0xAD, 0x50, 0x1B, 0xA7, 0x42, 0x20, 0x80, 0xA0, 0x13, 0x63, 0x3A, 0x2F, 0x68, 0xDB, 0xDC, 0xBC,
+    0x79, 0x73, 0x96, 0x17, 0x53, 0x4E, 0x4F, 0x4F, 0x6F, 0x1D, 0x1C, 0x1C, 0xFC, 0x68, 0x78, 0x78,
+    0x98, 0x1F, 0x75, 0x4D, 0xCB, 0x93, 0x5A, 0xF1, 0xCF, 0x8A, 0x5D, 0xF3, 0xE7, 0xE6, 0xE7, 0xE7,
+    0x7F, 0x3F, 0x7F, 0xFE, 0xFC, 0x77, 0x15, 0xF8, 0xFC, 0x10, 0x29, 0xF0, 0x99, 0x05, 0x04, 0x2D,
+    0x43, 0x5A, 0xF2, 0xAB, 0xE0, 0x03, 0x14, 0xF8, 0x88, 0xC2, 0xB7, 0xA4, 0x8C, 0x76, 0xDE, 0x83,
+    0x48, 0x88, 0x2F, 0x74, 0xB6, 0x10, 0x3C, 0x13, 0x44, 0x46, 0xB3, 0xC0, 0x32, 0xC2, 0x05, 0x9B,
+    0xD8, 0x85, 0x5F, 0xF7, 0x64, 0x0C, 0xE8, 0x74, 0x3D, 0xAA, 0xA4, 0xE5, 0xD0, 0x6E, 0x26, 0x46,
+    0x39, 0x79, 0x3A, 0x2F, 0xE0, 0x94, 0x7A, 0x08, 0x85, 0x60, 0x5A, 0xAE, 0x6C, 0xB2, 0x67, 0x66,
+    0x85, 0x98, 0x89, 0x8D, 0x98, 0xC1, 0x48, 0x9C, 0xB4, 0xE4, 0x28, 0xF6, 0x4F, 0xC0, 0xD4, 0xAD,
+    0x79, 0xA7, 0xBC, 0x1C, 0x02, 0x53, 0x86, 0x73, 0x57, 0x00, 0xC0, 0xFB, 0xF0, 0xDD, 0xE5, 0xC8,
+    0x4D, 0xCB, 0xC7, 0x66, 0x8A, 0x05, 0x9F, 0x3E, 0x25, 0x10, 0x6D, 0x2C, 0x46, 0x9A, 0x09, 0x88,
+    0x40, 0x1A, 0xF8, 0xCA, 0x73, 0x05, 0xB0, 0xD9, 0x6B, 0xA6, 0x1B, 0x32, 0xAE, 0x53, 0x4A, 0x70,
+    0x88, 0xB9, 0x0D, 0x00, 0x1D, 0x87, 0x82, 0xAF, 0x25, 0xCB, 0x05, 0xEE, 0xA6, 0xA9, 0xBF, 0x59,
+    0xCD, 0xE5, 0x45, 0x1A, 0x5E, 0x8A, 0x05, 0xDA, 0x8F, 0xB5, 0x8F, 0x98, 0x26, 0x3E, 0x5C, 0x60,
+    0x4A, 0x13, 0xFB, 0x41, 0x4B, 0x8D, 0x96, 0x1B, 0xC5, 0x6E, 0x9D, 0xCD, 0x0A, 0xBB, 0x59, 0xBF,
+    0x12, 0x88, 0x15, 0xF8, 0x12, 0x40, 0xB1, 0x66, 0x05, 0xDB, 0x7E, 0xC0, 0x27, 0x79, 0x35, 0x6B,
+    0xB6, 0x0F, 0xD4, 0x17, 0xC2, 0xDD, 0x56, 0x7D, 0xD5, 0x61, 0xBB, 0x17, 0x4D, 0x70, 0xE9, 0xBB,
+    0xD2, 0xF5, 0x62, 0x95, 0xBB, 0x71, 0x8D, 0x00, 0x14, 0x62, 0x82, 0xAA, 0xD8, 0xCF, 0xAB, 0x97,
+    0x9F, 0x54, 0xEC, 0xC1, 0x3F, 0xC9, 0x48, 0xAE, 0xF4, 0x5B, 0xE0, 0xD9, 0xF4, 0xF3, 0xFD, 0xBC,
+    0xA4, 0x8A, 0x0B, 0x32, 0xC9, 0xF0, 0xFE, 0xF8, 0xE5, 0xFE, 0xB6, 0xB7, 0x7B, 0x2A, 0x9C, 0x9F,
+    0xBF, 0xD9, 0xB6, 0x5D, 0xB8, 0xF5, 0xFA, 0xE6, 0x97, 0xFB, 0xDB, 0x69, 0x9D, 0xFF, 0x01, 0xE6,
+    0xF9, 0x19, 0xD7, 0x4A, 0xC7, 0x0D, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE,
+    0x42, 0x60, 0x82, 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49,
+    0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00, 0x00,
+    0xE2, 0x98, 0x77, 0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE, 0x1C,
+    0xE9, 0x00, 0x00, 0x09, 0x9B, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x5B, 0x6C, 0x54,
+    0x45, 0x18, 0xC7, 0xA7, 0xDB, 0x1B, 0xB7, 0x52, 0xA3, 0x05, 0x8A, 0x04, 0x42, 0xAB, 0x25, 0x26,
+    0x05, 0xD3, 0x34, 0x88, 0x11, 0x21, 0x26, 0xC6, 0x88, 0xD7, 0x68, 0xA2, 0xBC, 0x11, 0x12, 0x9F,
+    0x48, 0x78, 0x23, 0x82, 0xC6, 0xC6, 0x04, 0x83, 0xC6, 0x04, 0x13, 0x13, 0x0D, 0xD1, 0x04, 0x9F,
+    0x7C, 0x20, 0x86, 0x04, 0x1F, 0x78, 0xA8, 0x68, 0x50, 0xF1, 0x86, 0x18, 0x45, 0x50, 0x04, 0x34,
+    0xA4, 0x81, 0x72, 0x91, 0x42, 0xA1, 0x2A, 0xB4, 0x5C, 0x4A, 0xBB, 0x17, 0xBF, 0xFF, 0xE9, 0xFE,
+    0x4F, 0xA6, 0xB3, 0x67, 0xBB, 0xEC, 0xE9, 0xB9, 0x74, 0xBB, 0xF3, 0x25, 0xDF, 0xCE, 0x7D, 0xCE,
+    0x99, 0xDF, 0x37, 0xF3, 0xCD, 0xEE, 0x9E, 0x73, 0x76, 0x2B, 0xD4, 0xD8, 0x52, 0x61, 0x14, 0x9B,
+    0x69, 0xA3, 0x58, 0x15, 0x2A, 0x37, 0xEB, 0x97, 0x6A, 0x3A, 0x53, 0xE0, 0xC4, 0xCD, 0x72, 0x33,
+    0xED, 0x36, 0xCF, 0x07, 0x8C, 0xF9, 0x0C, 0xD1, 0x80, 0x71, 0x84, 0x8C, 0xEB, 0xF9, 0x88, 0x97,
+    0xA3, 0xE8, 0x70, 0x11, 0x67, 0x9A, 0x21, 0x98, 0x30, 0xCE, 0xD0, 0xE5, 0x54, 0xE5, 0xC6, 0x46,
+    0x22, 0x04, 0xAB, 0x87, 0x04, 0x6E, 0x86, 0x68, 0xC1, 0x3C, 0xA3, 0x9B, 0xB2, 0x4A, 0x02, 0x2A,
+    0xC1, 0x32, 0x6E, 0x86, 0x26, 0x10, 0xD6, 0xF7, 0x9C, 0xC9, 0x84, 0xAA, 0x87, 0x09, 0xE9, 0x81,
+    0x8A, 0x7C, 0xC4, 0x59, 0x8E, 0xCE, 0x11, 0x2F, 0x47, 0x21, 0x48, 0x02, 0x4F, 0x0B, 0x04, 0xC4,
+    0x11, 0x52, 0x59, 0xA6, 0x87, 0x60, 0x85, 0xB4, 0xF2, 0x5A, 0x01, 0x04, 0x4B, 0xE0, 0x95, 0x52,
+    0x0F, 0x71, 0x33, 0xD4, 0x0D, 0x81, 0xBE, 0x20, 0xE5, 0x62, 0x08, 0x07, 0xDE, 0xC8, 0x90, 0x5D,
+    0xE0, 0xC8, 0x03, 0xF4, 0x54, 0x9E, 0x10, 0x65, 0x14, 0xB7, 0x3D, 0x0D, 0x40, 0xE8, 0x0C, 0x09,
+    0x1C, 0xD0, 0xA1, 0xD5, 0xD9, 0x10, 0xF5, 0x99, 0x47, 0x03, 0xB1, 0x8D, 0x14, 0x39, 0x32, 0xD9,
+    0x8D, 0xE0, 0xC2, 0x93, 0xD1, 0x22, 0x4E, 0xF0, 0x84, 0x0F, 0x03, 0x24, 0x45, 0x11, 0x0E, 0x8B,
+    0x82, 0x07, 0xE2, 0x10, 0xDD, 0x08, 0x48, 0x67, 0x68, 0x00, 0x24, 0x20, 0xA8, 0xAC, 0xC3, 0x07,
+    0x78, 0x53, 0xD1, 0x86, 0x86, 0xD0, 0x8D, 0x20, 0xD9, 0x65, 0xB7, 0x02, 0x4C, 0xF8, 0x00, 0x0F,
+    0x05, 0x78, 0x28, 0xF8, 0x20, 0xD4, 0x05, 0x46, 0x70, 0x8D, 0x08, 0x90, 0x9C, 0xC1, 0x0C, 0x69,
+    0x00, 0x80, 0xAF, 0xC9, 0x6A, 0xAD, 0x16, 0x47, 0x1E, 0x57, 0x04, 0xDD, 0x12, 0xDB, 0x4A, 0x51,
+    0xD9, 0x88, 0x3E, 0xFB, 0x31, 0xC3, 0x39, 0xE3, 0x87, 0x24, 0x4E, 0x05, 0x4B, 0xB0, 0xA1, 0xB0,
+    0x8D, 0x9E, 0xE7, 0xCE, 0x7A, 0x18, 0x03, 0x70, 0xA7, 0x8B, 0xD6, 0x8B, 0xCE, 0x16, 0x9D, 0x2F,
+    0xDA, 0x22, 0xBA, 0x64, 0xDD, 0xBA, 0x75, 0xCF, 0x9E, 0x3A, 0x75, 0xAA, 0xB3, 0xBF, 0xBF, 0xBF,
+    0x3B, 0x93, 0xC9, 0xA4, 0x44, 0xAD, 0x8C, 0x26, 0x90, 0x02, 0x1B, 0x30, 0x02, 0x2B, 0x30, 0xCB,
+    0xB2, 0x03, 0x43, 0xB0, 0x04, 0x53, 0xB0, 0x05, 0x63, 0xB0, 0x76, 0x8D, 0x03, 0x6B, 0x20, 0x81,
+    0x59, 0x3D, 0x45, 0xB4, 0x4E, 0xB4, 0x41, 0x74, 0x9E, 0xE8, 0xBD, 0xA2, 0x4B, 0x76, 0xEF, 0xDE,
+    0xFD, 0x6A, 0x32, 0x99, 0xBC, 0x3E, 0xFA, 0x78, 0x36, 0x95, 0x8F, 0x00, 0x58, 0x81, 0x19, 0xD8,
+    0x65, 0x19, 0x82, 0x25, 0x98, 0x82, 0x2D, 0x18, 0x83, 0xB5, 0x63, 0x00, 0xDD, 0x85, 0x20, 0x83,
+    0x1B, 0x2E, 0x2A, 0xC0, 0xED, 0x4C, 0x11, 0x6B, 0x36, 0x6F, 0xD8, 0xB0, 0x61, 0x5B, 0x65, 0x65,
+    0xE5, 0x34, 0x49, 0x5B, 0xB9, 0x0D, 0x02, 0x89, 0x44, 0xA2, 0xBA, 0xA5, 0xA5, 0x65, 0x79, 0x6F,
+    0x6F, 0xEF, 0x57, 0x87, 0x0E, 0x1D, 0xEA, 0x97, 0x26, 0xDC, 0xA0, 0x11, 0x72, 0x0F, 0x70, 0xF6,
+    0x01, 0xCE, 0x7E, 0x84, 0x58, 0x16, 0x00, 0x8F, 0x25, 0x32, 0x55, 0x14, 0xC0, 0xA7, 0xCB, 0x92,
+    0x7A, 0xAB, 0xA9, 0xA9, 0xE9, 0x69, 0x89, 0x5B, 0x29, 0x92, 0x40, 0x77, 0x77, 0xF7, 0x67, 0xCD,
+    0xCD, 0xCD, 0xAF, 0x4B, 0xB3, 0xEB, 0xA2, 0x37, 0x44, 0x6F, 0x8A, 0x62, 0x7F, 0xC0, 0xC6, 0x8C,
+    0xCD, 0x3A, 0x83, 0x59, 0x0F, 0x81, 0x01, 0x68, 0x0C, 0xBE, 0xCD, 0x74, 0xF6, 0x84, 0x86, 0x86,
+    0x86, 0x56, 0xA7, 0x86, 0x7D, 0x29, 0x9A, 0x40, 0x96, 0x1D, 0x7D, 0x3E, 0xB9, 0x3A, 0xAE, 0x27,
+    0xCB, 0xDB, 0xF1, 0x43, 0xE8, 0x98, 0x06, 0xD0, 0x8D, 0xE0, 0xAC, 0x88, 0xBA, 0xBA, 0xBA, 0x05,
+    0x45, 0x1F, 0xD9, 0x36, 0x70, 0x08, 0x64, 0xD9, 0xC1, 0xAB, 0x80, 0xA5, 0xEE, 0xEE, 0xC9, 0xDB,
+    0x35, 0x00, 0x91, 0xB1, 0x80, 0xFB, 0x01, 0x1B, 0xB1, 0xDC, 0x86, 0xC5, 0x11, 0x30, 0x39, 0x92,
+    0xAF, 0xDB, 0x0B, 0x5D, 0x10, 0x32, 0x58, 0x88, 0x3C, 0x2A, 0x0C, 0x60, 0x65, 0x7C, 0x04, 0x38,
+    0x89, 0xC9, 0x94, 0x9C, 0x9D, 0x5E, 0x91, 0x89, 0x0C, 0x88, 0x1E, 0x22, 0xAE, 0x97, 0x39, 0x15,
+    0xEC, 0x8B, 0x2F, 0x02, 0x3A, 0x4B, 0x9D, 0x31, 0x3A, 0xAB, 0x00, 0x64, 0x48, 0x4E, 0x41, 0x36,
+    0x8F, 0xE5, 0x4E, 0x25, 0xFB, 0xE2, 0x8B, 0x00, 0x27, 0xB2, 0x17, 0xE3, 0x9C, 0x3D, 0x00, 0x47,
+    0x60, 0x45, 0x5F, 0x47, 0xB3, 0x8D, 0xC6, 0x24, 0x90, 0xC3, 0x36, 0xDF, 0x0C, 0x47, 0x45, 0xEA,
+    0x98, 0x3D, 0xDA, 0xC2, 0x82, 0x04, 0xC8, 0x31, 0x07, 0x3E, 0x5A, 0xE6, 0x33, 0x40, 0xC1, 0x5E,
+    0x6D, 0x85, 0x60, 0x08, 0x58, 0x03, 0x04, 0xC3, 0xD1, 0x77, 0x2F, 0xD6, 0x00, 0xBE, 0xD1, 0x05,
+    0xD3, 0xD0, 0x1A, 0x20, 0x18, 0x8E, 0xBE, 0x7B, 0xB1, 0x06, 0xF0, 0x8D, 0x2E, 0x98, 0x86, 0xD6,
+    0x00, 0xC1, 0x70, 0xF4, 0xDD, 0x8B, 0x35, 0x80, 0x6F, 0x74, 0xC1, 0x34, 0xB4, 0x06, 0x08, 0x86,
+    0xA3, 0xEF, 0x5E, 0x4A, 0xCA, 0x00, 0x27, 0xFB, 0x33, 0x6A, 0xDF, 0x79, 0x5C, 0x50, 0x52, 0xEA,
+    0xBD, 0x3F, 0x92, 0xEA, 0x99, 0x3D, 0xB7, 0x54, 0xDB, 0xAE, 0x41, 0xF5, 0x53, 0xEF, 0x48, 0x9E,
+    0x6F, 0x0A, 0x31, 0x36, 0xC4, 0xF7, 0xD4, 0x13, 0x52, 0x06, 0xE5, 0x1E, 0x83, 0x1F, 0x2E, 0xA4,
+    0xD5, 0xE1, 0xCB, 0x69, 0x75, 0xE4, 0x9F, 0xB4, 0x3A, 0xFA, 0x6F, 0x5A, 0x0D, 0x0C, 0x65, 0xD4,
+    0xC2, 0xBA, 0x84, 0x7A, 0x74, 0x5E, 0xAD, 0xFA, 0xBD, 0x2F, 0xAD, 0x8E, 0x49, 0x1E, 0x64, 0xD7,
+    0xC9, 0x94, 0x7A, 0x68, 0x4E, 0x49, 0xCD, 0x25, 0x97, 0xF9, 0x84, 0x32, 0x40, 0xBF, 0x5C, 0xA8,
+    0xDB, 0xF7, 0x77, 0x4A, 0x7D, 0x7E, 0x36, 0xA5, 0xBE, 0x13, 0xF8, 0x83, 0x49, 0xF7, 0xF6, 0x19,
+    0xF7, 0x84, 0xBD, 0x22, 0xA8, 0xFF, 0xE6, 0xB2, 0x6A, 0x35, 0x7D, 0x42, 0x8D, 0xC6, 0xEB, 0x4C,
+    0x73, 0xF3, 0x26, 0xC4, 0x29, 0x1F, 0xFF, 0x2F, 0xA3, 0x3E, 0x3C, 0x36, 0xAC, 0xF6, 0x9E, 0x4B,
+    0xAB, 0xE1, 0xF4, 0xED, 0x41, 0xD7, 0x87, 0x72, 0x53, 0x0C, 0xB5, 0x47, 0x8C, 0xB0, 0xBA, 0xB9,
+    0xF4, 0x2E, 0x5F, 0xC4, 0x6A, 0x80, 0x83, 0x97, 0xD2, 0xEA, 0x83, 0x63, 0x49, 0xF5, 0x6D, 0x0F,
+    0xEE, 0x69, 0x1A, 0x9F, 0x7C, 0x2A, 0x6E, 0xC8, 0x1A, 0xE0, 0x36, 0x19, 0x5E, 0x91, 0xFB, 0x02,
+    0x3A, 0x7E, 0x1E, 0x52, 0x7B, 0xCE, 0x8C, 0x1F, 0x3C, 0x0F, 0xF9, 0x8B, 0x18, 0xB3, 0x6F, 0x50,
+    0x6E, 0xBE, 0xC1, 0x5D, 0x37, 0x25, 0x24, 0x91, 0xAF, 0x80, 0xEF, 0xC5, 0xB7, 0x6F, 0xFC, 0x69,
+    0x48, 0x5D, 0xBA, 0x51, 0xBC, 0xAB, 0x19, 0x8B, 0xAB, 0xDC, 0x24, 0xA5, 0xF6, 0x5F, 0x48, 0xA9,
+    0xE7, 0x9B, 0xC6, 0x76, 0x43, 0x0B, 0x77, 0xE0, 0xCE, 0x10, 0xFF, 0x72, 0x7A, 0x0D, 0xEE, 0xD8,
+    0x09, 0x4E, 0x22, 0x7D, 0xEB, 0xB0, 0xED, 0x68, 0x52, 0xAD, 0xFD, 0xFA, 0x56, 0xE0, 0xF0, 0x89,
+    0x03, 0xEF, 0x9A, 0x4A, 0x4D, 0x22, 0x33, 0xC0, 0x47, 0x7F, 0x26, 0xD5, 0xBB, 0x47, 0x70, 0x3F,
+    0x52, 0x78, 0xB2, 0xFF, 0x62, 0x70, 0x2E, 0x2D, 0xBC, 0xB3, 0x1C, 0xDD, 0x73, 0x24, 0x06, 0xD8,
+    0xD1, 0x95, 0x52, 0x6F, 0x1F, 0x0E, 0x17, 0x3E, 0x86, 0xD5, 0x2B, 0x6E, 0xAD, 0xEB, 0x6A, 0xB0,
+    0xAE, 0x6D, 0x34, 0xAE, 0xE0, 0x53, 0xA1, 0xEF, 0x01, 0x00, 0xF2, 0xC6, 0xC1, 0xF0, 0xE1, 0x13,
+    0xCD, 0xAF, 0xF2, 0xC1, 0xAD, 0xA5, 0x3E, 0xFF, 0x3E, 0x10, 0xB4, 0x0F, 0xE7, 0x71, 0xFD, 0x86,
+    0xA1, 0xAF, 0x80, 0xCD, 0x02, 0x3F, 0xE9, 0xE3, 0xBD, 0xBD, 0xDF, 0x01, 0x75, 0x5D, 0x2D, 0xAD,
+    0x7D, 0x20, 0x54, 0x03, 0x74, 0xCA, 0xDB, 0xCC, 0x03, 0x11, 0xFB, 0xE5, 0xAE, 0x2B, 0xA5, 0xE5,
+    0x82, 0x42, 0x35, 0xC0, 0xC7, 0x27, 0xA2, 0xDF, 0x14, 0xED, 0x0A, 0xC8, 0xFA, 0x8E, 0xCB, 0xF2,
+    0xA1, 0x08, 0x5F, 0xA4, 0x45, 0x2D, 0x17, 0x65, 0x23, 0x1E, 0x88, 0x6E, 0xCB, 0x19, 0xF7, 0xF0,
+    0x42, 0x5B, 0x01, 0x5F, 0x9E, 0x4B, 0xA9, 0xB4, 0x7C, 0x38, 0x8A, 0x43, 0x7A, 0xAE, 0xC7, 0x73,
+    0x5C, 0x3F, 0x63, 0x0D, 0xCD, 0x00, 0x71, 0x7E, 0x47, 0x3F, 0x30, 0x6C, 0x0D, 0xA0, 0xE0, 0x0A,
+    0xE2, 0x92, 0x52, 0x72, 0x41, 0xA1, 0x7D, 0x0E, 0xB8, 0x7C, 0x33, 0x3E, 0x03, 0x5C, 0x1B, 0x63,
+    0x05, 0x94, 0xCD, 0x77, 0x41, 0x97, 0x07, 0xE3, 0x34, 0x40, 0x5C, 0x6B, 0xAF, 0xF8, 0xE3, 0x86,
+    0xB6, 0x07, 0x14, 0x7F, 0x2A, 0xE5, 0xD9, 0x22, 0x34, 0x03, 0xCC, 0x9A, 0xE2, 0x79, 0x33, 0x70,
+    0x24, 0x94, 0x67, 0xE0, 0xA9, 0xAC, 0x12, 0x91, 0xD0, 0xF6, 0x80, 0x59, 0x53, 0x2B, 0xD4, 0xE9,
+    0x81, 0x78, 0x28, 0xCC, 0xA8, 0xCE, 0x6F, 0xFC, 0xB2, 0xF9, 0x2E, 0x68, 0xCE, 0xB4, 0xFC, 0x10,
+    0xC2, 0x36, 0xCB, 0xCC, 0x12, 0x5A, 0x01, 0xA1, 0xB9, 0xA0, 0x07, 0x67, 0x87, 0xD6, 0x75, 0x41,
+    0xFB, 0x8D, 0xB5, 0x02, 0x0A, 0x36, 0x8E, 0xB8, 0x42, 0x68, 0x94, 0x56, 0xCD, 0xAF, 0x54, 0x15,
+    0x15, 0xF1, 0xAC, 0x82, 0xBB, 0xA7, 0xC7, 0x73, 0x5C, 0x3F, 0xB6, 0x0B, 0xCD, 0x00, 0xB3, 0xE5,
+    0xD2, 0x69, 0xDB, 0x5D, 0xD1, 0x83, 0x68, 0x14, 0xD7, 0x57, 0x67, 0x5D, 0xD0, 0xC8, 0x5C, 0x58,
+    0xB3, 0x28, 0xB4, 0x3D, 0x3E, 0xEF, 0x64, 0x6B, 0xA9, 0x0F, 0x6D, 0x4E, 0xE5, 0x3D, 0xE6, 0x78,
+    0x0A, 0x42, 0x3D, 0xDB, 0x17, 0xE4, 0x46, 0xA9, 0xF6, 0x59, 0xA1, 0x1E, 0x22, 0x67, 0xEC, 0x2D,
+    0x77, 0x44, 0xBF, 0xEA, 0x72, 0x4E, 0xA2, 0x88, 0x8C, 0xD0, 0xE9, 0x6C, 0x79, 0xA0, 0x46, 0x25,
+    0x22, 0xDC, 0x0B, 0x4A, 0x6D, 0x05, 0x84, 0xEE, 0x23, 0x16, 0xDF, 0x59, 0xA1, 0x36, 0xB6, 0x55,
+    0xA9, 0x77, 0x7E, 0x8B, 0xE6, 0x4B, 0xFA, 0xA5, 0x05, 0x56, 0x5C, 0xD9, 0x7C, 0x17, 0xA4, 0xAF,
+    0xC2, 0xF5, 0xAD, 0x55, 0x6A, 0xFD, 0xE2, 0xF0, 0x77, 0x46, 0x7C, 0xF6, 0x68, 0xA9, 0xB7, 0x2E,
+    0x48, 0x67, 0xEF, 0xC6, 0x5F, 0x91, 0x55, 0xF0, 0xD2, 0x7D, 0xE1, 0x2E, 0xB8, 0x95, 0x73, 0xF3,
+    0xDF, 0x0D, 0xE1, 0x9E, 0xC8, 0x04, 0x8B, 0x84, 0xBE, 0x07, 0xE8, 0xE3, 0xDD, 0xBC, 0xB4, 0x5A,
+    0xBD, 0xBF, 0xA2, 0x46, 0xD5, 0xD7, 0x84, 0x33, 0x4B, 0x57, 0xCE, 0x8D, 0x74, 0x38, 0xFA, 0xD0,
+    0x7C, 0xC7, 0xC3, 0x9D, 0x92, 0x1E, 0xA7, 0xF5, 0xDC, 0xC2, 0x4A, 0xB5, 0x4C, 0x3E, 0x25, 0xBF,
+    0x7C, 0x60, 0x38, 0xD0, 0x3B, 0x26, 0xF0, 0xA1, 0xEF, 0xE1, 0xC6, 0xC2, 0x2B, 0xA0, 0x6C, 0xBE,
+    0x0B, 0xF2, 0x60, 0xEF, 0x66, 0xCD, 0x15, 0x5F, 0xFD, 0xC9, 0x63, 0x35, 0x6A, 0xFB, 0x23, 0xB5,
+    0xAA, 0xAD, 0x21, 0x98, 0x59, 0x0B, 0xA3, 0x96, 0xDA, 0x9D, 0xD1, 0x00, 0x12, 0xCC, 0xE8, 0x5D,
+    0xB4, 0xC5, 0x45, 0x56, 0xCD, 0x4F, 0xA8, 0xDD, 0x4F, 0xD4, 0x8A, 0x31, 0x6A, 0xD5, 0x0A, 0xF1,
+    0xDF, 0xE3, 0xF9, 0xEA, 0xE2, 0xC5, 0x7B, 0x0A, 0xCF, 0xFE, 0xE2, 0xCE, 0x2E, 0x9A, 0xDA, 0x91,
+    0xBB, 0x20, 0xAF, 0x61, 0x2D, 0x6F, 0x4C, 0xA8, 0xE5, 0x8D, 0x35, 0x72, 0x1D, 0x59, 0xA9, 0xBD,
+    0xF2, 0x88, 0xD2, 0x17, 0xF2, 0xB4, 0x0B, 0xEE, 0xF7, 0xBF, 0xDD, 0x3B, 0xEA, 0xA6, 0x56, 0x55,
+    0xA8, 0xA7, 0x16, 0x58, 0x03, 0x78, 0xB1, 0x2D, 0x2A, 0xAF, 0x51, 0x7E, 0x28, 0x73, 0xED, 0xA2,
+    0x4A, 0x47, 0xAF, 0xCA, 0x43, 0x1C, 0xDF, 0x9C, 0x4F, 0xA9, 0xC3, 0xF2, 0x30, 0xDE, 0x51, 0x79,
+    0x48, 0xEF, 0x2F, 0x79, 0x8C, 0x69, 0x30, 0xE5, 0x7D, 0x99, 0xF3, 0x49, 0x81, 0x5F, 0x8A, 0xCF,
+    0x87, 0x01, 0xCE, 0x84, 0x58, 0x01, 0x5E, 0x56, 0xAA, 0x97, 0x1F, 0x7B, 0xC4, 0xC3, 0x16, 0x7C,
+    0xE0, 0x02, 0xEC, 0x4F, 0xC8, 0x6D, 0x87, 0x67, 0xAF, 0x8D, 0x18, 0xE1, 0x7E, 0xD9, 0x3B, 0x2E,
+    0xC9, 0x85, 0xFF, 0xF3, 0x72, 0xF7, 0xC5, 0xEA, 0x12, 0x75, 0x3F, 0x18, 0x37, 0xDE, 0x0F, 0x62,
+    0xED, 0x42, 0xF1, 0x49, 0x09, 0xBF, 0x96, 0x8B, 0x1F, 0x6C, 0x9D, 0x21, 0x3A, 0x53, 0xB4, 0x5E,
+    0x9E, 0x3C, 0xD9, 0x2B, 0xA1, 0x15, 0x9F, 0x04, 0x64, 0x5F, 0x7B, 0x5C, 0x9A, 0x5E, 0x15, 0xC5,
+    0x2F, 0xE8, 0x5E, 0x13, 0xC5, 0x0F, 0xB8, 0xDE, 0x12, 0xC5, 0x57, 0x03, 0xA9, 0x58, 0x37, 0x61,
+    0x39, 0x81, 0xB2, 0x17, 0x6B, 0x80, 0x98, 0xA7, 0x80, 0x35, 0x80, 0x35, 0x40, 0xCC, 0x04, 0x62,
+    0x3E, 0xBC, 0x5D, 0x01, 0xD6, 0x00, 0x31, 0x13, 0x88, 0xF9, 0xF0, 0x76, 0x05, 0x58, 0x03, 0xC4,
+    0x4C, 0x20, 0xE6, 0xC3, 0xE7, 0x5B, 0x01, 0xF8, 0xB8, 0x49, 0x8D, 0xF9, 0x14, 0x4B, 0xFE, 0xF0,
+    0xE4, 0x38, 0xF2, 0x11, 0xDE, 0x18, 0x8E, 0x97, 0x01, 0x3C, 0x2B, 0x1A, 0xED, 0x6C, 0xD2, 0x1F,
+    0x81, 0x1C, 0xB6, 0x34, 0x00, 0x0B, 0xF4, 0x10, 0xF1, 0xE8, 0x9F, 0xB2, 0xF3, 0x37, 0xB0, 0x89,
+    0xDC, 0x0A, 0x0C, 0xC1, 0x52, 0x67, 0x8B, 0xF3, 0x75, 0xD2, 0x30, 0x80, 0x57, 0x01, 0xF2, 0xD8,
+    0x10, 0x95, 0xAD, 0xF8, 0x27, 0xA0, 0xB3, 0xCC, 0x61, 0xCD, 0x15, 0x80, 0xEE, 0x51, 0xC8, 0xCA,
+    0x80, 0x0F, 0x8D, 0xFE, 0x41, 0x5F, 0x39, 0xE8, 0x24, 0x13, 0x30, 0x24, 0x4F, 0x4E, 0x6A, 0x1A,
+    0x22, 0xE7, 0x8A, 0x98, 0x6E, 0x04, 0x34, 0x64, 0xE3, 0x49, 0xC6, 0x24, 0xB2, 0xE1, 0x70, 0x12,
+    0x93, 0x23, 0xF9, 0xBA, 0x27, 0xC0, 0x15, 0xC0, 0x02, 0x84, 0x6C, 0xE4, 0xFC, 0x29, 0xE5, 0xC0,
+    0xC0, 0xC0, 0x59, 0xB7, 0xB6, 0x8D, 0x14, 0x45, 0x20, 0xCB, 0x0E, 0x5F, 0x3B, 0x83, 0xA5, 0x69,
+    0x04, 0xB0, 0x76, 0x57, 0x00, 0x0D, 0x40, 0xF8, 0xA8, 0x8C, 0x46, 0x43, 0x7D, 0x7D, 0x7D, 0xC7,
+    0x51, 0xD1, 0x4A, 0xF1, 0x04, 0xB2, 0xEC, 0xF0, 0xC7, 0x6D, 0x34, 0x80, 0x69, 0x04, 0xD7, 0x00,
+    0xE8, 0x9D, 0xB3, 0x1F, 0x46, 0x70, 0x66, 0xBF, 0x84, 0x43, 0x5B, 0xB7, 0x6E, 0xDD, 0x9E, 0x4A,
+    0xA5, 0x70, 0x11, 0xC1, 0x4A, 0x11, 0x04, 0xC0, 0x0C, 0xEC, 0xA4, 0x09, 0x0C, 0xC0, 0x55, 0x00,
+    0xB6, 0x50, 0x67, 0xF6, 0x4B, 0xE8, 0x5C, 0x09, 0x43, 0x08, 0xC1, 0xD5, 0x31, 0x2A, 0x5C, 0x13,
+    0xE2, 0x09, 0xF9, 0x2F, 0xC4, 0xEB, 0xED, 0xED, 0xED, 0x3D, 0xF8, 0x6F, 0x44, 0xFC, 0x47, 0xA2,
+    0xE4, 0x59, 0x29, 0x40, 0x00, 0xF0, 0x3B, 0x3B, 0x3B, 0xB7, 0x6C, 0xDA, 0xB4, 0xE9, 0xA0, 0x54,
+    0xC5, 0xD5, 0x2F, 0x5E, 0x01, 0x73, 0xAE, 0x82, 0x49, 0xDA, 0x35, 0x04, 0x2E, 0x45, 0x12, 0x3A,
+    0x42, 0x08, 0xF7, 0x05, 0xA6, 0xD5, 0xCE, 0x9D, 0x3B, 0xBB, 0xF1, 0xC7, 0x94, 0xAD, 0xAD, 0xAD,
+    0x33, 0xAB, 0xAA, 0xAA, 0x6A, 0x6A, 0x6B, 0x6B, 0x71, 0xB9, 0xD2, 0x2D, 0x77, 0x5A, 0xD9, 0x97,
+    0xB4, 0xF8, 0xFC, 0x33, 0x3D, 0x3D, 0x3D, 0x3F, 0x76, 0x74, 0x74, 0xBC, 0x96, 0x85, 0x2F, 0x3F,
+    0x59, 0xE2, 0xC0, 0xC7, 0x2A, 0x80, 0xC2, 0x05, 0x41, 0xE9, 0xF2, 0x47, 0xC1, 0x07, 0x50, 0xC0,
+    0x87, 0x51, 0x70, 0xB1, 0x1E, 0xB3, 0x1D, 0xFF, 0x83, 0x08, 0xB5, 0x7F, 0xE8, 0x2C, 0x10, 0x0C,
+    0x21, 0x44, 0xCC, 0x66, 0x82, 0xC5, 0x0C, 0x27, 0x6C, 0x84, 0x98, 0xF9, 0x4C, 0xD3, 0x0D, 0x8D,
+    0xDA, 0x07, 0x00, 0xDA, 0xF5, 0x47, 0xD9, 0x38, 0x3B, 0x94, 0xA4, 0x23, 0x28, 0x47, 0x1E, 0xF7,
+    0x05, 0x74, 0x8A, 0x76, 0x30, 0x14, 0x0C, 0x46, 0x77, 0x25, 0xD1, 0xB2, 0x59, 0x15, 0x64, 0x46,
+    0x36, 0x64, 0x06, 0x46, 0xE4, 0x04, 0xE0, 0xBA, 0x8E, 0x02, 0x2F, 0x65, 0x68, 0x9B, 0xF3, 0x9F,
+    0xF2, 0xEC, 0x50, 0xCA, 0x5C, 0x41, 0xE7, 0xBA, 0x01, 0x00, 0xDE, 0x84, 0xAF, 0xBB, 0x23, 0x3D,
+    0xEE, 0x76, 0x32, 0x89, 0x22, 0x84, 0x8F, 0x21, 0x39, 0x10, 0x25, 0x24, 0x23, 0xAE, 0x04, 0x18,
+    0x01, 0x71, 0x18, 0x80, 0x79, 0xBA, 0x01, 0x24, 0x7B, 0x44, 0x78, 0x5F, 0x90, 0xDE, 0x29, 0x4A,
+    0xD0, 0x21, 0x44, 0x3F, 0x00, 0xA0, 0xA3, 0x43, 0xC2, 0xA7, 0xCB, 0xD2, 0x81, 0xEB, 0x71, 0xB4,
+    0x9F, 0xAC, 0xA2, 0xF3, 0x42, 0x1C, 0xBC, 0x18, 0x12, 0xB4, 0x19, 0xB2, 0x0E, 0x99, 0x3A, 0x7D,
+    0xE8, 0xC0, 0x18, 0x47, 0x68, 0x2A, 0x5D, 0x0D, 0xDD, 0x0D, 0x43, 0xBD, 0xCD, 0x64, 0x85, 0x3D,
+    0xD6, 0xB8, 0x1C, 0x88, 0x59, 0xF8, 0x34, 0x00, 0x43, 0xAE, 0x0A, 0xA4, 0x4D, 0x45, 0x9F, 0xC8,
+    0xCB, 0xF1, 0xD9, 0x26, 0x50, 0xD3, 0x10, 0x7A, 0x9A, 0xED, 0xD9, 0x06, 0xE9, 0x72, 0x14, 0xC2,
+    0xC5, 0xD8, 0x19, 0xF7, 0x0A, 0x59, 0xAE, 0x87, 0x39, 0x06, 0x40, 0x21, 0x84, 0x50, 0x19, 0x9A,
+    0x79, 0x5E, 0xF9, 0x4E, 0xC3, 0x32, 0x7C, 0x71, 0x66, 0x72, 0x76, 0xDC, 0x04, 0x8F, 0xA4, 0x99,
+    0x6F, 0xE6, 0x39, 0x4D, 0x74, 0x90, 0x4E, 0x86, 0xF1, 0x62, 0x96, 0x9B, 0x69, 0xA3, 0xBA, 0x6B,
+    0x38, 0x33, 0x7F, 0xB2, 0xA5, 0x75, 0xB8, 0x5E, 0x63, 0x33, 0xCB, 0xCD, 0xB4, 0xDB, 0xE6, 0x7F,
+    0x62, 0xCE, 0x22, 0x70, 0x90, 0xCB, 0xAB, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44,
+    0xAE, 0x42, 0x60, 0x82, 0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D,
+    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x08, 0x06, 0x00, 0x00,
+    0x00, 0xE2, 0x98, 0x77, 0x38, 0x00, 0x00, 0x00, 0x01, 0x73, 0x52, 0x47, 0x42, 0x00, 0xAE, 0xCE,
+    0x1C, 0xE9, 0x00, 0x00, 0x09, 0x8C, 0x49, 0x44, 0x41, 0x54, 0x78, 0x01, 0xED, 0x9D, 0x49, 0x68,
+    0x54, 0x49, 0x1C, 0xC6, 0x2B, 0x8B, 0x93, 0x68, 0x12, 0x77, 0x07, 0x64, 0x54, 0x30, 0x4E, 0x14,
+    0x8D, 0x51, 0x11, 0x0F, 0xA2, 0x20, 0x8A, 0x30, 0x07, 0x43, 0xF0, 0xE2, 0x51, 0x6F, 0x82, 0x5E,
+    0x45, 0x64, 0x88, 0x0C, 0x08, 0xE3, 0x5C, 0xBC, 0x29, 0x03, 0x42, 0xBC, 0x78, 0x10, 0x41, 0x14,
+    0x41, 0x21, 0x03, 0x32, 0x8C, 0x37, 0xF7, 0x51, 0x71, 0x21, 0xEE, 0x18, 0x26, 0xEE, 0xB8, 0x8E,
+    0xEB, 0x24, 0x9A, 0x64, 0xFE, 0x5F, 0xD9, 0xDF, 0xA3, 0xBA, 0x7A, 0x7F, 0x76, 0xBD, 0xEE, 0x97,
+    0xAE, 0x3F, 0x54, 0x6A, 0xAF, 0xEA, 0xF7, 0xFB, 0x6A, 0x49, 0xBF, 0xAD, 0xAB, 0x54, 0x76, 0xAB,
+    0xB2, 0xB2, 0xED, 0xB8, 0x95, 0xAD, 0x72, 0xE5, 0xDB, 0xE5, 0xE3, 0x1A, 0x1F, 0xCE, 0xF1, 0xC1,
+    0xED, 0x7C, 0x3B, 0x1E, 0x54, 0xCF, 0x04, 0x8C, 0xE9, 0xF4, 0x51, 0x81, 0x61, 0xF8, 0x0C, 0x9B,
+    0xE9, 0x08, 0x57, 0xA2, 0x99, 0x70, 0x11, 0x66, 0x9C, 0x3E, 0x98, 0x30, 0x4C, 0x3F, 0xE0, 0x54,
+    0x1B, 0x84, 0xBE, 0x06, 0x08, 0xD6, 0xF4, 0x09, 0xDC, 0xF6, 0x51, 0x83, 0x69, 0x56, 0x33, 0x15,
+    0x15, 0x05, 0x54, 0x82, 0x65, 0xD8, 0xF6, 0x6D, 0x20, 0x2C, 0x9F, 0x76, 0x24, 0x13, 0xAA, 0xE9,
+    0x57, 0x4B, 0x0B, 0x74, 0x48, 0x47, 0x98, 0xF9, 0x68, 0x1C, 0xE1, 0x4A, 0x34, 0x82, 0x24, 0xF0,
+    0x21, 0x81, 0x80, 0x30, 0x7C, 0x3A, 0xE6, 0x99, 0x3E, 0x58, 0x21, 0xAE, 0xD2, 0xCD, 0x00, 0x82,
+    0x25, 0xF0, 0x1A, 0x29, 0x87, 0xB0, 0xED, 0x9B, 0x42, 0xA0, 0x2D, 0x58, 0xA5, 0x08, 0xA1, 0xE1,
+    0x7D, 0x3D, 0xE4, 0x00, 0x38, 0xD2, 0x00, 0x7D, 0x30, 0x83, 0x8F, 0x3C, 0x5A, 0x50, 0x9F, 0x02,
+    0x10, 0x3A, 0x7D, 0x02, 0x07, 0x74, 0xB8, 0x51, 0x09, 0x1F, 0xE5, 0x99, 0x46, 0x81, 0x58, 0x47,
+    0xB2, 0xB4, 0x8D, 0x74, 0x11, 0x02, 0x78, 0x72, 0xB4, 0x08, 0x13, 0x3C, 0xE1, 0x43, 0x80, 0x2F,
+    0xE2, 0xE0, 0x7F, 0x16, 0x07, 0x1E, 0x08, 0xC3, 0x4C, 0x11, 0x10, 0x1F, 0xA6, 0x00, 0x88, 0xC0,
+    0x50, 0xD8, 0x84, 0x0F, 0xF0, 0xB6, 0x43, 0x1D, 0x0A, 0x61, 0x8A, 0x20, 0xC9, 0x15, 0x37, 0x03,
+    0x6C, 0xF8, 0x00, 0x0F, 0x07, 0xF0, 0x70, 0xE0, 0x03, 0xDF, 0x34, 0x88, 0x10, 0x88, 0x08, 0x90,
+    0x1C, 0xC1, 0xF4, 0x29, 0x00, 0xC0, 0x7F, 0x97, 0x70, 0x75, 0x46, 0x18, 0x69, 0x9C, 0x11, 0x5C,
+    0x96, 0x58, 0x57, 0xB2, 0x2A, 0xC6, 0xCC, 0xD1, 0x8F, 0x11, 0xCE, 0x11, 0x3F, 0x20, 0x61, 0x3A,
+    0xB0, 0x04, 0x1B, 0x1A, 0xEB, 0x98, 0x69, 0xC1, 0xA8, 0x87, 0x18, 0x80, 0xDB, 0x20, 0x6E, 0x9C,
+    0xB8, 0xEF, 0xC5, 0x4D, 0x17, 0xD7, 0x22, 0xAE, 0x6D, 0xD3, 0xA6, 0x4D, 0x1D, 0xF7, 0xEF, 0xDF,
+    0xEF, 0x7E, 0xFB, 0xF6, 0x6D, 0xEF, 0xF0, 0xF0, 0xF0, 0xA0, 0x38, 0x6F, 0xC9, 0x04, 0x06, 0xC1,
+    0x06, 0x8C, 0xC0, 0x0A, 0xCC, 0x12, 0xEC, 0xC0, 0x10, 0x2C, 0xC1, 0x14, 0x6C, 0xC1, 0x18, 0xAC,
+    0x03, 0x71, 0xA0, 0x06, 0x22, 0x18, 0xD5, 0xF5, 0xE2, 0x9A, 0xC4, 0x4D, 0x16, 0xF7, 0x83, 0xB8,
+    0x1F, 0xC5, 0xB5, 0x1D, 0x3B, 0x76, 0xEC, 0xE7, 0x2F, 0x5F, 0xBE, 0x7C, 0x48, 0xEE, 0xCF, 0xC7,
+    0x32, 0x11, 0x00, 0x2B, 0x30, 0x03, 0xBB, 0x04, 0x43, 0xB0, 0x04, 0x53, 0xB0, 0x05, 0x63, 0xB0,
+    0xD6, 0x02, 0x98, 0x4B, 0x08, 0x12, 0xB8, 0xE1, 0xA2, 0x00, 0x96, 0x9D, 0x7A, 0x51, 0xB3, 0x79,
+    0xCB, 0x96, 0x2D, 0xBF, 0xD7, 0xD4, 0xD4, 0x8C, 0x91, 0xB8, 0xB7, 0x3C, 0x08, 0x54, 0x57, 0x57,
+    0x8F, 0x6A, 0x69, 0x69, 0x59, 0xF6, 0xEC, 0xD9, 0xB3, 0xBF, 0x2E, 0x5D, 0xBA, 0xF4, 0x56, 0xAA,
+    0x70, 0x83, 0x86, 0xCF, 0x3D, 0x40, 0xEF, 0x03, 0x1C, 0xFD, 0xF0, 0x31, 0x2D, 0x00, 0x1E, 0x53,
+    0x64, 0xB4, 0x38, 0x00, 0x6F, 0x90, 0x29, 0xF5, 0xDB, 0xCC, 0x99, 0x33, 0xDB, 0x25, 0xEC, 0xAD,
+    0x40, 0x02, 0xBD, 0xBD, 0xBD, 0x7F, 0x34, 0x37, 0x37, 0xFF, 0x22, 0xD5, 0x3E, 0x88, 0xFB, 0x28,
+    0xEE, 0x93, 0x38, 0xEC, 0x0F, 0xD8, 0x98, 0xB1, 0x59, 0x0F, 0x63, 0xD4, 0xC3, 0x20, 0x00, 0xC5,
+    0xE0, 0xBF, 0x99, 0x7A, 0x4F, 0x98, 0x3C, 0x79, 0x72, 0xAB, 0x2E, 0xE1, 0xFF, 0x14, 0x4C, 0x20,
+    0xC1, 0x8E, 0x6B, 0x3E, 0xB9, 0xEA, 0xA5, 0x27, 0xC1, 0x5B, 0xAF, 0x43, 0x68, 0x98, 0x02, 0x98,
+    0x22, 0xE8, 0x19, 0xD1, 0xD4, 0xD4, 0x34, 0xA3, 0xE0, 0x9E, 0x7D, 0x05, 0x4D, 0x20, 0xC1, 0x0E,
+    0xAB, 0x0A, 0x58, 0x9A, 0xCB, 0x3D, 0x79, 0x07, 0x02, 0x10, 0x19, 0x33, 0xB8, 0x1F, 0xB0, 0x12,
+    0xF3, 0xBD, 0x5F, 0x18, 0x01, 0x9B, 0x23, 0xF9, 0x06, 0xAD, 0x70, 0x09, 0x42, 0x02, 0x33, 0x91,
+    0x46, 0x07, 0x01, 0xBC, 0x7D, 0x1B, 0x01, 0x0E, 0x62, 0x32, 0x25, 0x67, 0xDD, 0x2A, 0x12, 0x91,
+    0x00, 0x33, 0x7D, 0x84, 0xCD, 0x3C, 0x5D, 0xC0, 0xFF, 0x09, 0x45, 0xC0, 0x64, 0x69, 0x32, 0x46,
+    0x63, 0x55, 0x80, 0x0C, 0x4B, 0xC9, 0x48, 0xA4, 0x31, 0x5F, 0x17, 0xF2, 0x7F, 0x42, 0x11, 0xE0,
+    0x40, 0x4E, 0xC7, 0x38, 0x65, 0x0F, 0x40, 0x0F, 0x2C, 0x18, 0xAA, 0x37, 0x5F, 0x29, 0x2B, 0x81,
+    0x14, 0xB6, 0x99, 0x46, 0x38, 0x0A, 0xD2, 0x65, 0x6D, 0xD1, 0x67, 0xE6, 0x24, 0x40, 0x8E, 0x29,
+    0xF0, 0x51, 0x33, 0x93, 0x00, 0x39, 0x5B, 0xF5, 0x05, 0x8A, 0x43, 0xC0, 0x0B, 0x50, 0x1C, 0x8E,
+    0xA1, 0x5B, 0xF1, 0x02, 0x84, 0x46, 0x57, 0x9C, 0x8A, 0x5E, 0x80, 0xE2, 0x70, 0x0C, 0xDD, 0x8A,
+    0x17, 0x20, 0x34, 0xBA, 0xE2, 0x54, 0xF4, 0x02, 0x14, 0x87, 0x63, 0xE8, 0x56, 0xBC, 0x00, 0xA1,
+    0xD1, 0x15, 0xA7, 0xA2, 0x17, 0xA0, 0x38, 0x1C, 0x43, 0xB7, 0x12, 0x2B, 0x01, 0x1E, 0x3D, 0x7A,
+    0xA4, 0x2E, 0x5E, 0xBC, 0xA8, 0x0F, 0xF6, 0xD0, 0xA1, 0x43, 0x4A, 0xAE, 0xD4, 0xA9, 0xF5, 0xEB,
+    0xD7, 0xAB, 0xEB, 0xD7, 0xAF, 0x87, 0x06, 0x50, 0xEA, 0x8A, 0x38, 0x4F, 0x5D, 0x96, 0x36, 0x30,
+    0x30, 0xA0, 0xAE, 0x5C, 0xB9, 0xA2, 0x6E, 0xDD, 0xBA, 0xA5, 0xEE, 0xDE, 0xBD, 0xAB, 0xEE, 0xDD,
+    0xBB, 0xA7, 0x3E, 0x7E, 0xFC, 0xA8, 0xA6, 0x4E, 0x9D, 0xAA, 0x96, 0x2C, 0x59, 0xA2, 0x6E, 0xDF,
+    0xBE, 0xAD, 0xE4, 0x6A, 0x9D, 0xFE, 0xEC, 0x27, 0x4F, 0x9E, 0x54, 0x6D, 0x6D, 0xB8, 0xFC, 0x1A,
+    0x3F, 0x2B, 0x2B, 0x01, 0x00, 0xF8, 0xC2, 0x85, 0x0B, 0xEA, 0xEC, 0xD9, 0xB3, 0xEA, 0xF2, 0xE5,
+    0xCB, 0x0A, 0x22, 0xE4, 0x63, 0x67, 0xCE, 0x9C, 0x51, 0x9B, 0x37, 0x6F, 0x56, 0xF5, 0xF5, 0xB8,
+    0xDE, 0x1D, 0x2F, 0x2B, 0x0B, 0x01, 0xE4, 0xDA, 0xA9, 0x3A, 0x72, 0xE4, 0x88, 0x3A, 0x7F, 0xFE,
+    0xBC, 0x92, 0x3B, 0x0A, 0x0A, 0x26, 0xD8, 0xDF, 0xDF, 0xAF, 0x4E, 0x9F, 0x3E, 0xAD, 0x56, 0xAF,
+    0x5E, 0x5D, 0x70, 0xDD, 0x52, 0x57, 0x28, 0xA9, 0x00, 0x37, 0x6E, 0xDC, 0xD0, 0xE0, 0x31, 0xDA,
+    0xBF, 0xD5, 0xB0, 0x0C, 0x79, 0x01, 0xF2, 0xA4, 0xF8, 0xFE, 0xFD, 0x7B, 0xB5, 0x77, 0xEF, 0x5E,
+    0x3D, 0x6A, 0xF3, 0xAC, 0x92, 0xB3, 0x18, 0xC4, 0x7C, 0xF3, 0xE6, 0x8D, 0x1A, 0x3F, 0x7E, 0x7C,
+    0xCE, 0xB2, 0xE5, 0x54, 0x20, 0xF2, 0x19, 0x80, 0x8D, 0x75, 0xF7, 0xEE, 0xDD, 0xEA, 0xF5, 0xEB,
+    0xD7, 0x45, 0xE5, 0x20, 0x37, 0x49, 0xE9, 0x4D, 0x7B, 0xE5, 0xCA, 0x95, 0x59, 0xDB, 0x5D, 0xBB,
+    0x76, 0x6D, 0xD6, 0xFC, 0x5C, 0x99, 0xC7, 0x8F, 0x1F, 0xCF, 0x55, 0xA4, 0xA0, 0xFC, 0x48, 0xFF,
+    0x0D, 0x3D, 0x7C, 0xF8, 0xB0, 0xDA, 0xB1, 0x63, 0x47, 0xD1, 0xE1, 0xF3, 0x88, 0x21, 0x6E, 0xDC,
+    0x2C, 0x32, 0x01, 0xE4, 0x56, 0x3D, 0x75, 0xF0, 0xE0, 0x41, 0xA7, 0x7C, 0xAE, 0x5E, 0xBD, 0xEA,
+    0xB4, 0x7D, 0x17, 0x8D, 0x47, 0x22, 0xC0, 0x89, 0x13, 0x27, 0xD4, 0xFE, 0xFD, 0xFB, 0x5D, 0x7C,
+    0xFE, 0xA4, 0x36, 0x5F, 0xBD, 0x7A, 0xA5, 0x1E, 0x3C, 0x78, 0x90, 0x94, 0x56, 0xEE, 0x11, 0xE7,
+    0x7B, 0x00, 0x80, 0xEC, 0xDB, 0xB7, 0x2F, 0x32, 0x0E, 0x37, 0x6F, 0xDE, 0x54, 0xD3, 0xA7, 0xE3,
+    0x86, 0xE4, 0xF4, 0x56, 0xEC, 0x35, 0x3C, 0x7D, 0x2F, 0xF9, 0xA7, 0x3A, 0x9F, 0x01, 0x5D, 0x5D,
+    0x5D, 0x6A, 0x70, 0x10, 0xB7, 0xCE, 0x47, 0x63, 0x7D, 0x7D, 0x7D, 0xD1, 0x74, 0x54, 0xA4, 0x5E,
+    0x9C, 0x0A, 0x70, 0xEA, 0xD4, 0xA9, 0xC8, 0xCF, 0xD3, 0x3C, 0x7C, 0xF8, 0xB0, 0x48, 0x68, 0xA2,
+    0x69, 0xC6, 0xA9, 0x00, 0xDD, 0xDD, 0xDD, 0xD1, 0x1C, 0x85, 0xD1, 0x8B, 0x9F, 0x01, 0x09, 0x18,
+    0xF8, 0x52, 0x84, 0x13, 0x69, 0x51, 0xDB, 0xCB, 0x97, 0x2F, 0xF5, 0x49, 0xBB, 0xA8, 0xFB, 0x0D,
+    0xDB, 0x9F, 0xB3, 0x19, 0x80, 0xF3, 0x3A, 0xF8, 0x72, 0x54, 0x0A, 0x7B, 0xFE, 0xFC, 0x79, 0x29,
+    0xBA, 0x0D, 0xD5, 0xA7, 0x33, 0x01, 0x4A, 0x79, 0x8E, 0x1E, 0x67, 0x55, 0xE3, 0x62, 0xCE, 0x04,
+    0xC0, 0x52, 0x50, 0x2A, 0x8B, 0x93, 0x00, 0xCE, 0xBE, 0x07, 0x14, 0xFB, 0x5C, 0x4F, 0x21, 0x62,
+    0x7E, 0xFA, 0x84, 0x27, 0x81, 0xD2, 0x5B, 0xC5, 0x9C, 0x0B, 0xC2, 0x26, 0x5C, 0x2A, 0x8B, 0xD3,
+    0x0C, 0x70, 0xB6, 0x04, 0x95, 0x0A, 0x7E, 0xDC, 0xFA, 0x75, 0x26, 0x40, 0x29, 0xCF, 0xCB, 0x8F,
+    0x19, 0x13, 0x9F, 0x27, 0x6A, 0x9D, 0xED, 0x01, 0x13, 0x26, 0x4C, 0x50, 0x4F, 0x9E, 0x3C, 0x29,
+    0xC9, 0x80, 0x1C, 0x3D, 0x1A, 0x4F, 0xD9, 0xA6, 0xB7, 0x8A, 0x39, 0x17, 0x34, 0x71, 0xE2, 0xC4,
+    0xF4, 0x04, 0x22, 0x48, 0x6D, 0x68, 0xC0, 0x1B, 0x01, 0xE2, 0x61, 0xCE, 0x96, 0xA0, 0xF9, 0xF3,
+    0xE7, 0x97, 0x8C, 0x40, 0xB6, 0x19, 0x50, 0xB2, 0x0F, 0x95, 0xA1, 0x63, 0x67, 0x02, 0x2C, 0x5D,
+    0xBA, 0x54, 0x55, 0x55, 0xA5, 0x7D, 0x28, 0x24, 0xC3, 0x47, 0x29, 0x5E, 0xF2, 0x94, 0x29, 0x53,
+    0x8A, 0xD7, 0x98, 0xE3, 0x96, 0x9C, 0x09, 0x80, 0x3D, 0x40, 0xDE, 0x97, 0xE0, 0xF8, 0xE3, 0xA7,
+    0x36, 0x3F, 0x69, 0xD2, 0x24, 0x15, 0xA7, 0x4D, 0xD8, 0x99, 0x00, 0x40, 0xB3, 0x66, 0xCD, 0x9A,
+    0x54, 0x42, 0x8E, 0x53, 0x66, 0xCC, 0x88, 0xD7, 0x83, 0xFD, 0x4E, 0x05, 0x58, 0xB5, 0x6A, 0x95,
+    0x9A, 0x33, 0x67, 0x8E, 0x63, 0xE4, 0xC9, 0xCD, 0x4F, 0x9B, 0x36, 0x2D, 0x39, 0xA1, 0xCC, 0x63,
+    0x4E, 0x05, 0xC0, 0xB1, 0xCB, 0xEB, 0x6E, 0x22, 0xDD, 0x0B, 0xE2, 0x36, 0x03, 0x9C, 0x7D, 0x0F,
+    0xE0, 0xC0, 0x9B, 0x35, 0x6B, 0x96, 0xBE, 0x83, 0xF9, 0xC0, 0x81, 0x03, 0x4C, 0x72, 0xEA, 0xCF,
+    0x9D, 0x3B, 0x37, 0x6B, 0xFB, 0x15, 0x73, 0x2E, 0xC8, 0xA4, 0xB0, 0x6E, 0xDD, 0x3A, 0x05, 0xE7,
+    0xDA, 0xF0, 0xDD, 0x23, 0xDB, 0x05, 0x79, 0xD7, 0xFD, 0x87, 0x69, 0xDF, 0xF9, 0x12, 0xC4, 0x0F,
+    0xB5, 0x61, 0xC3, 0x06, 0xD5, 0xD1, 0xD1, 0xC1, 0xA8, 0x13, 0x7F, 0xD1, 0xA2, 0x45, 0x4E, 0xDA,
+    0x75, 0xD9, 0x68, 0x64, 0x02, 0xE0, 0x20, 0x36, 0x6E, 0xDC, 0xA8, 0xB6, 0x6E, 0xDD, 0xAA, 0x5C,
+    0x7D, 0x53, 0x8D, 0xA3, 0x00, 0xCE, 0xF7, 0x00, 0x7B, 0xF4, 0xAC, 0x58, 0xB1, 0x42, 0xCD, 0x9B,
+    0x37, 0x4F, 0xED, 0xD9, 0xB3, 0x47, 0x5D, 0xBB, 0x76, 0xCD, 0xCE, 0x0E, 0x1D, 0xC7, 0x97, 0xBE,
+    0x85, 0x0B, 0x17, 0xE6, 0xAC, 0x5F, 0x31, 0xE7, 0x82, 0xB2, 0x91, 0x90, 0x57, 0x79, 0xA9, 0x9D,
+    0x3B, 0x77, 0xAA, 0xCE, 0xCE, 0x4E, 0x35, 0x7B, 0xF6, 0xEC, 0x6C, 0x45, 0xF3, 0xCE, 0x83, 0xA8,
+    0xA5, 0x3C, 0x03, 0x9B, 0xF7, 0x07, 0xB5, 0x0A, 0x46, 0x3E, 0x03, 0xCC, 0xFE, 0x71, 0xBA, 0x02,
+    0x0E, 0x33, 0xE1, 0xE8, 0xD1, 0xA3, 0x0A, 0xF7, 0x76, 0x86, 0xBD, 0x90, 0x1F, 0xC7, 0x67, 0x03,
+    0xC0, 0xA2, 0xA4, 0x02, 0x50, 0x8C, 0x05, 0x0B, 0x16, 0x28, 0x38, 0x5C, 0x47, 0x3E, 0x77, 0xEE,
+    0x9C, 0x76, 0x3D, 0x3D, 0x3D, 0x79, 0xDF, 0x51, 0x57, 0x57, 0x57, 0xA7, 0x96, 0x2F, 0x5F, 0xCE,
+    0xE6, 0x62, 0xE5, 0x97, 0x85, 0x00, 0x24, 0x86, 0xF3, 0x38, 0xED, 0xED, 0xED, 0xDA, 0xE1, 0x21,
+    0x0E, 0x3C, 0x11, 0x79, 0xE7, 0xCE, 0x1D, 0xFD, 0x90, 0x1E, 0x1E, 0x63, 0xFA, 0xFC, 0x19, 0x6F,
+    0x7B, 0x4C, 0xB5, 0x65, 0xCB, 0x96, 0xC5, 0xF2, 0xF9, 0x30, 0x1C, 0x49, 0x59, 0x09, 0x60, 0xA2,
+    0x6D, 0x6C, 0x6C, 0x54, 0x78, 0xD8, 0x82, 0x0F, 0x5C, 0x0C, 0x0D, 0x0D, 0x29, 0xDC, 0xF5, 0xF6,
+    0xF4, 0xE9, 0x53, 0x5D, 0x0C, 0x27, 0xFA, 0x70, 0xE1, 0x1F, 0xF7, 0x00, 0xC5, 0x75, 0xF9, 0xC1,
+    0x81, 0xE0, 0x7C, 0x31, 0x5E, 0x2A, 0x07, 0x87, 0xD7, 0x2B, 0xE2, 0x6D, 0xB9, 0xB8, 0x9E, 0xD7,
+    0x28, 0x6E, 0xAC, 0xB8, 0x71, 0xB2, 0x26, 0xFF, 0x29, 0xBE, 0xB7, 0x90, 0x04, 0xE4, 0xBF, 0xB3,
+    0x9F, 0xA4, 0xEA, 0xBF, 0xE2, 0xF0, 0x06, 0xDD, 0xF7, 0xE2, 0x70, 0xD3, 0x52, 0xBF, 0x38, 0x4C,
+    0xE7, 0xC1, 0x48, 0xBF, 0x07, 0x48, 0x87, 0xDE, 0x2C, 0x02, 0x5E, 0x00, 0x0B, 0x48, 0xD4, 0x51,
+    0x2F, 0x40, 0xD4, 0xC4, 0xAD, 0xFE, 0xBC, 0x00, 0x16, 0x90, 0xA8, 0xA3, 0x5E, 0x80, 0xA8, 0x89,
+    0x5B, 0xFD, 0x79, 0x01, 0x2C, 0x20, 0x51, 0x47, 0xBD, 0x00, 0x51, 0x13, 0xB7, 0xFA, 0xF3, 0x02,
+    0x58, 0x40, 0xA2, 0x8E, 0x66, 0x12, 0x80, 0xBF, 0xF6, 0x53, 0x9A, 0x47, 0x5C, 0xA2, 0xA6, 0xE0,
+    0xB6, 0xBF, 0xAC, 0x2C, 0xD3, 0x09, 0xE0, 0xA1, 0xBB, 0x13, 0x24, 0x85, 0x2D, 0x05, 0x60, 0x86,
+    0xE9, 0x23, 0x8C, 0x1F, 0x9C, 0xF1, 0xF6, 0x6D, 0x04, 0xC0, 0x10, 0x2C, 0x4D, 0xB6, 0x68, 0x51,
+    0xC7, 0x21, 0x40, 0xBA, 0x0C, 0xA4, 0xB1, 0x22, 0x0A, 0x7B, 0x0B, 0x4F, 0xC0, 0x64, 0x99, 0xC2,
+    0x9A, 0x33, 0x00, 0xCD, 0x23, 0x93, 0x85, 0x01, 0x1F, 0x2E, 0xBA, 0x47, 0xDC, 0xA5, 0xB3, 0x11,
+    0x6A, 0x60, 0x48, 0x9E, 0x1C, 0xD4, 0x14, 0x22, 0xE5, 0xED, 0xE9, 0xA6, 0x08, 0xA8, 0xC8, 0xCA,
+    0x23, 0x94, 0x8D, 0xF3, 0xC3, 0xE2, 0x20, 0x26, 0x47, 0xF2, 0x0D, 0x3A, 0xE6, 0x0C, 0x60, 0x06,
+    0x7C, 0x56, 0xC2, 0xCB, 0xDB, 0x3E, 0xBF, 0x7B, 0xF7, 0xAE, 0x2F, 0x28, 0xED, 0x03, 0x05, 0x11,
+    0x48, 0xB0, 0xE3, 0x6F, 0x86, 0xD9, 0x22, 0x80, 0x75, 0x30, 0x03, 0x28, 0x00, 0xE1, 0xA3, 0x30,
+    0x04, 0x18, 0x78, 0xF1, 0xE2, 0x45, 0x0F, 0x0A, 0x7A, 0x2B, 0x9C, 0x40, 0x82, 0x1D, 0x5E, 0xFD,
+    0x08, 0x96, 0x60, 0x6A, 0x8B, 0x10, 0x08, 0x80, 0xD6, 0x39, 0xFA, 0x21, 0x82, 0x1E, 0xFD, 0xE2,
+    0x0F, 0xEC, 0xDA, 0xB5, 0xAB, 0x4B, 0xDE, 0x76, 0x12, 0x9F, 0x27, 0x9F, 0x71, 0x24, 0x65, 0x60,
+    0x60, 0x06, 0x76, 0xF2, 0x51, 0x20, 0x00, 0x67, 0x01, 0xD8, 0xC2, 0xE9, 0xD1, 0x2F, 0xBE, 0xBE,
+    0x12, 0x06, 0x1F, 0x66, 0xFE, 0xD4, 0x06, 0x96, 0x26, 0xC4, 0xAB, 0xE5, 0xB7, 0x10, 0x3F, 0x2C,
+    0x5E, 0xBC, 0xF8, 0x31, 0x7E, 0x1B, 0x11, 0xBF, 0x91, 0x88, 0x82, 0xDE, 0xB2, 0x13, 0x00, 0x7C,
+    0x79, 0x51, 0xC9, 0xAF, 0xDB, 0xB6, 0x6D, 0xFB, 0x5B, 0x4A, 0xE2, 0xEA, 0x17, 0xAF, 0x80, 0xE9,
+    0xAB, 0x60, 0x12, 0x0F, 0x84, 0xC0, 0xA5, 0x48, 0x13, 0xBC, 0x44, 0x83, 0x59, 0x81, 0x74, 0x6D,
+    0xF2, 0x9A, 0xE0, 0x5E, 0xFC, 0x30, 0x65, 0x6B, 0x6B, 0xEB, 0xD8, 0xDA, 0xDA, 0xDA, 0xEF, 0xE4,
+    0x2E, 0x04, 0x5C, 0xAE, 0x0C, 0xF2, 0x13, 0xC5, 0x2A, 0xDD, 0x1B, 0x92, 0x35, 0xFF, 0x9F, 0xC7,
+    0x8F, 0x1F, 0x9F, 0xDE, 0xBE, 0x7D, 0x7B, 0x67, 0x02, 0xFE, 0x7F, 0x02, 0x05, 0xF0, 0x31, 0x0B,
+    0xE0, 0xB8, 0x0C, 0x71, 0xC9, 0x4F, 0x82, 0xAF, 0x47, 0xBC, 0x14, 0x82, 0x28, 0xB8, 0x58, 0x8F,
+    0xD1, 0x8E, 0xDF, 0x41, 0x84, 0xC3, 0xB5, 0x62, 0x86, 0xE1, 0x23, 0x8F, 0xD7, 0x92, 0x39, 0x5B,
+    0x2A, 0x4D, 0x10, 0x42, 0xC4, 0x68, 0x26, 0x58, 0x8C, 0x70, 0xC2, 0x86, 0x6F, 0xC2, 0xE7, 0x32,
+    0x94, 0xB4, 0x0F, 0x00, 0x74, 0xB0, 0x1E, 0x25, 0xC2, 0x6C, 0x50, 0xA2, 0xDA, 0x90, 0x8F, 0x34,
+    0xEE, 0x0B, 0x68, 0x14, 0xF5, 0x20, 0x00, 0xE0, 0x53, 0x00, 0x09, 0x56, 0xCC, 0xAC, 0x20, 0x33,
+    0xB2, 0x21, 0x33, 0x30, 0x22, 0x27, 0x00, 0x37, 0x5D, 0x12, 0x78, 0xC9, 0x43, 0xDD, 0x94, 0xDF,
+    0x94, 0x67, 0x83, 0x92, 0x17, 0x18, 0x1A, 0x37, 0x05, 0x30, 0x47, 0x3E, 0xE1, 0x9B, 0xA3, 0xDF,
+    0x0C, 0x07, 0x8D, 0x8C, 0xA0, 0x00, 0xE1, 0xE3, 0x90, 0x34, 0x44, 0xF1, 0xC9, 0x88, 0x33, 0x01,
+    0x22, 0x20, 0x0C, 0x01, 0x98, 0x66, 0x0A, 0x20, 0xC9, 0x5F, 0x8D, 0xF7, 0x05, 0x99, 0x8D, 0x22,
+    0x07, 0x0D, 0xC2, 0xCC, 0x0E, 0x00, 0x1E, 0x0D, 0x72, 0xE4, 0x73, 0xC9, 0x32, 0x81, 0x9B, 0x61,
+    0xD4, 0x1F, 0xA9, 0x66, 0xF2, 0x42, 0x18, 0xBC, 0xE8, 0x13, 0xB4, 0xED, 0xB3, 0x0C, 0x99, 0xEA,
+    0x36, 0x4C, 0x60, 0x0C, 0xC3, 0xB7, 0x1D, 0x97, 0x1A, 0x8E, 0x78, 0xFA, 0x66, 0x9D, 0x91, 0x0A,
+    0x3B, 0xDB, 0x71, 0x69, 0x88, 0x09, 0xF8, 0x14, 0x80, 0x3E, 0x67, 0x05, 0xE2, 0xB6, 0x43, 0x9B,
+    0x48, 0x4B, 0x59, 0xB3, 0x6D, 0xA0, 0xB6, 0x10, 0x66, 0x9C, 0xF5, 0x59, 0x07, 0xF1, 0x4A, 0x34,
+    0xC2, 0xC5, 0xB1, 0x33, 0x9C, 0xCE, 0x67, 0xBE, 0xE9, 0xA7, 0x08, 0x80, 0x4C, 0x18, 0xA1, 0xD2,
+    0xB7, 0xD3, 0xD2, 0xA5, 0xEB, 0x8A, 0x15, 0xF8, 0x47, 0x8F, 0xE4, 0xC4, 0x71, 0x13, 0x3C, 0xA2,
+    0x76, 0xBA, 0x9D, 0xA6, 0xAB, 0x98, 0x20, 0x75, 0x82, 0xF5, 0xC7, 0xCE, 0xB7, 0xE3, 0x56, 0xF1,
+    0x40, 0x38, 0x3B, 0x7D, 0xA4, 0xC5, 0x4D, 0xB8, 0xE9, 0x8E, 0xCD, 0xCE, 0xB7, 0xE3, 0x41, 0x9D,
+    0xFF, 0x01, 0xB2, 0x15, 0x34, 0x9A, 0xBC, 0x3E, 0x46, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
+    0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82,
+};
+
+static const T_UtilAssetEntry s_widgetInteractionEnBigScreenAssetPackEntries[8] = {
+    {"widget_config.json", 0xFDD7A11Cu, 0, 1986, 7177, UTIL_ASSET_COMPRESSION_LZ4},
+    {"icon_button1.png", 0xFE738FADu, 1986, 2137, 2137, UTIL_ASSET_COMPRESSION_NONE},
+    {"icon_button2.png", 0x483BEBD4u, 4123, 2114, 2114, UTIL_ASSET_COMPRESSION_NONE},
+    {"icon_list_item1.png", 0xBB4F9E0Du, 6237, 2556, 2556, UTIL_ASSET_COMPRESSION_NONE},
+    {"icon_list_item2.png", 0x0517FA34u, 8793, 2578, 2578, UTIL_ASSET_COMPRESSION_NONE},
+    {"icon_scale.png", 0xCA6B2C1Cu, 11371, 2440, 2440, UTIL_ASSET_COMPRESSION_NONE},
+    {"icon_switch_select.png", 0x0788E23Bu, 13811, 2529, 2529, UTIL_ASSET_COMPRESSION_NONE},
+    {"icon_switch_unselect.png", 0x040857ECu, 16340, 2514, 2514, UTIL_ASSET_COMPRESSION_NONE},
+};
+
+static const uint16_t s_widgetInteractionEnBigScreenAssetPackBuckets[16] = {
+    8, 0, 0, 0, 3, 5, 0, 0, 0, 0, 0, 7, 1, 2, 4, 6,
+};
+
+static uint8_t *s_widgetInteractionEnBigScreenAssetPackCache[8];
+
+const T_UtilAssetPack g_widgetInteractionEnBigScreenAssetPack = {
+    s_widgetInteractionEnBigScreenAssetPackBlob,
+    s_widgetInteractionEnBigScreenAssetPackEntries,
+    8,
+    s_widgetInteractionEnBigScreenAssetPackBuckets,
+    15,
+    s_widgetInteractionEnBigScreenAssetPackCache
+};
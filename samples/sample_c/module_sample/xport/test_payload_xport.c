@@ -30,22 +30,20 @@
 #include "dji_platform.h"
 #include "utils/util_misc.h"
 #include "dji_aircraft_info.h"
-#include "camera_emu/test_payload_cam_emu_base.h"
+#include "test_payload_xport_state.h"
 
 /* Private constants ---------------------------------------------------------*/
-#define XPORT_TASK_FREQ             (10)
-#define XPORT_TASK_STACK_SIZE       (2048)
 
 /* Private types -------------------------------------------------------------*/
 
 
 /* Private functions declaration ---------------------------------------------*/
-static void *UserXPort_Task(void *arg);
+static void ReceiveXPortLimitAngleChange(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                         T_DjiXPortLimitAngle limitAngle);
 static T_DjiReturnCode ReceiveXPortSystemState(T_DjiGimbalSystemState systemState);
 static T_DjiReturnCode ReceiveXPortAttitudeInformation(T_DjiGimbalAttitudeInformation attitudeInformation);
 
 /* Private variables ---------------------------------------------------------*/
-static T_DjiTaskHandle s_userXPortThread;
 static T_DjiMutexHandle s_userXPortMutex;
 static T_DjiGimbalSystemState s_userXPortSystemState = {0};
 static bool s_isUserXPortInited = false;
@@ -73,6 +71,13 @@ T_DjiReturnCode DjiTest_XPortStartService(void)
         return djiStat;
     }
 
+    djiStat = DjiTest_XPortStateStart(NULL);
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("start XPort state error: 0x%08llX.", djiStat);
+        return djiStat;
+    }
+    DjiTest_XPortStateRegLimitAngleChangeCallback(ReceiveXPortLimitAngleChange);
+
     djiStat = DjiXPort_RegReceiveSystemStateCallback(ReceiveXPortSystemState);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("register receive XPort system state callback function error: 0x%08llX.", djiStat);
@@ -88,7 +93,7 @@ T_DjiReturnCode DjiTest_XPortStartService(void)
 
     limitAngle.upperLimit = 300;
     limitAngle.lowerLimit = -1000;
-    djiStat = DjiXPort_SetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_JOINT_ANGLE, limitAngle);
+    djiStat = DjiTest_XPortStateSetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_JOINT_ANGLE, limitAngle);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("set pitch joint angle limit angle for XPort error: 0x%08llX.", djiStat);
         return djiStat;
@@ -96,7 +101,7 @@ T_DjiReturnCode DjiTest_XPortStartService(void)
 
     limitAngle.upperLimit = 300;
     limitAngle.lowerLimit = -800;
-    djiStat = DjiXPort_SetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_EULER_ANGLE, limitAngle);
+    djiStat = DjiTest_XPortStateSetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_EULER_ANGLE, limitAngle);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("set pitch euler angle limit angle for XPort error: 0x%08llX.", djiStat);
         return djiStat;
@@ -104,7 +109,7 @@ T_DjiReturnCode DjiTest_XPortStartService(void)
 
     limitAngle.upperLimit = 300;
     limitAngle.lowerLimit = -1000;
-    djiStat = DjiXPort_SetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_EULER_ANGLE_EXTENSION, limitAngle);
+    djiStat = DjiTest_XPortStateSetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_EULER_ANGLE_EXTENSION, limitAngle);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("set pitch extension euler angle limit angle for XPort error: 0x%08llX.", djiStat);
         return djiStat;
@@ -130,7 +135,7 @@ T_DjiReturnCode DjiTest_XPortStartService(void)
         return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
     }
 
-    djiStat = DjiXPort_SetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_YAW_JOINT_ANGLE, limitAngle);
+    djiStat = DjiTest_XPortStateSetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_YAW_JOINT_ANGLE, limitAngle);
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         USER_LOG_ERROR("set yaw joint angle limit angle for XPort error: 0x%08llX.", djiStat);
         return djiStat;
@@ -148,10 +153,11 @@ T_DjiReturnCode DjiTest_XPortStartService(void)
         return djiStat;
     }
 
-    if (osalHandler->TaskCreate("user_xport_task", UserXPort_Task, XPORT_TASK_STACK_SIZE, NULL, &s_userXPortThread) !=
-        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("user XPort task create error.");
-        return DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+    // Read back every limit angle once, the cache is refreshed again only when the system state changes.
+    djiStat = DjiTest_XPortStateRefreshLimitAngles();
+    if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("refresh XPort limit angles error: 0x%08llX.", djiStat);
+        return djiStat;
     }
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
@@ -162,9 +168,9 @@ T_DjiReturnCode DjiTest_XPortDeInit(void)
     T_DjiReturnCode djiStat;
     T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
 
-    djiStat = osalHandler->TaskDestroy(s_userXPortThread);
+    djiStat = DjiTest_XPortStateStop();
     if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-        USER_LOG_ERROR("Destroy test xport thread error: 0x%08llX.", djiStat);
+        USER_LOG_ERROR("Stop test xport state error: 0x%08llX.", djiStat);
         return djiStat;
     }
 
@@ -213,104 +219,13 @@ T_DjiReturnCode DjiTest_XPortGetSystemState(T_DjiGimbalSystemState *systemState)
 }
 
 /* Private functions definition-----------------------------------------------*/
-#ifndef __CC_ARM
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmissing-noreturn"
-#pragma GCC diagnostic ignored "-Wreturn-type"
-#endif
-
-static void *UserXPort_Task(void *arg)
+static void ReceiveXPortLimitAngleChange(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                         T_DjiXPortLimitAngle limitAngle)
 {
-    T_DjiReturnCode djiStat;
-    T_DjiXPortLimitAngle limitAngle = {0};
-    float opticalZoomFactor = 1.0f;
-    float digitalZoomFactor = 1.0f;
-    int step = 0;
-    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
-
-    USER_UTIL_UNUSED(arg);
-
-    while (1) {
-        osalHandler->TaskSleepMs(1000 / XPORT_TASK_FREQ);
-        step++;
-
-        if (USER_UTIL_IS_WORK_TURN(step, 1, XPORT_TASK_FREQ)) {
-            djiStat = DjiXPort_GetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_ROLL_JOINT_ANGLE, &limitAngle);
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("get roll joint angle limit angle from XPort error: 0x%08llX.", djiStat);
-                continue;
-            }
-
-            USER_LOG_DEBUG("roll joint angle limit angle of XPort: upper limit %d, lower limit %d.",
-                           limitAngle.upperLimit, limitAngle.lowerLimit);
-
-            djiStat = DjiXPort_GetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_JOINT_ANGLE, &limitAngle);
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("get pitch joint angle limit angle from XPort error: 0x%08llX.", djiStat);
-                continue;
-            }
-
-            USER_LOG_DEBUG("pitch joint angle limit angle of XPort: upper limit %d, lower limit %d.",
-                           limitAngle.upperLimit, limitAngle.lowerLimit);
-
-            djiStat = DjiXPort_GetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_EULER_ANGLE, &limitAngle);
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("get pitch euler angle limit angle from XPort error: 0x%08llX.", djiStat);
-                continue;
-            }
-
-            USER_LOG_DEBUG("pitch euler angle limit angle of XPort: upper limit %d, lower limit %d.",
-                           limitAngle.upperLimit, limitAngle.lowerLimit);
-
-            djiStat = DjiXPort_GetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_EULER_ANGLE_EXTENSION,
-                                                 &limitAngle);
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("get pitch extension euler angle limit angle from XPort error: 0x%08llX.",
-                               djiStat);
-                continue;
-            }
-
-            USER_LOG_DEBUG("pitch extension euler angle limit angle of XPort: upper limit %d, lower limit %d.",
-                           limitAngle.upperLimit, limitAngle.lowerLimit);
-
-            djiStat = DjiXPort_GetLimitAngleSync(DJI_XPORT_LIMIT_ANGLE_CATEGORY_YAW_JOINT_ANGLE, &limitAngle);
-            if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                USER_LOG_ERROR("get yaw joint angle limit angle from XPort error: 0x%08llX.", djiStat);
-                continue;
-            }
-
-            USER_LOG_DEBUG("yaw joint angle limit angle of XPort: upper limit %d, lower limit %d.",
-                           limitAngle.upperLimit, limitAngle.lowerLimit);
-        }
-
-        if (USER_UTIL_IS_WORK_TURN(step, 10, XPORT_TASK_FREQ)) {
-            if (DjiTest_CameraIsInited()) {
-                djiStat = DjiTest_CameraGetOpticalZoomFactor(&opticalZoomFactor);
-                if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    USER_LOG_ERROR("get camera optical zoom factor error: %d.", djiStat);
-                    continue;
-                }
-
-                djiStat = DjiTest_CameraGetDigitalZoomFactor(&digitalZoomFactor);
-                if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    USER_LOG_ERROR("get camera digital zoom factor error: %d.", djiStat);
-                    continue;
-                }
-
-                djiStat = DjiXPort_SetSpeedConversionFactor(1 / (opticalZoomFactor * digitalZoomFactor));
-                if (djiStat != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
-                    USER_LOG_ERROR("set speed conversion factor error: %d.", djiStat);
-                    continue;
-                }
-            }
-        }
-    }
+    USER_LOG_INFO("limit angle %d of XPort changed: upper limit %d, lower limit %d.", limitAngleCategory,
+                  limitAngle.upperLimit, limitAngle.lowerLimit);
 }
 
-#ifndef __CC_ARM
-#pragma GCC diagnostic pop
-#endif
-
 static T_DjiReturnCode ReceiveXPortSystemState(T_DjiGimbalSystemState systemState)
 {
     T_DjiReturnCode returnCode;
@@ -331,6 +246,8 @@ static T_DjiReturnCode ReceiveXPortSystemState(T_DjiGimbalSystemState systemStat
         return returnCode;
     }
 
+    DjiTest_XPortStateUpdateSystemState(&systemState);
+
     USER_LOG_DEBUG("receive XPort system state: mounted upward flag %d, gimbal mode %d.",
                    systemState.mountedUpward, systemState.gimbalMode);
 
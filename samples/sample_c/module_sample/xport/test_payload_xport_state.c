@@ -0,0 +1,596 @@
+/**
+ ********************************************************************
+ * @file    test_payload_xport_state.c
+ * @brief   Cached XPort limit angles and speed conversion factor, refreshed on change or on demand
+ * instead of polled, so that the link is left to the gimbal control commands.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "test_payload_xport_state.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+#include "utils/util_misc.h"
+#include "camera_emu/test_payload_cam_emu_base.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define XPORT_STATE_TASK_STACK_SIZE                 (2048)
+#define XPORT_STATE_STOP_TIMEOUT_MS                 (2000)
+#define XPORT_STATE_LIMIT_ANGLE_ALL_MASK            ((1 << DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM) - 1)
+
+#define XPORT_BENCHMARK_TICK_MS                     (100)
+#define XPORT_BENCHMARK_ROUND_TRIP_MS               (5)
+#define XPORT_BENCHMARK_ZOOM_PERIOD_TICKS           (50)
+#define XPORT_BENCHMARK_ZOOM_DURATION_TICKS         (10)
+#define XPORT_BENCHMARK_SYSTEM_STATE_PERIOD_TICKS   (100)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    T_DjiTestXPortBackend backend;
+    T_DjiXPortLimitAngle limitAngles[DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM];
+    uint8_t validLimitAngleMask;
+    uint8_t staleLimitAngleMask;
+    float pendingSpeedConversionFactor;
+    float appliedSpeedConversionFactor;
+    bool isSpeedConversionFactorPending;
+    bool isSystemStateValid;
+    T_DjiGimbalSystemState systemState;
+    DjiTestXPortLimitAngleChangeCallback limitAngleChangeCallback;
+    T_DjiTestXPortStateStatistics statistics;
+} T_DjiTestXPortState;
+
+typedef struct {
+    uint32_t roundTripCount;
+    float opticalZoomFactor;
+    float digitalZoomFactor;
+} T_DjiTestXPortBenchmarkMock;
+
+/* Private functions declaration ---------------------------------------------*/
+static void DjiTest_XPortStateZoomChangeCallback(dji_f32_t opticalZoomFactor, dji_f32_t digitalZoomFactor);
+static void DjiTest_XPortStateApplySpeedConversionFactor(void);
+static void DjiTest_XPortStateFetchLimitAngles(uint8_t categoryMask);
+static void *DjiTest_XPortStateTask(void *arg);
+static T_DjiReturnCode DjiTest_XPortMockSetLimitAngleSync(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                          T_DjiXPortLimitAngle limitAngle);
+static T_DjiReturnCode DjiTest_XPortMockGetLimitAngleSync(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                          T_DjiXPortLimitAngle *limitAngle);
+static T_DjiReturnCode DjiTest_XPortMockSetSpeedConversionFactor(float factor);
+static void DjiTest_XPortBenchmarkZoomStep(uint32_t tick);
+
+/* Private variables ---------------------------------------------------------*/
+static T_DjiTestXPortState s_xportState;
+static T_DjiMutexHandle s_xportStateMutex = NULL;
+static T_DjiSemaHandle s_xportStateSema = NULL;
+static T_DjiSemaHandle s_xportStateStopSema = NULL;
+static T_DjiTaskHandle s_xportStateThread = NULL;
+static volatile bool s_isXPortStateRunning = false;
+static volatile bool s_isXPortStateStopping = false;
+static T_DjiTestXPortBenchmarkMock s_xportBenchmarkMock;
+
+static const T_DjiTestXPortBackend s_xportDefaultBackend = {
+    .SetLimitAngleSync = DjiXPort_SetLimitAngleSync,
+    .GetLimitAngleSync = DjiXPort_GetLimitAngleSync,
+    .SetSpeedConversionFactor = DjiXPort_SetSpeedConversionFactor,
+};
+
+static const T_DjiTestXPortBackend s_xportMockBackend = {
+    .SetLimitAngleSync = DjiTest_XPortMockSetLimitAngleSync,
+    .GetLimitAngleSync = DjiTest_XPortMockGetLimitAngleSync,
+    .SetSpeedConversionFactor = DjiTest_XPortMockSetSpeedConversionFactor,
+};
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Start the cached XPort state and the task applying its changes.
+ * @note The speed conversion factor follows the zoom change notifications of the camera emulation.
+ * @param backend: XPort calls to use, NULL selects the DjiXPort interfaces.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_XPortStateStart(const T_DjiTestXPortBackend *backend)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+
+    if (s_isXPortStateRunning == true) {
+        USER_LOG_ERROR("XPort state is already running.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    }
+
+    memset(&s_xportState, 0, sizeof(s_xportState));
+    s_xportState.backend = backend != NULL ? *backend : s_xportDefaultBackend;
+    s_xportState.appliedSpeedConversionFactor = 1.0f;
+
+    // The lock and the semaphore are never destroyed, a zoom notification racing a stop may still be using them.
+    if (s_xportStateMutex == NULL) {
+        returnCode = osalHandler->MutexCreate(&s_xportStateMutex);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("XPort state mutex create error: 0x%08llX.", returnCode);
+            s_xportStateMutex = NULL;
+            return returnCode;
+        }
+    }
+    if (s_xportStateSema == NULL) {
+        returnCode = osalHandler->SemaphoreCreate(0, &s_xportStateSema);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            s_xportStateSema = NULL;
+            return returnCode;
+        }
+    }
+    returnCode = osalHandler->SemaphoreCreate(0, &s_xportStateStopSema);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+
+    s_isXPortStateStopping = false;
+    returnCode = osalHandler->TaskCreate("xport_state", DjiTest_XPortStateTask, XPORT_STATE_TASK_STACK_SIZE, NULL,
+                                         &s_xportStateThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("XPort state task create error: 0x%08llX.", returnCode);
+        osalHandler->SemaphoreDestroy(s_xportStateStopSema);
+        s_xportStateStopSema = NULL;
+        return returnCode;
+    }
+
+    s_isXPortStateRunning = true;
+    DjiTest_CameraRegZoomChangeCallback(DjiTest_XPortStateZoomChangeCallback);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_XPortStateStop(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    if (s_isXPortStateRunning == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    // A notification already past the unregistration finds the state stopped under the lock and leaves it alone.
+    DjiTest_CameraRegZoomChangeCallback(NULL);
+    osalHandler->MutexLock(s_xportStateMutex);
+    s_isXPortStateRunning = false;
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    s_isXPortStateStopping = true;
+    osalHandler->SemaphorePost(s_xportStateSema);
+    if (osalHandler->SemaphoreTimedWait(s_xportStateStopSema, XPORT_STATE_STOP_TIMEOUT_MS) !=
+        DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Wait XPort state task timeout.");
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+    osalHandler->TaskDestroy(s_xportStateThread);
+    s_xportStateThread = NULL;
+
+    osalHandler->SemaphoreDestroy(s_xportStateStopSema);
+    s_xportStateStopSema = NULL;
+
+    return returnCode;
+}
+
+/**
+ * @brief Get a limit angle from the cache, it is only read from XPort if it is not cached yet.
+ * @param limitAngleCategory: limit angle category.
+ * @param limitAngle: pointer to the limit angle.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_XPortStateGetLimitAngle(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                T_DjiXPortLimitAngle *limitAngle)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    bool isValid;
+
+    if ((uint32_t) limitAngleCategory >= DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM || limitAngle == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_isXPortStateRunning == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_xportStateMutex);
+    isValid = (s_xportState.validLimitAngleMask & (1 << limitAngleCategory)) != 0;
+    *limitAngle = s_xportState.limitAngles[limitAngleCategory];
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    if (isValid) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    DjiTest_XPortStateFetchLimitAngles(1 << limitAngleCategory);
+
+    osalHandler->MutexLock(s_xportStateMutex);
+    isValid = (s_xportState.validLimitAngleMask & (1 << limitAngleCategory)) != 0;
+    *limitAngle = s_xportState.limitAngles[limitAngleCategory];
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    return isValid ? DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS : DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+}
+
+/**
+ * @brief Set a limit angle on XPort and in the cache, the value is not read back.
+ */
+T_DjiReturnCode DjiTest_XPortStateSetLimitAngle(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                T_DjiXPortLimitAngle limitAngle)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+
+    if ((uint32_t) limitAngleCategory >= DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_isXPortStateRunning == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    returnCode = s_xportState.backend.SetLimitAngleSync(limitAngleCategory, limitAngle);
+
+    osalHandler->MutexLock(s_xportStateMutex);
+    s_xportState.statistics.setLimitAngleCount++;
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_xportState.limitAngles[limitAngleCategory] = limitAngle;
+        s_xportState.validLimitAngleMask |= (1 << limitAngleCategory);
+        s_xportState.staleLimitAngleMask &= ~(1 << limitAngleCategory);
+    }
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    return returnCode;
+}
+
+/**
+ * @brief Read every limit angle from XPort again, from the state task, the changed ones are notified.
+ */
+T_DjiReturnCode DjiTest_XPortStateRefreshLimitAngles(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (s_isXPortStateRunning == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_xportStateMutex);
+    s_xportState.staleLimitAngleMask = XPORT_STATE_LIMIT_ANGLE_ALL_MASK;
+    osalHandler->MutexUnlock(s_xportStateMutex);
+    osalHandler->SemaphorePost(s_xportStateSema);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_XPortStateRegLimitAngleChangeCallback(DjiTestXPortLimitAngleChangeCallback callback)
+{
+    if (s_isXPortStateRunning == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    s_xportState.limitAngleChangeCallback = callback;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Feed the XPort system state, the limit angles are refreshed when the mounting, the gimbal mode or the pitch
+ * range extension changes, as XPort applies other limits then. Does not block, can be called from the sdk callback.
+ */
+void DjiTest_XPortStateUpdateSystemState(const T_DjiGimbalSystemState *systemState)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    bool isChanged = false;
+
+    if (s_isXPortStateRunning == false || systemState == NULL) {
+        return;
+    }
+
+    osalHandler->MutexLock(s_xportStateMutex);
+    if (s_xportState.isSystemStateValid == true &&
+        (s_xportState.systemState.mountedUpward != systemState->mountedUpward ||
+         s_xportState.systemState.gimbalMode != systemState->gimbalMode ||
+         s_xportState.systemState.pitchRangeExtensionEnabledFlag != systemState->pitchRangeExtensionEnabledFlag)) {
+        s_xportState.staleLimitAngleMask = XPORT_STATE_LIMIT_ANGLE_ALL_MASK;
+        isChanged = true;
+    }
+    s_xportState.systemState = *systemState;
+    s_xportState.isSystemStateValid = true;
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    if (isChanged) {
+        osalHandler->SemaphorePost(s_xportStateSema);
+    }
+}
+
+T_DjiReturnCode DjiTest_XPortStateGetStatistics(T_DjiTestXPortStateStatistics *statistics)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (statistics == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_isXPortStateRunning == false) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->MutexLock(s_xportStateMutex);
+    *statistics = s_xportState.statistics;
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Count the XPort round trips of the former 10Hz polling and of the cached state against a mocked XPort, for
+ * the same zoom and system state activity: a zoom of 1 second every 5 seconds, a mounting change every 10 seconds and a
+ * gimbal controller reading the limit angles at 10Hz.
+ * @param durationMs: duration of each run.
+ * @return Execution result.
+ */
+T_DjiReturnCode DjiTest_XPortRunRoundTripBenchmark(uint32_t durationMs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiXPortLimitAngle limitAngle = {0};
+    T_DjiGimbalSystemState systemState = {0};
+    T_DjiTestXPortStateStatistics statistics = {0};
+    T_DjiReturnCode returnCode;
+    uint32_t tickCount = durationMs / XPORT_BENCHMARK_TICK_MS;
+    uint32_t pollingRoundTripCount;
+    uint32_t tick;
+    uint8_t category;
+
+    // Polling: every limit angle at 1Hz and the speed conversion factor at 10Hz, whatever happens.
+    memset(&s_xportBenchmarkMock, 0, sizeof(s_xportBenchmarkMock));
+    for (tick = 1; tick <= tickCount; tick++) {
+        DjiTest_XPortBenchmarkZoomStep(tick);
+        if (USER_UTIL_IS_WORK_TURN(tick, 1, 1000 / XPORT_BENCHMARK_TICK_MS)) {
+            for (category = 0; category < DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM; category++) {
+                s_xportMockBackend.GetLimitAngleSync((E_DjiXPortLimitAngleCategory) category, &limitAngle);
+            }
+        }
+        s_xportMockBackend.SetSpeedConversionFactor(
+            1 / (s_xportBenchmarkMock.opticalZoomFactor * s_xportBenchmarkMock.digitalZoomFactor));
+        osalHandler->TaskSleepMs(XPORT_BENCHMARK_TICK_MS);
+    }
+    pollingRoundTripCount = s_xportBenchmarkMock.roundTripCount;
+
+    // Cached: the same activity through the zoom notifications and the system state updates.
+    memset(&s_xportBenchmarkMock, 0, sizeof(s_xportBenchmarkMock));
+    returnCode = DjiTest_XPortStateStart(&s_xportMockBackend);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        return returnCode;
+    }
+    DjiTest_CameraRegZoomChangeCallback(NULL);
+    DjiTest_XPortStateRefreshLimitAngles();
+    DjiTest_XPortStateUpdateSystemState(&systemState);
+
+    for (tick = 1; tick <= tickCount; tick++) {
+        DjiTest_XPortBenchmarkZoomStep(tick);
+        DjiTest_XPortStateZoomChangeCallback(s_xportBenchmarkMock.opticalZoomFactor,
+                                             s_xportBenchmarkMock.digitalZoomFactor);
+        if (tick % XPORT_BENCHMARK_SYSTEM_STATE_PERIOD_TICKS == 0) {
+            systemState.mountedUpward = !systemState.mountedUpward;
+            DjiTest_XPortStateUpdateSystemState(&systemState);
+        }
+        for (category = 0; category < DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM; category++) {
+            DjiTest_XPortStateGetLimitAngle((E_DjiXPortLimitAngleCategory) category, &limitAngle);
+        }
+        osalHandler->TaskSleepMs(XPORT_BENCHMARK_TICK_MS);
+    }
+
+    DjiTest_XPortStateGetStatistics(&statistics);
+    DjiTest_XPortStateStop();
+
+    USER_LOG_INFO("XPort round trips in %u ms: polling %u, cached %u (%u limit angle reads, %u speed conversion "
+                  "factor sets for %u zoom changes, %u limit angle changes).", durationMs, pollingRoundTripCount,
+                  s_xportBenchmarkMock.roundTripCount, statistics.getLimitAngleCount,
+                  statistics.setSpeedConversionFactorCount, statistics.zoomChangeCount,
+                  statistics.limitAngleChangeCount);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void DjiTest_XPortStateZoomChangeCallback(dji_f32_t opticalZoomFactor, dji_f32_t digitalZoomFactor)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    float factor;
+
+    if (s_isXPortStateRunning == false || opticalZoomFactor <= 0 || digitalZoomFactor <= 0) {
+        return;
+    }
+
+    factor = 1 / (opticalZoomFactor * digitalZoomFactor);
+
+    // Only the newest factor is applied, the notifications in between do not reach the link.
+    osalHandler->MutexLock(s_xportStateMutex);
+    if (s_isXPortStateRunning == false) {
+        osalHandler->MutexUnlock(s_xportStateMutex);
+        return;
+    }
+    s_xportState.statistics.zoomChangeCount++;
+    s_xportState.pendingSpeedConversionFactor = factor;
+    s_xportState.isSpeedConversionFactorPending = true;
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    osalHandler->SemaphorePost(s_xportStateSema);
+}
+
+static void DjiTest_XPortStateApplySpeedConversionFactor(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+    float factor;
+    bool isPending;
+
+    osalHandler->MutexLock(s_xportStateMutex);
+    isPending = s_xportState.isSpeedConversionFactorPending &&
+                s_xportState.pendingSpeedConversionFactor != s_xportState.appliedSpeedConversionFactor;
+    factor = s_xportState.pendingSpeedConversionFactor;
+    s_xportState.isSpeedConversionFactorPending = false;
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    if (isPending == false) {
+        return;
+    }
+
+    returnCode = s_xportState.backend.SetSpeedConversionFactor(factor);
+
+    osalHandler->MutexLock(s_xportStateMutex);
+    s_xportState.statistics.setSpeedConversionFactorCount++;
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_xportState.appliedSpeedConversionFactor = factor;
+    }
+    osalHandler->MutexUnlock(s_xportStateMutex);
+
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("set speed conversion factor error: 0x%08llX.", returnCode);
+    }
+}
+
+static void DjiTest_XPortStateFetchLimitAngles(uint8_t categoryMask)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    DjiTestXPortLimitAngleChangeCallback callback;
+    T_DjiXPortLimitAngle limitAngle = {0};
+    T_DjiReturnCode returnCode;
+    bool isChanged;
+    uint8_t category;
+
+    for (category = 0; category < DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM; category++) {
+        if ((categoryMask & (1 << category)) == 0) {
+            continue;
+        }
+
+        returnCode = s_xportState.backend.GetLimitAngleSync((E_DjiXPortLimitAngleCategory) category, &limitAngle);
+
+        osalHandler->MutexLock(s_xportStateMutex);
+        s_xportState.statistics.getLimitAngleCount++;
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            osalHandler->MutexUnlock(s_xportStateMutex);
+            USER_LOG_ERROR("get limit angle %d from XPort error: 0x%08llX.", category, returnCode);
+            continue;
+        }
+        isChanged = (s_xportState.validLimitAngleMask & (1 << category)) == 0 ||
+                    s_xportState.limitAngles[category].upperLimit != limitAngle.upperLimit ||
+                    s_xportState.limitAngles[category].lowerLimit != limitAngle.lowerLimit;
+        s_xportState.limitAngles[category] = limitAngle;
+        s_xportState.validLimitAngleMask |= (1 << category);
+        if (isChanged) {
+            s_xportState.statistics.limitAngleChangeCount++;
+        }
+        callback = s_xportState.limitAngleChangeCallback;
+        osalHandler->MutexUnlock(s_xportStateMutex);
+
+        if (isChanged && callback != NULL) {
+            callback((E_DjiXPortLimitAngleCategory) category, limitAngle);
+        }
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-noreturn"
+#pragma GCC diagnostic ignored "-Wreturn-type"
+#endif
+
+static void *DjiTest_XPortStateTask(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint8_t staleLimitAngleMask;
+
+    USER_UTIL_UNUSED(arg);
+
+    while (1) {
+        osalHandler->SemaphoreWait(s_xportStateSema);
+        if (s_isXPortStateStopping) {
+            break;
+        }
+
+        // The speed conversion factor first, it changes what the pilot feels while zooming.
+        DjiTest_XPortStateApplySpeedConversionFactor();
+
+        osalHandler->MutexLock(s_xportStateMutex);
+        staleLimitAngleMask = s_xportState.staleLimitAngleMask;
+        s_xportState.staleLimitAngleMask = 0;
+        osalHandler->MutexUnlock(s_xportStateMutex);
+        if (staleLimitAngleMask != 0) {
+            DjiTest_XPortStateFetchLimitAngles(staleLimitAngleMask);
+        }
+    }
+
+    osalHandler->SemaphorePost(s_xportStateStopSema);
+    while (1) {
+        osalHandler->TaskSleepMs(1000);
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
+static T_DjiReturnCode DjiTest_XPortMockSetLimitAngleSync(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                          T_DjiXPortLimitAngle limitAngle)
+{
+    USER_UTIL_UNUSED(limitAngleCategory);
+    USER_UTIL_UNUSED(limitAngle);
+
+    s_xportBenchmarkMock.roundTripCount++;
+    DjiPlatform_GetOsalHandler()->TaskSleepMs(XPORT_BENCHMARK_ROUND_TRIP_MS);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* The mock reports limits that depend on the mounting, so that the mounting changes really change them. */
+static T_DjiReturnCode DjiTest_XPortMockGetLimitAngleSync(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                          T_DjiXPortLimitAngle *limitAngle)
+{
+    bool mountedUpward = s_xportState.systemState.mountedUpward;
+
+    s_xportBenchmarkMock.roundTripCount++;
+    DjiPlatform_GetOsalHandler()->TaskSleepMs(XPORT_BENCHMARK_ROUND_TRIP_MS);
+
+    limitAngle->upperLimit = (int16_t) (mountedUpward ? 1000 : 300) + limitAngleCategory;
+    limitAngle->lowerLimit = (int16_t) (mountedUpward ? -300 : -1000) - limitAngleCategory;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode DjiTest_XPortMockSetSpeedConversionFactor(float factor)
+{
+    USER_UTIL_UNUSED(factor);
+
+    s_xportBenchmarkMock.roundTripCount++;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Zooms in for a second then back out to 1x, as the continuous zoom of the camera emulation does at 10Hz. */
+static void DjiTest_XPortBenchmarkZoomStep(uint32_t tick)
+{
+    uint32_t phase = tick % XPORT_BENCHMARK_ZOOM_PERIOD_TICKS;
+
+    if (phase > 0 && phase <= XPORT_BENCHMARK_ZOOM_DURATION_TICKS) {
+        s_xportBenchmarkMock.opticalZoomFactor = 1.0f + (float) phase * 0.5f;
+    } else {
+        s_xportBenchmarkMock.opticalZoomFactor = 1.0f;
+    }
+    s_xportBenchmarkMock.digitalZoomFactor = 1.0f;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,85 @@
+/**
+ ********************************************************************
+ * @file    test_payload_xport_state.h
+ * @brief   This is the header file for "test_payload_xport_state.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_PAYLOAD_XPORT_STATE_H
+#define TEST_PAYLOAD_XPORT_STATE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "dji_xport.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM    (DJI_XPORT_LIMIT_ANGLE_CATEGORY_YAW_JOINT_ANGLE + 1)
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief XPort calls going over the link, the DjiXPort interfaces by default, replaced by a mock in the benchmark.
+ */
+typedef struct {
+    T_DjiReturnCode (*SetLimitAngleSync)(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                         T_DjiXPortLimitAngle limitAngle);
+    T_DjiReturnCode (*GetLimitAngleSync)(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                         T_DjiXPortLimitAngle *limitAngle);
+    T_DjiReturnCode (*SetSpeedConversionFactor)(float factor);
+} T_DjiTestXPortBackend;
+
+/**
+ * @brief Prototype of callback function notified when a refreshed limit angle differs from the cached one.
+ */
+typedef void (*DjiTestXPortLimitAngleChangeCallback)(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                     T_DjiXPortLimitAngle limitAngle);
+
+typedef struct {
+    uint32_t getLimitAngleCount;
+    uint32_t setLimitAngleCount;
+    uint32_t setSpeedConversionFactorCount;
+    uint32_t zoomChangeCount;
+    uint32_t limitAngleChangeCount;
+} T_DjiTestXPortStateStatistics;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode DjiTest_XPortStateStart(const T_DjiTestXPortBackend *backend);
+T_DjiReturnCode DjiTest_XPortStateStop(void);
+T_DjiReturnCode DjiTest_XPortStateGetLimitAngle(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                T_DjiXPortLimitAngle *limitAngle);
+T_DjiReturnCode DjiTest_XPortStateSetLimitAngle(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                T_DjiXPortLimitAngle limitAngle);
+T_DjiReturnCode DjiTest_XPortStateRefreshLimitAngles(void);
+T_DjiReturnCode DjiTest_XPortStateRegLimitAngleChangeCallback(DjiTestXPortLimitAngleChangeCallback callback);
+void DjiTest_XPortStateUpdateSystemState(const T_DjiGimbalSystemState *systemState);
+T_DjiReturnCode DjiTest_XPortStateGetStatistics(T_DjiTestXPortStateStatistics *statistics);
+T_DjiReturnCode DjiTest_XPortRunRoundTripBenchmark(uint32_t durationMs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_PAYLOAD_XPORT_STATE_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -25,13 +25,14 @@
 /* Includes ------------------------------------------------------------------*/
 #include "osal.h"
 #include "dji_typedef.h"
+#include <time.h>
+#include <errno.h>
 
 /* Private constants ---------------------------------------------------------*/
 
 /* Private types -------------------------------------------------------------*/
 
 /* Private values -------------------------------------------------------------*/
-static uint32_t s_localTimeMsOffset = 0;
 static uint64_t s_localTimeUsOffset = 0;
 
 /* Private functions declaration ---------------------------------------------*/
@@ -295,35 +296,65 @@ T_DjiReturnCode Osal_SemaphorePost(T_DjiSemaHandle semaphore)
 
 /**
  * @brief Get the system time for ms.
+ * @note Derived from Osal_GetTimeUs, so both count from the same origin on the monotonic clock and can be compared.
  * @return an uint32 that the time of system, uint:ms
  */
 T_DjiReturnCode Osal_GetTimeMs(uint32_t *ms)
 {
-    struct timeval time;
+    uint64_t us;
 
-    gettimeofday(&time, NULL);
-    *ms = (time.tv_sec * 1000 + time.tv_usec / 1000);
-
-    if (s_localTimeMsOffset == 0) {
-        s_localTimeMsOffset = *ms;
-    } else {
-        *ms = *ms - s_localTimeMsOffset;
-    }
+    Osal_GetTimeUs(&us);
+    *ms = (uint32_t) (us / 1000);
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
+/**
+ * @brief Get the system time for us.
+ * @note Based on the monotonic clock, so that periodic tasks scheduled against absolute deadlines are not disturbed by
+ * adjustments of the wall clock.
+ */
 T_DjiReturnCode Osal_GetTimeUs(uint64_t *us)
 {
-    struct timeval time;
+    struct timespec time;
 
-    gettimeofday(&time, NULL);
-    *us = (time.tv_sec * 1000000 + time.tv_usec);
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    *us = ((uint64_t) time.tv_sec * 1000000 + (uint64_t) time.tv_nsec / 1000);
 
     if (s_localTimeUsOffset == 0) {
         s_localTimeUsOffset = *us;
-    } else {
-        *us = *us - s_localTimeMsOffset;
+    }
+    *us = *us - s_localTimeUsOffset;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/**
+ * @brief Sleep until a deadline on the clock of Osal_GetTimeUs, with the microsecond resolution of the scheduler.
+ * @note The deadline is absolute, so the time a periodic task spends in its cycle does not shift the next one.
+ * @param deadlineUs: deadline, as returned by Osal_GetTimeUs.
+ * @return Execution result.
+ */
+T_DjiReturnCode Osal_TaskSleepUntilUs(uint64_t deadlineUs)
+{
+    struct timespec deadline;
+    uint64_t monotonicUs;
+    int ret;
+
+    if (s_localTimeUsOffset == 0) {
+        Osal_GetTimeUs(&monotonicUs);
+    }
+
+    monotonicUs = deadlineUs + s_localTimeUsOffset;
+    deadline.tv_sec = (time_t) (monotonicUs / 1000000);
+    deadline.tv_nsec = (long) (monotonicUs % 1000000) * 1000;
+
+    do {
+        ret = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+    } while (ret == EINTR);
+
+    if (ret != 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
     }
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
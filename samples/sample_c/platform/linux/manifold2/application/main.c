@@ -27,6 +27,8 @@
 #include <dji_logger.h>
 #include <dji_core.h>
 #include <utils/util_misc.h>
+#include <utils/util_periodic.h>
+#include <utils/util_asset.h>
 #include <errno.h>
 #include <signal.h>
 #include <power_management/test_power_management.h>
@@ -47,12 +49,14 @@
 #include "../hal/hal_uart.h"
 #include "../hal/hal_network.h"
 #include "../hal/hal_usb_bulk.h"
+#include "../hal/hal_pps.h"
 #include "dji_sdk_app_info.h"
 #include "dji_aircraft_info.h"
 #include "widget/test_widget.h"
 #include "widget/test_widget_speaker.h"
 #include "widget_interaction_test/test_widget_interaction.h"
 #include "data_transmission/test_data_transmission.h"
+#include "time_sync/test_time_sync.h"
 #include "dji_sdk_config.h"
 
 /* Private constants ---------------------------------------------------------*/
@@ -337,6 +341,20 @@ int main(int argc, char **argv)
 #endif
     }
 
+#ifdef CONFIG_MODULE_SAMPLE_TIME_SYNC_ON
+    T_DjiTestTimeSyncHandler testTimeSyncHandler = {
+        .PpsSignalResponseInit = HalPps_SignalResponseInit,
+        .GetNewestPpsTriggerLocalTimeUs = HalPps_GetNewestPpsTriggerLocalTimeUs,
+    };
+
+    returnCode = DjiTest_TimeSyncRegHandler(&testTimeSyncHandler);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("regsiter time sync handler error");
+    } else if (DjiTest_TimeSyncStartService() != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("psdk time sync init error");
+    }
+#endif
+
 #ifdef CONFIG_MODULE_SAMPLE_HMS_CUSTOMIZATION_ON
     returnCode = DjiTest_HmsCustomizationStartService();
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
@@ -367,6 +385,10 @@ int main(int argc, char **argv)
 static T_DjiReturnCode DjiUser_PrepareSystemEnvironment(void)
 {
     T_DjiReturnCode returnCode;
+    T_UtilPeriodicClock periodicClock = {
+        .GetTimeUs = Osal_GetTimeUs,
+        .SleepUntilUs = Osal_TaskSleepUntilUs,
+    };
     T_DjiOsalHandler osalHandler = {
         .TaskCreate = Osal_TaskCreate,
         .TaskDestroy = Osal_TaskDestroy,
@@ -456,6 +478,19 @@ static T_DjiReturnCode DjiUser_PrepareSystemEnvironment(void)
         return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
     }
 
+    // Periodic tasks sleep until microsecond deadlines, finer than the task sleep of the osal handler.
+    returnCode = UtilPeriodic_SetDefaultClock(&periodicClock);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        printf("set periodic clock error");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    returnCode = UtilAsset_Init();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        printf("init asset error");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
     returnCode = DjiPlatform_RegHalUartHandler(&uartHandler);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         printf("register hal uart handler error");
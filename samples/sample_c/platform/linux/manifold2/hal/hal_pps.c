@@ -0,0 +1,440 @@
+/**
+ ********************************************************************
+ * @file    hal_pps.c
+ * @brief   PPS signal of the time synchronization on Linux, read from a kernel pps device, a gpio line or a file.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <poll.h>
+#include <time.h>
+#include <sys/ioctl.h>
+#include <linux/pps.h>
+#include <linux/gpio.h>
+#include "hal_pps.h"
+#include "dji_logger.h"
+#include "dji_platform.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define HAL_PPS_TASK_STACK_SIZE                 (2048)
+#define HAL_PPS_WAIT_TIMEOUT_MS                 (2000)
+#define HAL_PPS_STATISTICS_LOG_PULSE_COUNT      (60)
+#define HAL_PPS_SIMULATION_EDGE_NUM_MAX         (1000000)
+#define HAL_PPS_GPIO_CONSUMER                   "dji_pps"
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static E_HalPpsSource s_ppsSource = HAL_PPS_SOURCE_NONE;
+static int s_ppsFd = -1;
+static uint32_t s_ppsLastSequence = 0;
+static uint64_t *s_ppsSimulationEdges = NULL;
+static uint32_t s_ppsSimulationEdgeCount = 0;
+static uint32_t s_ppsSimulationEdgeIndex = 0;
+static uint64_t s_ppsSimulationStartTimeUs = 0;
+static T_DjiTestTimeSyncFilter s_ppsFilter;
+static T_DjiMutexHandle s_ppsMutex = NULL;
+static T_DjiTaskHandle s_ppsThread = NULL;
+
+static const char *s_ppsSourceName[] = {"none", "kernel pps", "gpio", "simulation"};
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode HalPps_OpenKernelPps(void);
+static T_DjiReturnCode HalPps_OpenGpio(void);
+static T_DjiReturnCode HalPps_LoadSimulation(const char *path);
+static T_DjiReturnCode HalPps_WaitEdge(uint64_t *edgeLocalTimeUs);
+static T_DjiReturnCode HalPps_ClockToLocalTimeUs(clockid_t clockId, uint64_t clockTimeUs, uint64_t *localTimeUs);
+static void *HalPps_Task(void *arg);
+
+/* Exported functions definition ---------------------------------------------*/
+T_DjiReturnCode HalPps_SignalResponseInit(void)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+    const char *simulationFile;
+
+    if (s_ppsSource != HAL_PPS_SOURCE_NONE) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    simulationFile = getenv(LINUX_PPS_SIMULATION_FILE_ENV);
+    if (simulationFile != NULL && simulationFile[0] != '\0') {
+        returnCode = HalPps_LoadSimulation(simulationFile);
+        if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            return returnCode;
+        }
+        s_ppsSource = HAL_PPS_SOURCE_SIMULATION;
+    } else if (HalPps_OpenKernelPps() == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_ppsSource = HAL_PPS_SOURCE_KERNEL_PPS;
+    } else if (HalPps_OpenGpio() == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        s_ppsSource = HAL_PPS_SOURCE_GPIO;
+    } else {
+        USER_LOG_ERROR("No pps source, neither %s nor line %d of %s can be opened.", LINUX_PPS_DEV,
+                       LINUX_PPS_GPIO_LINE, LINUX_PPS_GPIO_CHIP_DEV);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    DjiTest_TimeSyncFilterInit(&s_ppsFilter, NULL);
+
+    returnCode = osalHandler->MutexCreate(&s_ppsMutex);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create pps mutex error: 0x%08llX.", returnCode);
+        goto close;
+    }
+
+    returnCode = osalHandler->TaskCreate("user_pps_task", HalPps_Task, HAL_PPS_TASK_STACK_SIZE, NULL, &s_ppsThread);
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        USER_LOG_ERROR("Create pps task error: 0x%08llX.", returnCode);
+        osalHandler->MutexDestroy(s_ppsMutex);
+        goto close;
+    }
+
+    USER_LOG_INFO("Pps signal read from %s.", s_ppsSourceName[s_ppsSource]);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+close:
+    if (s_ppsFd >= 0) {
+        close(s_ppsFd);
+        s_ppsFd = -1;
+    }
+    free(s_ppsSimulationEdges);
+    s_ppsSimulationEdges = NULL;
+    s_ppsSource = HAL_PPS_SOURCE_NONE;
+
+    return returnCode;
+}
+
+T_DjiReturnCode HalPps_GetNewestPpsTriggerLocalTimeUs(uint64_t *localTimeUs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiReturnCode returnCode;
+    uint64_t currentTimeUs;
+
+    if (localTimeUs == NULL) {
+        USER_LOG_ERROR("input pointer is null.");
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    if (s_ppsSource == HAL_PPS_SOURCE_NONE) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE;
+    }
+
+    osalHandler->GetTimeUs(&currentTimeUs);
+
+    osalHandler->MutexLock(s_ppsMutex);
+    returnCode = DjiTest_TimeSyncFilterGetNewestEdge(&s_ppsFilter, currentTimeUs, localTimeUs);
+    osalHandler->MutexUnlock(s_ppsMutex);
+
+    if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY) {
+        USER_LOG_WARN("pps have not been triggered.");
+    } else if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT) {
+        USER_LOG_WARN("pps lost.");
+    }
+
+    return returnCode;
+}
+
+T_DjiReturnCode HalPps_GetStatistics(E_HalPpsSource *source, T_DjiTestTimeSyncFilterStatistics *statistics)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    if (source == NULL || statistics == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    *source = s_ppsSource;
+    if (s_ppsSource == HAL_PPS_SOURCE_NONE) {
+        memset(statistics, 0, sizeof(T_DjiTestTimeSyncFilterStatistics));
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    osalHandler->MutexLock(s_ppsMutex);
+    DjiTest_TimeSyncFilterGetStatistics(&s_ppsFilter, statistics);
+    osalHandler->MutexUnlock(s_ppsMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode HalPps_OpenKernelPps(void)
+{
+    struct pps_kparams params;
+    int mode;
+
+    s_ppsFd = open(LINUX_PPS_DEV, O_RDWR);
+    if (s_ppsFd < 0) {
+        s_ppsFd = open(LINUX_PPS_DEV, O_RDONLY);
+    }
+    if (s_ppsFd < 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    if (ioctl(s_ppsFd, PPS_GETCAP, &mode) != 0 || (mode & PPS_CAPTUREASSERT) == 0) {
+        USER_LOG_ERROR("%s can not capture the assert edge.", LINUX_PPS_DEV);
+        close(s_ppsFd);
+        s_ppsFd = -1;
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+    }
+
+    /* usually already the default mode, setting it needs write access to the device */
+    if (ioctl(s_ppsFd, PPS_GETPARAMS, &params) == 0 && (params.mode & PPS_CAPTUREASSERT) == 0) {
+        params.mode |= PPS_CAPTUREASSERT;
+        if (ioctl(s_ppsFd, PPS_SETPARAMS, &params) != 0) {
+            USER_LOG_WARN("Enable the assert capture of %s error: %s.", LINUX_PPS_DEV, strerror(errno));
+        }
+    }
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode HalPps_OpenGpio(void)
+{
+#ifdef GPIO_V2_GET_LINE_IOCTL
+    struct gpio_v2_line_request request;
+    int chipFd;
+
+    chipFd = open(LINUX_PPS_GPIO_CHIP_DEV, O_RDONLY);
+    if (chipFd < 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    /* edge events are time stamped by the kernel with CLOCK_MONOTONIC, the clock of Osal_GetTimeUs */
+    memset(&request, 0, sizeof(request));
+    request.offsets[0] = LINUX_PPS_GPIO_LINE;
+    request.num_lines = 1;
+    strncpy(request.consumer, HAL_PPS_GPIO_CONSUMER, sizeof(request.consumer) - 1);
+    request.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING;
+
+    if (ioctl(chipFd, GPIO_V2_GET_LINE_IOCTL, &request) != 0) {
+        USER_LOG_ERROR("Request line %d of %s error: %s.", LINUX_PPS_GPIO_LINE, LINUX_PPS_GPIO_CHIP_DEV,
+                       strerror(errno));
+        close(chipFd);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    }
+
+    close(chipFd);
+    s_ppsFd = request.fd;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+#else
+    return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+#endif
+}
+
+static T_DjiReturnCode HalPps_LoadSimulation(const char *path)
+{
+    char line[64];
+    uint64_t *edges;
+    uint64_t edgeUs;
+    uint32_t capacity = 0;
+    char *end;
+    FILE *file;
+
+    file = fopen(path, "r");
+    if (file == NULL) {
+        USER_LOG_ERROR("Open pps simulation file %s error.", path);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    s_ppsSimulationEdgeCount = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') {
+            continue;
+        }
+
+        edgeUs = strtoull(line, &end, 10);
+        if (end == line || (s_ppsSimulationEdgeCount > 0 &&
+                            edgeUs <= s_ppsSimulationEdges[s_ppsSimulationEdgeCount - 1])) {
+            USER_LOG_ERROR("Invalid pps simulation edge '%s', edges have to increase.", line);
+            goto error;
+        }
+
+        if (s_ppsSimulationEdgeCount == capacity) {
+            if (capacity >= HAL_PPS_SIMULATION_EDGE_NUM_MAX) {
+                USER_LOG_ERROR("Too many pps simulation edges, at most %d.", HAL_PPS_SIMULATION_EDGE_NUM_MAX);
+                goto error;
+            }
+            capacity = capacity > 0 ? capacity * 2 : 1024;
+            edges = realloc(s_ppsSimulationEdges, capacity * sizeof(uint64_t));
+            if (edges == NULL) {
+                goto error;
+            }
+            s_ppsSimulationEdges = edges;
+        }
+        s_ppsSimulationEdges[s_ppsSimulationEdgeCount++] = edgeUs;
+    }
+
+    fclose(file);
+
+    if (s_ppsSimulationEdgeCount == 0) {
+        USER_LOG_ERROR("No edge in pps simulation file %s.", path);
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    s_ppsSimulationEdgeIndex = 0;
+    USER_LOG_INFO("Loaded %d pps simulation edges from %s.", s_ppsSimulationEdgeCount, path);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+error:
+    fclose(file);
+    free(s_ppsSimulationEdges);
+    s_ppsSimulationEdges = NULL;
+    s_ppsSimulationEdgeCount = 0;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+}
+
+static T_DjiReturnCode HalPps_WaitEdge(uint64_t *edgeLocalTimeUs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    struct pps_fdata fetchData;
+    uint64_t currentTimeUs;
+    uint64_t edgeUs;
+
+    switch (s_ppsSource) {
+        case HAL_PPS_SOURCE_KERNEL_PPS:
+            memset(&fetchData, 0, sizeof(fetchData));
+            fetchData.timeout.sec = HAL_PPS_WAIT_TIMEOUT_MS / 1000;
+            fetchData.timeout.flags = ~PPS_TIME_INVALID;
+            if (ioctl(s_ppsFd, PPS_FETCH, &fetchData) != 0) {
+                return errno == ETIMEDOUT ? DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT :
+                       DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            }
+            if (fetchData.info.assert_sequence == s_ppsLastSequence) {
+                return DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT;
+            }
+            s_ppsLastSequence = fetchData.info.assert_sequence;
+
+            /* the kernel pps time stamps are in CLOCK_REALTIME */
+            edgeUs = (uint64_t) fetchData.info.assert_tu.sec * 1000000 + fetchData.info.assert_tu.nsec / 1000;
+            return HalPps_ClockToLocalTimeUs(CLOCK_REALTIME, edgeUs, edgeLocalTimeUs);
+
+#ifdef GPIO_V2_GET_LINE_IOCTL
+        case HAL_PPS_SOURCE_GPIO: {
+            struct gpio_v2_line_event event;
+            struct pollfd pollFd = {.fd = s_ppsFd, .events = POLLIN};
+            int ret;
+
+            ret = poll(&pollFd, 1, HAL_PPS_WAIT_TIMEOUT_MS);
+            if (ret == 0) {
+                return DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT;
+            }
+            if (ret < 0 || read(s_ppsFd, &event, sizeof(event)) != sizeof(event)) {
+                return DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+            }
+
+            return HalPps_ClockToLocalTimeUs(CLOCK_MONOTONIC, event.timestamp_ns / 1000, edgeLocalTimeUs);
+        }
+#endif
+
+        case HAL_PPS_SOURCE_SIMULATION:
+            if (s_ppsSimulationEdgeIndex >= s_ppsSimulationEdgeCount) {
+                return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+            }
+
+            edgeUs = s_ppsSimulationStartTimeUs + s_ppsSimulationEdges[s_ppsSimulationEdgeIndex++];
+            osalHandler->GetTimeUs(&currentTimeUs);
+            if (edgeUs > currentTimeUs) {
+                usleep((useconds_t) (edgeUs - currentTimeUs));
+            }
+
+            *edgeLocalTimeUs = edgeUs;
+            return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+        default:
+            return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+    }
+}
+
+/* the local time is CLOCK_MONOTONIC shifted by osal, so go through the current time of both clocks */
+static T_DjiReturnCode HalPps_ClockToLocalTimeUs(clockid_t clockId, uint64_t clockTimeUs, uint64_t *localTimeUs)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    struct timespec currentClockTime;
+    uint64_t currentClockTimeUs;
+    uint64_t currentLocalTimeUs;
+
+    osalHandler->GetTimeUs(&currentLocalTimeUs);
+    clock_gettime(clockId, &currentClockTime);
+    currentClockTimeUs = (uint64_t) currentClockTime.tv_sec * 1000000 + (uint64_t) currentClockTime.tv_nsec / 1000;
+
+    if (clockTimeUs > currentClockTimeUs || currentClockTimeUs - clockTimeUs > currentLocalTimeUs) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE;
+    }
+
+    *localTimeUs = currentLocalTimeUs - (currentClockTimeUs - clockTimeUs);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void *HalPps_Task(void *arg)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestTimeSyncFilterStatistics statistics = {0};
+    T_DjiReturnCode returnCode;
+    uint64_t edgeLocalTimeUs;
+    bool accepted;
+
+    (void) arg;
+
+    osalHandler->GetTimeUs(&s_ppsSimulationStartTimeUs);
+
+    while (1) {
+        returnCode = HalPps_WaitEdge(&edgeLocalTimeUs);
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT) {
+            continue;
+        } else if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND) {
+            break;
+        } else if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            USER_LOG_ERROR("Read pps edge error: 0x%08llX.", returnCode);
+            osalHandler->TaskSleepMs(HAL_PPS_WAIT_TIMEOUT_MS);
+            continue;
+        }
+
+        osalHandler->MutexLock(s_ppsMutex);
+        accepted = DjiTest_TimeSyncFilterUpdate(&s_ppsFilter, edgeLocalTimeUs);
+        DjiTest_TimeSyncFilterGetStatistics(&s_ppsFilter, &statistics);
+        osalHandler->MutexUnlock(s_ppsMutex);
+
+        if (!accepted) {
+            USER_LOG_DEBUG("Pps edge at %llu us dropped.", (unsigned long long) edgeLocalTimeUs);
+        } else if (statistics.acceptedCount % HAL_PPS_STATISTICS_LOG_PULSE_COUNT == 0) {
+            USER_LOG_INFO("Pps drift %.2f ppm, residual rms %.1f us, accepted %d, rejected %d, missed %d, reset %d.",
+                          statistics.driftPpm, statistics.residualRmsUs, statistics.acceptedCount,
+                          statistics.rejectedCount, statistics.missedCount, statistics.resetCount);
+        }
+    }
+
+    USER_LOG_INFO("Pps simulation done, drift %.2f ppm, residual rms %.1f us, accepted %d, rejected %d, missed %d.",
+                  statistics.driftPpm, statistics.residualRmsUs, statistics.acceptedCount,
+                  statistics.rejectedCount, statistics.missedCount);
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,71 @@
+/**
+ ********************************************************************
+ * @file    hal_pps.h
+ * @brief   This is the header file for "hal_pps.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef HAL_PPS_H
+#define HAL_PPS_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "dji_typedef.h"
+#include "time_sync/test_time_sync_filter.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+//User can config dev based on there environmental conditions
+/* kernel pps device (RFC 2783), e.g. registered by the pps-gpio overlay of the pin wired to the pps output */
+#define LINUX_PPS_DEV                   "/dev/pps0"
+/* fallback when no kernel pps device exists: rising edges of a gpio line read through the gpio character device */
+#define LINUX_PPS_GPIO_CHIP_DEV         "/dev/gpiochip0"
+#define LINUX_PPS_GPIO_LINE             (18)
+/*
+ * When this environment variable names a file, the pulses are replayed from the file instead of read from the
+ * hardware. The file lists the local time of each edge in microseconds since the start of the replay, one per line,
+ * lines starting with '#' are ignored. 10 minutes of pps from a clock 25 ppm fast with 100 us of jitter:
+ *   awk 'BEGIN{srand(1); for(i=1;i<=600;i++) printf "%d\n", i*1000025+(rand()-0.5)*100}' > pps.txt
+ */
+#define LINUX_PPS_SIMULATION_FILE_ENV   "DJI_PPS_SIMULATION_FILE"
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    HAL_PPS_SOURCE_NONE = 0,
+    HAL_PPS_SOURCE_KERNEL_PPS,
+    HAL_PPS_SOURCE_GPIO,
+    HAL_PPS_SOURCE_SIMULATION,
+} E_HalPpsSource;
+
+/* Exported functions --------------------------------------------------------*/
+T_DjiReturnCode HalPps_SignalResponseInit(void);
+T_DjiReturnCode HalPps_GetNewestPpsTriggerLocalTimeUs(uint64_t *localTimeUs);
+T_DjiReturnCode HalPps_GetStatistics(E_HalPpsSource *source, T_DjiTestTimeSyncFilterStatistics *statistics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HAL_PPS_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
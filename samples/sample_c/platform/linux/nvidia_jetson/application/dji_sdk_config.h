@@ -66,6 +66,11 @@ extern "C" {
 
 #define CONFIG_MODULE_SAMPLE_FC_SUBSCRIPTION_ON
 
+/*!< Attention: This function needs the pps output of the aircraft wired to a kernel pps device or a gpio, see
+ * hal/hal_pps.h. Without the hardware the pulses can be replayed from a file for testing.
+* */
+//#define CONFIG_MODULE_SAMPLE_TIME_SYNC_ON
+
 /*!< Attention: This function needs to be used together with mobile sdk mop sample.
 * */
 //#define CONFIG_MODULE_SAMPLE_MOP_CHANNEL_ON
@@ -25,18 +25,67 @@
 /* Includes ------------------------------------------------------------------*/
 #include "limits.h"
 #include "osal.h"
+#include "osal_clock.h"
+#include "osal_pool.h"
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
 #include "stdlib.h"
+#include "string.h"
 
 /* Private constants ---------------------------------------------------------*/
 #define SEM_MUTEX_WAIT_FOREVER      0xFFFFFFFF
 #define TASK_PRIORITY_NORMAL        0
 
+/* ARMv7-M debug registers, the DWT cycle counter runs at the core clock */
+#define OSAL_DEMCR                  (*(volatile uint32_t *) 0xE000EDFCU)
+#define OSAL_DEMCR_TRCENA           (1U << 24)
+#define OSAL_DWT_CTRL               (*(volatile uint32_t *) 0xE0001000U)
+#define OSAL_DWT_CTRL_CYCCNTENA     (1U << 0)
+#define OSAL_DWT_CTRL_NOCYCCNT      (1U << 25)
+#define OSAL_DWT_CYCCNT             (*(volatile uint32_t *) 0xE0001004U)
+
+/* Small allocations are served by fixed-block classes carved out of the FreeRTOS heap at the first allocation, so
+ * the long lived mixed size allocations of the PSDK do not fragment heap_4. Block sizes include the 8 bytes header
+ * every allocation carries, classes must be sorted by block size. Override both macros from the build to tune.
+ * The default layout takes 12800 bytes of the FreeRTOS heap, out of the 90000 bytes configTOTAL_HEAP_SIZE of the
+ * STM32F4 sample; if they can not be allocated or the layout is invalid, every allocation goes to the heap. */
+#ifndef OSAL_MEMORY_POOL_ENABLE
+#define OSAL_MEMORY_POOL_ENABLE     1
+#endif
+#ifndef OSAL_MEMORY_POOL_LAYOUT
+#define OSAL_MEMORY_POOL_LAYOUT     {{32, 48}, {64, 48}, {128, 24}, {256, 12}, {512, 4}}
+#endif
+
+#define OSAL_HEAP_TASK_NUM_MAX      24
+#define OSAL_HEAP_BLOCK_MAGIC       0xA55A
+#define OSAL_HEAP_OWNER_OTHER       0
+
 /* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t size;
+    uint16_t owner;
+    uint16_t magic;
+} T_OsalHeapBlockHeader;
+
+/* Private values -------------------------------------------------------------*/
+static T_OsalClock s_osalClock;
+static volatile uint8_t s_osalClockState = 0; /* 0: not initialized, 1: cycle counter, 2: no cycle counter */
+
+#if OSAL_MEMORY_POOL_ENABLE
+static const T_OsalPoolClassConfig s_osalPoolConfig[] = OSAL_MEMORY_POOL_LAYOUT;
+static T_OsalPoolClass s_osalPoolClasses[sizeof(s_osalPoolConfig) / sizeof(s_osalPoolConfig[0])];
+static T_OsalPool s_osalPool;
+static bool s_osalPoolInited = false;
+#endif
+/* entry 0 collects allocations made outside of a task or once the table is full */
+static T_OsalHeapTaskStatistics s_osalHeapTaskStatistics[OSAL_HEAP_TASK_NUM_MAX] = {{"other"}};
+static TaskHandle_t s_osalHeapTaskHandles[OSAL_HEAP_TASK_NUM_MAX];
+static uint8_t s_osalHeapTaskCount = 1;
 
 /* Private functions declaration ---------------------------------------------*/
+static uint16_t Osal_HeapGetOwner(void);
+static void Osal_HeapReleaseOwner(TaskHandle_t task);
 
 /* Exported functions definition ---------------------------------------------*/
 
@@ -69,6 +118,10 @@ T_DjiReturnCode Osal_TaskDestroy(T_DjiTaskHandle task)
         return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
     }
 
+    vTaskSuspendAll();
+    Osal_HeapReleaseOwner((TaskHandle_t) task);
+    (void) xTaskResumeAll();
+
     vTaskDelete(task);
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
@@ -219,18 +272,41 @@ T_DjiReturnCode Osal_GetTimeMs(uint32_t *ms)
         return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
     }
 
-    *ms = xTaskGetTickCount();
+    *ms = xTaskGetTickCount() * portTICK_PERIOD_MS;
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
 
 T_DjiReturnCode Osal_GetTimeUs(uint64_t *us)
 {
+    UBaseType_t interruptMask;
+    uint32_t tick;
+
     if (us == NULL) {
         return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
     }
 
-    *us = xTaskGetTickCount() * 1000;
+    /* callable from tasks and from interrupts under configMAX_SYSCALL_INTERRUPT_PRIORITY */
+    interruptMask = portSET_INTERRUPT_MASK_FROM_ISR();
+    tick = xTaskGetTickCountFromISR();
+
+    if (s_osalClockState == 0) {
+        OSAL_DEMCR |= OSAL_DEMCR_TRCENA;
+        if ((OSAL_DWT_CTRL & OSAL_DWT_CTRL_NOCYCCNT) == 0) {
+            OSAL_DWT_CTRL |= OSAL_DWT_CTRL_CYCCNTENA;
+            OsalClock_Init(&s_osalClock, configCPU_CLOCK_HZ, configTICK_RATE_HZ, tick, OSAL_DWT_CYCCNT);
+            s_osalClockState = 1;
+        } else {
+            s_osalClockState = 2;
+        }
+    }
+
+    if (s_osalClockState == 1) {
+        *us = OsalClock_GetTimeUs(&s_osalClock, tick, OSAL_DWT_CYCCNT);
+    } else {
+        *us = (uint64_t) tick * portTICK_PERIOD_MS * 1000;
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(interruptMask);
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
@@ -244,12 +320,183 @@ T_DjiReturnCode Osal_GetRandomNum(uint16_t *randomNum)
 
 void *Osal_Malloc(uint32_t size)
 {
-    return pvPortMalloc(size);
+    T_OsalHeapBlockHeader *header = NULL;
+    T_OsalHeapTaskStatistics *statistics;
+    uint32_t blockSize = size + sizeof(T_OsalHeapBlockHeader);
+    uint16_t owner;
+
+    if (size == 0 || blockSize < size) {
+        return NULL;
+    }
+
+    vTaskSuspendAll();
+    {
+#if OSAL_MEMORY_POOL_ENABLE
+        if (s_osalPoolInited == false) {
+            uint32_t poolSize = OsalPool_GetMemorySize(s_osalPoolConfig, sizeof(s_osalPoolClasses) /
+                                                                         sizeof(s_osalPoolClasses[0]));
+            void *poolMemory = pvPortMalloc(poolSize);
+
+            if (poolMemory != NULL &&
+                OsalPool_Init(&s_osalPool, s_osalPoolClasses, s_osalPoolConfig,
+                              sizeof(s_osalPoolClasses) / sizeof(s_osalPoolClasses[0]), poolMemory,
+                              poolSize) == false) {
+                /* the pool stays empty, it serves no allocation and owns no pointer */
+                vPortFree(poolMemory);
+            }
+            s_osalPoolInited = true;
+        }
+        header = OsalPool_Alloc(&s_osalPool, blockSize);
+#endif
+        if (header == NULL) {
+            header = pvPortMalloc(blockSize);
+        }
+
+        if (header != NULL) {
+            owner = Osal_HeapGetOwner();
+            header->size = size;
+            header->owner = owner;
+            header->magic = OSAL_HEAP_BLOCK_MAGIC;
+
+            statistics = &s_osalHeapTaskStatistics[owner];
+            statistics->usedSize += size;
+            if (statistics->usedSize > statistics->peakUsedSize) {
+                statistics->peakUsedSize = statistics->usedSize;
+            }
+            statistics->allocCount++;
+        } else {
+            s_osalHeapTaskStatistics[Osal_HeapGetOwner()].failCount++;
+        }
+    }
+    (void) xTaskResumeAll();
+
+    return header != NULL ? header + 1 : NULL;
 }
 
 void Osal_Free(void *ptr)
 {
-    vPortFree(ptr);
+    T_OsalHeapBlockHeader *header;
+    T_OsalHeapTaskStatistics *statistics;
+
+    if (ptr == NULL) {
+        return;
+    }
+
+    header = (T_OsalHeapBlockHeader *) ptr - 1;
+    configASSERT(header->magic == OSAL_HEAP_BLOCK_MAGIC && header->owner < OSAL_HEAP_TASK_NUM_MAX);
+
+    vTaskSuspendAll();
+    {
+        statistics = &s_osalHeapTaskStatistics[header->owner];
+        statistics->usedSize -= header->size;
+        statistics->freeCount++;
+        header->magic = 0;
+
+#if OSAL_MEMORY_POOL_ENABLE
+        if (OsalPool_Free(&s_osalPool, header) == false)
+#endif
+        {
+            vPortFree(header);
+        }
+    }
+    (void) xTaskResumeAll();
+}
+
+/**
+ * @brief Get the heap usage of each task that allocated through Osal_Malloc(), in allocation order. Sizes are the
+ * requested ones. The first entry, named "other", collects allocations made before the scheduler started.
+ * A task deleted through Osal_TaskDestroy() keeps its entry while its allocations are not all freed, they are still
+ * accounted to it; the entry is then reset for the next new task, as the handle of the deleted task can be reused.
+ */
+T_DjiReturnCode Osal_HeapGetTaskStatistics(T_OsalHeapTaskStatistics *statistics, uint8_t maxCount, uint8_t *count)
+{
+    if (statistics == NULL || count == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    vTaskSuspendAll();
+    *count = s_osalHeapTaskCount < maxCount ? s_osalHeapTaskCount : maxCount;
+    memcpy(statistics, s_osalHeapTaskStatistics, *count * sizeof(T_OsalHeapTaskStatistics));
+    (void) xTaskResumeAll();
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode Osal_HeapGetPoolStatistics(T_OsalHeapPoolStatistics *statistics, uint8_t maxCount, uint8_t *count)
+{
+    if (statistics == NULL || count == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    *count = 0;
+#if OSAL_MEMORY_POOL_ENABLE
+    vTaskSuspendAll();
+    if (s_osalPoolInited && s_osalPool.classes != NULL) {
+        for (; *count < s_osalPool.classCount && *count < maxCount; (*count)++) {
+            statistics[*count].blockSize = s_osalPool.classes[*count].blockSize;
+            statistics[*count].blockCount = s_osalPool.classes[*count].blockCount;
+            statistics[*count].usedCount = s_osalPool.classes[*count].usedCount;
+            statistics[*count].peakUsedCount = s_osalPool.classes[*count].peakUsedCount;
+            statistics[*count].allocCount = s_osalPool.classes[*count].allocCount;
+            statistics[*count].spillCount = s_osalPool.classes[*count].spillCount;
+        }
+    }
+    (void) xTaskResumeAll();
+#endif
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static uint16_t Osal_HeapGetOwner(void)
+{
+    TaskHandle_t task = NULL;
+    uint8_t i;
+
+    if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+        task = xTaskGetCurrentTaskHandle();
+    }
+    if (task == NULL) {
+        return OSAL_HEAP_OWNER_OTHER;
+    }
+
+    for (i = 1; i < s_osalHeapTaskCount; i++) {
+        if (s_osalHeapTaskHandles[i] == task) {
+            return i;
+        }
+    }
+
+    /* reuse the entry of a deleted task that has nothing left allocated */
+    for (i = 1; i < s_osalHeapTaskCount; i++) {
+        if (s_osalHeapTaskHandles[i] == NULL && s_osalHeapTaskStatistics[i].usedSize == 0) {
+            break;
+        }
+    }
+    if (i == s_osalHeapTaskCount) {
+        if (s_osalHeapTaskCount >= OSAL_HEAP_TASK_NUM_MAX) {
+            return OSAL_HEAP_OWNER_OTHER;
+        }
+        s_osalHeapTaskCount++;
+    }
+
+    memset(&s_osalHeapTaskStatistics[i], 0, sizeof(s_osalHeapTaskStatistics[i]));
+    s_osalHeapTaskHandles[i] = task;
+    strncpy(s_osalHeapTaskStatistics[i].taskName, pcTaskGetName(task),
+            sizeof(s_osalHeapTaskStatistics[i].taskName) - 1);
+
+    return i;
+}
+
+/* Detach a deleted task from its entry, a new task created with the same handle must not be accounted to it. */
+static void Osal_HeapReleaseOwner(TaskHandle_t task)
+{
+    uint8_t i;
+
+    for (i = 1; i < s_osalHeapTaskCount; i++) {
+        if (s_osalHeapTaskHandles[i] == task) {
+            s_osalHeapTaskHandles[i] = NULL;
+            return;
+        }
+    }
 }
 
 /****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -39,6 +39,23 @@ extern "C" {
 /* Exported constants --------------------------------------------------------*/
 
 /* Exported types ------------------------------------------------------------*/
+typedef struct {
+    char taskName[16];
+    uint32_t usedSize;
+    uint32_t peakUsedSize;
+    uint32_t allocCount;
+    uint32_t freeCount;
+    uint32_t failCount;
+} T_OsalHeapTaskStatistics;
+
+typedef struct {
+    uint16_t blockSize;
+    uint16_t blockCount;
+    uint16_t usedCount;
+    uint16_t peakUsedCount;
+    uint32_t allocCount;
+    uint32_t spillCount;
+} T_OsalHeapPoolStatistics;
 
 /* Exported functions --------------------------------------------------------*/
 T_DjiReturnCode Osal_TaskCreate(const char *name, void *(*taskFunc)(void *), uint32_t stackSize,
@@ -59,6 +76,8 @@ T_DjiReturnCode Osal_GetTimeUs(uint64_t *us);
 T_DjiReturnCode Osal_GetRandomNum(uint16_t *randomNum);
 void *Osal_Malloc(uint32_t size);
 void Osal_Free(void *ptr);
+T_DjiReturnCode Osal_HeapGetTaskStatistics(T_OsalHeapTaskStatistics *statistics, uint8_t maxCount, uint8_t *count);
+T_DjiReturnCode Osal_HeapGetPoolStatistics(T_OsalHeapPoolStatistics *statistics, uint8_t maxCount, uint8_t *count);
 
 #ifdef __cplusplus
 }
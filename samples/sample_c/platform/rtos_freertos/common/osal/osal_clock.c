@@ -0,0 +1,116 @@
+/**
+ ********************************************************************
+ * @file    osal_clock.c
+ * @brief
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "osal_clock.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define OSAL_CLOCK_US_PER_SECOND        1000000U
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+
+/* Private functions declaration ---------------------------------------------*/
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Start the clock. Time returned by OsalClock_GetTimeUs() starts at the time of the given tick, so it stays
+ * aligned with the millisecond time derived from the tick.
+ * @param clock: clock to initialize.
+ * @param counterFreqHz: hardware counter frequency, must be a multiple of tickFreqHz.
+ * @param tickFreqHz: scheduler tick frequency, must divide one second.
+ * @param tick: current scheduler tick.
+ * @param counter: current hardware counter value.
+ */
+void OsalClock_Init(T_OsalClock *clock, uint32_t counterFreqHz, uint32_t tickFreqHz, uint32_t tick,
+                    uint32_t counter)
+{
+    clock->counterFreqHz = counterFreqHz;
+    clock->counterPerTick = counterFreqHz / tickFreqHz;
+    clock->usPerTick = OSAL_CLOCK_US_PER_SECOND / tickFreqHz;
+    clock->baseTick = tick;
+    clock->baseCounter = counter;
+    clock->lastElapsedTick = 0;
+    clock->tickWrapCount = 0;
+    clock->lastCount = 0;
+}
+
+/**
+ * @brief Get the number of counter periods elapsed since OsalClock_Init(). The result never goes backwards.
+ * @param clock: clock to read.
+ * @param tick: current scheduler tick, read close to the counter.
+ * @param counter: current hardware counter value.
+ * @return counter periods since OsalClock_Init().
+ */
+uint64_t OsalClock_GetCount(T_OsalClock *clock, uint32_t tick, uint32_t counter)
+{
+    uint32_t elapsedTick = tick - clock->baseTick;
+    uint32_t elapsedCounter = counter - clock->baseCounter;
+    uint64_t expectedCount;
+    uint64_t count;
+    int32_t offset;
+
+    if (elapsedTick < clock->lastElapsedTick) {
+        clock->tickWrapCount++;
+    }
+    clock->lastElapsedTick = elapsedTick;
+
+    expectedCount = ((((uint64_t) clock->tickWrapCount) << 32) + elapsedTick) * clock->counterPerTick;
+    if (expectedCount < clock->lastCount) {
+        expectedCount = clock->lastCount;
+    }
+
+    /* the counter low bits are exact, pick the value nearest to the expected one that has them */
+    offset = (int32_t) (elapsedCounter - (uint32_t) expectedCount);
+    count = expectedCount + (int64_t) offset;
+
+    if (count < clock->lastCount) {
+        count = clock->lastCount;
+    }
+    clock->lastCount = count;
+
+    return count;
+}
+
+/**
+ * @brief Get the time in microseconds, on the same base as the scheduler tick converted to microseconds.
+ * @param clock: clock to read.
+ * @param tick: current scheduler tick, read close to the counter.
+ * @param counter: current hardware counter value.
+ * @return time in microseconds.
+ */
+uint64_t OsalClock_GetTimeUs(T_OsalClock *clock, uint32_t tick, uint32_t counter)
+{
+    uint64_t count = OsalClock_GetCount(clock, tick, counter);
+    uint64_t seconds = count / clock->counterFreqHz;
+    uint32_t remainder = (uint32_t) (count - seconds * clock->counterFreqHz);
+
+    return (uint64_t) clock->baseTick * clock->usPerTick + seconds * OSAL_CLOCK_US_PER_SECOND +
+           (uint64_t) remainder * OSAL_CLOCK_US_PER_SECOND / clock->counterFreqHz;
+}
+
+/* Private functions definition-----------------------------------------------*/
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,69 @@
+/**
+ ********************************************************************
+ * @file    osal_clock.h
+ * @brief   This is the header file for "osal_clock.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef OSAL_CLOCK_H
+#define OSAL_CLOCK_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+
+/* Exported types ------------------------------------------------------------*/
+/**
+ * @brief Extends a free running 32-bit hardware counter (DWT cycle counter, 32-bit TIM) to 64 bits.
+ * The counter wraps every few seconds, so the scheduler tick, which wraps after weeks, is used to tell how many times
+ * it has wrapped: the tick gives the expected counter value within one tick, and the 32-bit counter gives the exact
+ * value near it. When the tick does not move (scheduler not started) the last returned value is used instead, which
+ * only needs a read at least once per half counter period. The structure holds no lock, callers serialize access.
+ */
+typedef struct {
+    uint32_t counterFreqHz;
+    uint32_t counterPerTick;
+    uint32_t usPerTick;
+    uint32_t baseTick;
+    uint32_t baseCounter;
+    uint32_t lastElapsedTick;
+    uint32_t tickWrapCount;
+    uint64_t lastCount;
+} T_OsalClock;
+
+/* Exported functions --------------------------------------------------------*/
+void OsalClock_Init(T_OsalClock *clock, uint32_t counterFreqHz, uint32_t tickFreqHz, uint32_t tick,
+                    uint32_t counter);
+uint64_t OsalClock_GetCount(T_OsalClock *clock, uint32_t tick, uint32_t counter);
+uint64_t OsalClock_GetTimeUs(T_OsalClock *clock, uint32_t tick, uint32_t counter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OSAL_CLOCK_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -0,0 +1,202 @@
+/**
+ ********************************************************************
+ * @file    osal_pool.c
+ * @brief
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "osal_pool.h"
+#include <stddef.h>
+
+/* Private constants ---------------------------------------------------------*/
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+
+/* Private functions declaration ---------------------------------------------*/
+static uint32_t OsalPool_AlignSize(uint32_t size);
+static T_OsalPoolClass *OsalPool_FindClass(const T_OsalPool *pool, const void *ptr);
+
+/* Exported functions definition ---------------------------------------------*/
+uint32_t OsalPool_GetMemorySize(const T_OsalPoolClassConfig *config, uint8_t classCount)
+{
+    uint32_t memorySize = 0;
+    uint8_t i;
+
+    for (i = 0; i < classCount; i++) {
+        memorySize += OsalPool_AlignSize(config[i].blockSize) * config[i].blockCount;
+    }
+
+    return memorySize;
+}
+
+/**
+ * @brief Build the pool in the given memory, which must be aligned to OSAL_POOL_ALIGNMENT and hold at least
+ * OsalPool_GetMemorySize() bytes.
+ * @return false if the configuration is not sorted by block size or the memory is too small.
+ */
+bool OsalPool_Init(T_OsalPool *pool, T_OsalPoolClass *classes, const T_OsalPoolClassConfig *config,
+                   uint8_t classCount, void *memory, uint32_t memorySize)
+{
+    uint8_t *block = memory;
+    uint16_t blockSize;
+    uint16_t j;
+    uint8_t i;
+
+    if (((uintptr_t) memory % OSAL_POOL_ALIGNMENT) != 0 ||
+        memorySize < OsalPool_GetMemorySize(config, classCount)) {
+        return false;
+    }
+
+    for (i = 0; i < classCount; i++) {
+        blockSize = (uint16_t) OsalPool_AlignSize(config[i].blockSize);
+        if (blockSize < sizeof(void *) || (i > 0 && blockSize <= classes[i - 1].blockSize)) {
+            return false;
+        }
+
+        classes[i].start = block;
+        classes[i].blockSize = blockSize;
+        classes[i].blockCount = config[i].blockCount;
+        classes[i].usedCount = 0;
+        classes[i].peakUsedCount = 0;
+        classes[i].allocCount = 0;
+        classes[i].spillCount = 0;
+        classes[i].freeList = NULL;
+
+        /* chain the blocks in address order, the lowest one is handed out first */
+        for (j = classes[i].blockCount; j > 0; j--) {
+            *(void **) (block + (uint32_t) (j - 1) * blockSize) = classes[i].freeList;
+            classes[i].freeList = block + (uint32_t) (j - 1) * blockSize;
+        }
+        block += (uint32_t) blockSize * classes[i].blockCount;
+        classes[i].end = block;
+    }
+
+    pool->classes = classes;
+    pool->classCount = classCount;
+    pool->start = memory;
+    pool->end = block;
+    pool->failCount = 0;
+
+    return true;
+}
+
+void *OsalPool_Alloc(T_OsalPool *pool, uint32_t size)
+{
+    T_OsalPoolClass *fitClass = NULL;
+    T_OsalPoolClass *poolClass;
+    void *block;
+    uint8_t i;
+
+    for (i = 0; i < pool->classCount; i++) {
+        poolClass = &pool->classes[i];
+        if (poolClass->blockSize < size) {
+            continue;
+        }
+        if (fitClass == NULL) {
+            fitClass = poolClass;
+        }
+        if (poolClass->freeList == NULL) {
+            continue;
+        }
+
+        block = poolClass->freeList;
+        poolClass->freeList = *(void **) block;
+        poolClass->usedCount++;
+        if (poolClass->usedCount > poolClass->peakUsedCount) {
+            poolClass->peakUsedCount = poolClass->usedCount;
+        }
+        poolClass->allocCount++;
+        if (fitClass != poolClass) {
+            fitClass->spillCount++;
+        }
+
+        return block;
+    }
+
+    if (fitClass != NULL) {
+        pool->failCount++;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Give a block back to its class.
+ * @return false if the pointer does not belong to the pool, so that the caller can free it elsewhere.
+ */
+bool OsalPool_Free(T_OsalPool *pool, void *ptr)
+{
+    T_OsalPoolClass *poolClass = OsalPool_FindClass(pool, ptr);
+
+    if (poolClass == NULL) {
+        return false;
+    }
+
+    *(void **) ptr = poolClass->freeList;
+    poolClass->freeList = ptr;
+    poolClass->usedCount--;
+
+    return true;
+}
+
+bool OsalPool_IsFromPool(const T_OsalPool *pool, const void *ptr)
+{
+    return (const uint8_t *) ptr >= pool->start && (const uint8_t *) ptr < pool->end;
+}
+
+uint32_t OsalPool_GetBlockSize(const T_OsalPool *pool, const void *ptr)
+{
+    T_OsalPoolClass *poolClass = OsalPool_FindClass(pool, ptr);
+
+    return poolClass != NULL ? poolClass->blockSize : 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static uint32_t OsalPool_AlignSize(uint32_t size)
+{
+    return (size + OSAL_POOL_ALIGNMENT - 1) & ~((uint32_t) OSAL_POOL_ALIGNMENT - 1);
+}
+
+static T_OsalPoolClass *OsalPool_FindClass(const T_OsalPool *pool, const void *ptr)
+{
+    T_OsalPoolClass *poolClass;
+    uint8_t i;
+
+    if (!OsalPool_IsFromPool(pool, ptr)) {
+        return NULL;
+    }
+
+    for (i = 0; i < pool->classCount; i++) {
+        poolClass = &pool->classes[i];
+        if ((const uint8_t *) ptr < poolClass->end) {
+            if (((uint32_t) ((const uint8_t *) ptr - poolClass->start) % poolClass->blockSize) != 0) {
+                return NULL;
+            }
+            return poolClass;
+        }
+    }
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,86 @@
+/**
+ ********************************************************************
+ * @file    osal_pool.h
+ * @brief   This is the header file for "osal_pool.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef OSAL_POOL_H
+#define OSAL_POOL_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define OSAL_POOL_ALIGNMENT         (8)
+
+/* Exported types ------------------------------------------------------------*/
+typedef struct {
+    uint16_t blockSize;
+    uint16_t blockCount;
+} T_OsalPoolClassConfig;
+
+typedef struct {
+    uint8_t *start;
+    uint8_t *end;
+    void *freeList;
+    uint16_t blockSize;
+    uint16_t blockCount;
+    uint16_t usedCount;
+    uint16_t peakUsedCount;
+    uint32_t allocCount;
+    uint32_t spillCount; /*!< allocations that fitted this class but were served by a larger one */
+} T_OsalPoolClass;
+
+/**
+ * @brief Fixed-block allocator made of classes of equal sized blocks, classes sorted by ascending block size.
+ * A request takes a block of the smallest class it fits in, or of the next larger class that still has a free block,
+ * so memory never fragments; requests no class can serve fail and are left to the caller. Not thread safe.
+ */
+typedef struct {
+    T_OsalPoolClass *classes;
+    uint8_t classCount;
+    uint8_t *start;
+    uint8_t *end;
+    uint32_t failCount; /*!< allocations small enough for the pool that found every fitting class exhausted */
+} T_OsalPool;
+
+/* Exported functions --------------------------------------------------------*/
+uint32_t OsalPool_GetMemorySize(const T_OsalPoolClassConfig *config, uint8_t classCount);
+bool OsalPool_Init(T_OsalPool *pool, T_OsalPoolClass *classes, const T_OsalPoolClassConfig *config,
+                   uint8_t classCount, void *memory, uint32_t memorySize);
+void *OsalPool_Alloc(T_OsalPool *pool, uint32_t size);
+bool OsalPool_Free(T_OsalPool *pool, void *ptr);
+bool OsalPool_IsFromPool(const T_OsalPool *pool, const void *ptr);
+uint32_t OsalPool_GetBlockSize(const T_OsalPool *pool, const void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OSAL_POOL_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -46,6 +46,7 @@
 #include "dji_logger.h"
 
 #include "utils/util_misc.h"
+#include "utils/util_asset.h"
 #include "camera_emu/test_payload_cam_emu_base.h"
 #include "fc_subscription/test_fc_subscription.h"
 #include "gimbal_emu/test_payload_gimbal_emu.h"
@@ -65,6 +66,9 @@
 
 #define DJI_USE_WIDGET_INTERACTION        0
 
+#define MONITOR_HEAP_TASK_NUM_MAX         24
+#define MONITOR_HEAP_POOL_CLASS_NUM_MAX   8
+
 /* Private types -------------------------------------------------------------*/
 
 /* Private values -------------------------------------------------------------*/
@@ -73,6 +77,7 @@ static bool s_isApplicationStart = false;
 /* Private functions declaration ---------------------------------------------*/
 static T_DjiReturnCode DjiUser_PrintConsole(const uint8_t *data, uint16_t dataLen);
 static T_DjiReturnCode DjiUser_FillInUserInfo(T_DjiUserInfo *userInfo);
+static void DjiUser_PrintHeapStatistics(void);
 
 /* Exported functions definition ---------------------------------------------*/
 void DjiUser_StartTask(void const *argument)
@@ -133,6 +138,12 @@ void DjiUser_StartTask(void const *argument)
         goto out;
     }
 
+    returnCode = UtilAsset_Init();
+    if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        printf("init asset error");
+        goto out;
+    }
+
     returnCode = DjiPlatform_RegHalUartHandler(&uartHandler);
     if (returnCode != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
         printf("register hal uart handler error");
@@ -432,9 +443,10 @@ void DjiUser_MonitorTask(void const *argument)
             lastTaskStatusArray = currentTaskStatusArray;
             lastTaskStatusArraySize = currentTaskStatusArraySize;
 #endif
+            DjiUser_PrintHeapStatistics();
         }
-        USER_LOG_INFO("Used heap size: %d/%d.\r\n", configTOTAL_HEAP_SIZE - xPortGetFreeHeapSize(),
-                      configTOTAL_HEAP_SIZE);
+        USER_LOG_INFO("Used heap size: %d/%d, peak %d.\r\n", configTOTAL_HEAP_SIZE - xPortGetFreeHeapSize(),
+                      configTOTAL_HEAP_SIZE, configTOTAL_HEAP_SIZE - xPortGetMinimumEverFreeHeapSize());
     }
 }
 
@@ -443,6 +455,33 @@ void DjiUser_MonitorTask(void const *argument)
 #endif
 
 /* Private functions definition-----------------------------------------------*/
+static void DjiUser_PrintHeapStatistics(void)
+{
+    static T_OsalHeapTaskStatistics taskStatistics[MONITOR_HEAP_TASK_NUM_MAX];
+    T_OsalHeapPoolStatistics poolStatistics[MONITOR_HEAP_POOL_CLASS_NUM_MAX];
+    uint8_t count = 0;
+    uint8_t i;
+
+    Osal_HeapGetTaskStatistics(taskStatistics, MONITOR_HEAP_TASK_NUM_MAX, &count);
+    USER_LOG_DEBUG("heap usage by task:");
+    USER_LOG_DEBUG("task name\tused (byte)\tpeak (byte)\talloc\tfree\tfail");
+    for (i = 0; i < count; i++) {
+        USER_LOG_DEBUG("%-16s\t%u\t%u\t%u\t%u\t%u", taskStatistics[i].taskName,
+                       (unsigned int) taskStatistics[i].usedSize, (unsigned int) taskStatistics[i].peakUsedSize,
+                       (unsigned int) taskStatistics[i].allocCount, (unsigned int) taskStatistics[i].freeCount,
+                       (unsigned int) taskStatistics[i].failCount);
+    }
+
+    Osal_HeapGetPoolStatistics(poolStatistics, MONITOR_HEAP_POOL_CLASS_NUM_MAX, &count);
+    USER_LOG_DEBUG("heap pool usage:");
+    USER_LOG_DEBUG("block size\tused/count\tpeak\talloc\tspill");
+    for (i = 0; i < count; i++) {
+        USER_LOG_DEBUG("%u\t%u/%u\t%u\t%u\t%u", poolStatistics[i].blockSize, poolStatistics[i].usedCount,
+                       poolStatistics[i].blockCount, poolStatistics[i].peakUsedCount,
+                       (unsigned int) poolStatistics[i].allocCount, (unsigned int) poolStatistics[i].spillCount);
+    }
+}
+
 static T_DjiReturnCode DjiUser_FillInUserInfo(T_DjiUserInfo *userInfo)
 {
     memset(userInfo->appName, 0, sizeof(userInfo->appName));
@@ -29,6 +29,7 @@
 #include "task.h"
 #include "core_cm4.h"
 #include "flash_if.h"
+#include "uart.h"
 
 /* Private constants ---------------------------------------------------------*/
 #define USER_START_TASK_STACK_SIZE          2048
@@ -162,6 +163,7 @@ void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
     /* USER CODE END Callback 0 */
     if (htim->Instance == TIM1) {
         HAL_IncTick();
+        UART_RetryTransmit();
     }
     /* USER CODE BEGIN Callback 1 */
 
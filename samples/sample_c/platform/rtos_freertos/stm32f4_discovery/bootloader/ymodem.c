@@ -57,6 +57,7 @@
 #include "menu.h"
 #include "uart.h"
 #include "osal.h"
+#include "ymodem_core.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
@@ -94,101 +95,46 @@
 #define DOWNLOAD_TIMEOUT        ((uint32_t)5000) /* Five second retry delay */
 #define MAX_ERRORS              ((uint32_t)5)
 #define CRC16_F       /* activate the CRC16 integrity */
+
+#define FLASH_WRITE_TASK_STACK_SIZE         512
 /* Private macro -------------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Flash programming of the packet received last, done by a task while the next packet is being received */
+typedef struct {
+    T_DjiTaskHandle task;
+    T_DjiSemaHandle requestSema;
+    T_DjiSemaHandle doneSema;
+    bool pending;
+    uint32_t address;
+    const uint8_t *data;
+    uint32_t size;
+    uint32_t result;
+    uint32_t erasedEndAddress;
+} T_YmodemFlashWriter;
+
 /* Private variables ---------------------------------------------------------*/
-__IO uint32_t flashdestination;
 /* @note ATTENTION - please keep this variable 32bit alligned */
 uint8_t aPacketData[PACKET_1K_SIZE + PACKET_DATA_INDEX + PACKET_TRAILER_SIZE];
+static uint32_t s_receivePacketBuffer[2][YMODEM_CORE_PACKET_BUFFER_SIZE / sizeof(uint32_t)];
+static T_YmodemFlashWriter s_flashWriter;
 
 /* Private function prototypes -----------------------------------------------*/
 static void PrepareIntialPacket(uint8_t *p_data, const uint8_t *p_file_name, uint32_t length);
 static void PreparePacket(uint8_t *p_source, uint8_t *p_packet, uint8_t pkt_nr, uint32_t size_blk);
-static HAL_StatusTypeDef ReceivePacket(uint8_t *p_data, uint32_t *p_length, uint32_t timeout);
-uint16_t UpdateCRC16(uint16_t crc_in, uint8_t byte);
-uint16_t Cal_CRC16(const uint8_t *p_data, uint32_t size);
 uint8_t CalcChecksum(const uint8_t *p_data, uint32_t size);
+static uint32_t Ymodem_UartRead(void *userData, uint8_t *buf, uint32_t size, uint32_t timeoutMs);
+static void Ymodem_UartWrite(void *userData, const uint8_t *buf, uint32_t size);
+static bool Ymodem_FlashOpen(void *userData, const char *fileName, uint32_t fileSize);
+static bool Ymodem_FlashWrite(void *userData, uint32_t offset, const uint8_t *data, uint32_t size);
+static bool Ymodem_FlashClose(void *userData, bool complete);
+static uint32_t Ymodem_FlashWaitIdle(T_YmodemFlashWriter *writer);
+static void *Ymodem_FlashWriteTask(void *arg);
 
 HAL_StatusTypeDef Uart_ReadWithTimeOut(E_UartNum uartNum, uint8_t *data, uint16_t len, uint32_t timeOut);
 HAL_StatusTypeDef Uart_WriteWithTimeOut(E_UartNum uartNum, uint8_t *data, uint16_t len, uint32_t timeOut);
 
 /* Private functions ---------------------------------------------------------*/
 
-/**
-  * @brief  Receive a packet from sender
-  * @param  data
-  * @param  length
-  *     0: end of transmission
-  *     2: abort by sender
-  *    >0: packet length
-  * @param  timeout
-  * @retval HAL_OK: normally return
-  *         HAL_BUSY: abort by user
-  */
-static HAL_StatusTypeDef ReceivePacket(uint8_t *p_data, uint32_t *p_length, uint32_t timeout)
-{
-    uint32_t crc;
-    uint32_t packet_size = 0;
-    HAL_StatusTypeDef status;
-    uint8_t char1;
-
-    *p_length = 0;
-    status = Uart_ReadWithTimeOut(PSDK_CONSOLE_UART_NUM, &char1, 1, timeout);
-
-    if (status == HAL_OK) {
-        switch (char1) {
-            case SOH:
-                packet_size = PACKET_SIZE;
-                break;
-            case STX:
-                packet_size = PACKET_1K_SIZE;
-                break;
-            case EOT:
-                break;
-            case CA:
-                if ((Uart_ReadWithTimeOut(PSDK_CONSOLE_UART_NUM, &char1, 1, timeout) == HAL_OK) && (char1 == CA)) {
-                    packet_size = 2;
-                } else {
-                    status = HAL_ERROR;
-                }
-                break;
-            case ABORT1:
-            case ABORT2:
-                status = HAL_BUSY;
-                break;
-            default:
-                status = HAL_ERROR;
-                break;
-        }
-        *p_data = char1;
-
-        if (packet_size >= PACKET_SIZE) {
-            status = Uart_ReadWithTimeOut(PSDK_CONSOLE_UART_NUM, &p_data[PACKET_NUMBER_INDEX],
-                                          packet_size + PACKET_OVERHEAD_SIZE,
-                                          timeout);
-
-            /* Simple packet sanity check */
-            if (status == HAL_OK) {
-                if (p_data[PACKET_NUMBER_INDEX] != ((p_data[PACKET_CNUMBER_INDEX]) ^ NEGATIVE_BYTE)) {
-                    packet_size = 0;
-                    status = HAL_ERROR;
-                } else {
-                    /* Check packet CRC */
-                    crc = p_data[packet_size + PACKET_DATA_INDEX] << 8;
-                    crc += p_data[packet_size + PACKET_DATA_INDEX + 1];
-                    if (Cal_CRC16(&p_data[PACKET_DATA_INDEX], packet_size) != crc) {
-                        packet_size = 0;
-                        status = HAL_ERROR;
-                    }
-                }
-            } else {
-                packet_size = 0;
-            }
-        }
-    }
-    *p_length = packet_size;
-    return status;
-}
-
 /**
   * @brief  Prepare the first block
   * @param  p_data:  output buffer
@@ -262,49 +208,6 @@ static void PreparePacket(uint8_t *p_source, uint8_t *p_packet, uint8_t pkt_nr,
     }
 }
 
-/**
-  * @brief  Update CRC16 for input byte
-  * @param  crc_in input value 
-  * @param  input byte
-  * @retval None
-  */
-uint16_t UpdateCRC16(uint16_t crc_in, uint8_t byte)
-{
-    uint32_t crc = crc_in;
-    uint32_t in = byte | 0x100;
-
-    do {
-        crc <<= 1;
-        in <<= 1;
-        if (in & 0x100)
-            ++crc;
-        if (crc & 0x10000)
-            crc ^= 0x1021;
-    } while (!(in & 0x10000));
-
-    return crc & 0xffffu;
-}
-
-/**
-  * @brief  Cal CRC16 for YModem Packet
-  * @param  data
-  * @param  length
-  * @retval None
-  */
-uint16_t Cal_CRC16(const uint8_t *p_data, uint32_t size)
-{
-    uint32_t crc = 0;
-    const uint8_t *dataEnd = p_data + size;
-
-    while (p_data < dataEnd)
-        crc = UpdateCRC16(crc, *p_data++);
-
-    crc = UpdateCRC16(crc, 0);
-    crc = UpdateCRC16(crc, 0);
-
-    return crc & 0xffffu;
-}
-
 /**
   * @brief  Calculate Check sum for YModem Packet
   * @param  p_data Pointer to input data
@@ -331,125 +234,41 @@ uint8_t CalcChecksum(const uint8_t *p_data, uint32_t size)
   */
 COM_StatusTypeDef Ymodem_Receive(uint32_t *p_size)
 {
-    uint32_t i, packet_length, session_done = 0, file_done, errors = 0, session_begin = 0;
-    // uint32_t flashdestination;
-    uint32_t ramsource, filesize, packets_received;
-    uint8_t *file_ptr;
-    uint8_t file_size[FILE_SIZE_LENGTH], tmp;
-    COM_StatusTypeDef result = COM_OK;
-
-    /* Initialize flashdestination variable */
-    flashdestination = APPLICATION_ADDRESS;
-
-    while ((session_done == 0) && (result == COM_OK)) {
-        packets_received = 0;
-        file_done = 0;
-        while ((file_done == 0) && (result == COM_OK)) {
-            switch (ReceivePacket(aPacketData, &packet_length, DOWNLOAD_TIMEOUT)) {
-                case HAL_OK:
-                    errors = 0;
-                    switch (packet_length) {
-                        case 2:
-                            /* Abort by sender */
-                            Serial_PutByte(ACK);
-                            result = COM_ABORT;
-                            break;
-                        case 0:
-                            /* End of transmission */
-                            Serial_PutByte(ACK);
-                            file_done = 1;
-                            break;
-                        default:
-                            /* Normal packet */
-                            if (aPacketData[PACKET_NUMBER_INDEX] != (uint8_t) packets_received) {
-                                Serial_PutByte(NAK);
-                            } else {
-                                if (packets_received == 0) {
-                                    /* File name packet */
-                                    if (aPacketData[PACKET_DATA_INDEX] != 0) {
-                                        /* File name extraction */
-                                        i = 0;
-                                        file_ptr = aPacketData + PACKET_DATA_INDEX;
-                                        while ((*file_ptr != 0) && (i < FILE_NAME_LENGTH)) {
-                                            aFileName[i++] = *file_ptr++;
-                                        }
-
-                                        /* File size extraction */
-                                        aFileName[i++] = '\0';
-                                        i = 0;
-                                        file_ptr++;
-                                        while ((*file_ptr != ' ') && (i < FILE_SIZE_LENGTH)) {
-                                            file_size[i++] = *file_ptr++;
-                                        }
-                                        file_size[i++] = '\0';
-                                        Str2Int(file_size, &filesize);
-
-                                        /* Test the size of the image to be sent */
-                                        /* Image size is greater than Flash size */
-                                        if (*p_size > (APPLICATION_FLASH_SIZE + 1)) {
-                                            /* End session */
-                                            tmp = CA;
-                                            Uart_WriteWithTimeOut(PSDK_CONSOLE_UART_NUM, &tmp, 1, NAK_TIMEOUT);
-                                            Uart_WriteWithTimeOut(PSDK_CONSOLE_UART_NUM, &tmp, 1, NAK_TIMEOUT);
-                                            result = COM_LIMIT;
-                                        }
-                                        /* erase user application area */
-                                        FLASH_If_Erase(APPLICATION_ADDRESS, APPLICATION_ADDRESS_END);
-                                        *p_size = filesize;
-
-                                        Serial_PutByte(ACK);
-                                        Serial_PutByte(CRC16);
-                                    }
-                                        /* File header packet is empty, end session */
-                                    else {
-                                        Serial_PutByte(ACK);
-                                        file_done = 1;
-                                        session_done = 1;
-                                        break;
-                                    }
-                                } else /* Data packet */
-                                {
-                                    ramsource = (uint32_t) &aPacketData[PACKET_DATA_INDEX];
-                                    /* Write received data in Flash */
-                                    if (FLASH_If_Write(flashdestination, (uint8_t *) ramsource, packet_length) ==
-                                        FLASHIF_OK) {
-                                        flashdestination += packet_length;
-                                        Serial_PutByte(ACK);
-                                    } else /* An error occurred while writing to Flash memory */
-                                    {
-                                        /* End session */
-                                        Serial_PutByte(CA);
-                                        Serial_PutByte(CA);
-                                        result = COM_DATA;
-                                    }
-                                }
-                                packets_received++;
-                                session_begin = 1;
-                            }
-                            break;
-                    }
-                    break;
-                case HAL_BUSY: /* Abort actually */
-                    Serial_PutByte(CA);
-                    Serial_PutByte(CA);
-                    result = COM_ABORT;
-                    break;
-                default:
-                    if (session_begin > 0) {
-                        errors++;
-                    }
-                    if (errors > MAX_ERRORS) {
-                        /* Abort communication */
-                        Serial_PutByte(CA);
-                        Serial_PutByte(CA);
-                    } else {
-                        Serial_PutByte(CRC16); /* Ask for a packet */
-                    }
-                    break;
-            }
+    static const T_YmodemCoreIo io = {
+        Ymodem_UartRead, Ymodem_UartWrite, Ymodem_FlashOpen, Ymodem_FlashWrite, Ymodem_FlashClose, &s_flashWriter,
+    };
+    T_YmodemCoreReceiver receiver;
+    E_YmodemCoreResult result;
+
+    if (s_flashWriter.task == NULL) {
+        if (Osal_SemaphoreCreate(0, &s_flashWriter.requestSema) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS ||
+            Osal_SemaphoreCreate(0, &s_flashWriter.doneSema) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS ||
+            Osal_TaskCreate("flash_write", Ymodem_FlashWriteTask, FLASH_WRITE_TASK_STACK_SIZE, &s_flashWriter,
+                            &s_flashWriter.task) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS ||
+            s_flashWriter.task == NULL) {
+            return COM_ERROR;
         }
     }
-    return result;
+
+    YmodemCore_InitReceiver(&receiver, &io, s_receivePacketBuffer[0], s_receivePacketBuffer[1]);
+    result = YmodemCore_Receive(&receiver);
+
+    strncpy((char *) aFileName, receiver.fileName, FILE_NAME_LENGTH - 1);
+    aFileName[FILE_NAME_LENGTH - 1] = '\0';
+    *p_size = receiver.receivedSize;
+
+    switch (result) {
+        case YMODEM_CORE_OK:
+            return COM_OK;
+        case YMODEM_CORE_ABORT:
+            return COM_ABORT;
+        case YMODEM_CORE_LIMIT:
+            return COM_LIMIT;
+        case YMODEM_CORE_DATA:
+            return COM_DATA;
+        default:
+            return COM_ERROR;
+    }
 }
 
 /**
@@ -483,7 +302,7 @@ COM_StatusTypeDef Ymodem_Transmit(uint8_t *p_buf, const uint8_t *p_file_name, ui
 
         /* Send CRC or Check Sum based on CRC16_F */
 #ifdef CRC16_F
-        temp_crc = Cal_CRC16(&aPacketData[PACKET_DATA_INDEX], PACKET_SIZE);
+        temp_crc = YmodemCore_Crc16(&aPacketData[PACKET_DATA_INDEX], PACKET_SIZE);
         Serial_PutByte(temp_crc >> 8);
         Serial_PutByte(temp_crc & 0xFF);
 #else /* CRC16_F */   
@@ -536,7 +355,7 @@ COM_StatusTypeDef Ymodem_Transmit(uint8_t *p_buf, const uint8_t *p_file_name, ui
 
             /* Send CRC or Check Sum based on CRC16_F */
 #ifdef CRC16_F
-            temp_crc = Cal_CRC16(&aPacketData[PACKET_DATA_INDEX], pkt_size);
+            temp_crc = YmodemCore_Crc16(&aPacketData[PACKET_DATA_INDEX], pkt_size);
             Serial_PutByte(temp_crc >> 8);
             Serial_PutByte(temp_crc & 0xFF);
 #else /* CRC16_F */   
@@ -614,7 +433,7 @@ COM_StatusTypeDef Ymodem_Transmit(uint8_t *p_buf, const uint8_t *p_file_name, ui
 
         /* Send CRC or Check Sum based on CRC16_F */
 #ifdef CRC16_F
-        temp_crc = Cal_CRC16(&aPacketData[PACKET_DATA_INDEX], PACKET_SIZE);
+        temp_crc = YmodemCore_Crc16(&aPacketData[PACKET_DATA_INDEX], PACKET_SIZE);
         Serial_PutByte(temp_crc >> 8);
         Serial_PutByte(temp_crc & 0xFF);
 #else /* CRC16_F */   
@@ -666,6 +485,116 @@ HAL_StatusTypeDef Uart_WriteWithTimeOut(E_UartNum uartNum, uint8_t *data, uint16
         return HAL_ERROR;
     }
 }
+static uint32_t Ymodem_UartRead(void *userData, uint8_t *buf, uint32_t size, uint32_t timeoutMs)
+{
+    uint32_t readSize = 0;
+    uint32_t startTimeMs;
+    uint32_t currentTimeMs;
+    int res;
+
+    Osal_GetTimeMs(&startTimeMs);
+    while (readSize < size) {
+        Osal_GetTimeMs(&currentTimeMs);
+        if (currentTimeMs - startTimeMs >= timeoutMs) {
+            break;
+        }
+
+        res = UART_ReadWait(PSDK_CONSOLE_UART_NUM, buf + readSize, (uint16_t) (size - readSize),
+                            timeoutMs - (currentTimeMs - startTimeMs));
+        if (res > 0) {
+            readSize += res;
+        }
+    }
+
+    return readSize;
+}
+
+static void Ymodem_UartWrite(void *userData, const uint8_t *buf, uint32_t size)
+{
+    UART_Write(PSDK_CONSOLE_UART_NUM, buf, (uint16_t) size);
+}
+
+static bool Ymodem_FlashOpen(void *userData, const char *fileName, uint32_t fileSize)
+{
+    T_YmodemFlashWriter *writer = userData;
+
+    (void) Ymodem_FlashWaitIdle(writer);
+    if (fileSize > APPLICATION_FLASH_SIZE) {
+        return false;
+    }
+
+    writer->result = FLASHIF_OK;
+    writer->erasedEndAddress = APPLICATION_ADDRESS;
+
+    return true;
+}
+
+static bool Ymodem_FlashWrite(void *userData, uint32_t offset, const uint8_t *data, uint32_t size)
+{
+    T_YmodemFlashWriter *writer = userData;
+    uint32_t address = APPLICATION_ADDRESS + offset;
+
+    if (Ymodem_FlashWaitIdle(writer) != FLASHIF_OK || offset + size > APPLICATION_FLASH_SIZE) {
+        return false;
+    }
+
+    /* erase the sectors the image reaches when it reaches them, the sender waits for the acknowledge meanwhile */
+    if (address + size > writer->erasedEndAddress) {
+        if (FLASH_If_Erase(writer->erasedEndAddress, address + size - 1) != FLASHIF_OK) {
+            return false;
+        }
+        writer->erasedEndAddress = FLASH_If_GetSectorEndAddress(address + size - 1) + 1;
+    }
+
+    writer->address = address;
+    writer->data = data;
+    writer->size = size;
+    writer->pending = true;
+    Osal_SemaphorePost(writer->requestSema);
+
+    return true;
+}
+
+static bool Ymodem_FlashClose(void *userData, bool complete)
+{
+    T_YmodemFlashWriter *writer = userData;
+
+    return Ymodem_FlashWaitIdle(writer) == FLASHIF_OK && complete;
+}
+
+static uint32_t Ymodem_FlashWaitIdle(T_YmodemFlashWriter *writer)
+{
+    if (writer->pending) {
+        Osal_SemaphoreWait(writer->doneSema);
+        writer->pending = false;
+    }
+
+    return writer->result;
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-noreturn"
+#pragma GCC diagnostic ignored "-Wreturn-type"
+#endif
+
+static void *Ymodem_FlashWriteTask(void *arg)
+{
+    T_YmodemFlashWriter *writer = arg;
+
+    while (1) {
+        Osal_SemaphoreWait(writer->requestSema);
+        if (writer->result == FLASHIF_OK) {
+            writer->result = FLASH_If_Write(writer->address, writer->data, writer->size);
+        }
+        Osal_SemaphorePost(writer->doneSema);
+    }
+}
+
+#ifndef __CC_ARM
+#pragma GCC diagnostic pop
+#endif
+
 /**
   * @}
   */
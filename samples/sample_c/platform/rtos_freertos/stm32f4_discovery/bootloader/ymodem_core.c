@@ -0,0 +1,374 @@
+/**
+ ********************************************************************
+ * @file    ymodem_core.c
+ * @brief   YMODEM receiver protocol, independent of the UART and of the flash so that it can run on a host.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "ymodem_core.h"
+#include <stddef.h>
+
+/* Private constants ---------------------------------------------------------*/
+#define YMODEM_CORE_SOH                     ((uint8_t) 0x01) /* start of 128-byte data packet */
+#define YMODEM_CORE_STX                     ((uint8_t) 0x02) /* start of 1024-byte data packet */
+#define YMODEM_CORE_EOT                     ((uint8_t) 0x04) /* end of transmission */
+#define YMODEM_CORE_ACK                     ((uint8_t) 0x06)
+#define YMODEM_CORE_NAK                     ((uint8_t) 0x15)
+#define YMODEM_CORE_CA                      ((uint8_t) 0x18) /* two of these in succession aborts transfer */
+#define YMODEM_CORE_CRC16                   ((uint8_t) 0x43) /* 'C', request 16-bit CRC */
+#define YMODEM_CORE_ABORT1                  ((uint8_t) 0x41) /* 'A', abort by user */
+#define YMODEM_CORE_ABORT2                  ((uint8_t) 0x61) /* 'a', abort by user */
+
+#define YMODEM_CORE_PACKET_START_INDEX      (1)
+#define YMODEM_CORE_PACKET_NUMBER_INDEX     (2)
+#define YMODEM_CORE_PACKET_CNUMBER_INDEX    (3)
+#define YMODEM_CORE_PACKET_OVERHEAD_SIZE    (4) /* number, !number and crc after the start byte */
+
+#define YMODEM_CORE_START_POLL_INTERVAL_MS  (1000)
+#define YMODEM_CORE_PACKET_TIMEOUT_MS       (5000)
+#define YMODEM_CORE_PURGE_TIMEOUT_MS        (50)
+#define YMODEM_CORE_MAX_ERROR_COUNT         (5)
+
+/* Private types -------------------------------------------------------------*/
+typedef enum {
+    YMODEM_CORE_PACKET_DATA = 0,
+    YMODEM_CORE_PACKET_EOT,
+    YMODEM_CORE_PACKET_CANCEL,
+    YMODEM_CORE_PACKET_USER_ABORT,
+    YMODEM_CORE_PACKET_TIMEOUT,
+    YMODEM_CORE_PACKET_ERROR,
+} E_YmodemCorePacketType;
+
+/* Private values -------------------------------------------------------------*/
+/* CRC-16/XMODEM, polynomial 0x1021, initial value 0 */
+static const uint16_t s_ymodemCoreCrc16Table[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+};
+
+/* Private functions declaration ---------------------------------------------*/
+static E_YmodemCorePacketType YmodemCore_ReceivePacket(T_YmodemCoreReceiver *receiver, uint8_t *packet,
+                                                       uint32_t *packetSize, uint32_t timeoutMs);
+static bool YmodemCore_ParseHeader(T_YmodemCoreReceiver *receiver, const uint8_t *data, uint32_t size);
+static void YmodemCore_PutByte(T_YmodemCoreReceiver *receiver, uint8_t byte);
+static void YmodemCore_Purge(T_YmodemCoreReceiver *receiver, uint8_t *buffer);
+static void YmodemCore_Cancel(T_YmodemCoreReceiver *receiver, bool fileOpened);
+
+/* Exported functions definition ---------------------------------------------*/
+/**
+ * @brief Prepare a receiver with the default timeouts.
+ * @param packetBuffer0: first packet buffer, YMODEM_CORE_PACKET_BUFFER_SIZE bytes.
+ * @param packetBuffer1: second packet buffer, YMODEM_CORE_PACKET_BUFFER_SIZE bytes.
+ */
+void YmodemCore_InitReceiver(T_YmodemCoreReceiver *receiver, const T_YmodemCoreIo *io,
+                             uint32_t *packetBuffer0, uint32_t *packetBuffer1)
+{
+    receiver->io = io;
+    receiver->packetBuffer[0] = packetBuffer0;
+    receiver->packetBuffer[1] = packetBuffer1;
+    receiver->fileName[0] = '\0';
+    receiver->fileSize = 0;
+    receiver->receivedSize = 0;
+    receiver->startPollIntervalMs = YMODEM_CORE_START_POLL_INTERVAL_MS;
+    receiver->packetTimeoutMs = YMODEM_CORE_PACKET_TIMEOUT_MS;
+    receiver->maxErrorCount = YMODEM_CORE_MAX_ERROR_COUNT;
+    receiver->statistics.packetCount = 0;
+    receiver->statistics.duplicatePacketCount = 0;
+    receiver->statistics.errorCount = 0;
+}
+
+/**
+ * @brief Receive a batch of files, until the sender sends the empty header that closes the session. Retransmitted
+ * packets whose acknowledge got lost are acknowledged again without being written twice. The padding of the last
+ * packet is not written when the sender gave the file size.
+ * @return result of the session, the name and the size of the last file are left in the receiver.
+ */
+E_YmodemCoreResult YmodemCore_Receive(T_YmodemCoreReceiver *receiver)
+{
+    const T_YmodemCoreIo *io = receiver->io;
+    E_YmodemCorePacketType packetType;
+    uint8_t *packet;
+    uint8_t *data;
+    uint32_t packetSize;
+    uint32_t writeSize;
+    uint32_t errorCount = 0;
+    uint8_t bufferIndex = 0;
+    uint8_t expectedNumber = 0;
+    bool sessionBegin = false;
+    bool fileOpened = false;
+
+    YmodemCore_PutByte(receiver, YMODEM_CORE_CRC16);
+
+    while (1) {
+        packet = (uint8_t *) receiver->packetBuffer[bufferIndex];
+        data = &packet[YMODEM_CORE_PACKET_DATA_INDEX];
+
+        packetType = YmodemCore_ReceivePacket(receiver, packet, &packetSize,
+                                              sessionBegin ? receiver->packetTimeoutMs :
+                                              receiver->startPollIntervalMs);
+        switch (packetType) {
+            case YMODEM_CORE_PACKET_DATA:
+                errorCount = 0;
+                receiver->statistics.packetCount++;
+
+                if (sessionBegin && packet[YMODEM_CORE_PACKET_NUMBER_INDEX] == (uint8_t) (expectedNumber - 1)) {
+                    /* our acknowledge got lost, the sender repeats the last packet */
+                    receiver->statistics.duplicatePacketCount++;
+                    YmodemCore_PutByte(receiver, YMODEM_CORE_ACK);
+                    if (expectedNumber == 1) {
+                        YmodemCore_PutByte(receiver, YMODEM_CORE_CRC16);
+                    }
+                    break;
+                }
+                if (packet[YMODEM_CORE_PACKET_NUMBER_INDEX] != expectedNumber) {
+                    receiver->statistics.errorCount++;
+                    YmodemCore_Cancel(receiver, fileOpened);
+                    return YMODEM_CORE_ERROR;
+                }
+
+                if (fileOpened == false) {
+                    /* file header, an empty one ends the session */
+                    if (data[0] == 0) {
+                        YmodemCore_PutByte(receiver, YMODEM_CORE_ACK);
+                        return YMODEM_CORE_OK;
+                    }
+                    if (YmodemCore_ParseHeader(receiver, data, packetSize) == false ||
+                        io->fileOpen(io->userData, receiver->fileName, receiver->fileSize) == false) {
+                        YmodemCore_Cancel(receiver, false);
+                        return YMODEM_CORE_LIMIT;
+                    }
+                    fileOpened = true;
+                    sessionBegin = true;
+                    receiver->receivedSize = 0;
+                    expectedNumber = 1;
+                    YmodemCore_PutByte(receiver, YMODEM_CORE_ACK);
+                    YmodemCore_PutByte(receiver, YMODEM_CORE_CRC16);
+                    break;
+                }
+
+                writeSize = packetSize;
+                if (receiver->fileSize != 0) {
+                    if (receiver->receivedSize >= receiver->fileSize) {
+                        writeSize = 0;
+                    } else if (receiver->fileSize - receiver->receivedSize < writeSize) {
+                        writeSize = receiver->fileSize - receiver->receivedSize;
+                    }
+                }
+                if (writeSize > 0) {
+                    if (io->fileWrite(io->userData, receiver->receivedSize, data, writeSize) == false) {
+                        YmodemCore_Cancel(receiver, true);
+                        return YMODEM_CORE_DATA;
+                    }
+                    /* the storage may still use this buffer, receive the next packet in the other one */
+                    bufferIndex ^= 1;
+                }
+                receiver->receivedSize += writeSize;
+                expectedNumber++;
+                YmodemCore_PutByte(receiver, YMODEM_CORE_ACK);
+                break;
+            case YMODEM_CORE_PACKET_EOT:
+                if (fileOpened == false) {
+                    YmodemCore_PutByte(receiver, YMODEM_CORE_ACK);
+                    break;
+                }
+                fileOpened = false;
+                if (io->fileClose(io->userData, true) == false) {
+                    YmodemCore_Cancel(receiver, false);
+                    return YMODEM_CORE_DATA;
+                }
+                expectedNumber = 0;
+                YmodemCore_PutByte(receiver, YMODEM_CORE_ACK);
+                /* ask for the next file header */
+                YmodemCore_PutByte(receiver, YMODEM_CORE_CRC16);
+                break;
+            case YMODEM_CORE_PACKET_CANCEL:
+                YmodemCore_PutByte(receiver, YMODEM_CORE_ACK);
+                if (fileOpened) {
+                    io->fileClose(io->userData, false);
+                }
+                return YMODEM_CORE_ABORT;
+            case YMODEM_CORE_PACKET_USER_ABORT:
+                YmodemCore_Cancel(receiver, fileOpened);
+                return YMODEM_CORE_ABORT;
+            case YMODEM_CORE_PACKET_TIMEOUT:
+            case YMODEM_CORE_PACKET_ERROR:
+            default:
+                if (sessionBegin == true) {
+                    receiver->statistics.errorCount++;
+                    if (++errorCount > receiver->maxErrorCount) {
+                        YmodemCore_Cancel(receiver, fileOpened);
+                        return YMODEM_CORE_ERROR;
+                    }
+                }
+                if (packetType == YMODEM_CORE_PACKET_ERROR) {
+                    YmodemCore_Purge(receiver, packet);
+                }
+                YmodemCore_PutByte(receiver, expectedNumber == 0 ? YMODEM_CORE_CRC16 : YMODEM_CORE_NAK);
+                break;
+        }
+    }
+}
+
+uint16_t YmodemCore_Crc16(const uint8_t *data, uint32_t size)
+{
+    uint16_t crc = 0;
+
+    while (size--) {
+        crc = (uint16_t) (crc << 8) ^ s_ymodemCoreCrc16Table[(uint8_t) (crc >> 8) ^ *data++];
+    }
+
+    return crc;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static E_YmodemCorePacketType YmodemCore_ReceivePacket(T_YmodemCoreReceiver *receiver, uint8_t *packet,
+                                                       uint32_t *packetSize, uint32_t timeoutMs)
+{
+    const T_YmodemCoreIo *io = receiver->io;
+    uint8_t *start = &packet[YMODEM_CORE_PACKET_START_INDEX];
+    uint16_t crc;
+
+    *packetSize = 0;
+    if (io->read(io->userData, start, 1, timeoutMs) != 1) {
+        return YMODEM_CORE_PACKET_TIMEOUT;
+    }
+
+    switch (*start) {
+        case YMODEM_CORE_SOH:
+            *packetSize = YMODEM_CORE_PACKET_SIZE;
+            break;
+        case YMODEM_CORE_STX:
+            *packetSize = YMODEM_CORE_PACKET_1K_SIZE;
+            break;
+        case YMODEM_CORE_EOT:
+            return YMODEM_CORE_PACKET_EOT;
+        case YMODEM_CORE_CA:
+            if (io->read(io->userData, start, 1, receiver->packetTimeoutMs) == 1 && *start == YMODEM_CORE_CA) {
+                return YMODEM_CORE_PACKET_CANCEL;
+            }
+            return YMODEM_CORE_PACKET_ERROR;
+        case YMODEM_CORE_ABORT1:
+        case YMODEM_CORE_ABORT2:
+            return YMODEM_CORE_PACKET_USER_ABORT;
+        default:
+            return YMODEM_CORE_PACKET_ERROR;
+    }
+
+    if (io->read(io->userData, &packet[YMODEM_CORE_PACKET_NUMBER_INDEX],
+                 *packetSize + YMODEM_CORE_PACKET_OVERHEAD_SIZE, receiver->packetTimeoutMs) !=
+        *packetSize + YMODEM_CORE_PACKET_OVERHEAD_SIZE) {
+        return YMODEM_CORE_PACKET_ERROR;
+    }
+
+    if ((packet[YMODEM_CORE_PACKET_NUMBER_INDEX] ^ packet[YMODEM_CORE_PACKET_CNUMBER_INDEX]) != 0xFF) {
+        return YMODEM_CORE_PACKET_ERROR;
+    }
+
+    crc = (uint16_t) (packet[YMODEM_CORE_PACKET_DATA_INDEX + *packetSize] << 8) |
+          packet[YMODEM_CORE_PACKET_DATA_INDEX + *packetSize + 1];
+    if (YmodemCore_Crc16(&packet[YMODEM_CORE_PACKET_DATA_INDEX], *packetSize) != crc) {
+        return YMODEM_CORE_PACKET_ERROR;
+    }
+
+    return YMODEM_CORE_PACKET_DATA;
+}
+
+static bool YmodemCore_ParseHeader(T_YmodemCoreReceiver *receiver, const uint8_t *data, uint32_t size)
+{
+    uint32_t i = 0;
+    uint32_t fileSize = 0;
+
+    while (i < size && data[i] != '\0' && i < YMODEM_CORE_FILE_NAME_LENGTH) {
+        receiver->fileName[i] = (char) data[i];
+        i++;
+    }
+    receiver->fileName[i] = '\0';
+    while (i < size && data[i] != '\0') {
+        i++;
+    }
+
+    /* decimal size, optionally followed by a space and more attributes */
+    for (i++; i < size && data[i] >= '0' && data[i] <= '9'; i++) {
+        if (fileSize > (UINT32_MAX - 9) / 10) {
+            return false;
+        }
+        fileSize = fileSize * 10 + (uint32_t) (data[i] - '0');
+    }
+    receiver->fileSize = fileSize;
+
+    return true;
+}
+
+static void YmodemCore_PutByte(T_YmodemCoreReceiver *receiver, uint8_t byte)
+{
+    receiver->io->write(receiver->io->userData, &byte, 1);
+}
+
+static void YmodemCore_Purge(T_YmodemCoreReceiver *receiver, uint8_t *buffer)
+{
+    const T_YmodemCoreIo *io = receiver->io;
+
+    /* drop the rest of a broken packet, so that its bytes are not taken as the start of the next one */
+    while (io->read(io->userData, buffer, YMODEM_CORE_PACKET_BUFFER_SIZE, YMODEM_CORE_PURGE_TIMEOUT_MS) > 0) {
+    }
+}
+
+static void YmodemCore_Cancel(T_YmodemCoreReceiver *receiver, bool fileOpened)
+{
+    const uint8_t cancel[] = {YMODEM_CORE_CA, YMODEM_CORE_CA};
+
+    receiver->io->write(receiver->io->userData, cancel, sizeof(cancel));
+    if (fileOpened) {
+        receiver->io->fileClose(receiver->io->userData, false);
+    }
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
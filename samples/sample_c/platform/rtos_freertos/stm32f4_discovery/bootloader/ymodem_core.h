@@ -0,0 +1,101 @@
+/**
+ ********************************************************************
+ * @file    ymodem_core.h
+ * @brief   This is the header file for "ymodem_core.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef YMODEM_CORE_H
+#define YMODEM_CORE_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define YMODEM_CORE_PACKET_SIZE             (128)
+#define YMODEM_CORE_PACKET_1K_SIZE          (1024)
+/* packet buffer: one unused byte, start, number, !number, data, crc high, crc low; data is 4 bytes aligned */
+#define YMODEM_CORE_PACKET_DATA_INDEX       (4)
+#define YMODEM_CORE_PACKET_BUFFER_SIZE      (YMODEM_CORE_PACKET_1K_SIZE + YMODEM_CORE_PACKET_DATA_INDEX + 4)
+#define YMODEM_CORE_FILE_NAME_LENGTH        (64)
+
+/* Exported types ------------------------------------------------------------*/
+typedef enum {
+    YMODEM_CORE_OK = 0,
+    YMODEM_CORE_ERROR,  /*!< too many consecutive errors, the transfer was cancelled */
+    YMODEM_CORE_ABORT,  /*!< cancelled by the sender or by the user */
+    YMODEM_CORE_LIMIT,  /*!< file rejected by fileOpen */
+    YMODEM_CORE_DATA,   /*!< fileWrite or fileClose failed */
+} E_YmodemCoreResult;
+
+/**
+ * @brief Transport and storage of a receiver. The receiver alternates between two packet buffers, the data handed to
+ * fileWrite stays untouched until the next fileWrite or fileClose call returns, so the storage can program it while
+ * the next packet is received, and has to finish with it before accepting the next one.
+ */
+typedef struct {
+    /* read up to size bytes, waiting at most timeoutMs in total, return the number of bytes read */
+    uint32_t (*read)(void *userData, uint8_t *buf, uint32_t size, uint32_t timeoutMs);
+    void (*write)(void *userData, const uint8_t *buf, uint32_t size);
+    /* fileSize is 0 if the sender did not give it, return false to reject the file */
+    bool (*fileOpen)(void *userData, const char *fileName, uint32_t fileSize);
+    bool (*fileWrite)(void *userData, uint32_t offset, const uint8_t *data, uint32_t size);
+    /* complete is false when the transfer stopped before the end of the file */
+    bool (*fileClose)(void *userData, bool complete);
+    void *userData;
+} T_YmodemCoreIo;
+
+typedef struct {
+    uint32_t packetCount;
+    uint32_t duplicatePacketCount;
+    uint32_t errorCount;
+} T_YmodemCoreStatistics;
+
+typedef struct {
+    const T_YmodemCoreIo *io;
+    uint32_t *packetBuffer[2];
+    char fileName[YMODEM_CORE_FILE_NAME_LENGTH + 1];
+    uint32_t fileSize;
+    uint32_t receivedSize;
+    uint32_t startPollIntervalMs;
+    uint32_t packetTimeoutMs;
+    uint32_t maxErrorCount;
+    T_YmodemCoreStatistics statistics;
+} T_YmodemCoreReceiver;
+
+/* Exported functions --------------------------------------------------------*/
+void YmodemCore_InitReceiver(T_YmodemCoreReceiver *receiver, const T_YmodemCoreIo *io,
+                             uint32_t *packetBuffer0, uint32_t *packetBuffer1);
+E_YmodemCoreResult YmodemCore_Receive(T_YmodemCoreReceiver *receiver);
+uint16_t YmodemCore_Crc16(const uint8_t *data, uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // YMODEM_CORE_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
@@ -52,6 +52,23 @@ static uint16_t RingBuf_CutBufSizeToPowOfTwo(uint16_t bufSize)
     return (uint16_t) (1 << (--i));
 }
 
+/**
+ * @brief Get the index an in place producer has written up to from its offset in the buffer.
+ * @note The committed write index is read before the offset, so the producer is never behind it, and it must be less
+ * than a whole buffer ahead of it, which RingBuf_CommitWrite at least every half buffer ensures.
+ * @param pthis Pointer to ring buffer structure.
+ * @param getWriteOffset Function returning the offset of the buffer the producer is writing to.
+ * @param arg Argument passed to getWriteOffset.
+ * @return Index the producer has written up to.
+ */
+static uint16_t RingBuf_GetProducerIndex(T_RingBuffer *pthis, RingBuf_GetWriteOffsetFunc getWriteOffset, void *arg)
+{
+    uint16_t writeIndex = pthis->writeIndex;
+    uint16_t writeOffset = getWriteOffset(arg);
+
+    return (uint16_t) (writeIndex + ((writeOffset - writeIndex) & (pthis->bufferSize - 1)));
+}
+
 /* Exported functions --------------------------------------------------------*/
 
 /**
@@ -128,3 +145,100 @@ uint16_t RingBuf_GetUnusedSize(T_RingBuffer *pthis)
 {
     return (uint16_t) (pthis->bufferSize - pthis->writeIndex + pthis->readIndex);
 }
+
+/**
+ * @brief Get used size of ring buffer.
+ * @param pthis Pointer to ring buffer structure.
+ * @return Used size of ring buffer, larger than the buffer size if an in place producer overran the consumer.
+ */
+uint16_t RingBuf_GetUsedSize(T_RingBuffer *pthis)
+{
+    return (uint16_t) (pthis->writeIndex - pthis->readIndex);
+}
+
+/**
+ * @brief Commit data written in place by an external producer, such as a circular DMA, up to an offset of the buffer.
+ * @note The producer must commit at least every half buffer, otherwise a whole lap can not be told from no data.
+ * @param pthis Pointer to ring buffer structure.
+ * @param writeOffset Offset of the buffer the producer has written up to, the buffer size is the same as 0.
+ * @return Length of data committed.
+ */
+uint16_t RingBuf_CommitWrite(T_RingBuffer *pthis, uint16_t writeOffset)
+{
+    uint16_t dataLen;
+
+    dataLen = (uint16_t) ((writeOffset - pthis->writeIndex) & (pthis->bufferSize - 1));
+    pthis->writeIndex += dataLen;
+
+    return dataLen;
+}
+
+/**
+ * @brief Get a block of data written in place by a producer that can overrun the consumer, such as a circular DMA.
+ * @note The position of the producer is taken before the copy to skip what it has already overwritten, including data
+ * not committed yet, and again after the copy to discard what it overwrote while the data was being copied.
+ * @param pthis Pointer to ring buffer structure.
+ * @param pData Pointer to data to be read.
+ * @param dataLen Length of data to be read.
+ * @param getWriteOffset Function returning the offset of the buffer the producer is writing to.
+ * @param arg Argument passed to getWriteOffset.
+ * @param lostLen Length of data overwritten by the producer before it could be read.
+ * @return Length of data read, all of it intact.
+ */
+uint16_t RingBuf_GetOverrunChecked(T_RingBuffer *pthis, uint8_t *pData, uint16_t dataLen,
+                                   RingBuf_GetWriteOffsetFunc getWriteOffset, void *arg, uint16_t *lostLen)
+{
+    uint16_t producerIndex;
+    uint16_t startIndex;
+    uint16_t overwrittenLen;
+
+    *lostLen = 0;
+
+    producerIndex = RingBuf_GetProducerIndex(pthis, getWriteOffset, arg);
+    if ((uint16_t) (producerIndex - pthis->readIndex) > pthis->bufferSize) {
+        *lostLen = (uint16_t) (producerIndex - pthis->bufferSize - pthis->readIndex);
+        pthis->readIndex = (uint16_t) (producerIndex - pthis->bufferSize);
+    }
+
+    startIndex = pthis->readIndex;
+    dataLen = RingBuf_Get(pthis, pData, dataLen);
+
+    producerIndex = RingBuf_GetProducerIndex(pthis, getWriteOffset, arg);
+    if ((uint16_t) (producerIndex - startIndex) > pthis->bufferSize) {
+        overwrittenLen = RINGBUF_MIN((uint16_t) (producerIndex - pthis->bufferSize - startIndex), dataLen);
+        memmove(pData, pData + overwrittenLen, dataLen - overwrittenLen);
+        dataLen -= overwrittenLen;
+        *lostLen += overwrittenLen;
+    }
+
+    return dataLen;
+}
+
+/**
+ * @brief Get the data that can be read in place without wrapping, such as by a transmit DMA.
+ * @param pthis Pointer to ring buffer structure.
+ * @param pData Pointer to the first byte to be read.
+ * @return Length of data readable in place, release it with RingBuf_Skip once consumed.
+ */
+uint16_t RingBuf_GetLinearReadBlock(T_RingBuffer *pthis, uint8_t **pData)
+{
+    uint16_t readOffset = (uint16_t) (pthis->readIndex & (pthis->bufferSize - 1));
+
+    *pData = pthis->bufferPtr + readOffset;
+
+    return RINGBUF_MIN((uint16_t) (pthis->writeIndex - pthis->readIndex), (uint16_t) (pthis->bufferSize - readOffset));
+}
+
+/**
+ * @brief Release data from ring buffer without copying it.
+ * @param pthis Pointer to ring buffer structure.
+ * @param dataLen Length of data to be released.
+ * @return Length of data released.
+ */
+uint16_t RingBuf_Skip(T_RingBuffer *pthis, uint16_t dataLen)
+{
+    dataLen = RINGBUF_MIN(dataLen, (uint16_t) (pthis->writeIndex - pthis->readIndex));
+    pthis->readIndex += dataLen;
+
+    return dataLen;
+}
@@ -37,6 +37,10 @@
 
 //Note: not need lock for just one producer / one consumer
 //need mutex to protect for multi-producer / multi-consumer
+//The buffer can also be filled in place by a circular DMA, the producer then only commits the DMA position
+//with RingBuf_CommitWrite and the consumer reads with RingBuf_GetOverrunChecked, and drained in place by a DMA with
+//RingBuf_GetLinearReadBlock and RingBuf_Skip.
+//This file has no dependency on the MCU so the index logic can be built and checked on a host.
 
 typedef struct _ringBuffer {
     uint8_t *bufferPtr;
@@ -46,6 +50,9 @@ typedef struct _ringBuffer {
     uint16_t writeIndex;
 } T_RingBuffer;
 
+//Returns the offset of the buffer an in place producer is writing to, the buffer size is the same as 0.
+typedef uint16_t (*RingBuf_GetWriteOffsetFunc)(void *arg);
+
 /* Exported variables --------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
@@ -53,6 +60,12 @@ void RingBuf_Init(T_RingBuffer *pthis, uint8_t *pBuf, uint16_t bufSize);
 uint16_t RingBuf_Put(T_RingBuffer *pthis, const uint8_t *pData, uint16_t dataLen);
 uint16_t RingBuf_Get(T_RingBuffer *pthis, uint8_t *pData, uint16_t dataLen);
 uint16_t RingBuf_GetUnusedSize(T_RingBuffer *pthis);
+uint16_t RingBuf_GetUsedSize(T_RingBuffer *pthis);
+uint16_t RingBuf_CommitWrite(T_RingBuffer *pthis, uint16_t writeOffset);
+uint16_t RingBuf_GetOverrunChecked(T_RingBuffer *pthis, uint8_t *pData, uint16_t dataLen,
+                                   RingBuf_GetWriteOffsetFunc getWriteOffset, void *arg, uint16_t *lostLen);
+uint16_t RingBuf_GetLinearReadBlock(T_RingBuffer *pthis, uint8_t **pData);
+uint16_t RingBuf_Skip(T_RingBuffer *pthis, uint16_t dataLen);
 
 /* Private constants ---------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
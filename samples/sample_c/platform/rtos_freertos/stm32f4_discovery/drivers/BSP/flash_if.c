@@ -104,6 +104,22 @@ out:
     return ret;
 }
 
+/**
+  * @brief  Returns the last address of the sector holding a given address
+  * @param  Address: Flash address
+  * @retval Last address of the sector
+  */
+uint32_t FLASH_If_GetSectorEndAddress(uint32_t Address)
+{
+    static const uint32_t sectorEndAddress[] = {
+        ADDR_FLASH_SECTOR_1 - 1, ADDR_FLASH_SECTOR_2 - 1, ADDR_FLASH_SECTOR_3 - 1, ADDR_FLASH_SECTOR_4 - 1,
+        ADDR_FLASH_SECTOR_5 - 1, ADDR_FLASH_SECTOR_6 - 1, ADDR_FLASH_SECTOR_7 - 1, ADDR_FLASH_SECTOR_8 - 1,
+        ADDR_FLASH_SECTOR_9 - 1, ADDR_FLASH_SECTOR_10 - 1, ADDR_FLASH_SECTOR_11 - 1, FLASH_END_ADDRESS,
+    };
+
+    return sectorEndAddress[GetSector(Address)];
+}
+
 /**
   * @brief  This function writes a data buffer in flash (data are 32-bit aligned).
   * @note   After writing data buffer, the flash content is checked.
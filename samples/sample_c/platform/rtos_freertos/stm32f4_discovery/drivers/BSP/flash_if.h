@@ -110,6 +110,7 @@ enum {
 /* Exported functions ------------------------------------------------------- */
 void FLASH_If_Init(void);
 uint32_t FLASH_If_Erase(uint32_t StartAddress, uint32_t endAddress);
+uint32_t FLASH_If_GetSectorEndAddress(uint32_t Address);
 uint32_t FLASH_If_Write(uint32_t FlashAddress, const uint8_t *Data, uint32_t DataLength);
 uint16_t FLASH_If_GetWriteProtectionStatus(void);
 HAL_StatusTypeDef FLASH_If_WriteProtectionConfig(uint32_t modifier);
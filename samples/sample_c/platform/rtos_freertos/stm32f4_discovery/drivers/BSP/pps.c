@@ -42,7 +42,7 @@
 /* Private types -------------------------------------------------------------*/
 
 /* Private values -------------------------------------------------------------*/
-static uint64_t s_ppsNewestTriggerLocalTimeMs = 0;
+static volatile uint64_t s_ppsNewestTriggerLocalTimeUs = 0;
 
 /* Private functions declaration ---------------------------------------------*/
 
@@ -50,30 +50,37 @@ static uint64_t s_ppsNewestTriggerLocalTimeMs = 0;
 void DjiTest_PpsIrqHandler(void)
 {
     T_DjiReturnCode psdkStat;
-    uint32_t timeMs = 0;
+    uint64_t timeUs = 0;
 
     /* EXTI line interrupt detected */
     if (__HAL_GPIO_EXTI_GET_IT(PPS_PIN) != RESET) {
         __HAL_GPIO_EXTI_CLEAR_IT(PPS_PIN);
-        psdkStat = Osal_GetTimeMs(&timeMs);
+        psdkStat = Osal_GetTimeUs(&timeUs);
         if (psdkStat == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
-            s_ppsNewestTriggerLocalTimeMs = timeMs;
+            s_ppsNewestTriggerLocalTimeUs = timeUs;
     }
 }
 
 T_DjiReturnCode DjiTest_GetNewestPpsTriggerLocalTimeUs(uint64_t *localTimeUs)
 {
+    uint64_t triggerTimeUs;
+
     if (localTimeUs == NULL) {
         USER_LOG_ERROR("input pointer is null.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
     }
 
-    if (s_ppsNewestTriggerLocalTimeMs == 0) {
+    /* 64-bit value written by the interrupt, read it with the interrupt masked */
+    HAL_NVIC_DisableIRQ(PPS_IRQn);
+    triggerTimeUs = s_ppsNewestTriggerLocalTimeUs;
+    HAL_NVIC_EnableIRQ(PPS_IRQn);
+
+    if (triggerTimeUs == 0) {
         USER_LOG_WARN("pps have not been triggered.");
         return DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
     }
 
-    *localTimeUs = (uint64_t) (s_ppsNewestTriggerLocalTimeMs * 1000);
+    *localTimeUs = triggerTimeUs;
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
@@ -33,65 +33,108 @@
 #include "osal.h"
 
 /* Private typedef -----------------------------------------------------------*/
+typedef struct {
+    USART_TypeDef *instance;
+    DMA_Stream_TypeDef *rxDmaStream;
+    uint32_t rxDmaChannel;
+    IRQn_Type rxDmaIrq;
+    DMA_Stream_TypeDef *txDmaStream;
+    uint32_t txDmaChannel;
+    IRQn_Type txDmaIrq;
+    uint8_t *readBuf;
+    uint16_t readBufSize;
+    uint8_t *writeBuf;
+    uint16_t writeBufSize;
+} T_UartPortConfig;
+
+typedef struct {
+    UART_HandleTypeDef uartHandle;
+    DMA_HandleTypeDef rxDmaHandle;
+    DMA_HandleTypeDef txDmaHandle;
+    //read ring buffer, filled in place by the circular rx DMA
+    T_RingBuffer readRingBuffer;
+    T_UartBufferState readBufferState;
+    //write ring buffer, drained in place by the tx DMA
+    T_RingBuffer writeRingBuffer;
+    T_UartBufferState writeBufferState;
+    //length of the write ring buffer block being sent by the tx DMA, 0 if the tx DMA is idle
+    volatile uint16_t txDmaLen;
+    //the HAL refused to start the tx DMA on data of the write ring buffer, retried by UART_RetryTransmit
+    volatile bool isTxDmaRetryPending;
+    //task waiting for data in UART_ReadWait, notified from the rx event interrupt
+    TaskHandle_t volatile readWaitTask;
+    T_DjiMutexHandle mutex;
+} T_UartPort;
 
 /* Private define ------------------------------------------------------------*/
-//uart uart buffer size define
+//uart uart buffer size define, power of 2 as the DMA runs on the whole ring buffer
 #define UART1_READ_BUF_SIZE      64
 #define UART1_WRITE_BUF_SIZE     64
-#define UART2_READ_BUF_SIZE      64
+//console, holds a whole 1K YMODEM packet so the bootloader can program flash while the next one arrives
+#define UART2_READ_BUF_SIZE      2048
 #define UART2_WRITE_BUF_SIZE     2048
 #define UART3_READ_BUF_SIZE      8192
 #define UART3_WRITE_BUF_SIZE     2048
 
+#define UART_CONSOLE_TIMEOUT_MS  0xFFFF
+
+#define UART_DMA_IRQ_PRIO_PRE    5
+#define UART_DMA_IRQ_PRIO_SUB    0
+
 /* Private macro -------------------------------------------------------------*/
+//Masks the UART and DMA interrupts around the tx DMA hand over, usable from tasks, interrupts and without scheduler.
+#define UART_ENTER_CRITICAL(primask)    do { (primask) = __get_PRIMASK(); __disable_irq(); } while (0)
+#define UART_EXIT_CRITICAL(primask)     __set_PRIMASK(primask)
 
 /* Private variables ---------------------------------------------------------*/
+//DMA can not access the CCM RAM, the UART buffers stay in the main SRAM: 14464 bytes for the three ports. With the
+//90000 bytes FreeRTOS heap and the 4096 bytes of main stack and newlib heap checked by the linker script, this leaves
+//22512 bytes of the 128K SRAM for the other data and bss, the link fails with "region RAM overflowed" otherwise.
 #ifdef USING_UART_PORT_1
-//UART1 read ring buffer structure
-static T_RingBuffer s_uart1ReadRingBuffer;
-//USART1 read buffer state
-static T_UartBufferState s_uart1ReadBufferState;
-//UART1 write ring buffer structure
-static T_RingBuffer s_uart1WriteRingBuffer;
-//USART1 write buffer state
-static T_UartBufferState s_uart1WriteBufferState;
 //UART1 read buffer
-CCMRAM static uint8_t s_uart1ReadBuf[UART1_READ_BUF_SIZE];
+static uint8_t s_uart1ReadBuf[UART1_READ_BUF_SIZE];
 //UART1 write buffer
-CCMRAM static uint8_t s_uart1WriteBuf[UART1_WRITE_BUF_SIZE];
-
-//UART1 mutex
-static T_DjiMutexHandle s_uart1Mutex;
-//USART1 handle
-static UART_HandleTypeDef s_uart1Handle;
+static uint8_t s_uart1WriteBuf[UART1_WRITE_BUF_SIZE];
+//UART1 port, USART1 rx on DMA2 stream 2 and tx on DMA2 stream 7, channel 4
+static T_UartPort s_uart1Port;
+static const T_UartPortConfig s_uart1PortConfig = {
+    USART1, DMA2_Stream2, DMA_CHANNEL_4, DMA2_Stream2_IRQn, DMA2_Stream7, DMA_CHANNEL_4, DMA2_Stream7_IRQn,
+    s_uart1ReadBuf, UART1_READ_BUF_SIZE, s_uart1WriteBuf, UART1_WRITE_BUF_SIZE,
+};
 #endif
 
 #ifdef USING_UART_PORT_2
-static T_RingBuffer s_uart2ReadRingBuffer;
-static T_UartBufferState s_uart2ReadBufferState;
-static T_RingBuffer s_uart2WriteRingBuffer;
-static T_UartBufferState s_uart2WriteBufferState;
-CCMRAM static uint8_t s_uart2ReadBuf[UART2_READ_BUF_SIZE];
-CCMRAM static uint8_t s_uart2WriteBuf[UART2_WRITE_BUF_SIZE];
-
-static T_DjiMutexHandle s_uart2Mutex;
-static UART_HandleTypeDef s_uart2Handle;
+static uint8_t s_uart2ReadBuf[UART2_READ_BUF_SIZE];
+static uint8_t s_uart2WriteBuf[UART2_WRITE_BUF_SIZE];
+//UART2 port, USART2 rx on DMA1 stream 5 and tx on DMA1 stream 6, channel 4
+static T_UartPort s_uart2Port;
+static const T_UartPortConfig s_uart2PortConfig = {
+    USART2, DMA1_Stream5, DMA_CHANNEL_4, DMA1_Stream5_IRQn, DMA1_Stream6, DMA_CHANNEL_4, DMA1_Stream6_IRQn,
+    s_uart2ReadBuf, UART2_READ_BUF_SIZE, s_uart2WriteBuf, UART2_WRITE_BUF_SIZE,
+};
 #endif
 
 #ifdef USING_UART_PORT_3
-static T_RingBuffer s_uart3ReadRingBuffer;
-static T_UartBufferState s_uart3ReadBufferState;
-static T_RingBuffer s_uart3WriteRingBuffer;
-static T_UartBufferState s_uart3WriteBufferState;
-CCMRAM static uint8_t s_uart3ReadBuf[UART3_READ_BUF_SIZE];
-CCMRAM static uint8_t s_uart3WriteBuf[UART3_WRITE_BUF_SIZE];
-
-static T_DjiMutexHandle s_uart3Mutex;
-static UART_HandleTypeDef s_uart3Handle;
+static uint8_t s_uart3ReadBuf[UART3_READ_BUF_SIZE];
+static uint8_t s_uart3WriteBuf[UART3_WRITE_BUF_SIZE];
+//UART3 port, USART3 rx on DMA1 stream 1 and tx on DMA1 stream 3, channel 4
+static T_UartPort s_uart3Port;
+static const T_UartPortConfig s_uart3PortConfig = {
+    USART3, DMA1_Stream1, DMA_CHANNEL_4, DMA1_Stream1_IRQn, DMA1_Stream3, DMA_CHANNEL_4, DMA1_Stream3_IRQn,
+    s_uart3ReadBuf, UART3_READ_BUF_SIZE, s_uart3WriteBuf, UART3_WRITE_BUF_SIZE,
+};
 #endif
 
 /* Exported variables --------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static T_UartPort *UART_GetPort(E_UartNum uartNum);
+static T_UartPort *UART_GetPortByHandle(const UART_HandleTypeDef *huart);
+static void UART_PortInit(T_UartPort *port, const T_UartPortConfig *config, uint32_t baudRate);
+static void UART_StartTransmitDma(T_UartPort *port);
+static uint16_t UART_GetRxDmaWriteOffset(void *arg);
+static void UART_UpdateMaxUsedCapacity(T_UartBufferState *bufferState, uint16_t usedCapacityOfBuffer);
+static void UART_ConsoleTransmit(T_UartPort *port, uint8_t ch);
+
 /* Private functions ---------------------------------------------------------*/
 /* Exported functions --------------------------------------------------------*/
 
@@ -106,65 +149,20 @@ void UART_Init(E_UartNum uartNum, uint32_t baudRate)
     switch (uartNum) {
 
 #ifdef USING_UART_PORT_1
-        case UART_NUM_1: {
-            RingBuf_Init(&s_uart1ReadRingBuffer, s_uart1ReadBuf, UART1_READ_BUF_SIZE);
-            RingBuf_Init(&s_uart1WriteRingBuffer, s_uart1WriteBuf, UART1_WRITE_BUF_SIZE);
-
-            s_uart1Handle.Instance = USART1;
-            s_uart1Handle.Init.BaudRate = baudRate;
-            s_uart1Handle.Init.WordLength = UART_WORDLENGTH_8B;
-            s_uart1Handle.Init.StopBits = UART_STOPBITS_1;
-            s_uart1Handle.Init.Parity = UART_PARITY_NONE;
-            s_uart1Handle.Init.HwFlowCtl = UART_HWCONTROL_NONE;
-            s_uart1Handle.Init.Mode = UART_MODE_TX_RX;
-            s_uart1Handle.Init.OverSampling = UART_OVERSAMPLING_16;
-            HAL_UART_Init(&s_uart1Handle);
-            __HAL_UART_ENABLE_IT(&s_uart1Handle, UART_IT_RXNE);
-
-            Osal_MutexCreate(&s_uart1Mutex);
-        }
+        case UART_NUM_1:
+            UART_PortInit(&s_uart1Port, &s_uart1PortConfig, baudRate);
             break;
 #endif
 
 #ifdef USING_UART_PORT_2
-        case UART_NUM_2: {
-            RingBuf_Init(&s_uart2ReadRingBuffer, s_uart2ReadBuf, UART2_READ_BUF_SIZE);
-            RingBuf_Init(&s_uart2WriteRingBuffer, s_uart2WriteBuf, UART2_WRITE_BUF_SIZE);
-
-            s_uart2Handle.Instance = USART2;
-            s_uart2Handle.Init.BaudRate = baudRate;
-            s_uart2Handle.Init.WordLength = UART_WORDLENGTH_8B;
-            s_uart2Handle.Init.StopBits = UART_STOPBITS_1;
-            s_uart2Handle.Init.Parity = UART_PARITY_NONE;
-            s_uart2Handle.Init.HwFlowCtl = UART_HWCONTROL_NONE;
-            s_uart2Handle.Init.Mode = UART_MODE_TX_RX;
-            s_uart2Handle.Init.OverSampling = UART_OVERSAMPLING_16;
-            HAL_UART_Init(&s_uart2Handle);
-            __HAL_UART_ENABLE_IT(&s_uart2Handle, UART_IT_RXNE);
-
-            Osal_MutexCreate(&s_uart2Mutex);
-        }
+        case UART_NUM_2:
+            UART_PortInit(&s_uart2Port, &s_uart2PortConfig, baudRate);
             break;
 #endif
 
 #ifdef USING_UART_PORT_3
-        case UART_NUM_3: {
-            RingBuf_Init(&s_uart3ReadRingBuffer, s_uart3ReadBuf, UART3_READ_BUF_SIZE);
-            RingBuf_Init(&s_uart3WriteRingBuffer, s_uart3WriteBuf, UART3_WRITE_BUF_SIZE);
-
-            s_uart3Handle.Instance = USART3;
-            s_uart3Handle.Init.BaudRate = baudRate;
-            s_uart3Handle.Init.WordLength = UART_WORDLENGTH_8B;
-            s_uart3Handle.Init.StopBits = UART_STOPBITS_1;
-            s_uart3Handle.Init.Parity = UART_PARITY_NONE;
-            s_uart3Handle.Init.HwFlowCtl = UART_HWCONTROL_NONE;
-            s_uart3Handle.Init.Mode = UART_MODE_TX_RX;
-            s_uart3Handle.Init.OverSampling = UART_OVERSAMPLING_16;
-            HAL_UART_Init(&s_uart3Handle);
-            __HAL_UART_ENABLE_IT(&s_uart3Handle, UART_IT_RXNE);
-
-            Osal_MutexCreate(&s_uart3Mutex);
-        }
+        case UART_NUM_3:
+            UART_PortInit(&s_uart3Port, &s_uart3PortConfig, baudRate);
             break;
 #endif
 
@@ -182,42 +180,60 @@ void UART_Init(E_UartNum uartNum, uint32_t baudRate)
  */
 int UART_Read(E_UartNum uartNum, uint8_t *buf, uint16_t readSize)
 {
+    T_UartPort *port = UART_GetPort(uartNum);
     uint16_t readRealSize;
+    uint16_t lostSize;
 
-    switch (uartNum) {
+    if (port == NULL) {
+        return UART_ERROR;
+    }
 
-#ifdef USING_UART_PORT_1
-        case UART_NUM_1: {
-            Osal_MutexLock(s_uart1Mutex);
-            readRealSize = RingBuf_Get(&s_uart1ReadRingBuffer, buf, readSize);
-            Osal_MutexUnlock(s_uart1Mutex);
-        }
-            break;
-#endif
+    Osal_MutexLock(port->mutex);
+    UART_UpdateMaxUsedCapacity(&port->readBufferState, RingBuf_GetUsedSize(&port->readRingBuffer));
+    readRealSize = RingBuf_GetOverrunChecked(&port->readRingBuffer, buf, readSize, UART_GetRxDmaWriteOffset, port,
+                                             &lostSize);
+    port->readBufferState.countOfLostData += lostSize;
+    if (port->isTxDmaRetryPending) {
+        UART_StartTransmitDma(port);
+    }
+    Osal_MutexUnlock(port->mutex);
 
-#ifdef USING_UART_PORT_2
-        case UART_NUM_2: {
-            Osal_MutexLock(s_uart2Mutex);
-            readRealSize = RingBuf_Get(&s_uart2ReadRingBuffer, buf, readSize);
-            Osal_MutexUnlock(s_uart2Mutex);
-        }
-            break;
-#endif
+    return readRealSize;
+}
 
-#ifdef USING_UART_PORT_3
-        case UART_NUM_3: {
-            Osal_MutexLock(s_uart3Mutex);
-            readRealSize = RingBuf_Get(&s_uart3ReadRingBuffer, buf, readSize);
-            Osal_MutexUnlock(s_uart3Mutex);
-        }
-            break;
-#endif
+/**
+ * @brief Read UART data, waiting for data to arrive if there is none.
+ * @note The calling task is woken by a task notification from the rx event interrupt, the notification of the task
+ * must not be used for anything else.
+ * @param uartNum UART number.
+ * @param buf Pointer to buffer used to store data.
+ * @param readSize Size of data to be read.
+ * @param timeoutMs Max time to wait for data, unit: ms.
+ * @return Size of data read actually, 0 if no data arrived before the timeout.
+ */
+int UART_ReadWait(E_UartNum uartNum, uint8_t *buf, uint16_t readSize, uint32_t timeoutMs)
+{
+    T_UartPort *port = UART_GetPort(uartNum);
+    int readRealSize;
 
-        default:
-            return UART_ERROR;
+    if (port == NULL) {
+        return UART_ERROR;
     }
 
-    return readRealSize;
+    readRealSize = UART_Read(uartNum, buf, readSize);
+    if (readRealSize != 0 || timeoutMs == 0) {
+        return readRealSize;
+    }
+
+    // Register before checking again, data committed after the check then notifies the task instead of being missed.
+    port->readWaitTask = xTaskGetCurrentTaskHandle();
+    (void) ulTaskNotifyTake(pdTRUE, 0);
+    if (RingBuf_GetUsedSize(&port->readRingBuffer) == 0) {
+        (void) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs));
+    }
+    port->readWaitTask = NULL;
+
+    return UART_Read(uartNum, buf, readSize);
 }
 
 /**
@@ -229,87 +245,92 @@ int UART_Read(E_UartNum uartNum, uint8_t *buf, uint16_t readSize)
  */
 int UART_Write(E_UartNum uartNum, const uint8_t *buf, uint16_t writeSize)
 {
+    T_UartPort *port = UART_GetPort(uartNum);
     int writeRealLen;
-    uint16_t usedCapacityOfBuffer = 0;
 
-    switch (uartNum) {
+    if (port == NULL) {
+        return UART_ERROR;
+    }
+
+    Osal_MutexLock(port->mutex);
+    writeRealLen = RingBuf_Put(&port->writeRingBuffer, buf, writeSize);
+    UART_UpdateMaxUsedCapacity(&port->writeBufferState, RingBuf_GetUsedSize(&port->writeRingBuffer));
+    port->writeBufferState.countOfLostData += writeSize - writeRealLen;
+    UART_StartTransmitDma(port);
+    Osal_MutexUnlock(port->mutex);
 
+    return writeRealLen;
+}
+
+/**
+ * @brief Restart the tx DMA of the ports where the HAL refused to start it, so data left in a write ring buffer is not
+ * stuck until the next write. Called periodically, from a task or from the tick interrupt.
+ * @return None.
+ */
+void UART_RetryTransmit(void)
+{
 #ifdef USING_UART_PORT_1
-        case UART_NUM_1: {
-            Osal_MutexLock(s_uart1Mutex);
-            writeRealLen = RingBuf_Put(&s_uart1WriteRingBuffer, buf, writeSize);
-            __HAL_UART_ENABLE_IT(&s_uart1Handle, UART_IT_TXE);
-            usedCapacityOfBuffer = UART1_WRITE_BUF_SIZE - RingBuf_GetUnusedSize(&s_uart1WriteRingBuffer);
-            s_uart1WriteBufferState.maxUsedCapacityOfBuffer =
-                usedCapacityOfBuffer > s_uart1WriteBufferState.maxUsedCapacityOfBuffer ? usedCapacityOfBuffer
-                                                                                       : s_uart1WriteBufferState.maxUsedCapacityOfBuffer;
-            s_uart1WriteBufferState.countOfLostData += writeSize - writeRealLen;
-            Osal_MutexUnlock(s_uart1Mutex);
-        }
-            break;
+    if (s_uart1Port.isTxDmaRetryPending) {
+        UART_StartTransmitDma(&s_uart1Port);
+    }
 #endif
-
 #ifdef USING_UART_PORT_2
-        case UART_NUM_2: {
-            Osal_MutexLock(s_uart2Mutex);
-            writeRealLen = RingBuf_Put(&s_uart2WriteRingBuffer, buf, writeSize);
-            __HAL_UART_ENABLE_IT(&s_uart2Handle, UART_IT_TXE);
-            usedCapacityOfBuffer = UART2_WRITE_BUF_SIZE - RingBuf_GetUnusedSize(&s_uart2WriteRingBuffer);
-            s_uart2WriteBufferState.maxUsedCapacityOfBuffer =
-                usedCapacityOfBuffer > s_uart2WriteBufferState.maxUsedCapacityOfBuffer ? usedCapacityOfBuffer
-                                                                                       : s_uart2WriteBufferState.maxUsedCapacityOfBuffer;
-            s_uart2WriteBufferState.countOfLostData += writeSize - writeRealLen;
-            Osal_MutexUnlock(s_uart2Mutex);
-        }
-            break;
+    if (s_uart2Port.isTxDmaRetryPending) {
+        UART_StartTransmitDma(&s_uart2Port);
+    }
 #endif
-
 #ifdef USING_UART_PORT_3
-        case UART_NUM_3: {
-            Osal_MutexLock(s_uart3Mutex);
-            writeRealLen = RingBuf_Put(&s_uart3WriteRingBuffer, buf, writeSize);
-            __HAL_UART_ENABLE_IT(&s_uart3Handle, UART_IT_TXE);
-            usedCapacityOfBuffer = UART3_WRITE_BUF_SIZE - RingBuf_GetUnusedSize(&s_uart3WriteRingBuffer);
-            s_uart3WriteBufferState.maxUsedCapacityOfBuffer =
-                usedCapacityOfBuffer > s_uart3WriteBufferState.maxUsedCapacityOfBuffer ? usedCapacityOfBuffer
-                                                                                       : s_uart3WriteBufferState.maxUsedCapacityOfBuffer;
-            s_uart3WriteBufferState.countOfLostData += writeSize - writeRealLen;
-            Osal_MutexUnlock(s_uart3Mutex);
-        }
-            break;
+    if (s_uart3Port.isTxDmaRetryPending) {
+        UART_StartTransmitDma(&s_uart3Port);
+    }
 #endif
+}
 
-        default:
-            return UART_ERROR;
+void UART_GetBufferState(E_UartNum uartNum, T_UartBufferState *readBufferState, T_UartBufferState *writeBufferState)
+{
+    T_UartPort *port = UART_GetPort(uartNum);
+
+    if (port == NULL) {
+        return;
     }
 
-    return writeRealLen;
+    memcpy(readBufferState, &port->readBufferState, sizeof(T_UartBufferState));
+    memcpy(writeBufferState, &port->writeBufferState, sizeof(T_UartBufferState));
 }
 
-void UART_GetBufferState(E_UartNum uartNum, T_UartBufferState *readBufferState, T_UartBufferState *writeBufferState)
+/**
+ * @brief Rx event callback of the HAL, called from the DMA half transfer and transfer complete interrupts and from the
+ * UART idle line interrupt with the offset of the read ring buffer the rx DMA has written up to.
+ */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
 {
-    switch (uartNum) {
-#ifdef USING_UART_PORT_1
-        case UART_NUM_1:
-            memcpy(readBufferState, &s_uart1ReadBufferState, sizeof(T_UartBufferState));
-            memcpy(writeBufferState, &s_uart1WriteBufferState, sizeof(T_UartBufferState));
-            break;
-#endif
-#ifdef USING_UART_PORT_2
-        case UART_NUM_2:
-            memcpy(readBufferState, &s_uart2ReadBufferState, sizeof(T_UartBufferState));
-            memcpy(writeBufferState, &s_uart2WriteBufferState, sizeof(T_UartBufferState));
-            break;
-#endif
-#ifdef USING_UART_PORT_3
-        case UART_NUM_3:
-            memcpy(readBufferState, &s_uart3ReadBufferState, sizeof(T_UartBufferState));
-            memcpy(writeBufferState, &s_uart3WriteBufferState, sizeof(T_UartBufferState));
-            break;
-#endif
-        default:
-            break;
+    T_UartPort *port = UART_GetPortByHandle(huart);
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+
+    if (port == NULL) {
+        return;
+    }
+
+    if (RingBuf_CommitWrite(&port->readRingBuffer, Size) != 0 && port->readWaitTask != NULL) {
+        vTaskNotifyGiveFromISR(port->readWaitTask, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+}
+
+/**
+ * @brief Tx complete callback of the HAL, releases the block sent and chains the next one of the write ring buffer.
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+    T_UartPort *port = UART_GetPortByHandle(huart);
+
+    if (port == NULL) {
+        return;
     }
+
+    RingBuf_Skip(&port->writeRingBuffer, port->txDmaLen);
+    port->txDmaLen = 0;
+    UART_StartTransmitDma(port);
 }
 
 /**
@@ -319,30 +340,17 @@ void UART_GetBufferState(E_UartNum uartNum, T_UartBufferState *readBufferState,
 
 void USART1_IRQHandler(void)
 {
-    uint8_t data;
-    uint16_t usedCapacityOfBuffer = 0;
-    uint16_t realCountPutBuffer = 0;
-
-    if (__HAL_UART_GET_IT_SOURCE(&s_uart1Handle, UART_IT_RXNE) != RESET &&
-        __HAL_UART_GET_FLAG(&s_uart1Handle, UART_FLAG_RXNE) != RESET) {
-        data = (uint8_t) ((uint16_t) (s_uart1Handle.Instance->DR & (uint16_t) 0x01FF) & (uint16_t) 0x00FF);
-        realCountPutBuffer = RingBuf_Put(&s_uart1ReadRingBuffer, &data, 1);
-        usedCapacityOfBuffer = UART1_READ_BUF_SIZE - RingBuf_GetUnusedSize(&s_uart1ReadRingBuffer);
-        s_uart1ReadBufferState.maxUsedCapacityOfBuffer =
-            usedCapacityOfBuffer > s_uart1ReadBufferState.maxUsedCapacityOfBuffer ? usedCapacityOfBuffer
-                                                                                  : s_uart1ReadBufferState.maxUsedCapacityOfBuffer;
-        s_uart1ReadBufferState.countOfLostData += 1 - realCountPutBuffer;
-    }
+    HAL_UART_IRQHandler(&s_uart1Port.uartHandle);
+}
 
-    if (__HAL_UART_GET_IT_SOURCE(&s_uart1Handle, UART_IT_TXE) != RESET &&
-        __HAL_UART_GET_FLAG(&s_uart1Handle, UART_FLAG_TXE) != RESET) {
-        if (RingBuf_Get(&s_uart1WriteRingBuffer, &data, 1)) {
-            /* Transmit Data */
-            s_uart1Handle.Instance->DR = ((uint16_t) data & (uint16_t) 0x01FF);
-        } else {
-            __HAL_UART_DISABLE_IT(&s_uart1Handle, UART_IT_TXE);
-        }
-    }
+void DMA2_Stream2_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&s_uart1Port.rxDmaHandle);
+}
+
+void DMA2_Stream7_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&s_uart1Port.txDmaHandle);
 }
 
 #endif
@@ -354,30 +362,17 @@ void USART1_IRQHandler(void)
 
 void USART2_IRQHandler(void)
 {
-    uint8_t data;
-    uint16_t usedCapacityOfBuffer = 0;
-    uint16_t realCountPutBuffer = 0;
-
-    if (__HAL_UART_GET_IT_SOURCE(&s_uart2Handle, UART_IT_RXNE) != RESET &&
-        __HAL_UART_GET_FLAG(&s_uart2Handle, UART_FLAG_RXNE) != RESET) {
-        data = (uint8_t) ((uint16_t) (s_uart2Handle.Instance->DR & (uint16_t) 0x01FF) & (uint16_t) 0x00FF);
-        realCountPutBuffer = RingBuf_Put(&s_uart2ReadRingBuffer, &data, 1);
-        usedCapacityOfBuffer = UART2_READ_BUF_SIZE - RingBuf_GetUnusedSize(&s_uart2ReadRingBuffer);
-        s_uart2ReadBufferState.maxUsedCapacityOfBuffer =
-            usedCapacityOfBuffer > s_uart2ReadBufferState.maxUsedCapacityOfBuffer ? usedCapacityOfBuffer
-                                                                                  : s_uart2ReadBufferState.maxUsedCapacityOfBuffer;
-        s_uart2ReadBufferState.countOfLostData += 1 - realCountPutBuffer;
-    }
+    HAL_UART_IRQHandler(&s_uart2Port.uartHandle);
+}
 
-    if (__HAL_UART_GET_IT_SOURCE(&s_uart2Handle, UART_IT_TXE) != RESET &&
-        __HAL_UART_GET_FLAG(&s_uart2Handle, UART_FLAG_TXE) != RESET) {
-        if (RingBuf_Get(&s_uart2WriteRingBuffer, &data, 1)) {
-            /* Transmit Data */
-            s_uart2Handle.Instance->DR = ((uint16_t) data & (uint16_t) 0x01FF);
-        } else {
-            __HAL_UART_DISABLE_IT(&s_uart2Handle, UART_IT_TXE);
-        }
-    }
+void DMA1_Stream5_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&s_uart2Port.rxDmaHandle);
+}
+
+void DMA1_Stream6_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&s_uart2Port.txDmaHandle);
 }
 
 #endif
@@ -389,30 +384,17 @@ void USART2_IRQHandler(void)
 
 void USART3_IRQHandler(void)
 {
-    uint8_t data;
-    uint16_t usedCapacityOfBuffer = 0;
-    uint16_t realCountPutBuffer = 0;
-
-    if (__HAL_UART_GET_IT_SOURCE(&s_uart3Handle, UART_IT_RXNE) != RESET &&
-        __HAL_UART_GET_FLAG(&s_uart3Handle, UART_FLAG_RXNE) != RESET) {
-        data = (uint8_t) ((uint16_t) (s_uart3Handle.Instance->DR & (uint16_t) 0x01FF) & (uint16_t) 0x00FF);
-        realCountPutBuffer = RingBuf_Put(&s_uart3ReadRingBuffer, &data, 1);
-        usedCapacityOfBuffer = UART3_READ_BUF_SIZE - RingBuf_GetUnusedSize(&s_uart3ReadRingBuffer);
-        s_uart3ReadBufferState.maxUsedCapacityOfBuffer =
-            usedCapacityOfBuffer > s_uart3ReadBufferState.maxUsedCapacityOfBuffer ? usedCapacityOfBuffer
-                                                                                  : s_uart3ReadBufferState.maxUsedCapacityOfBuffer;
-        s_uart3ReadBufferState.countOfLostData += 1 - realCountPutBuffer;
-    }
+    HAL_UART_IRQHandler(&s_uart3Port.uartHandle);
+}
 
-    if (__HAL_UART_GET_IT_SOURCE(&s_uart3Handle, UART_IT_TXE) != RESET &&
-        __HAL_UART_GET_FLAG(&s_uart3Handle, UART_FLAG_TXE) != RESET) {
-        if (RingBuf_Get(&s_uart3WriteRingBuffer, &data, 1)) {
-            /* Transmit Data */
-            s_uart3Handle.Instance->DR = ((uint16_t) data & (uint16_t) 0x01FF);
-        } else {
-            __HAL_UART_DISABLE_IT(&s_uart3Handle, UART_IT_TXE);
-        }
-    }
+void DMA1_Stream1_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&s_uart3Port.rxDmaHandle);
+}
+
+void DMA1_Stream3_IRQHandler(void)
+{
+    HAL_DMA_IRQHandler(&s_uart3Port.txDmaHandle);
 }
 
 #endif
@@ -421,11 +403,11 @@ void USART3_IRQHandler(void)
 int fputc(int ch,FILE *f)
 {
     if (DJI_CONSOLE_UART_NUM == UART_NUM_1) {
-        HAL_UART_Transmit(&s_uart1Handle, (uint8_t *) &ch, 1, 0xFFFF);
+        UART_ConsoleTransmit(&s_uart1Port, (uint8_t) ch);
     } else if (DJI_CONSOLE_UART_NUM == UART_NUM_2) {
-        HAL_UART_Transmit(&s_uart2Handle, (uint8_t *) &ch, 1, 0xFFFF);
+        UART_ConsoleTransmit(&s_uart2Port, (uint8_t) ch);
     } else if (DJI_CONSOLE_UART_NUM == UART_NUM_3) {
-        HAL_UART_Transmit(&s_uart3Handle, (uint8_t *) &ch, 1, 0xFFFF);
+        UART_ConsoleTransmit(&s_uart3Port, (uint8_t) ch);
     }
 
     return ch;
@@ -440,14 +422,194 @@ int fputc(int ch,FILE *f)
 PUTCHAR_PROTOTYPE
 {
     if (DJI_CONSOLE_UART_NUM == UART_NUM_1) {
-        HAL_UART_Transmit(&s_uart1Handle, (uint8_t *) &ch, 1, 0xFFFF);
+        UART_ConsoleTransmit(&s_uart1Port, (uint8_t) ch);
     } else if (DJI_CONSOLE_UART_NUM == UART_NUM_2) {
-        HAL_UART_Transmit(&s_uart2Handle, (uint8_t *) &ch, 1, 0xFFFF);
+        UART_ConsoleTransmit(&s_uart2Port, (uint8_t) ch);
     } else if (DJI_CONSOLE_UART_NUM == UART_NUM_3) {
-        HAL_UART_Transmit(&s_uart3Handle, (uint8_t *) &ch, 1, 0xFFFF);
+        UART_ConsoleTransmit(&s_uart3Port, (uint8_t) ch);
     }
 
     return ch;
 }
 
 #endif
+
+/* Private functions ---------------------------------------------------------*/
+static T_UartPort *UART_GetPort(E_UartNum uartNum)
+{
+    switch (uartNum) {
+#ifdef USING_UART_PORT_1
+        case UART_NUM_1:
+            return &s_uart1Port;
+#endif
+#ifdef USING_UART_PORT_2
+        case UART_NUM_2:
+            return &s_uart2Port;
+#endif
+#ifdef USING_UART_PORT_3
+        case UART_NUM_3:
+            return &s_uart3Port;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+static T_UartPort *UART_GetPortByHandle(const UART_HandleTypeDef *huart)
+{
+#ifdef USING_UART_PORT_1
+    if (huart == &s_uart1Port.uartHandle) {
+        return &s_uart1Port;
+    }
+#endif
+#ifdef USING_UART_PORT_2
+    if (huart == &s_uart2Port.uartHandle) {
+        return &s_uart2Port;
+    }
+#endif
+#ifdef USING_UART_PORT_3
+    if (huart == &s_uart3Port.uartHandle) {
+        return &s_uart3Port;
+    }
+#endif
+
+    return NULL;
+}
+
+/**
+ * @brief Configure a UART with a circular rx DMA on the whole read ring buffer and idle line detection, so the CPU is
+ * interrupted at half and full buffer and at the end of each burst instead of once per byte, and with a tx DMA fed
+ * from the write ring buffer.
+ */
+static void UART_PortInit(T_UartPort *port, const T_UartPortConfig *config, uint32_t baudRate)
+{
+    RingBuf_Init(&port->readRingBuffer, config->readBuf, config->readBufSize);
+    RingBuf_Init(&port->writeRingBuffer, config->writeBuf, config->writeBufSize);
+    port->txDmaLen = 0;
+    port->isTxDmaRetryPending = false;
+    port->readWaitTask = NULL;
+
+    __HAL_RCC_DMA1_CLK_ENABLE();
+    __HAL_RCC_DMA2_CLK_ENABLE();
+
+    port->uartHandle.Instance = config->instance;
+    port->uartHandle.Init.BaudRate = baudRate;
+    port->uartHandle.Init.WordLength = UART_WORDLENGTH_8B;
+    port->uartHandle.Init.StopBits = UART_STOPBITS_1;
+    port->uartHandle.Init.Parity = UART_PARITY_NONE;
+    port->uartHandle.Init.HwFlowCtl = UART_HWCONTROL_NONE;
+    port->uartHandle.Init.Mode = UART_MODE_TX_RX;
+    port->uartHandle.Init.OverSampling = UART_OVERSAMPLING_16;
+    HAL_UART_Init(&port->uartHandle);
+
+    port->rxDmaHandle.Instance = config->rxDmaStream;
+    port->rxDmaHandle.Init.Channel = config->rxDmaChannel;
+    port->rxDmaHandle.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    port->rxDmaHandle.Init.PeriphInc = DMA_PINC_DISABLE;
+    port->rxDmaHandle.Init.MemInc = DMA_MINC_ENABLE;
+    port->rxDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    port->rxDmaHandle.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    port->rxDmaHandle.Init.Mode = DMA_CIRCULAR;
+    port->rxDmaHandle.Init.Priority = DMA_PRIORITY_HIGH;
+    port->rxDmaHandle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&port->rxDmaHandle);
+    __HAL_LINKDMA(&port->uartHandle, hdmarx, port->rxDmaHandle);
+
+    port->txDmaHandle.Instance = config->txDmaStream;
+    port->txDmaHandle.Init.Channel = config->txDmaChannel;
+    port->txDmaHandle.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    port->txDmaHandle.Init.PeriphInc = DMA_PINC_DISABLE;
+    port->txDmaHandle.Init.MemInc = DMA_MINC_ENABLE;
+    port->txDmaHandle.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    port->txDmaHandle.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    port->txDmaHandle.Init.Mode = DMA_NORMAL;
+    port->txDmaHandle.Init.Priority = DMA_PRIORITY_MEDIUM;
+    port->txDmaHandle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    HAL_DMA_Init(&port->txDmaHandle);
+    __HAL_LINKDMA(&port->uartHandle, hdmatx, port->txDmaHandle);
+
+    HAL_NVIC_SetPriority(config->rxDmaIrq, UART_DMA_IRQ_PRIO_PRE, UART_DMA_IRQ_PRIO_SUB);
+    HAL_NVIC_EnableIRQ(config->rxDmaIrq);
+    HAL_NVIC_SetPriority(config->txDmaIrq, UART_DMA_IRQ_PRIO_PRE, UART_DMA_IRQ_PRIO_SUB);
+    HAL_NVIC_EnableIRQ(config->txDmaIrq);
+
+    HAL_UARTEx_ReceiveToIdle_DMA(&port->uartHandle, port->readRingBuffer.bufferPtr,
+                                 port->readRingBuffer.bufferSize);
+    // Line errors would make the HAL abort the circular reception, the DMA keeps receiving through them instead.
+    __HAL_UART_DISABLE_IT(&port->uartHandle, UART_IT_PE);
+    __HAL_UART_DISABLE_IT(&port->uartHandle, UART_IT_ERR);
+
+    Osal_MutexCreate(&port->mutex);
+}
+
+/**
+ * @brief Start the tx DMA on the next block of the write ring buffer if it is idle, from a task or from an interrupt.
+ * If the HAL refuses to start it, the block stays in the write ring buffer and a retry is left pending.
+ */
+static void UART_StartTransmitDma(T_UartPort *port)
+{
+    uint32_t primask;
+    uint8_t *data;
+    uint16_t dataLen;
+
+    UART_ENTER_CRITICAL(primask);
+    if (port->txDmaLen == 0) {
+        dataLen = RingBuf_GetLinearReadBlock(&port->writeRingBuffer, &data);
+        if (dataLen == 0) {
+            port->isTxDmaRetryPending = false;
+        } else if (HAL_UART_Transmit_DMA(&port->uartHandle, data, dataLen) == HAL_OK) {
+            port->txDmaLen = dataLen;
+            port->isTxDmaRetryPending = false;
+        } else {
+            port->isTxDmaRetryPending = true;
+        }
+    }
+    UART_EXIT_CRITICAL(primask);
+}
+
+/**
+ * @brief Offset of the read ring buffer the circular rx DMA is writing to, from its remaining transfer count.
+ */
+static uint16_t UART_GetRxDmaWriteOffset(void *arg)
+{
+    T_UartPort *port = (T_UartPort *) arg;
+
+    return (uint16_t) (port->readRingBuffer.bufferSize - __HAL_DMA_GET_COUNTER(&port->rxDmaHandle));
+}
+
+static void UART_UpdateMaxUsedCapacity(T_UartBufferState *bufferState, uint16_t usedCapacityOfBuffer)
+{
+    bufferState->maxUsedCapacityOfBuffer =
+        usedCapacityOfBuffer > bufferState->maxUsedCapacityOfBuffer ? usedCapacityOfBuffer
+                                                                    : bufferState->maxUsedCapacityOfBuffer;
+}
+
+/**
+ * @brief Blocking console output, writes the data register directly so the HAL state of the UART stays with the tx DMA.
+ * Waits for a tx DMA in progress on the same UART to finish first, it only completes through its interrupts, so the
+ * byte is dropped and counted as lost if it is still running when called with interrupts masked.
+ */
+static void UART_ConsoleTransmit(T_UartPort *port, uint8_t ch)
+{
+    uint32_t tickStart = HAL_GetTick();
+    uint32_t primask;
+
+    for (;;) {
+        // The tx DMA can not be started by an interrupt until the byte is in the data register.
+        UART_ENTER_CRITICAL(primask);
+        if (port->txDmaLen == 0 && port->uartHandle.gState == HAL_UART_STATE_READY) {
+            break;
+        }
+        UART_EXIT_CRITICAL(primask);
+
+        if (primask != 0 || __get_BASEPRI() != 0 || HAL_GetTick() - tickStart >= UART_CONSOLE_TIMEOUT_MS) {
+            port->writeBufferState.countOfLostData++;
+            return;
+        }
+    }
+
+    while (__HAL_UART_GET_FLAG(&port->uartHandle, UART_FLAG_TXE) == RESET) {
+    }
+    port->uartHandle.Instance->DR = ch;
+    UART_EXIT_CRITICAL(primask);
+}
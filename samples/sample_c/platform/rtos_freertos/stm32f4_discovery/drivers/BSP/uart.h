@@ -58,7 +58,9 @@ typedef struct {
 /* Exported functions --------------------------------------------------------*/
 void UART_Init(E_UartNum uartNum, uint32_t baudRate);
 int UART_Read(E_UartNum uartNum, uint8_t *buf, uint16_t readSize);
+int UART_ReadWait(E_UartNum uartNum, uint8_t *buf, uint16_t readSize, uint32_t timeoutMs);
 int UART_Write(E_UartNum uartNum, const uint8_t *buf, uint16_t writeSize);
+void UART_RetryTransmit(void);
 void UART_GetBufferState(E_UartNum uartNum, T_UartBufferState *readBufferState, T_UartBufferState *writeBufferState);
 
 /* Private constants ---------------------------------------------------------*/
@@ -37,6 +37,8 @@
 
 /* Private constants ---------------------------------------------------------*/
 #define COMMUNICATION_UART_NUM          UART_NUM_3
+//Max time a read waits for data, the reader is woken as soon as the UART receives a burst.
+#define COMMUNICATION_UART_READ_WAIT_MS (10)
 
 /* Private types -------------------------------------------------------------*/
 typedef enum {
@@ -54,8 +56,9 @@ typedef struct {
 T_DjiReturnCode HalUart_Init(E_DjiHalUartNum uartNum, uint32_t baudRate, T_DjiUartHandle *uartHandle)
 {
     T_UartHandleStruct *uartHandleStruct;
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
 
-    uartHandleStruct = pvPortMalloc(sizeof(T_UartHandleStruct));
+    uartHandleStruct = osalHandler->Malloc(sizeof(T_UartHandleStruct));
     if (uartHandleStruct == NULL) {
         return DJI_ERROR_SYSTEM_MODULE_CODE_MEMORY_ALLOC_FAILED;
     }
@@ -74,7 +77,9 @@ T_DjiReturnCode HalUart_Init(E_DjiHalUartNum uartNum, uint32_t baudRate, T_DjiUa
 
 T_DjiReturnCode HalUart_DeInit(T_DjiUartHandle uartHandle)
 {
-    vPortFree(uartHandle);
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+
+    osalHandler->Free(uartHandle);
 
     return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
 }
@@ -99,7 +104,8 @@ T_DjiReturnCode HalUart_ReadData(T_DjiUartHandle uartHandle, uint8_t *buf, uint3
     int32_t ret;
 
     if (uartHandleStruct->uartNum == USER_UART_NUM0) {
-        *realLen = UART_Read(COMMUNICATION_UART_NUM, buf, len);
+        ret = UART_ReadWait(COMMUNICATION_UART_NUM, buf, len, COMMUNICATION_UART_READ_WAIT_MS);
+        *realLen = ret > 0 ? ret : 0;
     } else if (uartHandleStruct->uartNum == USER_UART_NUM1) {
         USBH_CDC_ReadData(buf, len, realLen);
     }
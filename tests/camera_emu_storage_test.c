@@ -0,0 +1,343 @@
+/**
+ ********************************************************************
+ * @file    camera_emu_storage_test.c
+ * @brief   Runs the emulated sdcard of the camera emulation in the test output directory, checking its index
+ * against the files on disk, the space accounting, and formats racing the photo captures.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "test_common.h"
+#include "osal/osal.h"
+#include "utils/util_misc.h"
+#include "camera_emu/test_payload_cam_emu_storage.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define STORAGE_TEST_QUOTA_IN_MB            (1024)
+#define STORAGE_TEST_BYTES_PER_MB           (1024 * 1024)
+#define STORAGE_TEST_FILE_NUM_MAX           (1024)
+#define STORAGE_TEST_FORMAT_NUM             (20)
+#define STORAGE_TEST_BENCHMARK_FILE_NUM     (2000)
+#define STORAGE_TEST_PATH_SIZE              (DJI_FILE_PATH_SIZE_MAX + 64)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static char s_rootPath[DJI_FILE_PATH_SIZE_MAX];
+static T_DjiTestCameraEmuStorageFile s_files[STORAGE_TEST_FILE_NUM_MAX];
+static volatile bool s_isCapturing = false;
+static uint32_t s_capturedCount = 0;
+
+/* Private functions declaration ---------------------------------------------*/
+static void StorageTest_RunIndex(void);
+static void StorageTest_RunFormat(void);
+static void StorageTest_RunFormatRace(void);
+static void StorageTest_RunDefaultRoot(void);
+static void StorageTest_RunBenchmark(void);
+static void StorageTest_GetPath(char *path, const char *name);
+static void StorageTest_CreateFile(const char *name, uint32_t sizeInBytes);
+static void StorageTest_WaitFormatted(void);
+static uint32_t StorageTest_AssertIndexMatchesDisk(void);
+static void *StorageTest_CaptureTask(void *arg);
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+    snprintf(s_rootPath, sizeof(s_rootPath), "%s/sdcard", TestCommon_GetOutputDir("camera_emu_storage"));
+
+    StorageTest_RunIndex();
+    StorageTest_RunFormat();
+    StorageTest_RunFormatRace();
+    StorageTest_RunDefaultRoot();
+    StorageTest_RunBenchmark();
+
+    printf("camera emu storage test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void StorageTest_RunIndex(void)
+{
+    T_DjiTestCameraEmuStorageState state;
+    T_DjiCameraMediaFileInfo info = {0};
+    char path[STORAGE_TEST_PATH_SIZE];
+    char rootPath[DJI_FILE_PATH_SIZE_MAX];
+    uint32_t count = 0;
+    struct stat st;
+
+    // a sdcard left by a previous run, with a temporary photo copy and a directory that are not media files
+    snprintf(path, sizeof(path), "rm -rf %s", s_rootPath);
+    TEST_ASSERT(system(path) == 0);
+    TEST_ASSERT(mkdir(s_rootPath, 0755) == 0);
+    StorageTest_CreateFile("DJI_0007.jpg", 3000);
+    StorageTest_CreateFile("x.mp4", 100);
+    StorageTest_CreateFile(".00000000_DJI_0003.jpg", 100);
+    StorageTest_GetPath(path, "album");
+    TEST_ASSERT(mkdir(path, 0755) == 0);
+
+    TEST_ASSERT(DjiTest_CameraEmuStorageCapturePhoto(1) == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    snprintf(path, sizeof(path), "%s/", s_rootPath);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageInit(path, STORAGE_TEST_QUOTA_IN_MB));
+    TEST_ASSERT(DjiTest_CameraEmuStorageInit(s_rootPath, STORAGE_TEST_QUOTA_IN_MB) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetRootPath(rootPath));
+    TEST_ASSERT(strcmp(rootPath, s_rootPath) == 0);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetState(&state));
+    TEST_ASSERT(state.fileCount == 2 && state.totalSpaceInMB == STORAGE_TEST_QUOTA_IN_MB);
+    TEST_ASSERT(state.remainSpaceInMB == STORAGE_TEST_QUOTA_IN_MB - 1 && state.isFormatting == false);
+
+    // media info is kept in the index, paths are matched by their name in the sdcard
+    StorageTest_GetPath(path, "x.mp4");
+    TEST_ASSERT(DjiTest_CameraEmuStorageGetFileInfo(path, &info) == DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND);
+    info.type = DJI_CAMERA_FILE_TYPE_MP4;
+    info.fileSize = 1;
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageSetFileInfo(path, &info));
+    memset(&info, 0, sizeof(info));
+    StorageTest_GetPath(path, "/x.mp4");
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetFileInfo(path, &info));
+    TEST_ASSERT(info.type == DJI_CAMERA_FILE_TYPE_MP4 && info.fileSize == 100);
+    TEST_ASSERT(DjiTest_CameraEmuStorageGetFileInfo("/x.mp4", &info) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS);
+
+    // captures continue the sequence found on the sdcard
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageCapturePhoto(5 * STORAGE_TEST_BYTES_PER_MB));
+    StorageTest_GetPath(path, "DJI_0008.jpg");
+    TEST_ASSERT(stat(path, &st) == 0);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetFileInfo(path, &info));
+    TEST_ASSERT(info.type == DJI_CAMERA_FILE_TYPE_JPEG && info.fileSize == (uint32_t) st.st_size);
+
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageStartRecord());
+    TEST_ASSERT(DjiTest_CameraEmuStorageStartRecord() == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+    for (count = 0; count < 3; count++) {
+        TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageAppendRecord(2 * STORAGE_TEST_BYTES_PER_MB, 1));
+    }
+    TEST_ASSERT(DjiTest_CameraEmuStorageAppendRecord(STORAGE_TEST_QUOTA_IN_MB * STORAGE_TEST_BYTES_PER_MB, 1) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageStopRecord());
+    TEST_ASSERT(DjiTest_CameraEmuStorageAppendRecord(1, 1) == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    StorageTest_GetPath(path, "DJI_0009.mp4");
+    TEST_ASSERT(stat(path, &st) == 0 && st.st_size == 6 * STORAGE_TEST_BYTES_PER_MB);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetFileInfo(path, &info));
+    TEST_ASSERT(info.mediaFileAttr.attrVideoDuration == 3);
+
+    StorageTest_GetPath(path, "DJI_0007.jpg");
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageDeleteFile(path));
+    TEST_ASSERT(DjiTest_CameraEmuStorageGetFileInfo(path, &info) == DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetFileList(s_files, STORAGE_TEST_FILE_NUM_MAX, &count));
+    TEST_ASSERT(count == 3);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetState(&state));
+    TEST_ASSERT(state.fileCount == 3);
+    TEST_ASSERT(state.remainSpaceInMB <= STORAGE_TEST_QUOTA_IN_MB - 6 && state.remainSpaceInMB >= 1);
+}
+
+static void StorageTest_RunFormat(void)
+{
+    T_DjiTestCameraEmuStorageState state;
+    char path[STORAGE_TEST_PATH_SIZE];
+    struct stat st;
+    uint32_t i;
+
+    for (i = 0; i < 40; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageCapturePhoto(1));
+    }
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetState(&state));
+    TEST_ASSERT(state.fileCount == 43);
+    TEST_ASSERT(StorageTest_AssertIndexMatchesDisk() == 1);
+
+    // the files are deleted by the sdcard task, hidden ones included, and the sequence restarts
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageFormat());
+    StorageTest_WaitFormatted();
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetState(&state));
+    TEST_ASSERT(state.fileCount == 0 && state.remainSpaceInMB == STORAGE_TEST_QUOTA_IN_MB);
+    StorageTest_GetPath(path, ".00000000_DJI_0003.jpg");
+    TEST_ASSERT(stat(path, &st) != 0);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageCapturePhoto(1));
+    StorageTest_GetPath(path, "DJI_0001.jpg");
+    TEST_ASSERT(stat(path, &st) == 0);
+    TEST_ASSERT(StorageTest_AssertIndexMatchesDisk() == 0);
+}
+
+static void StorageTest_RunFormatRace(void)
+{
+    T_DjiTestCameraEmuStorageState state;
+    pthread_t captureThread;
+    uint32_t i;
+
+    // photos copied while a format starts are dropped, whatever the timing the index ends up matching the disk
+    s_capturedCount = 0;
+    s_isCapturing = true;
+    TEST_ASSERT(pthread_create(&captureThread, NULL, StorageTest_CaptureTask, NULL) == 0);
+    for (i = 0; i < STORAGE_TEST_FORMAT_NUM; i++) {
+        Osal_TaskSleepMs(5);
+        TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageFormat());
+        StorageTest_WaitFormatted();
+    }
+    Osal_TaskSleepMs(5);
+    s_isCapturing = false;
+    TEST_ASSERT(pthread_join(captureThread, NULL) == 0);
+
+    TEST_ASSERT(s_capturedCount > 0);
+    TEST_ASSERT(StorageTest_AssertIndexMatchesDisk() == 0);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetState(&state));
+    printf("%u photos captured around %u formats, %u on the sdcard\n", s_capturedCount, STORAGE_TEST_FORMAT_NUM,
+           state.fileCount);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageDeInit());
+    TEST_ASSERT(DjiTest_CameraEmuStorageIsInited() == false);
+}
+
+static void StorageTest_RunDefaultRoot(void)
+{
+    T_DjiTestCameraEmuStorageState state;
+    char workDirPath[DJI_FILE_PATH_SIZE_MAX];
+    char testDirPath[DJI_FILE_PATH_SIZE_MAX];
+    char rootPath[DJI_FILE_PATH_SIZE_MAX];
+    char path[STORAGE_TEST_PATH_SIZE];
+
+    // the default sdcard is created in the working directory and seeded with the sample media files
+    TEST_ASSERT(getcwd(workDirPath, sizeof(workDirPath)) != NULL);
+    snprintf(path, sizeof(path), "rm -rf %s/default && mkdir %s/default", TestCommon_GetOutputDir("camera_emu_storage"),
+             TestCommon_GetOutputDir("camera_emu_storage"));
+    TEST_ASSERT(system(path) == 0);
+    snprintf(path, sizeof(path), "%s/default", TestCommon_GetOutputDir("camera_emu_storage"));
+    TEST_ASSERT(chdir(path) == 0);
+    TEST_ASSERT(getcwd(testDirPath, sizeof(testDirPath)) != NULL);
+
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageInit(NULL, STORAGE_TEST_QUOTA_IN_MB));
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetRootPath(rootPath));
+    snprintf(path, sizeof(path), "%s/camera_emu_sdcard", testDirPath);
+    TEST_ASSERT(strcmp(rootPath, path) == 0);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetState(&state));
+    TEST_ASSERT(state.fileCount == 3);
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageDeInit());
+    TEST_ASSERT(chdir(workDirPath) == 0);
+
+    // a root path leaving no room for the file names is refused instead of truncated
+    memset(path, 'a', DJI_FILE_PATH_SIZE_MAX - 32);
+    path[0] = '/';
+    path[DJI_FILE_PATH_SIZE_MAX - 32] = '\0';
+    TEST_ASSERT(DjiTest_CameraEmuStorageInit(path, STORAGE_TEST_QUOTA_IN_MB) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_CameraEmuStorageIsInited() == false);
+}
+
+static void StorageTest_RunBenchmark(void)
+{
+    char path[DJI_FILE_PATH_SIZE_MAX];
+
+    snprintf(path, sizeof(path), "%s/benchmark", TestCommon_GetOutputDir("camera_emu_storage"));
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageRunBenchmark(path, STORAGE_TEST_BENCHMARK_FILE_NUM));
+    TEST_ASSERT(DjiTest_CameraEmuStorageIsInited() == false);
+}
+
+static void StorageTest_GetPath(char *path, const char *name)
+{
+    snprintf(path, STORAGE_TEST_PATH_SIZE, "%s/%s", s_rootPath, name);
+}
+
+static void StorageTest_CreateFile(const char *name, uint32_t sizeInBytes)
+{
+    char path[STORAGE_TEST_PATH_SIZE];
+    FILE *file;
+
+    StorageTest_GetPath(path, name);
+    file = fopen(path, "wb");
+    TEST_ASSERT(file != NULL);
+    TEST_ASSERT(ftruncate(fileno(file), sizeInBytes) == 0);
+    fclose(file);
+}
+
+static void StorageTest_WaitFormatted(void)
+{
+    T_DjiTestCameraEmuStorageState state;
+    uint32_t waitMs = 0;
+
+    do {
+        Osal_TaskSleepMs(1);
+        TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetState(&state));
+        TEST_ASSERT(++waitMs < 10000);
+    } while (state.isFormatting == true);
+}
+
+static uint32_t StorageTest_AssertIndexMatchesDisk(void)
+{
+    T_DjiTestCameraEmuStorageState state;
+    char path[STORAGE_TEST_PATH_SIZE];
+    uint32_t count = 0;
+    uint32_t diskCount = 0;
+    uint32_t hiddenCount = 0;
+    uint32_t i;
+    DIR *dir;
+    struct dirent *dirent;
+    struct stat st;
+
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetFileList(s_files, STORAGE_TEST_FILE_NUM_MAX, &count));
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuStorageGetState(&state));
+    TEST_ASSERT(count == state.fileCount);
+    for (i = 0; i < count; i++) {
+        StorageTest_GetPath(path, s_files[i].name);
+        TEST_ASSERT(stat(path, &st) == 0 && st.st_size == s_files[i].sizeInBytes);
+    }
+
+    // every media file is indexed, names are unique so counting is enough, temporary copies are only counted
+    dir = opendir(s_rootPath);
+    TEST_ASSERT(dir != NULL);
+    while ((dirent = readdir(dir)) != NULL) {
+        StorageTest_GetPath(path, dirent->d_name);
+        if (stat(path, &st) != 0 || S_ISREG(st.st_mode) == 0) {
+            continue;
+        }
+        if (dirent->d_name[0] == '.') {
+            hiddenCount++;
+        } else {
+            diskCount++;
+        }
+    }
+    closedir(dir);
+    TEST_ASSERT(diskCount == count);
+
+    return hiddenCount;
+}
+
+static void *StorageTest_CaptureTask(void *arg)
+{
+    T_DjiReturnCode returnCode;
+
+    USER_UTIL_UNUSED(arg);
+
+    while (s_isCapturing == true) {
+        returnCode = DjiTest_CameraEmuStorageCapturePhoto(1);
+        TEST_ASSERT(returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS ||
+                    returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            s_capturedCount++;
+        }
+    }
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,584 @@
+/**
+ ********************************************************************
+ * @file    camera_emu_timer_test.c
+ * @brief   Runs the deadline timer service on a simulated and on the real clock, and checks the shooting,
+ * recording and zoom deadlines of the camera emulation driven by it on the simulated clock.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "test_common.h"
+#include "utils/util_timer.h"
+#include "utils/util_misc.h"
+#include "camera_emu/test_payload_cam_emu_base.h"
+#include "camera_emu/test_payload_cam_emu_storage.h"
+#include "gimbal_emu/test_payload_gimbal_emu.h"
+#include "dji_aircraft_info.h"
+#include "osal/osal.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define TIMER_TEST_START_US             (5000000ULL)
+#define TIMER_TEST_TIMER_NUM            (4)
+#define TIMER_TEST_PERIOD_MS            (20)
+#define TIMER_TEST_PERIOD_NUM           (50)
+#define TIMER_TEST_REAL_LATE_MAX_US     (50000)
+#define TIMER_TEST_TASK_STACK_SIZE      (2048)
+// The timing of the camera emulation, as defined by its sample.
+#define CAMERA_TEST_PHOTO_TIME_MS       (500)
+#define CAMERA_TEST_PHOTO_SPACE_IN_MB   (4)
+#define CAMERA_TEST_RECORD_PERIOD_MS    (1000)
+#define CAMERA_TEST_RECORD_SPACE_IN_MB  (2)
+#define CAMERA_TEST_ZOOM_PERIOD_MS      (100)
+#define CAMERA_TEST_ZOOM_CTRL_STEP      (5)
+#define CAMERA_TEST_TAP_ZOOM_TIME_MS    (2000)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    T_UtilTimerService *service;
+    T_UtilTimer *timer;
+    uint32_t firedCount;
+    uint64_t firedTimeUs;
+    uint64_t deadlineUs;
+    uint32_t periodMs;
+    uint32_t periodNum;
+} T_TimerTestContext;
+
+/* Private values -------------------------------------------------------------*/
+static uint64_t s_nowUs = TIMER_TEST_START_US;
+static uint32_t s_firedOrder[TIMER_TEST_TIMER_NUM * 2];
+static uint32_t s_firedOrderNum = 0;
+static bool s_isCameraStarting = false;
+static T_UtilTimerService *s_cameraTimerService = NULL;
+static T_DjiCameraCommonHandler s_cameraCommonHandler;
+static T_DjiCameraOpticalZoomHandler s_cameraOpticalZoomHandler;
+static T_DjiCameraTapZoomHandler s_cameraTapZoomHandler;
+static uint32_t s_gimbalRotationCount = 0;
+
+/* Private functions declaration ---------------------------------------------*/
+T_DjiReturnCode __real_UtilTimer_ServiceInit(T_UtilTimerService *service, const T_UtilTimerClock *clock);
+T_DjiReturnCode __real_UtilTimer_ServiceStart(T_UtilTimerService *service, const char *name, uint32_t stackSize);
+T_DjiReturnCode __wrap_UtilTimer_ServiceInit(T_UtilTimerService *service, const T_UtilTimerClock *clock);
+T_DjiReturnCode __wrap_UtilTimer_ServiceStart(T_UtilTimerService *service, const char *name, uint32_t stackSize);
+T_DjiReturnCode __wrap_DjiTest_GimbalRotate(E_DjiGimbalRotationMode rotationMode,
+                                            T_DjiGimbalRotationProperty rotationProperty,
+                                            T_DjiAttitude3d rotationValue);
+T_DjiReturnCode __wrap_DjiTest_CameraEmuStorageInit(const char *rootPath, uint32_t quotaInMB);
+T_DjiReturnCode __wrap_DjiAircraftInfo_GetBaseInfo(T_DjiAircraftInfoBaseInfo *baseInfo);
+T_DjiReturnCode __wrap_DjiPayloadCamera_Init(void);
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegCommonHandler(const T_DjiCameraCommonHandler *cameraCommonHandler);
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegExposureMeteringHandler(const T_DjiCameraExposureMeteringHandler
+                                                                   *cameraExposureMeteringHandler);
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegFocusHandler(const T_DjiCameraFocusHandler *cameraFocusHandler);
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegDigitalZoomHandler(const T_DjiCameraDigitalZoomHandler
+                                                              *cameraDigitalZoomHandler);
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegOpticalZoomHandler(const T_DjiCameraOpticalZoomHandler
+                                                              *cameraOpticalZoomHandler);
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegTapZoomHandler(const T_DjiCameraTapZoomHandler *cameraTapZoomHandler);
+T_DjiReturnCode __wrap_DjiPayloadCamera_SetVideoStreamType(E_DjiCameraVideoStreamType videoStreamType);
+T_DjiReturnCode __wrap_DjiPayloadCamera_GetVideoStreamRemoteAddress(char *ipAddr, uint16_t *port);
+static T_DjiReturnCode TimerTest_GetTimeUs(uint64_t *us);
+static void TimerTest_RecordCallback(void *arg);
+static void TimerTest_PeriodicCallback(void *arg);
+static void TimerTest_RunOrder(void);
+static void TimerTest_RunPeriodic(void);
+static void TimerTest_RunRealClock(void);
+static void TimerTest_StartCamera(void);
+static void TimerTest_AdvanceCamera(uint32_t durationMs);
+static void TimerTest_RunCameraShooting(void);
+static void TimerTest_RunCameraRecording(void);
+static void TimerTest_RunCameraZoom(void);
+
+/* Private variables ---------------------------------------------------------*/
+static const T_UtilTimerClock s_fakeClock = {
+    .GetTimeUs = TimerTest_GetTimeUs,
+};
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+
+    TimerTest_RunOrder();
+    TimerTest_RunPeriodic();
+    TimerTest_RunRealClock();
+    TimerTest_StartCamera();
+    TimerTest_RunCameraShooting();
+    TimerTest_RunCameraRecording();
+    TimerTest_RunCameraZoom();
+
+    printf("camera emu timer test passed\n");
+    return 0;
+}
+
+T_DjiReturnCode __wrap_UtilTimer_ServiceInit(T_UtilTimerService *service, const T_UtilTimerClock *clock)
+{
+    // The camera emulation gets the simulated clock, the services of this test keep their own.
+    if (s_isCameraStarting == true) {
+        TEST_ASSERT(s_cameraTimerService == NULL);
+        s_cameraTimerService = service;
+        clock = &s_fakeClock;
+    }
+
+    return __real_UtilTimer_ServiceInit(service, clock);
+}
+
+T_DjiReturnCode __wrap_UtilTimer_ServiceStart(T_UtilTimerService *service, const char *name, uint32_t stackSize)
+{
+    // The test runs the expired timers of the camera emulation itself, its timer task is never started.
+    if (s_cameraTimerService != NULL && service == s_cameraTimerService) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    }
+
+    return __real_UtilTimer_ServiceStart(service, name, stackSize);
+}
+
+T_DjiReturnCode __wrap_DjiTest_GimbalRotate(E_DjiGimbalRotationMode rotationMode,
+                                            T_DjiGimbalRotationProperty rotationProperty,
+                                            T_DjiAttitude3d rotationValue)
+{
+    USER_UTIL_UNUSED(rotationMode);
+    USER_UTIL_UNUSED(rotationProperty);
+    USER_UTIL_UNUSED(rotationValue);
+
+    s_gimbalRotationCount++;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiTest_CameraEmuStorageInit(const char *rootPath, uint32_t quotaInMB)
+{
+    USER_UTIL_UNUSED(rootPath);
+    USER_UTIL_UNUSED(quotaInMB);
+
+    // Without the storage directory the sdcard space is counted down by the emulation.
+    return DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+}
+
+T_DjiReturnCode __wrap_DjiAircraftInfo_GetBaseInfo(T_DjiAircraftInfoBaseInfo *baseInfo)
+{
+    TEST_ASSERT(baseInfo != NULL);
+    memset(baseInfo, 0, sizeof(T_DjiAircraftInfoBaseInfo));
+    baseInfo->djiAdapterType = DJI_SDK_ADAPTER_TYPE_NONE;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_Init(void)
+{
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegCommonHandler(const T_DjiCameraCommonHandler *cameraCommonHandler)
+{
+    TEST_ASSERT(cameraCommonHandler != NULL);
+    s_cameraCommonHandler = *cameraCommonHandler;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegExposureMeteringHandler(const T_DjiCameraExposureMeteringHandler
+                                                                   *cameraExposureMeteringHandler)
+{
+    TEST_ASSERT(cameraExposureMeteringHandler != NULL);
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegFocusHandler(const T_DjiCameraFocusHandler *cameraFocusHandler)
+{
+    TEST_ASSERT(cameraFocusHandler != NULL);
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegDigitalZoomHandler(const T_DjiCameraDigitalZoomHandler
+                                                              *cameraDigitalZoomHandler)
+{
+    TEST_ASSERT(cameraDigitalZoomHandler != NULL);
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegOpticalZoomHandler(const T_DjiCameraOpticalZoomHandler
+                                                              *cameraOpticalZoomHandler)
+{
+    TEST_ASSERT(cameraOpticalZoomHandler != NULL);
+    s_cameraOpticalZoomHandler = *cameraOpticalZoomHandler;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_RegTapZoomHandler(const T_DjiCameraTapZoomHandler *cameraTapZoomHandler)
+{
+    TEST_ASSERT(cameraTapZoomHandler != NULL);
+    s_cameraTapZoomHandler = *cameraTapZoomHandler;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_SetVideoStreamType(E_DjiCameraVideoStreamType videoStreamType)
+{
+    USER_UTIL_UNUSED(videoStreamType);
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPayloadCamera_GetVideoStreamRemoteAddress(char *ipAddr, uint16_t *port)
+{
+    strcpy(ipAddr, "127.0.0.1");
+    *port = 0;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode TimerTest_GetTimeUs(uint64_t *us)
+{
+    *us = s_nowUs;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void TimerTest_RecordCallback(void *arg)
+{
+    TEST_ASSERT(s_firedOrderNum < sizeof(s_firedOrder) / sizeof(s_firedOrder[0]));
+    s_firedOrder[s_firedOrderNum++] = (uint32_t) (uintptr_t) arg;
+}
+
+static void TimerTest_PeriodicCallback(void *arg)
+{
+    T_TimerTestContext *context = (T_TimerTestContext *) arg;
+
+    UtilTimer_GetTimeUs(context->service, &context->firedTimeUs);
+    context->firedCount++;
+    if (context->firedCount < context->periodNum) {
+        context->deadlineUs += (uint64_t) context->periodMs * 1000;
+        TEST_ASSERT_SUCCESS(UtilTimer_StartAt(context->service, context->timer, context->deadlineUs));
+    }
+}
+
+static void TimerTest_RunOrder(void)
+{
+    T_UtilTimerService service;
+    T_UtilTimer timers[TIMER_TEST_TIMER_NUM];
+    T_UtilTimer noCallbackTimer;
+    uint64_t nextDeadlineUs = 0;
+    uint32_t i;
+
+    s_nowUs = TIMER_TEST_START_US;
+    s_firedOrderNum = 0;
+    TEST_ASSERT(UtilTimer_ServiceInit(NULL, &s_fakeClock) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT_SUCCESS(UtilTimer_ServiceInit(&service, &s_fakeClock));
+    for (i = 0; i < TIMER_TEST_TIMER_NUM; i++) {
+        UtilTimer_Init(&timers[i], TimerTest_RecordCallback, (void *) (uintptr_t) i);
+    }
+    UtilTimer_Init(&noCallbackTimer, NULL, NULL);
+    TEST_ASSERT(UtilTimer_Start(&service, &noCallbackTimer, 0) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    // nothing armed
+    TEST_ASSERT(UtilTimer_ServiceRunExpired(&service, &nextDeadlineUs) == 0);
+    TEST_ASSERT(nextDeadlineUs == UTIL_TIMER_NO_DEADLINE);
+
+    // fired in deadline order, the same deadline in arming order, a stopped timer never
+    TEST_ASSERT_SUCCESS(UtilTimer_Start(&service, &timers[0], 30));
+    TEST_ASSERT_SUCCESS(UtilTimer_Start(&service, &timers[1], 10));
+    TEST_ASSERT_SUCCESS(UtilTimer_Start(&service, &timers[2], 30));
+    TEST_ASSERT_SUCCESS(UtilTimer_Start(&service, &timers[3], 20));
+    TEST_ASSERT_SUCCESS(UtilTimer_Stop(&service, &timers[3]));
+    TEST_ASSERT_SUCCESS(UtilTimer_Stop(&service, &timers[3]));
+    TEST_ASSERT(UtilTimer_GetArmedCount(&service) == 3);
+    TEST_ASSERT(UtilTimer_IsArmed(&service, &timers[3]) == false);
+
+    s_nowUs += 10000 - 1;
+    TEST_ASSERT(UtilTimer_ServiceRunExpired(&service, &nextDeadlineUs) == 0);
+    TEST_ASSERT(nextDeadlineUs == TIMER_TEST_START_US + 10000);
+    s_nowUs += 1;
+    TEST_ASSERT(UtilTimer_ServiceRunExpired(&service, &nextDeadlineUs) == 1);
+    TEST_ASSERT(nextDeadlineUs == TIMER_TEST_START_US + 30000);
+    s_nowUs += 25000;
+    TEST_ASSERT(UtilTimer_ServiceRunExpired(&service, &nextDeadlineUs) == 2);
+    TEST_ASSERT(nextDeadlineUs == UTIL_TIMER_NO_DEADLINE);
+    TEST_ASSERT(s_firedOrderNum == 3 && s_firedOrder[0] == 1 && s_firedOrder[1] == 0 && s_firedOrder[2] == 2);
+    TEST_ASSERT(service.firedCount == 3 && service.maxLateUs == 5000);
+
+    // re-arming an armed timer moves its deadline instead of arming it twice
+    s_firedOrderNum = 0;
+    TEST_ASSERT_SUCCESS(UtilTimer_Start(&service, &timers[0], 10));
+    TEST_ASSERT_SUCCESS(UtilTimer_Start(&service, &timers[0], 50));
+    TEST_ASSERT(UtilTimer_GetArmedCount(&service) == 1);
+    s_nowUs += 10000;
+    TEST_ASSERT(UtilTimer_ServiceRunExpired(&service, NULL) == 0);
+    s_nowUs += 40000;
+    TEST_ASSERT(UtilTimer_ServiceRunExpired(&service, NULL) == 1);
+    TEST_ASSERT(s_firedOrderNum == 1 && s_firedOrder[0] == 0);
+
+    // armed timers are released with the service
+    TEST_ASSERT_SUCCESS(UtilTimer_Start(&service, &timers[1], 10));
+    TEST_ASSERT_SUCCESS(UtilTimer_ServiceDeInit(&service));
+    TEST_ASSERT(timers[1].isArmed == false && timers[1].next == NULL);
+}
+
+static void TimerTest_RunPeriodic(void)
+{
+    T_UtilTimerService service;
+    T_UtilTimer timer;
+    T_TimerTestContext context = {0};
+    uint32_t pass = 0;
+
+    s_nowUs = TIMER_TEST_START_US;
+    TEST_ASSERT_SUCCESS(UtilTimer_ServiceInit(&service, &s_fakeClock));
+    UtilTimer_Init(&timer, TimerTest_PeriodicCallback, &context);
+    context.service = &service;
+    context.timer = &timer;
+    context.periodMs = TIMER_TEST_PERIOD_MS;
+    context.periodNum = TIMER_TEST_PERIOD_NUM;
+    context.deadlineUs = s_nowUs + TIMER_TEST_PERIOD_MS * 1000;
+    TEST_ASSERT_SUCCESS(UtilTimer_StartAt(&service, &timer, context.deadlineUs));
+
+    // passes 7 ms late every time, re-arming from the previous deadline keeps every period on the grid
+    while (UtilTimer_IsArmed(&service, &timer) == true) {
+        s_nowUs = context.deadlineUs + 7000;
+        TEST_ASSERT(UtilTimer_ServiceRunExpired(&service, NULL) == 1);
+        TEST_ASSERT(context.firedTimeUs == TIMER_TEST_START_US + (uint64_t) (pass + 1) * TIMER_TEST_PERIOD_MS * 1000 +
+                                           7000);
+        pass++;
+    }
+    TEST_ASSERT(pass == TIMER_TEST_PERIOD_NUM && context.firedCount == TIMER_TEST_PERIOD_NUM);
+    TEST_ASSERT(service.maxLateUs == 7000);
+
+    // a deadline in the past fires on the next pass, once even when the callback re-arms for that same time
+    context.firedCount = 0;
+    context.periodMs = 0;
+    context.periodNum = 1000;
+    context.deadlineUs = s_nowUs - 1000;
+    TEST_ASSERT_SUCCESS(UtilTimer_StartAt(&service, &timer, context.deadlineUs));
+    TEST_ASSERT(UtilTimer_ServiceRunExpired(&service, NULL) == 1);
+    TEST_ASSERT(context.firedCount == 1 && UtilTimer_IsArmed(&service, &timer) == true);
+    TEST_ASSERT_SUCCESS(UtilTimer_ServiceDeInit(&service));
+}
+
+static void TimerTest_RunRealClock(void)
+{
+    T_UtilTimerService service;
+    T_UtilTimer timers[3];
+    T_TimerTestContext contexts[3] = {0};
+    const uint32_t delayMs[] = {100, 250, 300};
+    uint64_t startUs = 0;
+    uint32_t wakeupCount;
+    uint32_t i;
+
+    TEST_ASSERT_SUCCESS(UtilTimer_ServiceInit(&service, NULL));
+    TEST_ASSERT(UtilTimer_ServiceStart(NULL, "timer_test", TIMER_TEST_TASK_STACK_SIZE) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT_SUCCESS(UtilTimer_ServiceStart(&service, "timer_test", TIMER_TEST_TASK_STACK_SIZE));
+    TEST_ASSERT(UtilTimer_ServiceStart(&service, "timer_test", TIMER_TEST_TASK_STACK_SIZE) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+
+    TEST_ASSERT_SUCCESS(Osal_GetTimeUs(&startUs));
+    for (i = 0; i < 3; i++) {
+        UtilTimer_Init(&timers[i], TimerTest_PeriodicCallback, &contexts[i]);
+        contexts[i].service = &service;
+        contexts[i].timer = &timers[i];
+        contexts[i].periodNum = 1;
+        contexts[i].deadlineUs = startUs + (uint64_t) delayMs[i] * 1000;
+        TEST_ASSERT_SUCCESS(UtilTimer_StartAt(&service, &timers[i], contexts[i].deadlineUs));
+    }
+    TEST_ASSERT_SUCCESS(UtilTimer_Stop(&service, &timers[2]));
+
+    // the task sleeps until each deadline and not longer, without polling while nothing is armed
+    Osal_TaskSleepMs(600);
+    for (i = 0; i < 2; i++) {
+        TEST_ASSERT(contexts[i].firedCount == 1);
+        TEST_ASSERT(contexts[i].firedTimeUs >= contexts[i].deadlineUs &&
+                    contexts[i].firedTimeUs - contexts[i].deadlineUs < TIMER_TEST_REAL_LATE_MAX_US);
+    }
+    TEST_ASSERT(contexts[2].firedCount == 0);
+    TEST_ASSERT(service.firedCount == 2 && service.wakeupCount <= 8);
+    wakeupCount = service.wakeupCount;
+    Osal_TaskSleepMs(500);
+    TEST_ASSERT(service.wakeupCount == wakeupCount);
+    UtilTimer_PrintStatistics(&service, "timer test");
+
+    TEST_ASSERT_SUCCESS(UtilTimer_ServiceDeInit(&service));
+}
+
+static void TimerTest_StartCamera(void)
+{
+    s_nowUs = TIMER_TEST_START_US;
+    s_isCameraStarting = true;
+    TEST_ASSERT_SUCCESS(DjiTest_CameraEmuBaseStartService());
+    s_isCameraStarting = false;
+    TEST_ASSERT(s_cameraTimerService != NULL && DjiTest_CameraIsInited() == true);
+    TEST_ASSERT(s_cameraCommonHandler.StartShootPhoto != NULL && s_cameraOpticalZoomHandler.GetOpticalZoomFocalLength !=
+                NULL && s_cameraTapZoomHandler.TapZoomAtTarget != NULL);
+
+    // an idle camera arms no timer
+    TimerTest_AdvanceCamera(10000);
+    TEST_ASSERT(UtilTimer_GetArmedCount(s_cameraTimerService) == 0 && s_cameraTimerService->firedCount == 0);
+}
+
+/* Move the simulated clock forward, stopping at every deadline on the way like the timer task would. */
+static void TimerTest_AdvanceCamera(uint32_t durationMs)
+{
+    uint64_t endUs = s_nowUs + (uint64_t) durationMs * 1000;
+    uint64_t nextDeadlineUs = UTIL_TIMER_NO_DEADLINE;
+
+    UtilTimer_ServiceRunExpired(s_cameraTimerService, &nextDeadlineUs);
+    while (nextDeadlineUs <= endUs) {
+        if (nextDeadlineUs > s_nowUs) {
+            s_nowUs = nextDeadlineUs;
+        }
+        UtilTimer_ServiceRunExpired(s_cameraTimerService, &nextDeadlineUs);
+    }
+    s_nowUs = endUs;
+}
+
+static void TimerTest_RunCameraShooting(void)
+{
+    T_DjiCameraPhotoTimeIntervalSettings intervalSettings = {.captureCount = 3, .timeIntervalSeconds = 2};
+    T_DjiCameraSystemState systemState = {0};
+    T_DjiCameraSDCardState sdCardState = {0};
+    uint32_t remainSpaceInMB;
+
+    // a single photo is stored after the shooting time
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSDCardState(&sdCardState));
+    remainSpaceInMB = sdCardState.remainSpaceInMB;
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.SetShootPhotoMode(DJI_CAMERA_SHOOT_PHOTO_MODE_SINGLE));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.StartShootPhoto());
+    TimerTest_AdvanceCamera(CAMERA_TEST_PHOTO_TIME_MS - 1);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSDCardState(&sdCardState));
+    TEST_ASSERT(systemState.isStoring == true && sdCardState.remainSpaceInMB == remainSpaceInMB);
+    TimerTest_AdvanceCamera(1);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSDCardState(&sdCardState));
+    TEST_ASSERT(systemState.shootingState == DJI_CAMERA_SHOOTING_PHOTO_IDLE &&
+                sdCardState.remainSpaceInMB == remainSpaceInMB - CAMERA_TEST_PHOTO_SPACE_IN_MB);
+
+    // a burst of 3 photos is stored at once after the shooting time
+    remainSpaceInMB = sdCardState.remainSpaceInMB;
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.SetShootPhotoMode(DJI_CAMERA_SHOOT_PHOTO_MODE_BURST));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.SetPhotoBurstCount(DJI_CAMERA_BURST_COUNT_3));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.StartShootPhoto());
+    TimerTest_AdvanceCamera(CAMERA_TEST_PHOTO_TIME_MS - 1);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT(systemState.shootingState == DJI_CAMERA_SHOOTING_BURST_PHOTO);
+    TimerTest_AdvanceCamera(1);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSDCardState(&sdCardState));
+    TEST_ASSERT(systemState.shootingState == DJI_CAMERA_SHOOTING_PHOTO_IDLE &&
+                sdCardState.remainSpaceInMB == remainSpaceInMB - 3 * CAMERA_TEST_PHOTO_SPACE_IN_MB);
+
+    // 3 interval photos every 2 s, the first one right away and the next ones on the grid of the first
+    remainSpaceInMB = sdCardState.remainSpaceInMB;
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.SetShootPhotoMode(DJI_CAMERA_SHOOT_PHOTO_MODE_INTERVAL));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.SetPhotoTimeIntervalSettings(intervalSettings));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.StartShootPhoto());
+    TimerTest_AdvanceCamera(0);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT(systemState.shootingState == DJI_CAMERA_SHOOTING_INTERVAL_PHOTO &&
+                systemState.currentPhotoShootingIntervalCount == 2);
+    TimerTest_AdvanceCamera(CAMERA_TEST_PHOTO_TIME_MS);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSDCardState(&sdCardState));
+    TEST_ASSERT(systemState.currentPhotoShootingIntervalTimeInSeconds == 2 &&
+                sdCardState.remainSpaceInMB == remainSpaceInMB - CAMERA_TEST_PHOTO_SPACE_IN_MB);
+    TimerTest_AdvanceCamera(intervalSettings.timeIntervalSeconds * 1000 - CAMERA_TEST_PHOTO_TIME_MS - 1);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT(systemState.currentPhotoShootingIntervalCount == 2);
+    TimerTest_AdvanceCamera(1);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT(systemState.currentPhotoShootingIntervalCount == 1);
+    TimerTest_AdvanceCamera(intervalSettings.timeIntervalSeconds * 1000);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT(systemState.currentPhotoShootingIntervalCount == 0 && systemState.isShootingIntervalStart == false);
+
+    // the last interval photo is stored too, then nothing is armed any more
+    TimerTest_AdvanceCamera(10000);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSDCardState(&sdCardState));
+    TEST_ASSERT(systemState.shootingState == DJI_CAMERA_SHOOTING_PHOTO_IDLE &&
+                sdCardState.remainSpaceInMB == remainSpaceInMB - 3 * CAMERA_TEST_PHOTO_SPACE_IN_MB);
+    TEST_ASSERT(UtilTimer_GetArmedCount(s_cameraTimerService) == 0);
+}
+
+static void TimerTest_RunCameraRecording(void)
+{
+    T_DjiCameraSystemState systemState = {0};
+    T_DjiCameraSDCardState sdCardState = {0};
+    uint32_t remainSpaceInMB;
+
+    // every recorded second is counted on its tick and not before
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSDCardState(&sdCardState));
+    remainSpaceInMB = sdCardState.remainSpaceInMB;
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.SetMode(DJI_CAMERA_MODE_RECORD_VIDEO));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.StartRecordVideo());
+    TimerTest_AdvanceCamera(3 * CAMERA_TEST_RECORD_PERIOD_MS - 1);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT(systemState.currentVideoRecordingTimeInSeconds == 2);
+    TimerTest_AdvanceCamera(1);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSystemState(&systemState));
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.GetSDCardState(&sdCardState));
+    TEST_ASSERT(systemState.currentVideoRecordingTimeInSeconds == 3 &&
+                sdCardState.remainSpaceInMB == remainSpaceInMB - 3 * CAMERA_TEST_RECORD_SPACE_IN_MB);
+
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.StopRecordVideo());
+    TEST_ASSERT(UtilTimer_GetArmedCount(s_cameraTimerService) == 0);
+    TEST_ASSERT_SUCCESS(s_cameraCommonHandler.SetMode(DJI_CAMERA_MODE_SHOOT_PHOTO));
+}
+
+static void TimerTest_RunCameraZoom(void)
+{
+    T_DjiCameraPointInScreen tapTarget = {.focusX = 0.7f, .focusY = 0.5f};
+    T_DjiCameraTapZoomState tapZoomState = {0};
+    uint32_t focalLength = 0;
+    uint32_t zoomedFocalLength = 0;
+    uint32_t firedCount;
+
+    // the continuous optical zoom steps every 100 ms until it is stopped
+    TEST_ASSERT_SUCCESS(s_cameraOpticalZoomHandler.GetOpticalZoomFocalLength(&focalLength));
+    TEST_ASSERT_SUCCESS(s_cameraOpticalZoomHandler.StartContinuousOpticalZoom(DJI_CAMERA_ZOOM_DIRECTION_IN,
+                                                                              DJI_CAMERA_ZOOM_SPEED_NORMAL));
+    TimerTest_AdvanceCamera(1000);
+    TEST_ASSERT_SUCCESS(s_cameraOpticalZoomHandler.StopContinuousOpticalZoom());
+    TEST_ASSERT_SUCCESS(s_cameraOpticalZoomHandler.GetOpticalZoomFocalLength(&zoomedFocalLength));
+    TEST_ASSERT(zoomedFocalLength == focalLength + (1000 / CAMERA_TEST_ZOOM_PERIOD_MS) *
+                                    (DJI_CAMERA_ZOOM_SPEED_NORMAL - DJI_CAMERA_ZOOM_SPEED_SLOWEST + 1) *
+                                    CAMERA_TEST_ZOOM_CTRL_STEP);
+    TEST_ASSERT(UtilTimer_GetArmedCount(s_cameraTimerService) == 0);
+
+    // a tap rotates the gimbal and zooms in right away, then goes idle after the tap zoom duration
+    TEST_ASSERT_SUCCESS(s_cameraTapZoomHandler.SetTapZoomEnabled(true));
+    TEST_ASSERT_SUCCESS(s_cameraTapZoomHandler.SetTapZoomMultiplier(2));
+    TEST_ASSERT_SUCCESS(s_cameraTapZoomHandler.TapZoomAtTarget(tapTarget));
+    TimerTest_AdvanceCamera(0);
+    TEST_ASSERT_SUCCESS(s_cameraTapZoomHandler.GetTapZoomState(&tapZoomState));
+    TEST_ASSERT(s_gimbalRotationCount == 1 && tapZoomState.isGimbalMoving == true &&
+                tapZoomState.zoomState == DJI_CAMERA_TAP_ZOOM_STATE_ZOOM_IN);
+    TimerTest_AdvanceCamera(CAMERA_TEST_TAP_ZOOM_TIME_MS - 1);
+    TEST_ASSERT_SUCCESS(s_cameraTapZoomHandler.GetTapZoomState(&tapZoomState));
+    TEST_ASSERT(tapZoomState.zoomState == DJI_CAMERA_TAP_ZOOM_STATE_ZOOM_IN);
+    TimerTest_AdvanceCamera(1);
+    TEST_ASSERT_SUCCESS(s_cameraTapZoomHandler.GetTapZoomState(&tapZoomState));
+    TEST_ASSERT(tapZoomState.zoomState == DJI_CAMERA_TAP_ZOOM_STATE_IDLE && tapZoomState.isGimbalMoving == false);
+
+    // an idle camera fires no timer
+    firedCount = s_cameraTimerService->firedCount;
+    TimerTest_AdvanceCamera(60000);
+    TEST_ASSERT(UtilTimer_GetArmedCount(s_cameraTimerService) == 0 && s_cameraTimerService->firedCount == firedCount);
+    TEST_ASSERT(s_gimbalRotationCount == 1);
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,96 @@
+/**
+ ********************************************************************
+ * @file    test_common.c
+ * @brief   Shared setup of the host tests, registers the platform handlers the samples
+ * expect from the psdk.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_common.h"
+#include <string.h>
+#include <sys/stat.h>
+#include "dji_platform.h"
+#include "dji_logger.h"
+#include "osal/osal.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define TEST_COMMON_OUTPUT_DIR_ROOT     "test_output"
+#define TEST_COMMON_OUTPUT_DIR_SIZE     (256)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static char s_outputDir[TEST_COMMON_OUTPUT_DIR_SIZE];
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode TestCommon_PrintConsole(const uint8_t *data, uint16_t dataLen);
+
+/* Exported functions definition ---------------------------------------------*/
+void TestCommon_Init(void)
+{
+    static T_DjiOsalHandler osalHandler = {
+        .TaskCreate = Osal_TaskCreate,
+        .TaskDestroy = Osal_TaskDestroy,
+        .TaskSleepMs = Osal_TaskSleepMs,
+        .MutexCreate = Osal_MutexCreate,
+        .MutexDestroy = Osal_MutexDestroy,
+        .MutexLock = Osal_MutexLock,
+        .MutexUnlock = Osal_MutexUnlock,
+        .SemaphoreCreate = Osal_SemaphoreCreate,
+        .SemaphoreDestroy = Osal_SemaphoreDestroy,
+        .SemaphoreWait = Osal_SemaphoreWait,
+        .SemaphoreTimedWait = Osal_SemaphoreTimedWait,
+        .SemaphorePost = Osal_SemaphorePost,
+        .Malloc = Osal_Malloc,
+        .Free = Osal_Free,
+        .GetTimeMs = Osal_GetTimeMs,
+        .GetTimeUs = Osal_GetTimeUs,
+        .GetRandomNum = Osal_GetRandomNum,
+    };
+    static T_DjiLoggerConsole printConsole = {
+        .func = TestCommon_PrintConsole,
+        .consoleLevel = DJI_LOGGER_CONSOLE_LOG_LEVEL_INFO,
+        .isSupportColor = false,
+    };
+
+    TEST_ASSERT_SUCCESS(DjiPlatform_RegOsalHandler(&osalHandler));
+    TEST_ASSERT_SUCCESS(DjiLogger_AddConsole(&printConsole));
+}
+
+const char *TestCommon_GetOutputDir(const char *testName)
+{
+    mkdir(TEST_COMMON_OUTPUT_DIR_ROOT, 0755);
+    snprintf(s_outputDir, sizeof(s_outputDir), "%s/%s", TEST_COMMON_OUTPUT_DIR_ROOT, testName);
+    mkdir(s_outputDir, 0755);
+
+    return s_outputDir;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static T_DjiReturnCode TestCommon_PrintConsole(const uint8_t *data, uint16_t dataLen)
+{
+    fwrite(data, 1, dataLen, stdout);
+    fflush(stdout);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
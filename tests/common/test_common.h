@@ -0,0 +1,73 @@
+/**
+ ********************************************************************
+ * @file    test_common.h
+ * @brief   This is the header file for "test_common.c", defining the structure and
+ * (exported) function prototypes.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "dji_typedef.h"
+#include "dji_error.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Exported constants --------------------------------------------------------*/
+#define TEST_ASSERT(condition) \
+    do { \
+        if (!(condition)) { \
+            printf("%s:%d: assertion failed: %s\n", __FILE__, __LINE__, #condition); \
+            exit(1); \
+        } \
+    } while (0)
+
+#define TEST_ASSERT_SUCCESS(returnCode) TEST_ASSERT((returnCode) == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS)
+
+/* Exported types ------------------------------------------------------------*/
+
+/* Exported functions --------------------------------------------------------*/
+/**
+ * @brief Register the Linux osal and a stdout logger console, so modules under test run as they do in the samples.
+ */
+void TestCommon_Init(void);
+/**
+ * @brief Directory for files written by a test, created below the working directory of the test run.
+ */
+const char *TestCommon_GetOutputDir(const char *testName);
+/**
+ * @brief Delay the osal semaphore posts of the calling thread, so that a racing destroy lands between the caller taking
+ * the handle and using it. Only for tests linked with sample_poison_osal_locks().
+ */
+void TestCommon_SetSemaphorePostDelayUs(uint32_t delayUs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEST_COMMON_H
+/************************ (C) COPYRIGHT DJI Innovations *******END OF FILE******/
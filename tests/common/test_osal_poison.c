@@ -0,0 +1,113 @@
+/**
+ ********************************************************************
+ * @file    test_osal_poison.c
+ * @brief   Wrappers of the Linux osal mutex and semaphore, a destroyed one is poisoned and leaked rather than
+ * freed, so that a use after the destroy fails the test instead of going unnoticed.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
+#include "test_common.h"
+#include "osal/osal.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define TEST_OSAL_POISON            (0xA5)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static __thread uint32_t s_semaphorePostDelayUs = 0;
+
+/* Private functions declaration ---------------------------------------------*/
+static bool TestOsal_IsPoisoned(const void *object, uint32_t size);
+T_DjiReturnCode __wrap_Osal_MutexDestroy(T_DjiMutexHandle mutex);
+T_DjiReturnCode __wrap_Osal_MutexLock(T_DjiMutexHandle mutex);
+T_DjiReturnCode __real_Osal_MutexLock(T_DjiMutexHandle mutex);
+T_DjiReturnCode __wrap_Osal_SemaphoreDestroy(T_DjiSemaHandle semaphore);
+T_DjiReturnCode __wrap_Osal_SemaphorePost(T_DjiSemaHandle semaphore);
+T_DjiReturnCode __real_Osal_SemaphorePost(T_DjiSemaHandle semaphore);
+
+/* Exported functions definition ---------------------------------------------*/
+void TestCommon_SetSemaphorePostDelayUs(uint32_t delayUs)
+{
+    s_semaphorePostDelayUs = delayUs;
+}
+
+T_DjiReturnCode __wrap_Osal_MutexDestroy(T_DjiMutexHandle mutex)
+{
+    if (mutex == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    TEST_ASSERT(pthread_mutex_destroy(mutex) == 0);
+    memset(mutex, TEST_OSAL_POISON, sizeof(pthread_mutex_t));
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_Osal_MutexLock(T_DjiMutexHandle mutex)
+{
+    TEST_ASSERT(mutex == NULL || TestOsal_IsPoisoned(mutex, sizeof(pthread_mutex_t)) == false);
+
+    return __real_Osal_MutexLock(mutex);
+}
+
+T_DjiReturnCode __wrap_Osal_SemaphoreDestroy(T_DjiSemaHandle semaphore)
+{
+    if (semaphore == NULL) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER;
+    }
+
+    TEST_ASSERT(sem_destroy(semaphore) == 0);
+    memset(semaphore, TEST_OSAL_POISON, sizeof(sem_t));
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_Osal_SemaphorePost(T_DjiSemaHandle semaphore)
+{
+    if (s_semaphorePostDelayUs > 0) {
+        usleep(s_semaphorePostDelayUs);
+    }
+    TEST_ASSERT(semaphore == NULL || TestOsal_IsPoisoned(semaphore, sizeof(sem_t)) == false);
+
+    return __real_Osal_SemaphorePost(semaphore);
+}
+
+/* Private functions definition-----------------------------------------------*/
+static bool TestOsal_IsPoisoned(const void *object, uint32_t size)
+{
+    const uint8_t *bytes = object;
+    uint32_t i;
+
+    for (i = 0; i < size; i++) {
+        if (bytes[i] != TEST_OSAL_POISON) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,276 @@
+/**
+ ********************************************************************
+ * @file    data_transmission_pump_test.c
+ * @brief   Runs the data transmission message pump against its loopback backend, checking
+ * that queued data arrives in order and that the send rate backs off on a busy link.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "test_common.h"
+#include "dji_platform.h"
+#include "data_transmission/test_data_transmission_pump.h"
+#include "utils/util_misc.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define PUMP_TEST_CHANNEL               DJI_CHANNEL_ADDRESS_MASTER_RC_APP
+#define PUMP_TEST_QUEUE_SIZE            (1024)
+#define PUMP_TEST_MESSAGE_SIZE          (50)
+#define PUMP_TEST_MESSAGE_NUM           (20)
+#define PUMP_TEST_BANDWIDTH_LIMIT       (300)
+#define PUMP_TEST_WAIT_TIME_MS          (5000)
+#define PUMP_TEST_DRAIN_TIME_MS         (20000)
+#define PUMP_TEST_REFUSE_INTERVAL       (3)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static uint8_t s_sentData[PUMP_TEST_MESSAGE_SIZE * PUMP_TEST_MESSAGE_NUM];
+static uint8_t s_recvData[PUMP_TEST_MESSAGE_SIZE * PUMP_TEST_MESSAGE_NUM];
+static volatile uint32_t s_recvLen = 0;
+static volatile uint32_t s_recvOversizeCount = 0;
+static uint32_t s_sendCallCount = 0;
+static T_DjiReturnCode s_sendFailureCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+/* Private functions declaration ---------------------------------------------*/
+static void PumpTest_RecvCallback(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len);
+static T_DjiReturnCode PumpTest_RefusingSendData(E_DjiChannelAddress channelAddress, const uint8_t *data,
+                                                 uint16_t len);
+static T_DjiReturnCode PumpTest_RefusingGetSendDataState(E_DjiChannelAddress channelAddress,
+                                                         T_DjiDataChannelState *state);
+static void PumpTest_SendMessages(void);
+static void PumpTest_WaitDrained(T_DjiTestDataPumpChannelStatistics *statistics);
+static void PumpTest_WaitBusy(T_DjiTestDataPumpChannelStatistics *statistics);
+static void PumpTest_RunLoopback(void);
+static void PumpTest_RunBusyLink(void);
+static void PumpTest_RunRefusingLink(void);
+static void PumpTest_RunFailingLink(void);
+
+/* Private variables ---------------------------------------------------------*/
+/* Refuses every few frames with the given error while the channel state never reports busy. */
+static const T_DjiTestDataPumpBackend s_refusingBackend = {
+    .SendData = PumpTest_RefusingSendData,
+    .GetSendDataState = PumpTest_RefusingGetSendDataState,
+};
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+
+    for (uint32_t i = 0; i < sizeof(s_sentData); i++) {
+        s_sentData[i] = (uint8_t) (i * 7 + i / 251);
+    }
+
+    PumpTest_RunLoopback();
+    PumpTest_RunBusyLink();
+    PumpTest_RunRefusingLink();
+    PumpTest_RunFailingLink();
+
+    printf("data transmission pump test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void PumpTest_RunLoopback(void)
+{
+    T_DjiTestDataPumpChannelStatistics statistics = {0};
+
+    s_recvLen = 0;
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpInit(DjiTest_DataPumpGetLoopbackBackend(0), PumpTest_RecvCallback));
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpEnableChannel(PUMP_TEST_CHANNEL, PUMP_TEST_QUEUE_SIZE,
+                                                      DJI_TEST_DATA_PUMP_LOW_SPEED_FRAME_SIZE));
+
+    PumpTest_SendMessages();
+    PumpTest_WaitDrained(&statistics);
+
+    /* Every byte arrives once and in order, coalesced into frames no larger than the channel frame. */
+    TEST_ASSERT(statistics.queuedBytes == sizeof(s_sentData));
+    TEST_ASSERT(statistics.sentBytes == sizeof(s_sentData));
+    TEST_ASSERT(statistics.droppedBytes == 0);
+    TEST_ASSERT(statistics.sentFrames >= sizeof(s_sentData) / DJI_TEST_DATA_PUMP_LOW_SPEED_FRAME_SIZE);
+    TEST_ASSERT(s_recvLen == sizeof(s_sentData));
+    TEST_ASSERT(memcmp(s_recvData, s_sentData, sizeof(s_sentData)) == 0);
+    TEST_ASSERT(s_recvOversizeCount == 0);
+
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpDeInit());
+}
+
+static void PumpTest_RunBusyLink(void)
+{
+    T_DjiTestDataPumpChannelStatistics statistics = {0};
+
+    s_recvLen = 0;
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpInit(DjiTest_DataPumpGetLoopbackBackend(PUMP_TEST_BANDWIDTH_LIMIT),
+                                             PumpTest_RecvCallback));
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpEnableChannel(PUMP_TEST_CHANNEL, PUMP_TEST_QUEUE_SIZE,
+                                                      DJI_TEST_DATA_PUMP_LOW_SPEED_FRAME_SIZE));
+
+    PumpTest_SendMessages();
+    PumpTest_WaitBusy(&statistics);
+
+    /* The link takes less than the default rate, so the pump has to see it busy and lower its own rate. */
+    TEST_ASSERT(statistics.rateLimitBytesPerSecond < 1024);
+    TEST_ASSERT(statistics.sentBytes + statistics.droppedBytes <= sizeof(s_sentData));
+    TEST_ASSERT(statistics.sentBytes <= PUMP_TEST_BANDWIDTH_LIMIT * (PUMP_TEST_WAIT_TIME_MS / 1000 + 1));
+
+    /* Frames the link refused are sent again after the backoff, nothing is lost or reordered. */
+    PumpTest_WaitDrained(&statistics);
+    TEST_ASSERT(statistics.sentBytes == sizeof(s_sentData));
+    TEST_ASSERT(statistics.droppedBytes == 0);
+    TEST_ASSERT(s_recvLen == sizeof(s_sentData));
+    TEST_ASSERT(memcmp(s_recvData, s_sentData, sizeof(s_sentData)) == 0);
+
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpDeInit());
+}
+
+static void PumpTest_RunRefusingLink(void)
+{
+    T_DjiTestDataPumpChannelStatistics statistics = {0};
+
+    s_recvLen = 0;
+    s_sendCallCount = 0;
+    s_sendFailureCode = DJI_ERROR_SYSTEM_MODULE_CODE_BUSY;
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpInit(&s_refusingBackend, PumpTest_RecvCallback));
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpEnableChannel(PUMP_TEST_CHANNEL, PUMP_TEST_QUEUE_SIZE,
+                                                      DJI_TEST_DATA_PUMP_LOW_SPEED_FRAME_SIZE));
+
+    PumpTest_SendMessages();
+    PumpTest_WaitDrained(&statistics);
+
+    /* A refused send alone starts the backoff, even though the channel state never reports busy. */
+    TEST_ASSERT(statistics.busyCount > 0);
+    TEST_ASSERT(s_sendCallCount > statistics.sentFrames);
+    TEST_ASSERT(statistics.sentBytes == sizeof(s_sentData));
+    TEST_ASSERT(statistics.droppedBytes == 0);
+    TEST_ASSERT(s_recvLen == sizeof(s_sentData));
+    TEST_ASSERT(memcmp(s_recvData, s_sentData, sizeof(s_sentData)) == 0);
+
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpDeInit());
+}
+
+static void PumpTest_RunFailingLink(void)
+{
+    T_DjiTestDataPumpChannelStatistics statistics = {0};
+
+    s_recvLen = 0;
+    s_sendCallCount = 0;
+    s_sendFailureCode = DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT;
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpInit(&s_refusingBackend, PumpTest_RecvCallback));
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpEnableChannel(PUMP_TEST_CHANNEL, PUMP_TEST_QUEUE_SIZE,
+                                                      DJI_TEST_DATA_PUMP_LOW_SPEED_FRAME_SIZE));
+
+    PumpTest_SendMessages();
+    PumpTest_WaitDrained(&statistics);
+
+    /* A frame failing with an error that is not retryable is dropped once, the rest still goes out. */
+    TEST_ASSERT(statistics.busyCount == 0);
+    TEST_ASSERT(s_sendCallCount == statistics.sentFrames + s_sendCallCount / PUMP_TEST_REFUSE_INTERVAL);
+    TEST_ASSERT(statistics.droppedBytes > 0);
+    TEST_ASSERT(statistics.sentBytes + statistics.droppedBytes == sizeof(s_sentData));
+    TEST_ASSERT(s_recvLen == statistics.sentBytes);
+
+    TEST_ASSERT_SUCCESS(DjiTest_DataPumpDeInit());
+}
+
+static void PumpTest_SendMessages(void)
+{
+    for (int i = 0; i < PUMP_TEST_MESSAGE_NUM; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_DataPumpSend(PUMP_TEST_CHANNEL, &s_sentData[i * PUMP_TEST_MESSAGE_SIZE],
+                                                 PUMP_TEST_MESSAGE_SIZE));
+    }
+}
+
+static void PumpTest_WaitDrained(T_DjiTestDataPumpChannelStatistics *statistics)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t waitTimeMs = 0;
+
+    while (waitTimeMs < PUMP_TEST_DRAIN_TIME_MS) {
+        TEST_ASSERT_SUCCESS(DjiTest_DataPumpGetStatistics(PUMP_TEST_CHANNEL, statistics));
+        if (statistics->sentBytes + statistics->droppedBytes == statistics->queuedBytes &&
+            s_recvLen == statistics->sentBytes) {
+            return;
+        }
+        osalHandler->TaskSleepMs(10);
+        waitTimeMs += 10;
+    }
+
+    printf("pump not drained: queued %u sent %u dropped %u received %u\n", statistics->queuedBytes,
+           statistics->sentBytes, statistics->droppedBytes, s_recvLen);
+    TEST_ASSERT(false);
+}
+
+static void PumpTest_WaitBusy(T_DjiTestDataPumpChannelStatistics *statistics)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    uint32_t waitTimeMs = 0;
+
+    while (waitTimeMs < PUMP_TEST_WAIT_TIME_MS) {
+        TEST_ASSERT_SUCCESS(DjiTest_DataPumpGetStatistics(PUMP_TEST_CHANNEL, statistics));
+        if (statistics->busyCount > 0) {
+            return;
+        }
+        osalHandler->TaskSleepMs(10);
+        waitTimeMs += 10;
+    }
+
+    printf("pump never saw the link busy: sent %u dropped %u\n", statistics->sentBytes, statistics->droppedBytes);
+    TEST_ASSERT(false);
+}
+
+static T_DjiReturnCode PumpTest_RefusingSendData(E_DjiChannelAddress channelAddress, const uint8_t *data,
+                                                 uint16_t len)
+{
+    /* Only the pump task sends, so the counter needs no lock. */
+    s_sendCallCount++;
+    if (s_sendCallCount % PUMP_TEST_REFUSE_INTERVAL == 0) {
+        return s_sendFailureCode;
+    }
+
+    return DjiTest_DataPumpPushRecvData(channelAddress, data, len);
+}
+
+static T_DjiReturnCode PumpTest_RefusingGetSendDataState(E_DjiChannelAddress channelAddress,
+                                                         T_DjiDataChannelState *state)
+{
+    USER_UTIL_UNUSED(channelAddress);
+
+    memset(state, 0, sizeof(*state));
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void PumpTest_RecvCallback(E_DjiChannelAddress channelAddress, const uint8_t *data, uint16_t len)
+{
+    TEST_ASSERT(channelAddress == PUMP_TEST_CHANNEL);
+
+    if (len > DJI_TEST_DATA_PUMP_LOW_SPEED_FRAME_SIZE) {
+        s_recvOversizeCount++;
+    }
+
+    if (s_recvLen + len <= sizeof(s_recvData)) {
+        memcpy(&s_recvData[s_recvLen], data, len);
+    }
+    s_recvLen += len;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
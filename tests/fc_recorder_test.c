@@ -0,0 +1,367 @@
+/**
+ ********************************************************************
+ * @file    fc_recorder_test.c
+ * @brief   Records a synthetic topic stream through the subscription callbacks, converts it with fc_recorder2csv
+ * and compares every decoded value, also after a short write in the middle of the recording.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "test_common.h"
+#include "dji_platform.h"
+#include "osal/osal_fs.h"
+#include "fc_subscription/test_fc_subscription_recorder.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define RECORDER_TEST_TOPIC_NUM                 (2)
+#define RECORDER_TEST_QUATERNION_INDEX          (0)
+#define RECORDER_TEST_BATTERY_INDEX             (1)
+/* Block capacity of a 200Hz topic, one second of records. */
+#define RECORDER_TEST_BLOCK_RECORD_NUM          (200)
+#define RECORDER_TEST_PARTIAL_RECORD_NUM        (50)
+#define RECORDER_TEST_BATTERY_RECORD_NUM        (3)
+#define RECORDER_TEST_WAIT_MS                   (3000)
+#define RECORDER_TEST_PATH_SIZE                 (256)
+#define RECORDER_TEST_LINE_SIZE                 (512)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static const T_DjiTestFcSubscriptionRecorderTopic s_topics[RECORDER_TEST_TOPIC_NUM] = {
+    {DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,                 0},
+    {DJI_FC_SUBSCRIPTION_TOPIC_BATTERY_SINGLE_INFO_INDEX1, 0},
+};
+
+static DjiReceiveDataOfTopicCallback s_sdkCallbacks[RECORDER_TEST_TOPIC_NUM];
+static uint32_t s_unsubscribeCount = 0;
+static volatile bool s_isNextWriteShort = false;
+static const char *s_outputDir = NULL;
+
+/* Private functions declaration ---------------------------------------------*/
+static void RecorderTest_RunRoundTrip(void);
+static void RecorderTest_RunShortWrite(void);
+static void RecorderTest_FeedQuaternions(uint32_t firstIndex, uint32_t count);
+static void RecorderTest_FeedBatteries(uint32_t count);
+static void RecorderTest_WaitStatistics(uint32_t blockCount, uint32_t writeErrorCount);
+static int RecorderTest_Convert(const char *recordingPath, const char *csvDir);
+static void RecorderTest_CheckQuaternionCsv(const char *csvDir, uint32_t recordCount);
+static void RecorderTest_CheckBatteryCsv(const char *csvDir, uint32_t recordCount);
+static void RecorderTest_GetQuaternion(uint32_t index, T_DjiFcSubscriptionQuaternion *quaternion,
+                                       T_DjiDataTimestamp *timestamp);
+static int RecorderTest_FindTopic(E_DjiFcSubscriptionTopic topic);
+static T_DjiReturnCode RecorderTest_FileWrite(T_DjiFileHandle fileObj, const uint8_t *buf, uint32_t len,
+                                              uint32_t *realLen);
+T_DjiReturnCode __wrap_DjiFcSubscription_SubscribeTopic(E_DjiFcSubscriptionTopic topic,
+                                                        E_DjiDataSubscriptionTopicFreq frequency,
+                                                        DjiReceiveDataOfTopicCallback callback);
+T_DjiReturnCode __wrap_DjiFcSubscription_UnSubscribeTopic(E_DjiFcSubscriptionTopic topic);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    static const T_DjiFileSystemHandler fileSystemHandler = {
+        .FileOpen = Osal_FileOpen,
+        .FileClose = Osal_FileClose,
+        .FileWrite = RecorderTest_FileWrite,
+        .FileRead = Osal_FileRead,
+        .FileSync = Osal_FileSync,
+        .FileSeek = Osal_FileSeek,
+        .DirOpen = Osal_DirOpen,
+        .DirClose = Osal_DirClose,
+        .DirRead = Osal_DirRead,
+        .Mkdir = Osal_Mkdir,
+        .Unlink = Osal_Unlink,
+        .Rename = Osal_Rename,
+        .Stat = Osal_Stat,
+    };
+
+    TestCommon_Init();
+    TEST_ASSERT_SUCCESS(DjiPlatform_RegFileSystemHandler(&fileSystemHandler));
+    s_outputDir = TestCommon_GetOutputDir("fc_recorder_test");
+
+    RecorderTest_RunRoundTrip();
+    RecorderTest_RunShortWrite();
+
+    printf("fc recorder test passed\n");
+    return 0;
+}
+
+/* Stubs of the psdk subscription calls, linked with --wrap, the test calls the captured callbacks as the sdk would. */
+T_DjiReturnCode __wrap_DjiFcSubscription_SubscribeTopic(E_DjiFcSubscriptionTopic topic,
+                                                        E_DjiDataSubscriptionTopicFreq frequency,
+                                                        DjiReceiveDataOfTopicCallback callback)
+{
+    int index = RecorderTest_FindTopic(topic);
+
+    TEST_ASSERT(index >= 0 && callback != NULL);
+    if (index == RECORDER_TEST_QUATERNION_INDEX) {
+        TEST_ASSERT(frequency == DJI_DATA_SUBSCRIPTION_TOPIC_200_HZ);
+    }
+    s_sdkCallbacks[index] = callback;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiFcSubscription_UnSubscribeTopic(E_DjiFcSubscriptionTopic topic)
+{
+    TEST_ASSERT(RecorderTest_FindTopic(topic) >= 0);
+    s_unsubscribeCount++;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void RecorderTest_RunRoundTrip(void)
+{
+    T_DjiTestFcSubscriptionRecorderStatistics statistics = {0};
+    char recordingPath[RECORDER_TEST_PATH_SIZE];
+    char csvDir[RECORDER_TEST_PATH_SIZE];
+    uint32_t recordCount = 2 * RECORDER_TEST_BLOCK_RECORD_NUM + RECORDER_TEST_PARTIAL_RECORD_NUM;
+
+    snprintf(recordingPath, sizeof(recordingPath), "%s/round_trip.rec", s_outputDir);
+    snprintf(csvDir, sizeof(csvDir), "%s/round_trip", s_outputDir);
+    mkdir(csvDir, 0755);
+
+    s_unsubscribeCount = 0;
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionRecorderStart(recordingPath, s_topics, RECORDER_TEST_TOPIC_NUM));
+
+    // Two full blocks written by the flush task, then a partial one and the battery records written by the stop
+    RecorderTest_FeedQuaternions(0, RECORDER_TEST_BLOCK_RECORD_NUM);
+    RecorderTest_WaitStatistics(1, 0);
+    RecorderTest_FeedQuaternions(RECORDER_TEST_BLOCK_RECORD_NUM, RECORDER_TEST_BLOCK_RECORD_NUM);
+    RecorderTest_WaitStatistics(2, 0);
+    RecorderTest_FeedQuaternions(2 * RECORDER_TEST_BLOCK_RECORD_NUM, RECORDER_TEST_PARTIAL_RECORD_NUM);
+    RecorderTest_FeedBatteries(RECORDER_TEST_BATTERY_RECORD_NUM);
+
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionRecorderStop());
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionRecorderGetStatistics(&statistics));
+    TEST_ASSERT(s_unsubscribeCount == RECORDER_TEST_TOPIC_NUM);
+    TEST_ASSERT(statistics.recordCount == recordCount + RECORDER_TEST_BATTERY_RECORD_NUM);
+    TEST_ASSERT(statistics.droppedCount == 0);
+    TEST_ASSERT(statistics.blockCount == 4);
+    TEST_ASSERT(statistics.writeErrorCount == 0);
+
+    TEST_ASSERT(RecorderTest_Convert(recordingPath, csvDir) == 0);
+    RecorderTest_CheckQuaternionCsv(csvDir, recordCount);
+    RecorderTest_CheckBatteryCsv(csvDir, RECORDER_TEST_BATTERY_RECORD_NUM);
+}
+
+static void RecorderTest_RunShortWrite(void)
+{
+    T_DjiTestFcSubscriptionRecorderStatistics statistics = {0};
+    char recordingPath[RECORDER_TEST_PATH_SIZE];
+    char csvDir[RECORDER_TEST_PATH_SIZE];
+
+    snprintf(recordingPath, sizeof(recordingPath), "%s/short_write.rec", s_outputDir);
+    snprintf(csvDir, sizeof(csvDir), "%s/short_write", s_outputDir);
+    mkdir(csvDir, 0755);
+
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionRecorderStart(recordingPath, s_topics, 1));
+
+    RecorderTest_FeedQuaternions(0, RECORDER_TEST_BLOCK_RECORD_NUM);
+    RecorderTest_WaitStatistics(1, 0);
+
+    // The header of the second block is cut in half, the recording goes on with the next block
+    s_isNextWriteShort = true;
+    RecorderTest_FeedQuaternions(RECORDER_TEST_BLOCK_RECORD_NUM, RECORDER_TEST_BLOCK_RECORD_NUM);
+    RecorderTest_WaitStatistics(1, 1);
+    RecorderTest_FeedQuaternions(2 * RECORDER_TEST_BLOCK_RECORD_NUM, RECORDER_TEST_PARTIAL_RECORD_NUM);
+
+    // The stop reports the first failed write
+    TEST_ASSERT(DjiTest_FcSubscriptionRecorderStop() == DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR);
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionRecorderGetStatistics(&statistics));
+    TEST_ASSERT(statistics.blockCount == 2);
+    TEST_ASSERT(statistics.writeErrorCount == 1);
+    TEST_ASSERT(s_isNextWriteShort == false);
+
+    // The converter keeps the blocks before the failed one and reports the corruption
+    TEST_ASSERT(RecorderTest_Convert(recordingPath, csvDir) != 0);
+    RecorderTest_CheckQuaternionCsv(csvDir, RECORDER_TEST_BLOCK_RECORD_NUM);
+}
+
+static void RecorderTest_FeedQuaternions(uint32_t firstIndex, uint32_t count)
+{
+    T_DjiFcSubscriptionQuaternion quaternion;
+    T_DjiDataTimestamp timestamp;
+    uint32_t i;
+
+    for (i = firstIndex; i < firstIndex + count; i++) {
+        RecorderTest_GetQuaternion(i, &quaternion, &timestamp);
+        TEST_ASSERT_SUCCESS(s_sdkCallbacks[RECORDER_TEST_QUATERNION_INDEX]((const uint8_t *) &quaternion,
+                                                                           sizeof(quaternion), &timestamp));
+    }
+}
+
+static void RecorderTest_FeedBatteries(uint32_t count)
+{
+    uint8_t battery[sizeof(T_DjiFcSubscriptionSingleBatteryInfo)];
+    T_DjiDataTimestamp timestamp = {0};
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0; i < count; i++) {
+        for (j = 0; j < sizeof(battery); j++) {
+            battery[j] = (uint8_t) (i * 16 + j);
+        }
+        timestamp.millisecond = i * 1000;
+        timestamp.microsecond = i * 1000000;
+        TEST_ASSERT_SUCCESS(s_sdkCallbacks[RECORDER_TEST_BATTERY_INDEX](battery, sizeof(battery), &timestamp));
+    }
+}
+
+static void RecorderTest_WaitStatistics(uint32_t blockCount, uint32_t writeErrorCount)
+{
+    T_DjiOsalHandler *osalHandler = DjiPlatform_GetOsalHandler();
+    T_DjiTestFcSubscriptionRecorderStatistics statistics = {0};
+    uint32_t waitTimeMs = 0;
+
+    while (waitTimeMs < RECORDER_TEST_WAIT_MS) {
+        TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionRecorderGetStatistics(&statistics));
+        if (statistics.blockCount == blockCount && statistics.writeErrorCount == writeErrorCount) {
+            return;
+        }
+        osalHandler->TaskSleepMs(5);
+        waitTimeMs += 5;
+    }
+
+    printf("recorder statistics not reached: %u blocks, %u write errors\n", statistics.blockCount,
+           statistics.writeErrorCount);
+    TEST_ASSERT(false);
+}
+
+static int RecorderTest_Convert(const char *recordingPath, const char *csvDir)
+{
+    char command[3 * RECORDER_TEST_PATH_SIZE];
+    int status;
+
+    snprintf(command, sizeof(command), "%s %s %s > %s/convert.log", FC_RECORDER_TEST_CONVERTER_PATH, recordingPath,
+             csvDir, csvDir);
+    status = system(command);
+    TEST_ASSERT(status != -1 && WIFEXITED(status));
+
+    return WEXITSTATUS(status);
+}
+
+static void RecorderTest_CheckQuaternionCsv(const char *csvDir, uint32_t recordCount)
+{
+    T_DjiFcSubscriptionQuaternion expected;
+    T_DjiDataTimestamp timestamp;
+    char path[RECORDER_TEST_PATH_SIZE];
+    char line[RECORDER_TEST_LINE_SIZE];
+    unsigned int millisecond;
+    unsigned int microsecond;
+    float q[4];
+    uint32_t i = 0;
+    FILE *file;
+
+    snprintf(path, sizeof(path), "%s/QUATERNION.csv", csvDir);
+    file = fopen(path, "r");
+    TEST_ASSERT(file != NULL);
+
+    TEST_ASSERT(fgets(line, sizeof(line), file) != NULL);
+    TEST_ASSERT(strcmp(line, "timestamp_ms,timestamp_us,q0,q1,q2,q3\n") == 0);
+
+    // The values are exact in a float and printed with enough digits to compare them exactly
+    while (fgets(line, sizeof(line), file) != NULL) {
+        TEST_ASSERT(i < recordCount);
+        TEST_ASSERT(sscanf(line, "%u,%u,%f,%f,%f,%f", &millisecond, &microsecond, &q[0], &q[1], &q[2], &q[3]) == 6);
+        RecorderTest_GetQuaternion(i, &expected, &timestamp);
+        TEST_ASSERT(millisecond == timestamp.millisecond && microsecond == timestamp.microsecond);
+        TEST_ASSERT(q[0] == expected.q0 && q[1] == expected.q1 && q[2] == expected.q2 && q[3] == expected.q3);
+        i++;
+    }
+    TEST_ASSERT(i == recordCount);
+
+    fclose(file);
+}
+
+static void RecorderTest_CheckBatteryCsv(const char *csvDir, uint32_t recordCount)
+{
+    char path[RECORDER_TEST_PATH_SIZE];
+    char line[RECORDER_TEST_LINE_SIZE];
+    char expected[RECORDER_TEST_LINE_SIZE];
+    uint32_t offset;
+    uint32_t i = 0;
+    uint32_t j;
+    FILE *file;
+
+    snprintf(path, sizeof(path), "%s/BATTERY_SINGLE_INFO_INDEX1.csv", csvDir);
+    file = fopen(path, "r");
+    TEST_ASSERT(file != NULL);
+
+    // A topic without layout is dumped as hex
+    TEST_ASSERT(fgets(line, sizeof(line), file) != NULL);
+    TEST_ASSERT(strcmp(line, "timestamp_ms,timestamp_us,data\n") == 0);
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        TEST_ASSERT(i < recordCount);
+        offset = (uint32_t) snprintf(expected, sizeof(expected), "%u,%u,", i * 1000, i * 1000000);
+        for (j = 0; j < sizeof(T_DjiFcSubscriptionSingleBatteryInfo); j++) {
+            offset += (uint32_t) snprintf(&expected[offset], sizeof(expected) - offset, "%02X",
+                                          (uint8_t) (i * 16 + j));
+        }
+        snprintf(&expected[offset], sizeof(expected) - offset, "\n");
+        TEST_ASSERT(strcmp(line, expected) == 0);
+        i++;
+    }
+    TEST_ASSERT(i == recordCount);
+
+    fclose(file);
+}
+
+static void RecorderTest_GetQuaternion(uint32_t index, T_DjiFcSubscriptionQuaternion *quaternion,
+                                       T_DjiDataTimestamp *timestamp)
+{
+    quaternion->q0 = (dji_f32_t) index * 0.25f;
+    quaternion->q1 = -(dji_f32_t) index;
+    quaternion->q2 = 1.0f / 1024 * (dji_f32_t) (index % 7);
+    quaternion->q3 = 1000000.0f + (dji_f32_t) index;
+    timestamp->millisecond = 5000 + index * 5;
+    timestamp->microsecond = (5000 + index * 5) * 1000 + index % 1000;
+}
+
+static int RecorderTest_FindTopic(E_DjiFcSubscriptionTopic topic)
+{
+    for (int i = 0; i < RECORDER_TEST_TOPIC_NUM; i++) {
+        if (s_topics[i].topic == topic) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/* Writes only half of the data once when asked, as a full disk would. */
+static T_DjiReturnCode RecorderTest_FileWrite(T_DjiFileHandle fileObj, const uint8_t *buf, uint32_t len,
+                                              uint32_t *realLen)
+{
+    if (s_isNextWriteShort) {
+        s_isNextWriteShort = false;
+        return Osal_FileWrite(fileObj, buf, len / 2, realLen);
+    }
+
+    return Osal_FileWrite(fileObj, buf, len, realLen);
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,321 @@
+/**
+ ********************************************************************
+ * @file    fc_subscription_cache_test.c
+ * @brief   Hammers the fc subscription cache with a writer on the subscription callbacks and concurrent readers,
+ * checking that no value is torn, that snapshots are consistent cuts and that init and deinit can race.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <pthread.h>
+#include "test_common.h"
+#include "dji_platform.h"
+#include "fc_subscription/test_fc_subscription_cache.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define CACHE_TEST_TOPIC_NUM                (3)
+#define CACHE_TEST_DATA_SIZE_MAX            (sizeof(T_DjiFcSubscriptionPositionFused))
+#define CACHE_TEST_READER_NUM               (3)
+#define CACHE_TEST_WRITE_NUM                (200000)
+#define CACHE_TEST_INIT_TASK_NUM            (4)
+#define CACHE_TEST_INIT_LOOP_NUM            (1000000)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t snapshotCount;
+    uint32_t busyCount;
+    uint32_t tornCount;
+    uint32_t inconsistentCount;
+} T_CacheTestReader;
+
+/* Private values -------------------------------------------------------------*/
+static const struct {
+    E_DjiFcSubscriptionTopic topic;
+    uint16_t dataSize;
+} s_topics[CACHE_TEST_TOPIC_NUM] = {
+    {DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION,     sizeof(T_DjiFcSubscriptionQuaternion)},
+    {DJI_FC_SUBSCRIPTION_TOPIC_VELOCITY,       sizeof(T_DjiFcSubscriptionVelocity)},
+    {DJI_FC_SUBSCRIPTION_TOPIC_POSITION_FUSED, sizeof(T_DjiFcSubscriptionPositionFused)},
+};
+
+static DjiReceiveDataOfTopicCallback s_sdkCallbacks[CACHE_TEST_TOPIC_NUM];
+static volatile uint32_t s_unsubscribeCount = 0;
+static volatile uint32_t s_userCallbackCount = 0;
+static volatile bool s_isWriterRunning = false;
+static pthread_barrier_t s_initBarrier;
+
+/* Private functions declaration ---------------------------------------------*/
+static void CacheTest_RunInitCount(void);
+static void CacheTest_RunSeqlock(void);
+static void *CacheTest_InitTask(void *arg);
+static void *CacheTest_WriterTask(void *arg);
+static void *CacheTest_ReaderTask(void *arg);
+static T_DjiReturnCode CacheTest_UserCallback(const uint8_t *data, uint16_t dataSize,
+                                              const T_DjiDataTimestamp *timestamp);
+static int CacheTest_FindTopic(E_DjiFcSubscriptionTopic topic);
+T_DjiReturnCode __wrap_DjiFcSubscription_SubscribeTopic(E_DjiFcSubscriptionTopic topic,
+                                                        E_DjiDataSubscriptionTopicFreq frequency,
+                                                        DjiReceiveDataOfTopicCallback callback);
+T_DjiReturnCode __wrap_DjiFcSubscription_UnSubscribeTopic(E_DjiFcSubscriptionTopic topic);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+
+    CacheTest_RunInitCount();
+    CacheTest_RunSeqlock();
+
+    printf("fc subscription cache test passed\n");
+    return 0;
+}
+
+/* Stubs of the psdk subscription calls, linked with --wrap, the test calls the captured callbacks as the sdk would. */
+T_DjiReturnCode __wrap_DjiFcSubscription_SubscribeTopic(E_DjiFcSubscriptionTopic topic,
+                                                        E_DjiDataSubscriptionTopicFreq frequency,
+                                                        DjiReceiveDataOfTopicCallback callback)
+{
+    int index = CacheTest_FindTopic(topic);
+
+    (void) frequency;
+    TEST_ASSERT(index >= 0 && callback != NULL);
+    s_sdkCallbacks[index] = callback;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiFcSubscription_UnSubscribeTopic(E_DjiFcSubscriptionTopic topic)
+{
+    TEST_ASSERT(CacheTest_FindTopic(topic) >= 0);
+    s_unsubscribeCount++;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void CacheTest_RunInitCount(void)
+{
+    pthread_t initThreads[CACHE_TEST_INIT_TASK_NUM];
+    T_DjiFcSubscriptionQuaternion quaternion = {0};
+    uint8_t data[sizeof(T_DjiFcSubscriptionQuaternion)];
+    T_DjiDataTimestamp timestamp = {0};
+    int i;
+
+    // Not initialized yet
+    TEST_ASSERT(DjiTest_FcSubscriptionCacheSubscribe(s_topics[0].topic, DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
+                                                     s_topics[0].dataSize, NULL) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheDeInit());
+
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheInit());
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheSubscribe(s_topics[0].topic, DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
+                                                             s_topics[0].dataSize, NULL));
+
+    // Other modules init and deinit the cache concurrently, the reference of the test keeps the topic alive
+    s_unsubscribeCount = 0;
+    TEST_ASSERT(pthread_barrier_init(&s_initBarrier, NULL, CACHE_TEST_INIT_TASK_NUM) == 0);
+    for (i = 0; i < CACHE_TEST_INIT_TASK_NUM; i++) {
+        TEST_ASSERT(pthread_create(&initThreads[i], NULL, CacheTest_InitTask, NULL) == 0);
+    }
+    for (i = 0; i < CACHE_TEST_INIT_TASK_NUM; i++) {
+        TEST_ASSERT(pthread_join(initThreads[i], NULL) == 0);
+    }
+    TEST_ASSERT(pthread_barrier_destroy(&s_initBarrier) == 0);
+    TEST_ASSERT(s_unsubscribeCount == 0);
+
+    quaternion.q0 = 1.0f;
+    timestamp.millisecond = 7;
+    TEST_ASSERT_SUCCESS(s_sdkCallbacks[0]((const uint8_t *) &quaternion, sizeof(quaternion), &timestamp));
+    memset(&timestamp, 0, sizeof(timestamp));
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheGetLatestValue(s_topics[0].topic, data, sizeof(data),
+                                                                  &timestamp));
+    TEST_ASSERT(memcmp(data, &quaternion, sizeof(data)) == 0);
+    TEST_ASSERT(timestamp.millisecond == 7);
+
+    // The last deinit releases the topic, the cache refuses new subscriptions then
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheDeInit());
+    TEST_ASSERT(s_unsubscribeCount == 1);
+    TEST_ASSERT(DjiTest_FcSubscriptionCacheSubscribe(s_topics[0].topic, DJI_DATA_SUBSCRIPTION_TOPIC_50_HZ,
+                                                     s_topics[0].dataSize, NULL) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_FcSubscriptionCacheUnSubscribe(s_topics[0].topic) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheDeInit());
+}
+
+static void CacheTest_RunSeqlock(void)
+{
+    T_CacheTestReader readers[CACHE_TEST_READER_NUM];
+    pthread_t readerThreads[CACHE_TEST_READER_NUM];
+    pthread_t writerThread;
+    int i;
+
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheInit());
+    for (i = 0; i < CACHE_TEST_TOPIC_NUM; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheSubscribe(s_topics[i].topic,
+                                                                 DJI_DATA_SUBSCRIPTION_TOPIC_200_HZ,
+                                                                 s_topics[i].dataSize,
+                                                                 i == 0 ? CacheTest_UserCallback : NULL));
+    }
+
+    memset(readers, 0, sizeof(readers));
+    s_userCallbackCount = 0;
+    s_isWriterRunning = true;
+    for (i = 0; i < CACHE_TEST_READER_NUM; i++) {
+        TEST_ASSERT(pthread_create(&readerThreads[i], NULL, CacheTest_ReaderTask, &readers[i]) == 0);
+    }
+    TEST_ASSERT(pthread_create(&writerThread, NULL, CacheTest_WriterTask, NULL) == 0);
+
+    TEST_ASSERT(pthread_join(writerThread, NULL) == 0);
+    for (i = 0; i < CACHE_TEST_READER_NUM; i++) {
+        TEST_ASSERT(pthread_join(readerThreads[i], NULL) == 0);
+        printf("reader %d: %u snapshots, %u busy, %u torn, %u inconsistent\n", i, readers[i].snapshotCount,
+               readers[i].busyCount, readers[i].tornCount, readers[i].inconsistentCount);
+        TEST_ASSERT(readers[i].snapshotCount > 0);
+        TEST_ASSERT(readers[i].tornCount == 0);
+        TEST_ASSERT(readers[i].inconsistentCount == 0);
+    }
+
+    // The user callback still runs after the cache took the value
+    TEST_ASSERT(s_userCallbackCount == CACHE_TEST_WRITE_NUM);
+
+    for (i = 0; i < CACHE_TEST_TOPIC_NUM; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheUnSubscribe(s_topics[i].topic));
+    }
+    TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheDeInit());
+}
+
+static void *CacheTest_InitTask(void *arg)
+{
+    (void) arg;
+
+    pthread_barrier_wait(&s_initBarrier);
+    for (int i = 0; i < CACHE_TEST_INIT_LOOP_NUM; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheInit());
+        TEST_ASSERT_SUCCESS(DjiTest_FcSubscriptionCacheDeInit());
+    }
+
+    return NULL;
+}
+
+static void *CacheTest_WriterTask(void *arg)
+{
+    uint8_t payload[CACHE_TEST_DATA_SIZE_MAX];
+    T_DjiDataTimestamp timestamp = {0};
+    uint32_t cycle;
+    int i;
+
+    (void) arg;
+
+    // Every topic of one cycle carries the cycle counter in all its bytes and in its timestamp
+    for (cycle = 1; cycle <= CACHE_TEST_WRITE_NUM; cycle++) {
+        memset(payload, (uint8_t) cycle, sizeof(payload));
+        timestamp.millisecond = cycle;
+        timestamp.microsecond = cycle;
+        for (i = 0; i < CACHE_TEST_TOPIC_NUM; i++) {
+            TEST_ASSERT_SUCCESS(s_sdkCallbacks[i](payload, s_topics[i].dataSize, &timestamp));
+        }
+    }
+    s_isWriterRunning = false;
+
+    return NULL;
+}
+
+static void *CacheTest_ReaderTask(void *arg)
+{
+    T_CacheTestReader *reader = (T_CacheTestReader *) arg;
+    T_DjiTestFcSubscriptionCacheItem items[CACHE_TEST_TOPIC_NUM];
+    uint8_t values[CACHE_TEST_TOPIC_NUM][CACHE_TEST_DATA_SIZE_MAX];
+    uint32_t lastCycle = 0;
+    uint32_t firstCycle;
+    uint32_t cycle;
+    T_DjiReturnCode returnCode;
+    uint16_t j;
+    int i;
+
+    for (i = 0; i < CACHE_TEST_TOPIC_NUM; i++) {
+        items[i].topic = s_topics[i].topic;
+        items[i].data = values[i];
+        items[i].dataSize = s_topics[i].dataSize;
+    }
+
+    while (s_isWriterRunning) {
+        returnCode = DjiTest_FcSubscriptionCacheGetSnapshot(items, CACHE_TEST_TOPIC_NUM);
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY) {
+            reader->busyCount++;
+            continue;
+        }
+        TEST_ASSERT_SUCCESS(returnCode);
+        reader->snapshotCount++;
+
+        // Each value is whole and belongs to its timestamp and update count
+        for (i = 0; i < CACHE_TEST_TOPIC_NUM; i++) {
+            cycle = items[i].timestamp.millisecond;
+            for (j = 0; j < items[i].dataSize; j++) {
+                if (values[i][j] != (uint8_t) cycle) {
+                    reader->tornCount++;
+                    break;
+                }
+            }
+            if (items[i].timestamp.microsecond != cycle || items[i].updateCount != cycle) {
+                reader->tornCount++;
+            }
+        }
+
+        // Topics are written in order, a consistent cut sees the later ones at most one cycle behind the first,
+        // and time never goes back for one reader
+        firstCycle = items[0].timestamp.millisecond;
+        for (i = 1; i < CACHE_TEST_TOPIC_NUM; i++) {
+            cycle = items[i].timestamp.millisecond;
+            if (cycle != firstCycle && cycle + 1 != firstCycle) {
+                reader->inconsistentCount++;
+            }
+        }
+        if (firstCycle < lastCycle) {
+            reader->inconsistentCount++;
+        }
+        lastCycle = firstCycle;
+    }
+
+    return NULL;
+}
+
+static T_DjiReturnCode CacheTest_UserCallback(const uint8_t *data, uint16_t dataSize,
+                                              const T_DjiDataTimestamp *timestamp)
+{
+    TEST_ASSERT(data != NULL && dataSize == s_topics[0].dataSize && data[0] == (uint8_t) timestamp->millisecond);
+    s_userCallbackCount++;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static int CacheTest_FindTopic(E_DjiFcSubscriptionTopic topic)
+{
+    for (int i = 0; i < CACHE_TEST_TOPIC_NUM; i++) {
+        if (s_topics[i].topic == topic) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
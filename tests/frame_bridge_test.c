@@ -0,0 +1,369 @@
+/**
+ ********************************************************************
+ * @file    frame_bridge_test.c
+ * @brief   Runs the shared-memory frame bridge with readers in the test process and in forked processes,
+ * checking sequences, drops, reader statistics and frames published by several threads at once.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "test_common.h"
+#include "utils/util_misc.h"
+#include "frame_bridge/dji_frame_bridge.h"
+#include "frame_bridge/test_frame_bridge.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define BRIDGE_TEST_SLOT_NUM                (4)
+#define BRIDGE_TEST_SLOT_SIZE               (100)
+#define BRIDGE_TEST_PUBLISHER_NUM           (2)
+#define BRIDGE_TEST_PUBLISHER_FRAME_NUM     (5000)
+#define BRIDGE_TEST_PUBLISHER_FRAME_SIZE    (64 * 1024)
+#define BRIDGE_TEST_READ_TIMEOUT_MS         (1000)
+
+/* Private types -------------------------------------------------------------*/
+/* The leading fields of the segment header, as laid out by the bridge. */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t slotDataSize;
+    uint64_t slotStride;
+    uint64_t segmentSize;
+} T_BridgeTestHeader;
+
+typedef struct {
+    T_DjiFrameBridgeHandle bridge;
+    uint32_t sourceIndex;
+} T_BridgeTestPublisher;
+
+/* Private values -------------------------------------------------------------*/
+static char s_bridgeName[DJI_FRAME_BRIDGE_NAME_SIZE_MAX];
+static volatile bool s_isReading = false;
+static uint64_t s_readCount = 0;
+static uint64_t s_tornCount = 0;
+
+/* Private functions declaration ---------------------------------------------*/
+static void BridgeTest_RunRing(void);
+static void BridgeTest_RunCorruptHeader(void);
+static void BridgeTest_RunDeadReader(void);
+static void BridgeTest_RunConcurrentPublishers(void);
+static void BridgeTest_RunBenchmark(void);
+static void *BridgeTest_PublishTask(void *arg);
+static void *BridgeTest_ReadTask(void *arg);
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+    // Shared memory objects are global, the name is unique to the run so that concurrent runs do not meet.
+    snprintf(s_bridgeName, sizeof(s_bridgeName), "bridge_test_%u", (uint32_t) getpid());
+
+    BridgeTest_RunRing();
+    BridgeTest_RunCorruptHeader();
+    BridgeTest_RunDeadReader();
+    BridgeTest_RunConcurrentPublishers();
+    BridgeTest_RunBenchmark();
+
+    printf("frame bridge test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void BridgeTest_RunRing(void)
+{
+    T_DjiFrameBridgeHandle publisher;
+    T_DjiFrameBridgeHandle subscriber;
+    T_DjiFrameBridgeHandle lateSubscriber;
+    T_DjiFrameBridgeFrameInfo info = {0};
+    T_DjiFrameBridgeReaderStatistics statistics[DJI_FRAME_BRIDGE_READER_NUM_MAX];
+    uint8_t data[BRIDGE_TEST_SLOT_SIZE + 1] = {0};
+    uint8_t buffer[BRIDGE_TEST_SLOT_SIZE];
+    const uint8_t *frameData;
+    uint64_t count = 0;
+    uint64_t startUs;
+    uint32_t statisticsCount = 0;
+    uint8_t i;
+
+    TEST_ASSERT(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber) == DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND);
+    TEST_ASSERT(DjiFrameBridge_CreatePublisher(s_bridgeName, 1, BRIDGE_TEST_SLOT_SIZE, &publisher) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_CreatePublisher(s_bridgeName, BRIDGE_TEST_SLOT_NUM, BRIDGE_TEST_SLOT_SIZE,
+                                                       &publisher));
+
+    // nothing is copied and no sequence is used while no reader is attached
+    info.dataSize = 10;
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_Publish(publisher, &info, data));
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_GetPublishedCount(publisher, &count));
+    TEST_ASSERT(count == 0);
+
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber));
+    TEST_ASSERT(DjiFrameBridge_ReadFrame(subscriber, &info, buffer, sizeof(buffer), 0) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT);
+    startUs = DjiFrameBridge_GetTimeUs();
+    TEST_ASSERT(DjiFrameBridge_ReadFrame(subscriber, &info, buffer, sizeof(buffer), 50) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT);
+    TEST_ASSERT(DjiFrameBridge_GetTimeUs() - startUs >= 50000);
+
+    // a reader starts with the next frame published
+    for (i = 1; i <= 3; i++) {
+        data[0] = i;
+        TEST_ASSERT_SUCCESS(DjiFrameBridge_Publish(publisher, &info, data));
+    }
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_OpenSubscriber(s_bridgeName, &lateSubscriber));
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_ReadFrame(subscriber, &info, buffer, sizeof(buffer), 0));
+    TEST_ASSERT(info.sequence == 1 && info.dataSize == 10 && buffer[0] == 1);
+
+    // falling more than a ring behind skips to the oldest frame still in the ring
+    for (i = 4; i <= 10; i++) {
+        data[0] = i;
+        TEST_ASSERT_SUCCESS(DjiFrameBridge_Publish(publisher, &info, data));
+    }
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_AcquireFrame(subscriber, &info, &frameData, 0));
+    TEST_ASSERT(info.sequence == 7 && frameData[0] == 7);
+
+    // a frame overwritten while it was acquired is reported when released
+    data[0] = 11;
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_Publish(publisher, &info, data));
+    TEST_ASSERT(DjiFrameBridge_ReleaseFrame(subscriber) == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_ReadFrame(subscriber, &info, buffer, sizeof(buffer), 0));
+    TEST_ASSERT(info.sequence == 8 && buffer[0] == 8);
+    TEST_ASSERT(DjiFrameBridge_ReadFrame(lateSubscriber, &info, buffer, 5, 0) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_GetReaderStatistics(publisher, statistics, DJI_FRAME_BRIDGE_READER_NUM_MAX,
+                                                           &statisticsCount));
+    TEST_ASSERT(statisticsCount == 2);
+    TEST_ASSERT(statistics[0].pid == (uint32_t) getpid());
+    TEST_ASSERT(statistics[0].readCount == 2 && statistics[0].dropCount == 6 && statistics[0].lag == 3);
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_GetPublishedCount(publisher, &count));
+    TEST_ASSERT(count == 11);
+
+    info.dataSize = BRIDGE_TEST_SLOT_SIZE + 1;
+    TEST_ASSERT(DjiFrameBridge_Publish(publisher, &info, data) == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+
+    // readers see a destroyed publisher as gone, even while waiting
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_CloseSubscriber(lateSubscriber));
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_DestroyPublisher(publisher));
+    TEST_ASSERT(DjiFrameBridge_ReadFrame(subscriber, &info, buffer, sizeof(buffer), BRIDGE_TEST_READ_TIMEOUT_MS) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND);
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_CloseSubscriber(subscriber));
+}
+
+static void BridgeTest_RunCorruptHeader(void)
+{
+    T_DjiFrameBridgeHandle publisher;
+    T_DjiFrameBridgeHandle subscriber;
+    T_BridgeTestHeader *header;
+    T_BridgeTestHeader original;
+    char shmName[DJI_FRAME_BRIDGE_NAME_SIZE_MAX + 2];
+    struct stat st;
+    int fd;
+
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_CreatePublisher(s_bridgeName, BRIDGE_TEST_SLOT_NUM, BRIDGE_TEST_SLOT_SIZE,
+                                                       &publisher));
+    snprintf(shmName, sizeof(shmName), "/%s", s_bridgeName);
+    fd = shm_open(shmName, O_RDWR, 0);
+    TEST_ASSERT(fd >= 0);
+
+    // only the user of the publisher may map the ring
+    TEST_ASSERT(fstat(fd, &st) == 0 && (st.st_mode & 0777) == 0600);
+    header = mmap(NULL, sizeof(T_BridgeTestHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    TEST_ASSERT(header != MAP_FAILED);
+    original = *header;
+
+    // a ring too short to divide the sequences by
+    header->slotCount = 0;
+    TEST_ASSERT(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    header->slotCount = 1;
+    TEST_ASSERT(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    *header = original;
+
+    // slots reaching past the end of the segment, also when their size wraps around to the segment size
+    header->slotStride += 64;
+    TEST_ASSERT(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    header->slotStride = original.slotStride + (UINT64_MAX / BRIDGE_TEST_SLOT_NUM + 1);
+    TEST_ASSERT(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    *header = original;
+
+    // frames larger than their slot
+    header->slotDataSize = (uint32_t) original.slotStride;
+    TEST_ASSERT(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    *header = original;
+
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber));
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_CloseSubscriber(subscriber));
+    munmap(header, sizeof(T_BridgeTestHeader));
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_DestroyPublisher(publisher));
+}
+
+static void BridgeTest_RunDeadReader(void)
+{
+    T_DjiFrameBridgeHandle publisher;
+    T_DjiFrameBridgeHandle subscribers[DJI_FRAME_BRIDGE_READER_NUM_MAX];
+    T_DjiFrameBridgeHandle subscriber;
+    T_DjiFrameBridgeReaderStatistics statistics[DJI_FRAME_BRIDGE_READER_NUM_MAX];
+    uint32_t statisticsCount = 0;
+    uint32_t i;
+    pid_t pid;
+    int status;
+
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_CreatePublisher(s_bridgeName, BRIDGE_TEST_SLOT_NUM, BRIDGE_TEST_SLOT_SIZE,
+                                                       &publisher));
+
+    // a reader process exiting without closing keeps its place until another reader needs one
+    pid = fork();
+    TEST_ASSERT(pid >= 0);
+    if (pid == 0) {
+        _exit(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber) == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS ? 0 : 1);
+    }
+    TEST_ASSERT(waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_GetReaderStatistics(publisher, statistics, DJI_FRAME_BRIDGE_READER_NUM_MAX,
+                                                           &statisticsCount));
+    TEST_ASSERT(statisticsCount == 1 && statistics[0].pid == (uint32_t) pid);
+
+    for (i = 0; i < DJI_FRAME_BRIDGE_READER_NUM_MAX; i++) {
+        TEST_ASSERT_SUCCESS(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscribers[i]));
+    }
+    TEST_ASSERT(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber) == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_GetReaderStatistics(publisher, statistics, DJI_FRAME_BRIDGE_READER_NUM_MAX,
+                                                           &statisticsCount));
+    TEST_ASSERT(statisticsCount == DJI_FRAME_BRIDGE_READER_NUM_MAX);
+    for (i = 0; i < statisticsCount; i++) {
+        TEST_ASSERT(statistics[i].pid == (uint32_t) getpid());
+    }
+
+    for (i = 0; i < DJI_FRAME_BRIDGE_READER_NUM_MAX; i++) {
+        TEST_ASSERT_SUCCESS(DjiFrameBridge_CloseSubscriber(subscribers[i]));
+    }
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_DestroyPublisher(publisher));
+}
+
+static void BridgeTest_RunConcurrentPublishers(void)
+{
+    T_BridgeTestPublisher publishers[BRIDGE_TEST_PUBLISHER_NUM];
+    pthread_t publishThreads[BRIDGE_TEST_PUBLISHER_NUM];
+    pthread_t readThread;
+    T_DjiFrameBridgeHandle publisher;
+    T_DjiFrameBridgeHandle subscriber;
+    uint64_t count = 0;
+    uint32_t i;
+
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_CreatePublisher(s_bridgeName, BRIDGE_TEST_SLOT_NUM,
+                                                       BRIDGE_TEST_PUBLISHER_FRAME_SIZE, &publisher));
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_OpenSubscriber(s_bridgeName, &subscriber));
+
+    // two decoders publishing to one bridge, as during a camera stream handoff, never tear a frame or a sequence
+    s_readCount = 0;
+    s_tornCount = 0;
+    s_isReading = true;
+    TEST_ASSERT(pthread_create(&readThread, NULL, BridgeTest_ReadTask, subscriber) == 0);
+    for (i = 0; i < BRIDGE_TEST_PUBLISHER_NUM; i++) {
+        publishers[i].bridge = publisher;
+        publishers[i].sourceIndex = i;
+        TEST_ASSERT(pthread_create(&publishThreads[i], NULL, BridgeTest_PublishTask, &publishers[i]) == 0);
+    }
+    for (i = 0; i < BRIDGE_TEST_PUBLISHER_NUM; i++) {
+        TEST_ASSERT(pthread_join(publishThreads[i], NULL) == 0);
+    }
+    s_isReading = false;
+    TEST_ASSERT(pthread_join(readThread, NULL) == 0);
+
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_GetPublishedCount(publisher, &count));
+    printf("%u publishers: %llu frames published, %llu read, %llu torn\n", BRIDGE_TEST_PUBLISHER_NUM,
+           (unsigned long long) count, (unsigned long long) s_readCount, (unsigned long long) s_tornCount);
+    TEST_ASSERT(count == (uint64_t) BRIDGE_TEST_PUBLISHER_NUM * BRIDGE_TEST_PUBLISHER_FRAME_NUM);
+    TEST_ASSERT(s_readCount > 0 && s_tornCount == 0);
+
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_CloseSubscriber(subscriber));
+    TEST_ASSERT_SUCCESS(DjiFrameBridge_DestroyPublisher(publisher));
+}
+
+static void BridgeTest_RunBenchmark(void)
+{
+    // forks a copying, an in place and a slow reader against a 1080p producer
+    TEST_ASSERT_SUCCESS(DjiTest_FrameBridgeRunBenchmark());
+}
+
+static void *BridgeTest_PublishTask(void *arg)
+{
+    T_BridgeTestPublisher *publisher = (T_BridgeTestPublisher *) arg;
+    T_DjiFrameBridgeFrameInfo info = {0};
+    static uint8_t data[BRIDGE_TEST_PUBLISHER_NUM][BRIDGE_TEST_PUBLISHER_FRAME_SIZE];
+    uint32_t i;
+
+    info.source = DJI_FRAME_BRIDGE_SOURCE_SYNTHETIC;
+    info.sourceIndex = publisher->sourceIndex;
+    info.dataSize = BRIDGE_TEST_PUBLISHER_FRAME_SIZE;
+    for (i = 0; i < BRIDGE_TEST_PUBLISHER_FRAME_NUM; i++) {
+        // every byte of a frame tells which publisher wrote it and which of its frames it is
+        info.width = i;
+        memset(data[publisher->sourceIndex], (int) (publisher->sourceIndex * 128 + i % 128), sizeof(data[0]));
+        TEST_ASSERT_SUCCESS(DjiFrameBridge_Publish(publisher->bridge, &info, data[publisher->sourceIndex]));
+    }
+
+    return NULL;
+}
+
+static void *BridgeTest_ReadTask(void *arg)
+{
+    T_DjiFrameBridgeHandle subscriber = arg;
+    T_DjiFrameBridgeFrameInfo info;
+    static uint8_t buffer[BRIDGE_TEST_PUBLISHER_FRAME_SIZE];
+    T_DjiReturnCode returnCode;
+    uint64_t lastSequence = 0;
+    uint8_t value;
+    uint32_t i;
+
+    while (s_isReading == true) {
+        returnCode = DjiFrameBridge_ReadFrame(subscriber, &info, buffer, sizeof(buffer), 10);
+        if (returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT) {
+            continue;
+        }
+        TEST_ASSERT_SUCCESS(returnCode);
+
+        value = (uint8_t) (info.sourceIndex * 128 + info.width % 128);
+        for (i = 0; i < info.dataSize && buffer[i] == value; i++) {
+        }
+        if (info.sequence <= lastSequence || info.dataSize != sizeof(buffer) || i != info.dataSize) {
+            s_tornCount++;
+        }
+        lastSequence = info.sequence;
+        s_readCount++;
+    }
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
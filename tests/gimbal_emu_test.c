@@ -0,0 +1,316 @@
+/**
+ ********************************************************************
+ * @file    gimbal_emu_test.c
+ * @brief   Feeds aircraft quaternions to the gimbal emulator through a wrapped quaternion subscription, checking
+ * the attitude the gimbal task follows and that the lock-free getters never return a torn state.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+#include "test_common.h"
+#include "osal/osal.h"
+#include "dji_gimbal.h"
+#include "dji_fc_subscription.h"
+#include "gimbal_emu/test_payload_gimbal_emu.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define GIMBAL_TEST_STEP_NUM                (40)
+#define GIMBAL_TEST_AIRCRAFT_PITCH          (3.0) // unit: degree
+#define GIMBAL_TEST_AIRCRAFT_ROLL_STEP      (0.2) // unit: degree
+#define GIMBAL_TEST_AIRCRAFT_YAW_STEP       (3.0) // unit: degree
+#define GIMBAL_TEST_DEG_TO_RAD              (DJI_PI / 180.0)
+#define GIMBAL_TEST_RAD_TO_DECIDEGREE       (180.0 / DJI_PI * 10)
+#define GIMBAL_TEST_WAIT_TIMEOUT_MS         (2000)
+#define GIMBAL_TEST_READER_NUM              (3)
+#define GIMBAL_TEST_FEED_TIME_MS            (3000)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t readCount;
+    uint32_t unknownCount;
+} T_GimbalTestReader;
+
+/* Private values -------------------------------------------------------------*/
+static DjiReceiveDataOfTopicCallback volatile s_quaternionCallback = NULL;
+static T_DjiGimbalCommonHandler s_commonHandler;
+static T_DjiFcSubscriptionQuaternion s_quaternions[GIMBAL_TEST_STEP_NUM];
+static T_DjiAttitude3d s_aircraftAttitudes[GIMBAL_TEST_STEP_NUM]; // unit: 0.1 degree, ground coordination
+static uint32_t s_feedCount = 0;
+static volatile bool s_isFeeding = false;
+
+/* Private functions declaration ---------------------------------------------*/
+static void GimbalTest_BuildFeed(void);
+static void GimbalTest_RunFollow(void);
+static void GimbalTest_RunConcurrentReads(void);
+static void GimbalTest_Feed(int step);
+static void GimbalTest_WaitState(int32_t roll, int32_t yaw, const T_DjiAttitude3d *aircraftAttitude);
+static int GimbalTest_FindStep(const T_DjiAttitude3d *attitude);
+static void *GimbalTest_ReaderTask(void *arg);
+T_DjiReturnCode __wrap_DjiFcSubscription_Init(void);
+T_DjiReturnCode __wrap_DjiFcSubscription_SubscribeTopic(E_DjiFcSubscriptionTopic topic,
+                                                        E_DjiDataSubscriptionTopicFreq frequency,
+                                                        DjiReceiveDataOfTopicCallback callback);
+T_DjiReturnCode __wrap_DjiFcSubscription_UnSubscribeTopic(E_DjiFcSubscriptionTopic topic);
+T_DjiReturnCode __wrap_DjiGimbal_Init(void);
+T_DjiReturnCode __wrap_DjiGimbal_RegCommonHandler(const T_DjiGimbalCommonHandler *commonHandler);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    uint32_t startTime = 0;
+    uint32_t currentTime = 0;
+
+    TestCommon_Init();
+    GimbalTest_BuildFeed();
+
+    TEST_ASSERT_SUCCESS(DjiTest_GimbalStartService());
+    TEST_ASSERT(s_commonHandler.GetAttitudeInformation != NULL && s_commonHandler.GetJointAngle != NULL);
+
+    // The gimbal task subscribes the quaternion through the fc subscription cache once it runs
+    Osal_GetTimeMs(&startTime);
+    while (s_quaternionCallback == NULL) {
+        Osal_GetTimeMs(&currentTime);
+        TEST_ASSERT(currentTime - startTime < GIMBAL_TEST_WAIT_TIMEOUT_MS);
+        Osal_TaskSleepMs(1);
+    }
+
+    GimbalTest_RunFollow();
+    GimbalTest_RunConcurrentReads();
+
+    printf("gimbal emu test passed\n");
+    return 0;
+}
+
+/* Stubs of the psdk calls, linked with --wrap, the test calls the captured quaternion callback as the sdk would. */
+T_DjiReturnCode __wrap_DjiFcSubscription_Init(void)
+{
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiFcSubscription_SubscribeTopic(E_DjiFcSubscriptionTopic topic,
+                                                        E_DjiDataSubscriptionTopicFreq frequency,
+                                                        DjiReceiveDataOfTopicCallback callback)
+{
+    (void) frequency;
+    TEST_ASSERT(topic == DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION && callback != NULL);
+    s_quaternionCallback = callback;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiFcSubscription_UnSubscribeTopic(E_DjiFcSubscriptionTopic topic)
+{
+    TEST_ASSERT(topic == DJI_FC_SUBSCRIPTION_TOPIC_QUATERNION);
+    s_quaternionCallback = NULL;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiGimbal_Init(void)
+{
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiGimbal_RegCommonHandler(const T_DjiGimbalCommonHandler *commonHandler)
+{
+    TEST_ASSERT(commonHandler != NULL);
+    s_commonHandler = *commonHandler;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void GimbalTest_BuildFeed(void)
+{
+    double halfRoll;
+    double halfPitch;
+    double halfYaw;
+    T_DjiFcSubscriptionQuaternion *q;
+    int step;
+
+    for (step = 0; step < GIMBAL_TEST_STEP_NUM; step++) {
+        halfRoll = step * GIMBAL_TEST_AIRCRAFT_ROLL_STEP * GIMBAL_TEST_DEG_TO_RAD / 2;
+        halfPitch = GIMBAL_TEST_AIRCRAFT_PITCH * GIMBAL_TEST_DEG_TO_RAD / 2;
+        halfYaw = step * GIMBAL_TEST_AIRCRAFT_YAW_STEP * GIMBAL_TEST_DEG_TO_RAD / 2;
+
+        q = &s_quaternions[step];
+        q->q0 = cos(halfRoll) * cos(halfPitch) * cos(halfYaw) + sin(halfRoll) * sin(halfPitch) * sin(halfYaw);
+        q->q1 = sin(halfRoll) * cos(halfPitch) * cos(halfYaw) - cos(halfRoll) * sin(halfPitch) * sin(halfYaw);
+        q->q2 = cos(halfRoll) * sin(halfPitch) * cos(halfYaw) + sin(halfRoll) * cos(halfPitch) * sin(halfYaw);
+        q->q3 = cos(halfRoll) * cos(halfPitch) * sin(halfYaw) - sin(halfRoll) * sin(halfPitch) * cos(halfYaw);
+
+        // The emulator truncates the ground attitude of the aircraft to 0.1 degree, convert the same way
+        s_aircraftAttitudes[step].pitch = asin(2 * ((double) q->q0 * q->q2 - (double) q->q3 * q->q1)) *
+                                          GIMBAL_TEST_RAD_TO_DECIDEGREE;
+        s_aircraftAttitudes[step].roll = atan2(2 * ((double) q->q0 * q->q1 + (double) q->q2 * q->q3),
+                                               (double) 1 - 2 * ((double) q->q1 * q->q1 + (double) q->q2 * q->q2)) *
+                                         GIMBAL_TEST_RAD_TO_DECIDEGREE;
+        s_aircraftAttitudes[step].yaw = atan2(2 * ((double) q->q0 * q->q3 + (double) q->q1 * q->q2),
+                                              (double) 1 - 2 * ((double) q->q2 * q->q2 + (double) q->q3 * q->q3)) *
+                                        GIMBAL_TEST_RAD_TO_DECIDEGREE;
+    }
+
+    // Each step moves the aircraft, so a mix of two steps is never mistaken for one
+    for (step = 1; step < GIMBAL_TEST_STEP_NUM; step++) {
+        TEST_ASSERT(s_aircraftAttitudes[step].roll != s_aircraftAttitudes[step - 1].roll);
+        TEST_ASSERT(s_aircraftAttitudes[step].yaw != s_aircraftAttitudes[step - 1].yaw);
+    }
+}
+
+static void GimbalTest_RunFollow(void)
+{
+    const T_DjiAttitude3d *last = &s_aircraftAttitudes[GIMBAL_TEST_STEP_NUM - 1];
+    int step;
+
+    // Fpv mode follows roll and yaw of the aircraft and keeps the pitch in the ground coordination
+    TEST_ASSERT_SUCCESS(s_commonHandler.SetMode(DJI_GIMBAL_MODE_FPV));
+    for (step = 0; step < GIMBAL_TEST_STEP_NUM; step++) {
+        GimbalTest_Feed(step);
+        GimbalTest_WaitState(s_aircraftAttitudes[step].roll, s_aircraftAttitudes[step].yaw,
+                             &s_aircraftAttitudes[step]);
+    }
+
+    // Yaw follow mode keeps the roll while the aircraft rolls back
+    TEST_ASSERT_SUCCESS(s_commonHandler.SetMode(DJI_GIMBAL_MODE_YAW_FOLLOW));
+    GimbalTest_Feed(0);
+    GimbalTest_WaitState(last->roll, s_aircraftAttitudes[0].yaw, &s_aircraftAttitudes[0]);
+
+    GimbalTest_Feed(GIMBAL_TEST_STEP_NUM - 1);
+    GimbalTest_WaitState(last->roll, last->yaw, last);
+    TEST_ASSERT_SUCCESS(s_commonHandler.SetMode(DJI_GIMBAL_MODE_FPV));
+}
+
+static void GimbalTest_RunConcurrentReads(void)
+{
+    T_GimbalTestReader readers[GIMBAL_TEST_READER_NUM];
+    pthread_t readerThreads[GIMBAL_TEST_READER_NUM];
+    uint32_t startTime = 0;
+    uint32_t currentTime = 0;
+    int round = 0;
+    int step;
+    int i;
+
+    memset(readers, 0, sizeof(readers));
+    s_isFeeding = true;
+    for (i = 0; i < GIMBAL_TEST_READER_NUM; i++) {
+        TEST_ASSERT(pthread_create(&readerThreads[i], NULL, GimbalTest_ReaderTask, &readers[i]) == 0);
+    }
+
+    // Swing the aircraft back and forth, the gimbal task reads each quaternion while the next one is written
+    Osal_GetTimeMs(&startTime);
+    do {
+        for (step = 0; step < GIMBAL_TEST_STEP_NUM; step++) {
+            GimbalTest_Feed(round % 2 == 0 ? GIMBAL_TEST_STEP_NUM - 1 - step : step);
+        }
+        round++;
+        Osal_GetTimeMs(&currentTime);
+    } while (currentTime - startTime < GIMBAL_TEST_FEED_TIME_MS);
+    step = round % 2 == 0 ? GIMBAL_TEST_STEP_NUM - 1 : 0;
+    GimbalTest_WaitState(s_aircraftAttitudes[step].roll, s_aircraftAttitudes[step].yaw, &s_aircraftAttitudes[step]);
+
+    s_isFeeding = false;
+    for (i = 0; i < GIMBAL_TEST_READER_NUM; i++) {
+        TEST_ASSERT(pthread_join(readerThreads[i], NULL) == 0);
+        printf("reader %d: %u reads, %u unknown\n", i, readers[i].readCount, readers[i].unknownCount);
+        TEST_ASSERT(readers[i].readCount > 0);
+        TEST_ASSERT(readers[i].unknownCount == 0);
+    }
+}
+
+static void GimbalTest_Feed(int step)
+{
+    T_DjiDataTimestamp timestamp = {0};
+    DjiReceiveDataOfTopicCallback callback = s_quaternionCallback;
+
+    TEST_ASSERT(callback != NULL);
+    s_feedCount++;
+    timestamp.millisecond = s_feedCount;
+    timestamp.microsecond = s_feedCount * 1000;
+    TEST_ASSERT_SUCCESS(callback((const uint8_t *) &s_quaternions[step], sizeof(T_DjiFcSubscriptionQuaternion),
+                                 &timestamp));
+}
+
+/* The joint angles on the aircraft attitude tell a gimbal that applied the attitude from one that did not move yet. */
+static void GimbalTest_WaitState(int32_t roll, int32_t yaw, const T_DjiAttitude3d *aircraftAttitude)
+{
+    T_DjiGimbalAttitudeInformation attitudeInformation = {0};
+    T_DjiAttitude3d jointAngle = {0};
+    uint32_t startTime = 0;
+    uint32_t currentTime = 0;
+
+    Osal_GetTimeMs(&startTime);
+    while (1) {
+        TEST_ASSERT_SUCCESS(s_commonHandler.GetAttitudeInformation(&attitudeInformation));
+        TEST_ASSERT_SUCCESS(s_commonHandler.GetJointAngle(&jointAngle));
+        if (attitudeInformation.attitude.pitch == 0 && attitudeInformation.attitude.roll == roll &&
+            attitudeInformation.attitude.yaw == yaw && jointAngle.pitch == -aircraftAttitude->pitch &&
+            jointAngle.roll == roll - aircraftAttitude->roll && jointAngle.yaw == yaw - aircraftAttitude->yaw) {
+            return;
+        }
+
+        Osal_GetTimeMs(&currentTime);
+        if (currentTime - startTime >= GIMBAL_TEST_WAIT_TIMEOUT_MS) {
+            printf("gimbal attitude %d %d %d joint %d %d %d, expected attitude 0 %d %d\n",
+                   attitudeInformation.attitude.pitch, attitudeInformation.attitude.roll,
+                   attitudeInformation.attitude.yaw, jointAngle.pitch, jointAngle.roll, jointAngle.yaw, roll, yaw);
+            TEST_ASSERT(currentTime - startTime < GIMBAL_TEST_WAIT_TIMEOUT_MS);
+        }
+        Osal_TaskSleepMs(1);
+    }
+}
+
+/* In fpv mode the gimbal holds pitch 0 and the roll and yaw of one of the fed aircraft attitudes. */
+static int GimbalTest_FindStep(const T_DjiAttitude3d *attitude)
+{
+    int step;
+
+    if (attitude->pitch != 0) {
+        return -1;
+    }
+
+    for (step = 0; step < GIMBAL_TEST_STEP_NUM; step++) {
+        if (attitude->roll == s_aircraftAttitudes[step].roll && attitude->yaw == s_aircraftAttitudes[step].yaw) {
+            return step;
+        }
+    }
+
+    return -1;
+}
+
+static void *GimbalTest_ReaderTask(void *arg)
+{
+    T_GimbalTestReader *reader = arg;
+    T_DjiGimbalAttitudeInformation attitudeInformation = {0};
+
+    while (s_isFeeding) {
+        TEST_ASSERT_SUCCESS(s_commonHandler.GetAttitudeInformation(&attitudeInformation));
+        reader->readCount++;
+        if (GimbalTest_FindStep(&attitudeInformation.attitude) < 0) {
+            reader->unknownCount++;
+        }
+    }
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,140 @@
+/**
+ ********************************************************************
+ * @file    osal_clock_test.c
+ * @brief   Runs the FreeRTOS OSAL clock on simulated DWT cycle counter and scheduler tick values, checking
+ * that the 64-bit time stays exact and monotonic across counter and tick wraparounds.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_common.h"
+#include "osal_clock.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define CLOCK_TEST_COUNTER_FREQ_HZ      (168000000U)
+#define CLOCK_TEST_TICK_FREQ_HZ         (1000U)
+#define CLOCK_TEST_COUNTER_PER_TICK     (CLOCK_TEST_COUNTER_FREQ_HZ / CLOCK_TEST_TICK_FREQ_HZ)
+#define CLOCK_TEST_COUNTER_PER_US       (CLOCK_TEST_COUNTER_FREQ_HZ / 1000000U)
+#define CLOCK_TEST_DURATION_S           (2 * 3600ULL)
+//irregular read interval, not a multiple of the tick so reads fall anywhere in it
+#define CLOCK_TEST_READ_STEP            ((CLOCK_TEST_COUNTER_PER_TICK / 3 + 7777) * 997ULL)
+//without tick the counter must be read at least once per half period, 12.7 s at 168 MHz
+#define CLOCK_TEST_NO_TICK_READ_STEP    (10ULL * CLOCK_TEST_COUNTER_FREQ_HZ)
+#define CLOCK_TEST_NO_TICK_DURATION_S   (1000ULL)
+//the elapsed tick wraps after 49.7 days at 1 kHz
+#define CLOCK_TEST_LONG_READ_STEP       (3600ULL * CLOCK_TEST_COUNTER_FREQ_HZ + 12345)
+#define CLOCK_TEST_LONG_DURATION_S      (120ULL * 24 * 3600)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t startTick;
+    uint32_t startCounter;
+} T_ClockTestCase;
+
+/* Private values -------------------------------------------------------------*/
+static const T_ClockTestCase s_clockTestCases[] = {
+    {5, 0},
+    //the tick wraps 4096 ms after the start and the counter 256 cycles after it
+    {0xFFFFF000U, 0xFFFFFF00U},
+    {123456, 0x80000000U},
+};
+
+/* Private functions declaration ---------------------------------------------*/
+static void ClockTest_RunWithTick(const T_ClockTestCase *testCase);
+static void ClockTest_RunWithoutTick(void);
+static void ClockTest_RunTickWrap(void);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    for (uint32_t i = 0; i < sizeof(s_clockTestCases) / sizeof(s_clockTestCases[0]); i++) {
+        ClockTest_RunWithTick(&s_clockTestCases[i]);
+    }
+    ClockTest_RunWithoutTick();
+    ClockTest_RunTickWrap();
+
+    printf("osal clock test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+/* The counter wraps every 25 s for two hours, the tick read near it sometimes still lags by one. */
+static void ClockTest_RunWithTick(const T_ClockTestCase *testCase)
+{
+    T_OsalClock clock;
+    uint64_t lastUs = 0;
+    uint64_t readCount = 0;
+
+    OsalClock_Init(&clock, CLOCK_TEST_COUNTER_FREQ_HZ, CLOCK_TEST_TICK_FREQ_HZ, testCase->startTick,
+                   testCase->startCounter);
+
+    for (uint64_t cycles = 0; cycles < CLOCK_TEST_DURATION_S * CLOCK_TEST_COUNTER_FREQ_HZ;
+         cycles += CLOCK_TEST_READ_STEP) {
+        uint64_t elapsedTick = cycles / CLOCK_TEST_COUNTER_PER_TICK;
+        uint32_t tick = (uint32_t) (testCase->startTick + elapsedTick);
+        uint32_t counter = (uint32_t) (testCase->startCounter + cycles);
+        uint64_t expectedUs = (uint64_t) testCase->startTick * 1000 + cycles / CLOCK_TEST_COUNTER_PER_US;
+        uint64_t us;
+
+        if (readCount++ % 5 == 0 && elapsedTick != 0) {
+            tick--;
+        }
+
+        us = OsalClock_GetTimeUs(&clock, tick, counter);
+        TEST_ASSERT(us == expectedUs);
+        TEST_ASSERT(us >= lastUs);
+        lastUs = us;
+    }
+}
+
+/* Before the scheduler starts the tick stays still, the last value read resolves the counter wraps. */
+static void ClockTest_RunWithoutTick(void)
+{
+    T_OsalClock clock;
+
+    OsalClock_Init(&clock, CLOCK_TEST_COUNTER_FREQ_HZ, CLOCK_TEST_TICK_FREQ_HZ, 0, 0xF0000000U);
+
+    for (uint64_t cycles = 0; cycles < CLOCK_TEST_NO_TICK_DURATION_S * CLOCK_TEST_COUNTER_FREQ_HZ;
+         cycles += CLOCK_TEST_NO_TICK_READ_STEP) {
+        TEST_ASSERT(OsalClock_GetTimeUs(&clock, 0, (uint32_t) (0xF0000000U + cycles)) ==
+                    cycles / CLOCK_TEST_COUNTER_PER_US);
+    }
+}
+
+/* Hourly reads over 120 days, the tick elapsed since the start wraps twice and the time must carry on past it. */
+static void ClockTest_RunTickWrap(void)
+{
+    T_OsalClock clock;
+    const uint32_t startTick = 1000;
+    const uint32_t startCounter = 0x12345678U;
+
+    OsalClock_Init(&clock, CLOCK_TEST_COUNTER_FREQ_HZ, CLOCK_TEST_TICK_FREQ_HZ, startTick, startCounter);
+
+    for (uint64_t cycles = 0; cycles < CLOCK_TEST_LONG_DURATION_S * CLOCK_TEST_COUNTER_FREQ_HZ;
+         cycles += CLOCK_TEST_LONG_READ_STEP) {
+        uint32_t tick = (uint32_t) (startTick + cycles / CLOCK_TEST_COUNTER_PER_TICK);
+        uint32_t counter = (uint32_t) (startCounter + cycles);
+
+        TEST_ASSERT(OsalClock_GetTimeUs(&clock, tick, counter) ==
+                    (uint64_t) startTick * 1000 + cycles / CLOCK_TEST_COUNTER_PER_US);
+    }
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
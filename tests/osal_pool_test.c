@@ -0,0 +1,186 @@
+/**
+ ********************************************************************
+ * @file    osal_pool_test.c
+ * @brief   Runs the fixed-block pool of the FreeRTOS OSAL on the host, checking class selection, spill to
+ * larger classes, pointer ownership and that long random churn never fragments it.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "test_common.h"
+#include "osal_pool.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define POOL_TEST_CLASS_NUM             (3)
+#define POOL_TEST_BLOCK_NUM             (7)
+#define POOL_TEST_LIVE_NUM              (16)
+#define POOL_TEST_CHURN_NUM             (1000000)
+#define POOL_TEST_MAX_REQUEST_SIZE      (128)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint8_t *ptr;
+    uint32_t size;
+    uint8_t pattern;
+} T_PoolTestBlock;
+
+/* Private values -------------------------------------------------------------*/
+//the 60 bytes class is aligned up to 64
+static const T_OsalPoolClassConfig s_poolTestConfig[POOL_TEST_CLASS_NUM] = {{32, 4}, {60, 2}, {128, 1}};
+static uint64_t s_poolTestMemory[64];
+static T_OsalPoolClass s_poolTestClasses[POOL_TEST_CLASS_NUM];
+static T_OsalPool s_poolTest;
+
+/* Private functions declaration ---------------------------------------------*/
+static void PoolTest_RunInit(void);
+static void PoolTest_RunAlloc(void);
+static void PoolTest_RunChurn(void);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    PoolTest_RunInit();
+    PoolTest_RunAlloc();
+    PoolTest_RunChurn();
+
+    printf("osal pool test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void PoolTest_RunInit(void)
+{
+    const T_OsalPoolClassConfig unsortedConfig[] = {{64, 1}, {32, 1}};
+    T_OsalPool pool = {0};
+    uint32_t memorySize = OsalPool_GetMemorySize(s_poolTestConfig, POOL_TEST_CLASS_NUM);
+
+    TEST_ASSERT(memorySize == 32 * 4 + 64 * 2 + 128);
+    TEST_ASSERT(OsalPool_Init(&pool, s_poolTestClasses, s_poolTestConfig, POOL_TEST_CLASS_NUM, s_poolTestMemory,
+                              memorySize - 1) == false);
+    TEST_ASSERT(OsalPool_Init(&pool, s_poolTestClasses, s_poolTestConfig, POOL_TEST_CLASS_NUM,
+                              (uint8_t *) s_poolTestMemory + 4, memorySize) == false);
+    TEST_ASSERT(OsalPool_Init(&pool, s_poolTestClasses, unsortedConfig, 2, s_poolTestMemory, memorySize) == false);
+
+    // A pool that failed to build serves nothing and owns no pointer, the caller falls back to its heap.
+    TEST_ASSERT(pool.classCount == 0);
+    TEST_ASSERT(OsalPool_Alloc(&pool, 1) == NULL);
+    TEST_ASSERT(OsalPool_Free(&pool, s_poolTestMemory) == false);
+
+    TEST_ASSERT(OsalPool_Init(&s_poolTest, s_poolTestClasses, s_poolTestConfig, POOL_TEST_CLASS_NUM,
+                              s_poolTestMemory, memorySize) == true);
+}
+
+/* Requests take the smallest class that fits, spill to a larger one when it is exhausted and fail after that. */
+static void PoolTest_RunAlloc(void)
+{
+    void *smallBlocks[4];
+    void *spillBlock;
+    void *mediumBlock;
+    void *largeBlock;
+    int anyValue;
+
+    for (int i = 0; i < 4; i++) {
+        smallBlocks[i] = OsalPool_Alloc(&s_poolTest, 20);
+        TEST_ASSERT(smallBlocks[i] != NULL);
+        TEST_ASSERT(OsalPool_GetBlockSize(&s_poolTest, smallBlocks[i]) == 32);
+    }
+
+    spillBlock = OsalPool_Alloc(&s_poolTest, 20);
+    TEST_ASSERT(OsalPool_GetBlockSize(&s_poolTest, spillBlock) == 64);
+    TEST_ASSERT(s_poolTestClasses[0].spillCount == 1);
+
+    // Larger than every class, left to the caller without counting a failure.
+    TEST_ASSERT(OsalPool_Alloc(&s_poolTest, 200) == NULL);
+    TEST_ASSERT(s_poolTest.failCount == 0);
+
+    mediumBlock = OsalPool_Alloc(&s_poolTest, 64);
+    largeBlock = OsalPool_Alloc(&s_poolTest, 64);
+    TEST_ASSERT(OsalPool_GetBlockSize(&s_poolTest, mediumBlock) == 64);
+    TEST_ASSERT(OsalPool_GetBlockSize(&s_poolTest, largeBlock) == 128);
+    TEST_ASSERT(OsalPool_Alloc(&s_poolTest, 64) == NULL);
+    TEST_ASSERT(s_poolTest.failCount == 1);
+
+    // Pointers inside a block or outside the pool are not freed.
+    TEST_ASSERT(OsalPool_Free(&s_poolTest, (uint8_t *) smallBlocks[0] + 8) == false);
+    TEST_ASSERT(OsalPool_Free(&s_poolTest, &anyValue) == false);
+    TEST_ASSERT(OsalPool_IsFromPool(&s_poolTest, &anyValue) == false);
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT(OsalPool_Free(&s_poolTest, smallBlocks[i]) == true);
+    }
+    TEST_ASSERT(OsalPool_Free(&s_poolTest, spillBlock) == true);
+    TEST_ASSERT(OsalPool_Free(&s_poolTest, mediumBlock) == true);
+    TEST_ASSERT(OsalPool_Free(&s_poolTest, largeBlock) == true);
+
+    for (int i = 0; i < POOL_TEST_CLASS_NUM; i++) {
+        TEST_ASSERT(s_poolTestClasses[i].usedCount == 0);
+    }
+    TEST_ASSERT(s_poolTestClasses[0].peakUsedCount == 4);
+}
+
+/* Random sized allocations and frees, live blocks never overlap and every block is still available afterwards. */
+static void PoolTest_RunChurn(void)
+{
+    T_PoolTestBlock live[POOL_TEST_LIVE_NUM] = {0};
+    uint8_t pattern = 0;
+    int blockCount = 0;
+
+    srand(1);
+    for (int round = 0; round < POOL_TEST_CHURN_NUM; round++) {
+        T_PoolTestBlock *block = &live[rand() % POOL_TEST_LIVE_NUM];
+
+        if (block->ptr != NULL) {
+            for (uint32_t i = 0; i < block->size; i++) {
+                TEST_ASSERT(block->ptr[i] == block->pattern);
+            }
+            TEST_ASSERT(OsalPool_Free(&s_poolTest, block->ptr) == true);
+            block->ptr = NULL;
+            continue;
+        }
+
+        block->size = (uint32_t) (1 + rand() % POOL_TEST_MAX_REQUEST_SIZE);
+        block->ptr = OsalPool_Alloc(&s_poolTest, block->size);
+        if (block->ptr != NULL) {
+            TEST_ASSERT(OsalPool_GetBlockSize(&s_poolTest, block->ptr) >= block->size);
+            block->pattern = ++pattern;
+            memset(block->ptr, block->pattern, block->size);
+        }
+    }
+
+    for (int i = 0; i < POOL_TEST_LIVE_NUM; i++) {
+        if (live[i].ptr != NULL) {
+            TEST_ASSERT(OsalPool_Free(&s_poolTest, live[i].ptr) == true);
+        }
+    }
+    for (int i = 0; i < POOL_TEST_CLASS_NUM; i++) {
+        TEST_ASSERT(s_poolTestClasses[i].usedCount == 0);
+    }
+
+    // No fragmentation: the largest request still gets the 128 bytes block, and every block is handed out again.
+    TEST_ASSERT(OsalPool_GetBlockSize(&s_poolTest, OsalPool_Alloc(&s_poolTest, POOL_TEST_MAX_REQUEST_SIZE)) == 128);
+    blockCount = 1;
+    while (OsalPool_Alloc(&s_poolTest, 1) != NULL) {
+        blockCount++;
+    }
+    TEST_ASSERT(blockCount == POOL_TEST_BLOCK_NUM);
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,605 @@
+/**
+ ********************************************************************
+ * @file    positioning_test.c
+ * @brief   Runs the positioning event batching against a stubbed positioning module and a simulated pps,
+ * and checks that the rtcm journal and its replay keep the received stream byte for byte.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "test_common.h"
+#include "dji_platform.h"
+#include "dji_time_sync.h"
+#include "osal/osal.h"
+#include "osal/osal_fs.h"
+#include "positioning/test_positioning.h"
+#include "positioning/test_positioning_rtcm_journal.h"
+#include "fc_subscription/test_fc_subscription.h"
+#include "time_sync/test_time_sync.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define POSITIONING_TEST_EVENT_START_US         (100 * 1000000ULL)
+#define POSITIONING_TEST_EVENT_INTERVAL_US      (10000)
+#define POSITIONING_TEST_DUE_EVENT_NUM          (10)
+#define POSITIONING_TEST_EVENT_NUM              (POSITIONING_TEST_DUE_EVENT_NUM + 1)
+#define POSITIONING_TEST_WAIT_MS                (3000)
+#define POSITIONING_TEST_FAILED_SET_INDEX       (0xFFFF)
+
+#define POSITIONING_TEST_JOURNAL_STREAM_SIZE    (40 * 1024)
+#define POSITIONING_TEST_JOURNAL_MAX_FILE_SIZE  (4096)
+#define POSITIONING_TEST_JOURNAL_KEPT_FILE_NUM  (3)
+#define POSITIONING_TEST_PATH_SIZE              (128)
+
+#define POSITIONING_TEST_RTCM_FRAME_NUM         (300)
+#define POSITIONING_TEST_RTCM_GARBAGE_PERIOD    (20)
+
+#define POSITIONING_TEST_STOP_RACE_CYCLE_NUM    (200)
+#define POSITIONING_TEST_STOP_RACE_CHUNK_SIZE   (64)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    T_DjiTestPositioningEvent event;
+    T_DjiReturnCode result;
+} T_PositioningTestResult;
+
+/* Private values -------------------------------------------------------------*/
+static volatile uint64_t s_ppsUs = 0;
+static volatile T_DjiReturnCode s_satelliteNumberReturnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+static volatile bool s_isStopRaceWriting = false;
+static pthread_mutex_t s_resultMutex = PTHREAD_MUTEX_INITIALIZER;
+static T_PositioningTestResult s_results[DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE];
+static uint32_t s_resultCount = 0;
+static uint32_t s_requestedCounts[DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE];
+static uint64_t s_requestedTimes[DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE][DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX];
+static uint32_t s_requestCount = 0;
+static char s_journalPrefix[DJI_TEST_POSITIONING_RTCM_JOURNAL_PREFIX_MAX_SIZE];
+static char s_journalUnusedPrefix[DJI_TEST_POSITIONING_RTCM_JOURNAL_PREFIX_MAX_SIZE];
+
+/* Private functions declaration ---------------------------------------------*/
+static void PositioningTest_RunEventBatches(void);
+static void PositioningTest_RunQueueFull(void);
+static void PositioningTest_RunJournal(uint32_t maxFileCount);
+static void PositioningTest_RunReplay(void);
+static void PositioningTest_RunJournalStopRace(void);
+static void *PositioningTest_StopRaceWriteTask(void *arg);
+static void PositioningTest_ResultCallback(const T_DjiTestPositioningEvent *event,
+                                           const T_DjiPositioningPositionInfo *positionInfo, T_DjiReturnCode result);
+static uint32_t PositioningTest_GetResultCount(void);
+static uint8_t *PositioningTest_ReadJournal(uint32_t firstFileIndex, uint32_t fileCount, uint32_t *size);
+static uint32_t PositioningTest_Crc24q(const uint8_t *data, uint32_t len);
+T_DjiReturnCode __wrap_DjiPositioning_Init(void);
+void __wrap_DjiPositioning_SetTaskIndex(uint8_t index);
+T_DjiReturnCode __wrap_DjiPositioning_RegReceiveRtcmDataCallback(E_DjiPositioningRtcmDataType dataType,
+                                                                 DjiReceiveRtkRtcmDataCallback callback);
+T_DjiReturnCode __wrap_DjiTimeSync_TransferToAircraftTime(uint64_t localTimeUs,
+                                                          T_DjiTimeSyncAircraftTime *aircraftTime);
+T_DjiReturnCode __wrap_DjiPositioning_GetPositionInformationSync(uint8_t eventCount,
+                                                                 T_DjiPositioningEventInfo *eventInfo,
+                                                                 T_DjiPositioningPositionInfo *positionInfo);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    static const T_DjiFileSystemHandler fileSystemHandler = {
+        .FileOpen = Osal_FileOpen,
+        .FileClose = Osal_FileClose,
+        .FileWrite = Osal_FileWrite,
+        .FileRead = Osal_FileRead,
+        .FileSync = Osal_FileSync,
+        .FileSeek = Osal_FileSeek,
+        .DirOpen = Osal_DirOpen,
+        .DirClose = Osal_DirClose,
+        .DirRead = Osal_DirRead,
+        .Mkdir = Osal_Mkdir,
+        .Unlink = Osal_Unlink,
+        .Rename = Osal_Rename,
+        .Stat = Osal_Stat,
+    };
+    const char *outputDir;
+
+    TestCommon_Init();
+    TEST_ASSERT_SUCCESS(DjiPlatform_RegFileSystemHandler(&fileSystemHandler));
+
+    outputDir = TestCommon_GetOutputDir("positioning_test");
+    snprintf(s_journalPrefix, sizeof(s_journalPrefix), "%s/air", outputDir);
+    snprintf(s_journalUnusedPrefix, sizeof(s_journalUnusedPrefix), "%s/base", outputDir);
+
+    PositioningTest_RunEventBatches();
+    PositioningTest_RunQueueFull();
+    PositioningTest_RunJournal(0);
+    PositioningTest_RunJournal(POSITIONING_TEST_JOURNAL_KEPT_FILE_NUM);
+    PositioningTest_RunReplay();
+    PositioningTest_RunJournalStopRace();
+
+    printf("positioning test passed\n");
+    return 0;
+}
+
+/* Stubs of the psdk positioning and time synchronization calls, linked with --wrap, the aircraft time carries the
+ * local time. */
+T_DjiReturnCode __wrap_DjiPositioning_Init(void)
+{
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+void __wrap_DjiPositioning_SetTaskIndex(uint8_t index)
+{
+    (void) index;
+}
+
+T_DjiReturnCode __wrap_DjiPositioning_RegReceiveRtcmDataCallback(E_DjiPositioningRtcmDataType dataType,
+                                                                 DjiReceiveRtkRtcmDataCallback callback)
+{
+    (void) dataType;
+    (void) callback;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiTimeSync_TransferToAircraftTime(uint64_t localTimeUs,
+                                                          T_DjiTimeSyncAircraftTime *aircraftTime)
+{
+    uint64_t seconds = localTimeUs / 1000000;
+
+    memset(aircraftTime, 0, sizeof(*aircraftTime));
+    aircraftTime->hour = (uint8_t) (seconds / 3600);
+    aircraftTime->minute = (uint8_t) (seconds / 60 % 60);
+    aircraftTime->second = (uint8_t) (seconds % 60);
+    aircraftTime->microsecond = (uint32_t) (localTimeUs % 1000000);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode __wrap_DjiPositioning_GetPositionInformationSync(uint8_t eventCount,
+                                                                 T_DjiPositioningEventInfo *eventInfo,
+                                                                 T_DjiPositioningPositionInfo *positionInfo)
+{
+    T_DjiTimeSyncAircraftTime *eventTime;
+    uint64_t eventTimeUs;
+    uint8_t i;
+
+    TEST_ASSERT(eventCount > 0 && eventCount <= DJI_TEST_POSITIONING_EVENT_BATCH_SIZE_MAX);
+    TEST_ASSERT(s_requestCount < DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE);
+
+    for (i = 0; i < eventCount; i++) {
+        eventTime = &eventInfo[i].eventTime;
+        eventTimeUs = ((uint64_t) eventTime->hour * 3600 + eventTime->minute * 60 + eventTime->second) * 1000000 +
+                      eventTime->microsecond;
+        // the aircraft only answers for timestamps between 2 and 1 seconds before the newest pps
+        TEST_ASSERT(eventTimeUs + 2000000 >= s_ppsUs && eventTimeUs + 1000000 <= s_ppsUs);
+        s_requestedTimes[s_requestCount][i] = eventTimeUs;
+
+        positionInfo[i].targetPointPosition.longitude = eventInfo[i].eventSetIndex;
+        positionInfo[i].targetPointPosition.latitude = eventInfo[i].targetPointIndex;
+        if (eventInfo[i].eventSetIndex == POSITIONING_TEST_FAILED_SET_INDEX) {
+            s_requestedCounts[s_requestCount++] = eventCount;
+            return DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT;
+        }
+    }
+    s_requestedCounts[s_requestCount++] = eventCount;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_TimeSyncGetNewestPpsTriggerLocalTimeUs(uint64_t *localTimeUs)
+{
+    if (s_ppsUs == 0) {
+        return DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    }
+
+    *localTimeUs = s_ppsUs;
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+T_DjiReturnCode DjiTest_FcSubscriptionGetTotalSatelliteNumber(uint8_t *number)
+{
+    *number = 12;
+    return s_satelliteNumberReturnCode;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void PositioningTest_RunEventBatches(void)
+{
+    T_DjiTestPositioningEvent events[POSITIONING_TEST_EVENT_NUM];
+    T_DjiTestPositioningEventStatistics statistics;
+    uint32_t waitedMs = 0;
+    uint32_t resolvedCount = 0;
+    uint32_t expiredCount = 0;
+    uint32_t i;
+    uint32_t j;
+
+    TEST_ASSERT(DjiTest_PositioningSubmitEvents(events, 1) == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningEventServiceStart(PositioningTest_ResultCallback));
+    TEST_ASSERT(DjiTest_PositioningEventServiceStart(PositioningTest_ResultCallback) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+
+    // submitted youngest first, the requests have to take the oldest ones first
+    for (i = 0; i < POSITIONING_TEST_DUE_EVENT_NUM; i++) {
+        events[i].eventSetIndex = (uint16_t) i;
+        events[i].targetPointIndex = (uint8_t) (i % 3);
+        events[i].localTimeUs = POSITIONING_TEST_EVENT_START_US +
+                                (POSITIONING_TEST_DUE_EVENT_NUM - i) * POSITIONING_TEST_EVENT_INTERVAL_US;
+    }
+    // older than the request window once the pps moves on
+    events[POSITIONING_TEST_DUE_EVENT_NUM].eventSetIndex = POSITIONING_TEST_DUE_EVENT_NUM;
+    events[POSITIONING_TEST_DUE_EVENT_NUM].targetPointIndex = 0;
+    events[POSITIONING_TEST_DUE_EVENT_NUM].localTimeUs = POSITIONING_TEST_EVENT_START_US - 600000;
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningSubmitEvents(events, POSITIONING_TEST_EVENT_NUM));
+
+    // nothing is requested before the events are in the window of the newest pps
+    s_ppsUs = POSITIONING_TEST_EVENT_START_US;
+    Osal_TaskSleepMs(300);
+    TEST_ASSERT(PositioningTest_GetResultCount() == 0 && s_requestCount == 0);
+
+    s_ppsUs = POSITIONING_TEST_EVENT_START_US + 1500000;
+    while (PositioningTest_GetResultCount() < POSITIONING_TEST_EVENT_NUM && waitedMs < POSITIONING_TEST_WAIT_MS) {
+        Osal_TaskSleepMs(10);
+        waitedMs += 10;
+    }
+    TEST_ASSERT(PositioningTest_GetResultCount() == POSITIONING_TEST_EVENT_NUM);
+
+    // 10 due events give full batches of 4 then the rest, each batch older than the next one
+    TEST_ASSERT(s_requestCount == 3);
+    TEST_ASSERT(s_requestedCounts[0] == 4 && s_requestedCounts[1] == 4 && s_requestedCounts[2] == 2);
+    for (i = 0; i + 1 < s_requestCount; i++) {
+        for (j = 0; j < s_requestedCounts[i]; j++) {
+            TEST_ASSERT(s_requestedTimes[i][j] < s_requestedTimes[i + 1][0]);
+        }
+    }
+
+    for (i = 0; i < s_resultCount; i++) {
+        if (s_results[i].result == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            resolvedCount++;
+        } else if (s_results[i].result == DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT) {
+            TEST_ASSERT(s_results[i].event.eventSetIndex == POSITIONING_TEST_DUE_EVENT_NUM);
+            expiredCount++;
+        }
+    }
+    TEST_ASSERT(resolvedCount == POSITIONING_TEST_DUE_EVENT_NUM && expiredCount == 1);
+
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningGetEventStatistics(&statistics));
+    TEST_ASSERT(statistics.submittedCount == POSITIONING_TEST_EVENT_NUM && statistics.droppedCount == 0);
+    TEST_ASSERT(statistics.resolvedCount == POSITIONING_TEST_DUE_EVENT_NUM && statistics.expiredCount == 1);
+    TEST_ASSERT(statistics.failedCount == 0 && statistics.requestCount == 3);
+
+    // a failed request fails every event of its batch
+    events[0].eventSetIndex = POSITIONING_TEST_FAILED_SET_INDEX;
+    events[0].localTimeUs = s_ppsUs - 1500000;
+    events[1].eventSetIndex = 0;
+    events[1].localTimeUs = s_ppsUs - 1400000;
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningSubmitEvents(events, 2));
+    waitedMs = 0;
+    while (PositioningTest_GetResultCount() < POSITIONING_TEST_EVENT_NUM + 2 && waitedMs < POSITIONING_TEST_WAIT_MS) {
+        Osal_TaskSleepMs(10);
+        waitedMs += 10;
+    }
+    TEST_ASSERT(PositioningTest_GetResultCount() == POSITIONING_TEST_EVENT_NUM + 2);
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningGetEventStatistics(&statistics));
+    TEST_ASSERT(statistics.failedCount == 2 && statistics.requestCount == 4);
+
+    // without the satellite number of the fc subscription the position is not requested, the batch fails
+    s_satelliteNumberReturnCode = DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND;
+    events[0].eventSetIndex = 1;
+    events[0].localTimeUs = s_ppsUs - 1500000;
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningSubmitEvents(events, 1));
+    waitedMs = 0;
+    while (PositioningTest_GetResultCount() < POSITIONING_TEST_EVENT_NUM + 3 && waitedMs < POSITIONING_TEST_WAIT_MS) {
+        Osal_TaskSleepMs(10);
+        waitedMs += 10;
+    }
+    TEST_ASSERT(PositioningTest_GetResultCount() == POSITIONING_TEST_EVENT_NUM + 3);
+    TEST_ASSERT(s_results[POSITIONING_TEST_EVENT_NUM + 2].result == DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND);
+    TEST_ASSERT(s_requestCount == 4);
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningGetEventStatistics(&statistics));
+    TEST_ASSERT(statistics.failedCount == 3);
+    s_satelliteNumberReturnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    printf("event batches: %u events in %u requests\n", statistics.submittedCount, statistics.requestCount);
+}
+
+static void PositioningTest_RunQueueFull(void)
+{
+    static T_DjiTestPositioningEvent events[DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE + 2];
+    T_DjiTestPositioningEventStatistics before;
+    T_DjiTestPositioningEventStatistics after;
+    uint32_t i;
+
+    // too young to be requested, they stay in the queue
+    for (i = 0; i < DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE + 2; i++) {
+        events[i].eventSetIndex = (uint16_t) i;
+        events[i].targetPointIndex = 0;
+        events[i].localTimeUs = s_ppsUs;
+    }
+
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningGetEventStatistics(&before));
+    TEST_ASSERT(DjiTest_PositioningSubmitEvents(events, DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE + 2) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningGetEventStatistics(&after));
+    TEST_ASSERT(after.droppedCount == before.droppedCount + 2);
+    TEST_ASSERT(after.maxQueuedCount == DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE);
+}
+
+static void PositioningTest_RunJournal(uint32_t maxFileCount)
+{
+    T_DjiTestPositioningRtcmJournalConfig config = {0};
+    T_DjiTestPositioningRtcmJournalStatistics statistics;
+    char filePath[POSITIONING_TEST_PATH_SIZE];
+    uint8_t *stream;
+    uint8_t *journal;
+    uint32_t journalSize;
+    uint32_t streamSize = 0;
+    uint32_t chunkSize;
+    uint32_t keptFileCount;
+    uint32_t i;
+
+    stream = malloc(POSITIONING_TEST_JOURNAL_STREAM_SIZE);
+    TEST_ASSERT(stream != NULL);
+    srand(maxFileCount + 1);
+    for (i = 0; i < POSITIONING_TEST_JOURNAL_STREAM_SIZE; i++) {
+        stream[i] = (uint8_t) rand();
+    }
+
+    config.maxFileSize = POSITIONING_TEST_JOURNAL_MAX_FILE_SIZE;
+    config.maxFileCount = maxFileCount;
+    config.flushPeriodMs = 5;
+    TEST_ASSERT(DjiTest_PositioningRtcmJournalWrite(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT, stream, 1) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalStart(&config, s_journalPrefix, s_journalUnusedPrefix));
+    TEST_ASSERT(DjiTest_PositioningRtcmJournalStart(&config, s_journalPrefix, s_journalUnusedPrefix) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+
+    // chunks are spread over several flushes so that the journal has to rotate between them
+    while (streamSize < POSITIONING_TEST_JOURNAL_STREAM_SIZE) {
+        chunkSize = 100 + (uint32_t) rand() % 500;
+        if (chunkSize > POSITIONING_TEST_JOURNAL_STREAM_SIZE - streamSize) {
+            chunkSize = POSITIONING_TEST_JOURNAL_STREAM_SIZE - streamSize;
+        }
+        TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalWrite(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT,
+                                                                &stream[streamSize], (uint16_t) chunkSize));
+        streamSize += chunkSize;
+        usleep(1000);
+    }
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalStop());
+    TEST_ASSERT(DjiTest_PositioningRtcmJournalIsRunning() == false);
+
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalGetStatistics(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT,
+                                                                    &statistics));
+    TEST_ASSERT(statistics.receivedBytes == streamSize && statistics.writtenBytes == streamSize);
+    TEST_ASSERT(statistics.droppedBytes == 0 && statistics.writeErrorCount == 0);
+    TEST_ASSERT(statistics.fileCount > POSITIONING_TEST_JOURNAL_KEPT_FILE_NUM);
+
+    // only the newest parts are kept, concatenated they give back the end of the stream
+    keptFileCount = maxFileCount > 0 ? maxFileCount : statistics.fileCount;
+    for (i = 0; i < statistics.fileCount - keptFileCount; i++) {
+        snprintf(filePath, sizeof(filePath), "%s_%03u.rtcm", s_journalPrefix, i);
+        TEST_ASSERT(access(filePath, F_OK) != 0);
+    }
+    journal = PositioningTest_ReadJournal(statistics.fileCount - keptFileCount, keptFileCount, &journalSize);
+    TEST_ASSERT(journalSize <= streamSize);
+    TEST_ASSERT(memcmp(journal, &stream[streamSize - journalSize], journalSize) == 0);
+    if (maxFileCount == 0) {
+        TEST_ASSERT(journalSize == streamSize);
+    }
+
+    printf("rtcm journal: %u bytes in %u parts, %u kept\n", streamSize, statistics.fileCount, keptFileCount);
+
+    free(journal);
+    free(stream);
+}
+
+static void PositioningTest_RunReplay(void)
+{
+    T_DjiTestPositioningRtcmJournalConfig config = {0};
+    T_DjiTestPositioningRtcmJournalStatistics statistics;
+    char replayPath[POSITIONING_TEST_PATH_SIZE];
+    static uint8_t frames[POSITIONING_TEST_RTCM_FRAME_NUM * 1029];
+    static const uint8_t garbage[] = {0xD3, 0x00, 0x04, 0x01, 0x02, 0x03};
+    uint8_t frame[1029];
+    uint8_t *journal;
+    uint32_t journalSize;
+    uint32_t framesSize = 0;
+    uint32_t payloadLen;
+    uint32_t crc;
+    uint32_t i;
+    uint32_t j;
+    FILE *replayFile;
+
+    snprintf(replayPath, sizeof(replayPath), "%s/replay.rtcm", TestCommon_GetOutputDir("positioning_test"));
+    replayFile = fopen(replayPath, "wb");
+    TEST_ASSERT(replayFile != NULL);
+
+    // valid frames of random sizes, with truncated ones and garbage between them that the replay has to skip
+    srand(7);
+    for (i = 0; i < POSITIONING_TEST_RTCM_FRAME_NUM; i++) {
+        payloadLen = (uint32_t) rand() % 1024;
+        frame[0] = 0xD3;
+        frame[1] = (uint8_t) (payloadLen >> 8);
+        frame[2] = (uint8_t) payloadLen;
+        for (j = 0; j < payloadLen; j++) {
+            frame[3 + j] = (uint8_t) rand();
+        }
+        crc = PositioningTest_Crc24q(frame, 3 + payloadLen);
+        frame[3 + payloadLen] = (uint8_t) (crc >> 16);
+        frame[4 + payloadLen] = (uint8_t) (crc >> 8);
+        frame[5 + payloadLen] = (uint8_t) crc;
+
+        TEST_ASSERT(fwrite(frame, 1, payloadLen + 6, replayFile) == payloadLen + 6);
+        memcpy(&frames[framesSize], frame, payloadLen + 6);
+        framesSize += payloadLen + 6;
+        if (i % POSITIONING_TEST_RTCM_GARBAGE_PERIOD == 0) {
+            TEST_ASSERT(fwrite(garbage, 1, sizeof(garbage), replayFile) == sizeof(garbage));
+        }
+    }
+    fclose(replayFile);
+
+    config.maxFileSize = 16 * 1024 * 1024;
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalStart(&config, s_journalPrefix, s_journalUnusedPrefix));
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningRunRtcmReplay(replayPath, 0));
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalStop());
+
+    TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalGetStatistics(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT,
+                                                                    &statistics));
+    TEST_ASSERT(statistics.receivedChunks == POSITIONING_TEST_RTCM_FRAME_NUM && statistics.droppedBytes == 0);
+    TEST_ASSERT(statistics.fileCount == 1);
+
+    journal = PositioningTest_ReadJournal(0, 1, &journalSize);
+    TEST_ASSERT(journalSize == framesSize);
+    TEST_ASSERT(memcmp(journal, frames, framesSize) == 0);
+    free(journal);
+
+    TEST_ASSERT(DjiTest_PositioningRunRtcmReplay("not_recorded.rtcm", 0) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS);
+
+    printf("rtcm replay: %u frames journaled, garbage skipped\n", statistics.receivedChunks);
+}
+
+/* Stop and start the journal again and again while an rtcm callback keeps writing to it. */
+static void PositioningTest_RunJournalStopRace(void)
+{
+    T_DjiTestPositioningRtcmJournalConfig config = {0};
+    T_DjiTestPositioningRtcmJournalStatistics statistics;
+    pthread_t writeThread;
+    uint32_t i;
+
+    config.flushPeriodMs = 5;
+    s_isStopRaceWriting = true;
+    TEST_ASSERT(pthread_create(&writeThread, NULL, PositioningTest_StopRaceWriteTask, NULL) == 0);
+
+    for (i = 0; i < POSITIONING_TEST_STOP_RACE_CYCLE_NUM; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalStart(&config, s_journalPrefix, s_journalUnusedPrefix));
+        usleep(2000);
+        TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalStop());
+
+        // what was accepted before the stop has been written, nothing is accepted after it
+        TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalGetStatistics(
+            DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT, &statistics));
+        TEST_ASSERT(statistics.receivedBytes == statistics.writtenBytes + statistics.droppedBytes);
+        usleep(1000);
+        TEST_ASSERT_SUCCESS(DjiTest_PositioningRtcmJournalGetStatistics(
+            DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT, &statistics));
+        TEST_ASSERT(statistics.receivedBytes == statistics.writtenBytes + statistics.droppedBytes);
+    }
+
+    s_isStopRaceWriting = false;
+    TEST_ASSERT(pthread_join(writeThread, NULL) == 0);
+
+    printf("rtcm journal stop race: %u cycles\n", POSITIONING_TEST_STOP_RACE_CYCLE_NUM);
+}
+
+static void *PositioningTest_StopRaceWriteTask(void *arg)
+{
+    uint8_t chunk[POSITIONING_TEST_STOP_RACE_CHUNK_SIZE] = {0xD3};
+    T_DjiReturnCode returnCode;
+
+    (void) arg;
+
+    while (s_isStopRaceWriting) {
+        returnCode = DjiTest_PositioningRtcmJournalWrite(DJI_POSITIONING_RTCM_DATA_TYPE_RTK_ON_AIRCRAFT, chunk,
+                                                         sizeof(chunk));
+        TEST_ASSERT(returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS ||
+                    returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE ||
+                    returnCode == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+static void PositioningTest_ResultCallback(const T_DjiTestPositioningEvent *event,
+                                           const T_DjiPositioningPositionInfo *positionInfo, T_DjiReturnCode result)
+{
+    if (result == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+        TEST_ASSERT(positionInfo != NULL);
+        TEST_ASSERT(positionInfo->targetPointPosition.longitude == event->eventSetIndex);
+        TEST_ASSERT(positionInfo->targetPointPosition.latitude == event->targetPointIndex);
+    } else {
+        TEST_ASSERT(positionInfo == NULL);
+    }
+
+    pthread_mutex_lock(&s_resultMutex);
+    TEST_ASSERT(s_resultCount < DJI_TEST_POSITIONING_EVENT_QUEUE_SIZE);
+    s_results[s_resultCount].event = *event;
+    s_results[s_resultCount].result = result;
+    s_resultCount++;
+    pthread_mutex_unlock(&s_resultMutex);
+}
+
+static uint32_t PositioningTest_GetResultCount(void)
+{
+    uint32_t resultCount;
+
+    pthread_mutex_lock(&s_resultMutex);
+    resultCount = s_resultCount;
+    pthread_mutex_unlock(&s_resultMutex);
+
+    return resultCount;
+}
+
+static uint8_t *PositioningTest_ReadJournal(uint32_t firstFileIndex, uint32_t fileCount, uint32_t *size)
+{
+    char filePath[POSITIONING_TEST_PATH_SIZE];
+    uint8_t *data = NULL;
+    uint32_t dataSize = 0;
+    long fileSize;
+    FILE *file;
+    uint32_t i;
+
+    for (i = firstFileIndex; i < firstFileIndex + fileCount; i++) {
+        snprintf(filePath, sizeof(filePath), "%s_%03u.rtcm", s_journalPrefix, i);
+        file = fopen(filePath, "rb");
+        TEST_ASSERT(file != NULL);
+        TEST_ASSERT(fseek(file, 0, SEEK_END) == 0);
+        fileSize = ftell(file);
+        TEST_ASSERT(fileSize > 0);
+        TEST_ASSERT(fseek(file, 0, SEEK_SET) == 0);
+
+        data = realloc(data, dataSize + fileSize);
+        TEST_ASSERT(data != NULL);
+        TEST_ASSERT(fread(&data[dataSize], 1, fileSize, file) == (size_t) fileSize);
+        dataSize += (uint32_t) fileSize;
+        fclose(file);
+    }
+
+    *size = dataSize;
+    return data;
+}
+
+static uint32_t PositioningTest_Crc24q(const uint8_t *data, uint32_t len)
+{
+    uint32_t crc = 0;
+    uint32_t i;
+    uint8_t j;
+
+    for (i = 0; i < len; i++) {
+        crc ^= (uint32_t) data[i] << 16;
+        for (j = 0; j < 8; j++) {
+            crc <<= 1;
+            if (crc & 0x1000000) {
+                crc ^= 0x1864CFB;
+            }
+        }
+    }
+
+    return crc & 0xFFFFFF;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
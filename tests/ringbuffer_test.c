@@ -0,0 +1,288 @@
+/**
+ ********************************************************************
+ * @file    ringbuffer_test.c
+ * @brief   Runs the STM32F4 UART ring buffer against a simulated circular DMA, checking wraparound of
+ * the indexes and that data overrun by the DMA, before or during a read, is never returned.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "test_common.h"
+#include "dji_ringbuffer.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define RINGBUF_TEST_BUF_SIZE           (64)
+#define RINGBUF_TEST_INDEX_START        (65500)
+#define RINGBUF_TEST_ROUND_NUM          (5000)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    T_RingBuffer *ringBuffer;
+    uint16_t producerIndex;
+    //bytes the DMA writes between the copy of the consumer and the second position snapshot
+    uint16_t writeLenDuringCopy;
+    uint8_t *readBuf;
+    uint8_t callCount;
+} T_RingBufTestDma;
+
+/* Private values -------------------------------------------------------------*/
+static uint8_t s_ringBufTestBuf[RINGBUF_TEST_BUF_SIZE];
+
+/* Private functions declaration ---------------------------------------------*/
+static uint8_t RingBufTest_GetByte(uint16_t index);
+static void RingBufTest_DmaWrite(T_RingBufTestDma *dma, uint16_t len, bool isCommit);
+static uint16_t RingBufTest_GetDmaWriteOffset(void *arg);
+static void RingBufTest_CheckSequence(const uint8_t *data, uint16_t len, uint16_t index);
+static void RingBufTest_RunPutGet(void);
+static void RingBufTest_RunLinearRead(void);
+static void RingBufTest_RunDmaRead(void);
+static void RingBufTest_RunDmaOverrunBeforeRead(void);
+static void RingBufTest_RunDmaOverrunDuringRead(void);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    RingBufTest_RunPutGet();
+    RingBufTest_RunLinearRead();
+    RingBufTest_RunDmaRead();
+    RingBufTest_RunDmaOverrunBeforeRead();
+    RingBufTest_RunDmaOverrunDuringRead();
+
+    printf("ring buffer test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+/* Content of the byte at a stream index, a byte overwritten a lap later reads differently. */
+static uint8_t RingBufTest_GetByte(uint16_t index)
+{
+    return (uint8_t) (index * 7 + (index >> 8));
+}
+
+static void RingBufTest_DmaWrite(T_RingBufTestDma *dma, uint16_t len, bool isCommit)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        dma->ringBuffer->bufferPtr[dma->producerIndex & (dma->ringBuffer->bufferSize - 1)] =
+            RingBufTest_GetByte(dma->producerIndex);
+        dma->producerIndex++;
+    }
+
+    if (isCommit) {
+        RingBuf_CommitWrite(dma->ringBuffer, dma->producerIndex & (dma->ringBuffer->bufferSize - 1));
+    }
+}
+
+/* Snapshot of the DMA position, the second one of a read comes after the copy of the consumer. */
+static uint16_t RingBufTest_GetDmaWriteOffset(void *arg)
+{
+    T_RingBufTestDma *dma = (T_RingBufTestDma *) arg;
+    uint16_t startIndex;
+
+    dma->callCount++;
+    if (dma->callCount == 2 && dma->writeLenDuringCopy != 0) {
+        // The DMA won the race on the start of the copy, the consumer got the bytes of the next lap.
+        startIndex = (uint16_t) (dma->producerIndex - dma->ringBuffer->bufferSize);
+        RingBufTest_DmaWrite(dma, dma->writeLenDuringCopy, false);
+        for (uint16_t i = 0; i < dma->writeLenDuringCopy; i++) {
+            dma->readBuf[i] = RingBufTest_GetByte((uint16_t) (startIndex + dma->ringBuffer->bufferSize + i));
+        }
+    }
+
+    return (uint16_t) (dma->producerIndex & (dma->ringBuffer->bufferSize - 1));
+}
+
+static void RingBufTest_CheckSequence(const uint8_t *data, uint16_t len, uint16_t index)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        TEST_ASSERT(data[i] == RingBufTest_GetByte((uint16_t) (index + i)));
+    }
+}
+
+/* Indexes run freely and wrap at 65536, the buffer size is cut to a power of 2. */
+static void RingBufTest_RunPutGet(void)
+{
+    T_RingBuffer ringBuffer;
+    uint8_t data[RINGBUF_TEST_BUF_SIZE];
+    uint8_t readData[RINGBUF_TEST_BUF_SIZE];
+    uint16_t index = RINGBUF_TEST_INDEX_START;
+
+    RingBuf_Init(&ringBuffer, s_ringBufTestBuf, RINGBUF_TEST_BUF_SIZE + 10);
+    TEST_ASSERT(ringBuffer.bufferSize == RINGBUF_TEST_BUF_SIZE);
+
+    ringBuffer.readIndex = RINGBUF_TEST_INDEX_START;
+    ringBuffer.writeIndex = RINGBUF_TEST_INDEX_START;
+
+    for (int round = 0; round < RINGBUF_TEST_ROUND_NUM; round++) {
+        uint16_t len = (uint16_t) (round % RINGBUF_TEST_BUF_SIZE + 1);
+
+        for (uint16_t i = 0; i < len; i++) {
+            data[i] = RingBufTest_GetByte((uint16_t) (index + i));
+        }
+        TEST_ASSERT(RingBuf_Put(&ringBuffer, data, len) == len);
+        TEST_ASSERT(RingBuf_GetUsedSize(&ringBuffer) == len);
+        TEST_ASSERT(RingBuf_GetUnusedSize(&ringBuffer) == RINGBUF_TEST_BUF_SIZE - len);
+        TEST_ASSERT(RingBuf_Put(&ringBuffer, data, RINGBUF_TEST_BUF_SIZE) == RINGBUF_TEST_BUF_SIZE - len);
+
+        TEST_ASSERT(RingBuf_Get(&ringBuffer, readData, len) == len);
+        RingBufTest_CheckSequence(readData, len, index);
+        TEST_ASSERT(RingBuf_Skip(&ringBuffer, RINGBUF_TEST_BUF_SIZE) == RINGBUF_TEST_BUF_SIZE - len);
+        TEST_ASSERT(RingBuf_GetUsedSize(&ringBuffer) == 0);
+        index += len;
+    }
+}
+
+/* The tx DMA is handed blocks that end at the end of the buffer, the rest follows with the next block. */
+static void RingBufTest_RunLinearRead(void)
+{
+    T_RingBuffer ringBuffer;
+    uint8_t data[RINGBUF_TEST_BUF_SIZE];
+    uint8_t *block;
+    uint16_t index = RINGBUF_TEST_INDEX_START;
+    uint16_t blockLen;
+
+    RingBuf_Init(&ringBuffer, s_ringBufTestBuf, RINGBUF_TEST_BUF_SIZE);
+    ringBuffer.readIndex = (uint16_t) (index + 10);
+    ringBuffer.writeIndex = (uint16_t) (index + 10);
+    index += 10;
+
+    for (uint16_t i = 0; i < RINGBUF_TEST_BUF_SIZE; i++) {
+        data[i] = RingBufTest_GetByte((uint16_t) (index + i));
+    }
+    TEST_ASSERT(RingBuf_Put(&ringBuffer, data, RINGBUF_TEST_BUF_SIZE) == RINGBUF_TEST_BUF_SIZE);
+
+    blockLen = RingBuf_GetLinearReadBlock(&ringBuffer, &block);
+    TEST_ASSERT(blockLen == RINGBUF_TEST_BUF_SIZE - (index & (RINGBUF_TEST_BUF_SIZE - 1)));
+    RingBufTest_CheckSequence(block, blockLen, index);
+    TEST_ASSERT(RingBuf_Skip(&ringBuffer, blockLen) == blockLen);
+
+    TEST_ASSERT(RingBuf_GetLinearReadBlock(&ringBuffer, &block) == RINGBUF_TEST_BUF_SIZE - blockLen);
+    TEST_ASSERT(block == s_ringBufTestBuf);
+    RingBufTest_CheckSequence(block, RINGBUF_TEST_BUF_SIZE - blockLen, (uint16_t) (index + blockLen));
+    RingBuf_Skip(&ringBuffer, RINGBUF_TEST_BUF_SIZE - blockLen);
+
+    TEST_ASSERT(RingBuf_GetLinearReadBlock(&ringBuffer, &block) == 0);
+}
+
+/* A DMA committing every half buffer is read without loss, data not committed yet is left for the next read. */
+static void RingBufTest_RunDmaRead(void)
+{
+    T_RingBuffer ringBuffer;
+    T_RingBufTestDma dma = {0};
+    uint8_t readData[RINGBUF_TEST_BUF_SIZE];
+    uint16_t index = RINGBUF_TEST_INDEX_START;
+    uint16_t uncommittedLen = 0;
+    uint16_t lostLen;
+    uint16_t readLen;
+
+    RingBuf_Init(&ringBuffer, s_ringBufTestBuf, RINGBUF_TEST_BUF_SIZE);
+    ringBuffer.readIndex = index;
+    ringBuffer.writeIndex = index;
+    dma.ringBuffer = &ringBuffer;
+    dma.producerIndex = index;
+
+    for (int round = 0; round < RINGBUF_TEST_ROUND_NUM; round++) {
+        RingBufTest_DmaWrite(&dma, RINGBUF_TEST_BUF_SIZE / 2, true);
+        RingBufTest_DmaWrite(&dma, (uint16_t) (round % (RINGBUF_TEST_BUF_SIZE / 4)), false);
+
+        dma.callCount = 0;
+        readLen = RingBuf_GetOverrunChecked(&ringBuffer, readData, sizeof(readData), RingBufTest_GetDmaWriteOffset,
+                                            &dma, &lostLen);
+        TEST_ASSERT(lostLen == 0);
+        TEST_ASSERT(readLen == RINGBUF_TEST_BUF_SIZE / 2 + uncommittedLen);
+        uncommittedLen = (uint16_t) (round % (RINGBUF_TEST_BUF_SIZE / 4));
+        RingBufTest_CheckSequence(readData, readLen, index);
+        index += readLen;
+
+        // The idle line interrupt commits the rest of the burst.
+        RingBuf_CommitWrite(&ringBuffer, dma.producerIndex & (RINGBUF_TEST_BUF_SIZE - 1));
+    }
+}
+
+/* Data the DMA lapped before the read started is skipped and counted, the rest is returned in order. */
+static void RingBufTest_RunDmaOverrunBeforeRead(void)
+{
+    T_RingBuffer ringBuffer;
+    T_RingBufTestDma dma = {0};
+    uint8_t readData[RINGBUF_TEST_BUF_SIZE];
+    uint16_t index = RINGBUF_TEST_INDEX_START;
+    uint16_t lostLen;
+    uint16_t readLen;
+
+    RingBuf_Init(&ringBuffer, s_ringBufTestBuf, RINGBUF_TEST_BUF_SIZE);
+    ringBuffer.readIndex = index;
+    ringBuffer.writeIndex = index;
+    dma.ringBuffer = &ringBuffer;
+    dma.producerIndex = index;
+
+    // Three half buffers committed and a few bytes not committed yet, the oldest bytes are gone already.
+    RingBufTest_DmaWrite(&dma, RINGBUF_TEST_BUF_SIZE / 2, true);
+    RingBufTest_DmaWrite(&dma, RINGBUF_TEST_BUF_SIZE / 2, true);
+    RingBufTest_DmaWrite(&dma, RINGBUF_TEST_BUF_SIZE / 2, true);
+    RingBufTest_DmaWrite(&dma, 5, false);
+
+    readLen = RingBuf_GetOverrunChecked(&ringBuffer, readData, sizeof(readData), RingBufTest_GetDmaWriteOffset,
+                                        &dma, &lostLen);
+    TEST_ASSERT(lostLen == RINGBUF_TEST_BUF_SIZE / 2 + 5);
+    TEST_ASSERT(readLen == RINGBUF_TEST_BUF_SIZE - 5);
+    RingBufTest_CheckSequence(readData, readLen, (uint16_t) (index + lostLen));
+    TEST_ASSERT(RingBuf_GetUsedSize(&ringBuffer) == 0);
+}
+
+/* Bytes the DMA may have overwritten while they were copied are discarded from the front of the data read. */
+static void RingBufTest_RunDmaOverrunDuringRead(void)
+{
+    T_RingBuffer ringBuffer;
+    T_RingBufTestDma dma = {0};
+    uint8_t readData[RINGBUF_TEST_BUF_SIZE];
+    uint16_t index = RINGBUF_TEST_INDEX_START;
+    uint16_t lostLen;
+    uint16_t readLen;
+
+    RingBuf_Init(&ringBuffer, s_ringBufTestBuf, RINGBUF_TEST_BUF_SIZE);
+    ringBuffer.readIndex = index;
+    ringBuffer.writeIndex = index;
+    dma.ringBuffer = &ringBuffer;
+    dma.producerIndex = index;
+    dma.readBuf = readData;
+
+    // A full buffer committed, the DMA then writes 9 bytes of the next lap during the copy.
+    RingBufTest_DmaWrite(&dma, RINGBUF_TEST_BUF_SIZE / 2, true);
+    RingBufTest_DmaWrite(&dma, RINGBUF_TEST_BUF_SIZE / 2, true);
+    dma.writeLenDuringCopy = 9;
+
+    readLen = RingBuf_GetOverrunChecked(&ringBuffer, readData, sizeof(readData), RingBufTest_GetDmaWriteOffset,
+                                        &dma, &lostLen);
+    TEST_ASSERT(lostLen == 9);
+    TEST_ASSERT(readLen == RINGBUF_TEST_BUF_SIZE - 9);
+    RingBufTest_CheckSequence(readData, readLen, (uint16_t) (index + 9));
+
+    // The bytes of the next lap are read intact once committed.
+    RingBuf_CommitWrite(&ringBuffer, dma.producerIndex & (RINGBUF_TEST_BUF_SIZE - 1));
+    dma.callCount = 0;
+    dma.writeLenDuringCopy = 0;
+    readLen = RingBuf_GetOverrunChecked(&ringBuffer, readData, sizeof(readData), RingBufTest_GetDmaWriteOffset,
+                                        &dma, &lostLen);
+    TEST_ASSERT(lostLen == 0);
+    TEST_ASSERT(readLen == 9);
+    RingBufTest_CheckSequence(readData, readLen, (uint16_t) (index + RINGBUF_TEST_BUF_SIZE));
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,284 @@
+/**
+ ********************************************************************
+ * @file    time_sync_pps_test.c
+ * @brief   Replays a pps with drift, jitter, a missed pulse and an outlier through the DJI_PPS_SIMULATION_FILE
+ * source of the Linux pps provider on a simulated clock, checking the drift and offset the filter converges to.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "test_common.h"
+#include "hal_pps.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define PPS_TEST_PULSE_NUM                  (300)
+#define PPS_TEST_DRIFT_PPM                  (25)
+#define PPS_TEST_JITTER_US                  (100) // peak to peak
+#define PPS_TEST_MISSED_PULSE               (150)
+#define PPS_TEST_OUTLIER_PULSE              (200)
+#define PPS_TEST_OUTLIER_US                 (5000)
+#define PPS_TEST_START_TIME_US              (1000000)
+#define PPS_TEST_DRIFT_SETTLE_PULSE_NUM     (10)
+#define PPS_TEST_DRIFT_SETTLE_ERROR_PPM     (10)
+#define PPS_TEST_DRIFT_ERROR_PPM            (2)
+#define PPS_TEST_OFFSET_SETTLE_PULSE_NUM    (50)
+#define PPS_TEST_OFFSET_ERROR_US            (10)
+#define PPS_TEST_HOLDOVER_QUERY_DELAY_US    (100000)
+#define PPS_TEST_HOLDOVER_ERROR_US          (30)
+#define PPS_TEST_WAIT_TIMEOUT_MS            (5000)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static pthread_t s_mainThread;
+static uint32_t s_pulses[PPS_TEST_PULSE_NUM]; // pulse number of each replayed edge
+static uint64_t s_edgesUs[PPS_TEST_PULSE_NUM]; // replayed edge, since the start of the replay
+static uint32_t s_edgeNum = 0;
+static pthread_mutex_t s_clockMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t s_clockCond = PTHREAD_COND_INITIALIZER;
+static uint64_t s_timeUs = PPS_TEST_START_TIME_US;
+static uint64_t s_wakeTimeUs = 0;
+static bool s_isSleeping = false;
+
+/* Private functions declaration ---------------------------------------------*/
+static void PpsTest_WriteReplay(const char *path);
+static uint64_t PpsTest_GetTrueEdgeUs(uint32_t pulse);
+static uint64_t PpsTest_WaitSleep(void);
+static void PpsTest_SetTime(uint64_t timeUs, bool wake);
+static void PpsTest_WaitProcessed(uint32_t edgeNum);
+T_DjiReturnCode __wrap_Osal_GetTimeUs(uint64_t *us);
+int __wrap_usleep(useconds_t usec);
+int __real_usleep(useconds_t usec);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    T_DjiTestTimeSyncFilterStatistics statistics = {0};
+    E_HalPpsSource source = HAL_PPS_SOURCE_NONE;
+    char path[256];
+    uint64_t wakeTimeUs;
+    uint64_t newestEdgeUs;
+    uint64_t trueEdgeUs;
+    double rawErrorSumUs = 0;
+    double offsetSumUs = 0;
+    uint32_t offsetNum = 0;
+    uint32_t i;
+
+    TestCommon_Init();
+    s_mainThread = pthread_self();
+
+    snprintf(path, sizeof(path), "%s/pps.txt", TestCommon_GetOutputDir("time_sync_pps_test"));
+    PpsTest_WriteReplay(path);
+    TEST_ASSERT(setenv(LINUX_PPS_SIMULATION_FILE_ENV, path, 1) == 0);
+
+    TEST_ASSERT(HalPps_GetNewestPpsTriggerLocalTimeUs(&newestEdgeUs) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT_SUCCESS(HalPps_SignalResponseInit());
+    TEST_ASSERT_SUCCESS(HalPps_GetStatistics(&source, &statistics));
+    TEST_ASSERT(source == HAL_PPS_SOURCE_SIMULATION);
+
+    // The replay sleeps until each edge, the edges before it have been filtered then
+    for (i = 0; i < s_edgeNum; i++) {
+        wakeTimeUs = PpsTest_WaitSleep();
+        TEST_ASSERT(wakeTimeUs == PPS_TEST_START_TIME_US + s_edgesUs[i]);
+
+        if (i == 0) {
+            TEST_ASSERT(HalPps_GetNewestPpsTriggerLocalTimeUs(&newestEdgeUs) == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+            PpsTest_SetTime(wakeTimeUs, true);
+            continue;
+        }
+
+        TEST_ASSERT_SUCCESS(HalPps_GetNewestPpsTriggerLocalTimeUs(&newestEdgeUs));
+        trueEdgeUs = PpsTest_GetTrueEdgeUs(s_pulses[i - 1]);
+        if (s_pulses[i - 1] == PPS_TEST_OUTLIER_PULSE) {
+            // The outlier is dropped, the edge is extrapolated instead
+            TEST_ASSERT(fabs((double) newestEdgeUs - (double) trueEdgeUs) < PPS_TEST_HOLDOVER_ERROR_US);
+        } else if (s_pulses[i - 1] >= PPS_TEST_OFFSET_SETTLE_PULSE_NUM) {
+            offsetSumUs += fabs((double) newestEdgeUs - (double) trueEdgeUs);
+            rawErrorSumUs += fabs((double) s_edgesUs[i - 1] + PPS_TEST_START_TIME_US - (double) trueEdgeUs);
+            offsetNum++;
+        }
+
+        if (s_pulses[i - 1] == PPS_TEST_DRIFT_SETTLE_PULSE_NUM) {
+            TEST_ASSERT_SUCCESS(HalPps_GetStatistics(&source, &statistics));
+            printf("drift after %d pulses: %.2f ppm\n", PPS_TEST_DRIFT_SETTLE_PULSE_NUM, statistics.driftPpm);
+            TEST_ASSERT(fabs(statistics.driftPpm - PPS_TEST_DRIFT_PPM) < PPS_TEST_DRIFT_SETTLE_ERROR_PPM);
+        }
+
+        // A missed pulse is extrapolated from the tracked period
+        if (s_pulses[i] - s_pulses[i - 1] > 1) {
+            trueEdgeUs = PpsTest_GetTrueEdgeUs(s_pulses[i - 1] + 1);
+            PpsTest_SetTime(trueEdgeUs + PPS_TEST_HOLDOVER_QUERY_DELAY_US, false);
+            TEST_ASSERT_SUCCESS(HalPps_GetNewestPpsTriggerLocalTimeUs(&newestEdgeUs));
+            printf("missed pulse extrapolated %.0f us off\n", fabs((double) newestEdgeUs - (double) trueEdgeUs));
+            TEST_ASSERT(fabs((double) newestEdgeUs - (double) trueEdgeUs) < PPS_TEST_HOLDOVER_ERROR_US);
+        }
+
+        PpsTest_SetTime(wakeTimeUs, true);
+    }
+    PpsTest_WaitProcessed(s_edgeNum);
+
+    TEST_ASSERT_SUCCESS(HalPps_GetStatistics(&source, &statistics));
+    printf("drift %.2f ppm, residual rms %.1f us, accepted %u, rejected %u, missed %u, reset %u\n",
+           statistics.driftPpm, statistics.residualRmsUs, statistics.acceptedCount, statistics.rejectedCount,
+           statistics.missedCount, statistics.resetCount);
+    printf("mean offset of the filtered edge %.1f us, of the raw edge %.1f us\n", offsetSumUs / offsetNum,
+           rawErrorSumUs / offsetNum);
+    TEST_ASSERT(fabs(statistics.driftPpm - PPS_TEST_DRIFT_PPM) < PPS_TEST_DRIFT_ERROR_PPM);
+    TEST_ASSERT(statistics.acceptedCount == s_edgeNum - 1);
+    TEST_ASSERT(statistics.rejectedCount == 1);
+    TEST_ASSERT(statistics.missedCount == 2); // the missed pulse and the outlier
+    TEST_ASSERT(statistics.resetCount == 0);
+    TEST_ASSERT(offsetSumUs / offsetNum < PPS_TEST_OFFSET_ERROR_US);
+    TEST_ASSERT(offsetSumUs < rawErrorSumUs / 2);
+
+    // The pps is lost once the holdover ends
+    PpsTest_SetTime(PpsTest_GetTrueEdgeUs(s_pulses[s_edgeNum - 1] + 11), false);
+    TEST_ASSERT(HalPps_GetNewestPpsTriggerLocalTimeUs(&newestEdgeUs) == DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT);
+
+    printf("time sync pps test passed\n");
+    return 0;
+}
+
+/* The osal clock of the test is simulated and only moves when the test sets it. */
+T_DjiReturnCode __wrap_Osal_GetTimeUs(uint64_t *us)
+{
+    pthread_mutex_lock(&s_clockMutex);
+    *us = s_timeUs;
+    pthread_mutex_unlock(&s_clockMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/*
+ * The pps task is the only other thread, its replay waits for the test to move the simulated clock to the edge. The task
+ * is named only after it starts, so it is told apart from the main thread rather than by its name.
+ */
+int __wrap_usleep(useconds_t usec)
+{
+    if (pthread_equal(pthread_self(), s_mainThread)) {
+        return __real_usleep(usec);
+    }
+
+    pthread_mutex_lock(&s_clockMutex);
+    s_wakeTimeUs = s_timeUs + usec;
+    s_isSleeping = true;
+    pthread_cond_broadcast(&s_clockCond);
+    while (s_isSleeping) {
+        pthread_cond_wait(&s_clockCond, &s_clockMutex);
+    }
+    pthread_mutex_unlock(&s_clockMutex);
+
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+/*
+ * The local clock runs 25 ppm fast against the pps, the edges have 100 us of uniform jitter, the missed pulse is left
+ * out and the outlier is late by far more than the jitter.
+ */
+static void PpsTest_WriteReplay(const char *path)
+{
+    FILE *file = fopen(path, "w");
+    uint32_t random = 1;
+    double jitterUs;
+    uint32_t pulse;
+
+    TEST_ASSERT(file != NULL);
+    fprintf(file, "# pps at %d ppm with %d us of jitter\n", PPS_TEST_DRIFT_PPM, PPS_TEST_JITTER_US);
+
+    s_edgeNum = 0;
+    for (pulse = 1; s_edgeNum < PPS_TEST_PULSE_NUM; pulse++) {
+        random = random * 1103515245 + 12345;
+        jitterUs = ((double) (random >> 8) / (1 << 24) - 0.5) * PPS_TEST_JITTER_US;
+        if (pulse == PPS_TEST_MISSED_PULSE) {
+            continue;
+        }
+
+        s_pulses[s_edgeNum] = pulse;
+        s_edgesUs[s_edgeNum] = (uint64_t) ((double) PpsTest_GetTrueEdgeUs(pulse) - PPS_TEST_START_TIME_US + jitterUs);
+        if (pulse == PPS_TEST_OUTLIER_PULSE) {
+            s_edgesUs[s_edgeNum] += PPS_TEST_OUTLIER_US;
+        }
+        fprintf(file, "%llu\n", (unsigned long long) s_edgesUs[s_edgeNum]);
+        s_edgeNum++;
+    }
+
+    TEST_ASSERT(fclose(file) == 0);
+}
+
+/* Local time of a pulse without jitter, the replay starts at the start time of the simulated clock. */
+static uint64_t PpsTest_GetTrueEdgeUs(uint32_t pulse)
+{
+    return PPS_TEST_START_TIME_US + (uint64_t) pulse * (1000000 + PPS_TEST_DRIFT_PPM);
+}
+
+static uint64_t PpsTest_WaitSleep(void)
+{
+    struct timespec deadline;
+    uint64_t wakeTimeUs;
+
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += PPS_TEST_WAIT_TIMEOUT_MS / 1000;
+
+    pthread_mutex_lock(&s_clockMutex);
+    while (!s_isSleeping) {
+        TEST_ASSERT(pthread_cond_timedwait(&s_clockCond, &s_clockMutex, &deadline) == 0);
+    }
+    wakeTimeUs = s_wakeTimeUs;
+    pthread_mutex_unlock(&s_clockMutex);
+
+    return wakeTimeUs;
+}
+
+static void PpsTest_SetTime(uint64_t timeUs, bool wake)
+{
+    pthread_mutex_lock(&s_clockMutex);
+    s_timeUs = timeUs;
+    if (wake) {
+        s_isSleeping = false;
+        pthread_cond_broadcast(&s_clockCond);
+    }
+    pthread_mutex_unlock(&s_clockMutex);
+}
+
+/* The last edge is not followed by a sleep, wait for the filter to count it. */
+static void PpsTest_WaitProcessed(uint32_t edgeNum)
+{
+    T_DjiTestTimeSyncFilterStatistics statistics = {0};
+    E_HalPpsSource source;
+    uint32_t i;
+
+    for (i = 0; i < PPS_TEST_WAIT_TIMEOUT_MS; i++) {
+        TEST_ASSERT_SUCCESS(HalPps_GetStatistics(&source, &statistics));
+        if (statistics.acceptedCount + statistics.rejectedCount == edgeNum) {
+            return;
+        }
+        __real_usleep(1000);
+    }
+
+    TEST_ASSERT(statistics.acceptedCount + statistics.rejectedCount == edgeNum);
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,230 @@
+/**
+ ********************************************************************
+ * @file    util_asset_test.c
+ * @brief   Round-trips every asset of the packs embedded by the samples against its source file, and
+ * checks that concurrent first accesses of a compressed asset share one decoded copy.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <pthread.h>
+#include "test_common.h"
+#include "osal/osal.h"
+#include "utils/util_asset.h"
+#include "widget/widget_file_c/en_big_screen_assets.h"
+#include "widget_interaction_test/widget_file_c/en_big_screen_assets.h"
+#include "hms/hms_text_c/en_assets.h"
+#include "waypoint_v3/waypoint_file_c/waypoint_v3_assets.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define ASSET_TEST_PATH_SIZE            (512)
+#define ASSET_TEST_THREAD_NUM           (8)
+#define ASSET_TEST_RACE_ROUND_NUM       (200)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    const char *name;
+    const T_UtilAssetPack *pack;
+    const char *sourceDir; /*!< Directory of the packed files, relative to the module sample directory. */
+} T_AssetTestPack;
+
+typedef struct {
+    pthread_barrier_t *barrier;
+    const T_UtilAssetEntry *entry;
+    const uint8_t *data;
+    T_DjiReturnCode returnCode;
+} T_AssetTestRaceContext;
+
+/* Private values -------------------------------------------------------------*/
+static const T_AssetTestPack s_assetTestPacks[] = {
+    {"widget", &g_widgetEnBigScreenAssetPack, "widget/widget_file/en_big_screen"},
+    {"widget interaction", &g_widgetInteractionEnBigScreenAssetPack,
+     "widget_interaction_test/widget_file/en_big_screen"},
+    {"hms text", &g_hmsTextEnAssetPack, "hms/hms_text/en"},
+    {"waypoint v3", &g_waypointV3AssetPack, "waypoint_v3/waypoint_file"},
+};
+
+/* Private functions declaration ---------------------------------------------*/
+static void AssetTest_RunNotInit(void);
+static void AssetTest_RunRoundTrip(const T_AssetTestPack *testPack);
+static void AssetTest_RunFirstAccessRace(void);
+static uint8_t *AssetTest_ReadFile(const char *path, uint32_t *size);
+static void *AssetTest_RaceTask(void *arg);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    uint32_t i;
+
+    TestCommon_Init();
+
+    AssetTest_RunNotInit();
+    TEST_ASSERT_SUCCESS(UtilAsset_Init());
+    TEST_ASSERT_SUCCESS(UtilAsset_Init());
+
+    for (i = 0; i < sizeof(s_assetTestPacks) / sizeof(s_assetTestPacks[0]); i++) {
+        AssetTest_RunRoundTrip(&s_assetTestPacks[i]);
+    }
+    AssetTest_RunFirstAccessRace();
+
+    printf("util asset test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void AssetTest_RunNotInit(void)
+{
+    const T_UtilAssetPack *pack = &g_hmsTextEnAssetPack;
+    const uint8_t *data = NULL;
+    uint32_t size = 0;
+
+    // the compressed assets need the lock of their decoded copies, the stored ones are served without it
+    TEST_ASSERT(pack->entries[0].compression == UTIL_ASSET_COMPRESSION_LZ4);
+    TEST_ASSERT(UtilAsset_GetData(pack, &pack->entries[0], &data, &size) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT(pack->cache[0] == NULL);
+
+    pack = &g_waypointV3AssetPack;
+    TEST_ASSERT(pack->entries[0].compression == UTIL_ASSET_COMPRESSION_NONE);
+    TEST_ASSERT_SUCCESS(UtilAsset_GetData(pack, &pack->entries[0], &data, &size));
+    TEST_ASSERT(data == pack->blob + pack->entries[0].offset && size == pack->entries[0].size);
+}
+
+static void AssetTest_RunRoundTrip(const T_AssetTestPack *testPack)
+{
+    const T_UtilAssetPack *pack = testPack->pack;
+    const T_UtilAssetEntry *entry;
+    const uint8_t *data;
+    const uint8_t *cachedData;
+    uint32_t size;
+    uint8_t *expected;
+    uint32_t expectedSize;
+    char path[ASSET_TEST_PATH_SIZE];
+    uint16_t i;
+
+    TEST_ASSERT(pack->entryCount > 0);
+    for (i = 0; i < pack->entryCount; i++) {
+        entry = UtilAsset_Find(pack, pack->entries[i].name);
+        TEST_ASSERT(entry == &pack->entries[i]);
+
+        snprintf(path, sizeof(path), "%s/%s/%s", ASSET_TEST_MODULE_SAMPLE_DIR, testPack->sourceDir, entry->name);
+        expected = AssetTest_ReadFile(path, &expectedSize);
+
+        TEST_ASSERT_SUCCESS(UtilAsset_Load(pack, entry->name, &data, &size));
+        TEST_ASSERT(size == expectedSize);
+        TEST_ASSERT(memcmp(data, expected, size) == 0);
+
+        TEST_ASSERT_SUCCESS(UtilAsset_GetData(pack, entry, &cachedData, &size));
+        TEST_ASSERT(cachedData == data && size == expectedSize);
+        if (entry->compression == UTIL_ASSET_COMPRESSION_LZ4) {
+            TEST_ASSERT(pack->cache[i] == data);
+        } else {
+            TEST_ASSERT(data == pack->blob + entry->offset);
+        }
+
+        free(expected);
+    }
+
+    TEST_ASSERT(UtilAsset_Find(pack, "not_packed.json") == NULL);
+    TEST_ASSERT(UtilAsset_Load(pack, "not_packed.json", &data, &size) == DJI_ERROR_SYSTEM_MODULE_CODE_NOT_FOUND);
+
+    UtilAsset_ReleaseCache(pack);
+    for (i = 0; i < pack->entryCount; i++) {
+        TEST_ASSERT(pack->cache[i] == NULL);
+    }
+
+    printf("%s pack: %d assets round-tripped\n", testPack->name, pack->entryCount);
+}
+
+static void AssetTest_RunFirstAccessRace(void)
+{
+    const T_UtilAssetPack *pack = &g_widgetEnBigScreenAssetPack;
+    const T_UtilAssetEntry *entry = UtilAsset_Find(pack, "widget_config.json");
+    T_AssetTestRaceContext contexts[ASSET_TEST_THREAD_NUM];
+    pthread_t threads[ASSET_TEST_THREAD_NUM];
+    pthread_barrier_t barrier;
+    uint32_t round;
+    uint32_t i;
+
+    // the icons are stored, the packer only compresses the configuration
+    TEST_ASSERT(entry != NULL && entry->compression == UTIL_ASSET_COMPRESSION_LZ4);
+    TEST_ASSERT(pthread_barrier_init(&barrier, NULL, ASSET_TEST_THREAD_NUM) == 0);
+    for (round = 0; round < ASSET_TEST_RACE_ROUND_NUM; round++) {
+        for (i = 0; i < ASSET_TEST_THREAD_NUM; i++) {
+            contexts[i].barrier = &barrier;
+            contexts[i].entry = entry;
+            contexts[i].data = NULL;
+            contexts[i].returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_UNKNOWN;
+            TEST_ASSERT(pthread_create(&threads[i], NULL, AssetTest_RaceTask, &contexts[i]) == 0);
+        }
+        for (i = 0; i < ASSET_TEST_THREAD_NUM; i++) {
+            TEST_ASSERT(pthread_join(threads[i], NULL) == 0);
+        }
+
+        // a lost race would leak one copy and hand out another, every task must see the published one
+        for (i = 0; i < ASSET_TEST_THREAD_NUM; i++) {
+            TEST_ASSERT_SUCCESS(contexts[i].returnCode);
+            TEST_ASSERT(contexts[i].data != NULL);
+            TEST_ASSERT(contexts[i].data == contexts[0].data);
+        }
+        TEST_ASSERT(pack->cache[entry - pack->entries] == contexts[0].data);
+
+        UtilAsset_ReleaseCache(pack);
+    }
+    TEST_ASSERT(pthread_barrier_destroy(&barrier) == 0);
+
+    printf("first access race: %d rounds of %d tasks shared one copy\n", ASSET_TEST_RACE_ROUND_NUM,
+           ASSET_TEST_THREAD_NUM);
+}
+
+static uint8_t *AssetTest_ReadFile(const char *path, uint32_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    uint8_t *data;
+    long fileSize;
+
+    TEST_ASSERT(file != NULL);
+    TEST_ASSERT(fseek(file, 0, SEEK_END) == 0);
+    fileSize = ftell(file);
+    TEST_ASSERT(fileSize > 0);
+    TEST_ASSERT(fseek(file, 0, SEEK_SET) == 0);
+
+    data = malloc(fileSize);
+    TEST_ASSERT(data != NULL);
+    TEST_ASSERT(fread(data, 1, fileSize, file) == (size_t) fileSize);
+    fclose(file);
+
+    *size = (uint32_t) fileSize;
+    return data;
+}
+
+static void *AssetTest_RaceTask(void *arg)
+{
+    T_AssetTestRaceContext *context = arg;
+    uint32_t size;
+
+    pthread_barrier_wait(context->barrier);
+    context->returnCode = UtilAsset_GetData(&g_widgetEnBigScreenAssetPack, context->entry, &context->data, &size);
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,191 @@
+/**
+ ********************************************************************
+ * @file    util_periodic_test.c
+ * @brief   Runs the periodic executor on a simulated clock, checking that deadlines stay on
+ * the absolute grid and that overruns skip whole periods.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include "test_common.h"
+#include "utils/util_periodic.h"
+#include "osal/osal.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define PERIODIC_TEST_PERIOD_US         (1000)
+#define PERIODIC_TEST_START_US          (123456789ULL)
+#define PERIODIC_TEST_CYCLE_NUM         (10000)
+#define PERIODIC_TEST_BODY_US           (300)
+#define PERIODIC_TEST_WAKE_LATENCY_US   (50)
+#define PERIODIC_TEST_REAL_CYCLE_NUM    (200)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static uint64_t s_nowUs = PERIODIC_TEST_START_US;
+static uint32_t s_wakeLatencyUs = 0;
+static uint32_t s_sleepCount = 0;
+
+/* Private functions declaration ---------------------------------------------*/
+static T_DjiReturnCode PeriodicTest_GetTimeUs(uint64_t *us);
+static T_DjiReturnCode PeriodicTest_SleepUntilUs(uint64_t deadlineUs);
+static void PeriodicTest_RunNoDrift(void);
+static void PeriodicTest_RunOverrun(void);
+static void PeriodicTest_RunOverrunBelowPeriod(void);
+static void PeriodicTest_RunDefaultClock(void);
+
+/* Private variables ---------------------------------------------------------*/
+static const T_UtilPeriodicClock s_fakeClock = {
+    .GetTimeUs = PeriodicTest_GetTimeUs,
+    .SleepUntilUs = PeriodicTest_SleepUntilUs,
+};
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    PeriodicTest_RunNoDrift();
+    PeriodicTest_RunOverrun();
+    PeriodicTest_RunOverrunBelowPeriod();
+    PeriodicTest_RunDefaultClock();
+
+    printf("util periodic test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void PeriodicTest_RunNoDrift(void)
+{
+    T_UtilPeriodic periodic;
+
+    s_nowUs = PERIODIC_TEST_START_US;
+    s_wakeLatencyUs = PERIODIC_TEST_WAKE_LATENCY_US;
+    s_sleepCount = 0;
+    TEST_ASSERT_SUCCESS(UtilPeriodic_Init(&periodic, PERIODIC_TEST_PERIOD_US, &s_fakeClock));
+
+    /* Every wakeup is late and every body takes time, neither may accumulate into the schedule. */
+    for (int i = 0; i < PERIODIC_TEST_CYCLE_NUM; i++) {
+        TEST_ASSERT(UtilPeriodic_WaitNextCycle(&periodic) == 1);
+        TEST_ASSERT(s_nowUs == PERIODIC_TEST_START_US + (uint64_t) (i + 1) * PERIODIC_TEST_PERIOD_US +
+                               PERIODIC_TEST_WAKE_LATENCY_US);
+        s_nowUs += PERIODIC_TEST_BODY_US;
+    }
+
+    TEST_ASSERT(periodic.cycleCount == PERIODIC_TEST_CYCLE_NUM);
+    TEST_ASSERT(periodic.overrunCount == 0);
+    TEST_ASSERT(periodic.skippedCycleCount == 0);
+    TEST_ASSERT(periodic.maxJitterUs == PERIODIC_TEST_WAKE_LATENCY_US);
+    TEST_ASSERT(periodic.jitterHistogram[0] == PERIODIC_TEST_CYCLE_NUM);
+    TEST_ASSERT(s_sleepCount == PERIODIC_TEST_CYCLE_NUM);
+    TEST_ASSERT(periodic.nextDeadlineUs ==
+                PERIODIC_TEST_START_US + (uint64_t) (PERIODIC_TEST_CYCLE_NUM + 1) * PERIODIC_TEST_PERIOD_US);
+    TEST_ASSERT(UtilPeriodic_GetElapsedMs(&periodic) == PERIODIC_TEST_CYCLE_NUM * PERIODIC_TEST_PERIOD_US / 1000);
+}
+
+static void PeriodicTest_RunOverrun(void)
+{
+    T_UtilPeriodic periodic;
+    uint64_t deadlineUs;
+
+    s_nowUs = PERIODIC_TEST_START_US;
+    s_wakeLatencyUs = 0;
+    s_sleepCount = 0;
+    TEST_ASSERT_SUCCESS(UtilPeriodic_Init(&periodic, PERIODIC_TEST_PERIOD_US, &s_fakeClock));
+
+    TEST_ASSERT(UtilPeriodic_WaitNextCycle(&periodic) == 1);
+    deadlineUs = s_nowUs;
+
+    /* A body of 3.4 periods misses the next 3 deadlines, the schedule resumes on the grid without catching up. */
+    s_nowUs += 3 * PERIODIC_TEST_PERIOD_US + 400;
+    TEST_ASSERT(UtilPeriodic_WaitNextCycle(&periodic) == 3);
+    TEST_ASSERT(s_sleepCount == 1);
+    TEST_ASSERT(periodic.overrunCount == 1);
+    TEST_ASSERT(periodic.skippedCycleCount == 2);
+    TEST_ASSERT(periodic.maxJitterUs == 400);
+    TEST_ASSERT(periodic.jitterHistogram[2] == 1);
+    TEST_ASSERT(periodic.nextDeadlineUs == deadlineUs + 4 * PERIODIC_TEST_PERIOD_US);
+
+    TEST_ASSERT(UtilPeriodic_WaitNextCycle(&periodic) == 1);
+    TEST_ASSERT(s_nowUs == deadlineUs + 4 * PERIODIC_TEST_PERIOD_US);
+    TEST_ASSERT(periodic.cycleCount == 3);
+}
+
+static void PeriodicTest_RunOverrunBelowPeriod(void)
+{
+    T_UtilPeriodic periodic;
+    uint64_t deadlineUs;
+
+    s_nowUs = PERIODIC_TEST_START_US;
+    s_wakeLatencyUs = 0;
+    s_sleepCount = 0;
+    TEST_ASSERT_SUCCESS(UtilPeriodic_Init(&periodic, PERIODIC_TEST_PERIOD_US, &s_fakeClock));
+
+    TEST_ASSERT(UtilPeriodic_WaitNextCycle(&periodic) == 1);
+    deadlineUs = s_nowUs;
+
+    /* Late by less than a period, the cycle runs at once and the next one is back on time. */
+    s_nowUs += PERIODIC_TEST_PERIOD_US + 700;
+    TEST_ASSERT(UtilPeriodic_WaitNextCycle(&periodic) == 1);
+    TEST_ASSERT(periodic.overrunCount == 1);
+    TEST_ASSERT(periodic.skippedCycleCount == 0);
+    TEST_ASSERT(s_nowUs == deadlineUs + PERIODIC_TEST_PERIOD_US + 700);
+
+    TEST_ASSERT(UtilPeriodic_WaitNextCycle(&periodic) == 1);
+    TEST_ASSERT(s_nowUs == deadlineUs + 2 * PERIODIC_TEST_PERIOD_US);
+}
+
+static T_DjiReturnCode PeriodicTest_GetTimeUs(uint64_t *us)
+{
+    *us = s_nowUs;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode PeriodicTest_SleepUntilUs(uint64_t deadlineUs)
+{
+    TEST_ASSERT(deadlineUs > s_nowUs);
+
+    s_nowUs = deadlineUs + s_wakeLatencyUs;
+    s_sleepCount++;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* The Linux OSAL sleeps on absolute monotonic deadlines, no cycle may start before its deadline. */
+static void PeriodicTest_RunDefaultClock(void)
+{
+    T_UtilPeriodicClock osalClock = {
+        .GetTimeUs = Osal_GetTimeUs,
+        .SleepUntilUs = Osal_TaskSleepUntilUs,
+    };
+    T_UtilPeriodic periodic;
+    uint64_t nowUs = 0;
+
+    TEST_ASSERT_SUCCESS(UtilPeriodic_SetDefaultClock(&osalClock));
+    TEST_ASSERT_SUCCESS(UtilPeriodic_Init(&periodic, PERIODIC_TEST_PERIOD_US, NULL));
+    TEST_ASSERT(periodic.clock.SleepUntilUs == Osal_TaskSleepUntilUs);
+
+    for (int i = 0; i < PERIODIC_TEST_REAL_CYCLE_NUM; i++) {
+        UtilPeriodic_WaitNextCycle(&periodic);
+        TEST_ASSERT_SUCCESS(Osal_GetTimeUs(&nowUs));
+        TEST_ASSERT(nowUs >= periodic.startTimeUs + (uint64_t) (i + 1) * PERIODIC_TEST_PERIOD_US);
+    }
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
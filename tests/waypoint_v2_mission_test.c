@@ -0,0 +1,444 @@
+/**
+ ********************************************************************
+ * @file    waypoint_v2_mission_test.c
+ * @brief   Runs the waypoint V2 mission builder, checking its positions against an independent tangent plane
+ * of the WGS 84 ellipsoid, the patterns, the validation limits and the split of missions into chunks.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <math.h>
+#include <string.h>
+#include "test_common.h"
+#include "waypoint_v2/test_waypoint_v2_mission.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define MISSION_TEST_PI                     (3.14159265358979323846)
+#define MISSION_TEST_SEMI_MAJOR_AXIS        (6378137.0)
+#define MISSION_TEST_ECCENTRICITY_2         (6.69437999014e-3)
+#define MISSION_TEST_ORIGIN_LATITUDE        (0.394)
+#define MISSION_TEST_ORIGIN_LONGITUDE       (1.98)
+#define MISSION_TEST_POSITION_ERROR_MAX     (0.01) /* unit: m */
+#define MISSION_TEST_LOCAL_RANGE            (5000.0) /* unit: m */
+#define MISSION_TEST_WAYPOINT_NUM           (65535)
+#define MISSION_TEST_ACTION_NUM             (64)
+#define MISSION_TEST_CHUNK_WAYPOINT_NUM     (5)
+
+/* Private types -------------------------------------------------------------*/
+
+/* Private values -------------------------------------------------------------*/
+static T_DjiWaypointV2 s_waypoints[MISSION_TEST_WAYPOINT_NUM];
+static T_DJIWaypointV2Action s_actions[MISSION_TEST_ACTION_NUM];
+static T_DJIWaypointV2Action s_chunkActions[MISSION_TEST_ACTION_NUM];
+static T_DjiTestWaypointV2MissionBuilder s_builder;
+
+/* Private functions declaration ---------------------------------------------*/
+static void MissionTest_RunBuilderInit(void);
+static void MissionTest_RunLocalToGlobal(void);
+static void MissionTest_RunPolygon(void);
+static void MissionTest_RunGrid(void);
+static void MissionTest_RunChunks(void);
+static void MissionTest_RunCorridor(void);
+static void MissionTest_RunValidateLimits(void);
+static void MissionTest_RunBenchmark(void);
+static void MissionTest_InitBuilder(void);
+static void MissionTest_GetEcef(dji_f64_t latitude, dji_f64_t longitude, dji_f64_t *ecef);
+static void MissionTest_GetLocal(dji_f64_t latitude, dji_f64_t longitude, T_DjiTestWaypointV2MissionLocalPoint *point);
+static void MissionTest_AssertWaypoint(uint16_t index, dji_f64_t north, dji_f64_t east);
+
+/* Private variables ---------------------------------------------------------*/
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+
+    MissionTest_RunBuilderInit();
+    MissionTest_RunLocalToGlobal();
+    MissionTest_RunPolygon();
+    MissionTest_RunGrid();
+    MissionTest_RunChunks();
+    MissionTest_RunCorridor();
+    MissionTest_RunValidateLimits();
+    MissionTest_RunBenchmark();
+
+    printf("waypoint v2 mission test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void MissionTest_RunBuilderInit(void)
+{
+    TEST_ASSERT(DjiTest_WaypointV2MissionBuilderInit(NULL, s_waypoints, 10, s_actions, 10, 0, 0) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_WaypointV2MissionBuilderInit(&s_builder, NULL, 10, s_actions, 10, 0, 0) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_WaypointV2MissionBuilderInit(&s_builder, s_waypoints, 10, NULL, 10, 0, 0) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionBuilderInit(&s_builder, s_waypoints, 10, NULL, 0, 0, 0));
+
+    // an origin given in degrees, as shown to the user, is rejected
+    TEST_ASSERT(DjiTest_WaypointV2MissionBuilderInit(&s_builder, s_waypoints, 10, s_actions, 10, 22.5, 113.9) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+}
+
+static void MissionTest_RunLocalToGlobal(void)
+{
+    const dji_f64_t latitudes[] = {0.0, MISSION_TEST_ORIGIN_LATITUDE, 0.8, -1.2, 1.4};
+    T_DjiTestWaypointV2MissionLocalPoint point;
+    T_DjiTestWaypointV2MissionLocalPoint result;
+    dji_f64_t latitude;
+    dji_f64_t longitude;
+    dji_f64_t error;
+    dji_f64_t maxError;
+    uint8_t i;
+
+    for (i = 0; i < sizeof(latitudes) / sizeof(latitudes[0]); i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionBuilderInit(&s_builder, s_waypoints, MISSION_TEST_WAYPOINT_NUM,
+                                                                 s_actions, MISSION_TEST_ACTION_NUM, latitudes[i],
+                                                                 3.1));
+        maxError = 0;
+        for (point.north = -MISSION_TEST_LOCAL_RANGE; point.north <= MISSION_TEST_LOCAL_RANGE; point.north += 500) {
+            for (point.east = -MISSION_TEST_LOCAL_RANGE; point.east <= MISSION_TEST_LOCAL_RANGE; point.east += 500) {
+                DjiTest_WaypointV2MissionLocalToGlobal(&s_builder, &point, &latitude, &longitude);
+                MissionTest_GetLocal(latitude, longitude, &result);
+                error = hypot(result.north - point.north, result.east - point.east);
+                maxError = error > maxError ? error : maxError;
+            }
+        }
+        TEST_ASSERT(maxError < MISSION_TEST_POSITION_ERROR_MAX);
+        printf("latitude %.3f rad: max error %.4f m over +-%.0f m\n", latitudes[i], maxError,
+               MISSION_TEST_LOCAL_RANGE);
+    }
+
+    // the origin maps onto itself
+    point.north = 0;
+    point.east = 0;
+    DjiTest_WaypointV2MissionLocalToGlobal(&s_builder, &point, &latitude, &longitude);
+    TEST_ASSERT(fabs(latitude - 1.4) < 1e-9 && fabs(longitude - 3.1) < 1e-9);
+}
+
+static void MissionTest_RunPolygon(void)
+{
+    T_DjiTestWaypointV2MissionPolygon polygon = {
+        .center = {100, -50},
+        .radius = 300,
+        .startBearing = 90,
+        .sideNum = MISSION_TEST_WAYPOINT_NUM - 1,
+        .isClosed = true,
+    };
+    T_DjiTestWaypointV2MissionLocalPoint point;
+    dji_f64_t maxRadiusError = 0;
+    dji_f64_t radiusError;
+    uint32_t i;
+
+    MissionTest_InitBuilder();
+    polygon.sideNum = 2;
+    TEST_ASSERT(DjiTest_WaypointV2MissionAddPolygon(&s_builder, &polygon) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    // the largest closed polygon fills the mission, its rotated vertices stay on the circle
+    polygon.sideNum = MISSION_TEST_WAYPOINT_NUM - 1;
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPolygon(&s_builder, &polygon));
+    TEST_ASSERT(s_builder.waypointNum == MISSION_TEST_WAYPOINT_NUM);
+    MissionTest_AssertWaypoint(0, 100, 250);
+    TEST_ASSERT(memcmp(&s_waypoints[0], &s_waypoints[MISSION_TEST_WAYPOINT_NUM - 1], sizeof(T_DjiWaypointV2)) == 0);
+    for (i = 0; i < s_builder.waypointNum; i++) {
+        MissionTest_GetLocal(s_waypoints[i].latitude, s_waypoints[i].longitude, &point);
+        radiusError = fabs(hypot(point.north - 100, point.east + 50) - 300);
+        maxRadiusError = radiusError > maxRadiusError ? radiusError : maxRadiusError;
+    }
+    TEST_ASSERT(maxRadiusError < MISSION_TEST_POSITION_ERROR_MAX);
+    TEST_ASSERT(s_waypoints[1].relativeHeight == s_builder.waypointTemplate.relativeHeight);
+
+    // a full mission takes nothing more, its vertices are 3 cm apart, closer than a waypoint V2 segment
+    TEST_ASSERT(DjiTest_WaypointV2MissionAddPolygon(&s_builder, &polygon) == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+    TEST_ASSERT(s_builder.waypointNum == MISSION_TEST_WAYPOINT_NUM);
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    // a square starting north
+    MissionTest_InitBuilder();
+    polygon.sideNum = 4;
+    polygon.startBearing = 0;
+    polygon.isClosed = false;
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPolygon(&s_builder, &polygon));
+    TEST_ASSERT(s_builder.waypointNum == 4);
+    MissionTest_AssertWaypoint(0, 400, -50);
+    MissionTest_AssertWaypoint(1, 100, 250);
+    MissionTest_AssertWaypoint(2, -200, -50);
+    MissionTest_AssertWaypoint(3, 100, -350);
+}
+
+static void MissionTest_RunGrid(void)
+{
+    T_DjiTestWaypointV2MissionGrid grid = {
+        .center = {0, 0},
+        .length = 100,
+        .width = 40,
+        .lineSpacing = 15,
+        .pointSpacing = 30,
+        .heading = 90,
+    };
+    T_DjiTestWaypointV2MissionInfo info;
+    dji_f64_t north;
+    dji_f64_t east;
+    uint16_t line;
+    uint16_t j;
+
+    MissionTest_InitBuilder();
+    grid.lineSpacing = 0;
+    TEST_ASSERT(DjiTest_WaypointV2MissionAddGrid(&s_builder, &grid) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    grid.lineSpacing = 15;
+
+    // 40 m wide at most 15 m apart is 4 lines, 100 m long at most 30 m apart is 5 points, flown east then west
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddGrid(&s_builder, &grid));
+    TEST_ASSERT(s_builder.waypointNum == 20);
+    for (line = 0; line < 4; line++) {
+        north = 20 - line * 40.0 / 3;
+        for (j = 0; j < 5; j++) {
+            east = line % 2 == 0 ? -50 + j * 25 : 50 - j * 25;
+            MissionTest_AssertWaypoint((uint16_t) (line * 5 + j), north, east);
+        }
+    }
+
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionValidate(&s_builder, &info));
+    TEST_ASSERT(info.waypointNum == 20 && info.actionNum == 0);
+    TEST_ASSERT(fabs(info.totalLength - 440) < MISSION_TEST_POSITION_ERROR_MAX * 20);
+    TEST_ASSERT(fabs(info.minSegmentLength - 40.0 / 3) < MISSION_TEST_POSITION_ERROR_MAX);
+    TEST_ASSERT(fabs(info.maxSegmentLength - 25) < MISSION_TEST_POSITION_ERROR_MAX);
+    TEST_ASSERT(info.durationS == 219 || info.durationS == 220);
+
+    // a grid larger than the room left is not added at all
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionBuilderInit(&s_builder, s_waypoints, 25, NULL, 0,
+                                                             MISSION_TEST_ORIGIN_LATITUDE,
+                                                             MISSION_TEST_ORIGIN_LONGITUDE));
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddGrid(&s_builder, &grid));
+    TEST_ASSERT(DjiTest_WaypointV2MissionAddGrid(&s_builder, &grid) == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+    TEST_ASSERT(s_builder.waypointNum == 20);
+}
+
+static void MissionTest_RunChunks(void)
+{
+    T_DjiTestWaypointV2MissionGrid grid = {
+        .center = {0, 0},
+        .length = 100,
+        .width = 40,
+        .lineSpacing = 15,
+        .pointSpacing = 30,
+        .heading = 90,
+    };
+    T_DjiWayPointV2MissionSettings settings;
+    uint16_t waypointIndex;
+    uint16_t actionCount = 0;
+    uint16_t chunkNum;
+    uint16_t chunk;
+    uint16_t i;
+
+    MissionTest_InitBuilder();
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddGrid(&s_builder, &grid));
+    TEST_ASSERT(DjiTest_WaypointV2MissionAddPhotoActions(&s_builder, 0, 20, 3) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPhotoActions(&s_builder, 0, 19, 3));
+    TEST_ASSERT(s_builder.actionNum == 7);
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionValidate(&s_builder, NULL));
+
+    // chunks of 5 waypoints overlap by one, 20 waypoints need 5 of them
+    chunkNum = DjiTest_WaypointV2MissionGetChunkNum(&s_builder, MISSION_TEST_CHUNK_WAYPOINT_NUM);
+    TEST_ASSERT(chunkNum == 5);
+    TEST_ASSERT(DjiTest_WaypointV2MissionGetChunkNum(&s_builder, 1) == 0);
+    TEST_ASSERT(DjiTest_WaypointV2MissionGetChunk(&s_builder, MISSION_TEST_CHUNK_WAYPOINT_NUM, chunkNum,
+                                                  s_chunkActions, MISSION_TEST_ACTION_NUM, &settings) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    // every action goes to exactly one chunk, the one reaching its waypoint first
+    for (chunk = 0; chunk < chunkNum; chunk++) {
+        TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionGetChunk(&s_builder, MISSION_TEST_CHUNK_WAYPOINT_NUM, chunk,
+                                                              s_chunkActions, MISSION_TEST_ACTION_NUM, &settings));
+        TEST_ASSERT(settings.missionID == s_builder.settings.missionID + chunk);
+        TEST_ASSERT(settings.mission == &s_waypoints[chunk * 4]);
+        TEST_ASSERT(settings.missTotalLen == (chunk == chunkNum - 1 ? 4 : 5));
+        TEST_ASSERT(settings.finishedAction == (chunk == chunkNum - 1 ? s_builder.settings.finishedAction :
+                                                DJI_WAYPOINT_V2_FINISHED_NO_ACTION));
+        for (i = 0; i < settings.actionList.actionNum; i++) {
+            TEST_ASSERT(settings.actionList.actions[i].actionId == i);
+            waypointIndex = settings.actionList.actions[i].trigger.sampleReachPointTriggerParam.waypointIndex;
+            TEST_ASSERT(waypointIndex < settings.missTotalLen);
+            TEST_ASSERT(waypointIndex + chunk * 4 == actionCount * 3);
+            TEST_ASSERT(waypointIndex != settings.missTotalLen - 1 || chunk == chunkNum - 1);
+            actionCount++;
+        }
+    }
+    TEST_ASSERT(actionCount == s_builder.actionNum);
+
+    // an action buffer too small for a chunk is reported
+    TEST_ASSERT(DjiTest_WaypointV2MissionGetChunk(&s_builder, MISSION_TEST_CHUNK_WAYPOINT_NUM, 0, s_chunkActions, 1,
+                                                  &settings) == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+
+    // a mission fitting one chunk is uploaded as it is
+    chunkNum = DjiTest_WaypointV2MissionGetChunkNum(&s_builder,
+                                                    DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT);
+    TEST_ASSERT(chunkNum == 1);
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionGetChunk(&s_builder,
+                                                          DJI_TEST_WAYPOINT_V2_MISSION_CHUNK_WAYPOINT_NUM_DEFAULT, 0,
+                                                          s_chunkActions, MISSION_TEST_ACTION_NUM, &settings));
+    TEST_ASSERT(settings.missTotalLen == 20 && settings.actionList.actionNum == 7);
+    TEST_ASSERT(memcmp(s_chunkActions, s_actions, 7 * sizeof(T_DJIWaypointV2Action)) == 0);
+
+    // a mission split into chunks can not be repeated
+    s_builder.settings.repeatTimes = 2;
+    TEST_ASSERT(DjiTest_WaypointV2MissionGetChunk(&s_builder, MISSION_TEST_CHUNK_WAYPOINT_NUM, 0, s_chunkActions,
+                                                  MISSION_TEST_ACTION_NUM, &settings) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT);
+}
+
+static void MissionTest_RunCorridor(void)
+{
+    T_DjiTestWaypointV2MissionLocalPoint centerLine[] = {{0, 0}, {100, 0}, {100, 100}};
+    T_DjiTestWaypointV2MissionLocalPoint turnBackLine[] = {{0, 0}, {100, 0}, {0, 0}};
+    T_DjiTestWaypointV2MissionCorridor corridor = {centerLine, 3, 20, 3, 50};
+
+    // three passes 10 m apart, the outer corner is mitered, segments are split to at most 50 m
+    MissionTest_InitBuilder();
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddCorridor(&s_builder, &corridor));
+    TEST_ASSERT(s_builder.waypointNum == 17);
+    MissionTest_AssertWaypoint(0, 0, -10);
+    MissionTest_AssertWaypoint(3, 110, -10);
+    MissionTest_AssertWaypoint(6, 110, 100);
+    MissionTest_AssertWaypoint(7, 100, 100);
+    MissionTest_AssertWaypoint(9, 100, 0);
+    MissionTest_AssertWaypoint(11, 0, 0);
+    MissionTest_AssertWaypoint(12, 0, 10);
+    MissionTest_AssertWaypoint(14, 90, 10);
+    MissionTest_AssertWaypoint(16, 90, 100);
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionValidate(&s_builder, NULL));
+
+    corridor.centerLine = turnBackLine;
+    TEST_ASSERT(DjiTest_WaypointV2MissionAddCorridor(&s_builder, &corridor) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    // a corridor overflowing the mission is removed again
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionBuilderInit(&s_builder, s_waypoints, 10, NULL, 0,
+                                                             MISSION_TEST_ORIGIN_LATITUDE,
+                                                             MISSION_TEST_ORIGIN_LONGITUDE));
+    corridor.centerLine = centerLine;
+    TEST_ASSERT(DjiTest_WaypointV2MissionAddCorridor(&s_builder, &corridor) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+    TEST_ASSERT(s_builder.waypointNum == 0);
+}
+
+static void MissionTest_RunValidateLimits(void)
+{
+    T_DjiTestWaypointV2MissionLocalPoint point = {0, 0};
+
+    MissionTest_InitBuilder();
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPoint(&s_builder, &point));
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    point.north = 10;
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPoint(&s_builder, &point));
+    point.north = 20;
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPoint(&s_builder, &point));
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionValidate(&s_builder, NULL));
+
+    s_builder.settings.maxFlightSpeed = 16;
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    s_builder.settings.maxFlightSpeed = 10;
+    s_builder.settings.autoFlightSpeed = -11;
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    s_builder.settings.autoFlightSpeed = 2;
+
+    s_waypoints[1].relativeHeight = 501;
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    s_waypoints[1].relativeHeight = 15;
+    s_waypoints[2].heading = 181;
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    s_waypoints[2].heading = 0;
+    s_waypoints[2].latitude = 2;
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    s_waypoints[2] = s_waypoints[1];
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    // reach point actions out of order can not be split into chunks
+    MissionTest_InitBuilder();
+    point.north = 0;
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPoint(&s_builder, &point));
+    point.north = 10;
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPoint(&s_builder, &point));
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPhotoActions(&s_builder, 1, 1, 1));
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionAddPhotoActions(&s_builder, 0, 0, 1));
+    TEST_ASSERT(DjiTest_WaypointV2MissionValidate(&s_builder, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+}
+
+static void MissionTest_RunBenchmark(void)
+{
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionRunBenchmark(10000));
+}
+
+static void MissionTest_InitBuilder(void)
+{
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV2MissionBuilderInit(&s_builder, s_waypoints, MISSION_TEST_WAYPOINT_NUM,
+                                                             s_actions, MISSION_TEST_ACTION_NUM,
+                                                             MISSION_TEST_ORIGIN_LATITUDE,
+                                                             MISSION_TEST_ORIGIN_LONGITUDE));
+}
+
+static void MissionTest_GetEcef(dji_f64_t latitude, dji_f64_t longitude, dji_f64_t *ecef)
+{
+    dji_f64_t sinLatitude = sin(latitude);
+    dji_f64_t radius = MISSION_TEST_SEMI_MAJOR_AXIS / sqrt(1 - MISSION_TEST_ECCENTRICITY_2 * sinLatitude * sinLatitude);
+
+    ecef[0] = radius * cos(latitude) * cos(longitude);
+    ecef[1] = radius * cos(latitude) * sin(longitude);
+    ecef[2] = radius * (1 - MISSION_TEST_ECCENTRICITY_2) * sinLatitude;
+}
+
+/* North and east of a point of the ellipsoid on the tangent plane at the origin of the builder. */
+static void MissionTest_GetLocal(dji_f64_t latitude, dji_f64_t longitude, T_DjiTestWaypointV2MissionLocalPoint *point)
+{
+    dji_f64_t originLatitude = s_builder.originLatitude;
+    dji_f64_t originLongitude = s_builder.originLongitude;
+    dji_f64_t origin[3];
+    dji_f64_t position[3];
+    dji_f64_t delta[3];
+    uint8_t i;
+
+    MissionTest_GetEcef(originLatitude, originLongitude, origin);
+    MissionTest_GetEcef(latitude, longitude, position);
+    for (i = 0; i < 3; i++) {
+        delta[i] = position[i] - origin[i];
+    }
+
+    point->east = -sin(originLongitude) * delta[0] + cos(originLongitude) * delta[1];
+    point->north = -sin(originLatitude) * cos(originLongitude) * delta[0] -
+                   sin(originLatitude) * sin(originLongitude) * delta[1] + cos(originLatitude) * delta[2];
+}
+
+static void MissionTest_AssertWaypoint(uint16_t index, dji_f64_t north, dji_f64_t east)
+{
+    T_DjiTestWaypointV2MissionLocalPoint point;
+
+    TEST_ASSERT(index < s_builder.waypointNum);
+    MissionTest_GetLocal(s_waypoints[index].latitude, s_waypoints[index].longitude, &point);
+    if (hypot(point.north - north, point.east - east) >= MISSION_TEST_POSITION_ERROR_MAX) {
+        printf("waypoint %d at %.3f %.3f instead of %.3f %.3f\n", index, point.north, point.east, north, east);
+    }
+    TEST_ASSERT(hypot(point.north - north, point.east - east) < MISSION_TEST_POSITION_ERROR_MAX);
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,657 @@
+/**
+ ********************************************************************
+ * @file    waypoint_v3_kmz_test.c
+ * @brief   Runs the inflate decoder on hand built deflate streams and the kmz validation on the sample mission and
+ * on crafted archives, checking that malformed or truncated kmz files are rejected before their upload.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <stdlib.h>
+#include "test_common.h"
+#include "waypoint_v3/test_waypoint_v3_kmz.h"
+#include "utils/util_inflate.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define KMZ_TEST_SAMPLE_FILE            KMZ_TEST_MODULE_SAMPLE_DIR \
+                                        "/waypoint_v3/waypoint_file/waypoint_v3_test_file.kmz"
+#define KMZ_TEST_STREAM_SIZE_MAX        (65536)
+#define KMZ_TEST_OUTPUT_SIZE_MAX        (65536)
+#define KMZ_TEST_ARCHIVE_SIZE_MAX       (4096)
+#define KMZ_TEST_FAR_DATA_SIZE          (40000)
+#define KMZ_TEST_FAR_DISTANCE           (32768)
+#define KMZ_TEST_FUZZ_TIMES             (2000)
+
+#define KMZ_TEST_TEMPLATE_XML           "<?xml version=\"1.0\"?><kml><Document><Folder/></Document></kml>"
+#define KMZ_TEST_WAYLINES_XML           "<?xml version=\"1.0\"?>\n<kml xmlns:wpml=\"http://www.dji.com/wpmz/1.0.3\">" \
+                                        "<Document><Folder><Placemark><Point/></Placemark><Placemark/>" \
+                                        "<!-- <Placemark> --></Folder></Document></kml>"
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint8_t *data;
+    uint32_t size;
+    uint32_t bitBuffer;
+    uint32_t bitCount;
+} T_KmzTestBitWriter;
+
+typedef struct {
+    uint8_t data[KMZ_TEST_OUTPUT_SIZE_MAX];
+    uint32_t size;
+    uint32_t maxChunkSize;
+    int32_t result;
+} T_KmzTestOutput;
+
+typedef struct {
+    const char *name;
+    const char *content;
+    uint16_t flags;
+    bool isCrcCorrupted;
+} T_KmzTestEntry;
+
+/* Private values -------------------------------------------------------------*/
+static uint8_t s_window[UTIL_INFLATE_WINDOW_SIZE];
+static uint8_t s_stream[KMZ_TEST_STREAM_SIZE_MAX];
+static uint8_t s_archive[KMZ_TEST_ARCHIVE_SIZE_MAX];
+static T_KmzTestOutput s_output;
+static uint32_t s_uploadCount = 0;
+static T_DjiReturnCode s_uploadResult = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+/* Private functions declaration ---------------------------------------------*/
+static void KmzTest_RunCrc32(void);
+static void KmzTest_RunInflateStored(void);
+static void KmzTest_RunInflateFixed(void);
+static void KmzTest_RunInflateFarDistance(void);
+static void KmzTest_RunInflateMalformed(void);
+static void KmzTest_RunSampleKmz(void);
+static void KmzTest_RunCraftedKmz(void);
+static void KmzTest_RunCorruptedKmz(void);
+static void KmzTest_RunUpload(void);
+static void KmzTest_RunBenchmark(void);
+static void KmzTest_PutBits(T_KmzTestBitWriter *writer, uint32_t value, uint32_t count);
+static void KmzTest_PutHuffmanCode(T_KmzTestBitWriter *writer, uint32_t code, uint32_t len);
+static void KmzTest_PutFixedCode(T_KmzTestBitWriter *writer, uint32_t symbol);
+static void KmzTest_PutStoredBlock(T_KmzTestBitWriter *writer, const uint8_t *data, uint16_t len, bool isFinal);
+static void KmzTest_FlushBits(T_KmzTestBitWriter *writer);
+static int32_t KmzTest_Decode(const uint8_t *stream, uint32_t size);
+static int32_t KmzTest_Output(const uint8_t *data, uint32_t len, void *userData);
+static int32_t KmzTest_StopOutput(const uint8_t *data, uint32_t len, void *userData);
+static uint32_t KmzTest_BuildArchive(const T_KmzTestEntry *entries, uint8_t entryCount, const char *comment);
+static T_DjiReturnCode KmzTest_ValidateArchive(const T_KmzTestEntry *entries, uint8_t entryCount,
+                                               T_DjiTestWaypointV3KmzInfo *info);
+static void KmzTest_WriteU16(uint8_t *data, uint16_t value);
+static void KmzTest_WriteU32(uint8_t *data, uint32_t value);
+T_DjiReturnCode __wrap_DjiWaypointV3_UploadKmzFile(const uint8_t *bytes, uint32_t len);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+
+    KmzTest_RunCrc32();
+    KmzTest_RunInflateStored();
+    KmzTest_RunInflateFixed();
+    KmzTest_RunInflateFarDistance();
+    KmzTest_RunInflateMalformed();
+    KmzTest_RunSampleKmz();
+    KmzTest_RunCraftedKmz();
+    KmzTest_RunCorruptedKmz();
+    KmzTest_RunUpload();
+    KmzTest_RunBenchmark();
+
+    printf("waypoint v3 kmz test passed\n");
+    return 0;
+}
+
+/* The upload of the psdk is wrapped, the test decides whether the aircraft takes the mission. */
+T_DjiReturnCode __wrap_DjiWaypointV3_UploadKmzFile(const uint8_t *bytes, uint32_t len)
+{
+    TEST_ASSERT(bytes != NULL && len != 0);
+    s_uploadCount++;
+
+    return s_uploadResult;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void KmzTest_RunCrc32(void)
+{
+    const uint8_t checkData[] = "123456789";
+    uint32_t crc;
+
+    // check value of the crc-32 of zip, also when the data is given in chunks
+    TEST_ASSERT(UtilInflate_Crc32(0, checkData, 9) == 0xCBF43926);
+    crc = UtilInflate_Crc32(0, checkData, 4);
+    crc = UtilInflate_Crc32(crc, checkData + 4, 0);
+    crc = UtilInflate_Crc32(crc, checkData + 4, 5);
+    TEST_ASSERT(crc == 0xCBF43926);
+    TEST_ASSERT(UtilInflate_Crc32(0, checkData, 0) == 0);
+}
+
+static void KmzTest_RunInflateStored(void)
+{
+    T_KmzTestBitWriter writer = {s_stream, 0, 0, 0};
+    uint32_t outSize = 0;
+
+    KmzTest_PutStoredBlock(&writer, (const uint8_t *) "hello ", 6, false);
+    KmzTest_PutStoredBlock(&writer, NULL, 0, false);
+    KmzTest_PutStoredBlock(&writer, (const uint8_t *) "world", 5, true);
+
+    memset(&s_output, 0, sizeof(s_output));
+    TEST_ASSERT(UtilInflate_Decode(s_stream, writer.size, s_window, KmzTest_Output, &s_output, &outSize) == 0);
+    TEST_ASSERT(outSize == 11 && s_output.size == 11);
+    TEST_ASSERT(memcmp(s_output.data, "hello world", 11) == 0);
+}
+
+static void KmzTest_RunInflateFixed(void)
+{
+    T_KmzTestBitWriter writer = {s_stream, 0, 0, 0};
+    char expected[512];
+    uint32_t size;
+
+    // "abc", a match of 10 bytes 3 back overlapping itself, then "x" and the longest match 1 back
+    KmzTest_PutBits(&writer, 1, 1);
+    KmzTest_PutBits(&writer, 1, 2);
+    KmzTest_PutFixedCode(&writer, 'a');
+    KmzTest_PutFixedCode(&writer, 'b');
+    KmzTest_PutFixedCode(&writer, 'c');
+    KmzTest_PutFixedCode(&writer, 264);
+    KmzTest_PutHuffmanCode(&writer, 2, 5);
+    KmzTest_PutFixedCode(&writer, 'x');
+    KmzTest_PutFixedCode(&writer, 285);
+    KmzTest_PutHuffmanCode(&writer, 0, 5);
+    KmzTest_PutFixedCode(&writer, 0xE9);
+    KmzTest_PutFixedCode(&writer, 256);
+    KmzTest_FlushBits(&writer);
+
+    strcpy(expected, "abcabcabcabca");
+    size = (uint32_t) strlen(expected);
+    memset(expected + size, 'x', 1 + UTIL_INFLATE_MAX_MATCH);
+    size += 1 + UTIL_INFLATE_MAX_MATCH;
+    expected[size++] = (char) 0xE9;
+
+    TEST_ASSERT(KmzTest_Decode(s_stream, writer.size) == 0);
+    TEST_ASSERT(s_output.size == size);
+    TEST_ASSERT(memcmp(s_output.data, expected, size) == 0);
+}
+
+static void KmzTest_RunInflateFarDistance(void)
+{
+    T_KmzTestBitWriter writer = {s_stream, 0, 0, 0};
+    uint8_t *data = s_stream + KMZ_TEST_STREAM_SIZE_MAX - KMZ_TEST_FAR_DATA_SIZE;
+    uint32_t i;
+
+    // a match at the largest distance reads the window after it wrapped around
+    srand(1);
+    for (i = 0; i < KMZ_TEST_FAR_DATA_SIZE; i++) {
+        data[i] = (uint8_t) rand();
+    }
+    memmove(s_stream + 5, data, KMZ_TEST_FAR_DATA_SIZE);
+    data = s_stream + 5;
+    s_stream[0] = 0x00;
+    KmzTest_WriteU16(s_stream + 1, KMZ_TEST_FAR_DATA_SIZE);
+    KmzTest_WriteU16(s_stream + 3, (uint16_t) ~KMZ_TEST_FAR_DATA_SIZE);
+    writer.size = 5 + KMZ_TEST_FAR_DATA_SIZE;
+
+    KmzTest_PutBits(&writer, 1, 1);
+    KmzTest_PutBits(&writer, 1, 2);
+    KmzTest_PutFixedCode(&writer, 257);
+    KmzTest_PutHuffmanCode(&writer, 29, 5);
+    KmzTest_PutBits(&writer, KMZ_TEST_FAR_DISTANCE - 24577, 13);
+    KmzTest_PutFixedCode(&writer, 256);
+    KmzTest_FlushBits(&writer);
+
+    TEST_ASSERT(KmzTest_Decode(s_stream, writer.size) == 0);
+    TEST_ASSERT(s_output.size == KMZ_TEST_FAR_DATA_SIZE + 3);
+    TEST_ASSERT(memcmp(s_output.data, data, KMZ_TEST_FAR_DATA_SIZE) == 0);
+    TEST_ASSERT(memcmp(s_output.data + KMZ_TEST_FAR_DATA_SIZE,
+                       data + KMZ_TEST_FAR_DATA_SIZE - KMZ_TEST_FAR_DISTANCE, 3) == 0);
+    TEST_ASSERT(s_output.maxChunkSize <= UTIL_INFLATE_WINDOW_SIZE);
+}
+
+static void KmzTest_RunInflateMalformed(void)
+{
+    T_KmzTestBitWriter writer = {s_stream, 0, 0, 0};
+    uint8_t stream[8];
+    uint32_t size;
+    uint32_t i;
+
+    // reserved block type
+    stream[0] = 0x07;
+    TEST_ASSERT(KmzTest_Decode(stream, 1) == -1);
+
+    // stored block whose length is not confirmed by its complement
+    stream[0] = 0x01;
+    KmzTest_WriteU16(stream + 1, 2);
+    KmzTest_WriteU16(stream + 3, 2);
+    stream[5] = 'a';
+    stream[6] = 'b';
+    TEST_ASSERT(KmzTest_Decode(stream, 7) == -1);
+
+    // a match before the first byte
+    KmzTest_PutBits(&writer, 1, 1);
+    KmzTest_PutBits(&writer, 1, 2);
+    KmzTest_PutFixedCode(&writer, 'a');
+    KmzTest_PutFixedCode(&writer, 257);
+    KmzTest_PutHuffmanCode(&writer, 3, 5);
+    KmzTest_PutFixedCode(&writer, 256);
+    KmzTest_FlushBits(&writer);
+    TEST_ASSERT(KmzTest_Decode(s_stream, writer.size) == -1);
+
+    // every truncation of a valid stream fails instead of reading past its end
+    writer.size = 0;
+    KmzTest_PutBits(&writer, 1, 1);
+    KmzTest_PutBits(&writer, 1, 2);
+    for (i = 0; i < 20; i++) {
+        KmzTest_PutFixedCode(&writer, 'a' + i);
+    }
+    KmzTest_PutFixedCode(&writer, 256);
+    KmzTest_FlushBits(&writer);
+    size = writer.size;
+    for (i = 0; i < size; i++) {
+        TEST_ASSERT(KmzTest_Decode(s_stream, i) != 0);
+    }
+    TEST_ASSERT(KmzTest_Decode(s_stream, size) == 0 && s_output.size == 20);
+
+    // the output stops the decoder with its own value
+    TEST_ASSERT(UtilInflate_Decode(s_stream, size, s_window, KmzTest_StopOutput, NULL, NULL) == 7);
+}
+
+static void KmzTest_RunSampleKmz(void)
+{
+    T_DjiTestWaypointV3KmzInfo info;
+    T_DjiTestWaypointV3Kmz kmz;
+    T_DjiTestWaypointV3Kmz bufferKmz;
+
+    TEST_ASSERT(DjiTest_WaypointV3KmzMapFile("no_such_file.kmz", &kmz) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS);
+
+    // the entries of the sample mission are deflated by a real zip tool, their crc checks the dynamic blocks
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzMapFile(KMZ_TEST_SAMPLE_FILE, &kmz));
+    TEST_ASSERT(kmz.isMapped);
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzValidate(&kmz, &info));
+    TEST_ASSERT(info.entryCount == 2);
+    TEST_ASSERT(info.uncompressedSize == 19814 + 27262);
+    TEST_ASSERT(info.waylineCount == 1 && info.waypointCount == 14);
+    TEST_ASSERT(info.elementCount > info.waypointCount);
+
+    // a buffer holding the same bytes has the same hash
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzFromBuffer(kmz.data, kmz.size, &bufferKmz));
+    TEST_ASSERT(!bufferKmz.isMapped);
+    TEST_ASSERT(memcmp(bufferKmz.hash, kmz.hash, sizeof(kmz.hash)) == 0);
+    DjiTest_WaypointV3KmzRelease(&bufferKmz);
+    DjiTest_WaypointV3KmzRelease(&kmz);
+    TEST_ASSERT(kmz.data == NULL);
+
+    printf("sample kmz: %u entries, %u bytes of xml, %u elements\n", info.entryCount, info.uncompressedSize,
+           info.elementCount);
+}
+
+static void KmzTest_RunCraftedKmz(void)
+{
+    const T_KmzTestEntry validEntries[] = {
+        {"wpmz/res/", "", 0, false},
+        {DJI_TEST_WAYPOINT_V3_KMZ_TEMPLATE_FILE_NAME, KMZ_TEST_TEMPLATE_XML, 0, false},
+        {DJI_TEST_WAYPOINT_V3_KMZ_WAYLINES_FILE_NAME, KMZ_TEST_WAYLINES_XML, 0, false},
+    };
+    T_KmzTestEntry entries[3];
+    T_DjiTestWaypointV3KmzInfo info;
+    T_DjiTestWaypointV3Kmz kmz;
+    uint32_t size;
+
+    // stored entries with a directory, comments in the xml are not counted
+    TEST_ASSERT_SUCCESS(KmzTest_ValidateArchive(validEntries, 3, &info));
+    TEST_ASSERT(info.entryCount == 3 && info.waylineCount == 1 && info.waypointCount == 2);
+
+    // an archive comment is skipped
+    size = KmzTest_BuildArchive(validEntries, 3, "mission made by the test");
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzFromBuffer(s_archive, size, &kmz));
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzValidate(&kmz, NULL));
+    DjiTest_WaypointV3KmzRelease(&kmz);
+
+    TEST_ASSERT(KmzTest_ValidateArchive(validEntries + 1, 1, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(KmzTest_ValidateArchive(validEntries + 2, 1, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    memcpy(entries, validEntries, sizeof(entries));
+    entries[2].content = "<kml><Document><Folder><Placemark></Folder></Document></kml>";
+    TEST_ASSERT(KmzTest_ValidateArchive(entries, 3, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    entries[2].content = "<kml><Document><Folder><Placemark/></Folder></Document>";
+    TEST_ASSERT(KmzTest_ValidateArchive(entries, 3, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    entries[2].content = "<kml><Document></Document></kml>";
+    TEST_ASSERT(KmzTest_ValidateArchive(entries, 3, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    memcpy(entries, validEntries, sizeof(entries));
+    entries[0].name = "../wpmz/res/";
+    TEST_ASSERT(KmzTest_ValidateArchive(entries, 3, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    entries[0].name = "/wpmz/res/";
+    TEST_ASSERT(KmzTest_ValidateArchive(entries, 3, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    memcpy(entries, validEntries, sizeof(entries));
+    entries[1].flags = 0x0001;
+    TEST_ASSERT(KmzTest_ValidateArchive(entries, 3, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    memcpy(entries, validEntries, sizeof(entries));
+    entries[2].isCrcCorrupted = true;
+    TEST_ASSERT(KmzTest_ValidateArchive(entries, 3, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+}
+
+static void KmzTest_RunCorruptedKmz(void)
+{
+    T_DjiTestWaypointV3Kmz kmz;
+    T_DjiTestWaypointV3Kmz corruptedKmz;
+    uint8_t *data;
+    uint32_t acceptedCount = 0;
+    uint32_t size;
+    uint32_t i;
+    uint32_t j;
+
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzMapFile(KMZ_TEST_SAMPLE_FILE, &kmz));
+    data = malloc(kmz.size);
+    TEST_ASSERT(data != NULL);
+
+    // no truncation of the archive is accepted
+    TEST_ASSERT(DjiTest_WaypointV3KmzFromBuffer(kmz.data, 0, &corruptedKmz) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    for (size = 1; size < kmz.size; size++) {
+        TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzFromBuffer(kmz.data, size, &corruptedKmz));
+        TEST_ASSERT(DjiTest_WaypointV3KmzValidate(&corruptedKmz, NULL) != DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS);
+        DjiTest_WaypointV3KmzRelease(&corruptedKmz);
+    }
+
+    // flipped bits never read out of the archive, the few accepted ones only hit bytes the crc does not cover
+    srand(2);
+    for (i = 0; i < KMZ_TEST_FUZZ_TIMES; i++) {
+        memcpy(data, kmz.data, kmz.size);
+        for (j = 0; j < 1 + (uint32_t) rand() % 4; j++) {
+            data[(uint32_t) rand() % kmz.size] ^= (uint8_t) (1 << (rand() % 8));
+        }
+        TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzFromBuffer(data, kmz.size, &corruptedKmz));
+        if (DjiTest_WaypointV3KmzValidate(&corruptedKmz, NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            acceptedCount++;
+        }
+        DjiTest_WaypointV3KmzRelease(&corruptedKmz);
+    }
+    TEST_ASSERT(acceptedCount < KMZ_TEST_FUZZ_TIMES / 10);
+
+    printf("corrupted kmz: %u of %u accepted\n", acceptedCount, KMZ_TEST_FUZZ_TIMES);
+
+    free(data);
+    DjiTest_WaypointV3KmzRelease(&kmz);
+}
+
+static void KmzTest_RunUpload(void)
+{
+    T_DjiTestWaypointV3Kmz kmz;
+    T_DjiTestWaypointV3Kmz otherKmz;
+    uint32_t size;
+
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzMapFile(KMZ_TEST_SAMPLE_FILE, &kmz));
+    TEST_ASSERT(!DjiTest_WaypointV3KmzIsUploaded(&kmz));
+
+    // a failed upload leaves the mission not uploaded
+    s_uploadResult = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    TEST_ASSERT(DjiTest_WaypointV3KmzUpload(&kmz) == DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR);
+    TEST_ASSERT(!DjiTest_WaypointV3KmzIsUploaded(&kmz));
+
+    s_uploadResult = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzUpload(&kmz));
+    TEST_ASSERT(DjiTest_WaypointV3KmzIsUploaded(&kmz));
+    TEST_ASSERT(s_uploadCount == 2);
+
+    // another mission is not taken as uploaded, a failed upload of it also drops the previous one
+    size = KmzTest_BuildArchive(NULL, 0, NULL);
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzFromBuffer(s_archive, size, &otherKmz));
+    TEST_ASSERT(!DjiTest_WaypointV3KmzIsUploaded(&otherKmz));
+    s_uploadResult = DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT;
+    TEST_ASSERT(DjiTest_WaypointV3KmzUpload(&otherKmz) == DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT);
+    TEST_ASSERT(!DjiTest_WaypointV3KmzIsUploaded(&kmz));
+    DjiTest_WaypointV3KmzRelease(&otherKmz);
+
+    s_uploadResult = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzUpload(&kmz));
+    TEST_ASSERT(DjiTest_WaypointV3KmzIsUploaded(&kmz));
+    DjiTest_WaypointV3KmzForgetUploaded();
+    TEST_ASSERT(!DjiTest_WaypointV3KmzIsUploaded(&kmz));
+
+    DjiTest_WaypointV3KmzRelease(&kmz);
+}
+
+static void KmzTest_RunBenchmark(void)
+{
+    char filePath[256];
+
+    snprintf(filePath, sizeof(filePath), "%s/benchmark.kmz", TestCommon_GetOutputDir("waypoint_v3_kmz_test"));
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzRunBenchmark(filePath));
+}
+
+static void KmzTest_PutBits(T_KmzTestBitWriter *writer, uint32_t value, uint32_t count)
+{
+    writer->bitBuffer |= value << writer->bitCount;
+    writer->bitCount += count;
+    while (writer->bitCount >= 8) {
+        writer->data[writer->size++] = (uint8_t) writer->bitBuffer;
+        writer->bitBuffer >>= 8;
+        writer->bitCount -= 8;
+    }
+}
+
+/* Huffman codes go most significant bit first, unlike the other fields of a deflate stream. */
+static void KmzTest_PutHuffmanCode(T_KmzTestBitWriter *writer, uint32_t code, uint32_t len)
+{
+    uint32_t reversed = 0;
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        reversed |= ((code >> i) & 1) << (len - 1 - i);
+    }
+    KmzTest_PutBits(writer, reversed, len);
+}
+
+/* Writes a literal or length symbol with the fixed huffman code of RFC 1951, distances have fixed 5 bit codes. */
+static void KmzTest_PutFixedCode(T_KmzTestBitWriter *writer, uint32_t symbol)
+{
+    uint32_t code;
+    uint32_t len;
+
+    if (symbol < 144) {
+        code = 0x30 + symbol;
+        len = 8;
+    } else if (symbol < 256) {
+        code = 0x190 + symbol - 144;
+        len = 9;
+    } else if (symbol < 280) {
+        code = symbol - 256;
+        len = 7;
+    } else {
+        code = 0xC0 + symbol - 280;
+        len = 8;
+    }
+
+    KmzTest_PutHuffmanCode(writer, code, len);
+}
+
+static void KmzTest_PutStoredBlock(T_KmzTestBitWriter *writer, const uint8_t *data, uint16_t len, bool isFinal)
+{
+    KmzTest_PutBits(writer, isFinal ? 1 : 0, 1);
+    KmzTest_PutBits(writer, 0, 2);
+    KmzTest_FlushBits(writer);
+    KmzTest_WriteU16(writer->data + writer->size, len);
+    KmzTest_WriteU16(writer->data + writer->size + 2, (uint16_t) ~len);
+    writer->size += 4;
+    if (len != 0) {
+        memcpy(writer->data + writer->size, data, len);
+        writer->size += len;
+    }
+}
+
+static void KmzTest_FlushBits(T_KmzTestBitWriter *writer)
+{
+    if (writer->bitCount != 0) {
+        KmzTest_PutBits(writer, 0, 8 - writer->bitCount);
+    }
+}
+
+static int32_t KmzTest_Decode(const uint8_t *stream, uint32_t size)
+{
+    uint32_t outSize = 0;
+    int32_t result;
+
+    memset(&s_output, 0, sizeof(s_output));
+    result = UtilInflate_Decode(stream, size, s_window, KmzTest_Output, &s_output, &outSize);
+    if (result == 0) {
+        TEST_ASSERT(outSize == s_output.size);
+    }
+
+    return result;
+}
+
+static int32_t KmzTest_Output(const uint8_t *data, uint32_t len, void *userData)
+{
+    T_KmzTestOutput *output = userData;
+
+    TEST_ASSERT(len <= sizeof(output->data) - output->size);
+    memcpy(output->data + output->size, data, len);
+    output->size += len;
+    if (len > output->maxChunkSize) {
+        output->maxChunkSize = len;
+    }
+
+    return 0;
+}
+
+static int32_t KmzTest_StopOutput(const uint8_t *data, uint32_t len, void *userData)
+{
+    (void) data;
+    (void) len;
+    (void) userData;
+
+    return 7;
+}
+
+/* Builds a zip archive of stored entries in s_archive, with the template and waylines of the test if no entry is
+ * given. */
+static uint32_t KmzTest_BuildArchive(const T_KmzTestEntry *entries, uint8_t entryCount, const char *comment)
+{
+    const T_KmzTestEntry defaultEntries[] = {
+        {DJI_TEST_WAYPOINT_V3_KMZ_TEMPLATE_FILE_NAME, KMZ_TEST_TEMPLATE_XML, 0, false},
+        {DJI_TEST_WAYPOINT_V3_KMZ_WAYLINES_FILE_NAME, "<kml><Folder><Placemark/></Folder></kml>", 0, false},
+    };
+    uint32_t localOffsets[4];
+    uint32_t centralOffset;
+    uint32_t size = 0;
+    uint32_t nameLength;
+    uint32_t contentLength;
+    uint32_t crc;
+    uint8_t *header;
+    uint8_t i;
+
+    if (entries == NULL) {
+        entries = defaultEntries;
+        entryCount = 2;
+    }
+    TEST_ASSERT(entryCount <= 4);
+
+    for (i = 0; i < entryCount; i++) {
+        nameLength = (uint32_t) strlen(entries[i].name);
+        contentLength = (uint32_t) strlen(entries[i].content);
+        crc = UtilInflate_Crc32(0, (const uint8_t *) entries[i].content, contentLength);
+        TEST_ASSERT(size + 30 + nameLength + contentLength <= sizeof(s_archive));
+
+        localOffsets[i] = size;
+        header = s_archive + size;
+        memset(header, 0, 30);
+        KmzTest_WriteU32(header, 0x04034B50);
+        KmzTest_WriteU16(header + 4, 20);
+        KmzTest_WriteU16(header + 6, entries[i].flags);
+        KmzTest_WriteU32(header + 14, crc);
+        KmzTest_WriteU32(header + 18, contentLength);
+        KmzTest_WriteU32(header + 22, contentLength);
+        KmzTest_WriteU16(header + 26, (uint16_t) nameLength);
+        memcpy(header + 30, entries[i].name, nameLength);
+        memcpy(header + 30 + nameLength, entries[i].content, contentLength);
+        size += 30 + nameLength + contentLength;
+    }
+
+    centralOffset = size;
+    for (i = 0; i < entryCount; i++) {
+        nameLength = (uint32_t) strlen(entries[i].name);
+        contentLength = (uint32_t) strlen(entries[i].content);
+        crc = UtilInflate_Crc32(0, (const uint8_t *) entries[i].content, contentLength);
+        TEST_ASSERT(size + 46 + nameLength <= sizeof(s_archive));
+
+        header = s_archive + size;
+        memset(header, 0, 46);
+        KmzTest_WriteU32(header, 0x02014B50);
+        KmzTest_WriteU16(header + 4, 20);
+        KmzTest_WriteU16(header + 6, 20);
+        KmzTest_WriteU16(header + 8, entries[i].flags);
+        KmzTest_WriteU32(header + 16, entries[i].isCrcCorrupted ? crc ^ 1 : crc);
+        KmzTest_WriteU32(header + 20, contentLength);
+        KmzTest_WriteU32(header + 24, contentLength);
+        KmzTest_WriteU16(header + 28, (uint16_t) nameLength);
+        KmzTest_WriteU32(header + 42, localOffsets[i]);
+        memcpy(header + 46, entries[i].name, nameLength);
+        size += 46 + nameLength;
+    }
+
+    TEST_ASSERT(size + 22 + (comment != NULL ? strlen(comment) : 0) <= sizeof(s_archive));
+    header = s_archive + size;
+    memset(header, 0, 22);
+    KmzTest_WriteU32(header, 0x06054B50);
+    KmzTest_WriteU16(header + 8, entryCount);
+    KmzTest_WriteU16(header + 10, entryCount);
+    KmzTest_WriteU32(header + 12, size - centralOffset);
+    KmzTest_WriteU32(header + 16, centralOffset);
+    size += 22;
+    if (comment != NULL) {
+        KmzTest_WriteU16(header + 20, (uint16_t) strlen(comment));
+        memcpy(s_archive + size, comment, strlen(comment));
+        size += (uint32_t) strlen(comment);
+    }
+
+    return size;
+}
+
+static T_DjiReturnCode KmzTest_ValidateArchive(const T_KmzTestEntry *entries, uint8_t entryCount,
+                                               T_DjiTestWaypointV3KmzInfo *info)
+{
+    T_DjiTestWaypointV3Kmz kmz;
+    T_DjiReturnCode returnCode;
+
+    TEST_ASSERT_SUCCESS(DjiTest_WaypointV3KmzFromBuffer(s_archive, KmzTest_BuildArchive(entries, entryCount, NULL),
+                                                        &kmz));
+    returnCode = DjiTest_WaypointV3KmzValidate(&kmz, info);
+    DjiTest_WaypointV3KmzRelease(&kmz);
+
+    return returnCode;
+}
+
+static void KmzTest_WriteU16(uint8_t *data, uint16_t value)
+{
+    data[0] = (uint8_t) value;
+    data[1] = (uint8_t) (value >> 8);
+}
+
+static void KmzTest_WriteU32(uint8_t *data, uint32_t value)
+{
+    KmzTest_WriteU16(data, (uint16_t) value);
+    KmzTest_WriteU16(data + 2, (uint16_t) (value >> 16));
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
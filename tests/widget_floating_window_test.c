@@ -0,0 +1,389 @@
+/**
+ ********************************************************************
+ * @file    widget_floating_window_test.c
+ * @brief   Runs the widget floating window against a recording backend, checking that appended lines are shown,
+ * coalesced to the configured rate and only sent when the message changed.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include <sched.h>
+#include "test_common.h"
+#include "osal/osal.h"
+#include "dji_widget.h"
+#include "widget/test_widget_floating_window.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define WIDGET_TEST_WAIT_MS                 (2000)
+#define WIDGET_TEST_MIN_UPDATE_INTERVAL_MS  (100)
+#define WIDGET_TEST_REFRESH_INTERVAL_MS     (250)
+#define WIDGET_TEST_BURST_DURATION_MS       (1000)
+#define WIDGET_TEST_STRESS_DURATION_MS      (2000)
+#define WIDGET_TEST_STOP_RACE_CYCLE_NUM     (200)
+#define WIDGET_TEST_STOP_RACE_POST_DELAY_US (5000)
+#define WIDGET_TEST_STOP_RACE_WRITER_NUM    (2)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t messageCount;
+    bool isFailing;
+    char lastMessage[DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN];
+} T_WidgetTestBackend;
+
+/* Private values -------------------------------------------------------------*/
+static pthread_mutex_t s_backendMutex = PTHREAD_MUTEX_INITIALIZER;
+static T_WidgetTestBackend s_backend;
+static volatile bool s_isStopRaceAppending = false;
+
+/* Private functions declaration ---------------------------------------------*/
+static void WidgetTest_RunNotStarted(void);
+static void WidgetTest_RunAppendedLinesShown(void);
+static void WidgetTest_RunIdleRefresh(void);
+static void WidgetTest_RunCoalescing(void);
+static void WidgetTest_RunFailingBackend(void);
+static void WidgetTest_RunStressTest(void);
+static void WidgetTest_RunStopRace(void);
+static void *WidgetTest_StopRaceAppendTask(void *arg);
+static void WidgetTest_AppendLog(const char *fmt, ...);
+static T_WidgetTestBackend WidgetTest_GetBackend(void);
+static void WidgetTest_ResetBackend(bool isFailing);
+static void WidgetTest_WaitForMessage(const char *content);
+static T_DjiReturnCode WidgetTest_ShowMessage(const char *str);
+
+/* Private variables ---------------------------------------------------------*/
+static const T_DjiTestWidgetFloatingWindowBackend s_testBackend = {
+    .ShowMessage = WidgetTest_ShowMessage,
+};
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+
+    WidgetTest_RunNotStarted();
+    WidgetTest_RunAppendedLinesShown();
+    WidgetTest_RunIdleRefresh();
+    WidgetTest_RunCoalescing();
+    WidgetTest_RunFailingBackend();
+    WidgetTest_RunStressTest();
+    WidgetTest_RunStopRace();
+
+    printf("widget floating window test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void WidgetTest_RunNotStarted(void)
+{
+    T_DjiTestWidgetFloatingWindowConfig config = {
+        .minUpdateIntervalMs = WIDGET_TEST_MIN_UPDATE_INTERVAL_MS,
+        .refreshIntervalMs = 0,
+    };
+
+    TEST_ASSERT(DjiTest_WidgetFloatingWindowStop() == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT(DjiTest_WidgetFloatingWindowGetStatistics(NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    // an empty log without system time renders an empty message, which is never sent
+    WidgetTest_ResetBackend(false);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend));
+    TEST_ASSERT(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend) == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+    Osal_TaskSleepMs(WIDGET_TEST_MIN_UPDATE_INTERVAL_MS * 3);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStop());
+    TEST_ASSERT(WidgetTest_GetBackend().messageCount == 0);
+}
+
+static void WidgetTest_RunAppendedLinesShown(void)
+{
+    T_DjiTestWidgetFloatingWindowConfig config = {
+        .minUpdateIntervalMs = WIDGET_TEST_MIN_UPDATE_INTERVAL_MS,
+        .refreshIntervalMs = 0,
+    };
+    T_DjiTestWidgetFloatingWindowStatistics statistics;
+    char expected[DJI_WIDGET_FLOATING_WINDOW_MSG_MAX_LEN];
+    char longLine[DJI_TEST_WIDGET_LOG_LINE_SIZE_MAX * 2];
+    uint32_t messageCount;
+    int length = 0;
+    int i;
+
+    WidgetTest_ResetBackend(false);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend));
+
+    // only the newest lines are displayed, oldest first
+    for (i = 0; i < DJI_TEST_WIDGET_LOG_DISPLAY_LINE_NUM + 3; i++) {
+        WidgetTest_AppendLog("line %d", i);
+    }
+    for (i = 3; i < DJI_TEST_WIDGET_LOG_DISPLAY_LINE_NUM + 3; i++) {
+        length += snprintf(expected + length, sizeof(expected) - length, "%sline %d", length != 0 ? "\r\n" : "", i);
+    }
+    WidgetTest_WaitForMessage(expected);
+
+    // nothing changed, nothing is sent
+    messageCount = WidgetTest_GetBackend().messageCount;
+    Osal_TaskSleepMs(WIDGET_TEST_MIN_UPDATE_INTERVAL_MS * 3);
+    TEST_ASSERT(WidgetTest_GetBackend().messageCount == messageCount);
+
+    // a line longer than a ring slot is truncated
+    memset(longLine, 'x', sizeof(longLine) - 1);
+    longLine[sizeof(longLine) - 1] = '\0';
+    WidgetTest_AppendLog("%s", longLine);
+    longLine[DJI_TEST_WIDGET_LOG_LINE_SIZE_MAX - 1] = '\0';
+    length = 0;
+    for (i = 4; i < DJI_TEST_WIDGET_LOG_DISPLAY_LINE_NUM + 3; i++) {
+        length += snprintf(expected + length, sizeof(expected) - length, "%sline %d", length != 0 ? "\r\n" : "", i);
+    }
+    snprintf(expected + length, sizeof(expected) - length, "\r\n%s", longLine);
+    WidgetTest_WaitForMessage(expected);
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStop());
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowGetStatistics(&statistics));
+    TEST_ASSERT(statistics.messageCount == WidgetTest_GetBackend().messageCount);
+    TEST_ASSERT(statistics.messageErrorCount == 0);
+    TEST_ASSERT(statistics.droppedLineCount == 0);
+}
+
+static void WidgetTest_RunIdleRefresh(void)
+{
+    T_DjiTestWidgetFloatingWindowConfig config = {
+        .minUpdateIntervalMs = WIDGET_TEST_MIN_UPDATE_INTERVAL_MS,
+        .refreshIntervalMs = WIDGET_TEST_REFRESH_INTERVAL_MS,
+    };
+    T_WidgetTestBackend backend;
+    uint32_t messageCount;
+
+    // without new lines the system time alone is sent at the refresh rate
+    WidgetTest_ResetBackend(false);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend));
+    Osal_TaskSleepMs(WIDGET_TEST_REFRESH_INTERVAL_MS * 4 + WIDGET_TEST_REFRESH_INTERVAL_MS / 2);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStop());
+
+    backend = WidgetTest_GetBackend();
+    messageCount = backend.messageCount;
+    TEST_ASSERT(strncmp(backend.lastMessage, "System time : ", strlen("System time : ")) == 0);
+    TEST_ASSERT(messageCount >= 3 && messageCount <= 6);
+
+    printf("idle refresh: %u messages in %u ms\n", messageCount,
+           WIDGET_TEST_REFRESH_INTERVAL_MS * 4 + WIDGET_TEST_REFRESH_INTERVAL_MS / 2);
+}
+
+static void WidgetTest_RunCoalescing(void)
+{
+    T_DjiTestWidgetFloatingWindowConfig config = {
+        .minUpdateIntervalMs = WIDGET_TEST_MIN_UPDATE_INTERVAL_MS,
+        .refreshIntervalMs = 0,
+    };
+    uint32_t startMs;
+    uint32_t nowMs;
+    uint32_t lineCount = 0;
+    uint32_t messageCount;
+
+    // a line every millisecond is shown at most once per update interval, and the last line is not lost
+    WidgetTest_ResetBackend(false);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend));
+    Osal_GetTimeMs(&startMs);
+    do {
+        WidgetTest_AppendLog("burst %u", lineCount);
+        lineCount++;
+        Osal_TaskSleepMs(1);
+        Osal_GetTimeMs(&nowMs);
+    } while (nowMs - startMs < WIDGET_TEST_BURST_DURATION_MS);
+    Osal_TaskSleepMs(WIDGET_TEST_MIN_UPDATE_INTERVAL_MS * 2);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStop());
+
+    messageCount = WidgetTest_GetBackend().messageCount;
+    TEST_ASSERT(messageCount >= 2);
+    TEST_ASSERT(messageCount <= WIDGET_TEST_BURST_DURATION_MS / WIDGET_TEST_MIN_UPDATE_INTERVAL_MS + 4);
+    TEST_ASSERT(strstr(WidgetTest_GetBackend().lastMessage, "burst") != NULL);
+
+    printf("coalescing: %u lines in %u messages\n", lineCount, messageCount);
+}
+
+static void WidgetTest_RunFailingBackend(void)
+{
+    T_DjiTestWidgetFloatingWindowConfig config = {
+        .minUpdateIntervalMs = WIDGET_TEST_MIN_UPDATE_INTERVAL_MS,
+        .refreshIntervalMs = 0,
+    };
+    T_DjiTestWidgetFloatingWindowStatistics statistics;
+    uint32_t waitedMs = 0;
+
+    // a failed message is counted and not taken as shown, the next line is sent again
+    WidgetTest_ResetBackend(true);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend));
+    WidgetTest_AppendLog("rejected");
+    do {
+        Osal_TaskSleepMs(10);
+        waitedMs += 10;
+        TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowGetStatistics(&statistics));
+    } while (statistics.messageErrorCount == 0 && waitedMs < WIDGET_TEST_WAIT_MS);
+    TEST_ASSERT(statistics.messageErrorCount == 1);
+    TEST_ASSERT(statistics.messageCount == 0);
+
+    pthread_mutex_lock(&s_backendMutex);
+    s_backend.isFailing = false;
+    pthread_mutex_unlock(&s_backendMutex);
+    WidgetTest_AppendLog("accepted");
+    WidgetTest_WaitForMessage(NULL);
+    TEST_ASSERT(strstr(WidgetTest_GetBackend().lastMessage, "rejected\r\naccepted") != NULL);
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStop());
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowGetStatistics(&statistics));
+    TEST_ASSERT(statistics.messageErrorCount == 1);
+    TEST_ASSERT(statistics.messageCount == 1);
+}
+
+static void WidgetTest_RunStressTest(void)
+{
+    T_DjiTestWidgetFloatingWindowConfig config = {
+        .minUpdateIntervalMs = WIDGET_TEST_MIN_UPDATE_INTERVAL_MS,
+        .refreshIntervalMs = 0,
+    };
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowRunStressTest(4, WIDGET_TEST_STRESS_DURATION_MS));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowRunStressTest(8, WIDGET_TEST_STRESS_DURATION_MS));
+
+    // a running window is restarted with its own config and backend afterwards
+    WidgetTest_ResetBackend(false);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowRunStressTest(2, WIDGET_TEST_STRESS_DURATION_MS / 2));
+    TEST_ASSERT(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend) == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+    WidgetTest_AppendLog("after stress test");
+    WidgetTest_WaitForMessage(NULL);
+    TEST_ASSERT(strstr(WidgetTest_GetBackend().lastMessage, "after stress test") != NULL);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStop());
+}
+
+/* Stop and start the window again and again while other tasks keep appending lines and waking it. */
+static void WidgetTest_RunStopRace(void)
+{
+    T_DjiTestWidgetFloatingWindowConfig config = {
+        .minUpdateIntervalMs = 1,
+        .refreshIntervalMs = 0,
+    };
+    pthread_t appendThreads[WIDGET_TEST_STOP_RACE_WRITER_NUM];
+    uint32_t i;
+
+    s_isStopRaceAppending = true;
+    for (i = 0; i < WIDGET_TEST_STOP_RACE_WRITER_NUM; i++) {
+        TEST_ASSERT(pthread_create(&appendThreads[i], NULL, WidgetTest_StopRaceAppendTask, NULL) == 0);
+    }
+
+    // a restarted window may send its last message again, the backend starts over with it
+    for (i = 0; i < WIDGET_TEST_STOP_RACE_CYCLE_NUM; i++) {
+        WidgetTest_ResetBackend(false);
+        TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStart(&config, &s_testBackend));
+        Osal_TaskSleepMs(1);
+        TEST_ASSERT_SUCCESS(DjiTest_WidgetFloatingWindowStop());
+    }
+
+    s_isStopRaceAppending = false;
+    for (i = 0; i < WIDGET_TEST_STOP_RACE_WRITER_NUM; i++) {
+        TEST_ASSERT(pthread_join(appendThreads[i], NULL) == 0);
+    }
+
+    printf("stop race: %u cycles\n", WIDGET_TEST_STOP_RACE_CYCLE_NUM);
+}
+
+static void *WidgetTest_StopRaceAppendTask(void *arg)
+{
+    uint32_t i = 0;
+
+    (void) arg;
+
+    // a wake of the window outlasts a whole stop, it has to be waited for
+    TestCommon_SetSemaphorePostDelayUs(WIDGET_TEST_STOP_RACE_POST_DELAY_US);
+    while (s_isStopRaceAppending) {
+        WidgetTest_AppendLog("stop race line %u", i++);
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+static void WidgetTest_AppendLog(const char *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    DjiTest_WidgetFloatingWindowAppendLogV(fmt, args);
+    va_end(args);
+}
+
+static T_WidgetTestBackend WidgetTest_GetBackend(void)
+{
+    T_WidgetTestBackend backend;
+
+    pthread_mutex_lock(&s_backendMutex);
+    backend = s_backend;
+    pthread_mutex_unlock(&s_backendMutex);
+
+    return backend;
+}
+
+static void WidgetTest_ResetBackend(bool isFailing)
+{
+    pthread_mutex_lock(&s_backendMutex);
+    memset(&s_backend, 0, sizeof(s_backend));
+    s_backend.isFailing = isFailing;
+    pthread_mutex_unlock(&s_backendMutex);
+}
+
+/* Waits until the last message equals the content, or for a new message if the content is NULL. */
+static void WidgetTest_WaitForMessage(const char *content)
+{
+    uint32_t messageCount = WidgetTest_GetBackend().messageCount;
+    uint32_t waitedMs = 0;
+    T_WidgetTestBackend backend;
+
+    while (waitedMs < WIDGET_TEST_WAIT_MS) {
+        backend = WidgetTest_GetBackend();
+        if (content != NULL ? strcmp(backend.lastMessage, content) == 0 : backend.messageCount != messageCount) {
+            return;
+        }
+        Osal_TaskSleepMs(10);
+        waitedMs += 10;
+    }
+
+    printf("last message: \"%s\"\n", WidgetTest_GetBackend().lastMessage);
+    TEST_ASSERT(waitedMs < WIDGET_TEST_WAIT_MS);
+}
+
+static T_DjiReturnCode WidgetTest_ShowMessage(const char *str)
+{
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    pthread_mutex_lock(&s_backendMutex);
+    if (s_backend.isFailing) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR;
+    } else {
+        // an unchanged message must not be sent again
+        TEST_ASSERT(strcmp(s_backend.lastMessage, str) != 0);
+        TEST_ASSERT(strlen(str) < sizeof(s_backend.lastMessage));
+        strcpy(s_backend.lastMessage, str);
+        s_backend.messageCount++;
+    }
+    pthread_mutex_unlock(&s_backendMutex);
+
+    return returnCode;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
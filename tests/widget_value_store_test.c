@@ -0,0 +1,410 @@
+/**
+ ********************************************************************
+ * @file    widget_value_store_test.c
+ * @brief   Runs the widget value store with a test observer, checking that sets are never torn, coalesced to the
+ * latest value while the observer is busy and that every button press is still notified.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <pthread.h>
+#include "test_common.h"
+#include "osal/osal.h"
+#include "widget/test_widget_value_store.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define VALUE_STORE_TEST_WAIT_MS            (2000)
+#define VALUE_STORE_TEST_NOTIFICATION_NUM   (64)
+#define VALUE_STORE_TEST_SET_NUM            (1000)
+#define VALUE_STORE_TEST_PRESS_NUM          (5)
+#define VALUE_STORE_TEST_READ_SET_NUM       (200000)
+#define VALUE_STORE_TEST_BENCHMARK_MS       (1500)
+#define VALUE_STORE_TEST_SCALE_INDEX        (0)
+#define VALUE_STORE_TEST_SWITCH_INDEX       (3)
+#define VALUE_STORE_TEST_BUTTON_INDEX       (7)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t index;
+    T_DjiTestWidgetValue value;
+} T_ValueStoreTestNotification;
+
+typedef struct {
+    uint32_t count;
+    uint32_t anyCount;
+    volatile bool isBlocked;
+    volatile bool isWaiting;
+    T_ValueStoreTestNotification notifications[VALUE_STORE_TEST_NOTIFICATION_NUM];
+} T_ValueStoreTestObserver;
+
+/* Private values -------------------------------------------------------------*/
+static pthread_mutex_t s_observerMutex = PTHREAD_MUTEX_INITIALIZER;
+static T_ValueStoreTestObserver s_observer;
+static T_DjiTestWidgetValueStore s_store;
+static volatile bool s_isReaderStopping = false;
+static volatile uint32_t s_readerReadCount = 0;
+static volatile uint32_t s_readerTornCount = 0;
+
+/* Private functions declaration ---------------------------------------------*/
+static void ValueStoreTest_RunInit(void);
+static void ValueStoreTest_RunSetAndGet(void);
+static void ValueStoreTest_RunObservers(void);
+static void ValueStoreTest_RunCoalescing(void);
+static void ValueStoreTest_RunConcurrentReader(void);
+static void ValueStoreTest_RunBenchmark(void);
+static T_ValueStoreTestObserver ValueStoreTest_GetObserver(void);
+static void ValueStoreTest_ResetObserver(void);
+static void ValueStoreTest_WaitForValue(uint32_t index, int32_t value);
+static void ValueStoreTest_Observer(uint32_t index, const T_DjiTestWidgetValue *value, void *userData);
+static void ValueStoreTest_AnyObserver(uint32_t index, const T_DjiTestWidgetValue *value, void *userData);
+static void *ValueStoreTest_ReaderTask(void *arg);
+
+/* Private variables ---------------------------------------------------------*/
+static const T_DjiWidgetHandlerListItem s_handlerList[] = {
+    {VALUE_STORE_TEST_SCALE_INDEX,  DJI_WIDGET_TYPE_SCALE,  DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_store)},
+    {VALUE_STORE_TEST_SWITCH_INDEX, DJI_WIDGET_TYPE_SWITCH, DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_store)},
+    {VALUE_STORE_TEST_BUTTON_INDEX, DJI_WIDGET_TYPE_BUTTON, DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_store)},
+};
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+
+    ValueStoreTest_RunInit();
+    ValueStoreTest_RunSetAndGet();
+    ValueStoreTest_RunObservers();
+    ValueStoreTest_RunCoalescing();
+    ValueStoreTest_RunConcurrentReader();
+    ValueStoreTest_RunBenchmark();
+
+    printf("widget value store test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void ValueStoreTest_RunInit(void)
+{
+    T_DjiWidgetHandlerListItem outOfRangeList[] = {
+        {DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX, DJI_WIDGET_TYPE_SCALE,
+            DJI_TEST_WIDGET_VALUE_STORE_HANDLERS(&s_store)},
+    };
+
+    TEST_ASSERT(DjiTest_WidgetValueStoreInit(NULL, s_handlerList, 3) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_WidgetValueStoreInit(&s_store, NULL, 3) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_WidgetValueStoreInit(&s_store, outOfRangeList, 1) == DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+    TEST_ASSERT(DjiTest_WidgetValueStoreDeInit(&s_store) == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT(DjiTest_WidgetValueStoreDeInit(NULL) == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreInit(&s_store, s_handlerList, 3));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreDeInit(&s_store));
+    TEST_ASSERT(DjiTest_WidgetValueStoreDeInit(&s_store) == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+}
+
+static void ValueStoreTest_RunSetAndGet(void)
+{
+    T_DjiTestWidgetValue value;
+    int32_t widgetValue = 0;
+    uint32_t changeSequence;
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreInit(&s_store, s_handlerList, 3));
+    changeSequence = DjiTest_WidgetValueStoreGetChangeSequence(&s_store);
+
+    // widgets outside the handler list are rejected
+    TEST_ASSERT(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE, 1, 10, &s_store) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE,
+                                                       DJI_TEST_WIDGET_VALUE_STORE_WIDGET_NUM_MAX, 10, &s_store) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_WidgetValueStoreGetWidgetValue(DJI_WIDGET_TYPE_SCALE, 1, &widgetValue, &s_store) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_WidgetValueStoreGetValue(&s_store, 1, &value) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT(DjiTest_WidgetValueStoreGetChangeSequence(&s_store) == changeSequence);
+
+    // a set is read back by the widget module and the application
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE, VALUE_STORE_TEST_SCALE_INDEX, 42,
+                                                               &s_store));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreGetWidgetValue(DJI_WIDGET_TYPE_SCALE, VALUE_STORE_TEST_SCALE_INDEX,
+                                                               &widgetValue, &s_store));
+    TEST_ASSERT(widgetValue == 42);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreGetValue(&s_store, VALUE_STORE_TEST_SCALE_INDEX, &value));
+    TEST_ASSERT(value.type == DJI_WIDGET_TYPE_SCALE && value.value == 42 && value.sequence == 1);
+    TEST_ASSERT(value.pressCount == 0 && value.setTimeUs != 0);
+    TEST_ASSERT(DjiTest_WidgetValueStoreGetChangeSequence(&s_store) == changeSequence + 1);
+
+    // only presses of a button are counted
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SWITCH, VALUE_STORE_TEST_SWITCH_INDEX,
+                                                               DJI_WIDGET_BUTTON_STATE_PRESS_DOWN, &s_store));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_BUTTON, VALUE_STORE_TEST_BUTTON_INDEX,
+                                                               DJI_WIDGET_BUTTON_STATE_PRESS_DOWN, &s_store));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_BUTTON, VALUE_STORE_TEST_BUTTON_INDEX,
+                                                               DJI_WIDGET_BUTTON_STATE_RELEASE_UP, &s_store));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreGetValue(&s_store, VALUE_STORE_TEST_SWITCH_INDEX, &value));
+    TEST_ASSERT(value.pressCount == 0);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreGetValue(&s_store, VALUE_STORE_TEST_BUTTON_INDEX, &value));
+    TEST_ASSERT(value.type == DJI_WIDGET_TYPE_BUTTON && value.value == DJI_WIDGET_BUTTON_STATE_RELEASE_UP);
+    TEST_ASSERT(value.pressCount == 1 && value.sequence == 2);
+    TEST_ASSERT(DjiTest_WidgetValueStoreGetChangeSequence(&s_store) == changeSequence + 4);
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreDeInit(&s_store));
+}
+
+static void ValueStoreTest_RunObservers(void)
+{
+    T_ValueStoreTestObserver observer;
+    uint32_t i;
+
+    ValueStoreTest_ResetObserver();
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreInit(&s_store, s_handlerList, 3));
+    TEST_ASSERT(DjiTest_WidgetValueStoreRegObserver(&s_store, VALUE_STORE_TEST_SCALE_INDEX, NULL, NULL) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreRegObserver(&s_store, VALUE_STORE_TEST_BUTTON_INDEX,
+                                                            ValueStoreTest_Observer, NULL));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreRegObserver(&s_store, DJI_TEST_WIDGET_VALUE_STORE_ANY_INDEX,
+                                                            ValueStoreTest_AnyObserver, NULL));
+
+    // the observer of the button only gets the button, the observer of any widget gets both
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE, VALUE_STORE_TEST_SCALE_INDEX, 7,
+                                                               &s_store));
+    ValueStoreTest_WaitForValue(VALUE_STORE_TEST_SCALE_INDEX, 7);
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_BUTTON, VALUE_STORE_TEST_BUTTON_INDEX,
+                                                               DJI_WIDGET_BUTTON_STATE_PRESS_DOWN, &s_store));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_BUTTON, VALUE_STORE_TEST_BUTTON_INDEX,
+                                                               DJI_WIDGET_BUTTON_STATE_RELEASE_UP, &s_store));
+    ValueStoreTest_WaitForValue(VALUE_STORE_TEST_BUTTON_INDEX, DJI_WIDGET_BUTTON_STATE_RELEASE_UP);
+
+    // a press is notified before its release, whether or not both were set within one dispatch
+    observer = ValueStoreTest_GetObserver();
+    TEST_ASSERT(observer.count == 2 && observer.anyCount == 3);
+    TEST_ASSERT(observer.notifications[0].index == VALUE_STORE_TEST_SCALE_INDEX);
+    TEST_ASSERT(observer.notifications[1].index == VALUE_STORE_TEST_BUTTON_INDEX);
+    TEST_ASSERT(observer.notifications[1].value.value == DJI_WIDGET_BUTTON_STATE_PRESS_DOWN);
+    TEST_ASSERT(observer.notifications[1].value.pressCount == 1);
+    TEST_ASSERT(observer.notifications[2].value.value == DJI_WIDGET_BUTTON_STATE_RELEASE_UP);
+
+    // a set to the value already notified is not notified again
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE, VALUE_STORE_TEST_SCALE_INDEX, 7,
+                                                               &s_store));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE, VALUE_STORE_TEST_SCALE_INDEX, 8,
+                                                               &s_store));
+    ValueStoreTest_WaitForValue(VALUE_STORE_TEST_SCALE_INDEX, 8);
+    observer = ValueStoreTest_GetObserver();
+    TEST_ASSERT(observer.anyCount == 4);
+
+    for (i = 2; i < DJI_TEST_WIDGET_VALUE_STORE_OBSERVER_NUM_MAX; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreRegObserver(&s_store, VALUE_STORE_TEST_SWITCH_INDEX,
+                                                                ValueStoreTest_Observer, NULL));
+    }
+    TEST_ASSERT(DjiTest_WidgetValueStoreRegObserver(&s_store, VALUE_STORE_TEST_SWITCH_INDEX,
+                                                    ValueStoreTest_Observer, NULL) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_OUT_OF_RANGE);
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreDeInit(&s_store));
+}
+
+static void ValueStoreTest_RunCoalescing(void)
+{
+    T_DjiTestWidgetValueStoreStatistics statistics;
+    T_ValueStoreTestObserver observer;
+    uint32_t scaleNotifyCount = 0;
+    uint32_t pressNotifyCount = 0;
+    uint32_t waitedMs = 0;
+    uint32_t i;
+
+    ValueStoreTest_ResetObserver();
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreInit(&s_store, s_handlerList, 3));
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreRegObserver(&s_store, DJI_TEST_WIDGET_VALUE_STORE_ANY_INDEX,
+                                                            ValueStoreTest_AnyObserver, NULL));
+
+    // the observer hangs on the first notification while the widget module keeps setting
+    s_observer.isBlocked = true;
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE, VALUE_STORE_TEST_SCALE_INDEX,
+                                                               -1, &s_store));
+    while (!s_observer.isWaiting && waitedMs < VALUE_STORE_TEST_WAIT_MS) {
+        Osal_TaskSleepMs(1);
+        waitedMs++;
+    }
+    TEST_ASSERT(s_observer.isWaiting);
+
+    for (i = 1; i <= VALUE_STORE_TEST_SET_NUM; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE, VALUE_STORE_TEST_SCALE_INDEX,
+                                                                   (int32_t) i, &s_store));
+    }
+    for (i = 0; i < VALUE_STORE_TEST_PRESS_NUM; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_BUTTON,
+                                                                   VALUE_STORE_TEST_BUTTON_INDEX,
+                                                                   DJI_WIDGET_BUTTON_STATE_PRESS_DOWN, &s_store));
+        TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_BUTTON,
+                                                                   VALUE_STORE_TEST_BUTTON_INDEX,
+                                                                   DJI_WIDGET_BUTTON_STATE_RELEASE_UP, &s_store));
+    }
+    s_observer.isBlocked = false;
+    ValueStoreTest_WaitForValue(VALUE_STORE_TEST_SCALE_INDEX, VALUE_STORE_TEST_SET_NUM);
+    ValueStoreTest_WaitForValue(VALUE_STORE_TEST_BUTTON_INDEX, DJI_WIDGET_BUTTON_STATE_RELEASE_UP);
+
+    // the scale is notified once more with its latest value, every press is notified, the releases are coalesced
+    observer = ValueStoreTest_GetObserver();
+    TEST_ASSERT(observer.anyCount == 2 + VALUE_STORE_TEST_PRESS_NUM + 1);
+    TEST_ASSERT(observer.notifications[0].index == VALUE_STORE_TEST_SCALE_INDEX);
+    TEST_ASSERT(observer.notifications[0].value.value == -1);
+    for (i = 1; i < observer.anyCount; i++) {
+        if (observer.notifications[i].index == VALUE_STORE_TEST_SCALE_INDEX) {
+            scaleNotifyCount++;
+            TEST_ASSERT(observer.notifications[i].value.value == VALUE_STORE_TEST_SET_NUM);
+            TEST_ASSERT(observer.notifications[i].value.sequence == VALUE_STORE_TEST_SET_NUM + 1);
+        } else if (pressNotifyCount < VALUE_STORE_TEST_PRESS_NUM) {
+            TEST_ASSERT(observer.notifications[i].value.value == DJI_WIDGET_BUTTON_STATE_PRESS_DOWN);
+            TEST_ASSERT(observer.notifications[i].value.pressCount == ++pressNotifyCount);
+        } else {
+            TEST_ASSERT(observer.notifications[i].value.value == DJI_WIDGET_BUTTON_STATE_RELEASE_UP);
+            TEST_ASSERT(observer.notifications[i].value.pressCount == VALUE_STORE_TEST_PRESS_NUM);
+        }
+    }
+    TEST_ASSERT(scaleNotifyCount == 1 && pressNotifyCount == VALUE_STORE_TEST_PRESS_NUM);
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreGetStatistics(&s_store, &statistics));
+    TEST_ASSERT(statistics.setCount == 1 + VALUE_STORE_TEST_SET_NUM + VALUE_STORE_TEST_PRESS_NUM * 2);
+    TEST_ASSERT(statistics.notifyCount == observer.anyCount);
+    TEST_ASSERT(statistics.coalescedCount == VALUE_STORE_TEST_SET_NUM - 1 + VALUE_STORE_TEST_PRESS_NUM * 2 - 1);
+
+    printf("coalescing: %u sets, %u notifications, %u coalesced\n", statistics.setCount, statistics.notifyCount,
+           statistics.coalescedCount);
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreDeInit(&s_store));
+}
+
+static void ValueStoreTest_RunConcurrentReader(void)
+{
+    pthread_t readerThread;
+    uint32_t i;
+
+    // every set writes its own sequence as the value, a read mixing two sets is torn
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreInit(&s_store, s_handlerList, 3));
+    s_isReaderStopping = false;
+    TEST_ASSERT(pthread_create(&readerThread, NULL, ValueStoreTest_ReaderTask, NULL) == 0);
+    for (i = 1; i <= VALUE_STORE_TEST_READ_SET_NUM; i++) {
+        TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreSetWidgetValue(DJI_WIDGET_TYPE_SCALE, VALUE_STORE_TEST_SCALE_INDEX,
+                                                                   (int32_t) i, &s_store));
+    }
+    s_isReaderStopping = true;
+    TEST_ASSERT(pthread_join(readerThread, NULL) == 0);
+
+    TEST_ASSERT(s_readerTornCount == 0);
+    TEST_ASSERT(s_readerReadCount > 0);
+    printf("concurrent reader: %u reads of %u sets\n", s_readerReadCount, VALUE_STORE_TEST_READ_SET_NUM);
+
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreDeInit(&s_store));
+}
+
+static void ValueStoreTest_RunBenchmark(void)
+{
+    TEST_ASSERT_SUCCESS(DjiTest_WidgetValueStoreRunBenchmark(VALUE_STORE_TEST_BENCHMARK_MS));
+}
+
+static T_ValueStoreTestObserver ValueStoreTest_GetObserver(void)
+{
+    T_ValueStoreTestObserver observer;
+
+    pthread_mutex_lock(&s_observerMutex);
+    observer = s_observer;
+    pthread_mutex_unlock(&s_observerMutex);
+
+    return observer;
+}
+
+static void ValueStoreTest_ResetObserver(void)
+{
+    pthread_mutex_lock(&s_observerMutex);
+    memset(&s_observer, 0, sizeof(s_observer));
+    pthread_mutex_unlock(&s_observerMutex);
+}
+
+/* Waits until the observer of any widget got the value of the widget. */
+static void ValueStoreTest_WaitForValue(uint32_t index, int32_t value)
+{
+    T_ValueStoreTestObserver observer;
+    uint32_t waitedMs = 0;
+    uint32_t i;
+
+    while (waitedMs < VALUE_STORE_TEST_WAIT_MS) {
+        observer = ValueStoreTest_GetObserver();
+        for (i = 0; i < observer.anyCount && i < VALUE_STORE_TEST_NOTIFICATION_NUM; i++) {
+            if (observer.notifications[i].index == index && observer.notifications[i].value.value == value) {
+                return;
+            }
+        }
+        Osal_TaskSleepMs(1);
+        waitedMs++;
+    }
+
+    TEST_ASSERT(waitedMs < VALUE_STORE_TEST_WAIT_MS);
+}
+
+static void ValueStoreTest_Observer(uint32_t index, const T_DjiTestWidgetValue *value, void *userData)
+{
+    (void) userData;
+
+    pthread_mutex_lock(&s_observerMutex);
+    TEST_ASSERT(index == VALUE_STORE_TEST_BUTTON_INDEX && value->type == DJI_WIDGET_TYPE_BUTTON);
+    s_observer.count++;
+    pthread_mutex_unlock(&s_observerMutex);
+}
+
+static void ValueStoreTest_AnyObserver(uint32_t index, const T_DjiTestWidgetValue *value, void *userData)
+{
+    (void) userData;
+
+    pthread_mutex_lock(&s_observerMutex);
+    TEST_ASSERT(s_observer.anyCount < VALUE_STORE_TEST_NOTIFICATION_NUM);
+    s_observer.notifications[s_observer.anyCount].index = index;
+    s_observer.notifications[s_observer.anyCount].value = *value;
+    s_observer.anyCount++;
+    pthread_mutex_unlock(&s_observerMutex);
+
+    while (s_observer.isBlocked) {
+        s_observer.isWaiting = true;
+        Osal_TaskSleepMs(1);
+    }
+}
+
+static void *ValueStoreTest_ReaderTask(void *arg)
+{
+    T_DjiTestWidgetValue value;
+
+    (void) arg;
+
+    while (!s_isReaderStopping) {
+        if (DjiTest_WidgetValueStoreGetValue(&s_store, VALUE_STORE_TEST_SCALE_INDEX, &value) !=
+            DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS) {
+            continue;
+        }
+        s_readerReadCount++;
+        if (value.value != (int32_t) value.sequence) {
+            s_readerTornCount++;
+        }
+    }
+
+    return NULL;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,387 @@
+/**
+ ********************************************************************
+ * @file    xport_state_test.c
+ * @brief   Runs the cached XPort state against a fake XPort backend, checking that limit angles are only read
+ * when missing or stale and that the speed conversion factor follows the newest zoom.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "test_common.h"
+#include "osal/osal.h"
+#include "xport/test_payload_xport_state.h"
+#include "camera_emu/test_payload_cam_emu_base.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define XPORT_TEST_WAIT_MS              (2000)
+#define XPORT_TEST_ZOOM_CHANGE_NUM      (200)
+#define XPORT_TEST_STOP_RACE_CYCLE_NUM  (200)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    uint32_t getCount;
+    uint32_t setCount;
+    uint32_t setFactorCount;
+    uint32_t limitAngleChangeCount;
+    float lastFactor;
+    bool isGetFailing;
+    T_DjiXPortLimitAngle limitAngles[DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM];
+} T_XPortTestBackend;
+
+/* Private values -------------------------------------------------------------*/
+static pthread_mutex_t s_backendMutex = PTHREAD_MUTEX_INITIALIZER;
+static T_XPortTestBackend s_backend;
+static DjiTestCameraZoomChangeCallback s_zoomChangeCallback = NULL;
+static DjiTestCameraZoomChangeCallback s_stopRaceCallback = NULL;
+static volatile bool s_isStopRaceNotifying = false;
+
+/* Private functions declaration ---------------------------------------------*/
+static void XPortTest_RunNotStarted(void);
+static void XPortTest_RunLimitAngleCache(void);
+static void XPortTest_RunSpeedConversionFactor(void);
+static void XPortTest_RunSystemStateRefresh(void);
+static void XPortTest_RunFailingBackend(void);
+static void XPortTest_RunStopRace(void);
+static void *XPortTest_StopRaceNotifyTask(void *arg);
+static T_XPortTestBackend XPortTest_GetBackend(void);
+static void XPortTest_WaitForSetFactorCount(uint32_t count);
+static void XPortTest_WaitForGetCount(uint32_t count);
+static T_DjiReturnCode XPortTest_SetLimitAngleSync(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                   T_DjiXPortLimitAngle limitAngle);
+static T_DjiReturnCode XPortTest_GetLimitAngleSync(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                   T_DjiXPortLimitAngle *limitAngle);
+static T_DjiReturnCode XPortTest_SetSpeedConversionFactor(float factor);
+static void XPortTest_LimitAngleChangeCallback(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                               T_DjiXPortLimitAngle limitAngle);
+
+/* Private variables ---------------------------------------------------------*/
+static const T_DjiTestXPortBackend s_testBackend = {
+    .SetLimitAngleSync = XPortTest_SetLimitAngleSync,
+    .GetLimitAngleSync = XPortTest_GetLimitAngleSync,
+    .SetSpeedConversionFactor = XPortTest_SetSpeedConversionFactor,
+};
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    TestCommon_Init();
+
+    XPortTest_RunNotStarted();
+    XPortTest_RunLimitAngleCache();
+    XPortTest_RunSpeedConversionFactor();
+    XPortTest_RunSystemStateRefresh();
+    XPortTest_RunFailingBackend();
+    XPortTest_RunStopRace();
+
+    printf("xport state test passed\n");
+    return 0;
+}
+
+/* The camera emulation is not linked, its zoom notifications are raised by the test. */
+T_DjiReturnCode DjiTest_CameraRegZoomChangeCallback(DjiTestCameraZoomChangeCallback callback)
+{
+    s_zoomChangeCallback = callback;
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void XPortTest_RunNotStarted(void)
+{
+    T_DjiXPortLimitAngle limitAngle;
+    T_DjiTestXPortStateStatistics statistics;
+
+    TEST_ASSERT(DjiTest_XPortStateGetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_JOINT_ANGLE, &limitAngle) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT(DjiTest_XPortStateRefreshLimitAngles() == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT(DjiTest_XPortStateGetStatistics(&statistics) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+    TEST_ASSERT(DjiTest_XPortStateStop() == DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+}
+
+static void XPortTest_RunLimitAngleCache(void)
+{
+    T_DjiXPortLimitAngle limitAngle;
+    T_DjiXPortLimitAngle newLimitAngle = {.upperLimit = 250, .lowerLimit = -250};
+    uint8_t category;
+    uint32_t i;
+
+    memset(&s_backend, 0, sizeof(s_backend));
+    for (category = 0; category < DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM; category++) {
+        s_backend.limitAngles[category].upperLimit = (int16_t) (300 + category);
+        s_backend.limitAngles[category].lowerLimit = (int16_t) (-300 - category);
+    }
+
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateStart(&s_testBackend));
+    TEST_ASSERT(DjiTest_XPortStateStart(&s_testBackend) == DJI_ERROR_SYSTEM_MODULE_CODE_BUSY);
+    TEST_ASSERT(s_zoomChangeCallback != NULL);
+    TEST_ASSERT(DjiTest_XPortStateGetLimitAngle((E_DjiXPortLimitAngleCategory) DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM,
+                                                &limitAngle) == DJI_ERROR_SYSTEM_MODULE_CODE_INVALID_PARAMETER);
+
+    // every category is read once, then served from the cache
+    for (i = 0; i < 10; i++) {
+        for (category = 0; category < DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM; category++) {
+            TEST_ASSERT_SUCCESS(DjiTest_XPortStateGetLimitAngle((E_DjiXPortLimitAngleCategory) category, &limitAngle));
+            TEST_ASSERT(limitAngle.upperLimit == 300 + category && limitAngle.lowerLimit == -300 - category);
+        }
+    }
+    TEST_ASSERT(XPortTest_GetBackend().getCount == DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM);
+
+    // a set goes to XPort and into the cache, it is not read back
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateSetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_YAW_JOINT_ANGLE,
+                                                        newLimitAngle));
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateGetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_YAW_JOINT_ANGLE, &limitAngle));
+    TEST_ASSERT(limitAngle.upperLimit == newLimitAngle.upperLimit && limitAngle.lowerLimit == newLimitAngle.lowerLimit);
+    TEST_ASSERT(XPortTest_GetBackend().setCount == 1);
+    TEST_ASSERT(XPortTest_GetBackend().getCount == DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM);
+}
+
+static void XPortTest_RunSpeedConversionFactor(void)
+{
+    T_DjiTestXPortStateStatistics statistics;
+    uint32_t setFactorCount;
+    uint32_t i;
+
+    // 1x gives the factor already applied, nothing goes over the link
+    s_zoomChangeCallback(1.0f, 1.0f);
+    s_zoomChangeCallback(0.0f, 1.0f);
+    Osal_TaskSleepMs(100);
+    TEST_ASSERT(XPortTest_GetBackend().setFactorCount == 0);
+
+    // a burst of notifications only has to end on the newest factor, the intermediate ones may be skipped
+    for (i = 1; i <= XPORT_TEST_ZOOM_CHANGE_NUM; i++) {
+        s_zoomChangeCallback(1.0f + (float) i * 0.1f, 2.0f);
+    }
+    XPortTest_WaitForSetFactorCount(1);
+    Osal_TaskSleepMs(100);
+    TEST_ASSERT(XPortTest_GetBackend().setFactorCount <= XPORT_TEST_ZOOM_CHANGE_NUM);
+    TEST_ASSERT(XPortTest_GetBackend().lastFactor == 1 / ((1.0f + XPORT_TEST_ZOOM_CHANGE_NUM * 0.1f) * 2.0f));
+
+    // zooming out below 1x gives a factor above 1 as well
+    setFactorCount = XPortTest_GetBackend().setFactorCount;
+    s_zoomChangeCallback(0.5f, 1.0f);
+    XPortTest_WaitForSetFactorCount(setFactorCount + 1);
+    TEST_ASSERT(XPortTest_GetBackend().lastFactor == 2.0f);
+
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateGetStatistics(&statistics));
+    TEST_ASSERT(statistics.zoomChangeCount == XPORT_TEST_ZOOM_CHANGE_NUM + 2);
+    TEST_ASSERT(statistics.setSpeedConversionFactorCount == XPortTest_GetBackend().setFactorCount);
+
+    printf("speed conversion factor: %u zoom changes, %u sets\n", statistics.zoomChangeCount,
+           statistics.setSpeedConversionFactorCount);
+}
+
+static void XPortTest_RunSystemStateRefresh(void)
+{
+    T_DjiGimbalSystemState systemState = {0};
+    T_DjiXPortLimitAngle limitAngle;
+    uint32_t getCount;
+
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateRegLimitAngleChangeCallback(XPortTest_LimitAngleChangeCallback));
+
+    // the first state and the unrelated fields do not refresh the limits
+    DjiTest_XPortStateUpdateSystemState(&systemState);
+    systemState.blockingFlag = true;
+    DjiTest_XPortStateUpdateSystemState(&systemState);
+    Osal_TaskSleepMs(100);
+    getCount = XPortTest_GetBackend().getCount;
+    TEST_ASSERT(getCount == DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM);
+
+    // a mounting change reads all of them again, only the changed one is notified
+    pthread_mutex_lock(&s_backendMutex);
+    s_backend.limitAngles[DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_JOINT_ANGLE].upperLimit = 900;
+    pthread_mutex_unlock(&s_backendMutex);
+    systemState.mountedUpward = true;
+    DjiTest_XPortStateUpdateSystemState(&systemState);
+    XPortTest_WaitForGetCount(getCount + DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM);
+    Osal_TaskSleepMs(100);
+    TEST_ASSERT(XPortTest_GetBackend().limitAngleChangeCount == 1);
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateGetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_PITCH_JOINT_ANGLE, &limitAngle));
+    TEST_ASSERT(limitAngle.upperLimit == 900);
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateGetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_YAW_JOINT_ANGLE, &limitAngle));
+    TEST_ASSERT(limitAngle.upperLimit == 250);
+
+    // an explicit refresh and a gimbal mode change read them again, nothing changed this time
+    getCount = XPortTest_GetBackend().getCount;
+
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateRefreshLimitAngles());
+    XPortTest_WaitForGetCount(getCount + DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM);
+
+    systemState.gimbalMode = DJI_GIMBAL_MODE_YAW_FOLLOW;
+    DjiTest_XPortStateUpdateSystemState(&systemState);
+    XPortTest_WaitForGetCount(getCount + 2 * DJI_TEST_XPORT_LIMIT_ANGLE_CATEGORY_NUM);
+    TEST_ASSERT(XPortTest_GetBackend().limitAngleChangeCount == 1);
+
+    printf("system state refresh: %u limit angle reads\n", XPortTest_GetBackend().getCount);
+}
+
+static void XPortTest_RunFailingBackend(void)
+{
+    T_DjiXPortLimitAngle limitAngle;
+
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateStop());
+    TEST_ASSERT(s_zoomChangeCallback == NULL);
+
+    // a restarted state has an empty cache, a failed read is reported and not cached
+    memset(&s_backend, 0, sizeof(s_backend));
+    s_backend.isGetFailing = true;
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateStart(&s_testBackend));
+    TEST_ASSERT(DjiTest_XPortStateGetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_ROLL_JOINT_ANGLE, &limitAngle) ==
+                DJI_ERROR_SYSTEM_MODULE_CODE_SYSTEM_ERROR);
+
+    pthread_mutex_lock(&s_backendMutex);
+    s_backend.isGetFailing = false;
+    s_backend.limitAngles[DJI_XPORT_LIMIT_ANGLE_CATEGORY_ROLL_JOINT_ANGLE].upperLimit = 123;
+    pthread_mutex_unlock(&s_backendMutex);
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateGetLimitAngle(DJI_XPORT_LIMIT_ANGLE_CATEGORY_ROLL_JOINT_ANGLE, &limitAngle));
+    TEST_ASSERT(limitAngle.upperLimit == 123);
+    TEST_ASSERT(XPortTest_GetBackend().getCount == 2);
+
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateStop());
+}
+
+/* Stop and start the state again and again while a zoom notification that passed the unregistration keeps coming. */
+static void XPortTest_RunStopRace(void)
+{
+    T_DjiTestXPortStateStatistics statistics;
+    pthread_t notifyThread;
+    uint32_t i;
+
+    memset(&s_backend, 0, sizeof(s_backend));
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateStart(&s_testBackend));
+    s_stopRaceCallback = s_zoomChangeCallback;
+    s_isStopRaceNotifying = true;
+    TEST_ASSERT(pthread_create(&notifyThread, NULL, XPortTest_StopRaceNotifyTask, NULL) == 0);
+
+    for (i = 0; i < XPORT_TEST_STOP_RACE_CYCLE_NUM; i++) {
+        usleep(1000);
+        TEST_ASSERT_SUCCESS(DjiTest_XPortStateStop());
+        TEST_ASSERT(DjiTest_XPortStateGetStatistics(&statistics) ==
+                    DJI_ERROR_SYSTEM_MODULE_CODE_NONSUPPORT_IN_CURRENT_STATE);
+        TEST_ASSERT_SUCCESS(DjiTest_XPortStateStart(&s_testBackend));
+    }
+
+    s_isStopRaceNotifying = false;
+    TEST_ASSERT(pthread_join(notifyThread, NULL) == 0);
+    TEST_ASSERT_SUCCESS(DjiTest_XPortStateStop());
+
+    printf("stop race: %u cycles, %u factor sets\n", XPORT_TEST_STOP_RACE_CYCLE_NUM,
+           XPortTest_GetBackend().setFactorCount);
+}
+
+static void *XPortTest_StopRaceNotifyTask(void *arg)
+{
+    uint32_t i = 0;
+
+    (void) arg;
+
+    while (s_isStopRaceNotifying) {
+        s_stopRaceCallback(1.0f + (float) (i++ % 10), 1.0f);
+        sched_yield();
+    }
+
+    return NULL;
+}
+
+static T_XPortTestBackend XPortTest_GetBackend(void)
+{
+    T_XPortTestBackend backend;
+
+    pthread_mutex_lock(&s_backendMutex);
+    backend = s_backend;
+    pthread_mutex_unlock(&s_backendMutex);
+
+    return backend;
+}
+
+static void XPortTest_WaitForSetFactorCount(uint32_t count)
+{
+    uint32_t waitedMs = 0;
+
+    while (XPortTest_GetBackend().setFactorCount < count && waitedMs < XPORT_TEST_WAIT_MS) {
+        Osal_TaskSleepMs(5);
+        waitedMs += 5;
+    }
+    TEST_ASSERT(XPortTest_GetBackend().setFactorCount >= count);
+}
+
+static void XPortTest_WaitForGetCount(uint32_t count)
+{
+    uint32_t waitedMs = 0;
+
+    while (XPortTest_GetBackend().getCount < count && waitedMs < XPORT_TEST_WAIT_MS) {
+        Osal_TaskSleepMs(5);
+        waitedMs += 5;
+    }
+    TEST_ASSERT(XPortTest_GetBackend().getCount == count);
+}
+
+static T_DjiReturnCode XPortTest_SetLimitAngleSync(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                   T_DjiXPortLimitAngle limitAngle)
+{
+    pthread_mutex_lock(&s_backendMutex);
+    s_backend.setCount++;
+    s_backend.limitAngles[limitAngleCategory] = limitAngle;
+    pthread_mutex_unlock(&s_backendMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static T_DjiReturnCode XPortTest_GetLimitAngleSync(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                                   T_DjiXPortLimitAngle *limitAngle)
+{
+    T_DjiReturnCode returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+
+    pthread_mutex_lock(&s_backendMutex);
+    s_backend.getCount++;
+    if (s_backend.isGetFailing) {
+        returnCode = DJI_ERROR_SYSTEM_MODULE_CODE_TIMEOUT;
+    } else {
+        *limitAngle = s_backend.limitAngles[limitAngleCategory];
+    }
+    pthread_mutex_unlock(&s_backendMutex);
+
+    return returnCode;
+}
+
+static T_DjiReturnCode XPortTest_SetSpeedConversionFactor(float factor)
+{
+    pthread_mutex_lock(&s_backendMutex);
+    s_backend.setFactorCount++;
+    s_backend.lastFactor = factor;
+    pthread_mutex_unlock(&s_backendMutex);
+
+    return DJI_ERROR_SYSTEM_MODULE_CODE_SUCCESS;
+}
+
+static void XPortTest_LimitAngleChangeCallback(E_DjiXPortLimitAngleCategory limitAngleCategory,
+                                               T_DjiXPortLimitAngle limitAngle)
+{
+    pthread_mutex_lock(&s_backendMutex);
+    TEST_ASSERT(limitAngle.upperLimit == s_backend.limitAngles[limitAngleCategory].upperLimit);
+    s_backend.limitAngleChangeCount++;
+    pthread_mutex_unlock(&s_backendMutex);
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,407 @@
+/**
+ ********************************************************************
+ * @file    ymodem_core_test.c
+ * @brief   Runs the YMODEM receiver of the STM32F4 bootloader against a YMODEM sender over a pty, checking
+ * that files arrive intact through corrupted packets and lost acknowledges.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <termios.h>
+#include <unistd.h>
+#include "test_common.h"
+#include "osal/osal.h"
+#include "ymodem_core.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define YMODEM_TEST_SOH                 (0x01)
+#define YMODEM_TEST_STX                 (0x02)
+#define YMODEM_TEST_EOT                 (0x04)
+#define YMODEM_TEST_ACK                 (0x06)
+#define YMODEM_TEST_CA                  (0x18)
+#define YMODEM_TEST_CRC16               ('C')
+
+//ends with a short packet, sent as a 128 bytes one
+#define YMODEM_TEST_FILE_SIZE           (40 * 1024 + 100)
+#define YMODEM_TEST_FILE_SIZE_LIMIT     (64 * 1024)
+#define YMODEM_TEST_FILE_NAME           "app.bin"
+#define YMODEM_TEST_SENDER_TIMEOUT_MS   (100)
+#define YMODEM_TEST_SENDER_WAIT_MS      (5000)
+#define YMODEM_TEST_SENDER_RETRY_MAX    (10)
+#define YMODEM_TEST_RECEIVER_TIMEOUT_MS (1000)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    const char *name;
+    uint32_t fileSize;
+    uint32_t corruptEveryPacket;   /*!< the first try of every Nth data packet has a flipped byte, 0 for none */
+    uint32_t dropEveryAck;         /*!< every Nth acknowledge of a data packet is lost, 0 for none */
+    E_YmodemCoreResult expectedResult;
+} T_YmodemTestCase;
+
+typedef struct {
+    const T_YmodemTestCase *testCase;
+    T_YmodemCoreReceiver receiver;
+    int masterFd;
+    int slaveFd;
+    uint32_t ackCount;
+    uint8_t file[YMODEM_TEST_FILE_SIZE_LIMIT];
+    uint32_t fileWrittenSize;
+    const uint8_t *lastWriteData;
+    bool isFileOpened;
+    bool isFileComplete;
+    bool isSenderCancelled;
+    bool isSenderDone;
+} T_YmodemTestContext;
+
+/* Private values -------------------------------------------------------------*/
+static const T_YmodemTestCase s_ymodemTestCases[] = {
+    {"clean", YMODEM_TEST_FILE_SIZE, 0, 0, YMODEM_CORE_OK},
+    {"corrupted packets", YMODEM_TEST_FILE_SIZE, 7, 0, YMODEM_CORE_OK},
+    {"lost acknowledges", YMODEM_TEST_FILE_SIZE, 0, 5, YMODEM_CORE_OK},
+    {"corrupted packets and lost acknowledges", YMODEM_TEST_FILE_SIZE, 3, 4, YMODEM_CORE_OK},
+    {"file too large", YMODEM_TEST_FILE_SIZE_LIMIT + 1, 0, 0, YMODEM_CORE_LIMIT},
+};
+static uint8_t s_ymodemTestImage[YMODEM_TEST_FILE_SIZE_LIMIT + 1];
+static uint32_t s_ymodemTestPacketBuffer[2][YMODEM_CORE_PACKET_BUFFER_SIZE / sizeof(uint32_t)];
+static T_YmodemTestContext s_ymodemTestContext;
+
+/* Private functions declaration ---------------------------------------------*/
+static void YmodemTest_Run(const T_YmodemTestCase *testCase);
+static void YmodemTest_OpenPty(T_YmodemTestContext *context);
+static uint32_t YmodemTest_Read(void *userData, uint8_t *buf, uint32_t size, uint32_t timeoutMs);
+static void YmodemTest_Write(void *userData, const uint8_t *buf, uint32_t size);
+static bool YmodemTest_FileOpen(void *userData, const char *fileName, uint32_t fileSize);
+static bool YmodemTest_FileWrite(void *userData, uint32_t offset, const uint8_t *data, uint32_t size);
+static bool YmodemTest_FileClose(void *userData, bool complete);
+static void *YmodemTest_SenderTask(void *arg);
+static int YmodemTest_SenderGetByte(T_YmodemTestContext *context, uint32_t timeoutMs);
+static bool YmodemTest_SenderWaitFor(T_YmodemTestContext *context, uint8_t byte);
+static bool YmodemTest_SenderSendPacket(T_YmodemTestContext *context, uint8_t number, const uint8_t *data,
+                                        uint32_t dataSize, bool isCorrupted);
+static uint16_t YmodemTest_Crc16(const uint8_t *data, uint32_t size);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(void)
+{
+    for (uint32_t i = 0; i < sizeof(s_ymodemTestImage); i++) {
+        s_ymodemTestImage[i] = (uint8_t) (i * 31 + (i >> 10));
+    }
+
+    for (uint32_t i = 0; i < sizeof(s_ymodemTestCases) / sizeof(s_ymodemTestCases[0]); i++) {
+        YmodemTest_Run(&s_ymodemTestCases[i]);
+    }
+
+    printf("ymodem core test passed\n");
+    return 0;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static void YmodemTest_Run(const T_YmodemTestCase *testCase)
+{
+    static const T_YmodemCoreIo io = {
+        .read = YmodemTest_Read,
+        .write = YmodemTest_Write,
+        .fileOpen = YmodemTest_FileOpen,
+        .fileWrite = YmodemTest_FileWrite,
+        .fileClose = YmodemTest_FileClose,
+        .userData = &s_ymodemTestContext,
+    };
+    T_YmodemTestContext *context = &s_ymodemTestContext;
+    E_YmodemCoreResult result;
+    pthread_t sender;
+
+    memset(context, 0, sizeof(*context));
+    context->testCase = testCase;
+    YmodemTest_OpenPty(context);
+    YmodemCore_InitReceiver(&context->receiver, &io, s_ymodemTestPacketBuffer[0], s_ymodemTestPacketBuffer[1]);
+    context->receiver.packetTimeoutMs = YMODEM_TEST_RECEIVER_TIMEOUT_MS;
+
+    TEST_ASSERT(pthread_create(&sender, NULL, YmodemTest_SenderTask, context) == 0);
+    result = YmodemCore_Receive(&context->receiver);
+    TEST_ASSERT(pthread_join(sender, NULL) == 0);
+    close(context->slaveFd);
+    close(context->masterFd);
+
+    printf("%s: result %d, packets %u, duplicates %u, errors %u\n", testCase->name, result,
+           context->receiver.statistics.packetCount, context->receiver.statistics.duplicatePacketCount,
+           context->receiver.statistics.errorCount);
+    TEST_ASSERT(result == testCase->expectedResult);
+
+    if (result != YMODEM_CORE_OK) {
+        TEST_ASSERT(context->isSenderCancelled);
+        TEST_ASSERT(context->isFileOpened == false);
+        return;
+    }
+
+    TEST_ASSERT(context->isSenderDone);
+    TEST_ASSERT(context->isFileComplete);
+    TEST_ASSERT(strcmp(context->receiver.fileName, YMODEM_TEST_FILE_NAME) == 0);
+    TEST_ASSERT(context->receiver.fileSize == testCase->fileSize);
+    // The padding of the last packet is not written.
+    TEST_ASSERT(context->fileWrittenSize == testCase->fileSize);
+    TEST_ASSERT(memcmp(context->file, s_ymodemTestImage, testCase->fileSize) == 0);
+    if (testCase->corruptEveryPacket != 0) {
+        TEST_ASSERT(context->receiver.statistics.errorCount != 0);
+    }
+    if (testCase->dropEveryAck != 0) {
+        TEST_ASSERT(context->receiver.statistics.duplicatePacketCount != 0);
+    }
+}
+
+/* The receiver runs on the master side, the sender on the raw slave side, as a terminal program on a serial port. */
+static void YmodemTest_OpenPty(T_YmodemTestContext *context)
+{
+    struct termios attributes;
+
+    context->masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+    TEST_ASSERT(context->masterFd >= 0);
+    TEST_ASSERT(grantpt(context->masterFd) == 0 && unlockpt(context->masterFd) == 0);
+
+    context->slaveFd = open(ptsname(context->masterFd), O_RDWR | O_NOCTTY);
+    TEST_ASSERT(context->slaveFd >= 0);
+    TEST_ASSERT(tcgetattr(context->slaveFd, &attributes) == 0);
+    cfmakeraw(&attributes);
+    TEST_ASSERT(tcsetattr(context->slaveFd, TCSANOW, &attributes) == 0);
+}
+
+static uint32_t YmodemTest_Read(void *userData, uint8_t *buf, uint32_t size, uint32_t timeoutMs)
+{
+    T_YmodemTestContext *context = userData;
+    uint32_t readSize = 0;
+    uint32_t startMs;
+    uint32_t nowMs;
+    struct pollfd pollFd = {context->masterFd, POLLIN, 0};
+    ssize_t result;
+
+    TEST_ASSERT_SUCCESS(Osal_GetTimeMs(&startMs));
+    while (readSize < size) {
+        TEST_ASSERT_SUCCESS(Osal_GetTimeMs(&nowMs));
+        if (nowMs - startMs >= timeoutMs || poll(&pollFd, 1, (int) (timeoutMs - (nowMs - startMs))) <= 0) {
+            break;
+        }
+        result = read(context->masterFd, buf + readSize, size - readSize);
+        if (result <= 0) {
+            break;
+        }
+        readSize += (uint32_t) result;
+    }
+
+    return readSize;
+}
+
+/* Acknowledges of data packets can be lost on the way to the sender, which then repeats the packet. */
+static void YmodemTest_Write(void *userData, const uint8_t *buf, uint32_t size)
+{
+    T_YmodemTestContext *context = userData;
+    const T_YmodemCoreReceiver *receiver = &context->receiver;
+
+    if (size == 1 && buf[0] == YMODEM_TEST_ACK && context->testCase->dropEveryAck != 0 &&
+        receiver->receivedSize != 0 && receiver->receivedSize < receiver->fileSize &&
+        ++context->ackCount % context->testCase->dropEveryAck == 0) {
+        return;
+    }
+
+    TEST_ASSERT(write(context->masterFd, buf, size) == (ssize_t) size);
+}
+
+static bool YmodemTest_FileOpen(void *userData, const char *fileName, uint32_t fileSize)
+{
+    T_YmodemTestContext *context = userData;
+
+    (void) fileName;
+    if (fileSize > YMODEM_TEST_FILE_SIZE_LIMIT) {
+        return false;
+    }
+
+    context->isFileOpened = true;
+    context->fileWrittenSize = 0;
+    context->lastWriteData = NULL;
+
+    return true;
+}
+
+/* The storage may program a packet while the next one is received, so it must never get the same buffer twice. */
+static bool YmodemTest_FileWrite(void *userData, uint32_t offset, const uint8_t *data, uint32_t size)
+{
+    T_YmodemTestContext *context = userData;
+
+    TEST_ASSERT(context->isFileOpened);
+    TEST_ASSERT(data != context->lastWriteData);
+    TEST_ASSERT(offset == context->fileWrittenSize);
+    TEST_ASSERT(offset + size <= YMODEM_TEST_FILE_SIZE_LIMIT);
+
+    memcpy(&context->file[offset], data, size);
+    context->fileWrittenSize += size;
+    context->lastWriteData = data;
+
+    return true;
+}
+
+static bool YmodemTest_FileClose(void *userData, bool complete)
+{
+    T_YmodemTestContext *context = userData;
+
+    TEST_ASSERT(context->isFileOpened);
+    context->isFileOpened = false;
+    context->isFileComplete = complete;
+
+    return true;
+}
+
+/* Sends one file then the empty header that ends the session, repeating packets that are not acknowledged. */
+static void *YmodemTest_SenderTask(void *arg)
+{
+    T_YmodemTestContext *context = arg;
+    const T_YmodemTestCase *testCase = context->testCase;
+    uint8_t header[YMODEM_CORE_PACKET_SIZE] = {0};
+    const uint8_t eot = YMODEM_TEST_EOT;
+    uint32_t offset = 0;
+    uint32_t packetSize;
+    uint8_t number = 1;
+    int byte;
+    int retry;
+
+    snprintf((char *) header, sizeof(header), "%s", YMODEM_TEST_FILE_NAME);
+    snprintf((char *) header + strlen(YMODEM_TEST_FILE_NAME) + 1, sizeof(header) - strlen(YMODEM_TEST_FILE_NAME) - 1,
+             "%u 0", testCase->fileSize);
+
+    if (!YmodemTest_SenderWaitFor(context, YMODEM_TEST_CRC16) ||
+        !YmodemTest_SenderSendPacket(context, 0, header, sizeof(header), false) ||
+        !YmodemTest_SenderWaitFor(context, YMODEM_TEST_CRC16)) {
+        return NULL;
+    }
+
+    while (offset < testCase->fileSize) {
+        packetSize = testCase->fileSize - offset < YMODEM_CORE_PACKET_1K_SIZE ? testCase->fileSize - offset :
+                     YMODEM_CORE_PACKET_1K_SIZE;
+        if (!YmodemTest_SenderSendPacket(context, number, &s_ymodemTestImage[offset], packetSize,
+                                         testCase->corruptEveryPacket != 0 &&
+                                         number % testCase->corruptEveryPacket == 0)) {
+            return NULL;
+        }
+        offset += packetSize;
+        number++;
+    }
+
+    for (retry = 0; retry < YMODEM_TEST_SENDER_RETRY_MAX; retry++) {
+        TEST_ASSERT(write(context->slaveFd, &eot, 1) == 1);
+        byte = YmodemTest_SenderGetByte(context, YMODEM_TEST_SENDER_TIMEOUT_MS);
+        if (byte == YMODEM_TEST_ACK) {
+            break;
+        }
+    }
+    if (retry == YMODEM_TEST_SENDER_RETRY_MAX || !YmodemTest_SenderWaitFor(context, YMODEM_TEST_CRC16)) {
+        return NULL;
+    }
+
+    memset(header, 0, sizeof(header));
+    context->isSenderDone = YmodemTest_SenderSendPacket(context, 0, header, sizeof(header), false);
+
+    return NULL;
+}
+
+static int YmodemTest_SenderGetByte(T_YmodemTestContext *context, uint32_t timeoutMs)
+{
+    struct pollfd pollFd = {context->slaveFd, POLLIN, 0};
+    uint8_t byte;
+
+    if (poll(&pollFd, 1, (int) timeoutMs) <= 0 || read(context->slaveFd, &byte, 1) != 1) {
+        return -1;
+    }
+    if (byte == YMODEM_TEST_CA) {
+        context->isSenderCancelled = true;
+    }
+
+    return byte;
+}
+
+static bool YmodemTest_SenderWaitFor(T_YmodemTestContext *context, uint8_t byte)
+{
+    int received;
+
+    do {
+        received = YmodemTest_SenderGetByte(context, YMODEM_TEST_SENDER_WAIT_MS);
+    } while (received >= 0 && received != byte && received != YMODEM_TEST_CA);
+
+    return received == byte;
+}
+
+/* Data shorter than the packet is padded with 0x1A, a NAK or no answer makes the packet sent again. */
+static bool YmodemTest_SenderSendPacket(T_YmodemTestContext *context, uint8_t number, const uint8_t *data,
+                                        uint32_t dataSize, bool isCorrupted)
+{
+    uint8_t packet[3 + YMODEM_CORE_PACKET_1K_SIZE + 2];
+    uint32_t packetSize = dataSize > YMODEM_CORE_PACKET_SIZE ? YMODEM_CORE_PACKET_1K_SIZE : YMODEM_CORE_PACKET_SIZE;
+    uint16_t crc;
+    int byte;
+
+    packet[0] = packetSize == YMODEM_CORE_PACKET_1K_SIZE ? YMODEM_TEST_STX : YMODEM_TEST_SOH;
+    packet[1] = number;
+    packet[2] = (uint8_t) ~number;
+    memcpy(&packet[3], data, dataSize);
+    memset(&packet[3 + dataSize], 0x1A, packetSize - dataSize);
+    crc = YmodemTest_Crc16(&packet[3], packetSize);
+    packet[3 + packetSize] = (uint8_t) (crc >> 8);
+    packet[3 + packetSize + 1] = (uint8_t) crc;
+
+    for (int retry = 0; retry < YMODEM_TEST_SENDER_RETRY_MAX; retry++) {
+        if (isCorrupted && retry == 0) {
+            packet[3 + packetSize / 2] ^= 0xFF;
+        }
+        TEST_ASSERT(write(context->slaveFd, packet, packetSize + 5) == (ssize_t) (packetSize + 5));
+        if (isCorrupted && retry == 0) {
+            packet[3 + packetSize / 2] ^= 0xFF;
+        }
+
+        do {
+            byte = YmodemTest_SenderGetByte(context, YMODEM_TEST_SENDER_TIMEOUT_MS);
+        } while (byte == YMODEM_TEST_CRC16);
+        if (byte == YMODEM_TEST_ACK) {
+            return true;
+        }
+        if (byte == YMODEM_TEST_CA) {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+/* Bitwise CRC-16/XMODEM, independent of the table of the receiver. */
+static uint16_t YmodemTest_Crc16(const uint8_t *data, uint32_t size)
+{
+    uint16_t crc = 0;
+
+    while (size--) {
+        crc ^= (uint16_t) (*data++ << 8);
+        for (int i = 0; i < 8; i++) {
+            crc = (crc & 0x8000) ? (uint16_t) ((crc << 1) ^ 0x1021) : (uint16_t) (crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,525 @@
+/**
+ ********************************************************************
+ * @file    asset_packer.c
+ * @brief   Pack asset files into one C source with an indexed blob, read by module_sample/utils/util_asset.c.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "utils/util_asset.h"
+#include "utils/util_lz4.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define ASSET_PACKER_ENTRY_NUM_MAX          (UINT16_MAX / 2)
+#define ASSET_PACKER_PATH_LEN_MAX           (512)
+#define ASSET_PACKER_SYMBOL_LEN_MAX         (128)
+#define ASSET_PACKER_LZ4_HASH_BITS          (12)
+#define ASSET_PACKER_BYTES_PER_LINE         (16)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    char *name;
+    const char *path;
+    uint8_t *data;
+    uint32_t size;
+    uint8_t *stored;
+    uint32_t storedSize;
+    uint32_t offset;
+    uint8_t compression;
+} T_AssetPackerEntry;
+
+typedef struct {
+    char *text;
+    size_t length;
+    size_t capacity;
+} T_AssetPackerOutput;
+
+/* Private functions declaration ---------------------------------------------*/
+static int AssetPacker_ReadFile(const char *path, uint8_t **data, uint32_t *size);
+static uint32_t AssetPacker_HashName(const char *name);
+static uint32_t AssetPacker_Lz4Compress(const uint8_t *src, uint32_t srcSize, uint8_t *dst);
+static uint8_t *AssetPacker_Lz4WriteLength(uint8_t *dst, uint32_t length);
+static int AssetPacker_Print(T_AssetPackerOutput *output, const char *format, ...);
+static int AssetPacker_WriteFile(const char *path, const T_AssetPackerOutput *output);
+static void AssetPacker_GetMacroName(const char *symbol, char *macro, size_t macroSize);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(int argc, char **argv)
+{
+    T_AssetPackerEntry *entries = NULL;
+    T_AssetPackerOutput source = {0};
+    T_AssetPackerOutput header = {0};
+    uint16_t *buckets = NULL;
+    uint32_t entryCount = 0;
+    uint32_t bucketCount = 2;
+    uint32_t blobSize = 0;
+    uint32_t bucket;
+    uint32_t i;
+    uint32_t j;
+    const char *symbol = NULL;
+    const char *outputBase = NULL;
+    const char *guard = NULL;
+    const char *baseName;
+    const char *separator;
+    char macro[ASSET_PACKER_SYMBOL_LEN_MAX * 2];
+    char path[ASSET_PACKER_PATH_LEN_MAX];
+    int compress = 0;
+    int ret = 1;
+    int arg;
+
+    for (arg = 1; arg < argc && argv[arg][0] == '-'; arg++) {
+        if (strcmp(argv[arg], "-z") == 0) {
+            compress = 1;
+        } else if (strcmp(argv[arg], "-s") == 0 && arg + 1 < argc) {
+            symbol = argv[++arg];
+        } else if (strcmp(argv[arg], "-o") == 0 && arg + 1 < argc) {
+            outputBase = argv[++arg];
+        } else if (strcmp(argv[arg], "-g") == 0 && arg + 1 < argc) {
+            guard = argv[++arg];
+        } else {
+            break;
+        }
+    }
+
+    if (symbol == NULL || outputBase == NULL || arg >= argc) {
+        printf("Usage: %s [-z] [-g MACRO] -s SYMBOL -o OUTPUT [NAME=]FILE...\n", argv[0]);
+        return 1;
+    }
+    for (i = 0; symbol[i] != '\0'; i++) {
+        if (!isalnum((unsigned char) symbol[i]) && symbol[i] != '_') {
+            printf("Invalid symbol %s.\n", symbol);
+            return 1;
+        }
+    }
+    if (i >= ASSET_PACKER_SYMBOL_LEN_MAX || strlen(outputBase) + 3 > sizeof(path)) {
+        printf("Symbol or output path too long.\n");
+        return 1;
+    }
+
+    entryCount = (uint32_t) (argc - arg);
+    if (entryCount > ASSET_PACKER_ENTRY_NUM_MAX) {
+        printf("Too many assets, at most %d per pack.\n", ASSET_PACKER_ENTRY_NUM_MAX);
+        return 1;
+    }
+    entries = calloc(entryCount, sizeof(T_AssetPackerEntry));
+    if (entries == NULL) {
+        goto out;
+    }
+
+    /* load and encode the assets, in the order of the command line */
+    for (i = 0; i < entryCount; i++) {
+        T_AssetPackerEntry *entry = &entries[i];
+        const char *input = argv[arg + i];
+
+        separator = strchr(input, '=');
+        if (separator != NULL) {
+            entry->name = strndup(input, (size_t) (separator - input));
+            entry->path = separator + 1;
+        } else {
+            baseName = strrchr(input, '/');
+            entry->name = strdup(baseName != NULL ? baseName + 1 : input);
+            entry->path = input;
+        }
+        if (entry->name == NULL || entry->name[0] == '\0') {
+            printf("Invalid asset %s.\n", input);
+            goto out;
+        }
+        for (j = 0; entry->name[j] != '\0'; j++) {
+            if (!isprint((unsigned char) entry->name[j]) || entry->name[j] == '"' || entry->name[j] == '\\') {
+                printf("Invalid character in asset name %s.\n", entry->name);
+                goto out;
+            }
+        }
+        for (j = 0; j < i; j++) {
+            if (strcmp(entries[j].name, entry->name) == 0) {
+                printf("Duplicate asset name %s.\n", entry->name);
+                goto out;
+            }
+        }
+
+        if (AssetPacker_ReadFile(entry->path, &entry->data, &entry->size) != 0) {
+            printf("Read %s failed.\n", entry->path);
+            goto out;
+        }
+
+        entry->stored = entry->data;
+        entry->storedSize = entry->size;
+        entry->compression = UTIL_ASSET_COMPRESSION_NONE;
+
+        if (compress && entry->size > 0) {
+            uint8_t *compressed = malloc(entry->size + entry->size / 255 + 16);
+            uint8_t *decoded = malloc(entry->size);
+            uint32_t compressedSize;
+
+            if (compressed == NULL || decoded == NULL) {
+                free(compressed);
+                free(decoded);
+                goto out;
+            }
+
+            compressedSize = AssetPacker_Lz4Compress(entry->data, entry->size, compressed);
+
+            /* the device pays the decoded size in ram, only keep the compression when it saves enough flash */
+            if (compressedSize <= entry->size - entry->size / 8) {
+                if (UtilLz4_DecompressBlock(compressed, compressedSize, decoded, entry->size) != 0 ||
+                    memcmp(decoded, entry->data, entry->size) != 0) {
+                    printf("Round trip of %s failed.\n", entry->name);
+                    free(compressed);
+                    free(decoded);
+                    goto out;
+                }
+                entry->stored = compressed;
+                entry->storedSize = compressedSize;
+                entry->compression = UTIL_ASSET_COMPRESSION_LZ4;
+            } else {
+                free(compressed);
+            }
+            free(decoded);
+        }
+
+        entry->offset = blobSize;
+        if (blobSize + (uint64_t) entry->storedSize > UINT32_MAX) {
+            printf("Pack too large.\n");
+            goto out;
+        }
+        blobSize += entry->storedSize;
+    }
+
+    /* open addressing with linear probing, at most half full so that a probe always ends on an empty bucket */
+    while (bucketCount < entryCount * 2) {
+        bucketCount <<= 1;
+    }
+    buckets = calloc(bucketCount, sizeof(uint16_t));
+    if (buckets == NULL) {
+        goto out;
+    }
+    for (i = 0; i < entryCount; i++) {
+        bucket = AssetPacker_HashName(entries[i].name) & (bucketCount - 1);
+        while (buckets[bucket] != 0) {
+            bucket = (bucket + 1) & (bucketCount - 1);
+        }
+        buckets[bucket] = (uint16_t) (i + 1);
+    }
+
+    AssetPacker_GetMacroName(symbol, macro, sizeof(macro));
+    baseName = strrchr(outputBase, '/');
+    baseName = baseName != NULL ? baseName + 1 : outputBase;
+
+    AssetPacker_Print(&header, "/* Generated by asset_packer, do not edit manually */\n");
+    AssetPacker_Print(&header, "#ifndef %s_H\n#define %s_H\n\n", macro, macro);
+    AssetPacker_Print(&header, "#include \"utils/util_asset.h\"\n\n");
+    AssetPacker_Print(&header, "#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+    AssetPacker_Print(&header, "#define %s_ENTRY_COUNT        (%u)\n\n", macro, entryCount);
+    AssetPacker_Print(&header, "extern const T_UtilAssetPack g_%s;\n\n", symbol);
+    AssetPacker_Print(&header, "#ifdef __cplusplus\n}\n#endif\n\n#endif\n");
+
+    AssetPacker_Print(&source, "/* Generated by asset_packer, do not edit manually */\n");
+    AssetPacker_Print(&source, "#include \"%s.h\"\n\n", baseName);
+    if (guard != NULL) {
+        AssetPacker_Print(&source, "#ifndef %s\n\n", guard);
+    }
+    for (i = 0; i < entryCount; i++) {
+        if (entries[i].compression == UTIL_ASSET_COMPRESSION_LZ4) {
+            AssetPacker_Print(&source, "/* %s: %u bytes, lz4 %u bytes */\n", entries[i].name, entries[i].size,
+                              entries[i].storedSize);
+        } else {
+            AssetPacker_Print(&source, "/* %s: %u bytes */\n", entries[i].name, entries[i].size);
+        }
+    }
+
+    AssetPacker_Print(&source, "static const uint8_t s_%sBlob[%u] = {", symbol, blobSize > 0 ? blobSize : 1);
+    j = 0;
+    for (i = 0; i < entryCount; i++) {
+        uint32_t k;
+
+        for (k = 0; k < entries[i].storedSize; k++, j++) {
+            AssetPacker_Print(&source, j % ASSET_PACKER_BYTES_PER_LINE == 0 ? "\n    0x%02X," : " 0x%02X,",
+                              entries[i].stored[k]);
+        }
+    }
+    AssetPacker_Print(&source, blobSize > 0 ? "\n};\n\n" : "\n    0x00,\n};\n\n");
+
+    AssetPacker_Print(&source, "static const T_UtilAssetEntry s_%sEntries[%u] = {\n", symbol, entryCount);
+    for (i = 0; i < entryCount; i++) {
+        AssetPacker_Print(&source, "    {\"%s\", 0x%08Xu, %u, %u, %u, %s},\n", entries[i].name,
+                          AssetPacker_HashName(entries[i].name), entries[i].offset, entries[i].storedSize,
+                          entries[i].size, entries[i].compression == UTIL_ASSET_COMPRESSION_LZ4 ?
+                                           "UTIL_ASSET_COMPRESSION_LZ4" : "UTIL_ASSET_COMPRESSION_NONE");
+    }
+    AssetPacker_Print(&source, "};\n\n");
+
+    AssetPacker_Print(&source, "static const uint16_t s_%sBuckets[%u] = {", symbol, bucketCount);
+    for (i = 0; i < bucketCount; i++) {
+        AssetPacker_Print(&source, i % ASSET_PACKER_BYTES_PER_LINE == 0 ? "\n    %u," : " %u,", buckets[i]);
+    }
+    AssetPacker_Print(&source, "\n};\n\n");
+
+    AssetPacker_Print(&source, "static uint8_t *s_%sCache[%u];\n\n", symbol, entryCount);
+    AssetPacker_Print(&source, "const T_UtilAssetPack g_%s = {\n", symbol);
+    AssetPacker_Print(&source, "    s_%sBlob,\n    s_%sEntries,\n    %u,\n", symbol, symbol, entryCount);
+    AssetPacker_Print(&source, "    s_%sBuckets,\n    %u,\n    s_%sCache\n};\n", symbol, bucketCount - 1, symbol);
+    if (guard != NULL) {
+        AssetPacker_Print(&source, "\n#endif\n");
+    }
+
+    if (source.text == NULL || header.text == NULL) {
+        goto out;
+    }
+
+    snprintf(path, sizeof(path), "%s.h", outputBase);
+    if (AssetPacker_WriteFile(path, &header) != 0) {
+        printf("Write %s failed.\n", path);
+        goto out;
+    }
+    snprintf(path, sizeof(path), "%s.c", outputBase);
+    if (AssetPacker_WriteFile(path, &source) != 0) {
+        printf("Write %s failed.\n", path);
+        goto out;
+    }
+
+    printf("Packed %u assets into %s.c, %u bytes of blob.\n", entryCount, outputBase, blobSize);
+    ret = 0;
+
+out:
+    if (entries != NULL) {
+        for (i = 0; i < entryCount; i++) {
+            if (entries[i].stored != entries[i].data) {
+                free(entries[i].stored);
+            }
+            free(entries[i].data);
+            free(entries[i].name);
+        }
+    }
+    free(entries);
+    free(buckets);
+    free(source.text);
+    free(header.text);
+
+    return ret;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static int AssetPacker_ReadFile(const char *path, uint8_t **data, uint32_t *size)
+{
+    FILE *file;
+    long length;
+
+    file = fopen(path, "rb");
+    if (file == NULL) {
+        return -1;
+    }
+
+    if (fseek(file, 0, SEEK_END) != 0 || (length = ftell(file)) < 0 || length > (long) INT32_MAX ||
+        fseek(file, 0, SEEK_SET) != 0) {
+        fclose(file);
+        return -1;
+    }
+
+    *data = malloc(length > 0 ? (size_t) length : 1);
+    if (*data == NULL || fread(*data, 1, (size_t) length, file) != (size_t) length) {
+        free(*data);
+        *data = NULL;
+        fclose(file);
+        return -1;
+    }
+
+    *size = (uint32_t) length;
+    fclose(file);
+
+    return 0;
+}
+
+static uint32_t AssetPacker_HashName(const char *name)
+{
+    uint32_t hash = UTIL_ASSET_NAME_HASH_OFFSET_BASIS;
+
+    while (*name != '\0') {
+        hash ^= (uint8_t) *name++;
+        hash *= UTIL_ASSET_NAME_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+/*
+ * Greedy lz4 block compressor, one candidate per hash slot. The assets are packed once at build time, the ratio
+ * matters more than the speed but this is already within a few percent of the reference compressor on json.
+ */
+static uint32_t AssetPacker_Lz4Compress(const uint8_t *src, uint32_t srcSize, uint8_t *dst)
+{
+    int32_t table[1 << ASSET_PACKER_LZ4_HASH_BITS];
+    uint8_t *out = dst;
+    uint8_t *token;
+    uint32_t anchor = 0;
+    uint32_t ip = 0;
+    uint32_t ref;
+    uint32_t sequence;
+    uint32_t hash;
+    uint32_t literalLength;
+    uint32_t matchLength;
+    uint32_t matchLimit = srcSize > UTIL_LZ4_LAST_LITERALS ? srcSize - UTIL_LZ4_LAST_LITERALS : 0;
+
+    memset(table, 0xFF, sizeof(table));
+
+    while (srcSize >= UTIL_LZ4_MF_LIMIT && ip + UTIL_LZ4_MF_LIMIT <= srcSize) {
+        memcpy(&sequence, src + ip, sizeof(sequence));
+        hash = (sequence * 2654435761u) >> (32 - ASSET_PACKER_LZ4_HASH_BITS);
+        ref = (uint32_t) table[hash];
+        table[hash] = (int32_t) ip;
+
+        if (ref == UINT32_MAX || ip - ref > UTIL_LZ4_MAX_DISTANCE ||
+            memcmp(src + ref, src + ip, UTIL_LZ4_MIN_MATCH) != 0) {
+            ip++;
+            continue;
+        }
+
+        matchLength = UTIL_LZ4_MIN_MATCH;
+        while (ip + matchLength < matchLimit && src[ref + matchLength] == src[ip + matchLength]) {
+            matchLength++;
+        }
+
+        literalLength = ip - anchor;
+        token = out++;
+        *token = (uint8_t) ((literalLength >= 15 ? 15 : literalLength) << 4);
+        if (literalLength >= 15) {
+            out = AssetPacker_Lz4WriteLength(out, literalLength - 15);
+        }
+        memcpy(out, src + anchor, literalLength);
+        out += literalLength;
+
+        *out++ = (uint8_t) ((ip - ref) & 0xFF);
+        *out++ = (uint8_t) ((ip - ref) >> 8);
+
+        matchLength -= UTIL_LZ4_MIN_MATCH;
+        *token |= (uint8_t) (matchLength >= 15 ? 15 : matchLength);
+        if (matchLength >= 15) {
+            out = AssetPacker_Lz4WriteLength(out, matchLength - 15);
+        }
+
+        ip += matchLength + UTIL_LZ4_MIN_MATCH;
+        anchor = ip;
+    }
+
+    /* the block ends with literals only */
+    literalLength = srcSize - anchor;
+    token = out++;
+    *token = (uint8_t) ((literalLength >= 15 ? 15 : literalLength) << 4);
+    if (literalLength >= 15) {
+        out = AssetPacker_Lz4WriteLength(out, literalLength - 15);
+    }
+    memcpy(out, src + anchor, literalLength);
+    out += literalLength;
+
+    return (uint32_t) (out - dst);
+}
+
+static uint8_t *AssetPacker_Lz4WriteLength(uint8_t *dst, uint32_t length)
+{
+    while (length >= 255) {
+        *dst++ = 255;
+        length -= 255;
+    }
+    *dst++ = (uint8_t) length;
+
+    return dst;
+}
+
+static int AssetPacker_Print(T_AssetPackerOutput *output, const char *format, ...)
+{
+    va_list args;
+    int length;
+    char *text;
+
+    va_start(args, format);
+    length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+    if (length < 0) {
+        return -1;
+    }
+
+    if (output->length + (size_t) length + 1 > output->capacity) {
+        size_t capacity = output->capacity > 0 ? output->capacity : 4096;
+
+        while (output->length + (size_t) length + 1 > capacity) {
+            capacity *= 2;
+        }
+        text = realloc(output->text, capacity);
+        if (text == NULL) {
+            return -1;
+        }
+        output->text = text;
+        output->capacity = capacity;
+    }
+
+    va_start(args, format);
+    vsnprintf(output->text + output->length, (size_t) length + 1, format, args);
+    va_end(args);
+    output->length += (size_t) length;
+
+    return 0;
+}
+
+/* write to a temporary file first, the compiler never sees a half written pack */
+static int AssetPacker_WriteFile(const char *path, const T_AssetPackerOutput *output)
+{
+    char tempPath[ASSET_PACKER_PATH_LEN_MAX + 8];
+    FILE *file;
+
+    snprintf(tempPath, sizeof(tempPath), "%s.tmp", path);
+    file = fopen(tempPath, "wb");
+    if (file == NULL) {
+        return -1;
+    }
+
+    if (fwrite(output->text, 1, output->length, file) != output->length) {
+        fclose(file);
+        remove(tempPath);
+        return -1;
+    }
+    if (fclose(file) != 0) {
+        remove(tempPath);
+        return -1;
+    }
+
+    return rename(tempPath, path);
+}
+
+/* widgetEnBigScreenAssetPack -> WIDGET_EN_BIG_SCREEN_ASSET_PACK */
+static void AssetPacker_GetMacroName(const char *symbol, char *macro, size_t macroSize)
+{
+    size_t length = 0;
+    size_t i;
+
+    for (i = 0; symbol[i] != '\0' && length + 2 < macroSize; i++) {
+        if (i > 0 && isupper((unsigned char) symbol[i]) && !isupper((unsigned char) symbol[i - 1])) {
+            macro[length++] = '_';
+        }
+        macro[length++] = (char) toupper((unsigned char) symbol[i]);
+    }
+    macro[length] = '\0';
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/
@@ -0,0 +1,61 @@
+# asset_packer_add_pack(<name> SYMBOL <symbol> OUTPUT <relative path without extension> [COMPRESS] [GUARD <macro>]
+#                       FILES [<asset name>=]<file>...)
+#
+# Generate <path>.c and <path>.h holding the pack g_<symbol> below the current binary directory at build time, the
+# pack is rebuilt whenever one of the files changes. COMPRESS stores the assets that shrink enough as lz4 blocks, GUARD
+# compiles the pack only when the macro is not defined.
+function(asset_packer_add_pack NAME)
+    cmake_parse_arguments(PACK "COMPRESS" "SYMBOL;OUTPUT;GUARD" "FILES" ${ARGN})
+
+    set(PACK_OUTPUT_PATH ${CMAKE_CURRENT_BINARY_DIR}/${PACK_OUTPUT})
+    get_filename_component(PACK_OUTPUT_DIR ${PACK_OUTPUT_PATH} DIRECTORY)
+
+    set(PACK_ARGS -s ${PACK_SYMBOL} -o ${PACK_OUTPUT_PATH})
+    if (PACK_COMPRESS)
+        list(APPEND PACK_ARGS -z)
+    endif ()
+    if (PACK_GUARD)
+        list(APPEND PACK_ARGS -g ${PACK_GUARD})
+    endif ()
+
+    set(PACK_DEPENDS)
+    foreach (PACK_FILE ${PACK_FILES})
+        string(REGEX REPLACE "^[^=]*=" "" PACK_FILE_PATH ${PACK_FILE})
+        list(APPEND PACK_DEPENDS ${PACK_FILE_PATH})
+    endforeach ()
+
+    add_custom_command(OUTPUT ${PACK_OUTPUT_PATH}.c ${PACK_OUTPUT_PATH}.h
+            COMMAND ${CMAKE_COMMAND} -E make_directory ${PACK_OUTPUT_DIR}
+            COMMAND asset_packer ${PACK_ARGS} ${PACK_FILES}
+            DEPENDS asset_packer ${PACK_DEPENDS}
+            COMMENT "Packing assets of ${NAME}"
+            VERBATIM)
+    add_custom_target(${NAME} ALL DEPENDS ${PACK_OUTPUT_PATH}.c ${PACK_OUTPUT_PATH}.h)
+
+    set_property(GLOBAL APPEND PROPERTY ASSET_PACKER_PACKS ${NAME})
+    set_property(GLOBAL APPEND PROPERTY ASSET_PACKER_OUTPUTS ${PACK_OUTPUT})
+endfunction()
+
+# asset_packer_add_regen_target(<name> DESTINATION <dir>)
+#
+# Add a target, not built by default, copying every pack added so far to <dir>/<relative path>.
+function(asset_packer_add_regen_target NAME)
+    cmake_parse_arguments(REGEN "" "DESTINATION" "" ${ARGN})
+
+    get_property(REGEN_PACKS GLOBAL PROPERTY ASSET_PACKER_PACKS)
+    get_property(REGEN_OUTPUTS GLOBAL PROPERTY ASSET_PACKER_OUTPUTS)
+
+    set(REGEN_COMMANDS)
+    foreach (REGEN_OUTPUT ${REGEN_OUTPUTS})
+        foreach (REGEN_EXTENSION c h)
+            list(APPEND REGEN_COMMANDS COMMAND ${CMAKE_COMMAND} -E copy_if_different
+                    ${CMAKE_CURRENT_BINARY_DIR}/${REGEN_OUTPUT}.${REGEN_EXTENSION}
+                    ${REGEN_DESTINATION}/${REGEN_OUTPUT}.${REGEN_EXTENSION})
+        endforeach ()
+    endforeach ()
+
+    add_custom_target(${NAME} ${REGEN_COMMANDS}
+            COMMENT "Copying the asset packs to ${REGEN_DESTINATION}"
+            VERBATIM)
+    add_dependencies(${NAME} ${REGEN_PACKS})
+endfunction()
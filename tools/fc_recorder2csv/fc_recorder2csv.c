@@ -0,0 +1,387 @@
+/**
+ ********************************************************************
+ * @file    fc_recorder2csv.c
+ * @brief   Convert a recording of the fc subscription recorder into one csv file per topic.
+ *
+ * @copyright (c) 2021 DJI. All rights reserved.
+ *
+ * All information contained herein is, and remains, the property of DJI.
+ * The intellectual and technical concepts contained herein are proprietary
+ * to DJI and may be covered by U.S. and foreign patents, patents in process,
+ * and protected by trade secret or copyright law.  Dissemination of this
+ * information, including but not limited to data and other proprietary
+ * material(s) incorporated within the information, in any form, is strictly
+ * prohibited without the express written consent of DJI.
+ *
+ * If you receive this source code without DJI’s authorization, you may not
+ * further disseminate the information, and you must immediately remove the
+ * source code and notify DJI of its removal. DJI reserves the right to pursue
+ * legal actions against you for any loss(es) or damage(s) caused by your
+ * failure to do so.
+ *
+ *********************************************************************
+ */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "fc_subscription/test_fc_subscription_recorder.h"
+
+/* Private constants ---------------------------------------------------------*/
+#define FC_RECORDER2CSV_FIELD_NUM_MAX           (32)
+#define FC_RECORDER2CSV_PATH_LEN_MAX            (512)
+
+/* Private types -------------------------------------------------------------*/
+typedef struct {
+    char name[64];
+    char type;
+    uint8_t size;
+} T_FcRecorder2CsvField;
+
+typedef struct {
+    uint32_t topic;
+    uint16_t dataSize;
+    uint16_t frequency;
+    char name[256];
+    T_FcRecorder2CsvField fields[FC_RECORDER2CSV_FIELD_NUM_MAX];
+    uint8_t fieldCount;
+    FILE *csvFile;
+    uint32_t recordCount;
+    uint32_t droppedCount;
+    uint32_t blockCount;
+    uint64_t firstTimeUs;
+    uint64_t lastTimeUs;
+    uint32_t maxGapUs;
+} T_FcRecorder2CsvTopic;
+
+/* Private functions declaration ---------------------------------------------*/
+static uint8_t FcRecorder2Csv_GetTypeSize(char type);
+static void FcRecorder2Csv_SanitizeName(char *name, uint32_t index);
+static int FcRecorder2Csv_ParseLayout(T_FcRecorder2CsvTopic *topic, const char *layout);
+static void FcRecorder2Csv_WriteHeader(T_FcRecorder2CsvTopic *topic);
+static void FcRecorder2Csv_WriteRecord(T_FcRecorder2CsvTopic *topic, uint32_t millisecond, uint32_t microsecond,
+                                       const uint8_t *data);
+
+/* Exported functions definition ---------------------------------------------*/
+int main(int argc, char **argv)
+{
+    T_DjiTestFcSubscriptionRecorderFileHeader fileHeader;
+    T_DjiTestFcSubscriptionRecorderTopicDescriptor descriptor;
+    T_DjiTestFcSubscriptionRecorderBlockHeader blockHeader;
+    T_FcRecorder2CsvTopic *topics = NULL;
+    T_FcRecorder2CsvTopic *topic;
+    char layout[256];
+    char csvPath[FC_RECORDER2CSV_PATH_LEN_MAX];
+    const char *outputDir;
+    uint32_t *columns = NULL;
+    uint32_t columnsSize = 0;
+    uint32_t blockSize;
+    size_t readSize;
+    uint32_t i;
+    uint32_t j;
+    long offset;
+    FILE *file;
+    int ret = 0;
+
+    if (argc < 2) {
+        printf("Usage: %s RECORDING [OUTPUT_DIR]\n", argv[0]);
+        return 1;
+    }
+    outputDir = argc > 2 ? argv[2] : ".";
+
+    file = fopen(argv[1], "rb");
+    if (file == NULL) {
+        printf("Open %s failed.\n", argv[1]);
+        return 1;
+    }
+
+    if (fread(&fileHeader, sizeof(fileHeader), 1, file) != 1 ||
+        memcmp(fileHeader.magic, DJI_TEST_FC_SUBSCRIPTION_RECORDER_FILE_MAGIC, sizeof(fileHeader.magic)) != 0) {
+        printf("%s is not a fc subscription recording.\n", argv[1]);
+        ret = 1;
+        goto out;
+    }
+    if (fileHeader.version != DJI_TEST_FC_SUBSCRIPTION_RECORDER_FILE_VERSION) {
+        printf("Unsupported recording version %d.\n", fileHeader.version);
+        ret = 1;
+        goto out;
+    }
+
+    topics = calloc(fileHeader.topicCount, sizeof(T_FcRecorder2CsvTopic));
+    if (topics == NULL) {
+        ret = 1;
+        goto out;
+    }
+
+    for (i = 0; i < fileHeader.topicCount; i++) {
+        topic = &topics[i];
+        memset(layout, 0, sizeof(layout));
+        if (fread(&descriptor, sizeof(descriptor), 1, file) != 1 ||
+            fread(topic->name, 1, descriptor.nameLength, file) != descriptor.nameLength ||
+            fread(layout, 1, descriptor.layoutLength, file) != descriptor.layoutLength) {
+            printf("Truncated topic descriptor %u.\n", i);
+            ret = 1;
+            goto out;
+        }
+
+        FcRecorder2Csv_SanitizeName(topic->name, i);
+        topic->topic = descriptor.topic;
+        topic->dataSize = descriptor.dataSize;
+        topic->frequency = descriptor.frequency;
+        if (FcRecorder2Csv_ParseLayout(topic, layout) != 0) {
+            printf("Layout of topic %s does not match its size %d, the data is written as hex.\n", topic->name,
+                   topic->dataSize);
+            topic->fieldCount = 0;
+        }
+
+        snprintf(csvPath, sizeof(csvPath), "%s/%s.csv", outputDir, topic->name);
+        topic->csvFile = fopen(csvPath, "w");
+        if (topic->csvFile == NULL) {
+            printf("Create %s failed.\n", csvPath);
+            ret = 1;
+            goto out;
+        }
+        FcRecorder2Csv_WriteHeader(topic);
+    }
+
+    while (1) {
+        offset = ftell(file);
+        readSize = fread(&blockHeader, 1, sizeof(blockHeader), file);
+        if (readSize == 0) {
+            break;
+        }
+        if (readSize != sizeof(blockHeader)) {
+            printf("Truncated block header at offset %ld, stop decoding.\n", offset);
+            ret = 1;
+            break;
+        }
+        if (blockHeader.syncWord != DJI_TEST_FC_SUBSCRIPTION_RECORDER_BLOCK_SYNC_WORD ||
+            blockHeader.topicIndex >= fileHeader.topicCount) {
+            printf("Corrupted block at offset %ld, stop decoding.\n", offset);
+            ret = 1;
+            break;
+        }
+
+        topic = &topics[blockHeader.topicIndex];
+        blockSize = blockHeader.recordCount * (2 * sizeof(uint32_t) + topic->dataSize);
+        if (blockSize > columnsSize) {
+            free(columns);
+            columns = malloc(blockSize);
+            if (columns == NULL) {
+                ret = 1;
+                goto out;
+            }
+            columnsSize = blockSize;
+        }
+        if (fread(columns, 1, blockSize, file) != blockSize) {
+            printf("Truncated block of topic %s at offset %ld.\n", topic->name, offset);
+            ret = 1;
+            break;
+        }
+
+        // Columns are stored one after the other: milliseconds, microseconds, then the records.
+        for (j = 0; j < blockHeader.recordCount; j++) {
+            FcRecorder2Csv_WriteRecord(topic, columns[j], columns[blockHeader.recordCount + j],
+                                       (const uint8_t *) &columns[2 * blockHeader.recordCount] +
+                                       j * topic->dataSize);
+        }
+        topic->droppedCount += blockHeader.droppedCount;
+        topic->blockCount++;
+    }
+
+    printf("%-36s %8s %8s %8s %10s %12s\n", "topic", "freq", "records", "dropped", "rate(Hz)", "max gap(us)");
+    for (i = 0; i < fileHeader.topicCount; i++) {
+        topic = &topics[i];
+        printf("%-36s %8d %8u %8u %10.1f %12u\n", topic->name, topic->frequency, topic->recordCount,
+               topic->droppedCount, topic->recordCount > 1 && topic->lastTimeUs > topic->firstTimeUs ?
+                                    (double) (topic->recordCount - 1) * 1000000 /
+                                    (double) (topic->lastTimeUs - topic->firstTimeUs) : 0.0,
+               topic->maxGapUs);
+    }
+
+out:
+    if (topics != NULL) {
+        for (i = 0; i < fileHeader.topicCount; i++) {
+            if (topics[i].csvFile != NULL) {
+                fclose(topics[i].csvFile);
+            }
+        }
+        free(topics);
+    }
+    free(columns);
+    fclose(file);
+
+    return ret;
+}
+
+/* Private functions definition-----------------------------------------------*/
+static uint8_t FcRecorder2Csv_GetTypeSize(char type)
+{
+    switch (type) {
+        case 'b':
+        case 'B':
+            return 1;
+        case 'h':
+        case 'H':
+            return 2;
+        case 'i':
+        case 'I':
+        case 'f':
+            return 4;
+        case 'd':
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+/* The name comes from the recording and becomes a file name, keep it inside the output directory. */
+static void FcRecorder2Csv_SanitizeName(char *name, uint32_t index)
+{
+    char *c;
+
+    for (c = name; *c != '\0'; c++) {
+        if (isalnum((unsigned char) *c) == 0 && *c != '_' && *c != '-') {
+            *c = '_';
+        }
+    }
+
+    if (name[0] == '\0') {
+        sprintf(name, "topic_%u", index);
+    }
+}
+
+static int FcRecorder2Csv_ParseLayout(T_FcRecorder2CsvTopic *topic, const char *layout)
+{
+    const char *field = layout;
+    const char *colon;
+    const char *end;
+    uint32_t totalSize = 0;
+    size_t nameLength;
+
+    topic->fieldCount = 0;
+    if (layout[0] == '\0') {
+        return 0;
+    }
+
+    while (*field != '\0') {
+        end = strchr(field, ',');
+        if (end == NULL) {
+            end = field + strlen(field);
+        }
+        colon = memchr(field, ':', end - field);
+        if (colon == NULL || colon + 2 != end || topic->fieldCount >= FC_RECORDER2CSV_FIELD_NUM_MAX) {
+            return -1;
+        }
+
+        nameLength = colon - field;
+        if (nameLength >= sizeof(topic->fields[0].name)) {
+            nameLength = sizeof(topic->fields[0].name) - 1;
+        }
+        memcpy(topic->fields[topic->fieldCount].name, field, nameLength);
+        topic->fields[topic->fieldCount].name[nameLength] = '\0';
+        topic->fields[topic->fieldCount].type = colon[1];
+        topic->fields[topic->fieldCount].size = FcRecorder2Csv_GetTypeSize(colon[1]);
+        if (topic->fields[topic->fieldCount].size == 0) {
+            return -1;
+        }
+        totalSize += topic->fields[topic->fieldCount].size;
+        topic->fieldCount++;
+
+        field = *end == ',' ? end + 1 : end;
+    }
+
+    return totalSize == topic->dataSize ? 0 : -1;
+}
+
+static void FcRecorder2Csv_WriteHeader(T_FcRecorder2CsvTopic *topic)
+{
+    uint8_t i;
+
+    fprintf(topic->csvFile, "timestamp_ms,timestamp_us");
+    if (topic->fieldCount == 0) {
+        fprintf(topic->csvFile, ",data\n");
+        return;
+    }
+
+    for (i = 0; i < topic->fieldCount; i++) {
+        fprintf(topic->csvFile, ",%s", topic->fields[i].name);
+    }
+    fprintf(topic->csvFile, "\n");
+}
+
+static void FcRecorder2Csv_WriteRecord(T_FcRecorder2CsvTopic *topic, uint32_t millisecond, uint32_t microsecond,
+                                       const uint8_t *data)
+{
+    uint64_t timeUs = (uint64_t) millisecond * 1000 + microsecond % 1000;
+    union {
+        int8_t b;
+        uint8_t B;
+        int16_t h;
+        uint16_t H;
+        int32_t i;
+        uint32_t I;
+        float f;
+        double d;
+    } value;
+    uint16_t offset = 0;
+    uint8_t i;
+
+    if (topic->recordCount == 0) {
+        topic->firstTimeUs = timeUs;
+    } else if (timeUs > topic->lastTimeUs && timeUs - topic->lastTimeUs > topic->maxGapUs) {
+        topic->maxGapUs = (uint32_t) (timeUs - topic->lastTimeUs);
+    }
+    topic->lastTimeUs = timeUs;
+    topic->recordCount++;
+
+    fprintf(topic->csvFile, "%u,%u", millisecond, microsecond);
+    if (topic->fieldCount == 0) {
+        fprintf(topic->csvFile, ",");
+        for (offset = 0; offset < topic->dataSize; offset++) {
+            fprintf(topic->csvFile, "%02X", data[offset]);
+        }
+        fprintf(topic->csvFile, "\n");
+        return;
+    }
+
+    // 9 and 17 significant digits read back as the same float and double.
+    for (i = 0; i < topic->fieldCount; i++) {
+        memcpy(&value, data + offset, topic->fields[i].size);
+        offset += topic->fields[i].size;
+        switch (topic->fields[i].type) {
+            case 'b':
+                fprintf(topic->csvFile, ",%d", value.b);
+                break;
+            case 'B':
+                fprintf(topic->csvFile, ",%u", value.B);
+                break;
+            case 'h':
+                fprintf(topic->csvFile, ",%d", value.h);
+                break;
+            case 'H':
+                fprintf(topic->csvFile, ",%u", value.H);
+                break;
+            case 'i':
+                fprintf(topic->csvFile, ",%d", value.i);
+                break;
+            case 'I':
+                fprintf(topic->csvFile, ",%u", value.I);
+                break;
+            case 'f':
+                fprintf(topic->csvFile, ",%.9g", value.f);
+                break;
+            case 'd':
+                fprintf(topic->csvFile, ",%.17g", value.d);
+                break;
+            default:
+                break;
+        }
+    }
+    fprintf(topic->csvFile, "\n");
+}
+
+/****************** (C) COPYRIGHT DJI Innovations *****END OF FILE****/